@@ -43,7 +43,11 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/BandMatrix.h>
+#include <blaze/math/BatchMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/ChunkedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -63,9 +67,15 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedCompressedMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/PackingFlag.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
@@ -3913,9 +3913,10 @@
 
 // Both the \c inv() and the \c invert() functions will automatically select the most suited matrix
 // inversion algorithm depending on the size and type of the given matrix. For small matrices of
-// up to 6x6, both functions use manually optimized kernels for maximum performance. For matrices
-// larger than 6x6 the inversion is performed by means of the most suited matrix decomposition
-// method: In case of a general matrix the LU decomposition is used, for symmetric matrices the
+// up to 8x8, both functions use manually optimized kernels for maximum performance. In case of
+// matrices with compile time dimensions (as for instance StaticMatrix) these kernels do not
+// perform any dynamic memory allocation. For matrices larger than 8x8 the inversion is performed
+// by means of the most suited matrix decomposition method: In case of a general matrix the LU decomposition is used, for symmetric matrices the
 // LDLT decomposition is applied, for Hermitian matrices the LDLH decomposition is performed, and
 // for triangular matrices the inverse is computed via a forward or back substitution.
 //
@@ -4220,6 +4221,46 @@
    lq( A, L, Q );  // LQ decomposition of A
    \endcode
 
+// \n \subsection matrix_operations_decomposition_small Small Matrices
+//
+// The LU, Cholesky and QR decompositions of matrices with compile time dimensions (as for instance
+// StaticMatrix) are performed by completely unrolled kernels, which neither require a LAPACK
+// library nor perform any dynamic memory allocation. The same kernels are used for small matrices
+// with runtime dimensions (as for instance HybridMatrix).
+//
+//
+// \n \section matrix_operations_lse Linear Systems of Equations
+// <hr>
+//
+// The linear system of equations \f$ A \cdot x = b \f$ with a general square dense matrix \c A
+// can be solved via the \c solve() function:
+
+   \code
+   blaze::StaticMatrix<double,7UL,7UL,blaze::rowMajor> A;
+   blaze::StaticVector<double,7UL,blaze::columnVector> x, b;
+   // ... Initialization
+
+   solve( A, x, b );  // Solving the LSE A*x=b
+   \endcode
+
+// Multiple right-hand sides can be passed as a matrix, whose columns represent the individual
+// right-hand side vectors:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A, X, B;
+   // ... Resizing and initialization
+
+   solve( A, X, B );  // Solving the LSE A*X=B
+   \endcode
+
+// The system is solved by means of an LU decomposition with partial pivoting of a copy of \c A,
+// i.e. the given matrix is not modified. In case of matrices with compile time dimensions the
+// solution is computed by completely unrolled kernels without any dynamic memory allocation.
+// The \c solve() function throws a \c std::invalid_argument exception in case the given matrix
+// is not a square matrix or in case the sizes of the matrix and the right-hand side do not
+// match, and a \c std::runtime_error exception in case the given matrix is singular.
+//
+//
 // \n Previous: \ref matrix_types &nbsp; &nbsp; Next: \ref adaptors
 */
 //*************************************************************************************************
@@ -8879,6 +8920,22 @@
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the C++11 thread parallelization.
 //
+// On NUMA systems it is additionally recommended to pin the threads to fixed cores. This is
+// possible via the environment variable \c BLAZE_THREAD_AFFINITY, which either contains a list
+// of logical CPUs in the format used by \c taskset or the keyword \c compact, which pins the
+// threads to the CPUs available to the process in ascending order:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=0-7,16-23  // Pins the threads to the CPUs 0-7 and 16-23
+   export BLAZE_THREAD_AFFINITY=compact    // Pins the threads to the available CPUs
+   \endcode
+
+// In combination with the \c BLAZE_USE_NUMA_FIRST_TOUCH switch in the configuration file
+// <tt>./blaze/config/SMP.h</tt>, newly allocated dynamic vectors and matrices are initialized in
+// parallel with the same partitioning as the parallel assignment, such that every thread mainly
+// accesses memory of its own NUMA node. For the OpenMP-based parallelization the threads should
+// be pinned via the standard \c OMP_PROC_BIND and \c OMP_PLACES environment variables instead.
+//
 //
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
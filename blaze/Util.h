@@ -44,6 +44,8 @@
 #include <blaze/util/AlignedArray.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Algorithm.h>
+#include <blaze/util/Arena.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
@@ -60,6 +62,7 @@
 #include <blaze/util/Limits.h>
 #include <blaze/util/Logging.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
@@ -48,4 +48,29 @@ namespace blaze {
 constexpr size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Level-1 data cache size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level-1 data cache per core in Byte. It is used by
+// the packed dense matrix multiplication kernels to determine the depth of the packed panels.
+// For instance, a level-1 data cache of 32 KiByte must be specified as 32768.
+*/
+constexpr size_t l1CacheSize = 32768UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-2 cache size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level-2 cache per core in Byte. It is used by the
+// packed dense matrix multiplication kernels to determine the height of the packed panels
+// of the left-hand side operand. For instance, a level-2 cache of 256 KiByte must be specified
+// as 262144.
+*/
+constexpr size_t l2CacheSize = 262144UL;
+//*************************************************************************************************
+
 } // namespace blaze
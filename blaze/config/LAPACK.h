@@ -0,0 +1,57 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/LAPACK.h
+//  \brief Configuration of the LAPACK mode
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK mode.
+// \ingroup config
+//
+// This compilation switch enables/disables the LAPACK mode. In case the LAPACK mode is enabled,
+// the dense matrix decompositions (i.e. the lu(), llh(), and qr() functions) of large matrices
+// are handled by the according LAPACK functions. Note that in this case it is mandatory to link
+// the executable against a LAPACK library. In case the LAPACK mode is disabled, all dense matrix
+// decompositions use the native, blocked implementations of the Blaze library and LAPACK is not
+// required for these functions. The threshold between the native kernels and the LAPACK kernels
+// can be configured via the blaze::DECOMPOSITION_USER_THRESHOLD (see the
+// <tt>./blaze/config/Thresholds.h</tt> configuration file).
+//
+// Possible settings for the LAPACK switch:
+//  - Disabled: \b 0
+//  - Enabled : \b 1 (default)
+//
+// Note that changing the setting of the LAPACK mode requires a recompilation of all code using
+// the Blaze library. Also note that all remaining LAPACK-based functions (as for instance the
+// inversion functions or the LAPACK wrapper functions themselves) still require LAPACK.
+*/
+#define BLAZE_LAPACK_MODE 1
+//*************************************************************************************************
@@ -51,4 +51,43 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Number of tasks per thread for the C++11 and Boost thread-based parallelization.
+// \ingroup config
+//
+// This setting specifies into how many tasks per thread an SMP assignment is split in case of
+// the C++11 and Boost thread-based parallelization. A value of 1 results in a static partitioning
+// with a single block per thread. Larger values result in smaller blocks, which enables the
+// thread pool to balance the work load among the threads via work stealing (for instance in case
+// some of the threads are delayed by other work), at the cost of a slightly higher scheduling
+// overhead. The value must be at least 1.
+*/
+constexpr size_t smpTasksPerThread = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-aware initialization of dense vectors and matrices.
+// \ingroup config
+//
+// On NUMA systems the operating system places every memory page on the NUMA node of the thread
+// that writes to it first ("first touch"). This compilation switch enables/disables the parallel
+// initialization of the elements of newly allocated dynamic vectors and matrices with built-in
+// element types. In case the switch is set to 1, the elements are initialized by the threads of
+// the active parallelization backend, using the same partitioning as the SMP assignment. Thus
+// every thread of subsequent parallel operations primarily works on memory that is local to its
+// NUMA node. Note that the threads of the C++11 and Boost thread-based parallelization should
+// additionally be pinned via the \c BLAZE_THREAD_AFFINITY environment variable and that the
+// OpenMP threads should be pinned via the \c OMP_PROC_BIND and \c OMP_PLACES environment
+// variables. In addition, in NUMA mode the OpenMP-based parallelization distributes the work
+// statically among the threads.
+//
+// Possible settings for the NUMA-aware initialization:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_NUMA_FIRST_TOUCH 0
+//*************************************************************************************************
+
 } // namespace blaze
@@ -33,6 +33,17 @@
 //=================================================================================================
 
 
+//*************************************************************************************************
+// The following thresholds are tuned for a particular reference system. Instead of adapting
+// them manually, the complete set of thresholds can be replaced by a file that has been
+// generated for the target system by the 'thresholds' tool of the Blaze benchmark suite. For
+// that purpose, the BLAZE_THRESHOLDS_INCLUDE_FILE macro has to be defined to the name of the
+// generated file before any Blaze header is included (for instance via the command line
+// argument -DBLAZE_THRESHOLDS_INCLUDE_FILE="<MyThresholds.h>"). The generated file has to
+// provide all thresholds defined in this file.
+//*************************************************************************************************
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -259,6 +270,33 @@ constexpr size_t TSMATTDMATMULT_USER_THRESHOLD = 22500UL;
 
 
 
+//=================================================================================================
+//
+//  LAPACK THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dense matrix decomposition threshold.
+// \ingroup config
+//
+// This setting specifies the threshold between the application of the native Blaze kernels and
+// the LAPACK kernels for the LU, Cholesky, and QR decompositions of dense matrices. In case the
+// number of elements of the decomposed matrix is equal or higher than this value, the LAPACK
+// kernels are preferred over the native Blaze kernels. In case the number of elements is
+// smaller, the native Blaze kernels are used. In case the LAPACK mode is disabled (see the
+// <tt>./blaze/config/LAPACK.h</tt> configuration file), the native kernels are always used.
+//
+// The default setting for this threshold is 10000 (which for instance corresponds to a matrix
+// size of \f$ 100 \times 100 \f$). Note that in case the Blaze debug mode is active, this
+// threshold will be replaced by the blaze::DECOMPOSITION_DEBUG_THRESHOLD value.
+*/
+constexpr size_t DECOMPOSITION_USER_THRESHOLD = 10000UL;
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  SMP THRESHOLDS
@@ -1328,4 +1366,102 @@ constexpr size_t SMP_TSMATTSMATMULT_USER_THRESHOLD = 22500UL;
 constexpr size_t SMP_DVECTDVECMULT_USER_THRESHOLD = 84100UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense vector (as for instance computed by the
+// sum(), prod(), min(), and max() functions) can be executed in parallel. In case the number of
+// elements of the vector is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_DVECREDUCE_USER_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense matrix (either a total reduction to a
+// single value or a row-wise or column-wise reduction to a vector) can be executed in parallel.
+// In case the number of elements of the matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to a matrix size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+*/
+constexpr size_t SMP_DMATREDUCE_USER_THRESHOLD = 48400UL;
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief SMP batch operation threshold.
+// \ingroup config
+//
+// This threshold specifies when an operation on a batch of small matrices (see the BatchMatrix
+// class template) can be executed in parallel. In case the total number of elements of all
+// matrices of the batch is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 36000 (which corresponds to a batch of 4000
+// \f$ 3 \times 3 \f$ matrices). In case the threshold is set to 0, the operation is
+// unconditionally executed in parallel.
+*/
+constexpr size_t SMP_BATCH_USER_THRESHOLD = 36000UL;
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief SMP fused solver kernel threshold.
+// \ingroup config
+//
+// This threshold specifies when a fused kernel of the iterative solvers (as for instance the
+// combined sparse matrix/vector multiplication and dot product of the CG method) or a fused
+// evaluation of dense vector operations (see the fuse() function) can be executed in parallel.
+// In case the number of elements processed by the kernel (i.e. the number of non-zero elements
+// of a sparse matrix or the accumulated size of the involved vectors) is larger or equal to this
+// threshold, the kernel is executed in parallel. If the number of elements is below
+// this threshold the kernel is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// kernels are unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SOLVER_USER_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
 } // namespace blaze
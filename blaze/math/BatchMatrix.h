@@ -0,0 +1,197 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/BatchMatrix.h
+//  \brief Header file for the complete BatchMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_BATCHMATRIX_H_
+#define _BLAZE_MATH_BATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/BatchMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for BatchMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of BatchMatrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+class Rand< BatchMatrix<Type,M,N> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const BatchMatrix<Type,M,N> generate( size_t n ) const;
+
+   template< typename Arg >
+   inline const BatchMatrix<Type,M,N> generate( size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( BatchMatrix<Type,M,N>& batch ) const;
+
+   template< typename Arg >
+   inline void randomize( BatchMatrix<Type,M,N>& batch, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BatchMatrix.
+//
+// \param n The number of matrices of the random batch.
+// \return The generated random batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline const BatchMatrix<Type,M,N> Rand< BatchMatrix<Type,M,N> >::generate( size_t n ) const
+{
+   BatchMatrix<Type,M,N> batch( n );
+   randomize( batch );
+   return batch;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BatchMatrix.
+//
+// \param n The number of matrices of the random batch.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random batch.
+*/
+template< typename Type   // Data type of the matrices
+        , size_t M        // Number of rows
+        , size_t N >      // Number of columns
+template< typename Arg >  // Min/max argument type
+inline const BatchMatrix<Type,M,N>
+   Rand< BatchMatrix<Type,M,N> >::generate( size_t n, const Arg& min, const Arg& max ) const
+{
+   BatchMatrix<Type,M,N> batch( n );
+   randomize( batch, min, max );
+   return batch;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BatchMatrix.
+//
+// \param batch The batch to be randomized.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void Rand< BatchMatrix<Type,M,N> >::randomize( BatchMatrix<Type,M,N>& batch ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         Type* values( batch.data(i,j) );
+         for( size_t k=0UL; k<batch.size(); ++k ) {
+            randomize( values[k] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BatchMatrix.
+//
+// \param batch The batch to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type   // Data type of the matrices
+        , size_t M        // Number of rows
+        , size_t N >      // Number of columns
+template< typename Arg >  // Min/max argument type
+inline void Rand< BatchMatrix<Type,M,N> >::randomize( BatchMatrix<Type,M,N>& batch,
+                                                      const Arg& min, const Arg& max ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         Type* values( batch.data(i,j) );
+         for( size_t k=0UL; k<batch.size(); ++k ) {
+            randomize( values[k], min, max );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,139 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ColumnSelection.h
+//  \brief Header file for the complete ColumnSelection implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_COLUMNSELECTION_H_
+#define _BLAZE_MATH_COLUMNSELECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/views/ColumnSelection.h>
+#include <blaze/math/views/ElementSelection.h>
+#include <blaze/math/views/RowSelection.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION FOR COLUMNS VIEWS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for column selections.
+// \ingroup random
+//
+// This specialization of the Rand class randomizes column selections.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+class Rand< ColumnSelection<MT,SO> >
+{
+ public:
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( ColumnSelection<MT,SO>& c ) const;
+
+   template< typename Arg >
+   inline void randomize( ColumnSelection<MT,SO>& c, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a column selection.
+//
+// \param c The column selection to be randomized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void Rand< ColumnSelection<MT,SO> >::randomize( ColumnSelection<MT,SO>& c ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<c.rows(); ++i ) {
+      for( size_t j=0UL; j<c.columns(); ++j ) {
+         randomize( c(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a column selection.
+//
+// \param c The column selection to be randomized.
+// \param min The smallest possible value for an element.
+// \param max The largest possible value for an element.
+// \return void
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Arg >  // Min/max argument type
+inline void Rand< ColumnSelection<MT,SO> >::randomize( ColumnSelection<MT,SO>& c, const Arg& min, const Arg& max ) const
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<c.rows(); ++i ) {
+      for( size_t j=0UL; j<c.columns(); ++j ) {
+         randomize( c(i,j), min, max );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,6 +43,7 @@
 #include <cmath>
 #include <vector>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/TripletBuilder.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/SparseMatrix.h>
@@ -41,13 +41,16 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/Eigen.h>
 #include <blaze/math/dense/Inversion.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/LQ.h>
+#include <blaze/math/dense/LSE.h>
 #include <blaze/math/dense/LU.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
 #include <blaze/math/dense/RQ.h>
+#include <blaze/math/dense/SVD.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DMatDeclDiagExpr.h>
 #include <blaze/math/expressions/DMatDeclHermExpr.h>
@@ -62,6 +65,7 @@
 #include <blaze/math/expressions/DMatEvalExpr.h>
 #include <blaze/math/expressions/DMatForEachExpr.h>
 #include <blaze/math/expressions/DMatInvExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSerialExpr.h>
@@ -100,6 +104,7 @@
 #include <blaze/math/expressions/TSVecTDMatMultExpr.h>
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
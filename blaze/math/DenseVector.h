@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/Fusion.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/DVecDVecAddExpr.h>
 #include <blaze/math/expressions/DVecDVecDivExpr.h>
@@ -49,6 +50,7 @@
 #include <blaze/math/expressions/DVecDVecSubExpr.h>
 #include <blaze/math/expressions/DVecEvalExpr.h>
 #include <blaze/math/expressions/DVecForEachExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/DVecScalarDivExpr.h>
 #include <blaze/math/expressions/DVecScalarMultExpr.h>
 #include <blaze/math/expressions/DVecSerialExpr.h>
@@ -62,6 +64,7 @@
 #include <blaze/math/expressions/SVecSVecCrossExpr.h>
 #include <blaze/math/expressions/TDVecDVecMultExpr.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/smp/SparseVector.h>
 #include <blaze/math/Vector.h>
 #include <blaze/math/views/Subvector.h>
@@ -43,6 +43,7 @@
 #include <blaze/math/functors/Abs.h>
 #include <blaze/math/functors/Acos.h>
 #include <blaze/math/functors/Acosh.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Asin.h>
 #include <blaze/math/functors/Asinh.h>
 #include <blaze/math/functors/Atan.h>
@@ -73,6 +74,9 @@
 #include <blaze/math/functors/Log.h>
 #include <blaze/math/functors/Log2.h>
 #include <blaze/math/functors/Log10.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Real.h>
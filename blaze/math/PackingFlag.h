@@ -0,0 +1,131 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackingFlag.h
+//  \brief Header file for the packing flag values
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKINGFLAG_H_
+#define _BLAZE_MATH_PACKINGFLAG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKING FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packing flag for packed symmetric matrices.
+// \ingroup math
+//
+// Via this flag it is possible to specify a packed matrix as symmetric. Only the lower part of
+// the matrix is stored, the upper part is implied by the symmetry:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+   using blaze::columnMajor;
+
+   PackedMatrix<double,columnMajor,packedSymmetric> A( 5UL );
+   \endcode
+*/
+const size_t packedSymmetric = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packing flag for packed Hermitian matrices.
+// \ingroup math
+//
+// Via this flag it is possible to specify a packed matrix as Hermitian. Only the lower part of
+// the matrix is stored, the upper part is implied by the Hermitian symmetry:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedHermitian;
+   using blaze::columnMajor;
+
+   PackedMatrix<complex<double>,columnMajor,packedHermitian> A( 5UL );
+   \endcode
+*/
+const size_t packedHermitian = 1UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packing flag for packed lower matrices.
+// \ingroup math
+//
+// Via this flag it is possible to specify a packed matrix as lower triangular. Only the lower
+// part of the matrix is stored, the upper part is zero:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedLower;
+   using blaze::rowMajor;
+
+   PackedMatrix<double,rowMajor,packedLower> L( 5UL );
+   \endcode
+*/
+const size_t packedLower = 2UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packing flag for packed upper matrices.
+// \ingroup math
+//
+// Via this flag it is possible to specify a packed matrix as upper triangular. Only the upper
+// part of the matrix is stored, the lower part is zero:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+
+   PackedMatrix<double,rowMajor,packedUpper> U( 5UL );
+   \endcode
+*/
+const size_t packedUpper = 3UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,7 +41,10 @@
 //*************************************************************************************************
 
 #include <blaze/math/Column.h>
+#include <blaze/math/ColumnSelection.h>
+#include <blaze/math/ElementSelection.h>
 #include <blaze/math/Row.h>
+#include <blaze/math/RowSelection.h>
 #include <blaze/math/Submatrix.h>
 #include <blaze/math/Subvector.h>
 
@@ -0,0 +1,3594 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandMatrix.h
+//  \brief Header file for the implementation of a band matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsOpposedView.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/ArenaArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BANDPROXY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of band matrices.
+// \ingroup band_matrix
+//
+// The BandProxy class represents an access proxy for the elements of a BandMatrix (or a band
+// view of a dense matrix). In case the accessed element lies within the band, the proxy acts
+// like a reference to the stored element. In case the element lies outside the band, the proxy
+// represents a zero element: Reading the element returns 0, assigning 0 has no effect, and the
+// assignment of any other value results in a \a std::invalid_argument exception.
+*/
+template< typename Type >  // Data type of the accessed element
+class BandProxy : public Proxy< BandProxy<Type> >
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandProxy( Type* value ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const BandProxy& operator= ( const BandProxy& bp ) const;
+   template< typename T > inline const BandProxy& operator= ( const T& value ) const;
+   template< typename T > inline const BandProxy& operator+=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator-=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator*=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type get() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator Type() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void set( const Type& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* value_;  //!< Pointer to the stored element (\c nullptr for elements outside the band).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a BandProxy.
+//
+// \param value Pointer to the stored element (\c nullptr for elements outside the band).
+*/
+template< typename Type >  // Data type of the accessed element
+inline BandProxy<Type>::BandProxy( Type* value ) noexcept
+   : value_( value )  // Pointer to the stored element
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandProxy.
+//
+// \param bp Band proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline const BandProxy<Type>& BandProxy<Type>::operator=( const BandProxy& bp ) const
+{
+   set( bp.get() );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed band matrix element.
+//
+// \param value The new value of the band matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator=( const T& value ) const
+{
+   set( value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed band matrix element.
+//
+// \param value The right-hand side value to be added to the band matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator+=( const T& value ) const
+{
+   set( get() + value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed band matrix element.
+//
+// \param value The right-hand side value to be subtracted from the band matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator-=( const T& value ) const
+{
+   set( get() - value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed band matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator*=( const T& value ) const
+{
+   set( get() * value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed band matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator/=( const T& value ) const
+{
+   set( get() / value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed band matrix element.
+//
+// \return The current value of the band matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline Type BandProxy<Type>::get() const noexcept
+{
+   if( value_ == nullptr )
+      return Type();
+   else
+      return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to the value of the accessed band matrix element.
+//
+// \return The current value of the band matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline BandProxy<Type>::operator Type() const noexcept
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the accessed band matrix element.
+//
+// \param value The new value of the band matrix element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline void BandProxy<Type>::set( const Type& value ) const
+{
+   if( value_ != nullptr ) {
+      *value_ = value;
+   }
+   else if( !isDefault( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix element" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS BANDITERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the elements of a row/column of a band matrix.
+// \ingroup band_matrix
+//
+// The BandIterator class provides random access to all elements of a single row (row-major
+// matrices) or column (column-major matrices) of a BandMatrix or a band view, including the
+// zero elements outside the band.
+*/
+template< typename MatrixType     // Type of the band matrix
+        , typename ReferenceType  // Reference return type
+        , bool SO >               // Storage order of the band matrix
+class BandIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag       IteratorCategory;  //!< The iterator category.
+   typedef typename MatrixType::ElementType      ValueType;         //!< Type of the underlying elements.
+   typedef ReferenceType                         PointerType;       //!< Pointer return type.
+   typedef ptrdiff_t                             DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Default constructor of the BandIterator class.
+   */
+   inline BandIterator() noexcept
+      : matrix_( nullptr )  // The band matrix
+      , k_     ( 0UL )      // The index of the current row/column
+      , l_     ( 0UL )      // The index of the current element within the row/column
+   {}
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BandIterator class.
+   //
+   // \param matrix The band matrix.
+   // \param k The index of the row (row-major) or column (column-major).
+   // \param l The initial element index within the row/column.
+   */
+   inline BandIterator( MatrixType& matrix, size_t k, size_t l ) noexcept
+      : matrix_( &matrix )  // The band matrix
+      , k_     ( k )        // The index of the current row/column
+      , l_     ( l )        // The index of the current element within the row/column
+   {}
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Conversion constructor from different BandIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename MatrixType2, typename ReferenceType2 >
+   inline BandIterator( const BandIterator<MatrixType2,ReferenceType2,SO>& it ) noexcept
+      : matrix_( it.matrix_ )  // The band matrix
+      , k_     ( it.k_ )       // The index of the current row/column
+      , l_     ( it.l_ )       // The index of the current element within the row/column
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline BandIterator& operator+=( size_t inc ) noexcept {
+      l_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline BandIterator& operator-=( size_t dec ) noexcept {
+      l_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline BandIterator& operator++() noexcept {
+      ++l_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BandIterator operator++( int ) noexcept {
+      const BandIterator tmp( *this );
+      ++l_;
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline BandIterator& operator--() noexcept {
+      --l_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BandIterator operator--( int ) noexcept {
+      const BandIterator tmp( *this );
+      --l_;
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return The resulting value.
+   */
+   inline ReferenceType operator*() const {
+      return ( SO )?( (*matrix_)(l_,k_) ):( (*matrix_)(k_,l_) );
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   inline bool operator==( const BandIterator& rhs ) const noexcept {
+      return l_ == rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   inline bool operator!=( const BandIterator& rhs ) const noexcept {
+      return l_ != rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   inline bool operator<( const BandIterator& rhs ) const noexcept {
+      return l_ < rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   inline bool operator>( const BandIterator& rhs ) const noexcept {
+      return l_ > rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   inline bool operator<=( const BandIterator& rhs ) const noexcept {
+      return l_ <= rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two BandIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   inline bool operator>=( const BandIterator& rhs ) const noexcept {
+      return l_ >= rhs.l_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline DifferenceType operator-( const BandIterator& rhs ) const noexcept {
+      return static_cast<DifferenceType>( l_ ) - static_cast<DifferenceType>( rhs.l_ );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a BandIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BandIterator operator+( const BandIterator& it, size_t inc ) noexcept {
+      return BandIterator( *it.matrix_, it.k_, it.l_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a BandIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BandIterator operator+( size_t inc, const BandIterator& it ) noexcept {
+      return BandIterator( *it.matrix_, it.k_, it.l_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a BandIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const BandIterator operator-( const BandIterator& it, size_t dec ) noexcept {
+      return BandIterator( *it.matrix_, it.k_, it.l_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MatrixType* matrix_;  //!< The band matrix.
+   size_t      k_;       //!< The index of the current row/column.
+   size_t      l_;       //!< The index of the current element within the row/column.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename MatrixType2, typename ReferenceType2, bool SO2 > friend class BandIterator;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band_matrix BandMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a general band matrix.
+// \ingroup band_matrix
+//
+// \section bandmatrix_general General
+//
+// The BandMatrix class template is the representation of an arbitrary sized \f$ M \times N \f$
+// dense matrix, whose non-zero elements are restricted to a band around the diagonal. The band
+// consists of the diagonal, \a kl subdiagonals (the lower bandwidth) and \a ku superdiagonals
+// (the upper bandwidth), i.e. the element \f$ a_{ij} \f$ is stored if \f$ -kl \le j-i \le ku \f$.
+// All other elements are implicitly zero. The type of the elements and the storage order of the
+// matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// In contrast to the dense matrices of the Blaze library a BandMatrix requires only
+// \f$ (kl+ku+1) \cdot N \f$ elements of memory and all kernels operating on the band require
+// only \f$ O(N \cdot (kl+ku+1)) \f$ operations. This makes the BandMatrix the natural choice for
+// the matrices resulting from finite difference stencils:
+
+   \code
+   using blaze::BandMatrix;
+
+   // Second order central differences for the 1D Poisson equation
+   const size_t N( 100000UL );
+   BandMatrix<double> A( N, N, 1UL, 1UL );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( i > 0UL   ) A(i,i-1UL) = -1.0;
+                      A(i,i    ) =  2.0;
+      if( i+1UL < N ) A(i,i+1UL) = -1.0;
+   }
+   \endcode
+
+// \n \section bandmatrix_storage Storage Layout
+//
+// The band is stored diagonal by diagonal (diagonal-major storage): Every diagonal of the band
+// is stored in a separate, contiguous and padded array, starting with the lowest subdiagonal.
+// Within a diagonal the elements are arranged by their row index (row-major matrices) or their
+// column index (column-major matrices). Therefore the element \f$ a_{ij} \f$ of the band is
+// stored at
+
+   \code
+   A.data()[ ( kl + j - i ) * A.spacing() + ( SO ? j : i ) ]
+   \endcode
+
+// Storage positions that do not correspond to an element of the matrix (as for instance the
+// first \a kl positions of the lowest subdiagonal of a row-major matrix) are always zero. Due to
+// the diagonal-major storage the matrix/vector multiplication works on contiguous arrays and is
+// vectorized along the diagonals.
+//
+// \n \section bandmatrix_element_access Element Access
+//
+// All elements of a BandMatrix can be accessed via the function call operator. The access to
+// an element of the band returns a proxy that acts like a reference to the stored element. The
+// access to an element outside the band returns a proxy that represents a zero element, which
+// can only be set to zero:
+
+   \code
+   using blaze::BandMatrix;
+
+   BandMatrix<double> A( 5UL, 5UL, 1UL, 2UL );
+   A(1,0) =  1.0;  // Sets an element of the subdiagonal
+   A(1,3) = -2.0;  // Sets an element of the second superdiagonal
+   A(3,0) =  0.0;  // No effect
+   A(3,0) =  4.0;  // Throws an exception; invalid assignment outside the band
+   \endcode
+
+// In case a matrix is assigned to a BandMatrix, the bandwidths of the BandMatrix are extended
+// if necessary to hold all non-zero elements of the given matrix. The bandwidths can also be
+// changed explicitly by means of the resize() function.
+//
+// \n \section bandmatrix_arithmetic_operations Arithmetic Operations
+//
+// A BandMatrix can be used in all arithmetic operations of the Blaze library, but in contrast
+// to the other dense matrices it is not vectorized within expressions. In order to exploit the
+// band structure, the following kernels operate directly on the stored band:
+//
+//  - gbmv(): \f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$ (matrix/vector multiplication)
+//  - gbtrf() and gbtrs(): LU decomposition with partial pivoting and the according forward and
+//    back substitution
+//  - pbtrf() and pbtrs(): Cholesky decomposition of a positive definite band matrix and the
+//    according forward and back substitution
+//  - solveTridiagonal(): Solution of tridiagonal systems by means of the Thomas algorithm
+//  - solve(): Solution of a general band system by means of an LU decomposition
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   BandMatrix<double> A( N, N, 1UL, 1UL );
+   // ... Initialization of A
+
+   DynamicVector<double> x( N, 1.0 ), y( N );
+   gbmv( y, A, x, 1.0, 0.0 );  // y = A * x
+   y = A * x;                  // Same result via the default, element-wise kernel
+
+   DynamicMatrix<double,rowMajor> B( N, 64UL );
+   // ... Initialization of the 64 right-hand sides
+   solveTridiagonal( A, B );   // Solves all 64 systems, vectorized across the right-hand sides
+   \endcode
+*/
+template< typename Type                   // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class BandMatrix : public DenseMatrix< BandMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BandMatrix<Type,SO>        This;           //!< Type of this BandMatrix instance.
+   typedef DenseMatrix<This,SO>       BaseType;       //!< Base type of this BandMatrix instance.
+   typedef DynamicMatrix<Type,SO>     ResultType;     //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>    OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>    TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                       ElementType;    //!< Type of the matrix elements.
+   typedef const Type                 ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                CompositeType;  //!< Data type for composite expression templates.
+   typedef BandProxy<Type>            Reference;      //!< Reference to a non-constant matrix value.
+   typedef const Type                 ConstReference; //!< Reference to a constant matrix value.
+   typedef Type*                      Pointer;        //!< Pointer to the non-constant band elements.
+   typedef const Type*                ConstPointer;   //!< Pointer to the constant band elements.
+
+   typedef BandIterator<This,Reference,SO>             Iterator;       //!< Iterator over non-constant elements.
+   typedef BandIterator<const This,ConstReference,SO>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BandMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BandMatrix<ET,SO>  Other;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Due to the diagonal-major storage the matrix
+       cannot be vectorized within expressions, therefore the \a simdEnabled compilation flag
+       is always set to \a false. Note that the band kernel gbmv() is vectorized nonetheless. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandMatrix() noexcept;
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku );
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init );
+
+                                     inline BandMatrix( const BandMatrix& m );
+                                     inline BandMatrix( BandMatrix&& m ) noexcept;
+   template< typename MT, bool SO2 > inline BandMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BandMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandMatrix& operator=( const Type& rhs );
+   inline BandMatrix& operator=( const BandMatrix& rhs );
+   inline BandMatrix& operator=( BandMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline BandMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, BandMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, BandMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t lowerBandwidth() const noexcept;
+   inline size_t upperBandwidth() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline void   reset();
+   inline void   clear();
+          void   resize( size_t m, size_t n, size_t kl, size_t ku, bool preserve=true );
+   inline void   resize( size_t m, size_t n, bool preserve=true );
+   inline void   swap( BandMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Kernel functions */
+   //@{
+   void mult( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+              const Type& alpha, const Type& beta ) const;
+
+   void lu( int* ipiv );
+   void luSolve( Type* b, size_t ldb, size_t nrhs, const int* ipiv ) const;
+
+   void llh( char uplo );
+   void llhSolve( Type* b, size_t ldb, size_t nrhs, char uplo ) const;
+
+   void tridiagonalFactor( Type* BLAZE_RESTRICT cp, Type* BLAZE_RESTRICT w ) const;
+   void tridiagonalSolve( Type* b, size_t ldb, size_t nrhs,
+                          const Type* BLAZE_RESTRICT cp, const Type* BLAZE_RESTRICT w ) const;
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   //! The number of rows processed at once by the matrix/vector multiplication kernel.
+   enum : size_t { BLOCK = 512UL };
+
+   //! Compilation switch for the vectorized kernels.
+   enum : bool { vectorizable = useOptimizedKernels &&
+                                IsVectorizable<Type>::value &&
+                                HasSIMDAdd<Type,Type>::value &&
+                                HasSIMDMult<Type,Type>::value };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t padded( size_t k ) noexcept;
+
+   inline bool   isStored( size_t i, size_t j ) const noexcept;
+   inline size_t index   ( size_t i, size_t j ) const noexcept;
+   inline size_t first   ( size_t s ) const noexcept;
+   inline size_t last    ( size_t s ) const noexcept;
+   inline size_t rowBegin( size_t s ) const noexcept;
+   inline size_t rowEnd  ( size_t s ) const noexcept;
+
+   template< typename MT >
+   static void bandwidths( const MT& m, size_t& kl, size_t& ku );
+
+   template< typename T2, bool SO2 >
+   static inline void bandwidths( const BandMatrix<T2,SO2>& m, size_t& kl, size_t& ku ) noexcept;
+
+   template< typename MT, bool SO2 >
+   static inline void bandwidths( const Band<MT,SO2>& m, size_t& kl, size_t& ku ) noexcept;
+
+   template< typename MT > void assign( const MT& m );
+
+   static inline void multDiagonal( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT a,
+                                    const Type* BLAZE_RESTRICT x, size_t n, TrueType ) noexcept;
+   static inline void multDiagonal( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT a,
+                                    const Type* BLAZE_RESTRICT x, size_t n, FalseType ) noexcept;
+
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                            const Type& a, size_t n, TrueType ) noexcept;
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                            const Type& a, size_t n, FalseType ) noexcept;
+
+   static inline void scale( Type* y, const Type& a, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                //!< The current number of rows of the matrix.
+   size_t n_;                //!< The current number of columns of the matrix.
+   size_t kl_;               //!< The current number of subdiagonals of the band.
+   size_t ku_;               //!< The current number of superdiagonals of the band.
+   size_t nn_;               //!< The padded length of a single stored diagonal.
+   size_t capacity_;         //!< The maximum capacity of the band storage.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated band elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , kl_      ( 0UL )      // The current number of subdiagonals
+   , ku_      ( 0UL )      // The current number of superdiagonals
+   , nn_      ( 0UL )      // The padded length of a single diagonal
+   , capacity_( 0UL )      // The maximum capacity of the band storage
+   , v_       ( nullptr )  // The band elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a band matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+//
+// All matrix elements are initialized to the default value (for instance 0 for integral and
+// floating point data types).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku )
+   : m_       ( m )                              // The current number of rows of the matrix
+   , n_       ( n )                              // The current number of columns of the matrix
+   , kl_      ( kl )                             // The current number of subdiagonals
+   , ku_      ( ku )                             // The current number of superdiagonals
+   , nn_      ( padded( SO ? n : m ) )           // The padded length of a single diagonal
+   , capacity_( ( kl+ku+1UL ) * nn_ )            // The maximum capacity of the band storage
+   , v_       ( allocate<Type>( capacity_ ) )    // The band elements
+{
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all elements of the band.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \param init The initial value of the elements of the band.
+//
+// All elements of the band are initialized with the specified value, all elements outside the
+// band are zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init )
+   : BandMatrix( m, n, kl, ku )  // Initialization of the band storage
+{
+   *this = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( const BandMatrix& m )
+   : m_       ( m.m_ )                                 // The current number of rows of the matrix
+   , n_       ( m.n_ )                                 // The current number of columns of the matrix
+   , kl_      ( m.kl_ )                                // The current number of subdiagonals
+   , ku_      ( m.ku_ )                                // The current number of superdiagonals
+   , nn_      ( m.nn_ )                                // The padded length of a single diagonal
+   , capacity_( ( m.kl_+m.ku_+1UL ) * m.nn_ )          // The maximum capacity of the band storage
+   , v_       ( allocate<Type>( capacity_ ) )          // The band elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BandMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( BandMatrix&& m ) noexcept
+   : m_       ( m.m_        )  // The current number of rows of the matrix
+   , n_       ( m.n_        )  // The current number of columns of the matrix
+   , kl_      ( m.kl_       )  // The current number of subdiagonals
+   , ku_      ( m.ku_       )  // The current number of superdiagonals
+   , nn_      ( m.nn_       )  // The padded length of a single diagonal
+   , capacity_( m.capacity_ )  // The maximum capacity of the band storage
+   , v_       ( m.v_        )  // The band elements
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.kl_       = 0UL;
+   m.ku_       = 0UL;
+   m.nn_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// This constructor initializes the band matrix as a copy of the given matrix. The bandwidths
+// of the band matrix are chosen as the smallest bandwidths that contain all non-zero elements
+// of the given matrix. In case the given matrix is a band matrix, its bandwidths are adopted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BandMatrix<Type,SO>::BandMatrix( const Matrix<MT,SO2>& m )
+   : BandMatrix()  // Initialization of an empty matrix
+{
+   *this = ~m;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::~BandMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+//
+// The function returns a proxy that ensures that the matrix retains its band structure. Note
+// that this function only performs an index check in case BLAZE_USER_ASSERT() is active. In
+// contrast, the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return Reference( isStored( i, j ) ? v_ + index( i, j ) : nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index(i,j)];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. The diagonals
+// of the band are stored one after another, starting with the lowest subdiagonal, and the
+// distance between two diagonals is given by the spacing() function (see the storage layout
+// described in the documentation of the BandMatrix class template).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer BandMatrix<Type,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. The diagonals
+// of the band are stored one after another, starting with the lowest subdiagonal, and the
+// distance between two diagonals is given by the spacing() function (see the storage layout
+// described in the documentation of the BandMatrix class template).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer BandMatrix<Type,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements of a specific row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix), or \a nullptr in case
+// the row/column does not intersect with the band. Note that the elements of a row/column are
+// NOT contiguous in memory: in a row-major matrix element \f$ (i,j+1) \f$ is stored spacing()
+// elements after element \f$ (i,j) \f$, in a column-major matrix element \f$ (i+1,j) \f$ is
+// stored spacing() elements before element \f$ (i,j) \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer BandMatrix<Type,SO>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+
+   if( SO ) {
+      const size_t ibegin( ( i > ku_ )?( i-ku_ ):( 0UL ) );
+      return ( ibegin < m_ )?( v_ + index( ibegin, i ) ):( nullptr );
+   }
+   else {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      return ( jbegin < n_ )?( v_ + index( i, jbegin ) ):( nullptr );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements of a specific row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix), or \a nullptr in case
+// the row/column does not intersect with the band. Note that the elements of a row/column are
+// NOT contiguous in memory: in a row-major matrix element \f$ (i,j+1) \f$ is stored spacing()
+// elements after element \f$ (i,j) \f$, in a column-major matrix element \f$ (i+1,j) \f$ is
+// stored spacing() elements before element \f$ (i,j) \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer BandMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+
+   if( SO ) {
+      const size_t ibegin( ( i > ku_ )?( i-ku_ ):( 0UL ) );
+      return ( ibegin < m_ )?( v_ + index( ibegin, i ) ):( nullptr );
+   }
+   else {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      return ( jbegin < n_ )?( v_ + index( i, jbegin ) ):( nullptr );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator BandMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator BandMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator BandMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator BandMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return Iterator( *this, i, ( SO ? m_ : n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator BandMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return ConstIterator( *this, i, ( SO ? m_ : n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator BandMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid band matrix row/column access index" );
+   return ConstIterator( *this, i, ( SO ? m_ : n_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all elements of the band.
+//
+// \param rhs Scalar value to be assigned to all elements of the band.
+// \return Reference to the assigned matrix.
+//
+// All elements within the band are set to the given value, all elements outside the band
+// remain zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Type& rhs )
+{
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      std::fill( v_+s*nn_+first( s ), v_+s*nn_+last( s ), rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The band matrix is resized according to the given \f$ M \times N \f$ matrix and initialized
+// as a copy of this matrix, including its bandwidths.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const BandMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, rhs.kl_, rhs.ku_, false );
+   std::copy( rhs.v_, rhs.v_+( rhs.kl_+rhs.ku_+1UL )*rhs.nn_, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BandMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( BandMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   kl_       = rhs.kl_;
+   ku_       = rhs.ku_;
+   nn_       = rhs.nn_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.kl_       = 0UL;
+   rhs.ku_       = 0UL;
+   rhs.nn_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The band matrix is resized according to the given \f$ M \times N \f$ matrix and initialized
+// as a copy of this matrix. In case the given matrix has non-zero elements outside the current
+// band, the bandwidths of the band matrix are extended accordingly. Note that the bandwidths
+// are never reduced by this assignment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidths( tmp, kl, ku );
+
+   resize( tmp.rows(), tmp.columns(), max( kl, kl_ ), max( ku, ku_ ), false );
+   assign( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the given matrix has non-zero elements outside the current band, the bandwidths of
+// the band matrix are extended accordingly.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidths( tmp, kl, ku );
+
+   if( kl > kl_ || ku > ku_ ) {
+      resize( m_, n_, max( kl, kl_ ), max( ku, ku_ ), true );
+   }
+
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      for( size_t i=rowBegin( s ); i<rowEnd( s ); ++i ) {
+         v_[s*nn_+( SO ? i+s-kl_ : i )] += tmp( i, i+s-kl_ );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the given matrix has non-zero elements outside the current band, the bandwidths of
+// the band matrix are extended accordingly.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidths( tmp, kl, ku );
+
+   if( kl > kl_ || ku > ku_ ) {
+      resize( m_, n_, max( kl, kl_ ), max( ku, ku_ ), true );
+   }
+
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      for( size_t i=rowBegin( s ); i<rowEnd( s ); ++i ) {
+         v_[s*nn_+( SO ? i+s-kl_ : i )] -= tmp( i, i+s-kl_ );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator*=( Other rhs )
+{
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      for( size_t l=first( s ); l<last( s ); ++l ) {
+         v_[s*nn_+l] *= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      for( size_t l=first( s ); l<last( s ); ++l ) {
+         v_[s*nn_+l] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth (the number of subdiagonals) of the matrix.
+//
+// \return The lower bandwidth of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth (the number of superdiagonals) of the matrix.
+//
+// \return The upper bandwidth of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two stored diagonals.
+//
+// \return The spacing between the beginning of two stored diagonals.
+//
+// This function returns the spacing between the beginning of two stored diagonals of the band,
+// i.e. the total number of elements of a stored diagonal including the padding elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the band storage.
+//
+// \return The capacity of the band storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the band to their default value. Note that the size
+// and the bandwidths of the matrix are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset()
+{
+   std::fill( v_, v_+( kl_+ku_+1UL )*nn_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size and the bandwidths of the matrix are 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::clear()
+{
+   m_  = 0UL;
+   n_  = 0UL;
+   kl_ = 0UL;
+   ku_ = 0UL;
+   nn_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size and the bandwidths of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param kl The new number of subdiagonals of the band.
+// \param ku The new number of superdiagonals of the band.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size and bandwidths. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Note that
+// this function may invalidate all existing views (submatrices, rows, columns, ...) on the matrix
+// if it is used to shrink the matrix. In case \a preserve is \a true, all elements that are
+// contained both in the old and in the new band are preserved, all new elements are initialized
+// to 0. In case \a preserve is \a false, all elements are initialized to 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::resize( size_t m, size_t n, size_t kl, size_t ku, bool preserve )
+{
+   if( m == m_ && n == n_ && kl == kl_ && ku == ku_ ) return;
+
+   if( preserve )
+   {
+      BandMatrix tmp( m, n, kl, ku );
+
+      const size_t mmin ( min( m , m_  ) );
+      const size_t nmin ( min( n , n_  ) );
+      const size_t klmin( min( kl, kl_ ) );
+      const size_t kumin( min( ku, ku_ ) );
+
+      for( size_t i=0UL; i<mmin; ++i ) {
+         const size_t jbegin( ( i > klmin )?( i-klmin ):( 0UL ) );
+         const size_t jend  ( min( nmin, i+kumin+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j ) {
+            tmp.v_[tmp.index(i,j)] = v_[index(i,j)];
+         }
+      }
+
+      swap( tmp );
+   }
+   else
+   {
+      const size_t nn  ( padded( SO ? n : m ) );
+      const size_t size( ( kl+ku+1UL ) * nn );
+
+      if( size > capacity_ ) {
+         Type* BLAZE_RESTRICT v = allocate<Type>( size );
+         std::swap( v_, v );
+         deallocate( v );
+         capacity_ = size;
+      }
+
+      m_  = m;
+      n_  = n;
+      kl_ = kl;
+      ku_ = ku;
+      nn_ = nn;
+
+      std::fill( v_, v_+size, Type() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size, but preserves the current bandwidths
+// of the band matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   resize( m, n, kl_, ku_, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::swap( BandMatrix& m ) noexcept
+{
+   std::swap( m_ , m.m_  );
+   std::swap( n_ , m.n_  );
+   std::swap( kl_, m.kl_ );
+   std::swap( ku_, m.ku_ );
+   std::swap( nn_, m.nn_ );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Due to the diagonal-major storage the elements of a row or column are not stored contiguously
+// and the matrix cannot be used in aligned SIMD operations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRIVATE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the padded length of a stored diagonal.
+//
+// \param k The number of rows (row-major) or columns (column-major) of the matrix.
+// \return The padded length of a single stored diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::padded( size_t k ) noexcept
+{
+   return ( usePadding && vectorizable )?( nextMultiple<size_t>( k, SIMDSIZE ) ):( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ a_{ij} \f$ lies within the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isStored( size_t i, size_t j ) const noexcept
+{
+   return ( j+kl_ >= i ) && ( j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the storage position of the element \f$ a_{ij} \f$ of the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element within the band storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Element outside the band detected" );
+
+   return ( kl_+j-i )*nn_ + ( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first storage position of the given diagonal that holds a matrix element.
+//
+// \param s The index of the stored diagonal (0 for the lowest subdiagonal).
+// \return The first position within the diagonal that corresponds to a matrix element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::first( size_t s ) const noexcept
+{
+   return ( SO )?( min( last( s ), ( s > kl_ )?( s-kl_ ):( 0UL ) ) ):( rowBegin( s ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the storage position one past the last matrix element of the given diagonal.
+//
+// \param s The index of the stored diagonal (0 for the lowest subdiagonal).
+// \return The position one past the last position that corresponds to a matrix element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::last( size_t s ) const noexcept
+{
+   if( SO ) {
+      return ( m_+s > kl_ )?( min( n_, m_+s-kl_ ) ):( 0UL );
+   }
+   else {
+      return rowEnd( s );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row that intersects with the given diagonal.
+//
+// \param s The index of the stored diagonal (0 for the lowest subdiagonal).
+// \return The index of the first row with an element on the diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rowBegin( size_t s ) const noexcept
+{
+   return ( s < kl_ )?( min( m_, kl_-s ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last row that intersects with the given diagonal.
+//
+// \param s The index of the stored diagonal (0 for the lowest subdiagonal).
+// \return The index one past the last row with an element on the diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rowEnd( size_t s ) const noexcept
+{
+   const size_t ibegin( rowBegin( s ) );
+   return ( n_+kl_ > s )?( max( ibegin, min( m_, n_+kl_-s ) ) ):( ibegin );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the bandwidths of a general matrix.
+//
+// \param m The given matrix.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+//
+// This function computes the smallest lower and upper bandwidths that contain all non-default
+// elements of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the matrix
+void BandMatrix<Type,SO>::bandwidths( const MT& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( !isDefault( m(i,j) ) ) {
+            kl = max( kl, i-j );
+            break;
+         }
+      }
+      for( size_t j=m.columns(); j>i+1UL; --j ) {
+         if( !isDefault( m(i,j-1UL) ) ) {
+            ku = max( ku, j-1UL-i );
+            break;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the bandwidths of a band matrix.
+//
+// \param m The given band matrix.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+//
+// In case the given matrix is a band matrix, its bandwidths are adopted without inspection of
+// the stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T2    // Data type of the given band matrix
+        , bool SO2 >     // Storage order of the given band matrix
+inline void BandMatrix<Type,SO>::bandwidths( const BandMatrix<T2,SO2>& m, size_t& kl, size_t& ku ) noexcept
+{
+   kl = m.lowerBandwidth();
+   ku = m.upperBandwidth();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the bandwidths of a band view.
+//
+// \param m The given band view.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+//
+// In case the given matrix is a band view, its bandwidths are adopted without inspection of
+// the elements of the underlying matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the dense matrix of the band view
+        , bool SO2 >     // Storage order of the band view
+inline void BandMatrix<Type,SO>::bandwidths( const Band<MT,SO2>& m, size_t& kl, size_t& ku ) noexcept
+{
+   kl = m.lowerBandwidth();
+   ku = m.upperBandwidth();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the band of a general matrix.
+//
+// \param m The given matrix.
+// \return void
+//
+// This function copies all elements of the given matrix that lie within the current band.
+// The size of the given matrix has to match the size of the band matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the matrix
+void BandMatrix<Type,SO>::assign( const MT& m )
+{
+   BLAZE_INTERNAL_ASSERT( m.rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( m.columns() == n_, "Invalid number of columns" );
+
+   for( size_t s=0UL; s<=kl_+ku_; ++s ) {
+      for( size_t i=rowBegin( s ); i<rowEnd( s ); ++i ) {
+         v_[s*nn_+( SO ? i+s-kl_ : i )] = m( i, i+s-kl_ );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized element-wise update \f$ \vec{y} += \vec{a} \cdot \vec{x} \f$ along a diagonal.
+//
+// \param y Pointer to the first element of the target array.
+// \param a Pointer to the first element of the stored diagonal.
+// \param x Pointer to the first element of the right-hand side array.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::multDiagonal( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT a,
+                                               const Type* BLAZE_RESTRICT x, size_t n, TrueType ) noexcept
+{
+   const size_t lpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+   size_t l( 0UL );
+
+   for( ; l<lpos; l+=SIMDSIZE ) {
+      storeu( y+l, loadu( y+l ) + loadu( a+l ) * loadu( x+l ) );
+   }
+   for( ; l<n; ++l ) {
+      y[l] += a[l] * x[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default element-wise update \f$ \vec{y} += \vec{a} \cdot \vec{x} \f$ along a diagonal.
+//
+// \param y Pointer to the first element of the target array.
+// \param a Pointer to the first element of the stored diagonal.
+// \param x Pointer to the first element of the right-hand side array.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::multDiagonal( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT a,
+                                               const Type* BLAZE_RESTRICT x, size_t n, FalseType ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] += a[l] * x[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized update \f$ \vec{y} += a \vec{x} \f$ of an array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                       const Type& a, size_t n, TrueType ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const SIMDType factor( set( a ) );
+
+   const size_t lpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+   size_t l( 0UL );
+
+   for( ; l<lpos; l+=SIMDSIZE ) {
+      storeu( y+l, loadu( y+l ) + loadu( x+l ) * factor );
+   }
+   for( ; l<n; ++l ) {
+      y[l] += x[l] * a;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default update \f$ \vec{y} += a \vec{x} \f$ of an array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                       const Type& a, size_t n, FalseType ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] += x[l] * a;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling \f$ \vec{y} *= a \f$ of an array.
+//
+// \param y Pointer to the first element of the array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::scale( Type* y, const Type& a, size_t n ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] *= a;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band matrix/vector multiplication \f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$.
+//
+// \param y Pointer to the first element of the target vector (of size \a M).
+// \param x Pointer to the first element of the right-hand side vector (of size \a N).
+// \param alpha The scaling factor of the matrix/vector product.
+// \param beta The scaling factor of the target vector.
+// \return void
+//
+// This kernel traverses the band diagonal by diagonal. Since both the stored diagonals and the
+// according elements of \a x and \a y are contiguous in memory, each diagonal is processed by
+// means of a vectorized element-wise multiply-add. In order to keep the partial results in
+// cache, the rows are processed in blocks of \a BLOCK rows. In case \a beta is 0, the target
+// vector is not read and may be uninitialized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::mult( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                const Type& alpha, const Type& beta ) const
+{
+   Type tmp[BLOCK];
+
+   const bool overwrite( isDefault( beta ) );
+
+   for( size_t ii=0UL; ii<m_; ii+=BLOCK )
+   {
+      const size_t iend( min( ii+BLOCK, m_ ) );
+
+      std::fill( tmp, tmp+( iend-ii ), Type() );
+
+      for( size_t s=0UL; s<=kl_+ku_; ++s )
+      {
+         const size_t ibegin( max( ii  , rowBegin( s ) ) );
+         const size_t ilast ( min( iend, rowEnd  ( s ) ) );
+
+         if( ibegin >= ilast ) continue;
+
+         multDiagonal( tmp+( ibegin-ii ), v_+s*nn_+( SO ? ibegin+s-kl_ : ibegin ),
+                       x+ibegin+s-kl_, ilast-ibegin, BoolConstant<vectorizable>() );
+      }
+
+      if( overwrite ) {
+         for( size_t i=ii; i<iend; ++i )
+            y[i] = alpha * tmp[i-ii];
+      }
+      else {
+         for( size_t i=ii; i<iend; ++i )
+            y[i] = alpha * tmp[i-ii] + beta * y[i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place LU decomposition of the band matrix with partial pivoting.
+//
+// \param ipiv Pointer to the first element of the pivot array (of size \f$ min(M,N) \f$).
+// \return void
+//
+// This kernel performs the LU decomposition of the band matrix by means of Gaussian elimination
+// with partial row pivoting in the style of the LAPACK gbtrf() function. The multipliers of
+// \a L are stored on the subdiagonals, \a U is stored on the diagonal and the superdiagonals.
+// The kernel requires the upper bandwidth to be large enough to hold the fill-in caused by
+// the row interchanges, i.e. the upper bandwidth has to be at least \f$ kl+ku \f$ with respect
+// to the bandwidths of the original matrix. The pivot indices are stored 1-based; row \a i was
+// interchanged with row \a ipiv[i]-1. In case an exactly zero pivot is encountered, the
+// elimination step is skipped (i.e. \a U is singular).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::lu( int* ipiv )
+{
+   const size_t mn( min( m_, n_ ) );
+
+   for( size_t k=0UL; k<mn; ++k )
+   {
+      const size_t iend( min( m_, k+kl_+1UL ) );
+      const size_t jend( min( n_, k+ku_+1UL ) );
+
+      size_t p( k );
+      auto pmax( abs( v_[index(k,k)] ) );
+
+      for( size_t i=k+1UL; i<iend; ++i ) {
+         const auto tmp( abs( v_[index(i,k)] ) );
+         if( tmp > pmax ) {
+            pmax = tmp;
+            p = i;
+         }
+      }
+
+      ipiv[k] = static_cast<int>( p+1UL );
+
+      if( p != k ) {
+         for( size_t j=k; j<jend; ++j ) {
+            std::swap( v_[index(k,j)], v_[index(p,j)] );
+         }
+      }
+
+      const Type pivot( v_[index(k,k)] );
+
+      if( isDefault( pivot ) ) continue;
+
+      const Type inv( Type(1) / pivot );
+
+      for( size_t i=k+1UL; i<iend; ++i ) {
+         v_[index(i,k)] *= inv;
+      }
+
+      for( size_t j=k+1UL; j<jend; ++j )
+      {
+         const Type u( v_[index(k,j)] );
+
+         if( isDefault( u ) ) continue;
+
+         for( size_t i=k+1UL; i<iend; ++i ) {
+            v_[index(i,j)] -= v_[index(i,k)] * u;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and back substitution based on the LU decomposition of the band matrix.
+//
+// \param b Pointer to the first element of the right-hand side(s).
+// \param ldb The distance between the right-hand side elements of two consecutive rows.
+// \param nrhs The number of right-hand sides stored contiguously per row.
+// \param ipiv Pointer to the first element of the pivot array.
+// \return void
+//
+// This kernel solves the system(s) \f$ A X = B \f$ based on the LU decomposition computed by
+// the lu() kernel. Row \a i of the right-hand side(s) starts at \f$ b + i \cdot ldb \f$ and
+// holds \a nrhs contiguous elements. Therefore all right-hand sides are processed at once and
+// the updates are vectorized across the right-hand sides.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::luSolve( Type* b, size_t ldb, size_t nrhs, const int* ipiv ) const
+{
+   BLAZE_INTERNAL_ASSERT( m_ == n_, "Non-square matrix detected" );
+
+   const size_t n( n_ );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t p( static_cast<size_t>( ipiv[j] ) - 1UL );
+
+      if( p != j ) {
+         std::swap_ranges( b+j*ldb, b+j*ldb+nrhs, b+p*ldb );
+      }
+
+      const size_t iend( min( n, j+kl_+1UL ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         const Type l( v_[index(i,j)] );
+         if( !isDefault( l ) )
+            axpy( b+i*ldb, b+j*ldb, -l, nrhs, BoolConstant<vectorizable>() );
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; )
+   {
+      scale( b+j*ldb, Type(1) / v_[index(j,j)], nrhs );
+
+      const size_t ibegin( ( j > ku_ )?( j-ku_ ):( 0UL ) );
+
+      for( size_t i=ibegin; i<j; ++i ) {
+         const Type u( v_[index(i,j)] );
+         if( !isDefault( u ) )
+            axpy( b+i*ldb, b+j*ldb, -u, nrhs, BoolConstant<vectorizable>() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place Cholesky decomposition of a positive definite band matrix.
+//
+// \param uplo \c 'L' to use the lower band, \c 'U' to use the upper band of the matrix.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This kernel performs the Cholesky decomposition of the band matrix in the style of the LAPACK
+// pbtrf() function. In case \a uplo is set to \c 'L', the matrix is decomposed into \f$ A = L L^H \f$
+// based on the lower band, in case \a uplo is set to \c 'U', the matrix is decomposed into
+// \f$ A = U^H U \f$ based on the upper band. The other half of the band is not referenced.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::llh( char uplo )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == n_, "Non-square matrix detected" );
+
+   const size_t n( n_ );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const auto d( real( v_[index(j,j)] ) );
+
+      if( !( d > 0 ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      const auto djj( std::sqrt( d ) );
+      v_[index(j,j)] = djj;
+
+      if( uplo == 'L' )
+      {
+         const size_t iend( min( n, j+kl_+1UL ) );
+
+         for( size_t i=j+1UL; i<iend; ++i ) {
+            v_[index(i,j)] /= djj;
+         }
+
+         for( size_t c=j+1UL; c<iend; ++c ) {
+            const Type l( conj( v_[index(c,j)] ) );
+            for( size_t r=c; r<iend; ++r ) {
+               v_[index(r,c)] -= v_[index(r,j)] * l;
+            }
+         }
+      }
+      else
+      {
+         const size_t jend( min( n, j+ku_+1UL ) );
+
+         for( size_t c=j+1UL; c<jend; ++c ) {
+            v_[index(j,c)] /= djj;
+         }
+
+         for( size_t r=j+1UL; r<jend; ++r ) {
+            const Type u( conj( v_[index(j,r)] ) );
+            for( size_t c=r; c<jend; ++c ) {
+               v_[index(r,c)] -= u * v_[index(j,c)];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and back substitution based on the Cholesky decomposition of the band matrix.
+//
+// \param b Pointer to the first element of the right-hand side(s).
+// \param ldb The distance between the right-hand side elements of two consecutive rows.
+// \param nrhs The number of right-hand sides stored contiguously per row.
+// \param uplo \c 'L' in case of a \f$ L L^H \f$, \c 'U' in case of a \f$ U^H U \f$ decomposition.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::llhSolve( Type* b, size_t ldb, size_t nrhs, char uplo ) const
+{
+   BLAZE_INTERNAL_ASSERT( m_ == n_, "Non-square matrix detected" );
+
+   const size_t n( n_ );
+
+   if( uplo == 'L' )
+   {
+      for( size_t j=0UL; j<n; ++j ) {
+         scale( b+j*ldb, Type(1) / v_[index(j,j)], nrhs );
+         const size_t iend( min( n, j+kl_+1UL ) );
+         for( size_t i=j+1UL; i<iend; ++i ) {
+            axpy( b+i*ldb, b+j*ldb, -v_[index(i,j)], nrhs, BoolConstant<vectorizable>() );
+         }
+      }
+
+      for( size_t j=n; j-- > 0UL; ) {
+         const size_t iend( min( n, j+kl_+1UL ) );
+         for( size_t i=j+1UL; i<iend; ++i ) {
+            axpy( b+j*ldb, b+i*ldb, -conj( v_[index(i,j)] ), nrhs, BoolConstant<vectorizable>() );
+         }
+         scale( b+j*ldb, Type(1) / v_[index(j,j)], nrhs );
+      }
+   }
+   else
+   {
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t ibegin( ( j > ku_ )?( j-ku_ ):( 0UL ) );
+         for( size_t i=ibegin; i<j; ++i ) {
+            axpy( b+j*ldb, b+i*ldb, -conj( v_[index(i,j)] ), nrhs, BoolConstant<vectorizable>() );
+         }
+         scale( b+j*ldb, Type(1) / v_[index(j,j)], nrhs );
+      }
+
+      for( size_t j=n; j-- > 0UL; ) {
+         scale( b+j*ldb, Type(1) / v_[index(j,j)], nrhs );
+         const size_t ibegin( ( j > ku_ )?( j-ku_ ):( 0UL ) );
+         for( size_t i=ibegin; i<j; ++i ) {
+            axpy( b+i*ldb, b+j*ldb, -v_[index(i,j)], nrhs, BoolConstant<vectorizable>() );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Factorization of a tridiagonal matrix for the Thomas algorithm.
+//
+// \param cp Pointer to the first element of the modified superdiagonal (of size \a N).
+// \param w Pointer to the first element of the inverse pivots (of size \a N).
+// \return void
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This kernel computes the modified superdiagonal \f$ c'_i = c_i w_i \f$ and the inverse pivots
+// \f$ w_i = 1 / ( d_i - a_i c'_{i-1} ) \f$ of the Thomas algorithm, where \a a, \a d, and \a c
+// denote the subdiagonal, the diagonal, and the superdiagonal of the matrix. Since the Thomas
+// algorithm does not pivot, it is only stable for diagonally dominant or positive definite
+// matrices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::tridiagonalFactor( Type* BLAZE_RESTRICT cp, Type* BLAZE_RESTRICT w ) const
+{
+   BLAZE_INTERNAL_ASSERT( m_ == n_, "Non-square matrix detected" );
+   BLAZE_INTERNAL_ASSERT( kl_ <= 1UL && ku_ <= 1UL, "Non-tridiagonal matrix detected" );
+
+   const This& A( *this );
+   const size_t n( n_ );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type denom( ( i > 0UL )?( A(i,i) - A(i,i-1UL) * cp[i-1UL] ):( A(i,i) ) );
+
+      if( !isDivisor( denom ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving the LSE of a singular matrix failed" );
+      }
+
+      w[i]  = Type(1) / denom;
+      cp[i] = ( i+1UL < n )?( A(i,i+1UL) * w[i] ):( Type() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and back substitution of the Thomas algorithm.
+//
+// \param b Pointer to the first element of the right-hand side(s).
+// \param ldb The distance between the right-hand side elements of two consecutive rows.
+// \param nrhs The number of right-hand sides stored contiguously per row.
+// \param cp Pointer to the first element of the modified superdiagonal.
+// \param w Pointer to the first element of the inverse pivots.
+// \return void
+//
+// This kernel solves the tridiagonal system(s) based on the factorization computed by the
+// tridiagonalFactor() kernel. All \a nrhs right-hand sides of a row are updated at once, i.e.
+// the sweeps are vectorized across the right-hand sides.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::tridiagonalSolve( Type* b, size_t ldb, size_t nrhs,
+                                            const Type* BLAZE_RESTRICT cp,
+                                            const Type* BLAZE_RESTRICT w ) const
+{
+   BLAZE_INTERNAL_ASSERT( m_ == n_, "Non-square matrix detected" );
+   BLAZE_INTERNAL_ASSERT( kl_ <= 1UL && ku_ <= 1UL, "Non-tridiagonal matrix detected" );
+
+   const This& A( *this );
+   const size_t n( n_ );
+
+   if( n == 0UL ) return;
+
+   scale( b, w[0UL], nrhs );
+
+   for( size_t i=1UL; i<n; ++i ) {
+      const Type a( A(i,i-1UL) );
+      if( !isDefault( a ) )
+         axpy( b+i*ldb, b+(i-1UL)*ldb, -a, nrhs, BoolConstant<vectorizable>() );
+      scale( b+i*ldb, w[i], nrhs );
+   }
+
+   for( size_t i=n-1UL; i-- > 0UL; ) {
+      axpy( b+i*ldb, b+(i+1UL)*ldb, -cp[i], nrhs, BoolConstant<vectorizable>() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void clear( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept;
+
+template< typename VT1, typename Type, bool SO, typename VT2, typename ST >
+void gbmv( DenseVector<VT1,false>& y, const BandMatrix<Type,SO>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta );
+
+template< typename Type, bool SO >
+void gbtrf( BandMatrix<Type,SO>& A, int* ipiv );
+
+template< typename Type, bool SO, typename VT >
+void gbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b, const int* ipiv );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void gbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, const int* ipiv );
+
+template< typename Type, bool SO >
+void pbtrf( BandMatrix<Type,SO>& A, char uplo );
+
+template< typename Type, bool SO, typename VT >
+void pbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b, char uplo );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void pbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, char uplo );
+
+template< typename Type, bool SO, typename VT >
+void solveTridiagonal( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void solveTridiagonal( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B );
+
+template< typename Type, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const BandMatrix<Type,SO>& A, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename Type, bool SO, typename MT1, bool SO1, typename MT2, bool SO2 >
+void solve( const BandMatrix<Type,SO>& A, DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( BandMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band matrix is in default state.
+// \ingroup band_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const BandMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup band_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the direct memory access of the band kernels.
+// \ingroup band_matrix
+//
+// This auxiliary type trait evaluates to \a true in case the band kernels can directly operate
+// on the memory of the given dense vector or matrix type, i.e. in case the type provides mutable
+// low-level data access, its elements are stored contiguously (row-major for matrices), and its
+// element type matches the element type of the band matrix.
+*/
+template< typename T      // Type of the dense vector or matrix
+        , typename Type >  // Element type of the band matrix
+struct BandDirectAccess
+   : public BoolConstant< And< HasMutableDataAccess<T>
+                             , Not< IsOpposedView<T> >
+                             , IsSame< ElementType_<T>, Type > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given band kernel to a dense vector with direct memory access.
+// \ingroup band_matrix
+//
+// \param v The dense vector.
+// \param kernel The kernel to be applied to the elements of the vector.
+// \return void
+*/
+template< typename VT      // Type of the dense vector
+        , typename Type    // Element type of the band matrix
+        , typename OP >    // Type of the band kernel
+inline EnableIf_< BandDirectAccess<VT,Type> >
+   bandApply( DenseVector<VT,false>& v, OP kernel )
+{
+   kernel( (~v).data(), 1UL, 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given band kernel to a dense vector without direct memory access.
+// \ingroup band_matrix
+//
+// \param v The dense vector.
+// \param kernel The kernel to be applied to the elements of the vector.
+// \return void
+*/
+template< typename VT      // Type of the dense vector
+        , typename Type    // Element type of the band matrix
+        , typename OP >    // Type of the band kernel
+inline DisableIf_< BandDirectAccess<VT,Type> >
+   bandApply( DenseVector<VT,false>& v, OP kernel )
+{
+   DynamicVector<Type,false> tmp( ~v );
+   kernel( tmp.data(), 1UL, 1UL );
+   (~v) = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given band kernel to a row-major dense matrix with direct memory access.
+// \ingroup band_matrix
+//
+// \param B The dense matrix.
+// \param kernel The kernel to be applied to the elements of the matrix.
+// \return void
+//
+// All columns of the given matrix are processed at once, i.e. the band kernel is vectorized
+// across the columns of the matrix.
+*/
+template< typename MT      // Type of the dense matrix
+        , typename Type    // Element type of the band matrix
+        , typename OP >    // Type of the band kernel
+inline EnableIf_< BandDirectAccess<MT,Type> >
+   bandApply( DenseMatrix<MT,rowMajor>& B, OP kernel )
+{
+   kernel( (~B).data(), (~B).spacing(), (~B).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given band kernel to a column-major dense matrix with direct memory access.
+// \ingroup band_matrix
+//
+// \param B The dense matrix.
+// \param kernel The kernel to be applied to the elements of the matrix.
+// \return void
+//
+// The columns of the given matrix are processed one after another.
+*/
+template< typename MT      // Type of the dense matrix
+        , typename Type    // Element type of the band matrix
+        , typename OP >    // Type of the band kernel
+inline EnableIf_< BandDirectAccess<MT,Type> >
+   bandApply( DenseMatrix<MT,columnMajor>& B, OP kernel )
+{
+   for( size_t j=0UL; j<(~B).columns(); ++j ) {
+      kernel( (~B).data(j), 1UL, 1UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given band kernel to a dense matrix without direct memory access.
+// \ingroup band_matrix
+//
+// \param B The dense matrix.
+// \param kernel The kernel to be applied to the elements of the matrix.
+// \return void
+*/
+template< typename MT      // Type of the dense matrix
+        , bool SO          // Storage order of the dense matrix
+        , typename Type    // Element type of the band matrix
+        , typename OP >    // Type of the band kernel
+inline DisableIf_< BandDirectAccess<MT,Type> >
+   bandApply( DenseMatrix<MT,SO>& B, OP kernel )
+{
+   DynamicMatrix<Type,rowMajor> tmp( ~B );
+   kernel( tmp.data(), tmp.spacing(), tmp.columns() );
+   (~B) = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Band matrix/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup band_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side band matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function performs the multiplication of a band matrix with a dense vector in the style
+// of the BLAS gbmv() function. The band is traversed diagonal by diagonal and every diagonal is
+// processed by a vectorized multiply-add. Every stored element of the band matrix is read
+// exactly once. In case \a beta is zero, the target vector is not read and resized to the
+// number of rows of \a A if necessary.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void gbmv( DenseVector<VT1,false>& y, const BandMatrix<Type,SO>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~x).size() != A.columns() || ( !isDefault( beta ) && (~y).size() != A.rows() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( isDefault( beta ) ) {
+      resize( ~y, A.rows(), false );
+   }
+
+   const DynamicVector<Type,false> tx( ~x );
+   const Type a( alpha );
+   const Type b( beta );
+
+   bandApply<VT1,Type>( ~y, [&A,&tx,&a,&b]( Type* py, size_t, size_t ) {
+      A.mult( py, tx.data(), a, b );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LU decomposition of the given band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the LU decomposition of the given general \f$ M \times N \f$ band
+// matrix with partial pivoting by row interchanges in the style of the LAPACK gbtrf() function.
+// Since the row interchanges cause fill-in above the band, the upper bandwidth of \a A is
+// extended by its lower bandwidth before the decomposition. On exit, \a A contains the unit
+// lower triangular multipliers on its subdiagonals and the upper triangular factor \a U on its
+// diagonal and superdiagonals. The 1-based pivot indices are stored in \a ipiv; row \a i was
+// interchanged with row \a ipiv[i]-1. The decomposition has the form
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c P is a permutation matrix, \c L a lower unitriangular matrix, and \c U an upper
+// triangular matrix. This form holds independent of the storage order of \a A. The function
+// does not throw in case \a A is singular; in this case a diagonal element of \a U is exactly
+// zero and the result must not be used to solve a linear system of equations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+void gbtrf( BandMatrix<Type,SO>& A, int* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   A.resize( A.rows(), A.columns(), A.lowerBandwidth(),
+             A.upperBandwidth() + A.lowerBandwidth(), true );
+
+   A.lu( ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Substitution step of solving a band system of linear equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The LU decomposition of the system matrix as computed by gbtrf().
+// \param b The right-hand side vector on entry, the solution vector on exit.
+// \param ipiv Auxiliary array of the pivot indices as computed by gbtrf().
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT >  // Type of the right-hand side vector
+void gbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b, const int* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   bandApply<VT,Type>( ~b, [&A,ipiv]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.luSolve( pb, ldb, nrhs, ipiv );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Substitution step of solving a band system of linear equations (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The LU decomposition of the system matrix as computed by gbtrf().
+// \param B The matrix of right-hand sides on entry, the solution matrix on exit.
+// \param ipiv Auxiliary array of the pivot indices as computed by gbtrf().
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In contrast to the LAPACK gbtrs() function, every column of \a B represents a right-hand side
+// independent of the storage order of \a B. In case \a B is a row-major matrix, all right-hand
+// sides are processed at once and the substitution is vectorized across the right-hand sides.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void gbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, const int* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   bandApply<MT,Type>( ~B, [&A,ipiv]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.luSolve( pb, ldb, nrhs, ipiv );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cholesky decomposition of the given positive definite band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \param uplo \c 'L' to use the lower band, \c 'U' to use the upper band of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition of the given symmetric (Hermitian) positive
+// definite band matrix in the style of the LAPACK pbtrf() function. In case \a uplo is set to
+// \c 'L', the decomposition has the form \f$ A = L L^H \f$ and \a L is stored on the diagonal
+// and the subdiagonals of \a A. In case \a uplo is set to \c 'U', the decomposition has the form
+// \f$ A = U^H U \f$ and \a U is stored on the diagonal and the superdiagonals of \a A. The other
+// half of the band is neither referenced nor modified. Since the Cholesky decomposition doesn't
+// cause any fill-in, the bandwidths of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+void pbtrf( BandMatrix<Type,SO>& A, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   A.llh( uplo );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Substitution step of solving a positive definite band system (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The Cholesky decomposition of the system matrix as computed by pbtrf().
+// \param b The right-hand side vector on entry, the solution vector on exit.
+// \param uplo The \a uplo argument that was passed to pbtrf().
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT >  // Type of the right-hand side vector
+void pbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   bandApply<VT,Type>( ~b, [&A,uplo]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.llhSolve( pb, ldb, nrhs, uplo );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Substitution step of solving a positive definite band system (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The Cholesky decomposition of the system matrix as computed by pbtrf().
+// \param B The matrix of right-hand sides on entry, the solution matrix on exit.
+// \param uplo The \a uplo argument that was passed to pbtrf().
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// Every column of \a B represents a right-hand side independent of the storage order of \a B.
+// In case \a B is a row-major matrix, all right-hand sides are processed at once and the
+// substitution is vectorized across the right-hand sides.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void pbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( A.rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   bandApply<MT,Type>( ~B, [&A,uplo]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.llhSolve( pb, ldb, nrhs, uplo );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a tridiagonal system of linear equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The tridiagonal system matrix.
+// \param b The right-hand side vector on entry, the solution vector on exit.
+// \return void
+// \exception std::invalid_argument Invalid non-tridiagonal matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the given tridiagonal system by means of the Thomas algorithm, which
+// requires \f$ O(N) \f$ operations. The system matrix has to be a square band matrix with
+// lower and upper bandwidth of at most 1; it is not modified. Note that the Thomas algorithm
+// does not perform any pivoting and is therefore only stable for diagonally dominant or
+// positive definite matrices. For general tridiagonal matrices gbtrf() and gbtrs() should be
+// used instead.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT >  // Type of the right-hand side vector
+void solveTridiagonal( const BandMatrix<Type,SO>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() || A.lowerBandwidth() > 1UL || A.upperBandwidth() > 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-tridiagonal matrix provided" );
+   }
+
+   if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   ArenaArray<Type> cp( A.rows() );
+   ArenaArray<Type> w ( A.rows() );
+
+   A.tridiagonalFactor( cp.data(), w.data() );
+
+   bandApply<VT,Type>( ~b, [&A,&cp,&w]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.tridiagonalSolve( pb, ldb, nrhs, cp.data(), w.data() );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a tridiagonal system of linear equations with multiple right-hand sides
+//        (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The tridiagonal system matrix.
+// \param B The matrix of right-hand sides on entry, the solution matrix on exit.
+// \return void
+// \exception std::invalid_argument Invalid non-tridiagonal matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the given tridiagonal system for all columns of \a B by means of the
+// Thomas algorithm. The tridiagonal matrix is factorized only once. In case \a B is a row-major
+// matrix, the forward and back sweeps process all right-hand sides at once, i.e. the Thomas
+// algorithm is vectorized across the right-hand sides. Therefore row-major matrices should be
+// preferred for a large number of right-hand sides:
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+
+   BandMatrix<double> A( N, N, 1UL, 1UL );
+   // ... Initialization of the tridiagonal matrix
+
+   DynamicMatrix<double,rowMajor> B( N, 256UL );
+   // ... Initialization of the 256 right-hand sides
+
+   solveTridiagonal( A, B );  // Solves all 256 systems in a single sweep
+   \endcode
+
+// Note that the Thomas algorithm does not perform any pivoting and is therefore only stable for
+// diagonally dominant or positive definite matrices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void solveTridiagonal( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() || A.lowerBandwidth() > 1UL || A.upperBandwidth() > 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-tridiagonal matrix provided" );
+   }
+
+   if( A.rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   ArenaArray<Type> cp( A.rows() );
+   ArenaArray<Type> w ( A.rows() );
+
+   A.tridiagonalFactor( cp.data(), w.data() );
+
+   bandApply<MT,Type>( ~B, [&A,&cp,&w]( Type* pb, size_t ldb, size_t nrhs ) {
+      A.tridiagonalSolve( pb, ldb, nrhs, cp.data(), w.data() );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given band system of linear equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The band system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the given band system of linear equations by means of an LU decomposition
+// with partial pivoting of a copy of the given system matrix \a A (see gbtrf() and gbtrs()).
+// In contrast to the general solve() function for dense matrices, both the decomposition and
+// the substitution exploit the band structure and require \f$ O(N \cdot kl \cdot (kl+ku)) \f$
+// operations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the vectors
+void solve( const BandMatrix<Type,SO>& A, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_<VT1> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~x, (~b).size(), false );
+
+   BandMatrix<Type,SO> lu( A );
+   ArenaArray<int> ipiv( lu.rows() );
+
+   gbtrf( lu, ipiv.data() );
+
+   for( size_t i=0UL; i<lu.rows(); ++i ) {
+      const Type pivot( lu(i,i) );
+      if( !isDivisor( pivot ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving the LSE of a singular matrix failed" );
+      }
+   }
+
+   DynamicVector<Type,TF> tmp( ~b );
+   lu.luSolve( tmp.data(), 1UL, 1UL, ipiv.data() );
+
+   (~x) = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given band system of linear equations (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The band system matrix.
+// \param X The resulting solution matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the given band system of linear equations with multiple right-hand sides
+// by means of an LU decomposition with partial pivoting of a copy of the given system matrix
+// \a A (see gbtrf() and gbtrs()). Every column of \a B represents a right-hand side. The system
+// matrix is decomposed only once and the substitution is vectorized across the right-hand sides.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename MT1   // Type of the solution matrix
+        , bool SO1       // Storage order of the solution matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void solve( const BandMatrix<Type,SO>& A, DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_<MT1> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   resize( ~X, (~B).rows(), (~B).columns(), false );
+
+   BandMatrix<Type,SO> lu( A );
+   ArenaArray<int> ipiv( lu.rows() );
+
+   gbtrf( lu, ipiv.data() );
+
+   for( size_t i=0UL; i<lu.rows(); ++i ) {
+      const Type pivot( lu(i,i) );
+      if( !isDivisor( pivot ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving the LSE of a singular matrix failed" );
+      }
+   }
+
+   DynamicMatrix<Type,rowMajor> tmp( ~B );
+   lu.luSolve( tmp.data(), tmp.spacing(), tmp.columns(), ipiv.data() );
+
+   (~X) = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< BandMatrix<T,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1820 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchMatrix.h
+//  \brief Header file for the implementation of a batch of small, fixed-size matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHMATRIX_H_
+#define _BLAZE_MATH_DENSE_BATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/BatchMatrix.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/SizeT.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup batch_matrix BatchMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size matrices.
+// \ingroup batch_matrix
+//
+// The BatchMatrix class template represents a dynamically sized batch of small matrices of the
+// same, fixed size, as for instance the 3x3 or 6x6 blocks of a physics simulation. The type of
+// the elements and the number of rows and columns of the matrices can be specified via the three
+// template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class BatchMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BatchMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of the matrices.
+//  - N   : specifies the number of columns of the matrices.
+//
+// In contrast to a std::vector of StaticMatrix instances, BatchMatrix stores the matrices in a
+// structure-of-arrays layout: All elements \f$ (i,j) \f$ of all matrices are stored in a single,
+// contiguous and properly aligned array. Therefore the batch operations (mult(), det(), lu(), and
+// invert()) are vectorized across the matrices of the batch, i.e. every SIMD operation processes
+// the same element of several matrices at once, and are executed in parallel in case the shared
+// memory parallelization is enabled. Matrix/vector multiplications are performed via batches
+// of \f$ N \times 1 \f$ matrices. The following example demonstrates the usage of BatchMatrix:
+
+   \code
+   using blaze::BatchMatrix;
+   using blaze::StaticMatrix;
+
+   BatchMatrix<double,3UL,3UL> A( 100000UL );  // Batch of 100000 3x3 matrices
+   BatchMatrix<double,3UL,1UL> x( 100000UL );  // Batch of 100000 3-dimensional vectors
+   BatchMatrix<double,3UL,3UL> B, C;
+   BatchMatrix<double,3UL,1UL> y;
+
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      A.set( k, StaticMatrix<double,3UL,3UL>{ { 2.0, 1.0, 0.0 }, { 1.0, 3.0, 1.0 }, { 0.0, 1.0, 4.0 } } );
+      x(k,0,0) = 1.0; x(k,1,0) = 2.0; x(k,2,0) = 3.0;
+   }
+
+   mult( C, A, A );  // Matrix multiplication C[k] = A[k] * A[k] for all k
+   mult( y, A, x );  // Matrix/vector multiplication y[k] = A[k] * x[k] for all k
+
+   blaze::DynamicVector<double> d( det( A ) );  // Determinants of all matrices
+
+   B = A;
+   invert( B );  // In-place inversion of all matrices
+
+   StaticMatrix<double,3UL,3UL> Bk( B.get( 5UL ) );  // Extracting the 6th matrix of the batch
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+class BatchMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BatchMatrix<Type,M,N>             This;         //!< Type of this BatchMatrix instance.
+   typedef StaticMatrix<Type,M,N,rowMajor>   MatrixType;   //!< Type of a single matrix of the batch.
+   typedef Type                              ElementType;  //!< Type of the matrix elements.
+   typedef SIMDTrait_<ElementType>           SIMDType;     //!< SIMD type of the matrix elements.
+
+   typedef Type&        Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&  ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*        Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*  ConstPointer;    //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether the batch operations can be optimized
+       via SIMD operations. In case the element type of the matrices is a vectorizable data type,
+       the \a simdEnabled compilation flag is set to \a true, otherwise it is set to \a false. */
+   enum : bool { simdEnabled = IsVectorizable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BatchMatrix() noexcept;
+   explicit inline BatchMatrix( size_t n );
+
+   inline BatchMatrix( const BatchMatrix& m );
+   inline BatchMatrix( BatchMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BatchMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Pointer        data( size_t i, size_t j ) noexcept;
+   inline ConstPointer   data( size_t i, size_t j ) const noexcept;
+   inline MatrixType     get ( size_t k ) const;
+
+   template< typename MT, bool SO >
+   inline void set( size_t k, const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BatchMatrix& operator=( const BatchMatrix& rhs );
+   inline BatchMatrix& operator=( BatchMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline                  size_t size() const noexcept;
+   static inline constexpr size_t rows() noexcept;
+   static inline constexpr size_t columns() noexcept;
+   inline                  size_t spacing() const noexcept;
+   inline                  size_t capacity() const noexcept;
+   inline                  void   reset();
+   inline                  void   clear();
+   inline                  void   resize ( size_t n, bool preserve=true );
+   inline                  void   reserve( size_t n );
+   inline                  void   swap( BatchMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t addPadding( size_t n ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices of the batch.
+   size_t capacity_;         //!< The maximum number of matrices of the batch.
+                             /*!< The capacity is rounded to a multiple of the SIMD size and
+                                  determines the distance between two element arrays. */
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+                             /*!< Element \f$ (i,j) \f$ of the \f$ k \f$-th matrix is stored at
+                                  position \f$ (i \cdot N + j) \cdot capacity + k \f$. The elements
+                                  beyond the current size of the batch are always initialized to
+                                  the default value of the element type. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BatchMatrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>::BatchMatrix() noexcept
+   : size_    ( 0UL )      // The current number of matrices of the batch
+   , capacity_( 0UL )      // The maximum number of matrices of the batch
+   , v_       ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// \note element initialization is performed!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>::BatchMatrix( size_t n )
+   : size_    ( n )                                  // The current number of matrices of the batch
+   , capacity_( addPadding( n ) )                    // The maximum number of matrices of the batch
+   , v_       ( allocate<Type>( M*N*capacity_ ) )  // The matrix elements
+{
+   if( IsVectorizable<Type>::value ) {
+      for( size_t e=0UL; e<M*N; ++e ) {
+         std::fill( v_+e*capacity_+size_, v_+(e+1UL)*capacity_, Type() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BatchMatrix.
+//
+// \param m Batch to be copied.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>::BatchMatrix( const BatchMatrix& m )
+   : size_    ( m.size_ )                            // The current number of matrices of the batch
+   , capacity_( addPadding( size_ ) )                // The maximum number of matrices of the batch
+   , v_       ( allocate<Type>( M*N*capacity_ ) )  // The matrix elements
+{
+   for( size_t e=0UL; e<M*N; ++e ) {
+      std::copy( m.v_+e*m.capacity_, m.v_+e*m.capacity_+capacity_, v_+e*capacity_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BatchMatrix.
+//
+// \param m The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>::BatchMatrix( BatchMatrix&& m ) noexcept
+   : size_    ( m.size_     )  // The current number of matrices of the batch
+   , capacity_( m.capacity_ )  // The maximum number of matrices of the batch
+   , v_       ( m.v_        )  // The matrix elements
+{
+   m.size_     = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BatchMatrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>::~BatchMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to element \f$ (i,j) \f$ of the \a k-th matrix of the batch.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchMatrix<Type,M,N>::Reference
+   BatchMatrix<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[(i*N+j)*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to element \f$ (i,j) \f$ of the \a k-th matrix of the batch.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchMatrix<Type,M,N>::ConstReference
+   BatchMatrix<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[(i*N+j)*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the element array of element \f$ (i,j) \f$.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Pointer to the array of elements \f$ (i,j) \f$ of all matrices of the batch.
+//
+// This function returns a pointer to the properly aligned array of elements \f$ (i,j) \f$ of
+// all matrices of the batch, i.e. the element \f$ (i,j) \f$ of the \a k-th matrix is located
+// at position \a k of the array.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchMatrix<Type,M,N>::Pointer
+   BatchMatrix<Type,M,N>::data( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N, "Invalid column access index" );
+   return v_ + (i*N+j)*capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the element array of element \f$ (i,j) \f$.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Pointer to the array of elements \f$ (i,j) \f$ of all matrices of the batch.
+//
+// This function returns a pointer to the properly aligned array of elements \f$ (i,j) \f$ of
+// all matrices of the batch, i.e. the element \f$ (i,j) \f$ of the \a k-th matrix is located
+// at position \a k of the array.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchMatrix<Type,M,N>::ConstPointer
+   BatchMatrix<Type,M,N>::data( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N, "Invalid column access index" );
+   return v_ + (i*N+j)*capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th matrix of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th matrix of the batch.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchMatrix<Type,M,N>::MatrixType
+   BatchMatrix<Type,M,N>::get( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   MatrixType m;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         m(i,j) = v_[(i*N+j)*capacity_+k];
+      }
+   }
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th matrix of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The matrix to be copied into the batch.
+// \return void
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void BatchMatrix<Type,M,N>::set( size_t k, const Matrix<MT,SO>& m )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   if( (~m).rows() != M || (~m).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size" );
+   }
+
+   const MatrixType tmp( ~m );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         v_[(i*N+j)*capacity_+k] = tmp(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BatchMatrix.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>& BatchMatrix<Type,M,N>::operator=( const BatchMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BatchMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BatchMatrix.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchMatrix<Type,M,N>& BatchMatrix<Type,M,N>::operator=( BatchMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchMatrix<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the matrices of the batch.
+//
+// \return The number of rows of the matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t BatchMatrix<Type,M,N>::rows() noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the matrices of the batch.
+//
+// \return The number of columns of the matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t BatchMatrix<Type,M,N>::columns() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two element arrays.
+//
+// \return The spacing between the beginning of two element arrays.
+//
+// This function returns the spacing between the beginning of the arrays of two consecutive
+// elements, i.e. the total number of elements of an element array.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchMatrix<Type,M,N>::spacing() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the batch.
+//
+// \return The capacity of the batch in number of matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchMatrix<Type,M,N>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of all matrices of the batch to their default values.
+// Note that the size of the batch is not changed.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchMatrix<Type,M,N>::reset()
+{
+   std::fill( v_, v_+M*N*capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchMatrix<Type,M,N>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch using the given size to \a n. During this operation, new
+// dynamic memory may be allocated in case the capacity of the batch is too small. Note that
+// this function may invalidate all existing pointers to the elements of the batch in case
+// new dynamic memory is allocated. The function only preserves the values of the existing
+// matrices in case \a preserve is set to \a true. Note that new matrices are not initialized!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchMatrix<Type,M,N>::resize( size_t n, bool preserve )
+{
+   if( n > capacity_ )
+   {
+      const size_t newCapacity( addPadding( n ) );
+
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( M*N*newCapacity );
+
+      for( size_t e=0UL; e<M*N; ++e )
+      {
+         if( preserve ) {
+            std::copy( v_+e*capacity_, v_+e*capacity_+size_, tmp+e*newCapacity );
+         }
+
+         if( IsVectorizable<Type>::value ) {
+            std::fill( tmp+e*newCapacity+n, tmp+(e+1UL)*newCapacity, Type() );
+         }
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newCapacity;
+   }
+   else if( IsVectorizable<Type>::value && n < size_ )
+   {
+      for( size_t e=0UL; e<M*N; ++e ) {
+         std::fill( v_+e*capacity_+n, v_+e*capacity_+size_, Type() );
+      }
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the batch.
+//
+// \param n The new minimum capacity of the batch in number of matrices.
+// \return void
+//
+// This function increases the capacity of the batch to at least \a n matrices. The current
+// values of the matrices are preserved.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchMatrix<Type,M,N>::reserve( size_t n )
+{
+   if( n > capacity_ )
+   {
+      const size_t oldSize( size_ );
+      resize( n, true );
+      size_ = oldSize;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t e=0UL; e<M*N; ++e ) {
+            std::fill( v_+e*capacity_+size_, v_+e*capacity_+n, Type() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param m The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchMatrix<Type,M,N>::swap( BatchMatrix& m ) noexcept
+{
+   std::swap( size_    , m.size_     );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Add the necessary amount of padding to the given number of matrices.
+//
+// \param n The number of matrices to be padded.
+// \return The padded number of matrices.
+//
+// In case the element type is vectorizable, the number of matrices is rounded to the next
+// multiple of the SIMD size, such that every element array is properly aligned and can be
+// processed by SIMD operations without remainder loop.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchMatrix<Type,M,N>::addPadding( size_t n ) const noexcept
+{
+   if( IsVectorizable<Type>::value )
+      return nextMultiple<size_t>( n, SIMDSIZE );
+   else return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BatchMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( BatchMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( BatchMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( BatchMatrix<Type,M,N>& a, BatchMatrix<Type,M,N>& b ) noexcept;
+
+template< typename Type, size_t M, size_t K, size_t N >
+void mult( BatchMatrix<Type,M,N>& C, const BatchMatrix<Type,M,K>& A, const BatchMatrix<Type,K,N>& B );
+
+template< typename Type, size_t N >
+DynamicVector<Type,columnVector> det( const BatchMatrix<Type,N,N>& A );
+
+template< typename Type, size_t N >
+void lu( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,N>& L,
+         BatchMatrix<Type,N,N>& U, BatchMatrix<Type,N,N>& P );
+
+template< typename Type, size_t N >
+void invert( BatchMatrix<Type,N,N>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch of matrices.
+// \ingroup batch_matrix
+//
+// \param m The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void reset( BatchMatrix<Type,M,N>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch of matrices.
+// \ingroup batch_matrix
+//
+// \param m The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void clear( BatchMatrix<Type,M,N>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches of matrices.
+// \ingroup batch_matrix
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void swap( BatchMatrix<Type,M,N>& a, BatchMatrix<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the access to the matrices of a batch within the batch kernels.
+// \ingroup batch_matrix
+//
+// The BatchLane class template provides the access to the elements of a single matrix (in case
+// \a Vectorized is \a false) or of a SIMD-sized group of consecutive matrices (in case
+// \a Vectorized is \a true) of a batch. All batch kernels are implemented in terms of this
+// helper and therefore use the same code for both the vectorized and the scalar evaluation.
+*/
+template< typename Type       // Data type of the matrices
+        , bool Vectorized >   // Vectorization flag
+struct BatchLane
+{
+   //**Type definitions****************************************************************************
+   typedef Type  ValueType;  //!< Type of the values processed at once.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = 1UL };  //!< The number of matrices processed at once.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static inline ValueType load( const Type* address ) { return *address; }
+   static inline ValueType set ( const Type& value ) { return value; }
+   static inline void store( Type* address, const ValueType& value ) { *address = value; }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of BatchLane for the vectorized processing of batches.
+// \ingroup batch_matrix
+*/
+template< typename Type >  // Data type of the matrices
+struct BatchLane<Type,true>
+{
+   //**Type definitions****************************************************************************
+   typedef SIMDTrait_<Type>  ValueType;  //!< Type of the values processed at once.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = SIMDTrait<Type>::size };  //!< The number of matrices processed at once.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE ValueType load( const Type* address ) noexcept { return loada( address ); }
+   static BLAZE_ALWAYS_INLINE ValueType set ( const Type& value ) noexcept { return blaze::set( value ); }
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const ValueType& value ) noexcept { storea( address, value ); }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper to determine whether the arithmetic batch kernels can be vectorized.
+// \ingroup batch_matrix
+*/
+template< typename Type >  // Data type of the matrices
+struct BatchArithmetic
+   : public BoolConstant< useOptimizedKernels &&
+                          IsVectorizable<Type>::value &&
+                          HasSIMDAdd<Type,Type>::value &&
+                          HasSIMDSub<Type,Type>::value &&
+                          HasSIMDMult<Type,Type>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper to determine whether the batch kernels involving divisions can be
+//        vectorized.
+// \ingroup batch_matrix
+*/
+template< typename Type >  // Data type of the matrices
+struct BatchDivision
+   : public BoolConstant< BatchArithmetic<Type>::value &&
+                          HasSIMDDiv<Type,Type>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resetting the padding elements of the given batch of matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices.
+// \return void
+//
+// The vectorized batch kernels always process complete SIMD-sized groups of matrices and
+// therefore also write the padding elements beyond the size of the batch. This function
+// restores the default values of the padding elements.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void resetPadding( BatchMatrix<Type,M,N>& A )
+{
+   if( !IsVectorizable<Type>::value )
+      return;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         std::fill( A.data(i,j)+A.size(), A.data(i,j)+A.capacity(), Type() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batch matrix multiplication \f$ C_k = A_k \cdot B_k \f$.
+// \ingroup batch_matrix
+//
+// \param C The target batch.
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \param begin The index of the first matrix to be processed.
+// \param end The index one past the last matrix to be processed.
+// \return void
+//
+// All operands of a group of matrices are loaded before the results are stored. Therefore the
+// target batch is allowed to be identical to one of the operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void batchMultKernel( BatchMatrix<Type,M,N>& C, const BatchMatrix<Type,M,K>& A,
+                      const BatchMatrix<Type,K,N>& B, size_t begin, size_t end )
+{
+   typedef BatchLane< Type, BatchArithmetic<Type>::value >  Lane;
+   typedef typename Lane::ValueType                          ValueType;
+
+   for( size_t k=begin; k<end; k+=Lane::size )
+   {
+      ValueType a[M*K];
+      ValueType b[K*N];
+
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t l=0UL; l<K; ++l )
+            a[i*K+l] = Lane::load( A.data(i,l)+k );
+
+      for( size_t l=0UL; l<K; ++l )
+         for( size_t j=0UL; j<N; ++j )
+            b[l*N+j] = Lane::load( B.data(l,j)+k );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            ValueType sum( a[i*K] * b[j] );
+            for( size_t l=1UL; l<K; ++l ) {
+               sum = sum + a[i*K+l] * b[l*N+j];
+            }
+            Lane::store( C.data(i,j)+k, sum );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a single (group of) \f$ 1 \times 1 \f$ matrices.
+// \ingroup batch_matrix
+*/
+template< typename VT >  // Type of the values
+inline VT batchDet( const VT* a, SizeT<1UL> )
+{
+   return a[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a single (group of) \f$ 2 \times 2 \f$ matrices.
+// \ingroup batch_matrix
+*/
+template< typename VT >  // Type of the values
+inline VT batchDet( const VT* a, SizeT<2UL> )
+{
+   return a[0]*a[3] - a[1]*a[2];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a single (group of) \f$ 3 \times 3 \f$ matrices via
+//        the rule of Sarrus.
+// \ingroup batch_matrix
+*/
+template< typename VT >  // Type of the values
+inline VT batchDet( const VT* a, SizeT<3UL> )
+{
+   const VT c0( a[4]*a[8] - a[5]*a[7] );
+   const VT c1( a[5]*a[6] - a[3]*a[8] );
+   const VT c2( a[3]*a[7] - a[4]*a[6] );
+
+   return a[0]*c0 + a[1]*c1 + a[2]*c2;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LU decomposition of a group of matrices with partial pivoting.
+// \ingroup batch_matrix
+//
+// \param a Pointer to the first element of the group of matrices.
+// \param stride The distance between two element arrays.
+// \param ipiv The resulting pivot indices (one row of \a size values per column).
+// \return void
+//
+// This function performs an in-place LU decomposition with partial pivoting of a group of
+// \a Lane::size matrices, whose element \f$ (i,j) \f$ is stored at position
+// \f$ (i \cdot N + j) \cdot stride \f$. The pivot search and the row interchanges are performed
+// individually for every matrix, the elimination is vectorized across the group. In case a
+// column contains no non-zero pivot, the elimination step is skipped for the according matrix,
+// which results in a zero on the diagonal of \f$ U \f$.
+*/
+template< typename Lane  // Type of the lane helper
+        , size_t N       // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the matrices
+void batchLU( Type* a, size_t stride, size_t* ipiv )
+{
+   using std::abs;
+
+   typedef typename Lane::ValueType  ValueType;
+
+   AlignedArray<Type,Lane::size> pivot;
+
+   for( size_t c=0UL; c<N; ++c )
+   {
+      for( size_t l=0UL; l<Lane::size; ++l )
+      {
+         size_t p( c );
+
+         for( size_t r=c+1UL; r<N; ++r ) {
+            if( abs( a[(r*N+c)*stride+l] ) > abs( a[(p*N+c)*stride+l] ) )
+               p = r;
+         }
+
+         ipiv[c*Lane::size+l] = p;
+
+         if( p != c ) {
+            for( size_t j=0UL; j<N; ++j )
+               std::swap( a[(c*N+j)*stride+l], a[(p*N+j)*stride+l] );
+         }
+
+         pivot[l] = ( isDefault( a[(c*N+c)*stride+l] ) )?( Type(1) ):( a[(c*N+c)*stride+l] );
+      }
+
+      const ValueType inv( Lane::set( Type(1) ) / Lane::load( pivot.data() ) );
+
+      for( size_t r=c+1UL; r<N; ++r )
+      {
+         const ValueType factor( Lane::load( a+(r*N+c)*stride ) * inv );
+         Lane::store( a+(r*N+c)*stride, factor );
+
+         for( size_t j=c+1UL; j<N; ++j ) {
+            Lane::store( a+(r*N+j)*stride, Lane::load( a+(r*N+j)*stride ) - factor * Lane::load( a+(c*N+j)*stride ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinants of a group of small matrices via closed formulas.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices.
+// \param k The index of the first matrix of the group.
+// \param result The resulting determinants of the group.
+// \return void
+*/
+template< typename Lane  // Type of the lane helper
+        , typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+inline void batchDetGroup( const BatchMatrix<Type,N,N>& A, size_t k, Type* result, TrueType )
+{
+   typedef typename Lane::ValueType  ValueType;
+
+   ValueType a[N*N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i*N+j] = Lane::load( A.data(i,j)+k );
+
+   Lane::store( result, batchDet( a, SizeT<N>() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinants of a group of matrices via LU decomposition.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices.
+// \param k The index of the first matrix of the group.
+// \param result The resulting determinants of the group.
+// \return void
+*/
+template< typename Lane  // Type of the lane helper
+        , typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+inline void batchDetGroup( const BatchMatrix<Type,N,N>& A, size_t k, Type* result, FalseType )
+{
+   typedef typename Lane::ValueType  ValueType;
+
+   AlignedArray<Type,N*N*Lane::size> a;
+   size_t ipiv[N*Lane::size];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         Lane::store( a.data()+(i*N+j)*Lane::size, Lane::load( A.data(i,j)+k ) );
+
+   batchLU<Lane,N>( a.data(), Lane::size, ipiv );
+
+   ValueType prod( Lane::load( a.data() ) );
+   for( size_t i=1UL; i<N; ++i ) {
+      prod = prod * Lane::load( a.data()+(i*N+i)*Lane::size );
+   }
+
+   Lane::store( result, prod );
+
+   for( size_t l=0UL; l<Lane::size; ++l ) {
+      for( size_t c=0UL; c<N; ++c ) {
+         if( ipiv[c*Lane::size+l] != c )
+            result[l] = -result[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the computation of the determinants of a batch of \f$ N \times N \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param d The resulting determinants.
+// \param A The batch of matrices.
+// \param begin The index of the first matrix to be processed.
+// \param end The index one past the last matrix to be processed.
+// \return void
+//
+// The determinants of \f$ 1 \times 1 \f$, \f$ 2 \times 2 \f$, and \f$ 3 \times 3 \f$ matrices
+// are computed via closed formulas, all larger matrices are LU decomposed.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void batchDetKernel( DynamicVector<Type,columnVector>& d, const BatchMatrix<Type,N,N>& A,
+                     size_t begin, size_t end )
+{
+   typedef BoolConstant< ( N <= 3UL ) >  ClosedForm;
+   typedef BatchLane< Type, ( N <= 3UL ? BatchArithmetic<Type>::value
+                                       : BatchDivision<Type>::value ) >  Lane;
+
+   AlignedArray<Type,Lane::size> result;
+
+   for( size_t k=begin; k<end; k+=Lane::size )
+   {
+      batchDetGroup<Lane>( A, k, result.data(), ClosedForm() );
+
+      for( size_t l=0UL; l<Lane::size && k+l<end; ++l ) {
+         d[k+l] = result[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the LU decomposition of a batch of \f$ N \times N \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices to be decomposed.
+// \param L The resulting batch of lower unitriangular matrices.
+// \param U The resulting batch of upper triangular matrices.
+// \param P The resulting batch of permutation matrices.
+// \param begin The index of the first matrix to be processed.
+// \param end The index one past the last matrix to be processed.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void batchLUKernel( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,N>& L,
+                    BatchMatrix<Type,N,N>& U, BatchMatrix<Type,N,N>& P, size_t begin, size_t end )
+{
+   typedef BatchLane< Type, BatchDivision<Type>::value >  Lane;
+   typedef typename Lane::ValueType                       ValueType;
+
+   AlignedArray<Type,N*N*Lane::size> a;
+   size_t ipiv[N*Lane::size];
+   size_t perm[N];
+
+   for( size_t k=begin; k<end; k+=Lane::size )
+   {
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            Lane::store( a.data()+(i*N+j)*Lane::size, Lane::load( A.data(i,j)+k ) );
+
+      batchLU<Lane,N>( a.data(), Lane::size, ipiv );
+
+      const ValueType zero( Lane::set( Type() ) );
+      const ValueType one ( Lane::set( Type(1) ) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            const ValueType value( Lane::load( a.data()+(i*N+j)*Lane::size ) );
+            Lane::store( L.data(i,j)+k, ( i > j )?( value ):( i == j ? one : zero ) );
+            Lane::store( U.data(i,j)+k, ( i > j )?( zero ):( value ) );
+            Lane::store( P.data(i,j)+k, zero );
+         }
+      }
+
+      for( size_t l=0UL; l<Lane::size; ++l )
+      {
+         for( size_t i=0UL; i<N; ++i ) {
+            perm[i] = i;
+         }
+
+         for( size_t c=0UL; c<N; ++c ) {
+            std::swap( perm[c], perm[ipiv[c*Lane::size+l]] );
+         }
+
+         for( size_t c=0UL; c<N; ++c ) {
+            P.data(perm[c],c)[k+l] = Type(1);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a group of \f$ 1 \times 1 \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param a The elements of the group of matrices.
+// \param det The resulting determinants of the group of matrices.
+// \return void
+*/
+template< typename Lane    // Type of the lane helper
+        , typename Type >  // Data type of the matrices
+inline void batchInvertGroup( typename Lane::ValueType* a, typename Lane::ValueType& det, SizeT<1UL> )
+{
+   typedef typename Lane::ValueType  ValueType;
+
+   det = a[0];
+   a[0] = ValueType( Lane::set( Type(1) ) / det );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a group of \f$ 2 \times 2 \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param a The elements of the group of matrices.
+// \param det The resulting determinants of the group of matrices.
+// \return void
+*/
+template< typename Lane    // Type of the lane helper
+        , typename Type >  // Data type of the matrices
+inline void batchInvertGroup( typename Lane::ValueType* a, typename Lane::ValueType& det, SizeT<2UL> )
+{
+   typedef typename Lane::ValueType  ValueType;
+
+   det = batchDet( a, SizeT<2UL>() );
+
+   const ValueType idet ( Lane::set( Type(1) ) / det );
+   const ValueType nidet( Lane::set( Type() ) - idet );
+   const ValueType a0( a[0] );
+
+   a[0] = a[3] * idet;
+   a[1] = a[1] * nidet;
+   a[2] = a[2] * nidet;
+   a[3] = a0   * idet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a group of \f$ 3 \times 3 \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param a The elements of the group of matrices.
+// \param det The resulting determinants of the group of matrices.
+// \return void
+*/
+template< typename Lane    // Type of the lane helper
+        , typename Type >  // Data type of the matrices
+inline void batchInvertGroup( typename Lane::ValueType* a, typename Lane::ValueType& det, SizeT<3UL> )
+{
+   typedef typename Lane::ValueType  ValueType;
+
+   ValueType b[9];
+
+   b[0] = a[4]*a[8] - a[5]*a[7];
+   b[1] = a[2]*a[7] - a[1]*a[8];
+   b[2] = a[1]*a[5] - a[2]*a[4];
+   b[3] = a[5]*a[6] - a[3]*a[8];
+   b[4] = a[0]*a[8] - a[2]*a[6];
+   b[5] = a[2]*a[3] - a[0]*a[5];
+   b[6] = a[3]*a[7] - a[4]*a[6];
+   b[7] = a[1]*a[6] - a[0]*a[7];
+   b[8] = a[0]*a[4] - a[1]*a[3];
+
+   det = a[0]*b[0] + a[1]*b[3] + a[2]*b[6];
+
+   const ValueType idet( Lane::set( Type(1) ) / det );
+
+   for( size_t i=0UL; i<9UL; ++i ) {
+      a[i] = b[i] * idet;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the in-place inversion of a batch of \f$ N \times N \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param begin The index of the first matrix to be processed.
+// \param end The index one past the last matrix to be processed.
+// \return \a true in case all matrices could be inverted, \a false if at least one is singular.
+//
+// The inverses of \f$ 1 \times 1 \f$, \f$ 2 \times 2 \f$, and \f$ 3 \times 3 \f$ matrices are
+// computed via the adjugate matrix, all larger matrices are LU decomposed.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+bool batchInvertKernel( BatchMatrix<Type,N,N>& A, size_t begin, size_t end, TrueType )
+{
+   typedef BatchLane< Type, BatchDivision<Type>::value >  Lane;
+   typedef typename Lane::ValueType                       ValueType;
+
+   AlignedArray<Type,Lane::size> det;
+   bool success( true );
+
+   for( size_t k=begin; k<end; k+=Lane::size )
+   {
+      ValueType a[N*N];
+      ValueType d;
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            a[i*N+j] = Lane::load( A.data(i,j)+k );
+
+      batchInvertGroup<Lane,Type>( a, d, SizeT<N>() );
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            Lane::store( A.data(i,j)+k, a[i*N+j] );
+
+      Lane::store( det.data(), d );
+
+      for( size_t l=0UL; l<Lane::size && k+l<end; ++l ) {
+         if( isDefault( det[l] ) )
+            success = false;
+      }
+   }
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the in-place inversion of a batch of \f$ N \times N \f$ matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param begin The index of the first matrix to be processed.
+// \param end The index one past the last matrix to be processed.
+// \return \a true in case all matrices could be inverted, \a false if at least one is singular.
+//
+// The matrices are LU decomposed with partial pivoting, \f$ P A = L U \f$. Afterwards the
+// inverse is computed as \f$ A^{-1} = U^{-1} L^{-1} P \f$ by means of a forward and a backward
+// substitution, which are both vectorized across the group of matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+bool batchInvertKernel( BatchMatrix<Type,N,N>& A, size_t begin, size_t end, FalseType )
+{
+   typedef BatchLane< Type, BatchDivision<Type>::value >  Lane;
+   typedef typename Lane::ValueType                       ValueType;
+
+   AlignedArray<Type,N*N*Lane::size> a;
+   AlignedArray<Type,N*N*Lane::size> b;
+   AlignedArray<Type,Lane::size> pivot;
+   size_t ipiv[N*Lane::size];
+   bool success( true );
+
+   for( size_t k=begin; k<end; k+=Lane::size )
+   {
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            Lane::store( a.data()+(i*N+j)*Lane::size, Lane::load( A.data(i,j)+k ) );
+
+      batchLU<Lane,N>( a.data(), Lane::size, ipiv );
+
+      std::fill( b.data(), b.data()+N*N*Lane::size, Type() );
+
+      for( size_t l=0UL; l<Lane::size; ++l )
+      {
+         for( size_t i=0UL; i<N; ++i ) {
+            b[(i*N+i)*Lane::size+l] = Type(1);
+         }
+
+         for( size_t c=0UL; c<N; ++c ) {
+            const size_t p( ipiv[c*Lane::size+l] );
+            if( p != c ) {
+               for( size_t j=0UL; j<N; ++j )
+                  std::swap( b[(c*N+j)*Lane::size+l], b[(p*N+j)*Lane::size+l] );
+            }
+         }
+
+         for( size_t i=0UL; i<N; ++i ) {
+            if( isDefault( a[(i*N+i)*Lane::size+l] ) && k+l < end )
+               success = false;
+         }
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t r=i+1UL; r<N; ++r ) {
+            const ValueType factor( Lane::load( a.data()+(r*N+i)*Lane::size ) );
+            for( size_t j=0UL; j<N; ++j ) {
+               Lane::store( b.data()+(r*N+j)*Lane::size,
+                            Lane::load( b.data()+(r*N+j)*Lane::size ) - factor * Lane::load( b.data()+(i*N+j)*Lane::size ) );
+            }
+         }
+      }
+
+      for( size_t i=N; i-- > 0UL; )
+      {
+         for( size_t l=0UL; l<Lane::size; ++l ) {
+            const Type& diag( a[(i*N+i)*Lane::size+l] );
+            pivot[l] = ( isDefault( diag ) )?( Type(1) ):( diag );
+         }
+
+         const ValueType inv( Lane::set( Type(1) ) / Lane::load( pivot.data() ) );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            Lane::store( b.data()+(i*N+j)*Lane::size, Lane::load( b.data()+(i*N+j)*Lane::size ) * inv );
+         }
+
+         for( size_t r=0UL; r<i; ++r ) {
+            const ValueType factor( Lane::load( a.data()+(r*N+i)*Lane::size ) );
+            for( size_t j=0UL; j<N; ++j ) {
+               Lane::store( b.data()+(r*N+j)*Lane::size,
+                            Lane::load( b.data()+(r*N+j)*Lane::size ) - factor * Lane::load( b.data()+(i*N+j)*Lane::size ) );
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            Lane::store( A.data(i,j)+k, Lane::load( b.data()+(i*N+j)*Lane::size ) );
+   }
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of two batches of matrices (\f$ C_k = A_k \cdot B_k \f$).
+// \ingroup batch_matrix
+//
+// \param C The resulting batch of \f$ M \times N \f$ matrices.
+// \param A The left-hand side batch of \f$ M \times K \f$ matrices.
+// \param B The right-hand side batch of \f$ K \times N \f$ matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function multiplies every matrix of the batch \a A with the according matrix of the
+// batch \a B and stores the result in the according matrix of the batch \a C, which is resized
+// to the size of the operand batches. Matrix/vector multiplications can be computed by means
+// of batches of \f$ K \times 1 \f$ matrices:
+
+   \code
+   blaze::BatchMatrix<double,6UL,6UL> A( 1000UL ), B( 1000UL ), C;
+   blaze::BatchMatrix<double,6UL,1UL> x( 1000UL ), y;
+   // ... Initialization of the batches
+
+   mult( C, A, B );  // Batch matrix multiplication
+   mult( y, A, x );  // Batch matrix/vector multiplication
+   \endcode
+
+// The multiplication is vectorized across the matrices of the batch and executed in parallel
+// in case the shared memory parallelization is active. Note that the target batch \a C may
+// be identical to \a A or \a B.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void mult( BatchMatrix<Type,M,N>& C, const BatchMatrix<Type,M,K>& A, const BatchMatrix<Type,K,N>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   C.resize( A.size(), false );
+
+   smpBatch( C, [&]( size_t begin, size_t end ) {
+      batchMultKernel( C, A, B, begin, end );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinants of a batch of square matrices.
+// \ingroup batch_matrix
+//
+// \param A The given batch of square matrices.
+// \return The determinants of all matrices of the batch.
+//
+// This function computes the determinants of all matrices of the given batch. The determinants
+// of \f$ 1 \times 1 \f$, \f$ 2 \times 2 \f$, and \f$ 3 \times 3 \f$ matrices are computed via
+// closed formulas, the determinants of larger matrices via an LU decomposition with partial
+// pivoting. In both cases the computation is vectorized across the matrices of the batch.
+//
+// \note This function can only be used for batches with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with batches of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+DynamicVector<Type,columnVector> det( const BatchMatrix<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   DynamicVector<Type,columnVector> d( A.size() );
+
+   smpBatch( A, [&]( size_t begin, size_t end ) {
+      batchDetKernel( d, A, begin, end );
+   } );
+
+   return d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LU decomposition of a batch of square matrices (\f$ A_k = P_k L_k U_k \f$).
+// \ingroup batch_matrix
+//
+// \param A The batch of square matrices to be decomposed.
+// \param L The resulting batch of lower unitriangular matrices.
+// \param U The resulting batch of upper triangular matrices.
+// \param P The resulting batch of permutation matrices.
+// \return void
+//
+// This function performs the LU decomposition with partial pivoting of all matrices of the
+// given batch, such that \f$ A_k = P_k L_k U_k \f$ holds for every matrix of the batch. The
+// elimination is vectorized across the matrices of the batch. In contrast to the LU
+// decomposition of general matrices, the decomposition of singular matrices does not fail,
+// but results in a zero on the diagonal of the according upper triangular matrix.
+//
+// \note This function can only be used for batches with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with batches of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void lu( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,N>& L,
+         BatchMatrix<Type,N,N>& U, BatchMatrix<Type,N,N>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   L.resize( A.size(), false );
+   U.resize( A.size(), false );
+   P.resize( A.size(), false );
+
+   smpBatch( A, [&]( size_t begin, size_t end ) {
+      batchLUKernel( A, L, U, P, begin, end );
+   } );
+
+   resetPadding( L );
+   resetPadding( U );
+   resetPadding( P );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a batch of square matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of square matrices to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch in place. The inverses of
+// \f$ 1 \times 1 \f$, \f$ 2 \times 2 \f$, and \f$ 3 \times 3 \f$ matrices are computed via the
+// adjugate matrix, larger matrices are inverted by means of an LU decomposition with partial
+// pivoting. In both cases the computation is vectorized across the matrices of the batch. In
+// case at least one of the matrices is singular, a \a std::invalid_argument exception is
+// thrown and the contents of the batch are undefined.
+//
+// \note This function can only be used for batches with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with batches of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void invert( BatchMatrix<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   std::atomic<bool> success( true );
+
+   smpBatch( A, [&]( size_t begin, size_t end ) {
+      if( !batchInvertKernel( A, begin, end, BoolConstant< ( N <= 3UL ) >() ) )
+         success = false;
+   } );
+
+   resetPadding( A );
+
+   if( !success ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
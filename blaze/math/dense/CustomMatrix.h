@@ -827,7 +827,7 @@ inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n,
    if( PF && IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
+            if( v_[i*nn_+j] != Type() ) v_[i*nn_+j] = Type();
       }
    }
 }
@@ -930,7 +930,7 @@ inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n,
    if( PF && IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
+            if( v_[i*nn_+j] != Type() ) v_[i*nn_+j] = Type();
       }
    }
 }
@@ -3584,7 +3584,7 @@ inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t
    if( PF && IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
+            if( v_[i+j*mm_] != Type() ) v_[i+j*mm_] = Type();
       }
    }
 }
@@ -3689,7 +3689,7 @@ inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t
    if( PF && IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
+            if( v_[i+j*mm_] != Type() ) v_[i+j*mm_] = Type();
       }
    }
 }
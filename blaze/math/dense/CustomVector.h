@@ -3088,7 +3088,7 @@ inline CustomVector<Type,AF,padded,TF>::CustomVector( Type* ptr, size_t n, size_
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
+         if( v_[i] != Type() ) v_[i] = Type();
    }
 }
 /*! \endcond */
@@ -3141,7 +3141,7 @@ inline CustomVector<Type,AF,padded,TF>::CustomVector( Type* ptr, size_t n, size_
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
+         if( v_[i] != Type() ) v_[i] = Type();
    }
 }
 /*! \endcond */
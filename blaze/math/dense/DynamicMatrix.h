@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -89,6 +90,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Algorithm.h>
@@ -384,6 +386,18 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            IsSame< Type, ElementType_<MT> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -421,7 +435,12 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    template< typename MT >
    inline EnableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,SO>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline DisableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline EnableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -517,7 +536,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in NUMA mode (see the \c BLAZE_USE_NUMA_FIRST_TOUCH
+// switch) the memory of vectorizable element types is touched in parallel in order to distribute
+// it among the NUMA nodes.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -529,6 +550,12 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
+#if BLAZE_NUMA_FIRST_TOUCH_MODE
+      smpFirstTouch( *this, [this]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t i=row; i<row+rows; ++i )
+         std::fill( v_+i*nn_+column, v_+i*nn_+column+columns, Type() );
+      } );
+#endif
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -559,11 +586,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   smpFirstTouch( *this, [this,&init]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t i=row; i<row+rows; ++i )
+         std::fill( v_+i*nn_+column, v_+i*nn_+column+columns, init );
+   } );
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
       }
@@ -730,8 +759,15 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   smpFirstTouch( *this, [this,&m]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t i=row; i<row+rows; ++i )
+         std::copy( m.v_+i*nn_+column, m.v_+i*nn_+column+columns, v_+i*nn_+column );
+   } );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=n_; j<nn_; ++j )
+         v_[i*nn_+j] = m.v_[i*nn_+j];
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -777,10 +813,17 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
-                  j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
-         v_[i*nn_+j] = Type();
+   if( IsSparseMatrix<MT>::value ) {
+      smpFirstTouch( *this, [this]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t i=row; i<row+rows; ++i )
+         std::fill( v_+i*nn_+column, v_+i*nn_+column+columns, Type() );
+      } );
+   }
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j )
+            v_[i*nn_+j] = Type();
       }
    }
 
@@ -1817,6 +1860,11 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by exchanging blocks of elements. Non-square matrices are
+// transposed in-place by means of a cycle-following permutation of the elements, as long as
+// the transposed matrix fits into the currently allocated memory. Otherwise the transposed
+// matrix is assembled in a newly allocated array.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -1824,21 +1872,13 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t nn( adjustColumns( m_ ) );
 
-   if( m_ == n_ )
+   if( m_ == n_ || n_*nn <= capacity_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-      }
+      transposeInPlace_backend( v_, m_, n_, nn_, nn );
+      swap( m_, n_ );
+      nn_ = nn;
    }
    else
    {
@@ -1884,8 +1924,13 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            conjugate( v_[i*nn_+j] );
+         }
+      }
    }
 
    return *this;
@@ -2424,7 +2469,8 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2448,6 +2494,33 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3127,6 +3200,16 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            IsSame< Type, ElementType_<MT> >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -3164,7 +3247,12 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    template< typename MT >
    inline EnableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,true>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline DisableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline EnableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -3254,7 +3342,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in NUMA mode (see the \c BLAZE_USE_NUMA_FIRST_TOUCH
+// switch) the memory of vectorizable element types is touched in parallel in order to distribute
+// it among the NUMA nodes.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
@@ -3265,6 +3355,12 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
+#if BLAZE_NUMA_FIRST_TOUCH_MODE
+      smpFirstTouch( *this, [this]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t j=column; j<column+columns; ++j )
+         std::fill( v_+row+j*mm_, v_+row+j*mm_+rows, Type() );
+      } );
+#endif
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3296,11 +3392,13 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   smpFirstTouch( *this, [this,&init]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t j=column; j<column+columns; ++j )
+         std::fill( v_+row+j*mm_, v_+row+j*mm_+rows, init );
+   } );
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i )
             v_[i+j*mm_] = Type();
       }
@@ -3488,8 +3586,15 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   smpFirstTouch( *this, [this,&m]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t j=column; j<column+columns; ++j )
+         std::copy( m.v_+row+j*mm_, m.v_+row+j*mm_+rows, v_+row+j*mm_ );
+   } );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=m_; i<mm_; ++i )
+         v_[i+j*mm_] = m.v_[i+j*mm_];
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -3537,10 +3642,17 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
-                  i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
-         v_[i+j*mm_] = Type();
+   if( IsSparseMatrix<MT>::value ) {
+      smpFirstTouch( *this, [this]( size_t row, size_t column, size_t rows, size_t columns ) {
+      for( size_t j=column; j<column+columns; ++j )
+         std::fill( v_+row+j*mm_, v_+row+j*mm_+rows, Type() );
+      } );
+   }
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i )
+            v_[i+j*mm_] = Type();
       }
    }
 
@@ -4581,27 +4693,24 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by exchanging blocks of elements. Non-square matrices are
+// transposed in-place by means of a cycle-following permutation of the elements, as long as
+// the transposed matrix fits into the currently allocated memory. Otherwise the transposed
+// matrix is assembled in a newly allocated array.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t mm( adjustRows( n_ ) );
 
-   if( m_ == n_ )
+   if( m_ == n_ || mm*m_ <= capacity_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-      }
+      transposeInPlace_backend( v_, n_, m_, mm_, mm );
+      swap( m_, n_ );
+      mm_ = mm;
    }
    else
    {
@@ -4648,8 +4757,13 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      this->swap( tmp );
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            conjugate( v_[i+j*mm_] );
+         }
+      }
    }
 
    return *this;
@@ -5199,7 +5313,8 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5224,6 +5339,34 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
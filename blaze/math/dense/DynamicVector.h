@@ -79,6 +79,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/Algorithm.h>
@@ -504,7 +505,9 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 // \param n The size of the vector.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in NUMA mode (see the \c BLAZE_USE_NUMA_FIRST_TOUCH
+// switch) the memory of vectorizable element types is touched in parallel in order to distribute
+// it among the NUMA nodes.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -514,6 +517,11 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
    if( IsVectorizable<Type>::value ) {
+#if BLAZE_NUMA_FIRST_TOUCH_MODE
+      smpFirstTouch( *this, [this]( size_t index, size_t size ) {
+         std::fill( v_+index, v_+index+size, Type() );
+      } );
+#endif
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -538,8 +546,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   smpFirstTouch( *this, [this,&init]( size_t index, size_t size ) {
+      std::fill( v_+index, v_+index+size, init );
+   } );
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -677,7 +686,11 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
+   smpFirstTouch( *this, [this,&v]( size_t index, size_t size ) {
+      std::copy( v.v_+index, v.v_+index+size, v_+index );
+   } );
+
+   for( size_t i=size_; i<capacity_; ++i )
       v_[i] = v.v_[i];
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -717,9 +730,15 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
    , capacity_( adjustCapacity( size_ ) )      // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
-               i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
-      v_[i] = Type();
+   if( IsSparseVector<VT>::value ) {
+      smpFirstTouch( *this, [this]( size_t index, size_t size ) {
+         std::fill( v_+index, v_+index+size, Type() );
+      } );
+   }
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
    }
 
    smpAssign( *this, ~v );
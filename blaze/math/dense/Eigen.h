@@ -0,0 +1,611 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Eigen.h
+//  \brief Header file for the dense matrix eigenvalue functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_EIGEN_H_
+#define _BLAZE_MATH_DENSE_EIGEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/heevr.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/lapack/syevr.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  EIGENVALUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Eigenvalue functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
+            LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+            LapackWorkspace< ElementType_<MT1> >& ws );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+size_t eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, ST low, ST upp );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+size_t eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, ST low, ST upp,
+              LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
+size_t eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+              ST low, ST upp );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
+size_t eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+              ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigenvalue computation of real symmetric matrices.
+// \ingroup dense_matrix
+//
+// \param A The symmetric column-major matrix (only the lower part is referenced).
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors, \c 'N' to only compute the eigenvalues.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline DisableIf_< IsComplex< ElementType_<MT> > >
+   eigen_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz,
+                  LapackWorkspace< ElementType_<MT> >& ws )
+{
+   syevd( ~A, ~w, jobz, 'L', ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigenvalue computation of complex Hermitian matrices.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian column-major matrix (only the lower part is referenced).
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors, \c 'N' to only compute the eigenvalues.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline EnableIf_< IsComplex< ElementType_<MT> > >
+   eigen_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz,
+                  LapackWorkspace< ElementType_<MT> >& ws )
+{
+   heevd( ~A, ~w, jobz, 'L', ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the selected eigenvalue computation of real symmetric matrices.
+// \ingroup dense_matrix
+//
+// \param A The symmetric column-major matrix (only the lower part is referenced).
+// \param w The resulting vector of eigenvalues.
+// \param Z Pointer to the resulting matrix of eigenvectors (\c nullptr to skip the eigenvectors).
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed eigenvalues.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2      // Storage order of the matrix Z
+        , typename ST > // Type of the range bounds
+inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
+   eigen_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>* Z,
+                  ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   return syevr_backend( ~A, ~w, Z, 'L', low, upp, ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the selected eigenvalue computation of complex Hermitian matrices.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian column-major matrix (only the lower part is referenced).
+// \param w The resulting vector of eigenvalues.
+// \param Z Pointer to the resulting matrix of eigenvectors (\c nullptr to skip the eigenvectors).
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed eigenvalues.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2      // Storage order of the matrix Z
+        , typename ST > // Type of the range bounds
+inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
+   eigen_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>* Z,
+                  ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   return heevr_backend( ~A, ~w, Z, 'L', low, upp, ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues of the given dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues of the given symmetric (real) or Hermitian (complex)
+// \a n-by-\a n matrix \a A by means of a divide and conquer algorithm. The eigenvalues are
+// returned in ascending order in the given vector \a w, which is resized to \a n (if possible and
+// necessary). Note that only the lower part of \a A is referenced, i.e. \a A can be any dense
+// matrix with symmetric (Hermitian) content as well as a SymmetricMatrix or HermitianMatrix.
+//
+// Example:
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > A( 32UL );
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   // ... Initialization of A
+
+   eigen( A, w );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   eigen( ~A, ~w, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues of the given dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues of the given symmetric or Hermitian matrix (see the
+// overload without workspace for a detailed description). All auxiliary arrays and the copy of
+// \a A are taken from the given workspace \a ws. Therefore repeated eigenvalue computations of
+// matrices of the same size perform only a single LAPACK workspace query and no further memory
+// allocation:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::LapackWorkspace<double> ws;
+
+   for( const blaze::DynamicMatrix<double>& A : matrices ) {
+      eigen( A, w, ws );
+      // ...
+   }
+   \endcode
+
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
+            LapackWorkspace< ElementType_<MT> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   typename LapackWorkspace< ElementType_<MT> >::MatrixType& B( ws.matrix( 0UL ) );
+
+   B = ~A;
+   eigen_backend( B, ~w, 'N', ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues and eigenvectors of the given dense symmetric or
+//        Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and eigenvectors of the given symmetric (real) or
+// Hermitian (complex) \a n-by-\a n matrix \a A by means of a divide and conquer algorithm. The
+// eigenvalues are returned in ascending order in the given vector \a w, the corresponding
+// orthonormal eigenvectors are returned in the columns of the matrix \a V, independent of the
+// storage order of \a V:
+
+                              \f[ A \cdot V = V \cdot diag(w). \f]
+
+// Both \a w and \a V are resized to the correct dimensions (if possible and necessary). Note
+// that only the lower part of \a A is referenced.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   eigen( ~A, ~w, ~V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues and eigenvectors of the given dense symmetric or
+//        Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and eigenvectors of the given symmetric or Hermitian
+// matrix (see the overload without workspace for a detailed description). All auxiliary arrays
+// and matrices are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+            LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   typename LapackWorkspace< ElementType_<MT1> >::MatrixType& B( ws.matrix( 0UL ) );
+
+   B = ~A;
+   eigen_backend( B, ~w, 'V', ws );
+   ~V = B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected eigenvalues of the given dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues of the given symmetric (real) or
+// Hermitian (complex) \a n-by-\a n matrix \a A by means of the MRRR algorithm. The type of the
+// two range arguments \a low and \a upp determines the selected eigenvalues:
+//
+//  - floating point arguments select all eigenvalues in the half-open interval \f$(low..upp]\f$;
+//  - integral arguments select the eigenvalues with the 0-based indices \f$[low..upp]\f$, where
+//    index 0 refers to the smallest eigenvalue.
+//
+// The selected eigenvalues are returned in ascending order in the given vector \a w, which is
+// resized to the number of computed eigenvalues. This number is also returned by the function.
+// Note that only the lower part of \a A is referenced.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 500UL, 500UL );
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   // ... Initialization of A as symmetric matrix
+
+   eigen( A, w, 0, 9 );       // Computes the ten smallest eigenvalues
+   eigen( A, w, 0.0, 1.0 );   // Computes all eigenvalues in the interval (0..1]
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF      // Transpose flag of the vector w
+        , typename ST > // Type of the range bounds
+size_t eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   return eigen( ~A, ~w, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected eigenvalues of the given dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues of the given symmetric or Hermitian
+// matrix (see the overload without workspace for a detailed description). All auxiliary arrays
+// and matrices are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF      // Transpose flag of the vector w
+        , typename ST > // Type of the range bounds
+size_t eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, ST low, ST upp,
+              LapackWorkspace< ElementType_<MT> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typedef typename LapackWorkspace< ElementType_<MT> >::MatrixType  MatrixType;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   MatrixType& B( ws.matrix( 0UL ) );
+
+   B = ~A;
+   return eigen_backend( B, ~w, static_cast<MatrixType*>( nullptr ), low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected eigenvalues and eigenvectors of the given dense symmetric or
+//        Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues and the corresponding eigenvectors
+// of the given symmetric (real) or Hermitian (complex) \a n-by-\a n matrix \a A by means of the
+// MRRR algorithm. The selection of the eigenvalues works as described for the eigen() overload
+// without eigenvectors. The \a m selected eigenvalues are returned in ascending order in \a w,
+// the matrix \a V is resized to \a n-by-\a m and contains the corresponding eigenvectors in its
+// columns. Note that only the lower part of \a A is referenced.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2      // Storage order of the matrix V
+        , typename ST > // Type of the range bounds
+size_t eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+              ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   return eigen( ~A, ~w, ~V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected eigenvalues and eigenvectors of the given dense symmetric or
+//        Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric or Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues and eigenvectors of the given
+// symmetric or Hermitian matrix (see the overload without workspace for a detailed description).
+// All auxiliary arrays and matrices are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2      // Storage order of the matrix V
+        , typename ST > // Type of the range bounds
+size_t eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+              ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   typedef typename LapackWorkspace< ElementType_<MT1> >::MatrixType  MatrixType;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   MatrixType& B( ws.matrix( 0UL ) );
+   MatrixType& Z( ws.matrix( 1UL ) );
+
+   B = ~A;
+   const size_t m( eigen_backend( B, ~w, &Z, low, upp, ws ) );
+   ~V = Z;
+
+   return m;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
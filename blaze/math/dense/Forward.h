@@ -51,12 +51,15 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class BandMatrix;
+template< typename, size_t, size_t > class BatchMatrix;
 template< typename, bool, bool, bool > class CustomMatrix;
 template< typename, bool, bool, bool > class CustomVector;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, bool, size_t > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
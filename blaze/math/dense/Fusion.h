@@ -0,0 +1,1164 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Fusion.h
+//  \brief Header file for the fused evaluation of dense vector operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FUSION_H_
+#define _BLAZE_MATH_DENSE_FUSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecDVecMultExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsConvertible.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASSIGNMENT POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Policy for the deferred assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+struct DeferredAssign
+{
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return true; }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+
+   template< typename VT, typename ST >
+   static BLAZE_ALWAYS_INLINE void store( VT& lhs, size_t i, const ST& rhs ) { lhs.store( i, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Policy for the deferred addition assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+struct DeferredAddAssign
+{
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDAdd<T1,T2>::value; }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+
+   template< typename VT, typename ST >
+   static BLAZE_ALWAYS_INLINE void store( VT& lhs, size_t i, const ST& rhs ) { lhs.store( i, lhs.load(i) + rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Policy for the deferred subtraction assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+struct DeferredSubAssign
+{
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDSub<T1,T2>::value; }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+
+   template< typename VT, typename ST >
+   static BLAZE_ALWAYS_INLINE void store( VT& lhs, size_t i, const ST& rhs ) { lhs.store( i, lhs.load(i) - rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Policy for the deferred multiplication assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+struct DeferredMultAssign
+{
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDMult<T1,T2>::value; }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void apply( T1& lhs, const T2& rhs ) { lhs *= rhs; }
+
+   template< typename VT, typename ST >
+   static BLAZE_ALWAYS_INLINE void store( VT& lhs, size_t i, const ST& rhs ) { lhs.store( i, lhs.load(i) * rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Policy for the deferred division assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+struct DeferredDivAssign
+{
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDDiv<T1,T2>::value; }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void apply( T1& lhs, const T2& rhs ) { lhs /= rhs; }
+
+   template< typename VT, typename ST >
+   static BLAZE_ALWAYS_INLINE void store( VT& lhs, size_t i, const ST& rhs ) { lhs.store( i, lhs.load(i) / rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred assignment of a dense vector expression to a dense vector.
+// \ingroup dense_vector
+//
+// The DeferredAssignment class represents an assignment (or an addition, subtraction,
+// multiplication or division assignment) of a dense vector expression to a dense vector, whose
+// evaluation is deferred to a subsequent call of the fuse() function. Objects of this class are
+// created by the assignment operators of the DeferredTarget class (see the deferred() function).
+*/
+template< typename VT    // Type of the target dense vector
+        , typename VT2   // Type of the right-hand side dense vector expression
+        , typename OP >  // Type of the assignment policy
+class DeferredAssignment
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ElementType_<VT>   ET1;  //!< Element type of the target dense vector.
+   typedef ElementType_<VT2>  ET2;  //!< Element type of the right-hand side expression.
+
+   //! Composite type of the right-hand side dense vector expression.
+   typedef If_< IsExpression<VT2>, const VT2, const VT2& >  Operand;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Processing state of a partition of the fused evaluation.
+   struct State {};
+
+   //! Partial result of a partition of the fused evaluation.
+   struct PartialResult {
+      inline PartialResult& operator+=( const PartialResult& ) { return *this; }
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the selection of the vectorized kernel.
+   enum : bool { vectorizable = useOptimizedKernels &&
+                                VT::simdEnabled && VT2::simdEnabled &&
+                                IsSIMDCombinable<ET1,ET2>::value &&
+                                OP::BLAZE_TEMPLATE simdEnabled<ET1,ET2>() };
+
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DeferredAssignment class.
+   //
+   // \param lhs The target dense vector.
+   // \param rhs The right-hand side dense vector expression.
+   */
+   explicit inline DeferredAssignment( VT& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target dense vector
+      , rhs_( rhs )  // The right-hand side dense vector expression
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements processed by the assignment.
+   //
+   // \return The size of the target dense vector.
+   */
+   inline size_t size() const noexcept {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**First function******************************************************************************
+   /*!\brief Processes the first block of elements of a partition.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void first( size_t i, State& state ) const {
+      block<B>( i, state );
+   }
+   //**********************************************************************************************
+
+   //**Block function******************************************************************************
+   /*!\brief Processes a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void block( size_t i, State& ) const {
+      process<B>( i, Bool<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**Element function****************************************************************************
+   /*!\brief Processes a single element.
+   //
+   // \param i The index of the element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void element( size_t i, State& ) const {
+      OP::apply( lhs_[i], rhs_[i] );
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the partial result of a partition.
+   //
+   // \return The (empty) partial result of the partition.
+   */
+   inline PartialResult result( const State& ) const {
+      return PartialResult();
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Finalizes the assignment.
+   //
+   // \return void
+   */
+   inline void finalize( const PartialResult& ) const {}
+   //**********************************************************************************************
+
+ private:
+   //**Process functions***************************************************************************
+   /*!\brief Vectorized processing of a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void process( size_t i, TrueType ) const {
+      for( size_t k=0UL; k<B; k+=SIMDSIZE ) {
+         OP::store( lhs_, i+k, rhs_.load(i+k) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Default processing of a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void process( size_t i, FalseType ) const {
+      for( size_t k=0UL; k<B; ++k ) {
+         OP::apply( lhs_[i+k], rhs_[i+k] );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT&     lhs_;  //!< The target dense vector.
+   Operand rhs_;  //!< The right-hand side dense vector expression.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDREDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred reduction of a dense vector expression.
+// \ingroup dense_vector
+//
+// The DeferredReduction class represents the reduction of a dense vector expression by means of
+// a binary reduction operation, whose evaluation is deferred to a subsequent call of the fuse()
+// function. Objects of this class are created by the deferredReduce() and deferredDot()
+// functions.
+*/
+template< typename T     // Type of the scalar result
+        , typename VT    // Type of the dense vector expression
+        , typename OP >  // Type of the reduction operation
+class DeferredReduction
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ElementType_<VT>  ET;        //!< Element type of the dense vector expression.
+   typedef SIMDTrait_<ET>    SIMDType;  //!< SIMD type of the dense vector expression.
+
+   //! Composite type of the dense vector expression.
+   typedef If_< IsExpression<VT>, const VT, const VT& >  Operand;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+
+   //! Helper structure for the detection of the SIMD capabilities of the reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+
+   //! Helper structure for the detection of the SIMD capabilities of the dense vector expression.
+   /*! In case the dense vector expression is SIMD-enabled, \a value is set to 1 if the result of
+       the load() function (which might be a SIMD expression, as for instance in case of a fused
+       multiply-add) can be converted to the SIMD type of the element type. */
+   struct HasConvertibleSIMDType {
+      enum : bool { value = IsConvertible< Decay_< decltype( std::declval<const VT&>().load( 0UL ) ) >, SIMDType >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Processing state of a partition of the fused evaluation.
+   struct State {
+      SIMDType xmm1, xmm2, xmm3, xmm4;  //!< The four independent SIMD accumulators.
+      ET value = ET();                  //!< The scalar accumulator.
+      bool simd = false;                //!< Flag for the initialization of the SIMD accumulators.
+      bool scalar = false;              //!< Flag for the initialization of the scalar accumulator.
+   };
+
+   //! Partial result of a partition of the fused evaluation.
+   struct PartialResult {
+      ET value = ET();          //!< The result of the reduction within the partition.
+      bool valid = false;       //!< \a true in case the partition contained any elements.
+      const OP* op = nullptr;   //!< The reduction operation.
+
+      inline PartialResult& operator+=( const PartialResult& rhs ) {
+         if( !rhs.valid ) return *this;
+         if( valid ) value = (*op)( value, rhs.value );
+         else *this = rhs;
+         return *this;
+      }
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the selection of the vectorized kernel.
+   enum : bool { vectorizable = useOptimizedKernels &&
+                                If_< Bool< VT::simdEnabled >, HasConvertibleSIMDType, FalseType >::value &&
+                                If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DeferredReduction class.
+   //
+   // \param result The scalar receiving the result of the reduction.
+   // \param dv The dense vector expression to be reduced.
+   // \param op The reduction operation.
+   */
+   explicit inline DeferredReduction( T& result, const VT& dv, OP op )
+      : result_( result )  // The scalar receiving the result of the reduction
+      , dv_    ( dv )      // The dense vector expression to be reduced
+      , op_    ( op )      // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements processed by the reduction.
+   //
+   // \return The size of the reduced dense vector expression.
+   */
+   inline size_t size() const noexcept {
+      return dv_.size();
+   }
+   //**********************************************************************************************
+
+   //**First function******************************************************************************
+   /*!\brief Processes the first block of elements of a partition.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void first( size_t i, State& state ) const {
+      initialize<B>( i, state, Bool<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**Block function******************************************************************************
+   /*!\brief Processes a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void block( size_t i, State& state ) const {
+      process<B>( i, state, Bool<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**Element function****************************************************************************
+   /*!\brief Processes a single element.
+   //
+   // \param i The index of the element.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void element( size_t i, State& state ) const {
+      if( state.scalar ) {
+         state.value = op_( state.value, dv_[i] );
+      }
+      else {
+         state.value  = dv_[i];
+         state.scalar = true;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the partial result of a partition.
+   //
+   // \param state The processing state of the partition.
+   // \return The result of the reduction within the partition.
+   */
+   inline PartialResult result( const State& state ) const {
+      PartialResult partial;
+      partial.op = &op_;
+      combine( partial, state, Bool<vectorizable>() );
+      if( state.scalar ) {
+         partial.value = ( partial.valid )?( op_( partial.value, state.value ) ):( state.value );
+         partial.valid = true;
+      }
+      return partial;
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Assigns the result of the reduction to the target scalar.
+   //
+   // \param partial The combined result of all partitions.
+   // \return void
+   */
+   inline void finalize( const PartialResult& partial ) const {
+      result_ = ( partial.valid )?( partial.value ):( ET() );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Initialize functions************************************************************************
+   /*!\brief Vectorized initialization of the SIMD accumulators by a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void initialize( size_t i, State& state, TrueType ) const {
+      state.xmm1 = dv_.load(i             );
+      state.xmm2 = dv_.load(i+SIMDSIZE    );
+      state.xmm3 = dv_.load(i+SIMDSIZE*2UL);
+      state.xmm4 = dv_.load(i+SIMDSIZE*3UL);
+      state.simd = true;
+      process<B>( i, state, TrueType(), SIMDSIZE*4UL );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Default initialization of the accumulator by a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void initialize( size_t i, State& state, FalseType ) const {
+      process<B>( i, state, FalseType() );
+   }
+   //**********************************************************************************************
+
+   //**Process functions***************************************************************************
+   /*!\brief Vectorized processing of a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \param offset The number of leading elements of the block that have already been processed.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void process( size_t i, State& state, TrueType, size_t offset = 0UL ) const {
+      for( size_t k=offset; k<B; k+=SIMDSIZE*4UL ) {
+         state.xmm1 = op_.load( state.xmm1, SIMDType( dv_.load(i+k             ) ) );
+         state.xmm2 = op_.load( state.xmm2, SIMDType( dv_.load(i+k+SIMDSIZE    ) ) );
+         state.xmm3 = op_.load( state.xmm3, SIMDType( dv_.load(i+k+SIMDSIZE*2UL) ) );
+         state.xmm4 = op_.load( state.xmm4, SIMDType( dv_.load(i+k+SIMDSIZE*3UL) ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Default processing of a block of \a B elements.
+   //
+   // \param i The index of the first element of the block.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   template< size_t B >
+   BLAZE_ALWAYS_INLINE void process( size_t i, State& state, FalseType ) const {
+      for( size_t k=0UL; k<B; ++k ) {
+         element( i+k, state );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Combine functions***************************************************************************
+   /*!\brief Horizontal reduction of the SIMD accumulators.
+   //
+   // \param partial The partial result of the partition.
+   // \param state The processing state of the partition.
+   // \return void
+   */
+   inline void combine( PartialResult& partial, const State& state, TrueType ) const {
+      if( state.simd ) {
+         partial.value = reduce( op_.load( op_.load( state.xmm1, state.xmm2 )
+                                         , op_.load( state.xmm3, state.xmm4 ) ), op_ );
+         partial.valid = true;
+      }
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Default combination of the accumulators (no SIMD accumulators in use).
+   //
+   // \return void
+   */
+   inline void combine( PartialResult&, const State&, FalseType ) const {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T&      result_;  //!< The scalar receiving the result of the reduction.
+   Operand dv_;      //!< The dense vector expression to be reduced.
+   OP      op_;      //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDTARGET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Proxy for the creation of deferred assignments to a dense vector.
+// \ingroup dense_vector
+//
+// The DeferredTarget class wraps a dense vector, whose assignment operators create deferred
+// assignments instead of evaluating the right-hand side expression immediately. Objects of
+// this class are created by the deferred() function.
+*/
+template< typename VT  // Type of the target dense vector
+        , bool TF >    // Transpose flag
+class DeferredTarget
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DeferredTarget class.
+   //
+   // \param target The target dense vector.
+   */
+   explicit inline DeferredTarget( VT& target ) noexcept
+      : target_( target )  // The target dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename VT2 >
+   inline const DeferredAssignment<VT,VT2,DeferredAssign>
+      operator=( const DenseVector<VT2,TF>& rhs ) const;
+
+   template< typename VT2 >
+   inline const DeferredAssignment<VT,VT2,DeferredAddAssign>
+      operator+=( const DenseVector<VT2,TF>& rhs ) const;
+
+   template< typename VT2 >
+   inline const DeferredAssignment<VT,VT2,DeferredSubAssign>
+      operator-=( const DenseVector<VT2,TF>& rhs ) const;
+
+   template< typename VT2 >
+   inline const DeferredAssignment<VT,VT2,DeferredMultAssign>
+      operator*=( const DenseVector<VT2,TF>& rhs ) const;
+
+   template< typename VT2 >
+   inline const DeferredAssignment<VT,VT2,DeferredDivAssign>
+      operator/=( const DenseVector<VT2,TF>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT2 >
+   inline void checkSize( const DenseVector<VT2,TF>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT& target_;  //!< The target dense vector.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred assignment of a dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression.
+// \return The deferred assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline const DeferredAssignment<VT,VT2,DeferredAssign>
+   DeferredTarget<VT,TF>::operator=( const DenseVector<VT2,TF>& rhs ) const
+{
+   checkSize( rhs );
+   return DeferredAssignment<VT,VT2,DeferredAssign>( target_, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred addition assignment of a dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression to be added.
+// \return The deferred addition assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline const DeferredAssignment<VT,VT2,DeferredAddAssign>
+   DeferredTarget<VT,TF>::operator+=( const DenseVector<VT2,TF>& rhs ) const
+{
+   checkSize( rhs );
+   return DeferredAssignment<VT,VT2,DeferredAddAssign>( target_, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred subtraction assignment of a dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression to be subtracted.
+// \return The deferred subtraction assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline const DeferredAssignment<VT,VT2,DeferredSubAssign>
+   DeferredTarget<VT,TF>::operator-=( const DenseVector<VT2,TF>& rhs ) const
+{
+   checkSize( rhs );
+   return DeferredAssignment<VT,VT2,DeferredSubAssign>( target_, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred componentwise multiplication assignment of a dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression for the multiplication.
+// \return The deferred multiplication assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline const DeferredAssignment<VT,VT2,DeferredMultAssign>
+   DeferredTarget<VT,TF>::operator*=( const DenseVector<VT2,TF>& rhs ) const
+{
+   checkSize( rhs );
+   return DeferredAssignment<VT,VT2,DeferredMultAssign>( target_, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred componentwise division assignment of a dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression divisor.
+// \return The deferred division assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline const DeferredAssignment<VT,VT2,DeferredDivAssign>
+   DeferredTarget<VT,TF>::operator/=( const DenseVector<VT2,TF>& rhs ) const
+{
+   checkSize( rhs );
+   return DeferredAssignment<VT,VT2,DeferredDivAssign>( target_, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the size of the given right-hand side dense vector expression.
+//
+// \param rhs The right-hand side dense vector expression.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the target dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector expression
+inline void DeferredTarget<VT,TF>::checkSize( const DenseVector<VT2,TF>& rhs ) const
+{
+   if( target_.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED EVALUATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combined partial results of all statements of a fused evaluation.
+// \ingroup dense_vector
+*/
+template< typename... STs >  // Types of the fused statements
+struct DeferredResults
+{
+   //**Type definitions****************************************************************************
+   //! Type of the index sequence over all statements.
+   typedef std::index_sequence_for<STs...>  Indices;
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Combines the partial results of the given partition with the current results.
+   //
+   // \param rhs The partial results of the subsequent partition.
+   // \return Reference to the combined results.
+   */
+   inline DeferredResults& operator+=( const DeferredResults& rhs ) {
+      combine( rhs, Indices() );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial results of all statements.
+   //
+   // \param rhs The partial results of the subsequent partition.
+   // \return void
+   */
+   template< size_t... Is >
+   inline void combine( const DeferredResults& rhs, std::index_sequence<Is...> ) {
+      using Swallow = int[];
+      (void)Swallow{ 0, ( std::get<Is>( partials ) += std::get<Is>( rhs.partials ), 0 )... };
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::tuple< typename STs::PartialResult... > partials;  //!< The partial results of all statements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the fused evaluation of a range of elements.
+// \ingroup dense_vector
+//
+// \param statements The fused statements.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The partial results of all statements for the given range.
+//
+// This function processes the element range \f$ [begin..end) \f$ of all fused statements in
+// blocks of \a B elements. All statements are applied to a block in the given order before the
+// next block is processed, i.e. every operand is streamed from memory only once and every
+// statement observes the effects of all preceding statements on the elements of the block. The
+// remaining elements are processed one by one. This function must \b NOT be called explicitly!
+// It is used internally for the fused evaluation of dense vector operations. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors. Instead
+// of using this function use the fuse() function.
+*/
+template< size_t B          // Number of elements per block
+        , typename... STs   // Types of the fused statements
+        , size_t... Is >    // Indices of the fused statements
+inline DeferredResults<STs...>
+   fuse_backend( const std::tuple<const STs&...>& statements, size_t begin, size_t end,
+                 std::index_sequence<Is...> )
+{
+   using Swallow = int[];
+
+   std::tuple< typename STs::State... > states;
+
+   size_t i( begin );
+
+   if( i+B <= end )
+   {
+      (void)Swallow{ 0, ( std::get<Is>( statements ).BLAZE_TEMPLATE first<B>( i, std::get<Is>( states ) ), 0 )... };
+
+      for( i+=B; i+B<=end; i+=B ) {
+         (void)Swallow{ 0, ( std::get<Is>( statements ).BLAZE_TEMPLATE block<B>( i, std::get<Is>( states ) ), 0 )... };
+      }
+   }
+
+   for( ; i<end; ++i ) {
+      (void)Swallow{ 0, ( std::get<Is>( statements ).element( i, std::get<Is>( states ) ), 0 )... };
+   }
+
+   DeferredResults<STs...> results;
+   (void)Swallow{ 0, ( std::get<Is>( results.partials ) = std::get<Is>( statements ).result( std::get<Is>( states ) ), 0 )... };
+
+   return results;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finalization of all fused statements.
+// \ingroup dense_vector
+//
+// \param statements The fused statements.
+// \param results The combined results of all partitions.
+// \return void
+*/
+template< typename... STs   // Types of the fused statements
+        , size_t... Is >    // Indices of the fused statements
+inline void fuse_finalize( const std::tuple<const STs&...>& statements,
+                           const DeferredResults<STs...>& results, std::index_sequence<Is...> )
+{
+   using Swallow = int[];
+   (void)Swallow{ 0, ( std::get<Is>( statements ).finalize( std::get<Is>( results.partials ) ), 0 )... };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused evaluation functions */
+//@{
+template< typename VT, bool TF >
+inline DeferredTarget<VT,TF> deferred( DenseVector<VT,TF>& dv ) noexcept;
+
+template< typename T, typename VT, bool TF, typename OP >
+inline const DeferredReduction<T,VT,OP>
+   deferredReduce( T& result, const DenseVector<VT,TF>& dv, OP op );
+
+template< typename T, typename VT1, typename VT2, bool TF >
+inline decltype(auto)
+   deferredDot( T& result, const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename... STs >
+inline void fuse( const STs&... statements );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the given dense vector as target of a deferred assignment.
+// \ingroup dense_vector
+//
+// \param dv The target dense vector.
+// \return Proxy for the creation of deferred assignments to the dense vector.
+//
+// This function returns a proxy for the given dense vector, whose assignment operators (\c =,
+// \c +=, \c -=, \c *= and \c /=) don't evaluate the right-hand side expression but return a
+// deferred assignment, which can be evaluated together with other statements via the fuse()
+// function:
+
+   \code
+   blaze::DynamicVector<double> x, p, r, Ap;
+   double alpha, rr;
+   // ... Resizing and initialization
+
+   fuse( deferred( x ) += alpha * p,
+         deferred( r ) -= alpha * Ap,
+         deferredDot( rr, r, r ) );
+   \endcode
+*/
+template< typename VT  // Type of the target dense vector
+        , bool TF >    // Transpose flag
+inline DeferredTarget<VT,TF> deferred( DenseVector<VT,TF>& dv ) noexcept
+{
+   return DeferredTarget<VT,TF>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred reduction of the given dense vector expression.
+// \ingroup dense_vector
+//
+// \param result The scalar receiving the result of the reduction.
+// \param dv The dense vector expression to be reduced.
+// \param op The reduction operation.
+// \return The deferred reduction.
+//
+// This function returns a deferred reduction of the given dense vector expression by means
+// of the given reduction operation (see the reduce() function), which can be evaluated together
+// with other statements via the fuse() function. The result of the reduction is assigned to
+// \a result at the end of the fused evaluation:
+
+   \code
+   blaze::DynamicVector<double> x, y;
+   double xmax;
+   // ... Resizing and initialization
+
+   fuse( deferred( x ) += y, deferredReduce( xmax, x, blaze::Maximum() ) );
+   \endcode
+*/
+template< typename T     // Type of the scalar result
+        , typename VT    // Type of the dense vector expression
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline const DeferredReduction<T,VT,OP>
+   deferredReduce( T& result, const DenseVector<VT,TF>& dv, OP op )
+{
+   return DeferredReduction<T,VT,OP>( result, ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred scalar product of two dense vectors.
+// \ingroup dense_vector
+//
+// \param result The scalar receiving the scalar product.
+// \param lhs The left-hand side dense vector expression.
+// \param rhs The right-hand side dense vector expression.
+// \return The deferred scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function returns a deferred computation of the scalar product \f$ \vec{a}^T\vec{b} \f$
+// (i.e. without complex conjugation, as for \c trans(a)*b), which can be evaluated together
+// with other statements via the fuse() function. The scalar product is assigned to \a result
+// at the end of the fused evaluation.
+*/
+template< typename T     // Type of the scalar result
+        , typename VT1   // Type of the left-hand side dense vector expression
+        , typename VT2   // Type of the right-hand side dense vector expression
+        , bool TF >      // Transpose flag
+inline decltype(auto)
+   deferredDot( T& result, const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   return deferredReduce( result, (~lhs) * (~rhs), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of a sequence of deferred dense vector operations.
+// \ingroup dense_vector
+//
+// \param statements The deferred assignments and reductions to be evaluated.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates the given deferred assignments (see the deferred() function) and
+// reductions (see the deferredReduce() and deferredDot() functions) in a single pass over the
+// involved vectors. In contrast to a sequence of separate assignments, which streams every
+// vector once per assignment, the fused evaluation applies all statements to a block of
+// elements in the given order while the block resides in the registers or in the L1 cache.
+// The typical sequence of vector updates of the CG method, for instance, can be evaluated with
+// a single traversal of all vectors instead of three:
+
+   \code
+   blaze::DynamicVector<double> x, p, r, Ap;
+   double alpha, rr;
+   // ... Resizing and initialization
+
+   // Separate evaluation: r and x are read and written, r is read a second time
+   r -= alpha * Ap;
+   x += alpha * p;
+   rr = trans( r ) * r;
+
+   // Fused evaluation: every vector is streamed from memory only once
+   fuse( deferred( r ) -= alpha * Ap,
+         deferred( x ) += alpha * p,
+         deferredDot( rr, r, r ) );
+   \endcode
+
+// The statements are evaluated by means of the vectorized kernels of the according dense vector
+// expressions (i.e. via their SIMD \c load() functions) and are processed in parallel in case
+// the total number of processed elements exceeds the blaze::SMP_SOLVER_THRESHOLD. The results
+// of the reductions are assigned to the according scalars once all elements have been
+// processed. The partial results of the parallel partitions are combined in the order of the
+// partitions, i.e. the result does not depend on the scheduling of the threads.
+//
+// Since all statements are evaluated element by element, the fused evaluation gives the same
+// result as the sequential evaluation of the statements only if every statement accesses the
+// involved vectors element-wise. Therefore the right-hand side expressions must not require
+// an intermediate evaluation (as for instance a matrix/vector multiplication does), which is
+// checked at compile time, and a statement must not access the target of a preceding statement
+// at a different index (as for instance via an overlapping subvector). Also note that scalar
+// operands of the expressions are captured when the statements are created, i.e. the result of
+// a reduction is not available to the other statements of the same fused evaluation. In case
+// the sizes of the involved vectors don't match, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename... STs >  // Types of the fused statements
+inline void fuse( const STs&... statements )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( sizeof...( STs ) > 0UL, "No statements given for the fused evaluation" );
+
+   typedef DeferredResults<STs...>  RT;
+
+   constexpr size_t B( 4UL * std::max<size_t>( { size_t( STs::SIMDSIZE )... } ) );
+
+   const size_t sizes[] = { statements.size()... };
+   const size_t N( sizes[0UL] );
+
+   for( size_t size : sizes ) {
+      if( size != N ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+      }
+   }
+
+   const std::tuple<const STs&...> tuple( statements... );
+
+   const RT results( smpFusedKernel<RT>( N, N*sizeof...( STs ), [&tuple]( size_t begin, size_t end )
+   {
+      return fuse_backend<B>( tuple, begin, end, typename RT::Indices() );
+   } ) );
+
+   fuse_finalize( tuple, results, typename RT::Indices() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
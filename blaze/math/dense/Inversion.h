@@ -40,7 +40,7 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
+#include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -48,12 +48,14 @@
 #include <blaze/math/dense/StaticMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/InversionFlag.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/lapack/getri.h>
 #include <blaze/math/lapack/hetrf.h>
 #include <blaze/math/lapack/hetri.h>
+#include <blaze/math/lapack/native/getrf.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
 #include <blaze/math/lapack/sytrf.h>
@@ -63,6 +65,8 @@
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -3262,6 +3266,604 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 
 
 
+//=================================================================================================
+//
+//  INVERSION FUNCTIONS FOR 7x7 AND 8x8 MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place Gauss-Jordan inversion of the given small column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given \f$ N \times N \f$ matrix by means of an in-place Gauss-Jordan
+// elimination with partial pivoting. All eliminations are performed column by column, i.e. the
+// innermost loops traverse the contiguous elements of a column. Due to the compile time loop
+// bounds the compiler is able to completely unroll and vectorize the inversion.
+*/
+template< size_t N       // Number of rows and columns of the matrix
+        , typename ET >  // Element type of the matrix
+inline void invertGaussJordan( StaticMatrix<ET,N,N,columnMajor>& A )
+{
+   size_t ipiv[N];
+   ET factors[N];
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      size_t p( k );
+      auto pmax( pivotMagnitude( A(k,k) ) );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         const auto tmp( pivotMagnitude( A(i,k) ) );
+         if( tmp > pmax ) {
+            p    = i;
+            pmax = tmp;
+         }
+      }
+
+      if( !isDivisor( A(p,k) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+
+      ipiv[k] = p;
+
+      if( p != k ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            std::swap( A(k,j), A(p,j) );
+         }
+      }
+
+      const ET inv( ET(1) / A(k,k) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         factors[i] = A(i,k);
+         A(i,k) = ET(0);
+      }
+
+      factors[k] = ET(0);
+      A(k,k) = ET(1);
+
+      for( size_t j=0UL; j<N; ++j )
+      {
+         const ET tmp( A(k,j) * inv );
+         A(k,j) = tmp;
+
+         for( size_t i=0UL; i<N; ++i ) {
+            A(i,j) -= factors[i] * tmp;
+         }
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; ) {
+      if( ipiv[k] != k ) {
+         for( size_t i=0UL; i<N; ++i ) {
+            std::swap( A(i,k), A(i,ipiv[k]) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given small lower triangular column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The lower triangular column-major matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the lower part of the given \f$ N \times N \f$ matrix by means of a
+// column-oriented forward substitution (see the LAPACK trti2() functions). In case \a UNI is
+// set to \a true, the diagonal elements are assumed to be 1 and are not accessed. Due to the
+// compile time loop bounds the compiler is able to completely unroll the inversion.
+*/
+template< bool UNI       // Unitriangular flag
+        , size_t N       // Number of rows and columns of the matrix
+        , typename ET >  // Element type of the matrix
+inline void invertLowerTriangular( StaticMatrix<ET,N,N,columnMajor>& A )
+{
+   for( size_t j=N; j-- > 0UL; )
+   {
+      if( !UNI ) {
+         if( !isDivisor( A(j,j) ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+         }
+         invert( A(j,j) );
+      }
+
+      for( size_t k=N; k-- > j+1UL; )
+      {
+         const ET tmp( A(k,j) );
+
+         if( !UNI ) {
+            A(k,j) = A(k,k) * tmp;
+         }
+
+         for( size_t i=k+1UL; i<N; ++i ) {
+            A(i,j) += A(i,k) * tmp;
+         }
+      }
+
+      const ET ajj( UNI ? ET(-1) : -A(j,j) );
+
+      for( size_t i=j+1UL; i<N; ++i ) {
+         A(i,j) *= ajj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The general dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given general dense \f$ N \times N \f$ matrix by means of a Gauss-
+// Jordan elimination with partial pivoting on a StaticMatrix, which does not require any dynamic
+// memory. The matrix inversion fails if the given matrix is singular and not invertible. In this
+// case a \a std::runtime_error exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertGeneralStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( ~dm );
+
+   invertGaussJordan( A );
+
+   (~dm) = A;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given symmetric dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The symmetric dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given symmetric dense \f$ N \times N \f$ matrix by means of a Gauss-
+// Jordan elimination with partial pivoting on a StaticMatrix, which does not require any dynamic
+// memory. The result is symmetrized based on its lower part. The matrix inversion fails if the
+// given matrix is singular and not invertible. In this case a \a std::runtime_error exception
+// is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertSymmetricStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( ~dm );
+   MT& B( ~dm );
+
+   invertGaussJordan( A );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=j; i<N; ++i ) {
+         B(i,j) = A(i,j);
+         B(j,i) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given Hermitian dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The Hermitian dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given Hermitian dense \f$ N \times N \f$ matrix by means of a Gauss-
+// Jordan elimination with partial pivoting on a StaticMatrix, which does not require any dynamic
+// memory. The result is made Hermitian based on its lower part. The matrix inversion fails if
+// the given matrix is singular and not invertible. In this case a \a std::runtime_error
+// exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertHermitianStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( ~dm );
+   MT& B( ~dm );
+
+   invertGaussJordan( A );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      B(j,j) = ET( real( A(j,j) ) );
+
+      for( size_t i=j+1UL; i<N; ++i ) {
+         B(i,j) = A(i,j);
+         B(j,i) = conj( A(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given lower dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The lower dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given lower dense \f$ N \times N \f$ matrix by means of a forward
+// substitution on a StaticMatrix, which does not require any dynamic memory. The matrix inversion
+// fails if the given matrix is singular and not invertible. In this case a \a std::runtime_error
+// exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertLowerStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( ~dm );
+   MT& B( ~dm );
+
+   invertLowerTriangular<false>( A );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=j; i<N; ++i ) {
+         B(i,j) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given unilower dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The unilower dense matrix to be inverted.
+// \return void
+//
+// This function inverts the given unilower dense \f$ N \times N \f$ matrix by means of a forward
+// substitution on a StaticMatrix, which does not require any dynamic memory.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertUniLowerStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( ~dm );
+   MT& B( ~dm );
+
+   invertLowerTriangular<true>( A );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=j+1UL; i<N; ++i ) {
+         B(i,j) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given upper dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The upper dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given upper dense \f$ N \times N \f$ matrix by means of a forward
+// substitution on the transpose of the matrix, which does not require any dynamic memory. The
+// matrix inversion fails if the given matrix is singular and not invertible. In this case a
+// \a std::runtime_error exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertUpperStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( trans( ~dm ) );
+   MT& B( ~dm );
+
+   invertLowerTriangular<false>( A );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=j; i<N; ++i ) {
+         B(j,i) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given uniupper dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The uniupper dense matrix to be inverted.
+// \return void
+//
+// This function inverts the given uniupper dense \f$ N \times N \f$ matrix by means of a forward
+// substitution on the transpose of the matrix, which does not require any dynamic memory.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertUniUpperStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   StaticMatrix<ET,N,N,columnMajor> A( trans( ~dm ) );
+   MT& B( ~dm );
+
+   invertLowerTriangular<true>( A );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=j+1UL; i<N; ++i ) {
+         B(j,i) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given diagonal dense \f$ N \times N \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The diagonal dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given diagonal dense \f$ N \times N \f$ matrix. The matrix inversion
+// fails if the given matrix is singular and not invertible. In this case a \a std::runtime_error
+// exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< size_t N     // Number of rows and columns of the matrix
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertDiagonalStatic( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == N, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == N, "Invalid number of columns detected" );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      if( !isDivisor( (~dm)(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+
+      invert( (~dm)(i,i) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given dense 7x7 matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given dense 7x7 matrix via the specified matrix inversion algorithm
+// \a IF. In contrast to the inversion of larger matrices the inversion does not require a LAPACK
+// library and does not perform any dynamic memory allocation. The matrix inversion fails if the
+// given matrix is singular and not invertible. In this case a \a std::runtime_error exception
+// is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< InversionFlag IF  // Inversion algorithm
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+inline void invert7x7( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( isSquare( ~dm ), "Non-square matrix detected" );
+
+   switch( IF ) {
+      case byLU       : invertGeneralStatic  <7UL>( ~dm ); break;
+      case byLDLT     : invertSymmetricStatic<7UL>( ~dm ); break;
+      case byLDLH     : invertHermitianStatic<7UL>( ~dm ); break;
+      case byLLH      : invertHermitianStatic<7UL>( ~dm ); break;
+      case asGeneral  : invertGeneralStatic  <7UL>( ~dm ); break;
+      case asSymmetric: invertSymmetricStatic<7UL>( ~dm ); break;
+      case asHermitian: invertHermitianStatic<7UL>( ~dm ); break;
+      case asLower    : invertLowerStatic    <7UL>( ~dm ); break;
+      case asUniLower : invertUniLowerStatic <7UL>( ~dm ); break;
+      case asUpper    : invertUpperStatic    <7UL>( ~dm ); break;
+      case asUniUpper : invertUniUpperStatic <7UL>( ~dm ); break;
+      case asDiagonal : invertDiagonalStatic <7UL>( ~dm ); break;
+      default: BLAZE_INTERNAL_ASSERT( false, "Unhandled case detected" );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~dm ), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given dense 8x8 matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given dense 8x8 matrix via the specified matrix inversion algorithm
+// \a IF. In contrast to the inversion of larger matrices the inversion does not require a LAPACK
+// library and does not perform any dynamic memory allocation. The matrix inversion fails if the
+// given matrix is singular and not invertible. In this case a \a std::runtime_error exception
+// is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< InversionFlag IF  // Inversion algorithm
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+inline void invert8x8( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( isSquare( ~dm ), "Non-square matrix detected" );
+
+   switch( IF ) {
+      case byLU       : invertGeneralStatic  <8UL>( ~dm ); break;
+      case byLDLT     : invertSymmetricStatic<8UL>( ~dm ); break;
+      case byLDLH     : invertHermitianStatic<8UL>( ~dm ); break;
+      case byLLH      : invertHermitianStatic<8UL>( ~dm ); break;
+      case asGeneral  : invertGeneralStatic  <8UL>( ~dm ); break;
+      case asSymmetric: invertSymmetricStatic<8UL>( ~dm ); break;
+      case asHermitian: invertHermitianStatic<8UL>( ~dm ); break;
+      case asLower    : invertLowerStatic    <8UL>( ~dm ); break;
+      case asUniLower : invertUniLowerStatic <8UL>( ~dm ); break;
+      case asUpper    : invertUpperStatic    <8UL>( ~dm ); break;
+      case asUniUpper : invertUniUpperStatic <8UL>( ~dm ); break;
+      case asDiagonal : invertDiagonalStatic <8UL>( ~dm ); break;
+      default: BLAZE_INTERNAL_ASSERT( false, "Unhandled case detected" );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~dm ), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  INVERSION FUNCTIONS FOR NxN MATRICES
@@ -3304,10 +3906,10 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
-   const std::unique_ptr<int[]> ipiv( new int[n] );
+   ArenaArray<int> ipiv( n );
 
-   getrf( ~dm, ipiv.get() );
-   getri( ~dm, ipiv.get() );
+   getrf( ~dm, ipiv.data() );
+   getri( ~dm, ipiv.data() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3351,10 +3953,10 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
    BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
-   const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
+   ArenaArray<int> ipiv( (~dm).rows() );
 
-   sytrf( ~dm, uplo, ipiv.get() );
-   sytri( ~dm, uplo, ipiv.get() );
+   sytrf( ~dm, uplo, ipiv.data() );
+   sytri( ~dm, uplo, ipiv.data() );
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3453,10 +4055,10 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
-   const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
+   ArenaArray<int> ipiv( (~dm).rows() );
 
-   hetrf( ~dm, uplo, ipiv.get() );
-   hetri( ~dm, uplo, ipiv.get() );
+   hetrf( ~dm, uplo, ipiv.data() );
+   hetri( ~dm, uplo, ipiv.data() );
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3918,6 +4520,8 @@ inline void invert( DenseMatrix<MT,SO>& dm )
       case 4UL: invert4x4<IF>( ~dm ); break;
       case 5UL: invert5x5<IF>( ~dm ); break;
       case 6UL: invert6x6<IF>( ~dm ); break;
+      case 7UL: invert7x7<IF>( ~dm ); break;
+      case 8UL: invert8x8<IF>( ~dm ); break;
       default : invertNxN<IF>( ~dm ); break;
    }
 
@@ -49,10 +49,13 @@
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/potrf.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 
 
 namespace blaze {
@@ -115,8 +118,10 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), this function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error. Matrices with
+// less than blaze::DECOMPOSITION_THRESHOLD elements are always decomposed by the native kernels.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -166,7 +171,14 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
-   potrf( l, 'L' );
+#if BLAZE_LAPACK_MODE
+   if( n*n >= DECOMPOSITION_THRESHOLD ) {
+      potrf( l, 'L' );
+      return;
+   }
+#endif
+
+   nativePotrf( l, 'L' );
 }
 //*************************************************************************************************
 
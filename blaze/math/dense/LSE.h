@@ -0,0 +1,402 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/LSE.h
+//  \brief Header file for the dense linear system solver functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_LSE_H_
+#define _BLAZE_MATH_DENSE_LSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/LU.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/lapack/native/getrs.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/ArenaArray.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LINEAR SYSTEM SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Linear system solver functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the substitution step of the solution of a linear system.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed column-major system matrix.
+// \param B The right-hand side vector or the column-major matrix of right-hand sides.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+//
+// This function is an auxiliary helper for the solution of a general linear system of equations.
+// It selects between the native substitution kernel and the LAPACK kernel depending on the size
+// of the given system matrix.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T > // Type of the right-hand side(s)
+inline EnableIf_< UseLapackDecomposition<MT> >
+   getrs_backend( DenseMatrix<MT,columnMajor>& A, T& B, const int* ipiv )
+{
+   if( (~A).rows() * (~A).columns() >= DECOMPOSITION_THRESHOLD ) {
+      getrs( ~A, B, 'N', ipiv );
+      return;
+   }
+
+   nativeGetrs( ~A, B, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the substitution step of the solution of a linear system.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed column-major system matrix.
+// \param B The right-hand side vector or the column-major matrix of right-hand sides.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+//
+// This function is an auxiliary helper for the solution of a general linear system of equations
+// in case the LAPACK mode is disabled or the size of the given system matrix is limited below
+// the decomposition threshold at compile time. It always uses the native substitution kernel.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T > // Type of the right-hand side(s)
+inline DisableIf_< UseLapackDecomposition<MT> >
+   getrs_backend( DenseMatrix<MT,columnMajor>& A, T& B, const int* ipiv )
+{
+   nativeGetrs( ~A, B, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the solution of a linear system of equations.
+// \ingroup dense_matrix
+//
+// \param A The column-major system matrix, which is decomposed in-place.
+// \param B The right-hand side vector or the column-major matrix of right-hand sides.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \return void
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function is an auxiliary helper for the solution of a general linear system of equations.
+// It performs an in-place LU decomposition of the given system matrix and overwrites the given
+// right-hand side(s) with the solution.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T > // Type of the right-hand side(s)
+void solve_backend( DenseMatrix<MT,columnMajor>& A, T& B, int* ipiv )
+{
+   const size_t n( (~A).rows() );
+
+   getrf_backend( ~A, ipiv );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( !isDivisor( (~A)(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving the LSE of a singular matrix failed" );
+      }
+   }
+
+   getrs_backend( ~A, B, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the solution of a linear system of equations with a system matrix
+//        with compile time dimensions.
+// \ingroup dense_matrix
+//
+// \param A The column-major system matrix, which is decomposed in-place.
+// \param B The right-hand side vector or the column-major matrix of right-hand sides.
+// \return void
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// The auxiliary array for the pivot indices is placed on the stack.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T > // Type of the right-hand side(s)
+EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   solve_backend( DenseMatrix<MT,columnMajor>& A, T& B )
+{
+   int ipiv[ Rows<MT>::value ];
+
+   solve_backend( ~A, B, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the solution of a linear system of equations with a system matrix
+//        with runtime dimensions.
+// \ingroup dense_matrix
+//
+// \param A The column-major system matrix, which is decomposed in-place.
+// \param B The right-hand side vector or the column-major matrix of right-hand sides.
+// \return void
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// The auxiliary array for the pivot indices is taken from the arena of the calling thread.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T > // Type of the right-hand side(s)
+DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   solve_backend( DenseMatrix<MT,columnMajor>& A, T& B )
+{
+   ArenaArray<int> ipiv( (~A).rows() );
+
+   solve_backend( ~A, B, ipiv.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given general linear system of equations (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the general linear system of equations \f$ A*x=b \f$ by means of an LU
+// decomposition with partial pivoting of a copy of the given system matrix \a A. In contrast
+// to the LAPACK gesv() function the given matrix \a A and the right-hand side \a b are not
+// modified and the system is solved independent of the storage order of \a A:
+
+   \code
+   blaze::StaticMatrix<double,7UL,7UL,blaze::rowMajor> A;
+   blaze::StaticVector<double,7UL,blaze::columnVector> x, b;
+   // ... Initialization
+
+   solve( A, x, b );
+
+   assert( A * x == b );
+   \endcode
+
+// For system matrices with compile time dimensions (as for instance StaticMatrix) both the LU
+// decomposition and the forward and back substitution are performed by completely unrolled
+// kernels. In combination with a StaticMatrix or HybridMatrix the function does not perform
+// any dynamic memory allocation. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the sizes of the system matrix and the right-hand side vector don't match;
+//  - ... the given solution vector is a fixed size vector and the size doesn't match;
+//  - ... the given system matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), this function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error. Matrices with
+// less than blaze::DECOMPOSITION_THRESHOLD elements are always solved by the native kernels.
+// Matrices whose maximum size is below this threshold at compile time (as for instance small
+// StaticMatrix or HybridMatrix instances) do not require LAPACK at all.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, ElementType_<VT1> );
+
+   typedef RemoveAdaptor_< ResultType_<MT> >                   RT;
+   typedef If_< IsRowMajorMatrix<RT>, OppositeType_<RT>, RT >  LT;
+   typedef ResultType_<VT1>                                    ST;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~x, (~b).size(), false );
+
+   LT lu( ~A );
+   ST tmp( ~b );
+
+   solve_backend( lu, tmp );
+
+   (~x) = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given general linear system of equations (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param X The resulting solution matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the general linear system of equations \f$ A*X=B \f$ with multiple
+// right-hand sides by means of an LU decomposition with partial pivoting of a copy of the given
+// system matrix \a A. The system is solved independent of the storage order of the involved
+// matrices:
+
+   \code
+   blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> A;
+   blaze::StaticMatrix<double,6UL,3UL,blaze::rowMajor> X, B;
+   // ... Initialization
+
+   solve( A, X, B );
+
+   assert( A * X == B );
+   \endcode
+
+// For system matrices with compile time dimensions (as for instance StaticMatrix) both the LU
+// decomposition and the forward and back substitution are performed by completely unrolled
+// kernels. In combination with StaticMatrix or HybridMatrix the function does not perform any
+// dynamic memory allocation. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the number of rows of the system matrix and the right-hand sides don't match;
+//  - ... the given solution matrix is a fixed size matrix and the dimensions don't match;
+//  - ... the given system matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), this function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error. Matrices with
+// less than blaze::DECOMPOSITION_THRESHOLD elements are always solved by the native kernels.
+// Matrices whose maximum size is below this threshold at compile time (as for instance small
+// StaticMatrix or HybridMatrix instances) do not require LAPACK at all.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the solution matrix
+        , bool SO2      // Storage order of the solution matrix
+        , typename MT3  // Type of the right-hand side matrix
+        , bool SO3 >    // Storage order of the right-hand side matrix
+void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   typedef RemoveAdaptor_< ResultType_<MT1> >                     RT1;
+   typedef If_< IsRowMajorMatrix<RT1>, OppositeType_<RT1>, RT1 >  LT;
+   typedef RemoveAdaptor_< ResultType_<MT2> >                     RT2;
+   typedef If_< IsRowMajorMatrix<RT2>, OppositeType_<RT2>, RT2 >  ST;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   resize( ~X, (~B).rows(), (~B).columns(), false );
+
+   LT lu( ~A );
+   ST tmp( ~B );
+
+   solve_backend( lu, tmp );
+
+   (~X) = tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
@@ -55,8 +54,19 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/native/getrf.h>
 #include <blaze/math/traits/DerestrictTrait.h>
+#include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/MaxColumns.h>
+#include <blaze/math/typetraits/MaxRows.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/ArenaArray.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
 
 
 namespace blaze {
@@ -77,6 +87,82 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the dense matrix decomposition kernels.
+// \ingroup dense_matrix
+//
+// This auxiliary type trait evaluates whether the decomposition of a matrix of type \a MT can
+// be handled by the LAPACK kernels, which is the case if the LAPACK mode is enabled and the
+// size of the matrix is not limited below the decomposition threshold at compile time. Small
+// matrices with compile time dimensions (as for instance StaticMatrix and HybridMatrix) are
+// always handled by the native kernels, which avoids any reference to LAPACK.
+*/
+template< typename MT >  // Type of the matrix
+struct UseLapackDecomposition
+   : public BoolConstant< BLAZE_LAPACK_MODE &&
+                          ( MaxRows<MT>::value == 0UL ||
+                            MaxColumns<MT>::value == 0UL ||
+                            MaxRows<MT>::value * MaxColumns<MT>::value >=
+                               DECOMPOSITION_THRESHOLD ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the in-place LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition. It selects between
+// the native LU decomposition kernel and the LAPACK kernel depending on the size of the given
+// matrix.
+*/
+template< typename MT  // Type of matrix A
+        , bool SO >    // Storage order of dense matrix A
+inline EnableIf_< UseLapackDecomposition<MT> >
+   getrf_backend( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   if( (~A).rows() * (~A).columns() >= DECOMPOSITION_THRESHOLD ) {
+      getrf( ~A, ipiv );
+      return;
+   }
+
+   nativeGetrf( ~A, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the in-place LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition in case the LAPACK
+// mode is disabled or the size of the given matrix is limited below the decomposition threshold
+// at compile time. It always uses the native LU decomposition kernel.
+*/
+template< typename MT  // Type of matrix A
+        , bool SO >    // Storage order of dense matrix A
+inline DisableIf_< UseLapackDecomposition<MT> >
+   getrf_backend( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   nativeGetrf( ~A, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Auxiliary function for the LU decomposition of the given dense matrix.
@@ -84,6 +170,8 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
 //
 // \param A The matrix to be decomposed.
 // \param P The resulting permutation matrix.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param permut Auxiliary array for the permutation; size >= \a m (column-major) or \a n (row-major).
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix LU decomposition. It performs an
@@ -94,12 +182,8 @@ template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of dense matrix A
         , typename MT2  // Type of matrix P
         , bool SO2 >    // Storage order of matrix P
-void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+void lu_backend( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P, int* ipiv, int* permut )
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
-
    typedef ElementType_<MT2>  ET;
 
    const size_t m( (~A).rows()    );
@@ -107,11 +191,7 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    const size_t mindim( min( m, n ) );
    const size_t size( SO1 ? m : n );
 
-   const std::unique_ptr<int[]> helper( new int[mindim + size] );
-   int* ipiv  ( helper.get() );
-   int* permut( ipiv + mindim );
-
-   getrf( ~A, ipiv );
+   getrf_backend( ~A, ipiv );
 
    for( size_t i=0UL; i<size; ++i ) {
       permut[i] = i;
@@ -134,6 +214,80 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LU decomposition of the given dense matrix with compile time
+//        dimensions.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param P The resulting permutation matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition of matrices with
+// compile time dimensions (as for instance StaticMatrix). The auxiliary arrays for the pivot
+// indices and the permutation are placed on the stack.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of dense matrix A
+        , typename MT2  // Type of matrix P
+        , bool SO2 >    // Storage order of matrix P
+EnableIfTrue_< Rows<MT1>::value != 0UL && Columns<MT1>::value != 0UL >
+   lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+
+   constexpr size_t m( Rows<MT1>::value );
+   constexpr size_t n( Columns<MT1>::value );
+
+   int ipiv  [ m < n ? m : n ];
+   int permut[ SO1 ? m : n ];
+
+   lu_backend( ~A, ~P, ipiv, permut );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LU decomposition of the given dense matrix with runtime
+//        dimensions.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param P The resulting permutation matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition of matrices with
+// runtime dimensions. The auxiliary arrays for the pivot indices and the permutation are taken
+// from the arena of the calling thread.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of dense matrix A
+        , typename MT2  // Type of matrix P
+        , bool SO2 >    // Storage order of matrix P
+DisableIfTrue_< Rows<MT1>::value != 0UL && Columns<MT1>::value != 0UL >
+   lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   ArenaArray<int> helper( mindim + ( SO1 ? m : n ) );
+
+   lu_backend( ~A, ~P, helper.data(), helper.data() + mindim );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LU decomposition of the given dense matrix.
 // \ingroup dense_matrix
@@ -203,8 +357,12 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), this function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error. Matrices with
+// less than blaze::DECOMPOSITION_THRESHOLD elements are always decomposed by the native kernels.
+// Matrices whose maximum size is below this threshold at compile time (as for instance small
+// StaticMatrix or HybridMatrix instances) do not require LAPACK at all.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
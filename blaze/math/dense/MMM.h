@@ -55,527 +55,534 @@
 #include <blaze/math/constraints/UniUpper.h>
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
-#include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
-#include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/DerestrictTrait.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMaskedAccess.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsLower.h>
-#include <blaze/math/typetraits/IsPadded.h>
-#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsUpper.h>
-#include <blaze/math/views/Submatrix.h>
 #include <blaze/system/Blocking.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
-#include <blaze/util/StaticAssert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
-#include <blaze/util/typetraits/IsFloatingPoint.h>
 
 
 namespace blaze {
 
 //=================================================================================================
 //
-//  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
+//  PACKED DENSE MATRIX MULTIPLICATION ENGINE
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
+/*!\brief Blocking parameters of the packed dense matrix multiplication engine.
 // \ingroup dense_matrix
 //
-// \param C The target left-hand side row-major dense matrix.
-// \param A The left-hand side multiplication operand.
-// \param B The right-hand side multiplication operand.
-// \param alpha The scaling factor for \f$ A*B \f$.
-// \param beta The scaling factor for \f$ C \f$.
-// \return void
-//
-// This function implements the compute kernel for a general dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
-// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
-// row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// This auxiliary class template specifies the register and cache blocking of the packed dense
+// matrix multiplication engine for the given element type \a T. The micro kernel computes a
+// block of \a MR rows and \a NR columns of the target matrix in registers. A \a KC x \a NR
+// panel of the right-hand side operand is kept in the L1 cache, a \a MC x \a KC block of the
+// left-hand side operand is kept in the L2 cache, and a \a KC x \a NC block of the right-hand
+// side operand is kept in the last level cache.
 */
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+template< typename T >  // Type of the matrix elements
+struct MMMBlocking
 {
-   using ET1 = ElementType_<MT1>;
-   using ET2 = ElementType_<MT2>;
-   using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
-
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
-
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( JBLOCK >= SIMDSIZE && JBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
+   //**********************************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+   enum : size_t { MR = MMM_MICRO_ROWS };
+   enum : size_t { NV = MMM_MICRO_VECTORS };
+   enum : size_t { NR = NV * SIMDSIZE };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t {
+      KCR = l1CacheSize / ( 2UL * NR * sizeof(T) ),
+      KC  = ( BLAZE_DEBUG_MODE ? 16UL : ( KCR < 16UL ? 16UL : ( KCR > 512UL ? 512UL : KCR ) ) ),
+      MCR = ( l2CacheSize / ( 2UL * KC * sizeof(T) ) ) / MR * MR,
+      MC  = ( BLAZE_DEBUG_MODE ? 2UL*MR : ( MCR < MR ? size_t( MR ) : MCR ) ),
+      NCR = ( cacheSize / ( 2UL * KC * sizeof(T) ) ) / NR * NR,
+      NC  = ( BLAZE_DEBUG_MODE ? 2UL*NR : ( NCR < NR ? size_t( NR ) : NCR ) )
+   };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
 
-   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the left-hand side operand of a dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param buffer The aligned target buffer for the packed panels.
+// \param X The left-hand side multiplication operand.
+// \param ibegin The index of the first row of the block.
+// \param isize The number of rows of the block.
+// \param kbegin The index of the first column of the block.
+// \param ksize The number of columns of the block.
+// \return void
+//
+// This function copies the given block of the left-hand side operand into consecutive panels
+// of \a MR rows. Within each panel the elements are stored column by column, such that the
+// micro kernel can traverse the panel in a single contiguous sweep. Panels at the lower border
+// of the block are padded with zeros. In case \a TF is set to \a true, the block is extracted
+// from the transpose of the given operand.
+*/
+template< bool TF         // Transposition flag
+        , typename T      // Type of the buffer elements
+        , typename MT >   // Type of the left-hand side operand
+void mmmPackLeft( T* buffer, const MT& X, size_t ibegin, size_t isize, size_t kbegin, size_t ksize )
+{
+   constexpr size_t MR( MMMBlocking<T>::MR );
 
-   if( isDefault( beta ) ) {
-      reset( ~C );
-   }
-   else if( !isOne( beta ) ) {
-      (~C) *= beta;
-   }
+   for( size_t ii=0UL; ii<isize; ii+=MR )
+   {
+      const size_t iend( min( MR, isize-ii ) );
 
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
+      for( size_t k=kbegin; k<kbegin+ksize; ++k )
+      {
+         size_t i( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
+         for( ; i<iend; ++i ) {
+            *buffer++ = ( TF )?( X(k,ibegin+ii+i) ):( X(ibegin+ii+i,k) );
+         }
+         for( ; i<MR; ++i ) {
+            *buffer++ = T();
+         }
       }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t iend  ( IsUpper<MT2>::value ? kk+kblock : M );
-      const size_t isize ( iend - ibegin );
 
-      A2 = serial( submatrix<!remainder>( A, ibegin, kk, isize, kblock ) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the right-hand side operand of a dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param buffer The aligned target buffer for the packed panels.
+// \param Y The right-hand side multiplication operand.
+// \param kbegin The index of the first row of the block.
+// \param ksize The number of rows of the block.
+// \param jbegin The index of the first column of the block.
+// \param jsize The number of columns of the block.
+// \return void
+//
+// This function copies the given block of the right-hand side operand into consecutive panels
+// of \a NR columns. Within each panel the elements are stored row by row, such that each row
+// of a panel can be loaded by \a NV aligned SIMD loads. Panels at the right border of the block
+// are padded with zeros. In case \a TF is set to \a true, the block is extracted from the
+// transpose of the given operand.
+*/
+template< bool TF         // Transposition flag
+        , typename T      // Type of the buffer elements
+        , typename MT >   // Type of the right-hand side operand
+void mmmPackRight( T* buffer, const MT& Y, size_t kbegin, size_t ksize, size_t jbegin, size_t jsize )
+{
+   constexpr size_t NR( MMMBlocking<T>::NR );
 
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
+   for( size_t jj=0UL; jj<jsize; jj+=NR )
+   {
+      const size_t jend( min( NR, jsize-jj ) );
 
-      while( jj < N )
+      for( size_t k=kbegin; k<kbegin+ksize; ++k )
       {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
+         size_t j( 0UL );
 
-         if( ( IsLower<MT3>::value && kk+kblock <= jj ) ||
-             ( IsUpper<MT3>::value && jj+jblock <= kk ) ) {
-            jj += jblock;
-            continue;
+         for( ; j<jend; ++j ) {
+            *buffer++ = ( TF )?( Y(jbegin+jj+j,k) ):( Y(k,jbegin+jj+j) );
          }
+         for( ; j<NR; ++j ) {
+            *buffer++ = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-         B2 = serial( submatrix<!remainder>( B, kk, jj, kblock, jblock ) );
 
-         size_t i( 0UL );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the masked border update of the packed
+//        dense matrix multiplication engine.
+// \ingroup dense_matrix
+//
+// This auxiliary type trait evaluates to \a true in case the border blocks of the given target
+// matrix type can be updated via masked SIMD loads and stores.
+*/
+template< typename MT >  // Type of the target matrix
+struct UseMaskedMMMEdges
+   : public BoolConstant< HasMutableDataAccess<MT>::value &&
+                          HasSIMDMaskedAccess< ElementType_<MT> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
 
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               size_t j( 0UL );
 
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a2 * b1;
-                     xmm4  += a2 * b2;
-                     xmm5  += a3 * b1;
-                     xmm6  += a3 * b2;
-                     xmm7  += a4 * b1;
-                     xmm8  += a4 * b2;
-                     xmm9  += a5 * b1;
-                     xmm10 += a5 * b2;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j    ) += sum( xmm9  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j+1UL) += sum( xmm10 ) * alpha;
-               }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type trait for the selection of the micro kernel.
+// \ingroup dense_matrix
+//
+// This auxiliary type trait evaluates to \a true in case the SIMD addition and multiplication
+// is available for the given element type and the micro kernel can compute in SIMD registers.
+*/
+template< typename T >  // Type of the buffer elements
+struct UseVectorizedMMMKernel
+   : public BoolConstant< HasSIMDAdd<T,T>::value && HasSIMDMult<T,T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
 
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                     xmm5 += a5 * b1;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               size_t j( 0UL );
 
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a2 * b1;
-                     xmm4 += a2 * b2;
-                     xmm5 += a3 * b1;
-                     xmm6 += a3 * b2;
-                     xmm7 += a4 * b1;
-                     xmm8 += a4 * b2;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8 ) * alpha;
-               }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked update of a border block of the target matrix by the micro kernel registers.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The row index of the first element of the computed block.
+// \param j The column index of the first element of the computed block.
+// \param m The number of valid rows of the computed block.
+// \param n The number of valid columns of the computed block.
+// \param xmm The SIMD registers of the micro kernel.
+// \param alpha The scaling factor for the computed block.
+// \return void
+//
+// This function adds the scaled \a m x \a n block held in the given registers to the target
+// matrix. The last SIMD vector of each row is updated via masked loads and stores, which
+// avoids any access beyond the valid range of the block.
+*/
+template< typename MT     // Type of the target matrix
+        , typename T      // Type of the SIMD registers
+        , size_t MR       // Number of register rows
+        , size_t NV       // Number of SIMD registers per row
+        , typename ST >   // Type of the scalar value
+BLAZE_ALWAYS_INLINE EnableIf_< UseMaskedMMMEdges<MT> >
+   mmmMaskedUpdate( MT& C, size_t i, size_t j, size_t m, size_t n, const T (&xmm)[MR][NV], ST alpha )
+{
+   using ET = ElementType_<MT>;
 
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
 
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            size_t j( 0UL );
+   const T factor( set( ET( alpha ) ) );
 
-            for( ; (j+4UL) <= jblock; j+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+   for( size_t r=0UL; r<m; ++r )
+   {
+      ET* const c( C.data(i+r) + j );
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-                  const SIMDType b3( B2.load(k,j+2UL) );
-                  const SIMDType b4( B2.load(k,j+3UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a1 * b3;
-                  xmm4 += a1 * b4;
-                  xmm5 += a2 * b1;
-                  xmm6 += a2 * b2;
-                  xmm7 += a2 * b3;
-                  xmm8 += a2 * b4;
-               }
+      for( size_t v=0UL; v<NV && v*SIMDSIZE<n; ++v ) {
+         const size_t cnt( min( SIMDSIZE, n-v*SIMDSIZE ) );
+         maskstoreu( c+v*SIMDSIZE, maskloadu( c+v*SIMDSIZE, cnt ) + factor * xmm[r][v], cnt );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+2UL) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+3UL) += sum( xmm4 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+2UL) += sum( xmm7 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+3UL) += sum( xmm8 ) * alpha;
-            }
 
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the masked border update in case no masked SIMD access is available.
+// \ingroup dense_matrix
+//
+// This function is never called at runtime, but is required for the instantiation of the
+// micro kernel for target matrices without native masked SIMD access.
+*/
+template< typename MT     // Type of the target matrix
+        , typename T      // Type of the SIMD registers
+        , size_t MR       // Number of register rows
+        , size_t NV       // Number of SIMD registers per row
+        , typename ST >   // Type of the scalar value
+BLAZE_ALWAYS_INLINE DisableIf_< UseMaskedMMMEdges<MT> >
+   mmmMaskedUpdate( MT& /*C*/, size_t /*i*/, size_t /*j*/, size_t /*m*/, size_t /*n*/,
+                    const T (&/*xmm*/)[MR][NV], ST /*alpha*/ )
+{
+   BLAZE_INTERNAL_ASSERT( false, "Invalid masked border update detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
 
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro kernel of the packed dense matrix multiplication engine.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The row index of the first element of the computed block.
+// \param j The column index of the first element of the computed block.
+// \param m The number of valid rows of the computed block.
+// \param n The number of valid columns of the computed block.
+// \param a Pointer to the packed \a MR row panel of the left-hand side operand.
+// \param b Pointer to the packed \a NR column panel of the right-hand side operand.
+// \param ksize The depth of the packed panels.
+// \param alpha The scaling factor for the computed block.
+// \return void
+//
+// This function computes the product of an \a MR x \a ksize panel and a \a ksize x \a NR
+// panel in \a MR * \a NV SIMD registers and adds the scaled result to the according block
+// of the target matrix. Blocks that extend beyond the borders of the target matrix are updated
+// by means of masked loads and stores in case these are natively supported (see the
+// HasSIMDMaskedAccess type trait). Blocks that cross the diagonal of a lower (\a LOW) or upper
+// (\a UPP) target matrix and all remaining border blocks are only updated element-wise within
+// the valid range. In case \a TF is set to \a true, the block is added to the transpose of
+// the given target matrix.
+*/
+template< bool TF         // Transposition flag
+        , bool LOW        // Lower flag
+        , bool UPP        // Upper flag
+        , typename MT     // Type of the target matrix
+        , typename T      // Type of the buffer elements
+        , typename ST >   // Type of the scalar value
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedMMMKernel<T> >
+   mmmMicroKernel( MT& C, size_t i, size_t j, size_t m, size_t n,
+                   const T* a, const T* b, size_t ksize, ST alpha )
+{
+   using SIMDType = SIMDTrait_<T>;
 
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
 
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-            }
+   constexpr size_t MR( MMMBlocking<T>::MR );
+   constexpr size_t NV( MMMBlocking<T>::NV );
+   constexpr size_t NR( MMMBlocking<T>::NR );
 
-            if( j<jblock )
-            {
-               SIMDType xmm1, xmm2;
+   constexpr bool UseMaskedEdges( UseMaskedMMMEdges<MT>::value );
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
+   SIMDType xmm[MR][NV];
 
-                  const SIMDType b1( B2.load(k,j) );
+   for( size_t k=0UL; k<ksize; ++k, a+=MR, b+=NR )
+   {
+      SIMDType b1[NV];
 
-                  xmm1 += a1 * b1;
-                  xmm2 += a2 * b1;
-               }
+      for( size_t v=0UL; v<NV; ++v ) {
+         b1[v] = loada( b+v*SIMDSIZE );
+      }
 
-               (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-            }
+      for( size_t r=0UL; r<MR; ++r ) {
+         const SIMDType a1( set( a[r] ) );
+         for( size_t v=0UL; v<NV; ++v ) {
+            xmm[r][v] += a1 * b1[v];
          }
+      }
+   }
 
-         if( i<isize )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2;
+   if( m == MR && n == NR && ( !LOW || i >= j+NR-1UL ) && ( !UPP || i+MR-1UL <= j ) )
+   {
+      const SIMDType factor( set( T( alpha ) ) );
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t v=0UL; v<NV; ++v ) {
+            if( TF )
+               C.storeu( j+v*SIMDSIZE, i+r, C.loadu( j+v*SIMDSIZE, i+r ) + factor * xmm[r][v] );
+            else
+               C.storeu( i+r, j+v*SIMDSIZE, C.loadu( i+r, j+v*SIMDSIZE ) + factor * xmm[r][v] );
+         }
+      }
+   }
+   else if( UseMaskedEdges && ( !LOW || i >= j+n-1UL ) && ( !UPP || i+m-1UL <= j ) )
+   {
+      mmmMaskedUpdate( C, i, j, m, n, xmm, alpha );
+   }
+   else
+   {
+      AlignedArray<T,MR*NR> tmp;
 
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t v=0UL; v<NV; ++v ) {
+            storea( tmp.data()+r*NR+v*SIMDSIZE, xmm[r][v] );
+         }
+      }
 
-               (~C)(ibegin+i,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i,jj+j+1UL) += sum( xmm2 ) * alpha;
-            }
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c ) {
+            if( ( LOW && i+r < j+c ) || ( UPP && i+r > j+c ) ) continue;
+            if( TF )
+               C(j+c,i+r) += tmp[r*NR+c] * alpha;
+            else
+               C(i+r,j+c) += tmp[r*NR+c] * alpha;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-            if( j<jblock )
-            {
-               SIMDType xmm1;
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar micro kernel of the packed dense matrix multiplication engine.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The row index of the first element of the computed block.
+// \param j The column index of the first element of the computed block.
+// \param m The number of valid rows of the computed block.
+// \param n The number of valid columns of the computed block.
+// \param a Pointer to the packed \a MR row panel of the left-hand side operand.
+// \param b Pointer to the packed \a NR column panel of the right-hand side operand.
+// \param ksize The depth of the packed panels.
+// \param alpha The scaling factor for the computed block.
+// \return void
+//
+// This function is selected in case no SIMD addition or multiplication is available for the
+// element type (see the UseVectorizedMMMKernel type trait). It computes the same block as the
+// SIMD micro kernel by means of scalar operations and updates the valid range of the target
+// matrix element-wise.
+*/
+template< bool TF         // Transposition flag
+        , bool LOW        // Lower flag
+        , bool UPP        // Upper flag
+        , typename MT     // Type of the target matrix
+        , typename T      // Type of the buffer elements
+        , typename ST >   // Type of the scalar value
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedMMMKernel<T> >
+   mmmMicroKernel( MT& C, size_t i, size_t j, size_t m, size_t n,
+                   const T* a, const T* b, size_t ksize, ST alpha )
+{
+   constexpr size_t MR( MMMBlocking<T>::MR );
+   constexpr size_t NR( MMMBlocking<T>::NR );
 
-                  xmm1 += a1 * B2.load(k,j);
-               }
+   T tmp[MR][NR] = {};
 
-               (~C)(ibegin+i,jj+j) += sum( xmm1 ) * alpha;
-            }
+   for( size_t k=0UL; k<ksize; ++k, a+=MR, b+=NR ) {
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t c=0UL; c<NR; ++c ) {
+            tmp[r][c] += a[r] * b[c];
          }
-
-         jj += jblock;
       }
+   }
 
-      kk += kblock;
+   for( size_t r=0UL; r<m; ++r ) {
+      for( size_t c=0UL; c<n; ++c ) {
+         if( ( LOW && i+r < j+c ) || ( UPP && i+r > j+c ) ) continue;
+         if( TF )
+            C(j+c,i+r) += tmp[r][c] * alpha;
+         else
+            C(i+r,j+c) += tmp[r][c] * alpha;
+      }
    }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
 
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t isize ( M - ibegin );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*X*Y \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param X The left-hand side multiplication operand.
+// \param Y The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ X*Y \f$.
+// \return void
+//
+// This function implements a packed, cache- and register-blocked compute kernel for the dense
+// matrix multiplication \f$ C+=\alpha*X*Y \f$. The right-hand side operand is packed in blocks
+// of \a KC x \a NC elements and the left-hand side operand in blocks of \a MC x \a KC elements
+// (see the MMMBlocking class template), which are then multiplied by the SIMD micro kernel.
+// The packing buffers are taken from the arena of the calling thread (see the Arena class).
+// Blocks of the operands that are known to be zero due to a lower or upper structure are
+// skipped. In case \a LOW or \a UPP is set to \a true, only the lower or upper part of \a C
+// is updated, respectively. In case \a TF is set to \a true, the kernel computes the
+// transposed product \f$ C^T+=\alpha*X^T*Y^T \f$, which allows to use the same row-wise
+// vectorization for column-major target matrices.
+*/
+template< bool TF         // Transposition flag
+        , bool LOW        // Lower flag
+        , bool UPP        // Upper flag
+        , typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar value
+void packedmmm( MT1& C, const MT2& X, const MT3& Y, ST alpha )
+{
+   using ET = ElementType_<MT1>;
 
-      A2 = serial( submatrix( A, ibegin, kk, isize, ksize ) );
+   constexpr size_t MR( MMMBlocking<ET>::MR );
+   constexpr size_t NR( MMMBlocking<ET>::NR );
+   constexpr size_t KC( MMMBlocking<ET>::KC );
+   constexpr size_t MC( MMMBlocking<ET>::MC );
+   constexpr size_t NC( MMMBlocking<ET>::NC );
 
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
+   constexpr bool XLOW( TF ? IsUpper<MT2>::value : IsLower<MT2>::value );
+   constexpr bool XUPP( TF ? IsLower<MT2>::value : IsUpper<MT2>::value );
+   constexpr bool YLOW( TF ? IsUpper<MT3>::value : IsLower<MT3>::value );
+   constexpr bool YUPP( TF ? IsLower<MT3>::value : IsUpper<MT3>::value );
 
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
+   const size_t M( TF ? X.columns() : X.rows()    );
+   const size_t N( TF ? Y.rows()    : Y.columns() );
+   const size_t K( TF ? X.rows()    : X.columns() );
 
-         if( IsUpper<MT3>::value && jj+jblock <= kk ) {
-            jj += jblock;
-            continue;
-         }
+   BLAZE_INTERNAL_ASSERT( ( TF ? Y.columns() : Y.rows() ) == K, "Invalid matrix sizes detected" );
 
-         B2 = serial( submatrix( B, kk, jj, ksize, jblock ) );
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
 
-         size_t i( 0UL );
+   const size_t kcmax( min( KC, K ) );
+   const size_t mcmax( min( MC, ( ( M + MR - 1UL ) / MR ) * MR ) );
+   const size_t ncmax( min( NC, ( ( N + NR - 1UL ) / NR ) * NR ) );
 
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j    ) += A2(i+4UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j+1UL) += A2(i+4UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
+   ArenaArray<ET> a( mcmax*kcmax );
+   ArenaArray<ET> b( kcmax*ncmax );
 
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j) += A2(i+4UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
+   for( size_t jj=0UL; jj<N; jj+=NC )
+   {
+      const size_t jblock( min( NC, N-jj ) );
 
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
+      for( size_t kk=0UL; kk<K; kk+=KC )
+      {
+         const size_t kblock( min( KC, K-kk ) );
 
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
+         if( ( YLOW && kk+kblock <= jj ) || ( YUPP && jj+jblock <= kk ) )
+            continue;
 
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-         }
+         mmmPackRight<TF>( b.data(), Y, kk, kblock, jj, jblock );
 
-         if( i<isize )
+         for( size_t ii=0UL; ii<M; ii+=MC )
          {
-            size_t j( 0UL );
+            const size_t iblock( min( MC, M-ii ) );
 
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i,jj+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i,jj+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
+            if( ( LOW  && ii+iblock <= jj ) || ( UPP  && jj+jblock <= ii ) ||
+                ( XLOW && ii+iblock <= kk ) || ( XUPP && kk+kblock <= ii ) )
+               continue;
+
+            mmmPackLeft<TF>( a.data(), X, ii, iblock, kk, kblock );
+
+            for( size_t j=0UL; j<jblock; j+=NR )
+            {
+               const size_t jsize( min( NR, jblock-j ) );
+
+               for( size_t i=0UL; i<iblock; i+=MR )
+               {
+                  if( ( LOW && ii+i+MR <= jj+j ) || ( UPP && jj+j+NR <= ii+i ) )
+                     continue;
 
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i,jj+j) += A2(i,k) * B2(k,j) * alpha;
+                  mmmMicroKernel<TF,LOW,UPP>( C, ii+i, jj+j, min( MR, iblock-i ), jsize,
+                                              a.data()+i*kblock, b.data()+j*kblock, kblock, alpha );
                }
             }
          }
-
-         jj += jblock;
       }
    }
 }
@@ -583,13 +590,21 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 //*************************************************************************************************
 
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
-// \ingroup dense_matrix
-//
-// \param C The target left-hand side column-major dense matrix.
+
+
+//=================================================================================================
+//
+//  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
 // \param A The left-hand side multiplication operand.
 // \param B The right-hand side multiplication operand.
 // \param alpha The scaling factor for \f$ A*B \f$.
@@ -599,21 +614,20 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 // This function implements the compute kernel for a general dense matrix/dense matrix
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
-// column-major dense matrix type. The element types of all three matrices must be SIMD
+// row-major dense matrix type. The element types of all three matrices must be SIMD
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_<MT1>;
    using ET2 = ElementType_<MT2>;
    using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
 
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE        ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
@@ -624,25 +638,8 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( IBLOCK >= SIMDSIZE && IBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
-
    if( isDefault( beta ) ) {
       reset( ~C );
    }
@@ -650,418 +647,62 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
       (~C) *= beta;
    }
 
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jend  ( IsLower<MT3>::value ? kk+kblock : N );
-      const size_t jsize ( jend - jbegin );
-
-      B2 = serial( submatrix<!remainder>( B, kk, jbegin, kblock, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( ( IsLower<MT2>::value && ii+iblock <= kk ) ||
-             ( IsUpper<MT2>::value && kk+kblock <= ii ) ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix<!remainder>( A, ii, kk, iblock, kblock ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET3>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-                     const SIMDType b5( B2.load(k,j+4UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a1 * b3;
-                     xmm4  += a1 * b4;
-                     xmm5  += a1 * b5;
-                     xmm6  += a2 * b1;
-                     xmm7  += a2 * b2;
-                     xmm8  += a2 * b3;
-                     xmm9  += a2 * b4;
-                     xmm10 += a2 * b5;
-                  }
-
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+4UL) += sum( xmm5  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm6  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm7  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm8  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm9  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+4UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                     xmm5 += a1 * B2.load(k,j+4UL);
-                  }
-
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i,jbegin+j+4UL) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a1 * b3;
-                     xmm4 += a1 * b4;
-                     xmm5 += a2 * b1;
-                     xmm6 += a2 * b2;
-                     xmm7 += a2 * b3;
-                     xmm8 += a2 * b4;
-                  }
-
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm7 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                  }
-
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+4UL) <= iblock; i+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-                  const SIMDType a3( A2.load(i+2UL,k) );
-                  const SIMDType a4( A2.load(i+3UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-                  xmm7 += a4 * b1;
-                  xmm8 += a4 * b2;
-               }
-
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j    ) += sum( xmm7 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j+1UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( i<iblock )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( j<jsize )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2;
+   packedmmm<false,false,false>( ~C, A, B, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType b1( B2.load(k,j) );
 
-                  xmm1 += A2.load(i    ,k) * b1;
-                  xmm2 += A2.load(i+1UL,k) * b1;
-               }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
+// column-major dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_<MT1>;
+   using ET2 = ElementType_<MT2>;
+   using ET3 = ElementType_<MT3>;
 
-               (~C)(ii+i    ,jbegin+j) += sum( xmm1 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j) += sum( xmm2 ) * alpha;
-            }
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE        ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE    ( MT1 );
 
-            if( i<iblock )
-            {
-               SIMDType xmm1;
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
 
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  xmm1 += A2.load(i,k) * B2.load(k,j);
-               }
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
 
-               (~C)(ii+i,jbegin+j) += sum( xmm1 ) * alpha;
-            }
-         }
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-         ii += iblock;
-      }
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-      kk += kblock;
+   if( isDefault( beta ) ) {
+      reset( ~C );
    }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jsize ( N - jbegin );
-
-      B2 = serial( submatrix( B, kk, jbegin, ksize, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( IsLower<MT2>::value && ii+iblock <= kk ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix( A, ii, kk, iblock, ksize ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+4UL) += A2(i    ,k) * B2(k,j+4UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+4UL) += A2(i+1UL,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i,jbegin+j+4UL) += A2(i,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-         }
-
-         if( j<jsize )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i    ,jbegin+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i,jbegin+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         ii += iblock;
-      }
+   else if( !isOne( beta ) ) {
+      (~C) *= beta;
    }
+
+   packedmmm<true,false,false>( ~C, B, A, alpha );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1132,7 +773,6 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    using ET1 = ElementType_<MT1>;
    using ET2 = ElementType_<MT2>;
    using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE         ( MT1 );
@@ -1152,25 +792,8 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( JBLOCK >= SIMDSIZE && JBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
-
    DerestrictTrait_<MT1> c( derestrict( ~C ) );
 
    if( isDefault( beta ) ) {
@@ -1180,454 +803,169 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
       c *= beta;
    }
 
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
+   packedmmm<false,true,false>( c, A, B, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
 
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t iend  ( IsUpper<MT2>::value ? kk+kblock : M );
-      const size_t isize ( iend - ibegin );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a lower dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a lower dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
+// column-major dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_<MT1>;
+   using ET2 = ElementType_<MT2>;
+   using ET3 = ElementType_<MT3>;
 
-      A2 = serial( submatrix<!remainder>( A, ibegin, kk, isize, kblock ) );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE      ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNILOWER_MATRIX_TYPE      ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_LOWER_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UPPER_MATRIX_TYPE         ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE          ( MT1 );
 
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
 
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
 
-         if( ( IsLower<MT3>::value && kk+kblock <= jj ) ||
-             ( IsUpper<MT3>::value && jj+jblock <= kk ) ) {
-            jj += jblock;
-            continue;
-         }
-
-         B2 = serial( submatrix<!remainder>( B, kk, jj, kblock, jblock ) );
-
-         size_t i( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               if( jj > ibegin+i+4UL ) continue;
-
-               const size_t jend( min( ibegin+i-jj+5UL, jblock ) );
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jend; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a2 * b1;
-                     xmm4  += a2 * b2;
-                     xmm5  += a3 * b1;
-                     xmm6  += a3 * b2;
-                     xmm7  += a4 * b1;
-                     xmm8  += a4 * b2;
-                     xmm9  += a5 * b1;
-                     xmm10 += a5 * b2;
-                  }
-
-                  c(ibegin+i    ,jj+j    ) += sum( xmm1  ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += sum( xmm2  ) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += sum( xmm3  ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4  ) * alpha;
-                  c(ibegin+i+2UL,jj+j    ) += sum( xmm5  ) * alpha;
-                  c(ibegin+i+2UL,jj+j+1UL) += sum( xmm6  ) * alpha;
-                  c(ibegin+i+3UL,jj+j    ) += sum( xmm7  ) * alpha;
-                  c(ibegin+i+3UL,jj+j+1UL) += sum( xmm8  ) * alpha;
-                  c(ibegin+i+4UL,jj+j    ) += sum( xmm9  ) * alpha;
-                  c(ibegin+i+4UL,jj+j+1UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( j<jend )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                     xmm5 += a5 * b1;
-                  }
-
-                  c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-                  c(ibegin+i+4UL,jj+j) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               if( jj > ibegin+i+3UL ) continue;
-
-               const size_t jend( min( ibegin+i-jj+4UL, jblock ) );
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jend; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a2 * b1;
-                     xmm4 += a2 * b2;
-                     xmm5 += a3 * b1;
-                     xmm6 += a3 * b2;
-                     xmm7 += a4 * b1;
-                     xmm8 += a4 * b2;
-                  }
-
-                  c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-                  c(ibegin+i+2UL,jj+j    ) += sum( xmm5 ) * alpha;
-                  c(ibegin+i+2UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-                  c(ibegin+i+3UL,jj+j    ) += sum( xmm7 ) * alpha;
-                  c(ibegin+i+3UL,jj+j+1UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( j<jend )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                  }
-
-                  c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            if( jj > ibegin+i+1UL ) continue;
-
-            const size_t jend( min( ibegin+i-jj+2UL, jblock ) );
-            size_t j( 0UL );
-
-            for( ; (j+4UL) <= jend; j+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-                  const SIMDType b3( B2.load(k,j+2UL) );
-                  const SIMDType b4( B2.load(k,j+3UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a1 * b3;
-                  xmm4 += a1 * b4;
-                  xmm5 += a2 * b1;
-                  xmm6 += a2 * b2;
-                  xmm7 += a2 * b3;
-                  xmm8 += a2 * b4;
-               }
-
-               c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               c(ibegin+i    ,jj+j+2UL) += sum( xmm3 ) * alpha;
-               c(ibegin+i    ,jj+j+3UL) += sum( xmm4 ) * alpha;
-               c(ibegin+i+1UL,jj+j    ) += sum( xmm5 ) * alpha;
-               c(ibegin+i+1UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-               c(ibegin+i+1UL,jj+j+2UL) += sum( xmm7 ) * alpha;
-               c(ibegin+i+1UL,jj+j+3UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (j+2UL) <= jend; j+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               c(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-               c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( j<jend )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a2 * b1;
-               }
-
-               c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-               c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( i<isize && jj <= ibegin+i )
-         {
-            const size_t jend( min( ibegin+i-jj+2UL, jblock ) );
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jend; j+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               c(ibegin+i,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i,jj+j+1UL) += sum( xmm2 ) * alpha;
-            }
-
-            if( j<jend )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j);
-               }
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-               c(ibegin+i,jj+j) += sum( xmm1 ) * alpha;
-            }
-         }
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-         jj += jblock;
-      }
+   DerestrictTrait_<MT1> c( derestrict( ~C ) );
 
-      kk += kblock;
+   if( isDefault( beta ) ) {
+      reset( c );
+   }
+   else if( !isOne( beta ) ) {
+      c *= beta;
    }
 
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t isize ( M - ibegin );
-
-      A2 = serial( submatrix( A, ibegin, kk, isize, ksize ) );
+   packedmmm<true,false,true>( c, B, A, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
 
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a lower dense matrix/dense matrix multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return void
+//
+// This function implements the compute kernel for a lower dense matrix/dense matrix
+// multiplication of the form \f$ C=A*B \f$. Both \a A and \a B must be non-expression
+// dense matrix types, \a C must be a non-expression, non-adaptor, row-major dense matrix
+// type. The element types of all three matrices must be SIMD combinable, i.e. must
+// provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3 >
+inline void lmmm( MT1& C, const MT2& A, const MT3& B )
+{
+   using ET1 = ElementType_<MT1>;
+   using ET2 = ElementType_<MT2>;
+   using ET3 = ElementType_<MT3>;
 
-         if( IsUpper<MT3>::value && jj+jblock <= kk ) {
-            jj += jblock;
-            continue;
-         }
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-         B2 = serial( submatrix( B, kk, jj, ksize, jblock ) );
+   lmmm( C, A, B, ET1(1), ET1(0) );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-         size_t i( 0UL );
 
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               if( jj > ibegin+i+4UL ) continue;
-
-               const size_t jend( min( ibegin+i-jj+5UL, jblock ) );
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jend; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+4UL,jj+j    ) += A2(i+4UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+4UL,jj+j+1UL) += A2(i+4UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
 
-               if( j<jend ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+4UL,jj+j) += A2(i+4UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               if( jj > ibegin+i+3UL ) continue;
-
-               const size_t jend( min( ibegin+i-jj+4UL, jblock ) );
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jend; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
 
-               if( j<jend ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
+//=================================================================================================
+//
+//  UPPER DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
 
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            if( jj > ibegin+i+1UL ) continue;
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a upper dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a upper dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
+// row-major dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_<MT1>;
+   using ET2 = ElementType_<MT2>;
+   using ET3 = ElementType_<MT3>;
 
-            const size_t jend( min( ibegin+i-jj+2UL, jblock ) );
-            size_t j( 0UL );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE         ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE         ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIUPPER_MATRIX_TYPE      ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_UPPER_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE          ( MT1 );
 
-            for( ; (j+2UL) <= jend; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
 
-            if( j<jend ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-         }
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
 
-         if( i<isize && jj <= ibegin+i )
-         {
-            const size_t jend( min( ibegin+i-jj+2UL, jblock ) );
-            size_t j( 0UL );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-            for( ; (j+2UL) <= jend; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i,jj+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i,jj+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-            if( j<jend ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i,jj+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
+   DerestrictTrait_<MT1> c( derestrict( ~C ) );
 
-         jj += jblock;
-      }
+   if( isDefault( beta ) ) {
+      reset( c );
+   }
+   else if( !isOne( beta ) ) {
+      c *= beta;
    }
+
+   packedmmm<false,false,true>( c, A, B, alpha );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1635,7 +973,7 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a lower dense matrix/dense matrix multiplication
+/*!\brief Compute kernel for a upper dense matrix/dense matrix multiplication
 //        (\f$ C=\alpha*A*B+\beta*C \f$).
 // \ingroup dense_matrix
 //
@@ -1646,27 +984,26 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 // \param beta The scaling factor for \f$ C \f$.
 // \return void
 //
-// This function implements the compute kernel for a lower dense matrix/dense matrix
+// This function implements the compute kernel for a upper dense matrix/dense matrix
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // column-major dense matrix type. The element types of all three matrices must be SIMD
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
 {
    using ET1 = ElementType_<MT1>;
    using ET2 = ElementType_<MT2>;
    using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE      ( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE     ( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_UNILOWER_MATRIX_TYPE      ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_LOWER_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_UPPER_MATRIX_TYPE         ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE         ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIUPPER_MATRIX_TYPE      ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_UPPER_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE          ( MT1 );
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
@@ -1678,25 +1015,8 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( IBLOCK >= SIMDSIZE && IBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
-
    DerestrictTrait_<MT1> c( derestrict( ~C ) );
 
    if( isDefault( beta ) ) {
@@ -1706,1500 +1026,7 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
       c *= beta;
    }
 
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jend  ( IsLower<MT3>::value ? kk+kblock : N );
-      const size_t jsize ( jend - jbegin );
-
-      B2 = serial( submatrix<!remainder>( B, kk, jbegin, kblock, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( ( IsLower<MT2>::value && ii+iblock <= kk ) ||
-             ( IsUpper<MT2>::value && kk+kblock <= ii ) ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix<!remainder>( A, ii, kk, iblock, kblock ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET3>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               if( ii+iblock < jbegin ) continue;
-
-               size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-                     const SIMDType b5( B2.load(k,j+4UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a1 * b3;
-                     xmm4  += a1 * b4;
-                     xmm5  += a1 * b5;
-                     xmm6  += a2 * b1;
-                     xmm7  += a2 * b2;
-                     xmm8  += a2 * b3;
-                     xmm9  += a2 * b4;
-                     xmm10 += a2 * b5;
-                  }
-
-                  c(ii+i    ,jbegin+j    ) += sum( xmm1  ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += sum( xmm2  ) * alpha;
-                  c(ii+i    ,jbegin+j+2UL) += sum( xmm3  ) * alpha;
-                  c(ii+i    ,jbegin+j+3UL) += sum( xmm4  ) * alpha;
-                  c(ii+i    ,jbegin+j+4UL) += sum( xmm5  ) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += sum( xmm6  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += sum( xmm7  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+2UL) += sum( xmm8  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+3UL) += sum( xmm9  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+4UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                     xmm5 += a1 * B2.load(k,j+4UL);
-                  }
-
-                  c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  c(ii+i,jbegin+j+4UL) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               if( ii+iblock < jbegin ) continue;
-
-               size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a1 * b3;
-                     xmm4 += a1 * b4;
-                     xmm5 += a2 * b1;
-                     xmm6 += a2 * b2;
-                     xmm7 += a2 * b3;
-                     xmm8 += a2 * b4;
-                  }
-
-                  c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i    ,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i    ,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+2UL) += sum( xmm7 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+3UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                  }
-
-                  c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            if( ii+iblock < jbegin ) continue;
-
-            size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-            for( ; (i+4UL) <= iblock; i+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-                  const SIMDType a3( A2.load(i+2UL,k) );
-                  const SIMDType a4( A2.load(i+3UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-                  xmm7 += a4 * b1;
-                  xmm8 += a4 * b2;
-               }
-
-               c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               c(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               c(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-               c(ii+i+2UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-               c(ii+i+2UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-               c(ii+i+3UL,jbegin+j    ) += sum( xmm7 ) * alpha;
-               c(ii+i+3UL,jbegin+j+1UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               c(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               c(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( i<iblock )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( j<jsize && ii+iblock >= jbegin )
-         {
-            size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += A2.load(i    ,k) * b1;
-                  xmm2 += A2.load(i+1UL,k) * b1;
-               }
-
-               c(ii+i    ,jbegin+j) += sum( xmm1 ) * alpha;
-               c(ii+i+1UL,jbegin+j) += sum( xmm2 ) * alpha;
-            }
-
-            if( i<iblock )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  xmm1 += A2.load(i,k) * B2.load(k,j);
-               }
-
-               c(ii+i,jbegin+j) += sum( xmm1 ) * alpha;
-            }
-         }
-
-         ii += iblock;
-      }
-
-      kk += kblock;
-   }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jsize ( N - jbegin );
-
-      B2 = serial( submatrix( B, kk, jbegin, ksize, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( IsLower<MT2>::value && ii+iblock <= kk ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix( A, ii, kk, iblock, ksize ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               if( ii+iblock < jbegin ) continue;
-
-               size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i    ,jbegin+j+4UL) += A2(i    ,k) * B2(k,j+4UL) * alpha;
-                     c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+4UL) += A2(i+1UL,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i,jbegin+j+4UL) += A2(i,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               if( ii+iblock < jbegin ) continue;
-
-               size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            if( ii+iblock < jbegin ) continue;
-
-            size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-         }
-
-         if( j<jsize )
-         {
-            if( ii+iblock < jbegin ) continue;
-
-            size_t i( ( ii > jbegin+j )?( 0UL ):( jbegin+j-ii ) );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i    ,jbegin+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  c(ii+i+1UL,jbegin+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i,jbegin+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         ii += iblock;
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a lower dense matrix/dense matrix multiplication (\f$ C=A*B \f$).
-// \ingroup dense_matrix
-//
-// \param C The target left-hand side column-major dense matrix.
-// \param A The left-hand side multiplication operand.
-// \param B The right-hand side multiplication operand.
-// \return void
-//
-// This function implements the compute kernel for a lower dense matrix/dense matrix
-// multiplication of the form \f$ C=A*B \f$. Both \a A and \a B must be non-expression
-// dense matrix types, \a C must be a non-expression, non-adaptor, row-major dense matrix
-// type. The element types of all three matrices must be SIMD combinable, i.e. must
-// provide a common SIMD interface.
-*/
-template< typename MT1, typename MT2, typename MT3 >
-inline void lmmm( MT1& C, const MT2& A, const MT3& B )
-{
-   using ET1 = ElementType_<MT1>;
-   using ET2 = ElementType_<MT2>;
-   using ET3 = ElementType_<MT3>;
-
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
-
-   lmmm( C, A, B, ET1(1), ET1(0) );
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  UPPER DENSE MATRIX MULTIPLICATION KERNELS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a upper dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
-// \ingroup dense_matrix
-//
-// \param C The target left-hand side row-major dense matrix.
-// \param A The left-hand side multiplication operand.
-// \param B The right-hand side multiplication operand.
-// \param alpha The scaling factor for \f$ A*B \f$.
-// \param beta The scaling factor for \f$ C \f$.
-// \return void
-//
-// This function implements the compute kernel for a upper dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
-// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
-// row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
-*/
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
-{
-   using ET1 = ElementType_<MT1>;
-   using ET2 = ElementType_<MT2>;
-   using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE         ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE         ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIUPPER_MATRIX_TYPE      ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_UPPER_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE          ( MT1 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
-
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
-
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( JBLOCK >= SIMDSIZE && JBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
-   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
-
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
-
-   DerestrictTrait_<MT1> c( derestrict( ~C ) );
-
-   if( isDefault( beta ) ) {
-      reset( c );
-   }
-   else if( !isOne( beta ) ) {
-      c *= beta;
-   }
-
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t iend  ( IsUpper<MT2>::value ? kk+kblock : M );
-      const size_t isize ( iend - ibegin );
-
-      A2 = serial( submatrix<!remainder>( A, ibegin, kk, isize, kblock ) );
-
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
-
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
-
-         if( ( IsLower<MT3>::value && kk+kblock <= jj ) ||
-             ( IsUpper<MT3>::value && jj+jblock <= kk ) ) {
-            jj += jblock;
-            continue;
-         }
-
-         B2 = serial( submatrix<!remainder>( B, kk, jj, kblock, jblock ) );
-
-         size_t i( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               if( jj+jblock < ibegin ) continue;
-
-               size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a2 * b1;
-                     xmm4  += a2 * b2;
-                     xmm5  += a3 * b1;
-                     xmm6  += a3 * b2;
-                     xmm7  += a4 * b1;
-                     xmm8  += a4 * b2;
-                     xmm9  += a5 * b1;
-                     xmm10 += a5 * b2;
-                  }
-
-                  c(ibegin+i    ,jj+j    ) += sum( xmm1  ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += sum( xmm2  ) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += sum( xmm3  ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4  ) * alpha;
-                  c(ibegin+i+2UL,jj+j    ) += sum( xmm5  ) * alpha;
-                  c(ibegin+i+2UL,jj+j+1UL) += sum( xmm6  ) * alpha;
-                  c(ibegin+i+3UL,jj+j    ) += sum( xmm7  ) * alpha;
-                  c(ibegin+i+3UL,jj+j+1UL) += sum( xmm8  ) * alpha;
-                  c(ibegin+i+4UL,jj+j    ) += sum( xmm9  ) * alpha;
-                  c(ibegin+i+4UL,jj+j+1UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                     xmm5 += a5 * b1;
-                  }
-
-                  c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-                  c(ibegin+i+4UL,jj+j) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               if( jj+jblock < ibegin ) continue;
-
-               size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a2 * b1;
-                     xmm4 += a2 * b2;
-                     xmm5 += a3 * b1;
-                     xmm6 += a3 * b2;
-                     xmm7 += a4 * b1;
-                     xmm8 += a4 * b2;
-                  }
-
-                  c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-                  c(ibegin+i+2UL,jj+j    ) += sum( xmm5 ) * alpha;
-                  c(ibegin+i+2UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-                  c(ibegin+i+3UL,jj+j    ) += sum( xmm7 ) * alpha;
-                  c(ibegin+i+3UL,jj+j+1UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                  }
-
-                  c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  c(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  c(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            if( jj+jblock < ibegin ) continue;
-
-            size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-            for( ; (j+4UL) <= jblock; j+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-                  const SIMDType b3( B2.load(k,j+2UL) );
-                  const SIMDType b4( B2.load(k,j+3UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a1 * b3;
-                  xmm4 += a1 * b4;
-                  xmm5 += a2 * b1;
-                  xmm6 += a2 * b2;
-                  xmm7 += a2 * b3;
-                  xmm8 += a2 * b4;
-               }
-
-               c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               c(ibegin+i    ,jj+j+2UL) += sum( xmm3 ) * alpha;
-               c(ibegin+i    ,jj+j+3UL) += sum( xmm4 ) * alpha;
-               c(ibegin+i+1UL,jj+j    ) += sum( xmm5 ) * alpha;
-               c(ibegin+i+1UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-               c(ibegin+i+1UL,jj+j+2UL) += sum( xmm7 ) * alpha;
-               c(ibegin+i+1UL,jj+j+3UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               c(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               c(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-               c(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( j<jblock )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a2 * b1;
-               }
-
-               c(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-               c(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( i<isize && jj+jblock >= ibegin )
-         {
-            size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               c(ibegin+i,jj+j    ) += sum( xmm1 ) * alpha;
-               c(ibegin+i,jj+j+1UL) += sum( xmm2 ) * alpha;
-            }
-
-            if( j<jblock )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j);
-               }
-
-               c(ibegin+i,jj+j) += sum( xmm1 ) * alpha;
-            }
-         }
-
-         jj += jblock;
-      }
-
-      kk += kblock;
-   }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t ibegin( IsLower<MT2>::value ? kk : 0UL );
-      const size_t isize ( M - ibegin );
-
-      A2 = serial( submatrix( A, ibegin, kk, isize, ksize ) );
-
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
-
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
-
-         if( IsUpper<MT3>::value && jj+jblock <= kk ) {
-            jj += jblock;
-            continue;
-         }
-
-         B2 = serial( submatrix( B, kk, jj, ksize, jblock ) );
-
-         size_t i( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               if( jj+jblock < ibegin ) continue;
-
-               size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+4UL,jj+j    ) += A2(i+4UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+4UL,jj+j+1UL) += A2(i+4UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
-
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+4UL,jj+j) += A2(i+4UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               if( jj+jblock < ibegin ) continue;
-
-               size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     c(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     c(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
-
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     c(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            if( jj+jblock < ibegin ) continue;
-
-            size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  c(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  c(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         if( i<isize && jj+jblock >= ibegin )
-         {
-            size_t j( ( jj > ibegin+i )?( 0UL ):( ibegin+i-jj ) );
-
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i,jj+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  c(ibegin+i,jj+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ibegin+i,jj+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         jj += jblock;
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a upper dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
-// \ingroup dense_matrix
-//
-// \param C The target left-hand side column-major dense matrix.
-// \param A The left-hand side multiplication operand.
-// \param B The right-hand side multiplication operand.
-// \param alpha The scaling factor for \f$ A*B \f$.
-// \param beta The scaling factor for \f$ C \f$.
-// \return void
-//
-// This function implements the compute kernel for a upper dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
-// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
-// column-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
-*/
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
-{
-   using ET1 = ElementType_<MT1>;
-   using ET2 = ElementType_<MT2>;
-   using ET3 = ElementType_<MT3>;
-   using SIMDType = SIMDTrait_<ET1>;
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE             ( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE      ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE     ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE         ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIUPPER_MATRIX_TYPE      ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_UPPER_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE          ( MT1 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
-
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
-
-   enum : size_t { SIMDSIZE = SIMDTrait<ET1>::size };
-
-   constexpr bool remainder( !IsPadded<MT2>::value || !IsPadded<MT3>::value );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( IBLOCK >= SIMDSIZE && IBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
-   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
-
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
-
-   DerestrictTrait_<MT1> c( derestrict( ~C ) );
-
-   if( isDefault( beta ) ) {
-      reset( c );
-   }
-   else if( !isOne( beta ) ) {
-      c *= beta;
-   }
-
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jend  ( IsLower<MT3>::value ? kk+kblock : N );
-      const size_t jsize ( jend - jbegin );
-
-      B2 = serial( submatrix<!remainder>( B, kk, jbegin, kblock, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( ( IsLower<MT2>::value && ii+iblock <= kk ) ||
-             ( IsUpper<MT2>::value && kk+kblock <= ii ) ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix<!remainder>( A, ii, kk, iblock, kblock ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET3>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               if( ii > jbegin+j+4UL ) continue;
-
-               const size_t iend( min( iblock, jbegin+j-ii+5UL ) );
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iend; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-                     const SIMDType b5( B2.load(k,j+4UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a1 * b3;
-                     xmm4  += a1 * b4;
-                     xmm5  += a1 * b5;
-                     xmm6  += a2 * b1;
-                     xmm7  += a2 * b2;
-                     xmm8  += a2 * b3;
-                     xmm9  += a2 * b4;
-                     xmm10 += a2 * b5;
-                  }
-
-                  c(ii+i    ,jbegin+j    ) += sum( xmm1  ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += sum( xmm2  ) * alpha;
-                  c(ii+i    ,jbegin+j+2UL) += sum( xmm3  ) * alpha;
-                  c(ii+i    ,jbegin+j+3UL) += sum( xmm4  ) * alpha;
-                  c(ii+i    ,jbegin+j+4UL) += sum( xmm5  ) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += sum( xmm6  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += sum( xmm7  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+2UL) += sum( xmm8  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+3UL) += sum( xmm9  ) * alpha;
-                  c(ii+i+1UL,jbegin+j+4UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( i<iend )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                     xmm5 += a1 * B2.load(k,j+4UL);
-                  }
-
-                  c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  c(ii+i,jbegin+j+4UL) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               if( ii > jbegin+j+3UL ) continue;
-
-               const size_t iend( min( iblock, jbegin+j-ii+4UL ) );
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iend; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a1 * b3;
-                     xmm4 += a1 * b4;
-                     xmm5 += a2 * b1;
-                     xmm6 += a2 * b2;
-                     xmm7 += a2 * b3;
-                     xmm8 += a2 * b4;
-                  }
-
-                  c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i    ,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i    ,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+2UL) += sum( xmm7 ) * alpha;
-                  c(ii+i+1UL,jbegin+j+3UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( i<iend )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                  }
-
-                  c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  c(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  c(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            if( ii > jbegin+j+1UL ) continue;
-
-            const size_t iend( min( iblock, jbegin+j-ii+2UL ) );
-            size_t i( 0UL );
-
-            for( ; (i+4UL) <= iend; i+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-                  const SIMDType a3( A2.load(i+2UL,k) );
-                  const SIMDType a4( A2.load(i+3UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-                  xmm7 += a4 * b1;
-                  xmm8 += a4 * b2;
-               }
-
-               c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               c(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               c(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-               c(ii+i+2UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-               c(ii+i+2UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-               c(ii+i+3UL,jbegin+j    ) += sum( xmm7 ) * alpha;
-               c(ii+i+3UL,jbegin+j+1UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (i+2UL) <= iend; i+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               c(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               c(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               c(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( i<iend )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               c(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-               c(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( j<jsize && ii <= jbegin+j )
-         {
-            const size_t iend( min( iblock, jbegin+j-ii+2UL ) );
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iend; i+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += A2.load(i    ,k) * b1;
-                  xmm2 += A2.load(i+1UL,k) * b1;
-               }
-
-               c(ii+i    ,jbegin+j) += sum( xmm1 ) * alpha;
-               c(ii+i+1UL,jbegin+j) += sum( xmm2 ) * alpha;
-            }
-
-            if( i<iend )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  xmm1 += A2.load(i,k) * B2.load(k,j);
-               }
-
-               c(ii+i,jbegin+j) += sum( xmm1 ) * alpha;
-            }
-         }
-
-         ii += iblock;
-      }
-
-      kk += kblock;
-   }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t jbegin( IsUpper<MT3>::value ? kk : 0UL );
-      const size_t jsize ( N - jbegin );
-
-      B2 = serial( submatrix( B, kk, jbegin, ksize, jsize ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( IsLower<MT2>::value && ii+iblock <= kk ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix( A, ii, kk, iblock, ksize ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint<ET1>::value )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               if( ii > jbegin+j+4UL ) continue;
-
-               const size_t iend( min( iblock, jbegin+j-ii+5UL ) );
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iend; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i    ,jbegin+j+4UL) += A2(i    ,k) * B2(k,j+4UL) * alpha;
-                     c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+4UL) += A2(i+1UL,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-
-               if( i<iend ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i,jbegin+j+4UL) += A2(i,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               if( ii > jbegin+j+3UL ) continue;
-
-               const size_t iend( min( iblock, jbegin+j-ii+4UL ) );
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iend; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-
-               if( i<iend ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     c(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     c(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            if( ii > jbegin+j+1UL ) continue;
-
-            const size_t iend( min( iblock, jbegin+j-ii+2UL ) );
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iend; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  c(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  c(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  c(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( i<iend ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  c(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-         }
-
-         if( j<jsize && ii <= jbegin+j )
-         {
-            const size_t iend( min( iblock, jbegin+j-ii+2UL ) );
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iend; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i    ,jbegin+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  c(ii+i+1UL,jbegin+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-
-            if( i<iend ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  c(ii+i,jbegin+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         ii += iblock;
-      }
-   }
+   packedmmm<true,true,false>( c, B, A, alpha );
 }
 /*! \endcond */
 //*************************************************************************************************
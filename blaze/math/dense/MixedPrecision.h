@@ -0,0 +1,548 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MixedPrecision.h
+//  \brief Header file for the mixed-precision dense matrix/vector kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+#define _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MIXED-PRECISION MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the update of a single element of the target vector.
+// \ingroup dense_vector
+//
+// \param y The element of the target vector.
+// \param value The accumulated value of the matrix/vector product.
+// \param alpha The scaling factor of the matrix/vector product.
+// \param beta The scaling factor of the target vector (0 or 1).
+// \return void
+//
+// In case \a beta is 0, the target element is not read. This guarantees that uninitialized
+// elements of the target vector do not propagate into the result.
+*/
+BLAZE_ALWAYS_INLINE void mpupdate( double& y, double value, double alpha, double beta ) noexcept
+{
+   y = ( beta == 0.0 ) ? ( alpha * value ) : ( beta * y + alpha * value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed-precision multiplication of a single precision row-major dense matrix and a
+//        double precision dense vector (\f$ \vec{y}=\alpha A\vec{x}+\beta\vec{y} \f$).
+// \ingroup dense_vector
+//
+// \param y The double precision target vector.
+// \param A The single precision row-major matrix.
+// \param x The double precision right-hand side vector.
+// \param alpha The scaling factor of the matrix/vector product.
+// \param beta The scaling factor of the target vector (0 or 1).
+// \return void
+//
+// This kernel computes four dot products at a time. The elements of the matrix are loaded in
+// single precision and widened to double precision within the SIMD registers (see the
+// cvtloadu() function), such that the matrix only requires half of the memory bandwidth of a
+// double precision matrix while all products and sums are computed in double precision.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename VT2 >  // Type of the right-hand side vector operand
+void mpgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,false>& A,
+             const DenseVector<VT2,false>& x, double alpha, double beta )
+{
+   enum : size_t { SIMDSIZE = SIMDTrait<double>::size };
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == M, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == N, "Invalid vector size" );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const double* xp( (~x).data() );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= M; i+=4UL )
+   {
+      const float* a1( (~A).data(i    ) );
+      const float* a2( (~A).data(i+1UL) );
+      const float* a3( (~A).data(i+2UL) );
+      const float* a4( (~A).data(i+3UL) );
+
+      SIMDdouble xmm1, xmm2, xmm3, xmm4;
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         const SIMDdouble x1( loadu( xp+j ) );
+         xmm1 += cvtloadu( a1+j ) * x1;
+         xmm2 += cvtloadu( a2+j ) * x1;
+         xmm3 += cvtloadu( a3+j ) * x1;
+         xmm4 += cvtloadu( a4+j ) * x1;
+      }
+
+      double s1( sum( xmm1 ) );
+      double s2( sum( xmm2 ) );
+      double s3( sum( xmm3 ) );
+      double s4( sum( xmm4 ) );
+
+      for( ; j<N; ++j ) {
+         s1 += double( a1[j] ) * xp[j];
+         s2 += double( a2[j] ) * xp[j];
+         s3 += double( a3[j] ) * xp[j];
+         s4 += double( a4[j] ) * xp[j];
+      }
+
+      mpupdate( (~y)[i    ], s1, alpha, beta );
+      mpupdate( (~y)[i+1UL], s2, alpha, beta );
+      mpupdate( (~y)[i+2UL], s3, alpha, beta );
+      mpupdate( (~y)[i+3UL], s4, alpha, beta );
+   }
+
+   for( ; i<M; ++i )
+   {
+      const float* a1( (~A).data(i) );
+
+      SIMDdouble xmm1;
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         xmm1 += cvtloadu( a1+j ) * loadu( xp+j );
+      }
+
+      double s1( sum( xmm1 ) );
+
+      for( ; j<N; ++j ) {
+         s1 += double( a1[j] ) * xp[j];
+      }
+
+      mpupdate( (~y)[i], s1, alpha, beta );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed-precision multiplication of a single precision column-major dense matrix and a
+//        double precision dense vector (\f$ \vec{y}=\alpha A\vec{x}+\beta\vec{y} \f$).
+// \ingroup dense_vector
+//
+// \param y The double precision target vector.
+// \param A The single precision column-major matrix.
+// \param x The double precision right-hand side vector.
+// \param alpha The scaling factor of the matrix/vector product.
+// \param beta The scaling factor of the target vector (0 or 1).
+// \return void
+//
+// This kernel keeps a block of four SIMD vectors of the target vector in registers and
+// accumulates the contributions of all columns of the matrix into this block. The elements of
+// the matrix are loaded in single precision and widened to double precision within the SIMD
+// registers (see the cvtloadu() function).
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename VT2 >  // Type of the right-hand side vector operand
+void mpgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,true>& A,
+             const DenseVector<VT2,false>& x, double alpha, double beta )
+{
+   enum : size_t { SIMDSIZE = SIMDTrait<double>::size };
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == M, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == N, "Invalid vector size" );
+
+   const double* xp( (~x).data() );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= M; i+=SIMDSIZE*4UL )
+   {
+      SIMDdouble xmm1, xmm2, xmm3, xmm4;
+
+      for( size_t j=0UL; j<N; ++j ) {
+         const SIMDdouble x1( set( xp[j] ) );
+         const float* a( (~A).data(j) + i );
+         xmm1 += cvtloadu( a              ) * x1;
+         xmm2 += cvtloadu( a+SIMDSIZE     ) * x1;
+         xmm3 += cvtloadu( a+SIMDSIZE*2UL ) * x1;
+         xmm4 += cvtloadu( a+SIMDSIZE*3UL ) * x1;
+      }
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         mpupdate( (~y)[i             +k], xmm1[k], alpha, beta );
+         mpupdate( (~y)[i+SIMDSIZE    +k], xmm2[k], alpha, beta );
+         mpupdate( (~y)[i+SIMDSIZE*2UL+k], xmm3[k], alpha, beta );
+         mpupdate( (~y)[i+SIMDSIZE*3UL+k], xmm4[k], alpha, beta );
+      }
+   }
+
+   for( ; (i+SIMDSIZE) <= M; i+=SIMDSIZE )
+   {
+      SIMDdouble xmm1;
+
+      for( size_t j=0UL; j<N; ++j ) {
+         xmm1 += cvtloadu( (~A).data(j) + i ) * set( xp[j] );
+      }
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         mpupdate( (~y)[i+k], xmm1[k], alpha, beta );
+      }
+   }
+
+   for( ; i<M; ++i )
+   {
+      double s1( 0.0 );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         s1 += double( (~A).data(j)[i] ) * xp[j];
+      }
+
+      mpupdate( (~y)[i], s1, alpha, beta );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MIXED-PRECISION REDUCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Mixed-precision reductions */
+//@{
+template< typename VT, bool TF >
+double dssum( const DenseVector<VT,TF>& dv );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+double dsdot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF >
+double dsnrm2( const DenseVector<VT,TF>& dv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the mixed-precision reductions.
+// \ingroup dense_vector
+//
+// In case all given vector types provide direct access to their single precision elements and
+// the SIMD addition and multiplication of double precision values is available, the nested
+// \a value will be set to 1 and the SIMD kernels of the reductions are selected.
+// Otherwise \a value is set to 0.
+*/
+template< typename... VTs >  // Types of the dense vector operands
+struct UseMixedPrecisionReduction
+   : public Bool< useOptimizedKernels &&
+                  HasSIMDAdd<double,double>::value && HasSIMDMult<double,double>::value &&
+                  And< HasConstDataAccess<VTs>..., IsFloat< ElementType_<VTs> >... >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the sum of a dense vector with double precision accumulation.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Type of the dense vector
+inline DisableIf_< UseMixedPrecisionReduction<VT>, double > dssum_backend( const VT& x )
+{
+   double s( 0.0 );
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      s += double( x[i] );
+   }
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD backend of the sum of a single precision dense vector with double precision
+//        accumulation.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Type of the dense vector
+inline EnableIf_< UseMixedPrecisionReduction<VT>, double > dssum_backend( const VT& x )
+{
+   typedef SIMDTrait_< MultTrait_< ElementType_<VT>, double > >  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<double>::size };
+
+   const size_t N( x.size() );
+   const float* xp( x.data() );
+
+   SIMDType xmm1, xmm2;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= N; i+=SIMDSIZE*2UL ) {
+      xmm1 += cvtloadu( xp+i          );
+      xmm2 += cvtloadu( xp+i+SIMDSIZE );
+   }
+
+   double s( sum( xmm1 + xmm2 ) );
+
+   for( ; i<N; ++i ) {
+      s += double( xp[i] );
+   }
+
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sum of all elements of the given dense vector with double precision accumulation.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of all elements in double precision.
+//
+// This function computes the sum of all elements of the given dense vector in double precision,
+// independent of the element type of the vector. This allows to store large vectors in single
+// precision (and thus to halve their memory footprint and memory traffic) without accumulating
+// the rounding errors of a single precision summation:
+
+   \code
+   blaze::DynamicVector<float> a;
+   // ... Resizing and initialization
+   const double s = dssum( a );
+   \endcode
+
+// For vectors with direct access to their single precision elements, the elements are widened
+// to double precision within the SIMD registers. Note that this function is not defined for
+// vectors with complex elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline double dssum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_<VT> );
+
+   const CompositeType_<VT> x( ~dv );  // Evaluation of the dense vector operand
+   return dssum_backend( x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the dot product of two dense vectors with double precision
+//        accumulation.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< UseMixedPrecisionReduction<VT1,VT2>, double >
+   dsdot_backend( const VT1& x, const VT2& y )
+{
+   double s( 0.0 );
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      s += double( x[i] ) * double( y[i] );
+   }
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD backend of the dot product of two single precision dense vectors with double
+//        precision accumulation.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< UseMixedPrecisionReduction<VT1,VT2>, double >
+   dsdot_backend( const VT1& x, const VT2& y )
+{
+   typedef SIMDTrait_< MultTrait_< ElementType_<VT1>, double > >  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<double>::size };
+
+   const size_t N( x.size() );
+   const float* xp( x.data() );
+   const float* yp( y.data() );
+
+   SIMDType xmm1, xmm2;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= N; i+=SIMDSIZE*2UL ) {
+      xmm1 += cvtloadu( xp+i          ) * cvtloadu( yp+i          );
+      xmm2 += cvtloadu( xp+i+SIMDSIZE ) * cvtloadu( yp+i+SIMDSIZE );
+   }
+
+   double s( sum( xmm1 + xmm2 ) );
+
+   for( ; i<N; ++i ) {
+      s += double( xp[i] ) * double( yp[i] );
+   }
+
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dot product of two dense vectors with double precision accumulation.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \return The dot product of the two vectors in double precision.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the dot product \f$ \sum_i lhs_i \cdot rhs_i \f$ of the two given
+// dense vectors in double precision. In accordance to the BLAS function of the same name, the
+// vectors are typically stored in single precision, whereas all products and sums are computed
+// in double precision:
+
+   \code
+   blaze::DynamicVector<float> a, b;
+   // ... Resizing and initialization
+   const double d = dsdot( a, b );
+   \endcode
+
+// The transpose flags of the two vectors are ignored. In case the sizes of the two vectors
+// don't match, a \a std::invalid_argument exception is thrown. Note that this function is not
+// defined for vectors with complex elements.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline double dsdot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_<VT2> );
+
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const CompositeType_<VT1> x( ~lhs );  // Evaluation of the left-hand side dense vector
+   const CompositeType_<VT2> y( ~rhs );  // Evaluation of the right-hand side dense vector
+   return dsdot_backend( x, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Euclidean norm of the given dense vector with double precision accumulation.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The Euclidean norm of the vector in double precision.
+//
+// This function computes the Euclidean norm \f$ \|\vec{a}\|_2 \f$ of the given dense vector in
+// double precision. Since the square of any single precision value is representable in double
+// precision, the computation of the norm of a single precision vector requires no scaling to
+// prevent overflow:
+
+   \code
+   blaze::DynamicVector<float> a;
+   // ... Resizing and initialization
+   const double norm = dsnrm2( a );
+   \endcode
+
+// Note that this function is not defined for vectors with complex elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline double dsnrm2( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_<VT> );
+
+   const CompositeType_<VT> x( ~dv );  // Evaluation of the dense vector operand
+   return sqrt( dsdot_backend( x, x ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
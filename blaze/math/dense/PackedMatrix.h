@@ -0,0 +1,3001 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed symmetric, Hermitian, or triangular matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/adaptors/Forward.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PackingFlag.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS PACKEDPROXY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of packed Hermitian and packed triangular matrices.
+// \ingroup packed_matrix
+//
+// The PackedProxy class represents an access proxy for the elements of a PackedMatrix that
+// cannot be accessed via a plain reference. In case the accessed element lies in the stored
+// part of a Hermitian matrix, the proxy acts like a reference to the stored element. In case
+// the element lies in the implied part of a Hermitian matrix, the proxy refers to the stored,
+// mirrored element and transparently applies the complex conjugate. Assignments to the implied
+// part of a triangular matrix as well as the assignment of a value with non-zero imaginary part
+// to a diagonal element of a Hermitian matrix result in a \a std::invalid_argument exception.
+*/
+template< typename Type >  // Data type of the accessed element
+class PackedProxy : public Proxy< PackedProxy<Type> >
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedProxy( Type* value, bool mirrored, bool diagonal ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const PackedProxy& operator= ( const PackedProxy& pp ) const;
+   template< typename T > inline const PackedProxy& operator= ( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator+=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator-=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator*=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type get() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator Type() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void set( const Type& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* value_;    //!< Pointer to the stored element (\c nullptr for the zero part of a triangle).
+   bool mirrored_;  //!< \a true in case the accessed element is the conjugate of the stored element.
+   bool diagonal_;  //!< \a true in case the accessed element is a diagonal element of a Hermitian matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a PackedProxy.
+//
+// \param value Pointer to the stored element (\c nullptr for the zero part of a triangle).
+// \param mirrored \a true in case the accessed element is the conjugate of the stored element.
+// \param diagonal \a true in case the accessed element is a diagonal element of a Hermitian matrix.
+*/
+template< typename Type >  // Data type of the accessed element
+inline PackedProxy<Type>::PackedProxy( Type* value, bool mirrored, bool diagonal ) noexcept
+   : value_   ( value    )  // Pointer to the stored element
+   , mirrored_( mirrored )  // Conjugation flag
+   , diagonal_( diagonal )  // Hermitian diagonal flag
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline const PackedProxy<Type>& PackedProxy<Type>::operator=( const PackedProxy& pp ) const
+{
+   set( pp.get() );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed packed matrix element.
+//
+// \param value The new value of the packed matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator=( const T& value ) const
+{
+   set( value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value to be added to the packed matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator+=( const T& value ) const
+{
+   set( get() + value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the packed matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator-=( const T& value ) const
+{
+   set( get() - value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator*=( const T& value ) const
+{
+   set( get() * value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator/=( const T& value ) const
+{
+   set( get() / value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed packed matrix element.
+//
+// \return The current value of the packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline Type PackedProxy<Type>::get() const noexcept
+{
+   if( value_ == nullptr )
+      return Type();
+   else if( mirrored_ )
+      return conj( *value_ );
+   else
+      return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to the value of the accessed packed matrix element.
+//
+// \return The current value of the packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline PackedProxy<Type>::operator Type() const noexcept
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the accessed packed matrix element.
+//
+// \param value The new value of the packed matrix element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+*/
+template< typename Type >  // Data type of the accessed element
+inline void PackedProxy<Type>::set( const Type& value ) const
+{
+   if( value_ == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix element" );
+   }
+
+   if( diagonal_ && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+
+   *value_ = ( mirrored_ ? conj( value ) : value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a packed symmetric, Hermitian, or triangular matrix.
+// \ingroup packed_matrix
+//
+// \section packedmatrix_general General
+//
+// The PackedMatrix class template is the representation of an arbitrary sized, square dense
+// matrix that stores only a single triangle of its elements. The type of the elements, the
+// storage order and the structure of the matrix can be specified via the three template
+// parameters:
+
+   \code
+   template< typename Type, bool SO, size_t PF >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - PF  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedHermitian,
+//          blaze::packedLower, or blaze::packedUpper). The default value is blaze::packedSymmetric.
+//
+// Whereas the SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix adaptors store
+// all \f$ N^2 \f$ elements of the adapted matrix, a PackedMatrix stores only the lower part
+// (symmetric, Hermitian, and lower matrices) or the upper part (upper matrices) and therefore
+// requires only half the memory. The remaining part is implied by the structure of the matrix.
+//
+// \n \section packedmatrix_storage Storage Layout
+//
+// The stored triangle is arranged row-wise (row-major matrices) or column-wise (column-major
+// matrices), similar to the packed storage format of LAPACK. In order to enable vectorized
+// kernels, however, every row/column is aligned and starts and ends at a multiple of the SIMD
+// width (blocked-packed storage). For that purpose at most one SIMD vector of zero elements
+// is stored in front of and behind the stored part of every row/column, which is negligible
+// for large matrices:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::packedSymmetric;
+   using blaze::columnMajor;
+
+   SymmetricMatrix< DynamicMatrix<double,columnMajor> > A( 50000UL );  // Approx. 20 GByte
+   PackedMatrix<double,columnMajor,packedSymmetric>      B( 50000UL );  // Approx. 10 GByte
+   \endcode
+
+// \n \section packedmatrix_element_access Element Access
+//
+// All elements of a PackedMatrix can be accessed via the function call operator. In case of a
+// symmetric matrix, the access to the implied part of the matrix returns a reference to the
+// mirrored, stored element. In case of a Hermitian or a triangular matrix, the access returns
+// a proxy that ensures that the matrix retains its structure:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedHermitian;
+   using blaze::packedLower;
+   using blaze::rowMajor;
+
+   typedef std::complex<double>  cplx;
+
+   PackedMatrix<cplx,rowMajor,packedHermitian> A( 3UL );
+   A(0,2) = cplx( 1.0, 2.0 );  // Also sets A(2,0) to ( 1.0,-2.0 )
+   A(1,1) = cplx( 3.0, 1.0 );  // Throws an exception; invalid diagonal element
+
+   PackedMatrix<double,rowMajor,packedLower> L( 3UL );
+   L(2,0) = 4.0;               // Sets a stored element
+   L(0,2) = 4.0;               // Throws an exception; invalid assignment to the upper part
+   \endcode
+
+// \n \section packedmatrix_arithmetic_operations Arithmetic Operations
+//
+// A PackedMatrix can be used in all arithmetic operations of the Blaze library, but in contrast
+// to the other dense matrices it is not vectorized within expressions. In order to exploit the
+// packed storage, the following kernels operate directly on the stored triangle and read every
+// stored element exactly once:
+//
+//  - spmv(): \f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$ (matrix/vector multiplication)
+//  - spmm(): \f$ C = \alpha A B + \beta C \f$ (matrix/matrix multiplication)
+//  - sprk(): \f$ C = \alpha A A^T + \beta C \f$ or \f$ C = \alpha A A^H + \beta C \f$ (rank-k
+//    update of a packed symmetric or Hermitian matrix)
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::packedSymmetric;
+   using blaze::rowMajor;
+
+   DynamicMatrix<double,rowMajor> X( 1000UL, 200UL );
+   // ... Initialization of X
+
+   PackedMatrix<double,rowMajor,packedSymmetric> C;
+   sprk( C, X, 1.0/199.0, 0.0 );  // Covariance matrix C = X * trans(X) / 199
+
+   DynamicVector<double> x( 1000UL, 1.0 ), y( 1000UL );
+   spmv( y, C, x, 1.0, 0.0 );     // y = C * x
+   y = C * x;                     // Same result via the default, element-wise kernel
+   \endcode
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder     // Storage order
+        , size_t PF = packedSymmetric >     // Packing flag
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,SO,PF>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<Type,SO>   RT;  //!< Result type of the underlying storage order.
+   typedef DynamicMatrix<Type,!SO>  OT;  //!< Result type of the opposite storage order.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the structure of the matrix.
+   enum : bool { symmetric  = ( PF == packedSymmetric ) };
+   enum : bool { hermitian  = ( PF == packedHermitian ) };
+   enum : bool { triangular = ( PF == packedLower || PF == packedUpper ) };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,SO,PF>  This;      //!< Type of this PackedMatrix instance.
+   typedef DenseMatrix<This,SO>      BaseType;  //!< Base type of this PackedMatrix instance.
+
+   //! Result type for expression template evaluations.
+   typedef IfTrue_< symmetric, SymmetricMatrix<RT,SO,true,IsNumeric<Type>::value>
+                  , IfTrue_< hermitian, HermitianMatrix<RT,SO,true>
+                           , IfTrue_< PF == packedLower, LowerMatrix<RT,SO,true>
+                                                       , UpperMatrix<RT,SO,true> > > >  ResultType;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   typedef IfTrue_< symmetric, SymmetricMatrix<OT,!SO,true,IsNumeric<Type>::value>
+                  , IfTrue_< hermitian, HermitianMatrix<OT,!SO,true>
+                           , IfTrue_< PF == packedLower, LowerMatrix<OT,!SO,true>
+                                                       , UpperMatrix<OT,!SO,true> > > >  OppositeType;
+
+   //! Transpose type for expression template evaluations.
+   typedef IfTrue_< symmetric, SymmetricMatrix<OT,!SO,true,IsNumeric<Type>::value>
+                  , IfTrue_< hermitian, HermitianMatrix<OT,!SO,true>
+                           , IfTrue_< PF == packedLower, UpperMatrix<OT,!SO,true>
+                                                       , LowerMatrix<OT,!SO,true> > > >  TransposeType;
+
+   typedef Type         ElementType;    //!< Type of the matrix elements.
+   typedef const Type   ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&  CompositeType;  //!< Data type for composite expression templates.
+
+   //! Reference to a non-constant matrix value.
+   typedef IfTrue_< symmetric, Type&, PackedProxy<Type> >  Reference;
+
+   typedef const Type  ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*       Pointer;         //!< Pointer to the non-constant packed elements.
+   typedef const Type* ConstPointer;    //!< Pointer to the constant packed elements.
+   //**********************************************************************************************
+
+   //**PackedIterator class definition*************************************************************
+   /*!\brief Iterator over the elements of a row/column of the packed matrix.
+   //
+   // The PackedIterator class provides random access to all elements of a single row (row-major
+   // matrices) or column (column-major matrices), including the implied elements that are not
+   // part of the stored triangle.
+   */
+   template< typename MatrixType       // Type of the packed matrix
+           , typename ReferenceType >  // Reference return type
+   class PackedIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the PackedIterator class.
+      */
+      inline PackedIterator() noexcept
+         : matrix_( nullptr )  // The packed matrix
+         , k_     ( 0UL )      // The index of the current row/column
+         , l_     ( 0UL )      // The index of the current element within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the PackedIterator class.
+      //
+      // \param matrix The packed matrix.
+      // \param k The index of the row (row-major) or column (column-major).
+      // \param l The initial element index within the row/column.
+      */
+      inline PackedIterator( MatrixType& matrix, size_t k, size_t l ) noexcept
+         : matrix_( &matrix )  // The packed matrix
+         , k_     ( k )        // The index of the current row/column
+         , l_     ( l )        // The index of the current element within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different PackedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2, typename ReferenceType2 >
+      inline PackedIterator( const PackedIterator<MatrixType2,ReferenceType2>& it ) noexcept
+         : matrix_( it.matrix_ )  // The packed matrix
+         , k_     ( it.k_ )       // The index of the current row/column
+         , l_     ( it.l_ )       // The index of the current element within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline PackedIterator& operator+=( size_t inc ) noexcept {
+         l_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline PackedIterator& operator-=( size_t dec ) noexcept {
+         l_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline PackedIterator& operator++() noexcept {
+         ++l_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator++( int ) noexcept {
+         const PackedIterator tmp( *this );
+         ++l_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline PackedIterator& operator--() noexcept {
+         --l_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator--( int ) noexcept {
+         const PackedIterator tmp( *this );
+         --l_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return ( SO )?( (*matrix_)(l_,k_) ):( (*matrix_)(k_,l_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const PackedIterator& rhs ) const noexcept {
+         return l_ == rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const PackedIterator& rhs ) const noexcept {
+         return l_ != rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const PackedIterator& rhs ) const noexcept {
+         return l_ < rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const PackedIterator& rhs ) const noexcept {
+         return l_ > rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const PackedIterator& rhs ) const noexcept {
+         return l_ <= rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const PackedIterator& rhs ) const noexcept {
+         return l_ >= rhs.l_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const PackedIterator& rhs ) const noexcept {
+         return static_cast<DifferenceType>( l_ ) - static_cast<DifferenceType>( rhs.l_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) noexcept {
+         return PackedIterator( *it.matrix_, it.k_, it.l_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a PackedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) noexcept {
+         return PackedIterator( *it.matrix_, it.k_, it.l_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) noexcept {
+         return PackedIterator( *it.matrix_, it.k_, it.l_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< The packed matrix.
+      size_t      k_;       //!< The index of the current row/column.
+      size_t      l_;       //!< The index of the current element within the row/column.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename ReferenceType2 > friend class PackedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PackedIterator<This,Reference>             Iterator;       //!< Iterator over non-constant elements.
+   typedef PackedIterator<const This,ConstReference>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,SO,PF>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Due to the packed storage the matrix cannot be
+       vectorized within expressions, therefore the \a simdEnabled compilation flag is always
+       set to \a false. Note that the packed kernels spmv(), spmm(), and sprk() are vectorized
+       nonetheless. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t n );
+   explicit inline PackedMatrix( size_t n, const Type& init );
+
+                                     inline PackedMatrix( const PackedMatrix& m );
+                                     inline PackedMatrix( PackedMatrix&& m ) noexcept;
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& rhs );
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline void   reset();
+   inline void   clear();
+          void   resize ( size_t n, bool preserve=true );
+   inline void   extend ( size_t n, bool preserve=true );
+   inline void   swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Kernel functions */
+   //@{
+   void mult( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x ) const;
+   void mult( DynamicMatrix<Type,rowMajor>& C, const DynamicMatrix<Type,rowMajor>& B ) const;
+
+   template< typename ST >
+   void rankUpdate( const DynamicMatrix<Type,rowMajor>& A, ST alpha, ST beta );
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   //! The blocking factor of the packed storage.
+   enum : size_t { BLOCK = ( usePadding && IsVectorizable<Type>::value ? SIMDSIZE : 1UL ) };
+
+   //! Compilation switch for the storage of the lower part of the matrix.
+   enum : bool { lower = ( PF != packedUpper ) };
+
+   //! Compilation switch for the packed layout (\a true if row/column \a k starts at index \a k).
+   enum : bool { tail = ( lower == SO ) };
+
+   //! Compilation switch for the vectorized kernels.
+   enum : bool { vectorizable = usePadding &&
+                                IsVectorizable<Type>::value &&
+                                HasSIMDAdd<Type,Type>::value &&
+                                HasSIMDMult<Type,Type>::value };
+
+   //! Compilation switch for the vectorized kernels involving the conjugate of the elements.
+   enum : bool { conjVectorizable = vectorizable && !( hermitian && IsComplex<Type>::value ) };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t blockFloor( size_t k ) noexcept;
+   static inline size_t blockCeil ( size_t k ) noexcept;
+   static inline size_t storage   ( size_t n ) noexcept;
+
+   inline Type&             reference( size_t i, size_t j, TrueType  ) noexcept;
+   inline PackedProxy<Type> reference( size_t i, size_t j, FalseType ) noexcept;
+
+   inline bool   isStored( size_t i, size_t j ) const noexcept;
+   inline size_t first   ( size_t k ) const noexcept;
+   inline size_t last    ( size_t k ) const noexcept;
+   inline size_t offset  ( size_t k ) const noexcept;
+   inline size_t index   ( size_t i, size_t j ) const noexcept;
+
+   template< typename MT > inline bool isValid( const MT& m ) const;
+   template< typename MT > void assign( const MT& m );
+
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, TrueType  ) const noexcept;
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, FalseType ) const noexcept;
+
+   static inline Type dot( const Type* BLAZE_RESTRICT a, const Type* BLAZE_RESTRICT b, size_t n, TrueType  ) noexcept;
+   static inline Type dot( const Type* BLAZE_RESTRICT a, const Type* BLAZE_RESTRICT b, size_t n, FalseType ) noexcept;
+
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, TrueType  ) noexcept;
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, FalseType ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   size_t nn_;               //!< The number of rows and columns including the blocking.
+   size_t capacity_;         //!< The maximum capacity of the packed storage.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated packed matrix elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( PF <= packedUpper );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::PackedMatrix() noexcept
+   : n_       ( 0UL )      // The current number of rows and columns of the matrix
+   , nn_      ( 0UL )      // The number of rows and columns including the blocking
+   , capacity_( 0UL )      // The maximum capacity of the packed storage
+   , v_       ( nullptr )  // The packed matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a packed matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All matrix elements are initialized to the default value (for instance 0 for integral and
+// floating point data types).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::PackedMatrix( size_t n )
+   : n_       ( n )                          // The current number of rows and columns of the matrix
+   , nn_      ( blockCeil( n ) )             // The number of rows and columns including the blocking
+   , capacity_( storage( n ) )               // The maximum capacity of the packed storage
+   , v_       ( allocate<Type>( capacity_ ) )  // The packed matrix elements
+{
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \f$ n \times n \f$ matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the matrix elements.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// All matrix elements are initialized with the specified value. In case of a lower or upper
+// matrix, only the elements of the stored triangle are initialized with the given value. In
+// case of a Hermitian matrix, a value with non-zero imaginary part results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::PackedMatrix( size_t n, const Type& init )
+   : PackedMatrix( n )  // Initialization of the packed storage
+{
+   *this = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                       // The current number of rows and columns of the matrix
+   , nn_      ( m.nn_ )                      // The number of rows and columns including the blocking
+   , capacity_( storage( m.n_ ) )            // The maximum capacity of the packed storage
+   , v_       ( allocate<Type>( capacity_ ) )  // The packed matrix elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_       ( m.n_        )  // The current number of rows and columns of the matrix
+   , nn_      ( m.nn_       )  // The number of rows and columns including the blocking
+   , capacity_( m.capacity_ )  // The maximum capacity of the packed storage
+   , v_       ( m.v_        )  // The packed matrix elements
+{
+   m.n_        = 0UL;
+   m.nn_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor initializes the packed matrix as a copy of the given matrix. In case the
+// given matrix is not square or does not have the structure of the packed matrix (i.e. it is
+// not symmetric, Hermitian, lower, or upper, respectively), a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline PackedMatrix<Type,SO,PF>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : PackedMatrix()  // Initialization of an empty matrix
+{
+   *this = ~m;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// In case of a symmetric matrix, the function returns a reference to the stored element. In
+// case of a Hermitian or a triangular matrix, the function returns a proxy that ensures that
+// the matrix retains its structure. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform
+// a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Reference
+   PackedMatrix<Type,SO,PF>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return reference( i, j, BoolConstant<symmetric>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstReference
+   PackedMatrix<Type,SO,PF>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index(i,j)];
+   else if( triangular )
+      return Type();
+   else if( hermitian )
+      return conj( v_[index(j,i)] );
+   else
+      return v_[index(j,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Reference
+   PackedMatrix<Type,SO,PF>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstReference
+   PackedMatrix<Type,SO,PF>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal packed element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that the
+// stored rows (row-major) or columns (column-major) of the packed triangle are blocked with
+// respect to the SIMD width and are therefore interspersed with zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Pointer PackedMatrix<Type,SO,PF>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal packed element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that the
+// stored rows (row-major) or columns (column-major) of the packed triangle are blocked with
+// respect to the SIMD width and are therefore interspersed with zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstPointer PackedMatrix<Type,SO,PF>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed elements of a specific row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix). Note that only the
+// elements of the stored triangle are contiguous in memory, the mirrored or zero elements
+// of the row/column are not part of the storage!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Pointer PackedMatrix<Type,SO,PF>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return v_ + offset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed elements of a specific row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first stored element of row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix). Note that only the
+// elements of the stored triangle are contiguous in memory, the mirrored or zero elements
+// of the row/column are not part of the storage!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstPointer PackedMatrix<Type,SO,PF>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return v_ + offset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator to the first element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Iterator
+   PackedMatrix<Type,SO,PF>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator to the first element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstIterator
+   PackedMatrix<Type,SO,PF>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator to the first element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstIterator
+   PackedMatrix<Type,SO,PF>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator just past the last element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::Iterator
+   PackedMatrix<Type,SO,PF>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return Iterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator just past the last element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstIterator
+   PackedMatrix<Type,SO,PF>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i. In case the
+// storage order is set to \a rowMajor the function returns an iterator just past the last element of row
+// \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline typename PackedMatrix<Type,SO,PF>::ConstIterator
+   PackedMatrix<Type,SO,PF>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to Hermitian matrix.
+//
+// In case of a lower or upper matrix, only the elements of the stored triangle are set to the
+// given value. In case of a Hermitian matrix, a value with non-zero imaginary part results in
+// a \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator=( const Type& rhs )
+{
+   if( hermitian && !isReal( rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to Hermitian matrix" );
+   }
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      std::fill( segment+begin, segment+end, rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The packed matrix is resized according to the given matrix and initialized as a copy of
+// this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+storage( rhs.n_ ), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   n_        = rhs.n_;
+   nn_       = rhs.nn_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.n_        = 0UL;
+   rhs.nn_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The packed matrix is resized according to the given matrix and initialized as a copy of
+// this matrix. In case the given matrix is not square or does not have the structure of the
+// packed matrix (i.e. it is not symmetric, Hermitian, lower, or upper, respectively), a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   if( !isSquare( tmp ) || !isValid( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   resize( tmp.rows(), false );
+   assign( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix does not have
+// the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   if( !isValid( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      for( size_t l=begin; l<end; ++l ) {
+         segment[l] += ( SO ? tmp(l,k) : tmp(k,l) );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix does not have
+// the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PF>& PackedMatrix<Type,SO,PF>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typedef IfTrue_< IsExpression<MT>::value, const ResultType_<MT>, const MT& >  Tmp;
+
+   Tmp tmp( ~rhs );
+
+   if( !isValid( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      for( size_t l=begin; l<end; ++l ) {
+         segment[l] -= ( SO ? tmp(l,k) : tmp(k,l) );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , size_t PF >       // Packing flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,SO,PF> >&
+   PackedMatrix<Type,SO,PF>::operator*=( Other rhs )
+{
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      for( size_t l=begin; l<end; ++l ) {
+         segment[l] *= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , size_t PF >       // Packing flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,SO,PF> >&
+   PackedMatrix<Type,SO,PF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      for( size_t l=begin; l<end; ++l ) {
+         segment[l] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the length of the longest stored row/column.
+//
+// \return The number of elements of the longest stored row/column, including padding.
+//
+// In contrast to the spacing of a conventional dense matrix, the returned value does NOT denote
+// a constant stride between two rows (row-major) or columns (column-major), since the stored
+// rows/columns of a packed matrix have different lengths.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the packed storage.
+//
+// \return The number of elements the packed storage can hold.
+//
+// Note that due to the packed storage the capacity of an \f$ N \times N \f$ matrix is only
+// about \f$ N^2/2 \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::reset()
+{
+   std::fill( v_, v_+storage( n_ ), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::clear()
+{
+   n_  = 0UL;
+   nn_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. In contrast to the other dense matrices,
+// all new elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+void PackedMatrix<Type,SO,PF>::resize( size_t n, bool preserve )
+{
+   if( n == n_ ) return;
+
+   if( preserve && n_ > 0UL )
+   {
+      PackedMatrix tmp( n );
+      const size_t nmin( min( n, n_ ) );
+
+      for( size_t k=0UL; k<nmin; ++k ) {
+         const size_t begin( tail ? k : 0UL );
+         const size_t end  ( tail ? nmin : k+1UL );
+         std::copy( v_     + offset( k )     + begin - first( k ),
+                    v_     + offset( k )     + end   - first( k ),
+                    tmp.v_ + tmp.offset( k ) + begin - tmp.first( k ) );
+      }
+
+      swap( tmp );
+   }
+   else
+   {
+      const size_t required( storage( n ) );
+
+      if( required > capacity_ ) {
+         Type* BLAZE_RESTRICT v = allocate<Type>( required );
+         std::swap( v_, v );
+         deallocate( v );
+         capacity_ = required;
+      }
+
+      n_  = n;
+      nn_ = blockCeil( n );
+
+      std::fill( v_, v_+required, Type() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a n rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. All new
+// elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::extend( size_t n, bool preserve )
+{
+   resize( n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::swap( PackedMatrix& m ) noexcept
+{
+   std::swap( n_, m.n_ );
+   std::swap( nn_, m.nn_ );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest multiple of the blocking factor not larger than \a k.
+//
+// \param k The index to be rounded down.
+// \return The rounded index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::blockFloor( size_t k ) noexcept
+{
+   return k - ( k % BLOCK );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest multiple of the blocking factor not smaller than \a k.
+//
+// \param k The index to be rounded up.
+// \return The rounded index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::blockCeil( size_t k ) noexcept
+{
+   return nextMultiple<size_t>( k, BLOCK );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of elements of the packed storage of an \f$ n \times n \f$ matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The required number of elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::storage( size_t n ) noexcept
+{
+   const size_t q( n / BLOCK );
+   const size_t r( n % BLOCK );
+
+   if( tail )
+      return n*blockCeil( n ) - BLOCK*BLOCK*( q*(q-1UL)/2UL ) - r*q*BLOCK;
+   else
+      return BLOCK*BLOCK*( q*(q+1UL)/2UL ) + r*(q+1UL)*BLOCK;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the element \f$ (i,j) \f$ is part of the stored triangle.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline bool PackedMatrix<Type,SO,PF>::isStored( size_t i, size_t j ) const noexcept
+{
+   return ( lower ? i >= j : i <= j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of row/column \a k (including blocking).
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \return The index of the first stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::first( size_t k ) const noexcept
+{
+   return ( tail ? blockFloor( k ) : 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of row/column \a k (including blocking).
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \return The index one past the last stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::last( size_t k ) const noexcept
+{
+   return ( tail ? nn_ : blockCeil( k+1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of row/column \a k within the packed storage.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \return The offset of the first stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::offset( size_t k ) const noexcept
+{
+   const size_t q( k / BLOCK );
+   const size_t r( k % BLOCK );
+
+   if( tail )
+      return k*nn_ - BLOCK*BLOCK*( q*(q-1UL)/2UL ) - r*q*BLOCK;
+   else
+      return BLOCK*BLOCK*( q*(q+1UL)/2UL ) + r*(q+1UL)*BLOCK;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the stored element \f$ (i,j) \f$ within the packed storage.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The index of the element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline size_t PackedMatrix<Type,SO,PF>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid access to implied element" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   return offset( k ) + l - first( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a symmetric matrix element.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference to the stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline Type& PackedMatrix<Type,SO,PF>::reference( size_t i, size_t j, TrueType ) noexcept
+{
+   return v_[ isStored( i, j ) ? index( i, j ) : index( j, i ) ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a Hermitian or triangular matrix element.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Proxy to the accessed element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline PackedProxy<Type> PackedMatrix<Type,SO,PF>::reference( size_t i, size_t j, FalseType ) noexcept
+{
+   const bool stored( isStored( i, j ) );
+
+   if( stored )
+      return PackedProxy<Type>( v_ + index( i, j ), false, hermitian && i == j );
+   else if( triangular )
+      return PackedProxy<Type>( nullptr, false, false );
+   else
+      return PackedProxy<Type>( v_ + index( j, i ), true, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix has the structure of the packed matrix.
+//
+// \param m The matrix to be checked.
+// \return \a true in case the matrix has the required structure, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT >  // Type of the matrix
+inline bool PackedMatrix<Type,SO,PF>::isValid( const MT& m ) const
+{
+   if( symmetric )
+      return isSymmetric( m );
+   else if( hermitian )
+      return isHermitian( m );
+   else if( PF == packedLower )
+      return isLower( m );
+   else
+      return isUpper( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the stored triangle of the given matrix.
+//
+// \param m The matrix to be assigned.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename MT >  // Type of the matrix
+void PackedMatrix<Type,SO,PF>::assign( const MT& m )
+{
+   BLAZE_INTERNAL_ASSERT( m.rows() == n_ && m.columns() == n_, "Invalid matrix size" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+      for( size_t l=begin; l<end; ++l ) {
+         segment[l] = ( SO ? m(l,k) : m(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , size_t PF >       // Packing flag
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO,PF>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , size_t PF >       // Packing flag
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO,PF>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the matrix cannot be accessed via aligned SIMD operations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline bool PackedMatrix<Type,SO,PF>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since the matrix cannot be used in SMP assignments.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline bool PackedMatrix<Type,SO,PF>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the packed matrix/vector multiplication \f$ \vec{y} += A \vec{x} \f$.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// This function expects both vectors to be properly aligned and, in case the kernel is
+// vectorized, to be zero padded up to the next multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+void PackedMatrix<Type,SO,PF>::mult( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x ) const
+{
+   multKernel( y, x, BoolConstant<conjVectorizable>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the packed matrix/matrix multiplication \f$ C += A B \f$.
+//
+// \param C The row-major target matrix.
+// \param B The row-major right-hand side matrix.
+// \return void
+//
+// Every stored element of the packed matrix is read exactly once and scales a complete row of
+// \a B, i.e. the kernel is vectorized along the rows of \a B and \a C.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+void PackedMatrix<Type,SO,PF>::mult( DynamicMatrix<Type,rowMajor>& C,
+                                     const DynamicMatrix<Type,rowMajor>& B ) const
+{
+   BLAZE_INTERNAL_ASSERT( B.rows() == n_ && C.rows() == n_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == C.columns()      , "Invalid number of columns" );
+
+   const size_t N( vectorizable ? B.spacing() : B.columns() );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+
+      for( size_t l=begin; l<end; ++l )
+      {
+         const size_t i( SO ? l : k );
+         const size_t j( SO ? k : l );
+
+         axpy( C.data(i), B.data(j), segment[l], N, BoolConstant<vectorizable>() );
+
+         if( !triangular && i != j ) {
+            axpy( C.data(j), B.data(i), ( hermitian ? conj( segment[l] ) : segment[l] ),
+                  N, BoolConstant<vectorizable>() );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the rank-k update \f$ C = \alpha A A^T + \beta C \f$ (symmetric) or
+//        \f$ C = \alpha A A^H + \beta C \f$ (Hermitian).
+//
+// \param A The row-major \f$ N \times K \f$ matrix.
+// \param alpha The scaling factor for \f$ A A^T \f$ or \f$ A A^H \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// Every stored element of the packed matrix is computed as the dot product of two rows of
+// \a A. In case \a beta is zero, the current values of the packed matrix are not read.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+template< typename ST >  // Type of the scaling factors
+void PackedMatrix<Type,SO,PF>::rankUpdate( const DynamicMatrix<Type,rowMajor>& A, ST alpha, ST beta )
+{
+   BLAZE_STATIC_ASSERT( !triangular );
+
+   BLAZE_INTERNAL_ASSERT( A.rows() == n_, "Invalid number of rows" );
+
+   const size_t N( conjVectorizable ? A.spacing() : A.columns() );
+   const bool   scale( !isDefault( beta ) );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+
+      for( size_t l=begin; l<end; ++l )
+      {
+         const size_t i( SO ? l : k );
+         const size_t j( SO ? k : l );
+
+         const Type value( dot( A.data(i), A.data(j), N, BoolConstant<conjVectorizable>() ) );
+
+         if( scale )
+            segment[l] = alpha * value + beta * segment[l];
+         else
+            segment[l] = alpha * value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the packed matrix/vector multiplication \f$ \vec{y} += A \vec{x} \f$.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// For every stored row/column of the matrix, the stored part is used once for a vectorized
+// update of the target vector (column-wise storage) and once for a vectorized dot product with
+// the right-hand side vector (row-wise storage), i.e. every element is read exactly once.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                  TrueType ) const noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const bool update ( SO  || !triangular );
+   const bool product( !SO || !triangular );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const Type* BLAZE_RESTRICT a( v_ + offset( k ) );
+      const size_t begin( first( k ) );
+      const size_t end  ( last( k ) );
+
+      const SIMDType xk( set( x[k] ) );
+      SIMDType xmm( set( Type() ) );
+
+      for( size_t l=begin; l<end; l+=SIMDSIZE ) {
+         const SIMDType a1( loada( a+l-begin ) );
+         if( update  ) storea( y+l, loada( y+l ) + a1 * xk );
+         if( product ) xmm = xmm + a1 * loada( x+l );
+      }
+
+      if( product ) y[k] += sum( xmm );
+      if( update && product ) y[k] -= a[k-begin] * x[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the packed matrix/vector multiplication \f$ \vec{y} += A \vec{x} \f$.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                  FalseType ) const noexcept
+{
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const Type* const segment( v_ + offset( k ) - first( k ) );
+      const size_t begin( tail ? k : 0UL );
+      const size_t end  ( tail ? n_ : k+1UL );
+
+      Type tmp = Type();
+
+      for( size_t l=begin; l<end; ++l )
+      {
+         const Type& e( segment[l] );
+
+         if( SO ) {
+            y[l] += e * x[k];
+            if( !triangular && l != k )
+               tmp += ( hermitian ? conj( e ) : e ) * x[l];
+         }
+         else {
+            tmp += e * x[l];
+            if( !triangular && l != k )
+               y[l] += ( hermitian ? conj( e ) : e ) * x[k];
+         }
+      }
+
+      y[k] += tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized dot product of two aligned, zero padded arrays.
+//
+// \param a Pointer to the first element of the first array.
+// \param b Pointer to the first element of the second array.
+// \param n The number of elements including the padding (a multiple of the SIMD width).
+// \return The dot product of the two arrays.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline Type PackedMatrix<Type,SO,PF>::dot( const Type* BLAZE_RESTRICT a, const Type* BLAZE_RESTRICT b,
+                                           size_t n, TrueType ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   SIMDType xmm1( set( Type() ) );
+   SIMDType xmm2( set( Type() ) );
+   size_t l( 0UL );
+
+   for( ; (l+SIMDSIZE) < n; l+=SIMDSIZE*2UL ) {
+      xmm1 = xmm1 + loada( a+l          ) * loada( b+l          );
+      xmm2 = xmm2 + loada( a+l+SIMDSIZE ) * loada( b+l+SIMDSIZE );
+   }
+   for( ; l<n; l+=SIMDSIZE ) {
+      xmm1 = xmm1 + loada( a+l ) * loada( b+l );
+   }
+
+   return sum( xmm1 + xmm2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default dot product of two arrays.
+//
+// \param a Pointer to the first element of the first array.
+// \param b Pointer to the first element of the second array (conjugated for Hermitian matrices).
+// \param n The number of elements.
+// \return The dot product of the two arrays.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline Type PackedMatrix<Type,SO,PF>::dot( const Type* BLAZE_RESTRICT a, const Type* BLAZE_RESTRICT b,
+                                           size_t n, FalseType ) noexcept
+{
+   Type tmp = Type();
+
+   for( size_t l=0UL; l<n; ++l ) {
+      tmp += a[l] * ( hermitian ? conj( b[l] ) : b[l] );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized update \f$ \vec{y} += a \vec{x} \f$ of an aligned, zero padded array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements including the padding (a multiple of the SIMD width).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                            const Type& a, size_t n, TrueType ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const SIMDType factor( set( a ) );
+
+   for( size_t l=0UL; l<n; l+=SIMDSIZE ) {
+      storea( y+l, loada( y+l ) + loada( x+l ) * factor );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default update \f$ \vec{y} += a \vec{x} \f$ of an array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void PackedMatrix<Type,SO,PF>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                            const Type& a, size_t n, FalseType ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] += x[l] * a;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, bool SO, size_t PF >
+inline void reset( PackedMatrix<Type,SO,PF>& m );
+
+template< typename Type, bool SO, size_t PF >
+inline void clear( PackedMatrix<Type,SO,PF>& m );
+
+template< typename Type, bool SO, size_t PF >
+inline bool isDefault( const PackedMatrix<Type,SO,PF>& m );
+
+template< typename Type, bool SO, size_t PF >
+inline void swap( PackedMatrix<Type,SO,PF>& a, PackedMatrix<Type,SO,PF>& b ) noexcept;
+
+template< typename VT1, typename Type, bool SO, size_t PF, typename VT2, typename ST >
+void spmv( DenseVector<VT1,false>& y, const PackedMatrix<Type,SO,PF>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta );
+
+template< typename MT1, bool SO1, typename Type, bool SO, size_t PF, typename MT2, bool SO2, typename ST >
+void spmm( DenseMatrix<MT1,SO1>& C, const PackedMatrix<Type,SO,PF>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta );
+
+template< typename Type, bool SO, size_t PF, typename MT, bool SO2, typename ST >
+void sprk( PackedMatrix<Type,SO,PF>& C, const DenseMatrix<MT,SO2>& A, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void reset( PackedMatrix<Type,SO,PF>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void clear( PackedMatrix<Type,SO,PF>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline bool isDefault( const PackedMatrix<Type,SO,PF>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , size_t PF >    // Packing flag
+inline void swap( PackedMatrix<Type,SO,PF>& a, PackedMatrix<Type,SO,PF>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packed matrix/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup packed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side packed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function performs the multiplication of a packed matrix with a dense vector. Every
+// stored element of the packed matrix is read exactly once. In case \a beta is zero, the
+// target vector is not read and resized to the number of rows of \a A if necessary.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , size_t PF      // Packing flag of the matrix
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void spmv( DenseVector<VT1,false>& y, const PackedMatrix<Type,SO,PF>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~x).size() != A.columns() || ( !isDefault( beta ) && (~y).size() != A.rows() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const DynamicVector<Type,false> tx( ~x );
+   DynamicVector<Type,false> ty( A.rows(), Type() );
+
+   A.mult( ty.data(), tx.data() );
+
+   for( size_t i=ty.size(); i<ty.capacity(); ++i ) {
+      ty.data()[i] = Type();
+   }
+
+   if( isDefault( beta ) )
+      (~y) = alpha * ty;
+   else
+      (~y) = alpha * ty + beta * (~y);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packed matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup packed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side packed matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the multiplication of a packed matrix with a dense matrix. Every
+// stored element of the packed matrix is read exactly once and scales a complete row of \a B.
+// In case \a beta is zero, the target matrix is not read and resized if necessary.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , size_t PF      // Packing flag of the packed matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , bool SO2       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void spmm( DenseMatrix<MT1,SO1>& C, const PackedMatrix<Type,SO,PF>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != A.columns() ||
+       ( !isDefault( beta ) && ( (~C).rows() != A.rows() || (~C).columns() != (~B).columns() ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const DynamicMatrix<Type,rowMajor> tB( ~B );
+   DynamicMatrix<Type,rowMajor> tC( A.rows(), tB.columns(), Type() );
+
+   A.mult( tC, tB );
+
+   for( size_t i=0UL; i<tC.rows(); ++i ) {
+      for( size_t j=tC.columns(); j<tC.spacing(); ++j ) {
+         tC.data(i)[j] = Type();
+      }
+   }
+
+   if( isDefault( beta ) )
+      (~C) = alpha * tC;
+   else
+      (~C) = alpha * tC + beta * (~C);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-k update of a packed symmetric or Hermitian matrix.
+// \ingroup packed_matrix
+//
+// \param C The target packed symmetric or Hermitian matrix.
+// \param A The \f$ N \times K \f$ dense matrix operand.
+// \param alpha The scaling factor for \f$ A*A^T \f$ or \f$ A*A^H \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ C=\alpha*A*A^T+\beta*C \f$ for packed symmetric matrices and
+// \f$ C=\alpha*A*A^H+\beta*C \f$ for packed Hermitian matrices. Only the stored triangle of
+// \a C is computed and every element of \a C is written exactly once. In case \a beta is zero,
+// \a C is not read and resized if necessary. Note that for Hermitian matrices \a alpha and
+// \a beta are required to be real.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , size_t PF      // Packing flag of the packed matrix
+        , typename MT    // Type of the dense matrix operand
+        , bool SO2       // Storage order of the dense matrix operand
+        , typename ST >  // Type of the scaling factors
+void sprk( PackedMatrix<Type,SO,PF>& C, const DenseMatrix<MT,SO2>& A, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT( PF == packedSymmetric || PF == packedHermitian );
+
+   BLAZE_USER_ASSERT( PF != packedHermitian || ( isReal( alpha ) && isReal( beta ) ),
+                      "Invalid scaling factors for Hermitian matrix detected" );
+
+   if( isDefault( beta ) ) {
+      C.resize( (~A).rows(), false );
+   }
+   else if( C.rows() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const DynamicMatrix<Type,rowMajor> tA( ~A );
+
+   C.rankUpdate( tA, alpha, beta );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsSquare< PackedMatrix<T,SO,PF> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsSymmetric< PackedMatrix<T,SO,PF> > : public BoolConstant< PF == packedSymmetric || ( PF == packedHermitian && IsBuiltin<T>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsHermitian< PackedMatrix<T,SO,PF> > : public BoolConstant< PF == packedHermitian || ( PF == packedSymmetric && IsBuiltin<T>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsLower< PackedMatrix<T,SO,PF> > : public BoolConstant< PF == packedLower >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsUpper< PackedMatrix<T,SO,PF> > : public BoolConstant< PF == packedUpper >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t PF >
+struct IsResizable< PackedMatrix<T,SO,PF> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, size_t PF >
+struct SubmatrixTrait< PackedMatrix<T1,SO,PF> >
+{
+   using Type = DynamicMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, size_t PF >
+struct RowTrait< PackedMatrix<T1,SO,PF> >
+{
+   using Type = DynamicVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, size_t PF >
+struct ColumnTrait< PackedMatrix<T1,SO,PF> >
+{
+   using Type = DynamicVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -53,13 +52,22 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/lapack/geqrf.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/lapack/native/orgqr.h>
 #include <blaze/math/lapack/orgqr.h>
 #include <blaze/math/lapack/ungqr.h>
 #include <blaze/math/traits/DerestrictTrait.h>
+#include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/ArenaArray.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -79,6 +87,38 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param native \a true in case the native kernel is used, \a false for the LAPACK kernel.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
+// in-place QR decomposition of the given matrix by means of either the native kernel or the
+// LAPACK kernel.
+*/
+template< typename MT1 >  // Type of matrix A
+inline void geqrf_backend( MT1& A, ElementType_<MT1>* tau, bool native )
+{
+#if BLAZE_LAPACK_MODE
+   if( !native ) {
+      geqrf( A, tau );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( native );
+#endif
+
+   nativeGeqrf( A, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Auxiliary function for the QR decomposition.
@@ -86,6 +126,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 //
 // \param A The QR decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param native \a true in case the native kernel is used, \a false for the LAPACK kernel.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
@@ -93,9 +134,18 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
-   qr_backend( MT1& A, const ElementType_<MT1>* tau )
+   qr_backend( MT1& A, const ElementType_<MT1>* tau, bool native )
 {
-   orgqr( A, tau );
+#if BLAZE_LAPACK_MODE
+   if( !native ) {
+      orgqr( A, tau );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( native );
+#endif
+
+   nativeOrgqr( A, tau );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -108,6 +158,7 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 //
 // \param A The QR decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param native \a true in case the native kernel is used, \a false for the LAPACK kernel.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
@@ -115,9 +166,149 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
-   qr_backend( MT1& A, const ElementType_<MT1>* tau )
+   qr_backend( MT1& A, const ElementType_<MT1>* tau, bool native )
 {
-   ungqr( A, tau );
+#if BLAZE_LAPACK_MODE
+   if( !native ) {
+      ungqr( A, tau );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( native );
+#endif
+
+   nativeOrgqr( A, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param R The resulting \c R matrix.
+// \param tau Auxiliary array for the scalar factors of the elementary reflectors.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
+// QR decomposition of the given matrix \a A and writes the result to the two matrices \a Q
+// and \a R, which are expected to be checked for fitting dimensions.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix R
+        , bool SO3 >    // Storage order of matrix R
+void qr_decompose( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q,
+                   DenseMatrix<MT3,SO3>& R, ElementType_<MT1>* tau )
+{
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+
+   DerestrictTrait_<MT3> r( derestrict( ~R ) );
+
+   const bool native( !BLAZE_LAPACK_MODE || m*n < DECOMPOSITION_THRESHOLD );
+
+   if( m < n )
+   {
+      r = A;
+      geqrf_backend( r, tau, native );
+      (~Q) = submatrix( r, 0UL, 0UL, m, m );
+      qr_backend( ~Q, tau, native );
+
+      for( size_t i=1UL; i<m; ++i ) {
+         for( size_t j=0UL; j<i; ++j ) {
+            reset( r(i,j) );
+         }
+      }
+   }
+   else
+   {
+      (~Q) = A;
+      geqrf_backend( ~Q, tau, native );
+
+      resize( ~R, n, n );
+      reset( r );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            r(i,j) = (~Q)(i,j);
+         }
+      }
+
+      qr_backend( ~Q, tau, native );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition of a dense matrix with compile time
+//        dimensions.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param R The resulting \c R matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition of matrices with
+// compile time dimensions (as for instance StaticMatrix). The auxiliary array for the scalar
+// factors of the elementary reflectors is placed on the stack.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix R
+        , bool SO3 >    // Storage order of matrix R
+EnableIfTrue_< Rows<MT1>::value != 0UL && Columns<MT1>::value != 0UL >
+   qr_decompose( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R )
+{
+   constexpr size_t m( Rows<MT1>::value );
+   constexpr size_t n( Columns<MT1>::value );
+
+   ElementType_<MT1> tau[ m < n ? m : n ];
+
+   qr_decompose( ~A, ~Q, ~R, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition of a dense matrix with runtime dimensions.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param R The resulting \c R matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition of matrices with
+// runtime dimensions. The auxiliary array for the scalar factors of the elementary reflectors
+// is taken from the arena of the calling thread.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix R
+        , bool SO3 >    // Storage order of matrix R
+DisableIfTrue_< Rows<MT1>::value != 0UL && Columns<MT1>::value != 0UL >
+   qr_decompose( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R )
+{
+   ArenaArray< ElementType_<MT1> > tau( min( (~A).rows(), (~A).columns() ) );
+
+   qr_decompose( ~A, ~Q, ~R, tau.data() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -168,8 +359,10 @@ inline EnableIf_<IsComplex< ElementType_<MT1> > >
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), this function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error. Matrices with
+// less than blaze::DECOMPOSITION_THRESHOLD elements are always decomposed by the native kernels.
 */
 template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of matrix A
@@ -191,8 +384,6 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE( MT3 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT3> );
 
-   typedef ElementType_<MT1>  ET1;
-
    const size_t m( (~A).rows() );
    const size_t n( (~A).columns() );
    const size_t mindim( min( m, n ) );
@@ -206,38 +397,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
       BLAZE_THROW_INVALID_ARGUMENT( "Square matrix cannot be resized to min(m,n)-by-n" );
    }
 
-   const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
-   DerestrictTrait_<MT3> r( derestrict( ~R ) );
-
-   if( m < n )
-   {
-      r = A;
-      geqrf( r, tau.get() );
-      (~Q) = submatrix( r, 0UL, 0UL, m, m );
-      qr_backend( ~Q, tau.get() );
-
-      for( size_t i=1UL; i<m; ++i ) {
-         for( size_t j=0UL; j<i; ++j ) {
-            reset( r(i,j) );
-         }
-      }
-   }
-   else
-   {
-      (~Q) = A;
-      geqrf( ~Q, tau.get() );
-
-      resize( ~R, n, n );
-      reset( r );
-
-      for( size_t i=0UL; i<n; ++i ) {
-         for( size_t j=i; j<n; ++j ) {
-            r(i,j) = (~Q)(i,j);
-         }
-      }
-
-      qr_backend( ~Q, tau.get() );
-   }
+   qr_decompose( ~A, ~Q, ~R );
 }
 //*************************************************************************************************
 
@@ -0,0 +1,496 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SVD.h
+//  \brief Header file for the dense matrix singular value decomposition (SVD) functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SVD_H_
+#define _BLAZE_MATH_DENSE_SVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/gesdd.h>
+#include <blaze/math/lapack/gesvdx.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SINGULAR VALUE DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Singular value decomposition functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+          LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO, typename MT2, bool SO2, typename VT, bool TF
+        , typename MT3, bool SO3 >
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V );
+
+template< typename MT1, bool SO, typename MT2, bool SO2, typename VT, bool TF
+        , typename MT3, bool SO3 >
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V,
+          LapackWorkspace< ElementType_<MT1> >& ws );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+            LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO, typename MT2, bool SO2, typename VT, bool TF
+        , typename MT3, bool SO3, typename ST >
+size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+            DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V, ST low, ST upp );
+
+template< typename MT1, bool SO, typename MT2, bool SO2, typename VT, bool TF
+        , typename MT3, bool SO3, typename ST >
+size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+            DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V, ST low, ST upp,
+            LapackWorkspace< ElementType_<MT1> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the singular values of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of the given general \a m-by-\a n matrix \a A by
+// means of a divide and conquer algorithm. The \a min(m,n) singular values are returned in
+// descending order in the given vector \a s, which is resized to the correct size (if possible
+// and necessary).
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 50UL );
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   // ... Initialization of A
+
+   svd( A, s );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   svd( ~A, ~s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the singular values of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of the given general matrix (see the overload
+// without workspace for a detailed description). All auxiliary arrays and the copy of \a A are
+// taken from the given workspace \a ws. Therefore repeated computations for matrices of the same
+// size perform only a single LAPACK workspace query and no further memory allocation.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+          LapackWorkspace< ElementType_<MT> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typename LapackWorkspace< ElementType_<MT> >::MatrixType& B( ws.matrix( 0UL ) );
+
+   B = ~A;
+   gesdd( B, ~s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the thin singular value decomposition of the given general \a m-by-\a n
+// matrix \a A by means of a divide and conquer algorithm. The resulting decomposition has the form
+
+                              \f[ A = U \cdot S \cdot V, \f]
+
+// where \c S is a diagonal matrix containing the \a k = \a min(m,n) singular values in descending
+// order. The singular values are stored in the vector \a s, which is resized to \a k. \a U is
+// resized to \a m-by-\a k and contains the left singular vectors in its columns, \a V is resized
+// to \a k-by-\a n and contains the conjugate transposed right singular vectors in its rows.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 50UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor> U, V;
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   // ... Initialization of A
+
+   svd( A, U, s, V );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of the matrix A
+        , typename MT2  // Type of the matrix U
+        , bool SO2      // Storage order of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , bool SO3 >    // Storage order of the matrix V
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   svd( ~A, ~U, ~s, ~V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the thin singular value decomposition of the given general matrix (see
+// the overload without workspace for a detailed description). All auxiliary arrays and matrices
+// are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of the matrix A
+        , typename MT2  // Type of the matrix U
+        , bool SO2      // Storage order of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , bool SO3 >    // Storage order of the matrix V
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V,
+          LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   typedef typename LapackWorkspace< ElementType_<MT1> >::MatrixType  MatrixType;
+
+   MatrixType& B ( ws.matrix( 0UL ) );
+   MatrixType& UB( ws.matrix( 1UL ) );
+   MatrixType& VB( ws.matrix( 2UL ) );
+
+   B = ~A;
+   gesdd( B, UB, ~s, VB, 'S', ws );
+   ~U = UB;
+   ~V = VB;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected singular values of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values of the given general
+// \a m-by-\a n matrix \a A. The type of the two range arguments \a low and \a upp determines the
+// selected singular values:
+//
+//  - floating point arguments select all singular values in the half-open interval
+//    \f$(low..upp]\f$;
+//  - integral arguments select the singular values with the 0-based indices \f$[low..upp]\f$,
+//    where index 0 refers to the largest singular value.
+//
+// The selected singular values are returned in descending order in the given vector \a s, which
+// is resized to the number of computed singular values. This number is also returned by the
+// function.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 200UL );
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   // ... Initialization of A
+
+   svd( A, s, 0, 4 );      // Computes the five largest singular values
+   svd( A, s, 1.0, 2.0 );  // Computes all singular values in the interval (1..2]
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF      // Transpose flag of the vector s
+        , typename ST > // Type of the range bounds
+size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   return svd( ~A, ~s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of selected singular values of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values of the given general matrix
+// (see the overload without workspace for a detailed description). All auxiliary arrays and the
+// copy of \a A are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF      // Transpose flag of the vector s
+        , typename ST > // Type of the range bounds
+size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+            LapackWorkspace< ElementType_<MT> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typename LapackWorkspace< ElementType_<MT> >::MatrixType& B( ws.matrix( 0UL ) );
+
+   B = ~A;
+   return gesvdx( B, ~s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selected singular values and singular vectors of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values and the corresponding singular
+// vectors of the given general \a m-by-\a n matrix \a A. The selection of the singular values
+// works as described for the svd() overload without singular vectors. The \a k selected singular
+// values are returned in descending order in \a s, \a U is resized to \a m-by-\a k and contains
+// the corresponding left singular vectors in its columns, and \a V is resized to \a k-by-\a n and
+// contains the corresponding conjugate transposed right singular vectors in its rows. Thus the
+// product \f$ U \cdot diag(s) \cdot V \f$ is the best rank-\a k approximation of \a A in case
+// the \a k largest singular values are selected.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of the matrix A
+        , typename MT2  // Type of the matrix U
+        , bool SO2      // Storage order of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , bool SO3      // Storage order of the matrix V
+        , typename ST > // Type of the range bounds
+size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+            DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   return svd( ~A, ~U, ~s, ~V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selected singular values and singular vectors of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays and matrices.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values and singular vectors of the
+// given general matrix (see the overload without workspace for a detailed description). All
+// auxiliary arrays and matrices are taken from the given workspace \a ws.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of the matrix A
+        , typename MT2  // Type of the matrix U
+        , bool SO2      // Storage order of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , bool SO3      // Storage order of the matrix V
+        , typename ST > // Type of the range bounds
+size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO2>& U,
+            DenseVector<VT,TF>& s, DenseMatrix<MT3,SO3>& V, ST low, ST upp,
+            LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   typedef typename LapackWorkspace< ElementType_<MT1> >::MatrixType  MatrixType;
+
+   MatrixType& B ( ws.matrix( 0UL ) );
+   MatrixType& UB( ws.matrix( 1UL ) );
+   MatrixType& VB( ws.matrix( 2UL ) );
+
+   B = ~A;
+   const size_t k( gesvdx( B, UB, ~s, VB, low, upp, ws ) );
+   ~U = UB;
+   ~V = VB;
+
+   return k;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,487 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transpose.h
+//  \brief Header file for the dense matrix transposition kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REGISTER TILE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single register tile.
+// \ingroup math
+//
+// The TransposeTile class template provides the innermost kernel of the dense matrix
+// transposition. The \a apply() function transposes a square tile of \a size x \a size
+// elements of the matrix \a A (with spacing \a lda) into the matrix \a B (with spacing
+// \a ldb). The default implementation handles single elements, whereas the specializations
+// for single and double precision values transpose complete tiles within the SIMD registers.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct TransposeTile
+{
+   enum : size_t { size = 1UL };
+
+   static BLAZE_ALWAYS_INLINE void apply( const Type* A, size_t lda, Type* B, size_t ldb )
+   {
+      UNUSED_PARAMETER( lda, ldb );
+
+      *B = *A;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX_MODE
+template<>
+struct TransposeTile<float>
+{
+   enum : size_t { size = 8UL };
+
+   static BLAZE_ALWAYS_INLINE void apply( const float* A, size_t lda, float* B, size_t ldb )
+   {
+      const __m256 r0( _mm256_loadu_ps( A       ) );
+      const __m256 r1( _mm256_loadu_ps( A+  lda ) );
+      const __m256 r2( _mm256_loadu_ps( A+2*lda ) );
+      const __m256 r3( _mm256_loadu_ps( A+3*lda ) );
+      const __m256 r4( _mm256_loadu_ps( A+4*lda ) );
+      const __m256 r5( _mm256_loadu_ps( A+5*lda ) );
+      const __m256 r6( _mm256_loadu_ps( A+6*lda ) );
+      const __m256 r7( _mm256_loadu_ps( A+7*lda ) );
+
+      const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+      const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+      const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+      const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+      const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+      const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+      const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+      const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+      const __m256 s0( _mm256_shuffle_ps( t0, t2, 0x44 ) );
+      const __m256 s1( _mm256_shuffle_ps( t0, t2, 0xEE ) );
+      const __m256 s2( _mm256_shuffle_ps( t1, t3, 0x44 ) );
+      const __m256 s3( _mm256_shuffle_ps( t1, t3, 0xEE ) );
+      const __m256 s4( _mm256_shuffle_ps( t4, t6, 0x44 ) );
+      const __m256 s5( _mm256_shuffle_ps( t4, t6, 0xEE ) );
+      const __m256 s6( _mm256_shuffle_ps( t5, t7, 0x44 ) );
+      const __m256 s7( _mm256_shuffle_ps( t5, t7, 0xEE ) );
+
+      _mm256_storeu_ps( B      , _mm256_permute2f128_ps( s0, s4, 0x20 ) );
+      _mm256_storeu_ps( B+  ldb, _mm256_permute2f128_ps( s1, s5, 0x20 ) );
+      _mm256_storeu_ps( B+2*ldb, _mm256_permute2f128_ps( s2, s6, 0x20 ) );
+      _mm256_storeu_ps( B+3*ldb, _mm256_permute2f128_ps( s3, s7, 0x20 ) );
+      _mm256_storeu_ps( B+4*ldb, _mm256_permute2f128_ps( s0, s4, 0x31 ) );
+      _mm256_storeu_ps( B+5*ldb, _mm256_permute2f128_ps( s1, s5, 0x31 ) );
+      _mm256_storeu_ps( B+6*ldb, _mm256_permute2f128_ps( s2, s6, 0x31 ) );
+      _mm256_storeu_ps( B+7*ldb, _mm256_permute2f128_ps( s3, s7, 0x31 ) );
+   }
+};
+#elif BLAZE_SSE_MODE
+template<>
+struct TransposeTile<float>
+{
+   enum : size_t { size = 4UL };
+
+   static BLAZE_ALWAYS_INLINE void apply( const float* A, size_t lda, float* B, size_t ldb )
+   {
+      __m128 r0( _mm_loadu_ps( A       ) );
+      __m128 r1( _mm_loadu_ps( A+  lda ) );
+      __m128 r2( _mm_loadu_ps( A+2*lda ) );
+      __m128 r3( _mm_loadu_ps( A+3*lda ) );
+
+      _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+      _mm_storeu_ps( B      , r0 );
+      _mm_storeu_ps( B+  ldb, r1 );
+      _mm_storeu_ps( B+2*ldb, r2 );
+      _mm_storeu_ps( B+3*ldb, r3 );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX_MODE
+template<>
+struct TransposeTile<double>
+{
+   enum : size_t { size = 4UL };
+
+   static BLAZE_ALWAYS_INLINE void apply( const double* A, size_t lda, double* B, size_t ldb )
+   {
+      const __m256d r0( _mm256_loadu_pd( A       ) );
+      const __m256d r1( _mm256_loadu_pd( A+  lda ) );
+      const __m256d r2( _mm256_loadu_pd( A+2*lda ) );
+      const __m256d r3( _mm256_loadu_pd( A+3*lda ) );
+
+      const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+      const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+      const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+      const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+      _mm256_storeu_pd( B      , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+      _mm256_storeu_pd( B+  ldb, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+      _mm256_storeu_pd( B+2*ldb, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+      _mm256_storeu_pd( B+3*ldb, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+   }
+};
+#elif BLAZE_SSE2_MODE
+template<>
+struct TransposeTile<double>
+{
+   enum : size_t { size = 2UL };
+
+   static BLAZE_ALWAYS_INLINE void apply( const double* A, size_t lda, double* B, size_t ldb )
+   {
+      const __m128d r0( _mm_loadu_pd( A     ) );
+      const __m128d r1( _mm_loadu_pd( A+lda ) );
+
+      _mm_storeu_pd( B    , _mm_unpacklo_pd( r0, r1 ) );
+      _mm_storeu_pd( B+ldb, _mm_unpackhi_pd( r0, r1 ) );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUT-OF-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious transposition of a row-major array.
+// \ingroup math
+//
+// \param A Pointer to the first element of the \f$ m \times n \f$ source array.
+// \param lda The spacing between two rows of the source array.
+// \param B Pointer to the first element of the \f$ n \times m \f$ target array.
+// \param ldb The spacing between two rows of the target array.
+// \param m The number of rows of the source array.
+// \param n The number of columns of the source array.
+// \return void
+//
+// This function computes \f$ B(j,i) = A(i,j) \f$ by recursively splitting the larger of the
+// two dimensions until the remaining block fits into the L1 cache. The blocks are processed by
+// means of the register tile kernels of the TransposeTile class template. The two arrays must
+// not overlap.
+*/
+template< typename Type >  // Data type of the array elements
+void transpose_backend( const Type* A, size_t lda, Type* B, size_t ldb, size_t m, size_t n )
+{
+   constexpr size_t TS   ( TransposeTile<Type>::size );
+   constexpr size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   if( m > block || n > block )
+   {
+      if( m >= n ) {
+         const size_t m1( ( ( m / 2UL ) + TS - 1UL ) / TS * TS );
+         transpose_backend( A        , lda, B     , ldb, m1  , n );
+         transpose_backend( A+m1*lda , lda, B+m1  , ldb, m-m1, n );
+      }
+      else {
+         const size_t n1( ( ( n / 2UL ) + TS - 1UL ) / TS * TS );
+         transpose_backend( A   , lda, B       , ldb, m, n1   );
+         transpose_backend( A+n1, lda, B+n1*ldb, ldb, m, n-n1 );
+      }
+      return;
+   }
+
+   size_t i( 0UL );
+
+   for( ; (i+TS) <= m; i+=TS )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+TS) <= n; j+=TS ) {
+         TransposeTile<Type>::apply( A+i*lda+j, lda, B+j*ldb+i, ldb );
+      }
+      for( ; j<n; ++j ) {
+         for( size_t k=i; k<i+TS; ++k ) {
+            B[j*ldb+k] = A[k*lda+j];
+         }
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B[j*ldb+i] = A[i*lda+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of a dense matrix to a dense matrix with opposite storage order.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function performs the assignment \f$ lhs = rhs \f$ between two dense matrices with
+// opposite storage order, which in memory corresponds to a transposition of the underlying
+// arrays. Both matrices are required to provide low-level data access and to have the same
+// element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO       // Storage order of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void transposeAssign( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t m( SO ? (~rhs).rows() : (~rhs).columns() );
+   const size_t n( SO ? (~rhs).columns() : (~rhs).rows() );
+
+   transpose_backend( (~rhs).data(), (~rhs).spacing(), (~lhs).data(), (~lhs).spacing(), m, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a square row-major array.
+// \ingroup math
+//
+// \param A Pointer to the first element of the \f$ n \times n \f$ array.
+// \param n The number of rows and columns of the array.
+// \param lda The spacing between two rows of the array.
+// \return void
+//
+// This function transposes the given square array in-place. Each pair of mirrored blocks is
+// exchanged by transposing one block into a small buffer, the second block into the place of
+// the first one and finally copying the buffer into the place of the second block.
+*/
+template< typename Type >  // Data type of the array elements
+void transposeInPlace_backend( Type* A, size_t n, size_t lda )
+{
+   constexpr size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   Type buffer[block*block];
+
+   for( size_t ii=0UL; ii<n; ii+=block )
+   {
+      const size_t ibs( min( block, n-ii ) );
+
+      transpose_backend( A+ii*lda+ii, lda, buffer, block, ibs, ibs );
+      for( size_t i=0UL; i<ibs; ++i ) {
+         std::copy( buffer+i*block, buffer+i*block+ibs, A+(ii+i)*lda+ii );
+      }
+
+      for( size_t jj=ii+block; jj<n; jj+=block )
+      {
+         const size_t jbs( min( block, n-jj ) );
+
+         Type* X( A+ii*lda+jj );  // The ibs x jbs block above the diagonal
+         Type* Y( A+jj*lda+ii );  // The jbs x ibs block below the diagonal
+
+         transpose_backend( X, lda, buffer, block, ibs, jbs );
+         transpose_backend( Y, lda, X, lda, jbs, ibs );
+         for( size_t j=0UL; j<jbs; ++j ) {
+            std::copy( buffer+j*block, buffer+j*block+ibs, Y+j*lda );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a general row-major array.
+// \ingroup math
+//
+// \param A Pointer to the first element of the \f$ m \times n \f$ array.
+// \param m The number of rows of the array.
+// \param n The number of columns of the array.
+// \param lda The spacing between two rows of the given array.
+// \param ldb The spacing between two rows of the transposed \f$ n \times m \f$ array.
+// \return void
+//
+// This function transposes the given array in-place, i.e. without a temporary copy of the
+// array. The memory referenced by \a A must be large enough to hold both \f$ m \cdot lda \f$
+// and \f$ n \cdot ldb \f$ elements. Square arrays with identical spacing are transposed via
+// block exchanges. In all other cases the padding elements are removed first. With \f$ g \f$
+// denoting the greatest common divisor of \a m and \a n, the compacted array is interpreted as
+// a grid of \f$ g \times g \f$ blocks, which are transposed individually. The remaining
+// permutation moves contiguous chunks of \f$ g \f$ elements and is performed by following its
+// cycles, which requires one bit per chunk and a buffer for a single chunk. Finally the rows
+// of the result are spread out to the new spacing and all padding elements are reset to their
+// default value.
+*/
+template< typename Type >  // Data type of the array elements
+void transposeInPlace_backend( Type* A, size_t m, size_t n, size_t lda, size_t ldb )
+{
+   BLAZE_INTERNAL_ASSERT( lda >= n, "Invalid spacing of the source array" );
+   BLAZE_INTERNAL_ASSERT( ldb >= m, "Invalid spacing of the target array" );
+
+   if( m == n && lda == ldb ) {
+      transposeInPlace_backend( A, n, lda );
+      return;
+   }
+
+   if( lda != n ) {
+      for( size_t i=1UL; i<m; ++i ) {
+         std::move( A+i*lda, A+i*lda+n, A+i*n );
+      }
+   }
+
+   if( m > 1UL && n > 1UL )
+   {
+      size_t g( m ), r( n );
+      while( r != 0UL ) {
+         const size_t tmp( g % r );
+         g = r;
+         r = tmp;
+      }
+
+      const size_t a( m / g );
+      const size_t b( n / g );
+
+      if( g > 1UL ) {
+         for( size_t ii=0UL; ii<m; ii+=g ) {
+            for( size_t jj=0UL; jj<n; jj+=g ) {
+               transposeInPlace_backend( A+ii*n+jj, g, n );
+            }
+         }
+      }
+
+      const size_t chunks( a*g*b );
+      std::vector<bool> moved( chunks, false );
+      std::unique_ptr<Type[]> buffer( new Type[g] );
+
+      // The chunk at position t of the result is row jj of the transposed block (ai,bj)
+      const auto source = [a,b,g]( size_t t ) {
+         const size_t ai( t % a );
+         const size_t jj( ( t / a ) % g );
+         const size_t bj( t / ( a*g ) );
+         return ( ai*g + jj )*b + bj;
+      };
+
+      for( size_t start=0UL; start<chunks; ++start )
+      {
+         if( moved[start] ) continue;
+
+         moved[start] = true;
+
+         size_t k( start );
+         size_t next( source( k ) );
+
+         if( next == start ) continue;
+
+         std::move( A+start*g, A+(start+1UL)*g, buffer.get() );
+
+         while( next != start ) {
+            std::move( A+next*g, A+(next+1UL)*g, A+k*g );
+            k = next;
+            moved[k] = true;
+            next = source( k );
+         }
+
+         std::move( buffer.get(), buffer.get()+g, A+k*g );
+      }
+   }
+
+   if( ldb != m && n > 0UL ) {
+      for( size_t i=n-1UL; i>0UL; --i ) {
+         std::move_backward( A+i*m, A+(i+1UL)*m, A+i*ldb+m );
+      }
+      for( size_t i=0UL; i<n; ++i ) {
+         std::fill( A+i*ldb+m, A+(i+1UL)*ldb, Type() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
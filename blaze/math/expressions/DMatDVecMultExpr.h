@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/MixedPrecision.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -65,6 +66,7 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMaskedAccess.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
@@ -202,6 +204,103 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type provides direct access to its single precision elements and both
+       vector types are double precision vector types, the nested \a value will be set to 1 and
+       the mixed-precision kernels are selected. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            !IsDiagonal<T2>::value &&
+                            HasSIMDAdd<double,double>::value && HasSIMDMult<double,double>::value &&
+                            HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value &&
+                            IsFloat< ElementType_<T2> >::value &&
+                            IsDouble< ElementType_<T3> >::value &&
+                            IsDouble< ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the right-hand side vector type provide direct access to
+       their elements and support masked SIMD loads (see the HasSIMDMaskedAccess type trait),
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseMaskedRemainder {
+      enum : bool { value = HasConstDataAccess<T1>::value && HasConstDataAccess<T2>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            HasSIMDMaskedAccess< ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Masked load of the remaining elements of a row of the given dense matrix.
+   //
+   // \param A The dense matrix operand.
+   // \param i The row index of the loaded elements.
+   // \param j The column index of the first loaded element.
+   // \param n The number of loaded elements \f$[1..SIMDSIZE]\f$.
+   // \return The loaded elements, padded with zeros.
+   */
+   template< typename MT1 >  // Type of the matrix operand
+   static inline EnableIf_< HasConstDataAccess<MT1>, SIMDTrait_< ElementType_<MT1> > >
+      maskedLoad( const MT1& A, size_t i, size_t j, size_t n ) noexcept
+   {
+      return maskloadu( A.data(i) + j, n );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Masked load of the remaining elements of the given dense vector.
+   //
+   // \param x The dense vector operand.
+   // \param j The index of the first loaded element.
+   // \param n The number of loaded elements \f$[1..SIMDSIZE]\f$.
+   // \return The loaded elements, padded with zeros.
+   */
+   template< typename VT2 >  // Type of the vector operand
+   static inline EnableIf_< HasConstDataAccess<VT2>, SIMDTrait_< ElementType_<VT2> > >
+      maskedLoad( const VT2& x, size_t j, size_t n ) noexcept
+   {
+      return maskloadu( x.data() + j, n );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fallback for matrix operands without direct element access (never called).
+   */
+   template< typename MT1 >  // Type of the matrix operand
+   static inline DisableIf_< HasConstDataAccess<MT1>, SIMDTrait_< ElementType_<MT1> > >
+      maskedLoad( const MT1& /*A*/, size_t /*i*/, size_t /*j*/, size_t /*n*/ ) noexcept
+   {
+      return SIMDTrait_< ElementType_<MT1> >();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fallback for vector operands without direct element access (never called).
+   */
+   template< typename VT2 >  // Type of the vector operand
+   static inline DisableIf_< HasConstDataAccess<VT2>, SIMDTrait_< ElementType_<VT2> > >
+      maskedLoad( const VT2& /*x*/, size_t /*j*/, size_t /*n*/ ) noexcept
+   {
+      return SIMDTrait_< ElementType_<VT2> >();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -440,7 +539,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -452,6 +552,31 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed-precision assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed-precision assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      mpgemv( y, A, x, 1.0, 0.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense vector multiplication
@@ -565,6 +690,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+6UL] = sum( xmm7 );
          y[i+7UL] = sum( xmm8 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -606,6 +745,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+2UL] = sum( xmm3 );
          y[i+3UL] = sum( xmm4 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -641,6 +790,15 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+1UL] = sum( xmm2 );
          y[i+2UL] = sum( xmm3 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -673,6 +831,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i    ] = sum( xmm1 );
          y[i+1UL] = sum( xmm2 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -701,6 +867,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          y[i] = sum( xmm1 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j];
          }
@@ -822,6 +995,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -881,6 +1068,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -930,6 +1127,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -974,6 +1179,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i] += sum( A.load(i,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j];
          }
@@ -1123,7 +1335,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1135,6 +1348,31 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed-precision addition assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed-precision addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      mpgemv( y, A, x, 1.0, 1.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
@@ -1248,6 +1486,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+6UL] += sum( xmm7 );
          y[i+7UL] += sum( xmm8 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1289,6 +1541,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+2UL] += sum( xmm3 );
          y[i+3UL] += sum( xmm4 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1324,6 +1586,15 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+1UL] += sum( xmm2 );
          y[i+2UL] += sum( xmm3 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1356,6 +1627,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i    ] += sum( xmm1 );
          y[i+1UL] += sum( xmm2 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1384,6 +1663,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          y[i] += sum( xmm1 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j];
          }
@@ -1503,6 +1789,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1562,6 +1862,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1611,6 +1921,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -1655,6 +1973,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i] += sum( A.load(i,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j];
          }
@@ -1779,7 +2104,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1791,6 +2117,31 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed-precision subtraction assignment to dense vectors**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed-precision subtraction assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      mpgemv( y, A, x, -1.0, 1.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
@@ -1904,6 +2255,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+6UL] -= sum( xmm7 );
          y[i+7UL] -= sum( xmm8 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] -= sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] -= sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] -= sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] -= sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -1945,6 +2310,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+2UL] -= sum( xmm3 );
          y[i+3UL] -= sum( xmm4 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -1980,6 +2355,15 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i+1UL] -= sum( xmm2 );
          y[i+2UL] -= sum( xmm3 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -2012,6 +2396,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          y[i    ] -= sum( xmm1 );
          y[i+1UL] -= sum( xmm2 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -2040,6 +2432,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          y[i] -= sum( xmm1 );
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] -= sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] -= A(i,j) * x[j];
          }
@@ -2159,6 +2558,20 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+7UL] -= sum( A.load(i+7UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] -= sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] -= sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] -= sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] -= sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -2218,6 +2631,16 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+3UL] -= sum( A.load(i+3UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -2267,6 +2690,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i+1UL] -= sum( A.load(i+1UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j];
             y[i+1UL] -= A(i+1UL,j) * x[j];
@@ -2311,6 +2742,13 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
             y[i] -= sum( A.load(i,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] -= sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] -= A(i,j) * x[j];
          }
@@ -2802,6 +3240,91 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type provides direct access to its single precision elements and both
+       vector types are double precision vector types, the nested \a value will be set to 1 and
+       the mixed-precision kernels are selected. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            !IsDiagonal<T2>::value &&
+                            HasSIMDAdd<double,double>::value && HasSIMDMult<double,double>::value &&
+                            HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value &&
+                            IsFloat< ElementType_<T2> >::value &&
+                            IsDouble< ElementType_<T3> >::value &&
+                            IsDouble< ElementType_<T1> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the right-hand side vector type provide direct access to
+       their elements and support masked SIMD loads (see the HasSIMDMaskedAccess type trait),
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseMaskedRemainder {
+      enum : bool { value = HasConstDataAccess<T1>::value && HasConstDataAccess<T2>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            HasSIMDMaskedAccess< ElementType_<T1> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Masked load of the remaining elements of a row of the given dense matrix.
+   //
+   // \param A The dense matrix operand.
+   // \param i The row index of the loaded elements.
+   // \param j The column index of the first loaded element.
+   // \param n The number of loaded elements \f$[1..SIMDSIZE]\f$.
+   // \return The loaded elements, padded with zeros.
+   */
+   template< typename MT1 >  // Type of the matrix operand
+   static inline EnableIf_< HasConstDataAccess<MT1>, SIMDTrait_< ElementType_<MT1> > >
+      maskedLoad( const MT1& A, size_t i, size_t j, size_t n ) noexcept
+   {
+      return maskloadu( A.data(i) + j, n );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Masked load of the remaining elements of the given dense vector.
+   //
+   // \param x The dense vector operand.
+   // \param j The index of the first loaded element.
+   // \param n The number of loaded elements \f$[1..SIMDSIZE]\f$.
+   // \return The loaded elements, padded with zeros.
+   */
+   template< typename VT2 >  // Type of the vector operand
+   static inline EnableIf_< HasConstDataAccess<VT2>, SIMDTrait_< ElementType_<VT2> > >
+      maskedLoad( const VT2& x, size_t j, size_t n ) noexcept
+   {
+      return maskloadu( x.data() + j, n );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Fallback for matrix operands without direct element access (never called).
+   */
+   template< typename MT1 >  // Type of the matrix operand
+   static inline DisableIf_< HasConstDataAccess<MT1>, SIMDTrait_< ElementType_<MT1> > >
+      maskedLoad( const MT1& /*A*/, size_t /*i*/, size_t /*j*/, size_t /*n*/ ) noexcept
+   {
+      return SIMDTrait_< ElementType_<MT1> >();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Fallback for vector operands without direct element access (never called).
+   */
+   template< typename VT2 >  // Type of the vector operand
+   static inline DisableIf_< HasConstDataAccess<VT2>, SIMDTrait_< ElementType_<VT2> > >
+      maskedLoad( const VT2& /*x*/, size_t /*j*/, size_t /*n*/ ) noexcept
+   {
+      return SIMDTrait_< ElementType_<VT2> >();
+   }
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DVecScalarMultExpr<MVM,ST,false>  This;           //!< Type of this DVecScalarMultExpr instance.
@@ -3023,7 +3546,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3034,6 +3558,31 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed-precision assignment to dense vectors**************************************************
+   /*!\brief Mixed-precision assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      mpgemv( y, A, x, static_cast<double>( scalar ), 0.0 );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3149,6 +3698,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+6UL] = sum( xmm7 ) * scalar;
          y[i+7UL] = sum( xmm8 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 ) * scalar;
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 ) * scalar;
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 ) * scalar;
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3190,6 +3753,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+2UL] = sum( xmm3 ) * scalar;
          y[i+3UL] = sum( xmm4 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3225,6 +3798,15 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+1UL] = sum( xmm2 ) * scalar;
          y[i+2UL] = sum( xmm3 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3257,6 +3839,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i    ] = sum( xmm1 ) * scalar;
          y[i+1UL] = sum( xmm2 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3285,6 +3875,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          y[i] = sum( xmm1 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j] * scalar;
          }
@@ -3406,6 +4003,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 );
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 );
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 );
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -3474,6 +4085,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 );
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -3528,6 +4149,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 );
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j];
             y[i+1UL] += A(i+1UL,j) * x[j];
@@ -3575,6 +4204,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i] += sum( A.load(i,j) * x1 );
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 );
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j];
          }
@@ -3725,7 +4361,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3736,6 +4373,31 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed-precision addition assignment to dense vectors*****************************************
+   /*!\brief Mixed-precision addition assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      mpgemv( y, A, x, static_cast<double>( scalar ), 1.0 );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*!\brief Default addition assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
@@ -3850,6 +4512,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+6UL] += sum( xmm7 ) * scalar;
          y[i+7UL] += sum( xmm8 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 ) * scalar;
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 ) * scalar;
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 ) * scalar;
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3891,6 +4567,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+2UL] += sum( xmm3 ) * scalar;
          y[i+3UL] += sum( xmm4 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3926,6 +4612,15 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+1UL] += sum( xmm2 ) * scalar;
          y[i+2UL] += sum( xmm3 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3958,6 +4653,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i    ] += sum( xmm1 ) * scalar;
          y[i+1UL] += sum( xmm2 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -3986,6 +4689,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          y[i] += sum( xmm1 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j] * scalar;
          }
@@ -4105,6 +4815,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+7UL] += sum( A.load(i+7UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            y[i+4UL] += sum( maskedLoad( A, i+4UL, j, rest ) * x1 ) * scalar;
+            y[i+5UL] += sum( maskedLoad( A, i+5UL, j, rest ) * x1 ) * scalar;
+            y[i+6UL] += sum( maskedLoad( A, i+6UL, j, rest ) * x1 ) * scalar;
+            y[i+7UL] += sum( maskedLoad( A, i+7UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -4164,6 +4888,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+3UL] += sum( A.load(i+3UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] += sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] += sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -4213,6 +4947,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+1UL] += sum( A.load(i+1UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] += sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] += sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] += A(i    ,j) * x[j] * scalar;
             y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
@@ -4257,6 +4999,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i] += sum( A.load(i,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] += sum( maskedLoad( A, i, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] += A(i,j) * x[j] * scalar;
          }
@@ -4382,7 +5131,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -4393,6 +5143,31 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed-precision subtraction assignment to dense vectors**************************************
+   /*!\brief Mixed-precision subtraction assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays the multiplication of a single precision matrix and a double
+   // precision vector to the mixed-precision kernel (see the mpgemv() function).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      mpgemv( y, A, x, -static_cast<double>( scalar ), 1.0 );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*!\brief Default subtraction assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
@@ -4507,6 +5282,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+6UL] -= sum( xmm7 ) * scalar;
          y[i+7UL] -= sum( xmm8 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            y[i+4UL] -= sum( maskedLoad( A, i+4UL, j, rest ) * x1 ) * scalar;
+            y[i+5UL] -= sum( maskedLoad( A, i+5UL, j, rest ) * x1 ) * scalar;
+            y[i+6UL] -= sum( maskedLoad( A, i+6UL, j, rest ) * x1 ) * scalar;
+            y[i+7UL] -= sum( maskedLoad( A, i+7UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4548,6 +5337,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+2UL] -= sum( xmm3 ) * scalar;
          y[i+3UL] -= sum( xmm4 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4583,6 +5382,15 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i+1UL] -= sum( xmm2 ) * scalar;
          y[i+2UL] -= sum( xmm3 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4615,6 +5423,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          y[i    ] -= sum( xmm1 ) * scalar;
          y[i+1UL] -= sum( xmm2 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4643,6 +5459,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          y[i] -= sum( xmm1 ) * scalar;
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] -= sum( maskedLoad( A, i, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] -= A(i,j) * x[j] * scalar;
          }
@@ -4762,6 +5585,20 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+7UL] -= sum( A.load(i+7UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            y[i+4UL] -= sum( maskedLoad( A, i+4UL, j, rest ) * x1 ) * scalar;
+            y[i+5UL] -= sum( maskedLoad( A, i+5UL, j, rest ) * x1 ) * scalar;
+            y[i+6UL] -= sum( maskedLoad( A, i+6UL, j, rest ) * x1 ) * scalar;
+            y[i+7UL] -= sum( maskedLoad( A, i+7UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4821,6 +5658,16 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+3UL] -= sum( A.load(i+3UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            y[i+2UL] -= sum( maskedLoad( A, i+2UL, j, rest ) * x1 ) * scalar;
+            y[i+3UL] -= sum( maskedLoad( A, i+3UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4870,6 +5717,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i+1UL] -= sum( A.load(i+1UL,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i    ] -= sum( maskedLoad( A, i    , j, rest ) * x1 ) * scalar;
+            y[i+1UL] -= sum( maskedLoad( A, i+1UL, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i    ] -= A(i    ,j) * x[j] * scalar;
             y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
@@ -4914,6 +5769,13 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
             y[i] -= sum( A.load(i,j) * x1 ) * scalar;
          }
 
+         if( UseMaskedRemainder<MT1,VT2>::value && remainder && j<jend ) {
+            const size_t rest( jend - j );
+            const SIMDTrait_< ElementType_<VT2> > x1( maskedLoad( x, j, rest ) );
+            y[i] -= sum( maskedLoad( A, i, j, rest ) * x1 ) * scalar;
+            j = jend;
+         }
+
          for( ; remainder && j<jend; ++j ) {
             y[i] -= A(i,j) * x[j] * scalar;
          }
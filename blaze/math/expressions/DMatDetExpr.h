@@ -40,13 +40,10 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <boost/cast.hpp>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/BLASCompatible.h>
-#include <blaze/math/constraints/DenseMatrix.h>
-#include <blaze/math/constraints/MutableDataAccess.h>
-#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/CustomMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
@@ -54,7 +51,7 @@
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
-#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Types.h>
 
@@ -317,7 +314,8 @@ inline ElementType_<MT> det6x6( const DenseMatrix<MT,SO>& dm )
 // \return The determinant of the given matrix.
 //
 // This function computes the determinant of the given dense square matrix via an LU decomposition
-// of the matrix.
+// of the matrix. The copy of the matrix and the pivot indices are stored in the arena of the
+// calling thread (see the Arena class).
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
@@ -325,24 +323,22 @@ ElementType_<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~dm ), "Non-square symmetric matrix detected" );
 
-   typedef ResultType_<MT>     RT;
-   typedef ElementType_<MT>    ET;
-   typedef RemoveAdaptor_<RT>  URT;
+   typedef ElementType_<MT>                          ET;
+   typedef CustomMatrix<ET,unaligned,unpadded,SO>  TmpType;
 
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( URT );
-   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( URT );
-   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( URT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
 
-   URT A( ~dm );
+   ArenaArray<ET> memory( (~dm).rows() * (~dm).columns() );
+   TmpType A( memory.data(), (~dm).rows(), (~dm).columns() );
+   A = ~dm;
 
    int n   ( boost::numeric_cast<int>( A.rows()      ) );
    int lda ( boost::numeric_cast<int>( A.spacing() ) );
    int info( 0 );
 
-   const std::unique_ptr<int[]> ipiv( new int[n] );
+   ArenaArray<int> ipiv( n );
 
-   getrf( n, n, A.data(), lda, ipiv.get(), &info );
+   getrf( n, n, A.data(), lda, ipiv.data(), &info );
 
    if( info > 0 ) {
       return ET(0);
@@ -0,0 +1,1303 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix reduction operation.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense matrix expression.
+   typedef RemoveReference_< CompositeType_<MT> >  CT;
+
+   //! Element type of the dense matrix expression.
+   typedef ElementType_<CT>  ET;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD capabilities of the given reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+
+   //! Helper structure for the detection of the SIMD capabilities of the dense matrix expression.
+   /*! In case the dense matrix expression is SIMD-enabled, \a value is set to 1 if the SIMD type
+       returned by the load() function matches the SIMD type of the element type. */
+   struct HasMatchingSIMDType {
+      enum : bool { value = IsSame< SIMDTrait_<ET>, Decay_< decltype( std::declval<CT&>().load( 0UL, 0UL ) ) > >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         If_< Bool< CT::simdEnabled >, HasMatchingSIMDType, FalseType >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the row-wise and column-wise dense matrix reduction operation.
+// \ingroup dense_matrix
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatPartialReduceExprHelper
+{
+   //**********************************************************************************************
+   enum : bool { value = DMatReduceExprHelper<MT,OP>::value &&
+                         VT::simdEnabled &&
+                         IsSame< ElementType_<VT>, ElementType_<MT> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TOTAL REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the total reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default (i.e. single-threaded and non-vectorized) reduction of
+// all elements of the given dense matrix. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of reduction operations. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+// Instead of using this function use the reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   ET redux( A(0UL,0UL) );
+
+   if( SO == rowMajor ) {
+      for( size_t j=1UL; j<N; ++j )
+         redux = op( redux, A(0UL,j) );
+      for( size_t i=1UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            redux = op( redux, A(i,j) );
+   }
+   else {
+      for( size_t i=1UL; i<M; ++i )
+         redux = op( redux, A(i,0UL) );
+      for( size_t j=1UL; j<N; ++j )
+         for( size_t i=0UL; i<M; ++i )
+            redux = op( redux, A(i,j) );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the total reduction of a row-major dense
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the single-threaded, vectorized reduction of all elements of the
+// given row-major dense matrix. Each row is reduced by means of up to four independent SIMD
+// accumulators, the row results are combined in a single SIMD accumulator, which is reduced
+// horizontally at the very end. The elements beyond the last full SIMD vector of each row are
+// reduced separately, i.e. the reduction does not rely on the padding elements. This function
+// must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of reduction operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( jpos == 0UL ) {
+      ET redux( A(0UL,0UL) );
+      for( size_t j=1UL; j<N; ++j )
+         redux = op( redux, A(0UL,j) );
+      for( size_t i=1UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            redux = op( redux, A(i,j) );
+      return redux;
+   }
+
+   SIMDType xmm;
+   ET rest = ET();
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      SIMDType xmm1( A.load(i,0UL) );
+      size_t j( SIMDSIZE );
+
+      if( jpos >= SIMDSIZE*4UL )
+      {
+         SIMDType xmm2( A.load(i,SIMDSIZE    ) );
+         SIMDType xmm3( A.load(i,SIMDSIZE*2UL) );
+         SIMDType xmm4( A.load(i,SIMDSIZE*3UL) );
+
+         for( j=SIMDSIZE*4UL; (j+SIMDSIZE*4UL) <= jpos; j+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, A.load(i,j             ) );
+            xmm2 = op.load( xmm2, A.load(i,j+SIMDSIZE    ) );
+            xmm3 = op.load( xmm3, A.load(i,j+SIMDSIZE*2UL) );
+            xmm4 = op.load( xmm4, A.load(i,j+SIMDSIZE*3UL) );
+         }
+
+         xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         xmm1 = op.load( xmm1, A.load(i,j) );
+      }
+
+      if( i == 0UL ) {
+         xmm = xmm1;
+      }
+      else {
+         xmm = op.load( xmm, xmm1 );
+      }
+
+      if( j < N ) {
+         if( i == 0UL ) {
+            rest = A(0UL,j);
+            ++j;
+         }
+         for( ; j<N; ++j ) {
+            rest = op( rest, A(i,j) );
+         }
+      }
+   }
+
+   ET redux( reduce( xmm, op ) );
+
+   if( jpos < N ) {
+      redux = op( redux, rest );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the total reduction of a column-major dense
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the single-threaded, vectorized reduction of all elements of the
+// given column-major dense matrix. Each column is reduced by means of up to four independent
+// SIMD accumulators, the column results are combined in a single SIMD accumulator, which is
+// reduced horizontally at the very end. The elements beyond the last full SIMD vector of each
+// column are reduced separately, i.e. the reduction does not rely on the padding elements.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( ipos == 0UL ) {
+      ET redux( A(0UL,0UL) );
+      for( size_t i=1UL; i<M; ++i )
+         redux = op( redux, A(i,0UL) );
+      for( size_t j=1UL; j<N; ++j )
+         for( size_t i=0UL; i<M; ++i )
+            redux = op( redux, A(i,j) );
+      return redux;
+   }
+
+   SIMDType xmm;
+   ET rest = ET();
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      SIMDType xmm1( A.load(0UL,j) );
+      size_t i( SIMDSIZE );
+
+      if( ipos >= SIMDSIZE*4UL )
+      {
+         SIMDType xmm2( A.load(SIMDSIZE    ,j) );
+         SIMDType xmm3( A.load(SIMDSIZE*2UL,j) );
+         SIMDType xmm4( A.load(SIMDSIZE*3UL,j) );
+
+         for( i=SIMDSIZE*4UL; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, A.load(i             ,j) );
+            xmm2 = op.load( xmm2, A.load(i+SIMDSIZE    ,j) );
+            xmm3 = op.load( xmm3, A.load(i+SIMDSIZE*2UL,j) );
+            xmm4 = op.load( xmm4, A.load(i+SIMDSIZE*3UL,j) );
+         }
+
+         xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+      }
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         xmm1 = op.load( xmm1, A.load(i,j) );
+      }
+
+      if( j == 0UL ) {
+         xmm = xmm1;
+      }
+      else {
+         xmm = op.load( xmm, xmm1 );
+      }
+
+      if( i < M ) {
+         if( j == 0UL ) {
+            rest = A(i,0UL);
+            ++i;
+         }
+         for( ; i<M; ++i ) {
+            rest = op( rest, A(i,j) );
+         }
+      }
+   }
+
+   ET redux( reduce( xmm, op ) );
+
+   if( ipos < M ) {
+      redux = op( redux, rest );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW-WISE REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the row-wise reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param y The target column vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the default (i.e. single-threaded and non-vectorized) row-wise
+// reduction of the given dense matrix, i.e. the reduction result of the \a i-th row is stored
+// in the \a i-th element of the column vector \a y. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of reduction
+// operations. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,columnVector>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   typedef CompositeType_<MT>  CT;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).rows(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( N == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( SO == rowMajor ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         ElementType_<VT> redux( A(i,0UL) );
+         for( size_t j=1UL; j<N; ++j )
+            redux = op( redux, A(i,j) );
+         (~y)[i] = redux;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<M; ++i )
+         (~y)[i] = A(i,0UL);
+      for( size_t j=1UL; j<N; ++j )
+         for( size_t i=0UL; i<M; ++i )
+            (~y)[i] = op( (~y)[i], A(i,j) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the row-wise reduction of a row-major dense
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param y The target column vector for the reduction results.
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the single-threaded, vectorized row-wise reduction of the given
+// row-major dense matrix. Each row is reduced by means of up to four independent SIMD
+// accumulators, which are reduced horizontally at the end of the row. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of reduction operations. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,columnVector>& y, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).rows(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( N == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      size_t j( 0UL );
+      ET redux;
+
+      if( jpos > 0UL )
+      {
+         SIMDType xmm1( A.load(i,0UL) );
+         j = SIMDSIZE;
+
+         if( jpos >= SIMDSIZE*4UL )
+         {
+            SIMDType xmm2( A.load(i,SIMDSIZE    ) );
+            SIMDType xmm3( A.load(i,SIMDSIZE*2UL) );
+            SIMDType xmm4( A.load(i,SIMDSIZE*3UL) );
+
+            for( j=SIMDSIZE*4UL; (j+SIMDSIZE*4UL) <= jpos; j+=SIMDSIZE*4UL ) {
+               xmm1 = op.load( xmm1, A.load(i,j             ) );
+               xmm2 = op.load( xmm2, A.load(i,j+SIMDSIZE    ) );
+               xmm3 = op.load( xmm3, A.load(i,j+SIMDSIZE*2UL) );
+               xmm4 = op.load( xmm4, A.load(i,j+SIMDSIZE*3UL) );
+            }
+
+            xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, A.load(i,j) );
+         }
+
+         redux = reduce( xmm1, op );
+      }
+      else {
+         redux = A(i,0UL);
+         j = 1UL;
+      }
+
+      for( ; j<N; ++j ) {
+         redux = op( redux, A(i,j) );
+      }
+
+      (~y)[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the row-wise reduction of a column-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param y The target column vector for the reduction results.
+// \param dm The given column-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the single-threaded, vectorized row-wise reduction of the given
+// column-major dense matrix. Since the elements of a row are distributed over all columns,
+// the kernel combines the columns element-wise in up to four SIMD accumulators (i.e. for up
+// to four SIMD vectors of rows at once) and thus does not require any horizontal reduction.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,columnVector>& y, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).rows(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( N == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL )
+   {
+      SIMDType xmm1( A.load(i             ,0UL) );
+      SIMDType xmm2( A.load(i+SIMDSIZE    ,0UL) );
+      SIMDType xmm3( A.load(i+SIMDSIZE*2UL,0UL) );
+      SIMDType xmm4( A.load(i+SIMDSIZE*3UL,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         xmm1 = op.load( xmm1, A.load(i             ,j) );
+         xmm2 = op.load( xmm2, A.load(i+SIMDSIZE    ,j) );
+         xmm3 = op.load( xmm3, A.load(i+SIMDSIZE*2UL,j) );
+         xmm4 = op.load( xmm4, A.load(i+SIMDSIZE*3UL,j) );
+      }
+
+      (~y).store( i             , xmm1 );
+      (~y).store( i+SIMDSIZE    , xmm2 );
+      (~y).store( i+SIMDSIZE*2UL, xmm3 );
+      (~y).store( i+SIMDSIZE*3UL, xmm4 );
+   }
+
+   for( ; i<ipos; i+=SIMDSIZE )
+   {
+      SIMDType xmm1( A.load(i,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         xmm1 = op.load( xmm1, A.load(i,j) );
+      }
+
+      (~y).store( i, xmm1 );
+   }
+
+   for( ; i<M; ++i )
+   {
+      ET redux( A(i,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, A(i,j) );
+      }
+
+      (~y)[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMN-WISE REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the column-wise reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param y The target row vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the default (i.e. single-threaded and non-vectorized) column-wise
+// reduction of the given dense matrix, i.e. the reduction result of the \a j-th column is
+// stored in the \a j-th element of the row vector \a y. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of reduction
+// operations. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,rowVector>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   typedef CompositeType_<MT>  CT;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).columns(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( SO == rowMajor ) {
+      for( size_t j=0UL; j<N; ++j )
+         (~y)[j] = A(0UL,j);
+      for( size_t i=1UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            (~y)[j] = op( (~y)[j], A(i,j) );
+   }
+   else {
+      for( size_t j=0UL; j<N; ++j ) {
+         ElementType_<VT> redux( A(0UL,j) );
+         for( size_t i=1UL; i<M; ++i )
+            redux = op( redux, A(i,j) );
+         (~y)[j] = redux;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the column-wise reduction of a row-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param y The target row vector for the reduction results.
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the single-threaded, vectorized column-wise reduction of the given
+// row-major dense matrix. Since the elements of a column are distributed over all rows, the
+// kernel combines the rows element-wise in up to four SIMD accumulators (i.e. for up to four
+// SIMD vectors of columns at once) and thus does not require any horizontal reduction. This
+// function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,rowVector>& y, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).columns(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE*4UL) <= jpos; j+=SIMDSIZE*4UL )
+   {
+      SIMDType xmm1( A.load(0UL,j             ) );
+      SIMDType xmm2( A.load(0UL,j+SIMDSIZE    ) );
+      SIMDType xmm3( A.load(0UL,j+SIMDSIZE*2UL) );
+      SIMDType xmm4( A.load(0UL,j+SIMDSIZE*3UL) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         xmm1 = op.load( xmm1, A.load(i,j             ) );
+         xmm2 = op.load( xmm2, A.load(i,j+SIMDSIZE    ) );
+         xmm3 = op.load( xmm3, A.load(i,j+SIMDSIZE*2UL) );
+         xmm4 = op.load( xmm4, A.load(i,j+SIMDSIZE*3UL) );
+      }
+
+      (~y).store( j             , xmm1 );
+      (~y).store( j+SIMDSIZE    , xmm2 );
+      (~y).store( j+SIMDSIZE*2UL, xmm3 );
+      (~y).store( j+SIMDSIZE*3UL, xmm4 );
+   }
+
+   for( ; j<jpos; j+=SIMDSIZE )
+   {
+      SIMDType xmm1( A.load(0UL,j) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         xmm1 = op.load( xmm1, A.load(i,j) );
+      }
+
+      (~y).store( j, xmm1 );
+   }
+
+   for( ; j<N; ++j )
+   {
+      ET redux( A(0UL,j) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         redux = op( redux, A(i,j) );
+      }
+
+      (~y)[j] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the column-wise reduction of a column-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param y The target row vector for the reduction results.
+// \param dm The given column-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the single-threaded, vectorized column-wise reduction of the given
+// column-major dense matrix. Each column is reduced by means of up to four independent SIMD
+// accumulators, which are reduced horizontally at the end of the column. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of reduction operations. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatreduce( DenseVector<VT,rowVector>& y, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~dm).columns(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL ) {
+      reset( ~y );
+      return;
+   }
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      size_t i( 0UL );
+      ET redux;
+
+      if( ipos > 0UL )
+      {
+         SIMDType xmm1( A.load(0UL,j) );
+         i = SIMDSIZE;
+
+         if( ipos >= SIMDSIZE*4UL )
+         {
+            SIMDType xmm2( A.load(SIMDSIZE    ,j) );
+            SIMDType xmm3( A.load(SIMDSIZE*2UL,j) );
+            SIMDType xmm4( A.load(SIMDSIZE*3UL,j) );
+
+            for( i=SIMDSIZE*4UL; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+               xmm1 = op.load( xmm1, A.load(i             ,j) );
+               xmm2 = op.load( xmm2, A.load(i+SIMDSIZE    ,j) );
+               xmm3 = op.load( xmm3, A.load(i+SIMDSIZE*2UL,j) );
+               xmm4 = op.load( xmm4, A.load(i+SIMDSIZE*3UL,j) );
+            }
+
+            xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+         }
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, A.load(i,j) );
+         }
+
+         redux = reduce( xmm1, op );
+      }
+      else {
+         redux = A(0UL,j);
+         i = 1UL;
+      }
+
+      for( ; i<M; ++i ) {
+         redux = op( redux, A(i,j) );
+      }
+
+      (~y)[j] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of the given
+// reduction operation \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. See \ref custom_operations for a detailed overview of the possibilities of custom
+// operations.
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// matrix has no elements, the function returns the default value of the element type (e.g. 0
+// in case of fundamental data types). In case the number of elements is larger or equal to the
+// blaze::SMP_DMATREDUCE_THRESHOLD, the reduction is computed in parallel.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const ElementType_<MT> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom row-wise or column-wise reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The vector of the row-wise or column-wise reduction results.
+//
+// This function reduces the rows or columns of the given dense matrix \a dm by means of the
+// given reduction operation \a op. In case the reduction flag \a RF is set to blaze::rowwise,
+// each row is reduced individually and the results are returned as a column vector. In case
+// \a RF is set to blaze::columnwise, each column is reduced individually and the results are
+// returned as a row vector:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double,blaze::columnVector> rs;
+   blaze::DynamicVector<double,blaze::rowVector> cs;
+   // ... Resizing and initialization
+
+   rs = blaze::reduce<blaze::rowwise>( A, blaze::Add() );     // Row-wise sums
+   cs = blaze::reduce<blaze::columnwise>( A, blaze::Add() );  // Column-wise sums
+   \endcode
+
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// reduced dimension of the matrix is 0, all elements of the resulting vector are set to their
+// default value (e.g. 0 in case of fundamental data types). In case the number of elements is
+// larger or equal to the blaze::SMP_DMATREDUCE_THRESHOLD, the reduction is computed in parallel.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >
+   reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 2UL, "Invalid reduction flag" );
+
+   typedef If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >  ReturnType;
+
+   ReturnType result;
+   resize( result, ( RF == rowwise )?( (~dm).rows() ):( (~dm).columns() ), false );
+
+   smpReduce( result, ~dm, op );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of addition:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalsum = sum( A );  // Results in 10
+   \endcode
+
+// In case the matrix has no elements, the function returns 0.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The vector of the row-wise or column-wise sums.
+//
+// This function computes the row-wise (\a RF set to blaze::rowwise) or column-wise (\a RF set
+// to blaze::columnwise) sums of the given dense matrix \a dm:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+   blaze::DynamicVector<int,blaze::columnVector> rs;
+   blaze::DynamicVector<int,blaze::rowVector> cs;
+
+   rs = blaze::sum<blaze::rowwise>( A );     // Results in ( 3, 7 )
+   cs = blaze::sum<blaze::columnwise>( A );  // Results in ( 4, 6 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >
+   sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of
+// multiplication:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// In case the matrix has no elements, the function returns 1.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return ElementType_<MT>( 1 );
+
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The vector of the row-wise or column-wise products.
+//
+// This function computes the row-wise (\a RF set to blaze::rowwise) or column-wise (\a RF set
+// to blaze::columnwise) products of the given dense matrix \a dm:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+   blaze::DynamicVector<int,blaze::columnVector> rp;
+   blaze::DynamicVector<int,blaze::rowVector> cp;
+
+   rp = blaze::prod<blaze::rowwise>( A );     // Results in ( 2, 12 )
+   cp = blaze::prod<blaze::columnwise>( A );  // Results in ( 3, 8 )
+   \endcode
+
+// In case the reduced dimension of the matrix is 0, all elements of the resulting vector
+// are 1.
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >
+   prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >  ReturnType;
+
+   if( ( RF == rowwise && (~dm).columns() == 0UL ) || ( RF == columnwise && (~dm).rows() == 0UL ) ) {
+      ReturnType result;
+      resize( result, ( RF == rowwise )?( (~dm).rows() ):( (~dm).columns() ), false );
+      result = ElementType_<MT>( 1 );
+      return result;
+   }
+
+   return reduce<RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, -2 }, { 3, 0 } };
+
+   const int totalmin = min( A );  // Results in -2
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of the row-wise or column-wise minima.
+//
+// This function returns the smallest element of each row (\a RF set to blaze::rowwise) or
+// of each column (\a RF set to blaze::columnwise) of the given dense matrix \a dm:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, -2 }, { 3, 0 } };
+   blaze::DynamicVector<int,blaze::columnVector> rmin;
+   blaze::DynamicVector<int,blaze::rowVector> cmin;
+
+   rmin = blaze::min<blaze::rowwise>( A );     // Results in ( -2, 0 )
+   cmin = blaze::min<blaze::columnwise>( A );  // Results in ( 1, -2 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >
+   min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest dense matrix element.
+//
+// This function returns the largest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, -2 }, { 3, 0 } };
+
+   const int totalmax = max( A );  // Results in 3
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of the row-wise or column-wise maxima.
+//
+// This function returns the largest element of each row (\a RF set to blaze::rowwise) or
+// of each column (\a RF set to blaze::columnwise) of the given dense matrix \a dm:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, -2 }, { 3, 0 } };
+   blaze::DynamicVector<int,blaze::columnVector> rmax;
+   blaze::DynamicVector<int,blaze::rowVector> cmax;
+
+   rmax = blaze::max<blaze::rowwise>( A );     // Results in ( 1, 3 )
+   cmax = blaze::max<blaze::columnwise>( A );  // Results in ( 3, 0 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const If_< Bool< RF == rowwise >, ColumnTrait_< ResultType_<MT> >, RowTrait_< ResultType_<MT> > >
+   max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
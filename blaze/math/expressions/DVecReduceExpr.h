@@ -0,0 +1,430 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecReduceExpr.h
+//  \brief Header file for the dense vector reduction operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction operation.
+// \ingroup dense_vector
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   typedef RemoveReference_< CompositeType_<VT> >  CT;
+
+   //! Element type of the dense vector expression.
+   typedef ElementType_<CT>  ET;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD capabilities of the given reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+
+   //! Helper structure for the detection of the SIMD capabilities of the dense vector expression.
+   /*! In case the dense vector expression is SIMD-enabled, \a value is set to 1 if the SIMD type
+       returned by the load() function matches the SIMD type of the element type. */
+   struct HasMatchingSIMDType {
+      enum : bool { value = IsSame< SIMDTrait_<ET>, Decay_< decltype( std::declval<CT&>().load( 0UL ) ) > >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         If_< Bool< CT::simdEnabled >, HasMatchingSIMDType, FalseType >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default (i.e. single-threaded and non-vectorized) reduction of
+// the given dense vector. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of reduction operations. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors. Instead of using
+// this function use the reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   ET redux1( tmp[0UL] );
+
+   if( N > 1UL )
+   {
+      ET redux2( tmp[1UL] );
+      size_t i( 2UL );
+
+      for( ; (i+2UL) <= N; i+=2UL ) {
+         redux1 = op( redux1, tmp[i    ] );
+         redux2 = op( redux2, tmp[i+1UL] );
+      }
+      if( i < N ) {
+         redux1 = op( redux1, tmp[i] );
+      }
+
+      redux1 = op( redux1, redux2 );
+   }
+
+   return redux1;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the single-threaded, vectorized reduction of the given dense vector.
+// In order to hide the latency of the reduction operation, the kernel works on four independent
+// SIMD accumulators, which are combined and horizontally reduced at the end. The remaining
+// elements are processed one by one, i.e. the reduction does not rely on the padding elements.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+   typedef SIMDTrait_<ET>      SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   if( N < SIMDSIZE ) {
+      ET redux( tmp[0UL] );
+      for( size_t i=1UL; i<N; ++i ) {
+         redux = op( redux, tmp[i] );
+      }
+      return redux;
+   }
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   SIMDType xmm1( tmp.load(0UL) );
+   size_t i( SIMDSIZE );
+
+   if( ipos >= SIMDSIZE*4UL )
+   {
+      SIMDType xmm2( tmp.load(SIMDSIZE    ) );
+      SIMDType xmm3( tmp.load(SIMDSIZE*2UL) );
+      SIMDType xmm4( tmp.load(SIMDSIZE*3UL) );
+
+      for( i=SIMDSIZE*4UL; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+         xmm1 = op.load( xmm1, tmp.load(i             ) );
+         xmm2 = op.load( xmm2, tmp.load(i+SIMDSIZE    ) );
+         xmm3 = op.load( xmm3, tmp.load(i+SIMDSIZE*2UL) );
+         xmm4 = op.load( xmm4, tmp.load(i+SIMDSIZE*3UL) );
+      }
+
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 = op.load( xmm1, tmp.load(i) );
+   }
+
+   ET redux( reduce( xmm1, op ) );
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, tmp[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( a, blaze::Add() );
+   const double totalsum2 = reduce( a, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. However, for instance in the case of lambdas the vectorization of the reduction
+// operation is compiler dependent and might not perform at peak performance. However, it is
+// also possible to create vectorized custom operations. See \ref custom_operations for a
+// detailed overview of the possibilities of custom operations.
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// vector is empty, the function returns the default value of the element type (e.g. 0 in
+// case of fundamental data types). In case the number of elements is larger or equal to
+// the blaze::SMP_DVECREDUCE_THRESHOLD, the reduction is computed in parallel.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline const ElementType_<VT> reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of addition:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalsum = sum( a );  // Results in 10
+   \endcode
+
+// In case the vector is empty, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementType_<VT> sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of multiplication:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalprod = prod( a );  // Results in 24
+   \endcode
+
+// In case the vector is empty, the function returns 1.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementType_<VT> prod( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~dv).size() == 0UL ) return ElementType_<VT>( 1 );
+
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The smallest dense vector element.
+//
+// This function returns the smallest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+
+   \code
+   blaze::DynamicVector<int> a{ 1, -2, 3, 0 };
+
+   const int totalmin = min( a );  // Results in -2
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementType_<VT> min( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest dense vector element.
+//
+// This function returns the largest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+
+   \code
+   blaze::DynamicVector<int> a{ 1, -2, 3, 0 };
+
+   const int totalmax = max( a );  // Results in 3
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementType_<VT> max( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Maximum() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -83,6 +83,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSpMultKernels.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -119,6 +120,7 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -190,6 +192,20 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix type \a T2 provides specialized multiplication kernels and the
+       element types of the sparse matrix and the dense matrix \a T3 are identical, the nested
+       \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSpMultKernel {
+      enum : bool { value = HasSpMultKernels<T2>::value &&
+                            IsSame< ElementType_<T2>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -198,6 +214,7 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    template< typename T1, typename T2, typename T3 >
    struct UseVectorizedKernel {
       enum : bool { value = useOptimizedKernels &&
+                            !UseSpMultKernel<T1,T2,T3>::value &&
                             !IsDiagonal<T3>::value &&
                             T1::simdEnabled && T3::simdEnabled &&
                             IsRowMajorMatrix<T1>::value &&
@@ -219,6 +236,7 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    template< typename T1, typename T2, typename T3 >
    struct UseOptimizedKernel {
       enum : bool { value = useOptimizedKernels &&
+                            !UseSpMultKernel<T1,T2,T3>::value &&
                             !UseVectorizedKernel<T1,T2,T3>::value &&
                             !IsDiagonal<T3>::value &&
                             !IsResizable< ElementType_<T1> >::value &&
@@ -230,11 +248,12 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case neither a vectorized nor optimized computation is possible, the nested \value will
-       be set to 1, otherwise it will be 0. */
+   /*! In case neither a kernel-based, vectorized nor optimized computation is possible, the nested
+       \value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum : bool { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum : bool { value = !UseSpMultKernel<T1,T2,T3>::value &&
+                            !UseVectorizedKernel<T1,T2,T3>::value &&
                             !UseOptimizedKernel<T1,T2,T3>::value };
    };
    /*! \endcond */
@@ -854,6 +873,29 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Kernel-based assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-dense matrix multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseSpMultKernel<MT3,MT4,MT5> >
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT4>  ET;
+      spmm( C, A, B, ET(1), ET(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1252,6 +1294,29 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Kernel-based addition assignment to dense matrices******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-dense matrix multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseSpMultKernel<MT3,MT4,MT5> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT4>  ET;
+      spmm( C, A, B, ET(1), ET(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1615,6 +1680,29 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2,SF,HF,LF,U
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Kernel-based subtraction assignment to dense matrices***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-dense matrix multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseSpMultKernel<MT3,MT4,MT5> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT4>  ET;
+      spmm( C, A, B, ET(-1), ET(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -58,6 +58,7 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasSpMultKernels.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -75,6 +76,7 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -117,15 +119,22 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    enum : bool { evaluateVector = IsComputation<VT>::value || RequiresEvaluation<VT>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Compilation switch for the use of the specialized multiplication kernels of the matrix.
+   enum : bool { useKernel = HasSpMultKernels<MT>::value &&
+                             IsSame< ElementType_<MT>, ElementType_<VT> >::value };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Compilation switch for the evaluation strategy of the multiplication expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
        the evaluation strategy of the multiplication expression. In case either the matrix or
-       the vector operand requires an intermediate evaluation or the dense vector expression
-       is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum : bool { useAssign = evaluateMatrix || evaluateVector };
+       the vector operand requires an intermediate evaluation, the dense vector expression
+       is a compound expression, or the sparse matrix provides specialized multiplication
+       kernels, \a useAssign will be set to \a true and the multiplication expression will be
+       evaluated via the \a assign function family. Otherwise \a useAssign will be set to
+       \a false and the expression will be evaluated via the subscript operator. */
+   enum : bool { useAssign = evaluateMatrix || evaluateVector || useKernel };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -146,7 +155,21 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
        evaluation, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum : bool { value = useAssign };
+      enum : bool { value = evaluateMatrix || evaluateVector };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix type \a T2 provides specialized multiplication kernels and the
+       element types of the sparse matrix and the dense vector \a T3 are identical, the nested
+       \value will be set to 1, otherwise it will be 0. */
+   template< typename T2, typename T3 >
+   struct UseSpMultKernel {
+      enum : bool { value = HasSpMultKernels<T2>::value &&
+                            IsSame< ElementType_<T2>, ElementType_<T3> >::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -342,7 +365,52 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseSpMultKernel<MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kernel-based assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-dense vector multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSpMultKernel<MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<MT1>  ET;
+      spmv( y, A, x, ET(1), ET(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -417,7 +485,52 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseSpMultKernel<MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kernel-based addition assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-dense vector multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSpMultKernel<MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<MT1>  ET;
+      spmv( y, A, x, ET(1), ET(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -462,7 +575,52 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseSpMultKernel<MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kernel-based subtraction assignment to dense vectors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication by means of the
+   //        specialized multiplication kernel of the sparse matrix (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSpMultKernel<MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<MT1>  ET;
+      spmv( y, A, x, ET(-1), ET(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
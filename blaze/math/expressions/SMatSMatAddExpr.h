@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/MatMatAddExpr.h>
@@ -78,6 +79,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -498,7 +500,8 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
       const size_t n( A.columns() );
 
       // Counting the number of elements per column
-      std::vector<size_t> nonzeros( n, 0UL );
+      ArenaArray<size_t> nonzeros( n );
+      std::fill( nonzeros.begin(), nonzeros.end(), 0UL );
       for( size_t i=0UL; i<m; ++i )
       {
          const LeftIterator  lend( A.end(i) );
@@ -40,7 +40,7 @@
 // Includes
 //*************************************************************************************************
 
-#include <vector>
+#include <algorithm>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/Computation.h>
@@ -49,6 +49,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -548,7 +549,8 @@ class SMatTransposer : public SparseMatrix< SMatTransposer<MT,SO>, SO >
       const size_t n( columns() );
 
       // Counting the number of elements per row
-      std::vector<size_t> rowLengths( m, 0UL );
+      ArenaArray<size_t> rowLengths( m );
+      std::fill( rowLengths.begin(), rowLengths.end(), 0UL );
       for( size_t j=0UL; j<n; ++j ) {
          for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
             ++rowLengths[element->index()];
@@ -1013,7 +1015,8 @@ class SMatTransposer<MT,true> : public SparseMatrix< SMatTransposer<MT,true>, tr
       const size_t n( columns() );
 
       // Counting the number of elements per row
-      std::vector<size_t> columnLengths( n, 0UL );
+      ArenaArray<size_t> columnLengths( n );
+      std::fill( columnLengths.begin(), columnLengths.end(), 0UL );
       for( size_t i=0UL; i<m; ++i ) {
          for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
             ++columnLengths[element->index()];
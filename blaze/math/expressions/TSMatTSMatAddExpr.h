@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/MatMatAddExpr.h>
@@ -78,6 +79,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -422,7 +424,8 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
       const size_t n( rhs.columns() );
 
       // Counting the number of elements per column
-      std::vector<size_t> nonzeros( m, 0UL );
+      ArenaArray<size_t> nonzeros( m );
+      std::fill( nonzeros.begin(), nonzeros.end(), 0UL );
       for( size_t j=0UL; j<n; ++j )
       {
          const LeftIterator  lend( A.end(j) );
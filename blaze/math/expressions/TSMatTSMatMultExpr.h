@@ -40,8 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
-#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -53,10 +51,9 @@
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
-#include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SpGEMM.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -99,7 +96,6 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
-#include <blaze/util/typetraits/RemoveReference.h>
 #include <blaze/util/Unused.h>
 
 
@@ -502,7 +498,9 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    // \return void
    //
    // This function implements the performance optimized assignment of a transpose sparse matrix-
-   // transpose sparse matrix multiplication expression to a column-major sparse matrix.
+   // transpose sparse matrix multiplication expression to a column-major sparse matrix. The
+   // multiplication is performed by the sparse matrix multiplication engine (see
+   // blaze/math/sparse/SpGEMM.h).
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,true>& lhs, const TSMatTSMatMultExpr& rhs )
@@ -512,9 +510,6 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef ConstIterator_< RemoveReference_<CT1> >  LeftIterator;
-      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -525,91 +520,7 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
-
-      for( size_t j=0UL; j<(~lhs).columns(); ++j ) {
-         const RightIterator rend( B.end(j) );
-         for( RightIterator relem=B.begin(j); relem!=rend; ++relem ) {
-            nonzeros += A.nonZeros( relem->index() );
-         }
-      }
-
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
-      }
-
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
-
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).rows(), ElementType() );
-      std::vector<byte_t>      valid  ( (~lhs).rows(), 0   );
-      std::vector<size_t>      indices( (~lhs).rows(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t j=0UL; j<(~lhs).columns(); ++j )
-      {
-         const RightIterator rend( B.end(j) );
-         for( RightIterator relem=B.begin(j); relem!=rend; ++relem )
-         {
-            const LeftIterator lend( A.end( relem->index() ) );
-            for( LeftIterator lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
-            {
-               if( !valid[lelem->index()] ) {
-                  values[lelem->index()] = lelem->value() * relem->value();
-                  valid [lelem->index()] = 1;
-                  indices[nonzeros] = lelem->index();
-                  ++nonzeros;
-                  if( lelem->index() < minIndex ) minIndex = lelem->index();
-                  if( lelem->index() > maxIndex ) maxIndex = lelem->index();
-               }
-               else {
-                  values[lelem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).rows(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t i=0UL; i<nonzeros; ++i )
-               {
-                  const size_t index( indices[i] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( index, j, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t i=minIndex; i<=maxIndex; ++i )
-               {
-                  if( !isDefault( values[i] ) ) {
-                     (~lhs).append( i, j, values[i] );
-                     reset( values[i] );
-                  }
-
-                  reset( valid [i] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
-
-         (~lhs).finalize( j );
-      }
+      spgemm( ~lhs, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -911,6 +822,47 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to column-major sparse matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose sparse matrix-transpose sparse matrix multiplication
+   //        to a column-major sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose sparse
+   // matrix-transpose sparse matrix multiplication expression to a column-major sparse matrix.
+   // Due to the explicit application of the SFINAE principle this function can only be selected
+   // by the compiler in case none of the two matrix operands requires an intermediate evaluation.
+   // The columns of the target matrix are computed in parallel by the sparse matrix multiplication
+   // engine.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline DisableIf_< IsEvaluationRequired<MT,MT1,MT2> >
+      smpAssign( SparseMatrix<MT,true>& lhs, const TSMatTSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpSpgemm( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP assignment to row-major matrices******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP assignment of a transpose sparse matrix-transpose sparse matrix
@@ -47,6 +47,7 @@ namespace blaze {
 struct Abs;
 struct Acos;
 struct Acosh;
+struct Add;
 struct Asin;
 struct Asinh;
 struct Atan;
@@ -77,6 +78,9 @@ struct InvSqrt;
 struct Log;
 struct Log2;
 struct Log10;
+struct Maximum;
+struct Minimum;
+struct Mult;
 template< typename > struct Pow;
 struct Real;
 struct Round;
@@ -76,4 +76,18 @@
 */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\defgroup lapack_eigenvalue Eigenvalue Computation
+// \ingroup lapack
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\defgroup lapack_singular_value Singular Value Decomposition
+// \ingroup lapack
+*/
+//*************************************************************************************************
+
 #endif
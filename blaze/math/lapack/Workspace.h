@@ -0,0 +1,451 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/Workspace.h
+//  \brief Header file for the reusable workspace of the LAPACK functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_WORKSPACE_H_
+#define _BLAZE_MATH_LAPACK_WORKSPACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <memory>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable workspace for the LAPACK eigenvalue and singular value functions.
+// \ingroup lapack
+//
+// The LapackWorkspace class owns all auxiliary arrays required by the LAPACK eigenvalue and
+// singular value functions (see for instance the syevd(), heevd(), gesdd(), eigen() and svd()
+// functions). On the first call the optimal size of the auxiliary arrays is determined by a
+// LAPACK workspace query and the arrays are allocated. Subsequent calls with the same routine
+// and the same matrix dimensions skip the workspace query, and as long as the arrays are large
+// enough they are reused without any further memory allocation:
+
+   \code
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   blaze::LapackWorkspace<double> ws;
+
+   for( const auto& A : covariances ) {  // Thousands of 128x128 covariance matrices
+      blaze::eigen( A, w, V, ws );       // Single workspace query, single allocation
+      // ...
+   }
+   \endcode
+
+// The template argument \a Type specifies the element type of the decomposed matrices, which
+// has to be either \c float, \c double, \c complex<float>, or \c complex<double>. Note that a
+// workspace must not be shared between several threads.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+class LapackWorkspace
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type                             ElementType;  //!< Element type of the matrices.
+   typedef UnderlyingBuiltin_<Type>         BuiltinType;  //!< Underlying builtin element type.
+   typedef DynamicMatrix<Type,columnMajor>  MatrixType;   //!< Type of the auxiliary matrices.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline LapackWorkspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t queries () const noexcept;
+   inline size_t capacity() const noexcept;
+   inline void   clear   () noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Workspace functions*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Workspace functions */
+   //@{
+   inline bool isQueried( const char* routine, char job, char range, int m, int n ) const noexcept;
+   inline void setQuery ( const char* routine, char job, char range, int m, int n,
+                          int lwork, int lrwork, int liwork );
+
+   inline Type*        work  () noexcept;
+   inline BuiltinType* rwork () noexcept;
+   inline int*         iwork () noexcept;
+   inline int          lwork () const noexcept;
+   inline int          lrwork() const noexcept;
+   inline int          liwork() const noexcept;
+   inline MatrixType&  matrix( size_t index ) noexcept;
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const char* routine_;  //!< The LAPACK routine of the last workspace query.
+   char job_;             //!< The job argument of the last workspace query.
+   char range_;           //!< The range argument of the last workspace query.
+   int m_;                //!< The number of rows of the last workspace query.
+   int n_;                //!< The number of columns of the last workspace query.
+   int lwork_;            //!< The current size of the element work array.
+   int lrwork_;           //!< The current size of the builtin work array.
+   int liwork_;           //!< The current size of the integer work array.
+   size_t queries_;       //!< The total number of performed workspace queries.
+
+   std::unique_ptr<Type[]>        work_;         //!< The element work array.
+   std::unique_ptr<BuiltinType[]> rwork_;        //!< The builtin work array.
+   std::unique_ptr<int[]>         iwork_;        //!< The integer work array.
+   MatrixType                     matrices_[3];  //!< Auxiliary matrices of the eigen()/svd() functions.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the LapackWorkspace class.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline LapackWorkspace<Type>::LapackWorkspace()
+   : routine_ ( nullptr )  // The LAPACK routine of the last workspace query
+   , job_     ( '\0'    )  // The job argument of the last workspace query
+   , range_   ( '\0'    )  // The range argument of the last workspace query
+   , m_       ( 0       )  // The number of rows of the last workspace query
+   , n_       ( 0       )  // The number of columns of the last workspace query
+   , lwork_   ( 0       )  // The current size of the element work array
+   , lrwork_  ( 0       )  // The current size of the builtin work array
+   , liwork_  ( 0       )  // The current size of the integer work array
+   , queries_ ( 0UL     )  // The total number of performed workspace queries
+   , work_    ()           // The element work array
+   , rwork_   ()           // The builtin work array
+   , iwork_   ()           // The integer work array
+   , matrices_()           // Auxiliary matrices of the high-level functions
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of LAPACK workspace queries performed with this workspace.
+//
+// \return The number of performed workspace queries.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline size_t LapackWorkspace<Type>::queries() const noexcept
+{
+   return queries_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes currently allocated by the auxiliary arrays.
+//
+// \return The size of the auxiliary arrays in bytes.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline size_t LapackWorkspace<Type>::capacity() const noexcept
+{
+   size_t bytes( lwork_*sizeof(Type) + lrwork_*sizeof(BuiltinType) + liwork_*sizeof(int) );
+
+   for( const MatrixType& M : matrices_ ) {
+      bytes += M.capacity() * sizeof(Type);
+   }
+
+   return bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases all auxiliary arrays of the workspace.
+//
+// \return void
+//
+// This function releases all memory held by the workspace. The next call of a LAPACK function
+// with this workspace will perform a new workspace query.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline void LapackWorkspace<Type>::clear() noexcept
+{
+   routine_ = nullptr;
+   lwork_   = 0;
+   lrwork_  = 0;
+   liwork_  = 0;
+
+   work_.reset();
+   rwork_.reset();
+   iwork_.reset();
+
+   for( MatrixType& M : matrices_ ) {
+      MatrixType().swap( M );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the workspace has been queried for the given LAPACK call.
+//
+// \param routine The name of the LAPACK routine.
+// \param job The job argument of the LAPACK call.
+// \param range The range argument of the LAPACK call.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return \a true in case the auxiliary arrays fit the given call, \a false if not.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline bool LapackWorkspace<Type>::isQueried( const char* routine, char job, char range,
+                                              int m, int n ) const noexcept
+{
+   return routine_ != nullptr && std::strcmp( routine_, routine ) == 0 &&
+          job_ == job && range_ == range && m_ == m && n_ == n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Records the result of a workspace query and resizes the auxiliary arrays.
+//
+// \param routine The name of the LAPACK routine (string literal).
+// \param job The job argument of the LAPACK call.
+// \param range The range argument of the LAPACK call.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param lwork The required size of the element work array.
+// \param lrwork The required size of the builtin work array.
+// \param liwork The required size of the integer work array.
+// \return void
+//
+// This function records the given LAPACK call and grows the auxiliary arrays to the given sizes.
+// The auxiliary arrays are never shrunk, i.e. a workspace that has been used for large matrices
+// can be reused for smaller matrices without any memory allocation.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline void LapackWorkspace<Type>::setQuery( const char* routine, char job, char range,
+                                             int m, int n, int lwork, int lrwork, int liwork )
+{
+   BLAZE_INTERNAL_ASSERT( lwork >= 0 && lrwork >= 0 && liwork >= 0, "Invalid workspace sizes" );
+
+   if( lwork > lwork_ ) {
+      work_.reset( new Type[lwork] );
+      lwork_ = lwork;
+   }
+
+   if( lrwork > lrwork_ ) {
+      rwork_.reset( new BuiltinType[lrwork] );
+      lrwork_ = lrwork;
+   }
+
+   if( liwork > liwork_ ) {
+      iwork_.reset( new int[liwork] );
+      liwork_ = liwork;
+   }
+
+   routine_ = routine;
+   job_     = job;
+   range_   = range;
+   m_       = m;
+   n_       = n;
+
+   ++queries_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the element work array.
+//
+// \return Pointer to the element work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline Type* LapackWorkspace<Type>::work() noexcept
+{
+   return work_.get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the builtin work array.
+//
+// \return Pointer to the builtin work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline typename LapackWorkspace<Type>::BuiltinType* LapackWorkspace<Type>::rwork() noexcept
+{
+   return rwork_.get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the integer work array.
+//
+// \return Pointer to the integer work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline int* LapackWorkspace<Type>::iwork() noexcept
+{
+   return iwork_.get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the element work array.
+//
+// \return The size of the element work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline int LapackWorkspace<Type>::lwork() const noexcept
+{
+   return lwork_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the builtin work array.
+//
+// \return The size of the builtin work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline int LapackWorkspace<Type>::lrwork() const noexcept
+{
+   return lrwork_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the integer work array.
+//
+// \return The size of the integer work array.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline int LapackWorkspace<Type>::liwork() const noexcept
+{
+   return liwork_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns one of the auxiliary matrices of the workspace.
+//
+// \param index The index of the auxiliary matrix \f$[0..2]\f$.
+// \return Reference to the auxiliary matrix.
+//
+// The auxiliary matrices are used by the high-level eigen() and svd() functions to hold the
+// column-major copies of the decomposed matrix and of the singular vectors. Resizing a matrix
+// to a size it already had before does not result in a memory allocation.
+*/
+template< typename Type >  // Element type of the decomposed matrices
+inline typename LapackWorkspace<Type>::MatrixType&
+   LapackWorkspace<Type>::matrix( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < 3UL, "Invalid auxiliary matrix access index" );
+
+   return matrices_[index];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
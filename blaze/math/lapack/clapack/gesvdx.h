@@ -0,0 +1,364 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/gesvdx.h
+//  \brief Header file for the CLAPACK gesvdx wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_GESVDX_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_GESVDX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+extern "C" {
+
+void sgesvdx_( char* jobu, char* jobv, char* range, int* m, int* n, float* A, int* lda, float* vl,
+               float* vu, int* il, int* iu, int* ns, float* s, float* U, int* ldu, float* VT, int* ldvt,
+               float* work, int* lwork, int* iwork, int* info );
+void dgesvdx_( char* jobu, char* jobv, char* range, int* m, int* n, double* A, int* lda, double* vl,
+               double* vu, int* il, int* iu, int* ns, double* s, double* U, int* ldu, double* VT, int* ldvt,
+               double* work, int* lwork, int* iwork, int* info );
+void cgesvdx_( char* jobu, char* jobv, char* range, int* m, int* n, float* A, int* lda, float* vl,
+               float* vu, int* il, int* iu, int* ns, float* s, float* U, int* ldu, float* VT, int* ldvt,
+               float* work, int* lwork, float* rwork, int* iwork, int* info );
+void zgesvdx_( char* jobu, char* jobv, char* range, int* m, int* n, double* A, int* lda, double* vl,
+               double* vu, int* il, int* iu, int* ns, double* s, double* U, int* ldu, double* VT, int* ldvt,
+               double* work, int* lwork, double* rwork, int* iwork, int* info );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SELECTED SVD FUNCTIONS (GESVDX)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK selected SVD functions (gesvdx) */
+//@{
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, float* A, int lda,
+                    float vl, float vu, int il, int iu, int* ns, float* s,
+                    float* U, int ldu, float* VT, int ldvt,
+                    float* work, int lwork, int* iwork, int* info );
+
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, double* A, int lda,
+                    double vl, double vu, int il, int iu, int* ns, double* s,
+                    double* U, int ldu, double* VT, int ldvt,
+                    double* work, int lwork, int* iwork, int* info );
+
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, complex<float>* A, int lda,
+                    float vl, float vu, int il, int iu, int* ns, float* s,
+                    complex<float>* U, int ldu, complex<float>* VT, int ldvt,
+                    complex<float>* work, int lwork, float* rwork, int* iwork, int* info );
+
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, complex<double>* A, int lda,
+                    double vl, double vu, int il, int iu, int* ns, double* s,
+                    complex<double>* U, int ldu, complex<double>* VT, int ldvt,
+                    complex<double>* work, int lwork, double* rwork, int* iwork, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of a dense single precision
+//        column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to not compute them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to not compute them.
+// \param range \c 'A' for all singular values, \c 'V' for the singular values in \f$(vl..vu]\f$,
+//              or \c 'I' for the singular values with index \f$[il..iu]\f$.
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to be returned (\a range = \c 'I').
+// \param ns The total number of singular values found.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param iwork Auxiliary array; size >= 12*min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected singular values and, optionally, the corresponding singular
+// vectors of a general \a m-by-\a n single precision column-major matrix based on the LAPACK
+// sgesvdx() function. The \a ns selected singular values are returned in descending order in the
+// first \a ns elements of \a s. The corresponding left singular vectors are returned in the first
+// \a ns columns of \a U, the corresponding right singular vectors are returned in the first \a ns
+// rows of \a VT (i.e. as rows of \f$ V^T \f$). Note that the matrix \a A is destroyed on exit.
+// Calling the function with \a lwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the sgesvdx() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, float* A, int lda,
+                    float vl, float vu, int il, int iu, int* ns, float* s,
+                    float* U, int ldu, float* VT, int ldvt,
+                    float* work, int lwork, int* iwork, int* info )
+{
+   sgesvdx_( &jobu, &jobv, &range, &m, &n, A, &lda, &vl, &vu, &il, &iu, ns, s,
+             U, &ldu, VT, &ldvt, work, &lwork, iwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of a dense double precision
+//        column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to not compute them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to not compute them.
+// \param range \c 'A' for all singular values, \c 'V' for the singular values in \f$(vl..vu]\f$,
+//              or \c 'I' for the singular values with index \f$[il..iu]\f$.
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to be returned (\a range = \c 'I').
+// \param ns The total number of singular values found.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param iwork Auxiliary array; size >= 12*min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected singular values and, optionally, the corresponding singular
+// vectors of a general \a m-by-\a n double precision column-major matrix based on the LAPACK
+// dgesvdx() function. The \a ns selected singular values are returned in descending order in the
+// first \a ns elements of \a s. The corresponding left singular vectors are returned in the first
+// \a ns columns of \a U, the corresponding right singular vectors are returned in the first \a ns
+// rows of \a VT (i.e. as rows of \f$ V^T \f$). Note that the matrix \a A is destroyed on exit.
+// Calling the function with \a lwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the dgesvdx() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, double* A, int lda,
+                    double vl, double vu, int il, int iu, int* ns, double* s,
+                    double* U, int ldu, double* VT, int ldvt,
+                    double* work, int lwork, int* iwork, int* info )
+{
+   dgesvdx_( &jobu, &jobv, &range, &m, &n, A, &lda, &vl, &vu, &il, &iu, ns, s,
+             U, &ldu, VT, &ldvt, work, &lwork, iwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of a dense single precision complex
+//        column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to not compute them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to not compute them.
+// \param range \c 'A' for all singular values, \c 'V' for the singular values in \f$(vl..vu]\f$,
+//              or \c 'I' for the singular values with index \f$[il..iu]\f$.
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision complex column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to be returned (\a range = \c 'I').
+// \param ns The total number of singular values found.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param rwork Auxiliary array; size >= 17*min(\a m,\a n)*min(\a m,\a n).
+// \param iwork Auxiliary array; size >= 12*min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected singular values and, optionally, the corresponding singular
+// vectors of a general \a m-by-\a n single precision complex column-major matrix based on the
+// LAPACK cgesvdx() function. The \a ns selected singular values are returned in descending order in
+// the first \a ns elements of \a s. The corresponding left singular vectors are returned in the
+// first \a ns columns of \a U, the corresponding right singular vectors are returned in the first
+// \a ns rows of \a VT (i.e. as rows of \f$ V^H \f$). Note that the matrix \a A is destroyed on
+// exit. Calling the function with \a lwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the cgesvdx() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, complex<float>* A, int lda,
+                    float vl, float vu, int il, int iu, int* ns, float* s,
+                    complex<float>* U, int ldu, complex<float>* VT, int ldvt,
+                    complex<float>* work, int lwork, float* rwork, int* iwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   cgesvdx_( &jobu, &jobv, &range, &m, &n, reinterpret_cast<float*>( A ), &lda, &vl, &vu, &il, &iu,
+             ns, s, reinterpret_cast<float*>( U ), &ldu, reinterpret_cast<float*>( VT ), &ldvt,
+             reinterpret_cast<float*>( work ), &lwork, rwork, iwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of a dense double precision complex
+//        column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to not compute them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to not compute them.
+// \param range \c 'A' for all singular values, \c 'V' for the singular values in \f$(vl..vu]\f$,
+//              or \c 'I' for the singular values with index \f$[il..iu]\f$.
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision complex column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for singular values (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to be returned (\a range = \c 'I').
+// \param ns The total number of singular values found.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param rwork Auxiliary array; size >= 17*min(\a m,\a n)*min(\a m,\a n).
+// \param iwork Auxiliary array; size >= 12*min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected singular values and, optionally, the corresponding singular
+// vectors of a general \a m-by-\a n double precision complex column-major matrix based on the
+// LAPACK zgesvdx() function. The \a ns selected singular values are returned in descending order in
+// the first \a ns elements of \a s. The corresponding left singular vectors are returned in the
+// first \a ns columns of \a U, the corresponding right singular vectors are returned in the first
+// \a ns rows of \a VT (i.e. as rows of \f$ V^H \f$). Note that the matrix \a A is destroyed on
+// exit. Calling the function with \a lwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the zgesvdx() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void gesvdx( char jobu, char jobv, char range, int m, int n, complex<double>* A, int lda,
+                    double vl, double vu, int il, int iu, int* ns, double* s,
+                    complex<double>* U, int ldu, complex<double>* VT, int ldvt,
+                    complex<double>* work, int lwork, double* rwork, int* iwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   zgesvdx_( &jobu, &jobv, &range, &m, &n, reinterpret_cast<double*>( A ), &lda, &vl, &vu, &il,
+             &iu, ns, s, reinterpret_cast<double*>( U ), &ldu, reinterpret_cast<double*>( VT ),
+             &ldvt, reinterpret_cast<double*>( work ), &lwork, rwork, iwork, info );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
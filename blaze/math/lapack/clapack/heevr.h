@@ -0,0 +1,228 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/heevr.h
+//  \brief Header file for the CLAPACK heevr wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_HEEVR_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_HEEVR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+extern "C" {
+
+void cheevr_( char* jobz, char* range, char* uplo, int* n, float* A, int* lda, float* vl, float* vu,
+              int* il, int* iu, float* abstol, int* m, float* w, float* Z, int* ldz, int* isuppz,
+              float* work, int* lwork, float* rwork, int* lrwork, int* iwork, int* liwork, int* info );
+void zheevr_( char* jobz, char* range, char* uplo, int* n, double* A, int* lda, double* vl, double* vu,
+              int* il, int* iu, double* abstol, int* m, double* w, double* Z, int* ldz, int* isuppz,
+              double* work, int* lwork, double* rwork, int* lrwork, int* iwork, int* liwork, int* info );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK HERMITIAN MATRIX SELECTED EIGENVALUE FUNCTIONS (HEEVR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK Hermitian matrix selected eigenvalue functions (heevr) */
+//@{
+inline void heevr( char jobz, char range, char uplo, int n, complex<float>* A, int lda,
+                   float vl, float vu, int il, int iu, float abstol, int* m, float* w,
+                   complex<float>* Z, int ldz, int* isuppz, complex<float>* work, int lwork,
+                   float* rwork, int lrwork, int* iwork, int liwork, int* info );
+
+inline void heevr( char jobz, char range, char uplo, int n, complex<double>* A, int lda,
+                   double vl, double vu, int il, int iu, double abstol, int* m, double* w,
+                   complex<double>* Z, int ldz, int* isuppz, complex<double>* work, int lwork,
+                   double* rwork, int lrwork, int* iwork, int liwork, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues of a dense single precision complex
+//        column-major Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param range \c 'A' for all eigenvalues, \c 'V' for the eigenvalues in the half-open interval
+//              \f$(vl..vu]\f$, or \c 'I' for the eigenvalues with index \f$[il..iu]\f$.
+// \param uplo \c 'L' in case the lower part of \a A is stored, \c 'U' in case of the upper part.
+// \param n The number of rows and columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision complex column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for eigenvalues (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for eigenvalues (\a range = \c 'V').
+// \param il The 1-based index of the smallest eigenvalue to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the largest eigenvalue to be returned (\a range = \c 'I').
+// \param abstol The absolute error tolerance for the eigenvalues.
+// \param m The total number of eigenvalues found.
+// \param w Pointer to the first element of the vector for the eigenvalues; size >= \a n.
+// \param Z Pointer to the first element of the column-major matrix for the eigenvectors.
+// \param ldz The total number of elements between two columns of the matrix \a Z.
+// \param isuppz Auxiliary array for the support of the eigenvectors; size >= 2*max( 1, \a m ).
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param rwork Auxiliary array; size >= max( 1, \a lrwork ).
+// \param lrwork The dimension of the array \a rwork (see online reference for details).
+// \param iwork Auxiliary array; size >= max( 1, \a liwork ).
+// \param liwork The dimension of the array \a iwork (see online reference for details).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected eigenvalues and, optionally, the corresponding eigenvectors of a
+// Hermitian \a n-by-\a n single precision complex column-major matrix based on the LAPACK cheevr()
+// function, which uses the Relatively Robust Representations (MRRR) algorithm. The \a m selected
+// eigenvalues are returned in ascending order in the first \a m elements of \a w and, in case
+// \a jobz is \c 'V', the corresponding eigenvectors are returned in the first \a m columns of \a Z.
+// Note that the matrix \a A is destroyed on exit. Calling the function with \a lwork, \a lrwork,
+// and \a liwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the cheevr() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void heevr( char jobz, char range, char uplo, int n, complex<float>* A, int lda,
+                   float vl, float vu, int il, int iu, float abstol, int* m, float* w,
+                   complex<float>* Z, int ldz, int* isuppz, complex<float>* work, int lwork,
+                   float* rwork, int lrwork, int* iwork, int liwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   cheevr_( &jobz, &range, &uplo, &n, reinterpret_cast<float*>( A ), &lda, &vl, &vu, &il, &iu,
+            &abstol, m, w, reinterpret_cast<float*>( Z ), &ldz, isuppz,
+            reinterpret_cast<float*>( work ), &lwork, rwork, &lrwork, iwork, &liwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues of a dense double precision complex
+//        column-major Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param range \c 'A' for all eigenvalues, \c 'V' for the eigenvalues in the half-open interval
+//              \f$(vl..vu]\f$, or \c 'I' for the eigenvalues with index \f$[il..iu]\f$.
+// \param uplo \c 'L' in case the lower part of \a A is stored, \c 'U' in case of the upper part.
+// \param n The number of rows and columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision complex column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for eigenvalues (\a range = \c 'V').
+// \param vu The upper bound of the interval to be searched for eigenvalues (\a range = \c 'V').
+// \param il The 1-based index of the smallest eigenvalue to be returned (\a range = \c 'I').
+// \param iu The 1-based index of the largest eigenvalue to be returned (\a range = \c 'I').
+// \param abstol The absolute error tolerance for the eigenvalues.
+// \param m The total number of eigenvalues found.
+// \param w Pointer to the first element of the vector for the eigenvalues; size >= \a n.
+// \param Z Pointer to the first element of the column-major matrix for the eigenvectors.
+// \param ldz The total number of elements between two columns of the matrix \a Z.
+// \param isuppz Auxiliary array for the support of the eigenvectors; size >= 2*max( 1, \a m ).
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param rwork Auxiliary array; size >= max( 1, \a lrwork ).
+// \param lrwork The dimension of the array \a rwork (see online reference for details).
+// \param iwork Auxiliary array; size >= max( 1, \a liwork ).
+// \param liwork The dimension of the array \a iwork (see online reference for details).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes selected eigenvalues and, optionally, the corresponding eigenvectors of a
+// Hermitian \a n-by-\a n double precision complex column-major matrix based on the LAPACK zheevr()
+// function, which uses the Relatively Robust Representations (MRRR) algorithm. The \a m selected
+// eigenvalues are returned in ascending order in the first \a m elements of \a w and, in case
+// \a jobz is \c 'V', the corresponding eigenvectors are returned in the first \a m columns of \a Z.
+// Note that the matrix \a A is destroyed on exit. Calling the function with \a lwork, \a lrwork,
+// and \a liwork set to -1 performs a workspace query.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: Internal error.
+//
+// For more information on the zheevr() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void heevr( char jobz, char range, char uplo, int n, complex<double>* A, int lda,
+                   double vl, double vu, int il, int iu, double abstol, int* m, double* w,
+                   complex<double>* Z, int ldz, int* isuppz, complex<double>* work, int lwork,
+                   double* rwork, int lrwork, int* iwork, int liwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   zheevr_( &jobz, &range, &uplo, &n, reinterpret_cast<double*>( A ), &lda, &vl, &vu, &il, &iu,
+            &abstol, m, w, reinterpret_cast<double*>( Z ), &ldz, isuppz,
+            reinterpret_cast<double*>( work ), &lwork, rwork, &lrwork, iwork, &liwork, info );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
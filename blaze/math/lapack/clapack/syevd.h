@@ -0,0 +1,182 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/syevd.h
+//  \brief Header file for the CLAPACK syevd wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_SYEVD_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_SYEVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+extern "C" {
+
+void ssyevd_( char* jobz, char* uplo, int* n, float* A, int* lda, float* w, float* work, int* lwork,
+              int* iwork, int* liwork, int* info );
+void dsyevd_( char* jobz, char* uplo, int* n, double* A, int* lda, double* w, double* work, int* lwork,
+              int* iwork, int* liwork, int* info );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SYMMETRIC MATRIX EIGENVALUE FUNCTIONS (SYEVD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK symmetric matrix eigenvalue functions (syevd) */
+//@{
+inline void syevd( char jobz, char uplo, int n, float* A, int lda, float* w,
+                   float* work, int lwork, int* iwork, int liwork, int* info );
+
+inline void syevd( char jobz, char uplo, int n, double* A, int lda, double* w,
+                   double* work, int lwork, int* iwork, int liwork, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense single precision
+//        column-major symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' in case the lower part of \a A is stored, \c 'U' in case of the upper part.
+// \param n The number of rows and columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param w Pointer to the first element of the vector for the eigenvalues.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param iwork Auxiliary array; size >= max( 1, \a liwork ).
+// \param liwork The dimension of the array \a iwork (see online reference for details).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes all eigenvalues and, optionally, all eigenvectors of a symmetric
+// \a n-by-\a n single precision column-major matrix based on the LAPACK ssyevd() function, which
+// uses a divide and conquer algorithm. The eigenvalues are returned in ascending order in \a w. In
+// case \a jobz is \c 'V', on exit \a A contains the orthonormal eigenvectors of the matrix (in the
+// columns of \a A). Calling the function with \a lwork and \a liwork set to -1 performs a workspace
+// query: the optimal workspace sizes are returned in the first elements of the auxiliary arrays.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: The algorithm failed to converge.
+//
+// For more information on the ssyevd() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void syevd( char jobz, char uplo, int n, float* A, int lda, float* w,
+                   float* work, int lwork, int* iwork, int liwork, int* info )
+{
+   ssyevd_( &jobz, &uplo, &n, A, &lda, w, work, &lwork, iwork, &liwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense double precision
+//        column-major symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' in case the lower part of \a A is stored, \c 'U' in case of the upper part.
+// \param n The number of rows and columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param w Pointer to the first element of the vector for the eigenvalues.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work (see online reference for details).
+// \param iwork Auxiliary array; size >= max( 1, \a liwork ).
+// \param liwork The dimension of the array \a iwork (see online reference for details).
+// \param info Return code of the function call.
+// \return void
+//
+// This function computes all eigenvalues and, optionally, all eigenvectors of a symmetric
+// \a n-by-\a n double precision column-major matrix based on the LAPACK dsyevd() function, which
+// uses a divide and conquer algorithm. The eigenvalues are returned in ascending order in \a w. In
+// case \a jobz is \c 'V', on exit \a A contains the orthonormal eigenvectors of the matrix (in the
+// columns of \a A). Calling the function with \a lwork and \a liwork set to -1 performs a workspace
+// query: the optimal workspace sizes are returned in the first elements of the auxiliary arrays.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: The algorithm failed to converge.
+//
+// For more information on the dsyevd() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+inline void syevd( char jobz, char uplo, int n, double* A, int lda, double* w,
+                   double* work, int lwork, int* iwork, int liwork, int* info )
+{
+   dsyevd_( &jobz, &uplo, &n, A, &lda, w, work, &lwork, iwork, &liwork, info );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,480 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gesdd.h
+//  \brief Header file for the CLAPACK gesdd wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GESDD_H_
+#define _BLAZE_MATH_LAPACK_GESDD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/clapack/gesdd.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SINGULAR VALUE DECOMPOSITION FUNCTIONS (GESDD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK singular value decomposition functions (gesdd) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+                   LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz,
+                   LapackWorkspace< ElementType_<MT1> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the LAPACK gesdd() kernels for real column-major matrices.
+// \ingroup lapack_singular_value
+//
+// \param jobz The computation mode for the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param m The number of rows of the given matrix.
+// \param n The number of columns of the given matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename ET >  // Element type of the matrix
+inline DisableIf_< IsComplex<ET> >
+   gesdd_backend( char jobz, int m, int n, ET* A, int lda, ET* s,
+                  ET* U, int ldu, ET* VT, int ldvt, LapackWorkspace<ET>& ws )
+{
+   using boost::numeric_cast;
+
+   int info( 0 );
+
+   if( !ws.isQueried( "gesdd", jobz, 'A', m, n ) )
+   {
+      ET lwork( 0 );
+
+      gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt, &lwork, -1, nullptr, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "gesdd", jobz, 'A', m, n, numeric_cast<int>( lwork ), 0, 8*min( m, n ) );
+   }
+
+   gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt, ws.work(), ws.lwork(), ws.iwork(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Singular value decomposition failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the LAPACK gesdd() kernels for complex column-major matrices.
+// \ingroup lapack_singular_value
+//
+// \param jobz The computation mode for the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param m The number of rows of the given matrix.
+// \param n The number of columns of the given matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename ET >  // Element type of the matrix
+inline EnableIf_< IsComplex<ET> >
+   gesdd_backend( char jobz, int m, int n, ET* A, int lda, UnderlyingBuiltin_<ET>* s,
+                  ET* U, int ldu, ET* VT, int ldvt, LapackWorkspace<ET>& ws )
+{
+   using boost::numeric_cast;
+
+   int info( 0 );
+
+   if( !ws.isQueried( "gesdd", jobz, 'A', m, n ) )
+   {
+      const int minmn( min( m, n ) );
+      const int maxmn( max( m, n ) );
+
+      const int lrwork( ( jobz == 'N' )
+                        ?( 7*minmn )
+                        :( max( 5*minmn*minmn + 5*minmn,
+                                2*maxmn*minmn + 2*minmn*minmn + minmn ) ) );
+
+      ET lwork( 0 );
+
+      gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt, &lwork, -1, nullptr, nullptr, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "gesdd", jobz, 'A', m, n, numeric_cast<int>( real( lwork ) ), lrwork, 8*minmn );
+   }
+
+   gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt,
+          ws.work(), ws.lwork(), ws.rwork(), ws.iwork(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Singular value decomposition failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the singular values of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of a general \a m-by-\a n matrix based on the LAPACK
+// gesdd() functions, which use a divide and conquer algorithm. Note that the function only works
+// for general, non-adapted matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with any adapted matrix or
+// matrices of any other element type results in a compile time error!
+//
+// The \a min(m,n) singular values are returned in descending order in the given vector \a s,
+// which is resized to the correct size (if possible and necessary). Note that the content of
+// \a A is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given vector \a s is a fixed size vector and the size doesn't match;
+//  - ... the singular value decomposition fails.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the gesdd() functions (i.e. sgesdd(), dgesdd(), cgesdd(), and zgesdd())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a s may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   gesdd( ~A, ~s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the singular values of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of a general matrix (see the overload without
+// workspace for a detailed description). The auxiliary arrays are taken from the given workspace
+// \a ws: The optimal workspace size is only queried in case the workspace has not yet been used
+// for a gesdd() call of the same size, and memory is only allocated in case the workspace is too
+// small.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a s may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+                   LapackWorkspace< ElementType_<MT> >& ws )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT> >, ElementType_<VT> );
+
+   typedef ElementType_<MT>  ET;
+
+   resize( ~s, min( (~A).rows(), (~A).columns() ), false );
+
+   int m  ( numeric_cast<int>( SO ? (~A).rows() : (~A).columns() ) );
+   int n  ( numeric_cast<int>( SO ? (~A).columns() : (~A).rows() ) );
+   int lda( numeric_cast<int>( (~A).spacing() ) );
+   int ldu( 1 );
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   gesdd_backend( 'N', m, n, (~A).data(), lda, (~s).data(),
+                  static_cast<ET*>( nullptr ), ldu, static_cast<ET*>( nullptr ), ldu, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobz \c 'A' for the full decomposition, \c 'S' for the thin decomposition.
+// \return void
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular value decomposition of a general \a m-by-\a n matrix based
+// on the LAPACK gesdd() functions, which use a divide and conquer algorithm. Note that the function
+// only works for general, non-adapted matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with any adapted matrix or
+// matrices of any other element type results in a compile time error!
+//
+// The resulting decomposition has the form
+
+                              \f[ A = U \cdot S \cdot V, \f]
+
+// where \c S is a diagonal matrix containing the \a min(m,n) singular values in descending order,
+// \c U contains the left singular vectors in its columns, and \c V contains the conjugate
+// transposed right singular vectors in its rows. In case \a jobz is \c 'A', \a U is resized to
+// \a m-by-\a m and \a V is resized to \a n-by-\a n. In case \a jobz is \c 'S', \a U is resized to
+// \a m-by-\a min(m,n) and \a V is resized to \a min(m,n)-by-\a n. Note that the content of \a A
+// is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given \a jobz argument is neither \c 'A' nor \c 'S';
+//  - ... the given vector or matrices are fixed size and the sizes don't match;
+//  - ... the singular value decomposition fails.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the gesdd() functions (i.e. sgesdd(), dgesdd(), cgesdd(), and zgesdd())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of all matrices
+        , typename MT2  // Type of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3 > // Type of the matrix V
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   gesdd( ~A, ~U, ~s, ~V, jobz, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobz \c 'A' for the full decomposition, \c 'S' for the thin decomposition.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular value decomposition of a general matrix (see the overload
+// without workspace for a detailed description). The auxiliary arrays are taken from the given
+// workspace \a ws, which is only queried and grown if necessary.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of all matrices
+        , typename MT2  // Type of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3 > // Type of the matrix V
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz,
+                   LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT1> >, ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT3> );
+
+   if( jobz != 'A' && jobz != 'S' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid jobz argument provided" );
+   }
+
+   const size_t M( (~A).rows() );
+   const size_t N( (~A).columns() );
+   const size_t K( min( M, N ) );
+
+   resize( ~s, K, false );
+   resize( ~U, M, ( jobz == 'A' ? M : K ), false );
+   resize( ~V, ( jobz == 'A' ? N : K ), N, false );
+
+   int m  ( numeric_cast<int>( M ) );
+   int n  ( numeric_cast<int>( N ) );
+   int lda( numeric_cast<int>( (~A).spacing() ) );
+   int ldu( numeric_cast<int>( (~U).spacing() ) );
+   int ldv( numeric_cast<int>( (~V).spacing() ) );
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   // A row-major matrix is handled as its column-major transpose A^T = U' S V'^H: The memory of
+   // V receives U' and the memory of U receives V'^H, which results in A = U S V.
+   if( SO ) {
+      gesdd_backend( jobz, m, n, (~A).data(), lda, (~s).data(),
+                     (~U).data(), ldu, (~V).data(), ldv, ws );
+   }
+   else {
+      gesdd_backend( jobz, n, m, (~A).data(), lda, (~s).data(),
+                     (~V).data(), ldv, (~U).data(), ldu, ws );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
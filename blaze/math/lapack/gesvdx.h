@@ -0,0 +1,556 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gesvdx.h
+//  \brief Header file for the CLAPACK gesvdx wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GESVDX_H_
+#define _BLAZE_MATH_LAPACK_GESVDX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/clapack/gesvdx.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Arithmetic.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SELECTED SINGULAR VALUE FUNCTIONS (GESVDX)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK selected singular value functions (gesvdx) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+                      LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3, typename ST >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3, typename ST >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                      LapackWorkspace< ElementType_<MT1> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the LAPACK gesvdx() kernels for real column-major matrices.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to skip them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to skip them.
+// \param range \c 'V' for a value range, \c 'I' for an index range.
+// \param m The number of rows of the given matrix.
+// \param n The number of columns of the given matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param vl The lower bound of the value range (\a range = \c 'V').
+// \param vu The upper bound of the value range (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to compute (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to compute (\a range = \c 'I').
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed singular values.
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename ET >  // Element type of the matrix
+inline DisableIf_< IsComplex<ET>, int >
+   gesvdx_backend( char jobu, char jobv, char range, int m, int n, ET* A, int lda,
+                   ET vl, ET vu, int il, int iu, ET* s, ET* U, int ldu, ET* VT, int ldvt,
+                   LapackWorkspace<ET>& ws )
+{
+   using boost::numeric_cast;
+
+   int ns  ( 0 );
+   int info( 0 );
+
+   if( !ws.isQueried( "gesvdx", jobu, range, m, n ) )
+   {
+      ET lwork( 0 );
+
+      gesvdx( jobu, jobv, range, m, n, A, lda, vl, vu, il, iu, &ns, s,
+              U, ldu, VT, ldvt, &lwork, -1, nullptr, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "gesvdx", jobu, range, m, n, numeric_cast<int>( lwork ), 0, 12*min( m, n ) );
+   }
+
+   gesvdx( jobu, jobv, range, m, n, A, lda, vl, vu, il, iu, &ns, s,
+           U, ldu, VT, ldvt, ws.work(), ws.lwork(), ws.iwork(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Singular value decomposition failed" );
+   }
+
+   return ns;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the LAPACK gesvdx() kernels for complex column-major matrices.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to skip them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to skip them.
+// \param range \c 'V' for a value range, \c 'I' for an index range.
+// \param m The number of rows of the given matrix.
+// \param n The number of columns of the given matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param vl The lower bound of the value range (\a range = \c 'V').
+// \param vu The upper bound of the value range (\a range = \c 'V').
+// \param il The 1-based index of the largest singular value to compute (\a range = \c 'I').
+// \param iu The 1-based index of the smallest singular value to compute (\a range = \c 'I').
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed singular values.
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename ET >  // Element type of the matrix
+inline EnableIf_< IsComplex<ET>, int >
+   gesvdx_backend( char jobu, char jobv, char range, int m, int n, ET* A, int lda,
+                   UnderlyingBuiltin_<ET> vl, UnderlyingBuiltin_<ET> vu, int il, int iu,
+                   UnderlyingBuiltin_<ET>* s, ET* U, int ldu, ET* VT, int ldvt,
+                   LapackWorkspace<ET>& ws )
+{
+   using boost::numeric_cast;
+
+   int ns  ( 0 );
+   int info( 0 );
+
+   if( !ws.isQueried( "gesvdx", jobu, range, m, n ) )
+   {
+      const int minmn( min( m, n ) );
+
+      ET lwork( 0 );
+
+      gesvdx( jobu, jobv, range, m, n, A, lda, vl, vu, il, iu, &ns, s,
+              U, ldu, VT, ldvt, &lwork, -1, nullptr, nullptr, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "gesvdx", jobu, range, m, n, numeric_cast<int>( real( lwork ) ),
+                   17*minmn*minmn, 12*minmn );
+   }
+
+   gesvdx( jobu, jobv, range, m, n, A, lda, vl, vu, il, iu, &ns, s,
+           U, ldu, VT, ldvt, ws.work(), ws.lwork(), ws.rwork(), ws.iwork(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Singular value decomposition failed" );
+   }
+
+   return ns;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values of a general \a m-by-\a n matrix
+// based on the LAPACK gesvdx() functions. Note that the function only works for general,
+// non-adapted matrices with \c float, \c double, \c complex<float>, or \c complex<double> element
+// type. The attempt to call the function with any adapted matrix or matrices of any other element
+// type results in a compile time error!
+//
+// The type of the two range arguments \a low and \a upp determines the selected singular values:
+//
+//  - floating point arguments select all singular values in the half-open interval
+//    \f$(low..upp]\f$;
+//  - integral arguments select the singular values with the 0-based indices \f$[low..upp]\f$,
+//    where index 0 refers to the largest singular value.
+//
+// The selected singular values are returned in descending order in the given vector \a s, which
+// is resized to the number of computed singular values. This number is also returned by the
+// function. Note that the content of \a A is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given vector \a s is a fixed size vector;
+//  - ... the given value range is empty or negative (\a low >= \a upp or \a low < 0);
+//  - ... the given index range is invalid (\a low > \a upp or \a upp >= \a min(m,n));
+//  - ... the singular value decomposition fails.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the gesvdx() functions (i.e. sgesvdx(), dgesvdx(), cgesvdx(), and
+// zgesvdx()) see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a s may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF      // Transpose flag of the vector s
+        , typename ST > // Type of the range bounds
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   return gesvdx( ~A, ~s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values of a general matrix (see the
+// overload without workspace for a detailed description). The auxiliary arrays are taken from
+// the given workspace \a ws, which is only queried and grown if necessary.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a s may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF      // Transpose flag of the vector s
+        , typename ST > // Type of the range bounds
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+                      LapackWorkspace< ElementType_<MT> >& ws )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT> >, ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_BE_ARITHMETIC_TYPE( ST );
+
+   typedef ElementType_<MT>  ET;
+   typedef ElementType_<VT>  BT;
+
+   const size_t K( min( (~A).rows(), (~A).columns() ) );
+   const bool byValue( IsFloatingPoint<ST>::value );
+
+   if( byValue && ( !( low < upp ) || low < ST(0) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid value range provided" );
+   }
+
+   if( !byValue && ( low < ST(0) || upp < low || upp >= ST( K ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid index range provided" );
+   }
+
+   resize( ~s, K, false );
+
+   int m  ( numeric_cast<int>( SO ? (~A).rows() : (~A).columns() ) );
+   int n  ( numeric_cast<int>( SO ? (~A).columns() : (~A).rows() ) );
+   int lda( numeric_cast<int>( (~A).spacing() ) );
+   BT  vl ( byValue ? BT( low ) : BT(0) );
+   BT  vu ( byValue ? BT( upp ) : BT(0) );
+   int il ( byValue ? 1 : static_cast<int>( low ) + 1 );
+   int iu ( byValue ? 1 : static_cast<int>( upp ) + 1 );
+
+   if( K == 0UL ) {
+      return 0UL;
+   }
+
+   const int ns( gesvdx_backend( 'N', 'N', ( byValue ? 'V' : 'I' ), m, n, (~A).data(), lda,
+                                 vl, vu, il, iu, (~s).data(), static_cast<ET*>( nullptr ), 1,
+                                 static_cast<ET*>( nullptr ), 1, ws ) );
+
+   resize( ~s, ns, true );
+
+   return ns;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values and singular vectors of the given
+//        dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values and the corresponding singular
+// vectors of a general \a m-by-\a n matrix based on the LAPACK gesvdx() functions. The selection
+// of the singular values works as described for the gesvdx() overload without singular vectors.
+// The \a k selected singular values are returned in descending order in \a s, \a U is resized to
+// \a m-by-\a k and contains the corresponding left singular vectors in its columns, and \a V is
+// resized to \a k-by-\a n and contains the corresponding conjugate transposed right singular
+// vectors in its rows. Note that the content of \a A is destroyed.
+//
+// For more information on the gesvdx() functions (i.e. sgesvdx(), dgesvdx(), cgesvdx(), and
+// zgesvdx()) see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of all matrices
+        , typename MT2  // Type of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , typename ST > // Type of the range bounds
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   return gesvdx( ~A, ~U, ~s, ~V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected singular values and singular vectors of the given
+//        dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed singular values.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a selected subset of the singular values and singular vectors of a
+// general matrix (see the overload without workspace for a detailed description). The auxiliary
+// arrays are taken from the given workspace \a ws, which is only queried and grown if necessary.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of all matrices
+        , typename MT2  // Type of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3  // Type of the matrix V
+        , typename ST > // Type of the range bounds
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                      LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT1> >, ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT3> );
+
+   BLAZE_CONSTRAINT_MUST_BE_ARITHMETIC_TYPE( ST );
+
+   typedef ElementType_<VT>  BT;
+
+   const size_t M( (~A).rows() );
+   const size_t N( (~A).columns() );
+   const size_t K( min( M, N ) );
+   const bool byValue( IsFloatingPoint<ST>::value );
+
+   if( byValue && ( !( low < upp ) || low < ST(0) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid value range provided" );
+   }
+
+   if( !byValue && ( low < ST(0) || upp < low || upp >= ST( K ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid index range provided" );
+   }
+
+   const size_t kmax( byValue ? K : size_t( upp - low ) + 1UL );
+
+   resize( ~s, K, false );
+   resize( ~U, M, kmax, false );
+   resize( ~V, kmax, N, false );
+
+   int m  ( numeric_cast<int>( M ) );
+   int n  ( numeric_cast<int>( N ) );
+   int lda( numeric_cast<int>( (~A).spacing() ) );
+   int ldu( numeric_cast<int>( (~U).spacing() ) );
+   int ldv( numeric_cast<int>( (~V).spacing() ) );
+   BT  vl ( byValue ? BT( low ) : BT(0) );
+   BT  vu ( byValue ? BT( upp ) : BT(0) );
+   int il ( byValue ? 1 : static_cast<int>( low ) + 1 );
+   int iu ( byValue ? 1 : static_cast<int>( upp ) + 1 );
+   int ns ( 0 );
+
+   if( K == 0UL ) {
+      return 0UL;
+   }
+
+   // A row-major matrix is handled as its column-major transpose A^T = U' S V'^H: The memory of
+   // V receives U' and the memory of U receives V'^H, which results in A = U S V.
+   if( SO ) {
+      ns = gesvdx_backend( 'V', 'V', ( byValue ? 'V' : 'I' ), m, n, (~A).data(), lda,
+                           vl, vu, il, iu, (~s).data(), (~U).data(), ldu, (~V).data(), ldv, ws );
+   }
+   else {
+      ns = gesvdx_backend( 'V', 'V', ( byValue ? 'V' : 'I' ), n, m, (~A).data(), lda,
+                           vl, vu, il, iu, (~s).data(), (~V).data(), ldv, (~U).data(), ldu, ws );
+   }
+
+   resize( ~s, ns, true );
+
+   if( size_t( ns ) != kmax ) {
+      resize( ~U, M, ns, true );
+      resize( ~V, ns, N, true );
+   }
+
+   return ns;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
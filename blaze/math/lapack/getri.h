@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <boost/cast.hpp>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getri.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 
 
@@ -130,9 +130,9 @@ inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv )
    }
 
    int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ArenaArray<ET> work( lwork );
 
-   getri( n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+   getri( n, (~A).data(), lda, ipiv, work.data(), lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
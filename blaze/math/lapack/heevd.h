@@ -0,0 +1,265 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/heevd.h
+//  \brief Header file for the CLAPACK heevd wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_HEEVD_H_
+#define _BLAZE_MATH_LAPACK_HEEVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/heevd.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK HERMITIAN MATRIX EIGENVALUE FUNCTIONS (HEEVD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK Hermitian matrix eigenvalue functions (heevd) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                   LapackWorkspace< ElementType_<MT> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and, optionally, all eigenvectors of a Hermitian matrix
+// based on the LAPACK heevd() functions, which use a divide and conquer algorithm. Note that the
+// function only works for general, non-adapted matrices with \c complex<float> or
+// \c complex<double> element type. The attempt to call the function with any adapted matrix or
+// matrices of any other element type results in a compile time error!
+//
+// The eigenvalues are returned in ascending order in the given vector \a w, which is resized to
+// the correct size (if possible and necessary). In case \a jobz is set to \c 'V', on exit \a A
+// contains the unitary eigenvectors of the matrix: in case \a A is a column-major matrix the
+// eigenvectors are stored in the columns of \a A, in case \a A is a row-major matrix they are
+// stored in the rows of \a A. In case \a jobz is set to \c 'N', the content of the part of \a A
+// selected by \a uplo is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a square matrix;
+//  - ... the given vector \a w is a fixed size vector and the size doesn't match;
+//  - ... the given \a jobz argument is neither \c 'V' nor \c 'N';
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the eigenvalue computation fails.
+//
+// In all failure cases an exception is thrown.
+//
+// This function allocates the auxiliary arrays required by the LAPACK function on every call. In
+// order to perform several eigenvalue computations without repeated workspace queries and memory
+// allocations, use the overload taking a LapackWorkspace.
+//
+// For more information on the heevd() functions (i.e. cheevd() and zheevd()) see the LAPACK
+// online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a w may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   heevd( ~A, ~w, jobz, uplo, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and, optionally, all eigenvectors of a Hermitian matrix
+// (see the overload without workspace for a detailed description). In contrast to the overload
+// without workspace, the auxiliary arrays are taken from the given workspace \a ws: The optimal
+// workspace size is only queried in case the workspace has not yet been used for a heevd() call
+// of the same size, and memory is only allocated in case the workspace is too small.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a w may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                   LapackWorkspace< ElementType_<MT> >& ws )
+{
+   using boost::numeric_cast;
+
+   typedef ElementType_<MT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_<ET>, ElementType_<VT> );
+
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( jobz != 'V' && jobz != 'N' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid jobz argument provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   resize( ~w, (~A).rows(), false );
+
+   int n   ( numeric_cast<int>( (~A).rows()    ) );
+   int lda ( numeric_cast<int>( (~A).spacing() ) );
+   int info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT>::value ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+   if( !ws.isQueried( "heevd", jobz, 'A', n, n ) )
+   {
+      ET  lwork ( 0 );
+      BT  lrwork( 0 );
+      int liwork( 0 );
+
+      heevd( jobz, uplo, n, (~A).data(), lda, (~w).data(),
+             &lwork, -1, &lrwork, -1, &liwork, -1, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "heevd", jobz, 'A', n, n, numeric_cast<int>( real( lwork ) ),
+                   numeric_cast<int>( lrwork ), liwork );
+   }
+
+   heevd( jobz, uplo, n, (~A).data(), lda, (~w).data(),
+          ws.work(), ws.lwork(), ws.rwork(), ws.lrwork(), ws.iwork(), ws.liwork(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Eigenvalue computation failed" );
+   }
+
+   if( IsRowMajorMatrix<MT>::value && jobz == 'V' ) {
+      for( int i=0; i<n; ++i ) {
+         for( int j=0; j<n; ++j ) {
+            (~A)(i,j) = conj( (~A)(i,j) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
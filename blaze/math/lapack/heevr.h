@@ -0,0 +1,478 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/heevr.h
+//  \brief Header file for the CLAPACK heevr wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_HEEVR_H_
+#define _BLAZE_MATH_LAPACK_HEEVR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/heevr.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Arithmetic.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK HERMITIAN MATRIX SELECTED EIGENVALUE FUNCTIONS (HEEVR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK Hermitian matrix selected eigenvalue functions (heevr) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t heevr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t heevr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp,
+                     LapackWorkspace< ElementType_<MT> >& ws );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
+inline size_t heevr( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& Z,
+                     char uplo, ST low, ST upp );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
+inline size_t heevr( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& Z,
+                     char uplo, ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the LAPACK heevr() kernels for dense Hermitian matrices.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param Z Pointer to the resulting matrix of eigenvectors (\c nullptr to skip the eigenvectors).
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is the backend implementation of the heevr() kernels for dense Hermitian matrices.
+// It selects the LAPACK range argument based on the type of the range bounds: floating point bounds
+// select the value range \f$(low..upp]\f$, integral bounds select the 0-based index range
+// \f$[low..upp]\f$.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2      // Storage order of the matrix Z
+        , typename ST > // Type of the range bounds
+inline size_t heevr_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
+                             DenseMatrix<MT2,SO2>* Z, char uplo, ST low, ST upp,
+                             LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT1> >, ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_BE_ARITHMETIC_TYPE( ST );
+
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const bool byValue( IsFloatingPoint<ST>::value );
+
+   if( byValue && !( low < upp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid value range provided" );
+   }
+
+   if( !byValue && ( low < ST(0) || upp < low || upp >= ST( (~A).rows() ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid index range provided" );
+   }
+
+   const size_t mmax( byValue ? (~A).rows() : size_t( upp - low ) + 1UL );
+
+   resize( ~w, (~A).rows(), false );
+
+   if( Z != nullptr ) {
+      if( IsRowMajorMatrix<MT2>::value )
+         resize( ~*Z, mmax, (~A).rows(), false );
+      else
+         resize( ~*Z, (~A).rows(), mmax, false );
+   }
+
+   char jobz  ( Z != nullptr ? 'V' : 'N' );
+   char range ( byValue ? 'V' : 'I' );
+   int  n     ( numeric_cast<int>( (~A).rows()    ) );
+   int  lda   ( numeric_cast<int>( (~A).spacing() ) );
+   BT   vl    ( byValue ? BT( low ) : BT(0) );
+   BT   vu    ( byValue ? BT( upp ) : BT(0) );
+   int  il    ( byValue ? 1 : static_cast<int>( low ) + 1 );
+   int  iu    ( byValue ? 1 : static_cast<int>( upp ) + 1 );
+   ET*  zdata ( Z != nullptr ? (~*Z).data() : nullptr );
+   int  ldz   ( Z != nullptr ? numeric_cast<int>( (~*Z).spacing() ) : 1 );
+   int  m     ( 0 );
+   int  info  ( 0 );
+
+   if( n == 0 ) {
+      return 0UL;
+   }
+
+   if( IsRowMajorMatrix<MT1>::value ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+   if( !ws.isQueried( "heevr", jobz, range, n, n ) )
+   {
+      ET  lwork ( 0 );
+      BT  lrwork( 0 );
+      int liwork( 0 );
+      int isuppz[2];
+
+      heevr( jobz, range, uplo, n, (~A).data(), lda, vl, vu, il, iu, BT(0), &m, (~w).data(),
+             zdata, ldz, isuppz, &lwork, -1, &lrwork, -1, &liwork, -1, &info );
+
+      BLAZE_INTERNAL_ASSERT( info == 0, "Invalid workspace query" );
+
+      ws.setQuery( "heevr", jobz, range, n, n, numeric_cast<int>( real( lwork ) ),
+                   numeric_cast<int>( lrwork ), liwork + 2*n );
+   }
+
+   heevr( jobz, range, uplo, n, (~A).data(), lda, vl, vu, il, iu, BT(0), &m, (~w).data(),
+          zdata, ldz, ws.iwork(), ws.work(), ws.lwork(), ws.rwork(), ws.lrwork(),
+          ws.iwork()+2*n, ws.liwork()-2*n, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Eigenvalue computation failed" );
+   }
+
+   resize( ~w, m, true );
+
+   if( Z != nullptr && size_t( m ) != mmax ) {
+      if( IsRowMajorMatrix<MT2>::value )
+         resize( ~*Z, m, n, true );
+      else
+         resize( ~*Z, n, m, true );
+   }
+
+   if( Z != nullptr && IsRowMajorMatrix<MT1>::value ) {
+      for( size_t i=0UL; i<(~*Z).rows(); ++i ) {
+         for( size_t j=0UL; j<(~*Z).columns(); ++j ) {
+            (~*Z)(i,j) = conj( (~*Z)(i,j) );
+         }
+      }
+   }
+
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues of the given dense Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues of a Hermitian matrix based on the
+// LAPACK heevr() functions, which use the Relatively Robust Representations (MRRR) algorithm. Note
+// that the function only works for general, non-adapted matrices with \c complex<float> or
+// \c complex<double> element type. The attempt to call the function with any adapted matrix or
+// matrices of any other element type results in a compile time error!
+//
+// The type of the two range arguments \a low and \a upp determines the selected eigenvalues:
+//
+//  - floating point arguments select all eigenvalues in the half-open interval \f$(low..upp]\f$;
+//  - integral arguments select the eigenvalues with the 0-based indices \f$[low..upp]\f$, where
+//    index 0 refers to the smallest eigenvalue.
+//
+// The selected eigenvalues are returned in ascending order in the given vector \a w, which is
+// resized to the number of computed eigenvalues. This number is also returned by the function.
+// Note that the content of the part of \a A selected by \a uplo is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a square matrix;
+//  - ... the given vector \a w is a fixed size vector;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the given value range is empty (\a low >= \a upp);
+//  - ... the given index range is invalid (\a low > \a upp or \a upp >= \a n);
+//  - ... the eigenvalue computation fails.
+//
+// In all failure cases an exception is thrown.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<blaze::complex<double>,blaze::columnMajor> A( 100UL, 100UL );
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   // ... Initialization of A as Hermitian matrix
+
+   blaze::DynamicMatrix<blaze::complex<double>,blaze::columnMajor> B( A );
+   heevr( B, w, 'L', 0, 4 );  // Computes the five smallest eigenvalues
+
+   B = A;
+   heevr( B, w, 'L', -1.0, 1.0 );  // Computes all eigenvalues in the interval (-1..1]
+   \endcode
+
+// For more information on the heevr() functions (i.e. cheevr() and zheevr()) see the LAPACK
+// online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a w may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF      // Transpose flag of the vector w
+        , typename ST > // Type of the range bounds
+inline size_t heevr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT> > ws;
+   return heevr( ~A, ~w, uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues of the given dense Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues of a Hermitian matrix (see the
+// overload without workspace for a detailed description). The auxiliary arrays are taken from
+// the given workspace \a ws, which is only queried and grown if necessary.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a w may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF      // Transpose flag of the vector w
+        , typename ST > // Type of the range bounds
+inline size_t heevr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp,
+                     LapackWorkspace< ElementType_<MT> >& ws )
+{
+   return heevr_backend( ~A, ~w, static_cast<MT*>( nullptr ), uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues and eigenvectors of the given dense
+//        Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param Z The resulting matrix of eigenvectors.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues and the corresponding unitary
+// eigenvectors of a Hermitian matrix based on the LAPACK heevr() functions. The selection of the
+// eigenvalues works as described for the heevr() overload without eigenvectors. The \a m selected
+// eigenvalues are returned in ascending order in \a w. In case \a Z is a column-major matrix, it
+// is resized to \a n-by-\a m and the eigenvectors are stored in its columns, in case \a Z is a
+// row-major matrix, it is resized to \a m-by-\a n and the eigenvectors are stored in its rows.
+// Note that the content of the part of \a A selected by \a uplo is destroyed.
+//
+// For more information on the heevr() functions (i.e. cheevr() and zheevr()) see the LAPACK
+// online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a w, and \a Z may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2      // Storage order of the matrix Z
+        , typename ST > // Type of the range bounds
+inline size_t heevr( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& Z,
+                     char uplo, ST low, ST upp )
+{
+   LapackWorkspace< ElementType_<MT1> > ws;
+   return heevr( ~A, ~w, ~Z, uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing selected eigenvalues and eigenvectors of the given dense
+//        Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param Z The resulting matrix of eigenvectors.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the value or index range.
+// \param upp The upper bound of the value or index range.
+// \param ws The workspace for the auxiliary arrays of the LAPACK function.
+// \return The number of computed eigenvalues.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes a selected subset of the eigenvalues and eigenvectors of a Hermitian
+// matrix (see the overload without workspace for a detailed description). The auxiliary arrays
+// are taken from the given workspace \a ws, which is only queried and grown if necessary.
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a w, and \a Z may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2      // Storage order of the matrix Z
+        , typename ST > // Type of the range bounds
+inline size_t heevr( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& Z,
+                     char uplo, ST low, ST upp, LapackWorkspace< ElementType_<MT1> >& ws )
+{
+   return heevr_backend( ~A, ~w, &Z, uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,589 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/geqrf.h
+//  \brief Header file for the native QR decomposition functions (geqrf)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE QR DECOMPOSITION FUNCTIONS (GEQRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native QR decomposition functions (geqrf) */
+//@{
+template< typename MT, bool SO >
+inline void nativeGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of an elementary reflector.
+// \ingroup lapack_decomposition
+//
+// \param alpha The first element of the vector to be reflected.
+// \param x The remaining elements of the vector to be reflected.
+// \return The scalar factor \c tau of the elementary reflector.
+//
+// This function generates the elementary reflector \f$ H = I - tau \cdot v \cdot v^H \f$ such
+// that \f$ H^H \cdot (alpha,x)^T = (beta,0,...,0)^T \f$, where \c beta is real (see the LAPACK
+// larfg() functions). On exit, \c beta is stored in \a alpha and the elements \c v(1:n) of the
+// vector \c v (with \c v(0) = 1) are stored in \a x.
+*/
+template< typename VT >  // Type of the vector
+ElementType_<VT> nativeLarfg( ElementType_<VT>& alpha, VT& x )
+{
+   typedef ElementType_<VT>          ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t n( x.size() );
+   const ET a( alpha );
+
+   const BT xnorm2( ( n > 0UL )?( real( ctrans( x ) * x ) ):( BT(0) ) );
+
+   if( xnorm2 == BT(0) && imag( a ) == BT(0) ) {
+      return ET(0);
+   }
+
+   const BT anorm2( real( a )*real( a ) + imag( a )*imag( a ) );
+   const BT beta( -std::copysign( std::sqrt( anorm2 + xnorm2 ), real( a ) ) );
+
+   if( n > 0UL ) {
+      x *= ET(1) / ( a - beta );
+   }
+
+   alpha = beta;
+
+   return ( ET(beta) - a ) / beta;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Formation of the triangular factor of a block reflector.
+// \ingroup lapack_decomposition
+//
+// \param V The unit lower trapezoidal matrix of the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \param T The resulting upper triangular factor.
+// \return void
+//
+// This function forms the upper triangular factor \c T of the block reflector
+// \f$ H = H(0) H(1) ... H(k-1) = I - V \cdot T \cdot V^H \f$ (see the LAPACK larft() functions).
+*/
+template< typename MT1   // Type of the reflector matrix
+        , typename ET    // Element type of the scalar factors
+        , typename MT2 > // Type of the triangular factor
+void nativeLarft( const MT1& V, const ET* tau, MT2& T )
+{
+   const size_t m( V.rows() );
+   const size_t k( V.columns() );
+
+   resize( T, k, k, false );
+   reset( T );
+
+   DynamicVector<ET,columnVector> tmp;
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      T(i,i) = tau[i];
+
+      if( i == 0UL || tau[i] == ET(0) )
+         continue;
+
+      auto ti( subvector( column( T, i ), 0UL, i ) );
+
+      tmp = ctrans( submatrix( V, i, 0UL, m-i, i ) ) * subvector( column( V, i ), i, m-i );
+      tmp *= -tau[i];
+      ti = submatrix( T, 0UL, 0UL, i, i ) * tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the unit lower trapezoidal matrix of the elementary reflectors of a panel.
+// \ingroup lapack_decomposition
+//
+// \param P The panel containing the elementary reflectors below the diagonal.
+// \param V The resulting unit lower trapezoidal matrix.
+// \return void
+*/
+template< typename MT1   // Type of the panel
+        , typename MT2 > // Type of the reflector matrix
+void nativeReflectors( const MT1& P, MT2& V )
+{
+   typedef ElementType_<MT2>  ET;
+
+   const size_t m( P.rows() );
+   const size_t k( P.columns() );
+
+   resize( V, m, k, false );
+   reset( V );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      V(j,j) = ET(1);
+      if( j+1UL < m ) {
+         submatrix( V, j+1UL, j, m-j-1UL, 1UL ) = submatrix( P, j+1UL, j, m-j-1UL, 1UL );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a block reflector to a matrix from the left.
+// \ingroup lapack_decomposition
+//
+// \param V The unit lower trapezoidal matrix of the elementary reflectors.
+// \param T The upper triangular factor of the block reflector (or its conjugate transpose).
+// \param C The matrix to be updated.
+// \return void
+//
+// This function computes \f$ C = (I - V \cdot T \cdot V^H) \cdot C \f$ by means of three Blaze
+// matrix multiplication kernels (see the LAPACK larfb() functions). The columns of \a C are
+// updated in parallel (in case \a C is sufficiently large).
+*/
+template< typename MT1   // Type of the reflector matrix
+        , typename MT2   // Type of the triangular factor
+        , typename MT3 > // Type of the updated matrix
+void nativeLarfb( const MT1& V, const MT2& T, MT3& C )
+{
+   typedef ElementType_<MT3>  ET;
+
+   const size_t m( C.rows() );
+   const size_t n( C.columns() );
+   const size_t k( V.columns() );
+
+   const DynamicMatrix<ET,columnMajor> Vh( ctrans( V ) );
+
+   const size_t processed = smpFusedKernel<size_t>( n, m*n, [&]( size_t begin, size_t end )
+   {
+      auto Cb( submatrix( C, 0UL, begin, m, end-begin ) );
+
+      DynamicMatrix<ET,columnMajor> W1( k, end-begin );
+      DynamicMatrix<ET,columnMajor> W2( k, end-begin );
+
+      mmm( W1, Vh, Cb, ET(1), ET(0) );
+      mmm( W2, T, W1, ET(1), ET(0) );
+      mmm( Cb, V, W2, ET(-1), ET(1) );
+
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == n, "Invalid number of processed columns" );
+   UNUSED_PARAMETER( processed );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked QR decomposition of a panel.
+// \ingroup lapack_decomposition
+//
+// \param P The panel to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \return void
+//
+// This function performs the unblocked Householder QR decomposition of the given panel (see
+// the LAPACK geqr2() functions). The application of each elementary reflector is evaluated by
+// a vectorized dense vector/dense matrix multiplication and a vectorized outer product.
+*/
+template< typename MT >  // Type of the panel
+void nativeGeqrfPanel( MT& P, ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( P.rows() );
+   const size_t n( P.columns() );
+   const size_t kend( min( m, n ) );
+
+   DynamicVector<ET,rowVector> w;
+
+   for( size_t k=0UL; k<kend; ++k )
+   {
+      auto x( column( submatrix( P, k, k, m-k, 1UL ), 0UL ) );
+      auto v( column( submatrix( P, k+1UL, k, m-k-1UL, 1UL ), 0UL ) );
+      tau[k] = nativeLarfg( P(k,k), v );
+
+      if( k+1UL < n && tau[k] != ET(0) )
+      {
+         const ET beta( P(k,k) );
+         P(k,k) = ET(1);
+
+         auto C( submatrix( P, k, k+1UL, m-k, n-k-1UL ) );
+         w = ctrans( x ) * C;
+         C -= ( conj( tau[k] ) * x ) * w;
+
+         P(k,k) = beta;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked QR decomposition of a dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \return void
+//
+// This function implements the blocked Householder QR decomposition of the given matrix. The
+// matrix is processed in panels of blaze::DECOMPOSITION_BLOCK_SIZE columns. After the unblocked
+// decomposition of a panel, its elementary reflectors are accumulated into a block reflector,
+// which is applied to the trailing matrix by means of the Blaze matrix multiplication kernels.
+*/
+template< typename MT >  // Type of the matrix
+void nativeGeqrfBlocked( MT& A, ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t kend( min( m, n ) );
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t j=0UL; j<kend; j+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jb( min( DECOMPOSITION_BLOCK_SIZE, kend-j ) );
+
+      auto P( submatrix( A, j, j, m-j, jb ) );
+      nativeGeqrfPanel( P, tau+j );
+
+      if( j+jb < n ) {
+         nativeReflectors( P, V );
+         nativeLarft( V, tau+j, T );
+         auto C( submatrix( A, j, j+jb, m-j, n-j-jb ) );
+         nativeLarfb( V, DynamicMatrix<ET,columnMajor>( ctrans( T ) ), C );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked QR decomposition of a small matrix.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the unblocked Householder QR decomposition of a small matrix directly
+// on the given array. In contrast to the blocked algorithm it does not require any temporary
+// vector or matrix and therefore never allocates memory.
+*/
+template< typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeGeqrfUnblocked( ET* A, size_t m, size_t n, size_t rs, size_t cs, ET* tau )
+{
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t kend( m < n ? m : n );
+
+   for( size_t k=0UL; k<kend; ++k )
+   {
+      const ET alpha( A[k*rs+k*cs] );
+
+      BT xnorm2( 0 );
+      for( size_t i=k+1UL; i<m; ++i ) {
+         xnorm2 += real( conj( A[i*rs+k*cs] ) * A[i*rs+k*cs] );
+      }
+
+      if( xnorm2 == BT(0) && imag( alpha ) == BT(0) ) {
+         tau[k] = ET(0);
+         continue;
+      }
+
+      const BT anorm2( real( alpha )*real( alpha ) + imag( alpha )*imag( alpha ) );
+      const BT beta( -std::copysign( std::sqrt( anorm2 + xnorm2 ), real( alpha ) ) );
+      const ET scale( ET(1) / ( alpha - beta ) );
+
+      for( size_t i=k+1UL; i<m; ++i ) {
+         A[i*rs+k*cs] *= scale;
+      }
+
+      A[k*rs+k*cs] = beta;
+      tau[k] = ( ET(beta) - alpha ) / beta;
+
+      const ET ctau( conj( tau[k] ) );
+
+      for( size_t j=k+1UL; j<n; ++j )
+      {
+         ET w( A[k*rs+j*cs] );
+         for( size_t i=k+1UL; i<m; ++i ) {
+            w += conj( A[i*rs+k*cs] ) * A[i*rs+j*cs];
+         }
+
+         w *= ctau;
+
+         A[k*rs+j*cs] -= w;
+         for( size_t i=k+1UL; i<m; ++i ) {
+            A[i*rs+j*cs] -= A[i*rs+k*cs] * w;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief QR decomposition of a small matrix with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a M, \a N ).
+// \return void
+//
+// This function performs the unblocked Householder QR decomposition of a small matrix with
+// compile time dimensions (as for instance a StaticMatrix). Due to the compile time loop bounds
+// the compiler is able to completely unroll the decomposition.
+*/
+template< size_t M       // Number of rows of the matrix
+        , size_t N       // Number of columns of the matrix
+        , typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeGeqrfStatic( ET* A, size_t rs, size_t cs, ET* tau )
+{
+   nativeGeqrfUnblocked( A, M, N, rs, cs, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native QR decomposition for matrices with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGeqrf_backend( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   constexpr size_t M( Rows<MT>::value );
+   constexpr size_t N( Columns<MT>::value );
+
+   const size_t lda( (~A).spacing() );
+
+   if( SO )
+      nativeGeqrfStatic<M,N>( (~A).data(), 1UL, lda, tau );
+   else
+      nativeGeqrfStatic<M,N>( (~A).data(), lda, 1UL, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native QR decomposition for matrices with runtime dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// Matrices that fit into a single block of blaze::DECOMPOSITION_BLOCK_SIZE columns are directly
+// decomposed by the unblocked kernel, all other matrices by the blocked algorithm.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGeqrf_backend( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+   const size_t lda( (~A).spacing() );
+
+   if( m*n <= DECOMPOSITION_BLOCK_SIZE*DECOMPOSITION_BLOCK_SIZE ) {
+      if( SO )
+         nativeGeqrfUnblocked( (~A).data(), m, n, 1UL, lda, tau );
+      else
+         nativeGeqrfUnblocked( (~A).data(), m, n, lda, 1UL, tau );
+      return;
+   }
+
+   CustomMatrix<ET,unaligned,unpadded,SO> V( (~A).data(), m, n, lda );
+   nativeGeqrfBlocked( V, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the QR decomposition of the given dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix QR decomposition of a general \a m-by-\a n matrix. In
+// contrast to the geqrf() function it does not require a LAPACK library, but it has the same
+// semantics: The resulting decomposition has the form
+
+                              \f[ A = Q \cdot R, \f]
+
+// where the \c Q is represented as a product of elementary reflectors
+
+               \f[ Q = H(1) H(2) . . . H(k) \texttt{, with k = min(m,n).} \f]
+
+// Each H(i) has the form
+
+                      \f[ H(i) = I - tau \cdot v \cdot v^T, \f]
+
+// where \c tau is a real scalar, and \c v is a real vector with <tt>v(0:i-1) = 0</tt> and
+// <tt>v(i) = 1</tt>. <tt>v(i+1:m)</tt> is stored on exit in <tt>A(i+1:m,i)</tt>, and \c tau
+// in \c tau(i). Thus on exit the elements on and above the diagonal of the matrix contain the
+// min(\a m,\a n)-by-\a n upper trapezoidal matrix \c R (\c R is upper triangular if \a m >= \a n);
+// the elements below the diagonal, with the array \c tau, represent the orthogonal matrix \c Q
+// as a product of min(\a m,\a n) elementary reflectors. In accordance with the geqrf() function,
+// the elements of a row-major complex matrix are stored conjugated. The \c Q matrix can be
+// reconstructed by means of the nativeOrgqr() function.
+//
+// Matrices with compile time dimensions (as for instance StaticMatrix) are decomposed by a
+// completely unrolled kernel without any temporary, all other matrices are decomposed by a
+// blocked Householder algorithm based on the Blaze matrix multiplication kernels.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void nativeGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+
+   if( m == 0UL || n == 0UL ) {
+      return;
+   }
+
+   if( !SO && IsComplex<ET>::value ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            conjugate( (~A)(i,j) );
+   }
+
+   nativeGeqrf_backend( ~A, tau );
+
+   if( !SO && IsComplex<ET>::value ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            conjugate( (~A)(i,j) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
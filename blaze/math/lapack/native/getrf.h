@@ -0,0 +1,441 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getrf.h
+//  \brief Header file for the native LU decomposition functions (getrf)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION FUNCTIONS (GETRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native LU decomposition functions (getrf) */
+//@{
+template< typename MT, bool SO >
+inline void nativeGetrf( DenseMatrix<MT,SO>& A, int* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the magnitude of the given value used for the pivot selection.
+// \ingroup lapack_decomposition
+//
+// \param value The given value.
+// \return The sum of the absolute values of the real and imaginary part.
+//
+// In accordance with LAPACK, the pivot selection of complex matrices is based on the sum of the
+// absolute values of the real and imaginary part instead of the absolute value.
+*/
+template< typename T >  // Type of the value
+BLAZE_ALWAYS_INLINE auto pivotMagnitude( const T& value ) -> decltype( abs( real( value ) ) )
+{
+   return abs( real( value ) ) + abs( imag( value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition of a column-major panel.
+// \ingroup lapack_decomposition
+//
+// \param P The column-major panel to be decomposed.
+// \param ipiv Auxiliary array for the 0-based pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the unblocked, right-looking LU decomposition with partial pivoting of
+// the given column-major panel. The row interchanges are only applied within the panel. The
+// scaling of the columns and the rank-1 updates are evaluated by the vectorized dense vector
+// and dense matrix kernels.
+*/
+template< typename MT >  // Type of the panel
+void nativeGetrfPanel( MT& P, int* ipiv )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( P.rows() );
+   const size_t n( P.columns() );
+   const size_t kend( min( m, n ) );
+
+   for( size_t k=0UL; k<kend; ++k )
+   {
+      size_t p( k );
+      auto pmax( pivotMagnitude( P(k,k) ) );
+
+      for( size_t i=k+1UL; i<m; ++i ) {
+         const auto tmp( pivotMagnitude( P(i,k) ) );
+         if( tmp > pmax ) {
+            p    = i;
+            pmax = tmp;
+         }
+      }
+
+      ipiv[k] = static_cast<int>( p );
+
+      if( p != k ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            std::swap( P(k,j), P(p,j) );
+         }
+      }
+
+      if( k+1UL == m )
+         continue;
+
+      auto lk( column( submatrix( P, k+1UL, k, m-k-1UL, 1UL ), 0UL ) );
+
+      if( P(k,k) != ET(0) ) {
+         lk *= ET(1) / P(k,k);
+      }
+
+      if( k+1UL < n ) {
+         auto A22( submatrix( P, k+1UL, k+1UL, m-k-1UL, n-k-1UL ) );
+         A22 -= lk * row( submatrix( P, k, k+1UL, 1UL, n-k-1UL ), 0UL );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition of a small column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the column-major matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param lda The total number of elements between two columns.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the LU decomposition with partial pivoting of a small matrix directly
+// on the given array. In contrast to the blocked algorithm it does not require any temporary or
+// view and therefore never allocates memory.
+*/
+template< typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeGetrfUnblocked( ET* A, size_t m, size_t n, size_t lda, int* ipiv )
+{
+   const size_t kend( m < n ? m : n );
+
+   for( size_t k=0UL; k<kend; ++k )
+   {
+      size_t p( k );
+      auto pmax( pivotMagnitude( A[k+k*lda] ) );
+
+      for( size_t i=k+1UL; i<m; ++i ) {
+         const auto tmp( pivotMagnitude( A[i+k*lda] ) );
+         if( tmp > pmax ) {
+            p    = i;
+            pmax = tmp;
+         }
+      }
+
+      ipiv[k] = static_cast<int>( p+1UL );
+
+      if( p != k ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            std::swap( A[k+j*lda], A[p+j*lda] );
+         }
+      }
+
+      if( A[k+k*lda] != ET(0) ) {
+         const ET inv( ET(1) / A[k+k*lda] );
+         for( size_t i=k+1UL; i<m; ++i ) {
+            A[i+k*lda] *= inv;
+         }
+      }
+
+      for( size_t j=k+1UL; j<n; ++j ) {
+         const ET u( A[k+j*lda] );
+         for( size_t i=k+1UL; i<m; ++i ) {
+            A[i+j*lda] -= A[i+k*lda] * u;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition of a column-major matrix with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a M, \a N ).
+// \return void
+//
+// This function performs the LU decomposition with partial pivoting of a small matrix with
+// compile time dimensions (as for instance a StaticMatrix). Due to the compile time loop bounds
+// the compiler is able to completely unroll the decomposition.
+*/
+template< size_t M       // Number of rows of the column-major matrix
+        , size_t N       // Number of columns of the column-major matrix
+        , typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeGetrfStatic( ET* A, size_t lda, int* ipiv )
+{
+   nativeGetrfUnblocked( A, M, N, lda, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native LU decomposition for matrices with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGetrf_backend( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   constexpr size_t M( SO ? Rows<MT>::value : Columns<MT>::value );
+   constexpr size_t N( SO ? Columns<MT>::value : Rows<MT>::value );
+
+   nativeGetrfStatic<M,N>( (~A).data(), (~A).spacing(), ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native LU decomposition for matrices with runtime dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function implements the blocked, right-looking LU decomposition of the given matrix.
+// Small matrices that fit into a single block (as for instance most HybridMatrix instances) are
+// directly decomposed by the unblocked kernel without any temporary. All other matrices are
+// processed in panels of blaze::DECOMPOSITION_BLOCK_SIZE columns. Each panel is decomposed by
+// the unblocked panel kernel, followed by the application of the row interchanges, the triangular
+// solve for the block row of \c U, and the update of the trailing matrix by means of the Blaze
+// matrix multiplication kernel. The row interchanges, the triangular solve and the
+// trailing update are fused and executed in parallel on blocks of columns (in case the trailing
+// matrix is sufficiently large).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGetrf_backend( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( SO ? (~A).rows() : (~A).columns() );
+   const size_t n( SO ? (~A).columns() : (~A).rows() );
+   const size_t kend( min( m, n ) );
+
+   if( m*n <= DECOMPOSITION_BLOCK_SIZE*DECOMPOSITION_BLOCK_SIZE ) {
+      nativeGetrfUnblocked( (~A).data(), m, n, (~A).spacing(), ipiv );
+      return;
+   }
+
+   CustomMatrix<ET,unaligned,unpadded,columnMajor> V( (~A).data(), m, n, (~A).spacing() );
+
+   for( size_t j=0UL; j<kend; j+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jb( min( DECOMPOSITION_BLOCK_SIZE, kend-j ) );
+
+      auto panel( submatrix( V, j, j, m-j, jb ) );
+      nativeGetrfPanel( panel, ipiv+j );
+
+      const auto swapRows = [&V,ipiv,j,jb]( size_t begin, size_t end )
+      {
+         for( size_t c=begin; c<end; ++c ) {
+            for( size_t k=0UL; k<jb; ++k ) {
+               const size_t p( j + ipiv[j+k] );
+               if( p != j+k ) {
+                  std::swap( V(j+k,c), V(p,c) );
+               }
+            }
+         }
+      };
+
+      swapRows( 0UL, j );
+
+      if( j+jb < n )
+      {
+         const size_t mrest( m-j-jb );
+         const size_t nrest( n-j-jb );
+
+         const auto L11( submatrix( V, j, j, jb, jb ) );
+         const auto L21( submatrix( V, j+jb, j, mrest, jb ) );
+
+         const size_t processed = smpFusedKernel<size_t>( nrest, (mrest+jb)*nrest,
+                                                          [&]( size_t begin, size_t end )
+         {
+            swapRows( j+jb+begin, j+jb+end );
+
+            auto U12( submatrix( V, j, j+jb+begin, jb, end-begin ) );
+
+            // The operands of the rank-1 updates never overlap with the updated rows, therefore
+            // the updates are directly assigned in order to avoid the evaluation of a temporary
+            for( size_t i=1UL; i<jb; ++i ) {
+               auto U( submatrix( U12, i, 0UL, jb-i, end-begin ) );
+               const auto l( column( submatrix( L11, i, i-1UL, jb-i, 1UL ), 0UL ) );
+               subAssign( U, l * row( U12, i-1UL ) );
+            }
+
+            if( mrest > 0UL ) {
+               auto A22( submatrix( V, j+jb, j+jb+begin, mrest, end-begin ) );
+               mmm( A22, L21, U12, ET(-1), ET(1) );
+            }
+
+            return end - begin;
+         } );
+
+         BLAZE_INTERNAL_ASSERT( processed == nrest, "Invalid number of processed columns" );
+         UNUSED_PARAMETER( processed );
+      }
+
+      for( size_t k=0UL; k<jb; ++k ) {
+         ipiv[j+k] += static_cast<int>( j+1UL );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the LU decomposition of the given dense general matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix LU decomposition of a general m-by-n matrix with
+// partial pivoting. In contrast to the getrf() function it does not require a LAPACK library,
+// but it has the same semantics: In case of a column-major matrix, the resulting decomposition
+// has the form
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c L is a lower unitriangular matrix (lower trapezoidal if \a m > \a n), \c U is an upper
+// triangular matrix (upper trapezoidal if \a m < \a n), and \c P is an m-by-m permutation matrix,
+// which represents the pivoting indices for the applied row interchanges.
+//
+// In case of a row-major matrix, the resulting decomposition has the form
+
+                          \f[ A = L \cdot U \cdot P, \f]
+
+// where \c P is an n-by-n permutation matrix, which represents the pivoting indices for the applied
+// column interchanges, \c L is a lower triangular matrix (lower trapezoidal if \a m > \a n), and
+// \c U is an upper unitriangular matrix (upper trapezoidal if \a m < \a n).
+//
+// The resulting decomposition is stored within the matrix \a A and the 1-based pivot indices are
+// stored in \a ipiv. Matrices with compile time dimensions (as for instance StaticMatrix) are
+// decomposed by a completely unrolled kernel, all other matrices are decomposed by a blocked,
+// right-looking algorithm based on the Blaze matrix multiplication kernels.
+//
+// \note The LU decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void nativeGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
+      return;
+   }
+
+   nativeGetrf_backend( ~A, ipiv );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
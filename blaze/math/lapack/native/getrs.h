@@ -0,0 +1,346 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getrs.h
+//  \brief Header file for the native LU-based substitution functions (getrs)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRS_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU-BASED SUBSTITUTION FUNCTIONS (GETRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native LU-based substitution functions (getrs) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+inline void nativeGetrs( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const int* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void nativeGetrs( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const int* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and back substitution with the LU decomposition of a small matrix.
+// \ingroup lapack_substitution
+//
+// \param A Pointer to the first element of the column-major LU decomposed matrix.
+// \param lda The total number of elements between two columns.
+// \param ipiv The 1-based pivot indices of the LU decomposition.
+// \param b Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a small matrix
+// with compile time dimensions (as for instance a StaticMatrix), which has been decomposed by the
+// nativeGetrfStatic() kernel. Due to the compile time loop bounds the compiler is able to
+// completely unroll the substitution. The updates of the right-hand side are performed column
+// by column, i.e. the innermost loops traverse contiguous memory.
+*/
+template< size_t N       // Number of rows and columns of the column-major matrix
+        , typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeGetrsStatic( const ET* A, size_t lda, const int* ipiv, ET* b )
+{
+   for( size_t k=0UL; k<N; ++k ) {
+      const size_t p( ipiv[k] - 1 );
+      if( p != k ) {
+         std::swap( b[k], b[p] );
+      }
+   }
+
+   for( size_t k=0UL; k<N; ++k ) {
+      const ET tmp( b[k] );
+      for( size_t i=k+1UL; i<N; ++i ) {
+         b[i] -= A[i+k*lda] * tmp;
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; ) {
+      b[k] /= A[k+k*lda];
+      const ET tmp( b[k] );
+      for( size_t i=0UL; i<k; ++i ) {
+         b[i] -= A[i+k*lda] * tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and back substitution with the LU decomposition of a general matrix.
+// \ingroup lapack_substitution
+//
+// \param A Pointer to the first element of the column-major LU decomposed matrix.
+// \param n The number of rows and columns of the matrix.
+// \param lda The total number of elements between two columns.
+// \param ipiv The 1-based pivot indices of the LU decomposition.
+// \param b Pointer to the first element of the right-hand side vector.
+// \return void
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a matrix with
+// runtime dimensions, which has been decomposed by the getrf() or nativeGetrf() functions.
+*/
+template< typename ET >  // Element type of the matrix
+void nativeGetrsDynamic( const ET* A, size_t n, size_t lda, const int* ipiv, ET* b )
+{
+   for( size_t k=0UL; k<n; ++k ) {
+      const size_t p( ipiv[k] - 1 );
+      if( p != k ) {
+         std::swap( b[k], b[p] );
+      }
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const ET tmp( b[k] );
+      const ET* a( A + k*lda );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         b[i] -= a[i] * tmp;
+      }
+   }
+
+   for( size_t k=n; k-- > 0UL; ) {
+      const ET* a( A + k*lda );
+      b[k] /= a[k];
+      const ET tmp( b[k] );
+      for( size_t i=0UL; i<k; ++i ) {
+         b[i] -= a[i] * tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native substitution for matrices with compile time dimensions.
+// \ingroup lapack_substitution
+//
+// \param A The LU decomposed system matrix.
+// \param b Pointer to the first element of the right-hand side vector.
+// \param ipiv The 1-based pivot indices of the LU decomposition.
+// \return void
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGetrs_backend( const DenseMatrix<MT,SO>& A, ElementType_<MT>* b, const int* ipiv )
+{
+   nativeGetrsStatic<Rows<MT>::value>( (~A).data(), (~A).spacing(), ipiv, b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native substitution for matrices with runtime dimensions.
+// \ingroup lapack_substitution
+//
+// \param A The LU decomposed system matrix.
+// \param b Pointer to the first element of the right-hand side vector.
+// \param ipiv The 1-based pivot indices of the LU decomposition.
+// \return void
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeGetrs_backend( const DenseMatrix<MT,SO>& A, ElementType_<MT>* b, const int* ipiv )
+{
+   nativeGetrsDynamic( (~A).data(), (~A).rows(), (~A).spacing(), ipiv, b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the substitution step of solving a general linear system of equations
+//        (\f$ A*x=b \f$).
+// \ingroup lapack_substitution
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function uses the LU decomposition of the given system matrix \a A computed by the getrf()
+// or nativeGetrf() functions to solve the linear system of equations. In contrast to the getrs()
+// function it does not require a LAPACK library, but it has the same semantics as getrs() with
+// \c trans = \c 'N': It solves
+//
+//  - \f$ A  *x=b \f$ if \a A is column-major
+//  - \f$ A^T*x=b \f$ if \a A is row-major
+//
+// The solution is stored in \a b. Matrices with compile time dimensions (as for instance
+// StaticMatrix) are processed by a completely unrolled kernel, which neither requires any
+// dynamic memory nor any temporary. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the sizes of the system matrix and the right-hand side vector don't match.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+inline void nativeGetrs( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, ElementType_<VT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (~A).rows() == 0UL ) {
+      return;
+   }
+
+   nativeGetrs_backend( ~A, (~b).data(), ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the substitution step of solving a general linear system of equations
+//        (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param A The system matrix.
+// \param B The matrix of right-hand sides.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function uses the LU decomposition of the given system matrix \a A computed by the getrf()
+// or nativeGetrf() functions to solve the linear system of equations. In contrast to the getrs()
+// function it does not require a LAPACK library, but it has the same semantics as getrs() with
+// \c trans = \c 'N': It solves
+//
+//  - \f$ A  *X  =B   \f$ if both \a A and \a B are column-major
+//  - \f$ A^T*X  =B   \f$ if \a A is row-major and \a B is column-major
+//  - \f$ A  *X^T=B^T \f$ if \a A is column-major and \a B is row-major
+//  - \f$ A^T*X^T=B^T \f$ if both \a A and \a B are row-major
+//
+// The solution is stored in \a B. Matrices with compile time dimensions (as for instance
+// StaticMatrix) are processed by a completely unrolled kernel, which neither requires any
+// dynamic memory nor any temporary. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the sizes of the two given matrices don't match.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void nativeGetrs( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n   ( (~A).rows() );
+   const size_t mrhs( SO2 ? (~B).rows() : (~B).columns() );
+   const size_t nrhs( SO2 ? (~B).columns() : (~B).rows() );
+   const size_t ldb ( (~B).spacing() );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( n == 0UL ) {
+      return;
+   }
+
+   for( size_t j=0UL; j<nrhs; ++j ) {
+      nativeGetrs_backend( ~A, (~B).data()+j*ldb, ipiv );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
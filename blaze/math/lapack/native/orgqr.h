@@ -0,0 +1,386 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/orgqr.h
+//  \brief Header file for the native functions to reconstruct Q from a QR decomposition (orgqr)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_ORGQR_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_ORGQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE FUNCTIONS TO RECONSTRUCT Q FROM A QR DECOMPOSITION (ORGQR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native functions to reconstruct Q from a QR decomposition (orgqr) */
+//@{
+template< typename MT, bool SO >
+inline void nativeOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked reconstruction of the \c Q matrix of a panel.
+// \ingroup lapack_decomposition
+//
+// \param P The panel containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// This function overwrites the given m-by-k panel, which contains the k elementary reflectors
+// below the diagonal, by the first k columns of the product of the elementary reflectors (see
+// the LAPACK org2r() and ung2r() functions).
+*/
+template< typename MT >  // Type of the panel
+void nativeOrgqrPanel( MT& P, const ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( P.rows() );
+   const size_t k( P.columns() );
+
+   DynamicVector<ET,rowVector> w;
+
+   for( size_t i=k; i-- > 0UL; )
+   {
+      auto x( column( submatrix( P, i, i, m-i, 1UL ), 0UL ) );
+
+      if( i+1UL < k ) {
+         P(i,i) = ET(1);
+         auto C( submatrix( P, i, i+1UL, m-i, k-i-1UL ) );
+         w = ctrans( x ) * C;
+         C -= ( tau[i] * x ) * w;
+      }
+
+      if( i+1UL < m ) {
+         submatrix( P, i+1UL, i, m-i-1UL, 1UL ) *= -tau[i];
+      }
+
+      P(i,i) = ET(1) - tau[i];
+
+      if( i > 0UL ) {
+         reset( subvector( column( P, i ), 0UL, i ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked reconstruction of the \c Q matrix of a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// This function reconstructs the \c Q matrix from the elementary reflectors stored in the given
+// matrix. The panels of blaze::DECOMPOSITION_BLOCK_SIZE reflectors are processed in reverse
+// order. The block reflector of each panel is applied to the already reconstructed columns by
+// means of the Blaze matrix multiplication kernels.
+*/
+template< typename MT >  // Type of the matrix
+void nativeOrgqrBlocked( MT& A, const ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( A.rows() );
+   const size_t k( A.columns() );
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t jj=( k-1UL ) / DECOMPOSITION_BLOCK_SIZE + 1UL; jj-- > 0UL; )
+   {
+      const size_t j ( jj*DECOMPOSITION_BLOCK_SIZE );
+      const size_t jb( min( DECOMPOSITION_BLOCK_SIZE, k-j ) );
+
+      auto P( submatrix( A, j, j, m-j, jb ) );
+
+      if( j+jb < k ) {
+         nativeReflectors( P, V );
+         nativeLarft( V, tau+j, T );
+         auto C( submatrix( A, j, j+jb, m-j, k-j-jb ) );
+         nativeLarfb( V, T, C );
+      }
+
+      nativeOrgqrPanel( P, tau+j );
+
+      if( j > 0UL ) {
+         reset( submatrix( A, 0UL, j, j, jb ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked reconstruction of the \c Q matrix of a small matrix.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix.
+// \param kend The number of elementary reflectors.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// This function overwrites the first \a kend columns of the given matrix, which contain the
+// \a kend elementary reflectors below the diagonal, by the \c Q matrix. In contrast to the
+// blocked algorithm it does not require any temporary vector or matrix and therefore never
+// allocates memory.
+*/
+template< typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeOrgqrUnblocked( ET* A, size_t m, size_t kend, size_t rs, size_t cs, const ET* tau )
+{
+   for( size_t i=kend; i-- > 0UL; )
+   {
+      if( i+1UL < kend )
+      {
+         A[i*rs+i*cs] = ET(1);
+
+         for( size_t j=i+1UL; j<kend; ++j )
+         {
+            ET w( ET(0) );
+            for( size_t k=i; k<m; ++k ) {
+               w += conj( A[k*rs+i*cs] ) * A[k*rs+j*cs];
+            }
+
+            w *= tau[i];
+
+            for( size_t k=i; k<m; ++k ) {
+               A[k*rs+j*cs] -= A[k*rs+i*cs] * w;
+            }
+         }
+      }
+
+      for( size_t k=i+1UL; k<m; ++k ) {
+         A[k*rs+i*cs] *= -tau[i];
+      }
+
+      A[i*rs+i*cs] = ET(1) - tau[i];
+
+      for( size_t k=0UL; k<i; ++k ) {
+         A[k*rs+i*cs] = ET(0);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reconstruction of the \c Q matrix of a small matrix with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// This function overwrites the first \a K columns of the given M-by-K matrix, which contains
+// the \a K elementary reflectors below the diagonal, by the \c Q matrix. Due to the compile
+// time loop bounds the compiler is able to completely unroll the reconstruction.
+*/
+template< size_t M       // Number of rows of the matrix
+        , size_t K       // Number of elementary reflectors
+        , typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativeOrgqrStatic( ET* A, size_t rs, size_t cs, const ET* tau )
+{
+   nativeOrgqrUnblocked( A, M, K, rs, cs, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native \c Q reconstruction for matrices with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeOrgqr_backend( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   constexpr size_t M( Rows<MT>::value );
+   constexpr size_t K( M < Columns<MT>::value ? M : Columns<MT>::value );
+
+   const size_t lda( (~A).spacing() );
+
+   if( SO )
+      nativeOrgqrStatic<M,K>( (~A).data(), 1UL, lda, tau );
+   else
+      nativeOrgqrStatic<M,K>( (~A).data(), lda, 1UL, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native \c Q reconstruction for matrices with runtime dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// Matrices that fit into a single block of blaze::DECOMPOSITION_BLOCK_SIZE columns are directly
+// processed by the unblocked kernel, all other matrices by the blocked algorithm.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativeOrgqr_backend( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t k( min( m, (~A).columns() ) );
+   const size_t lda( (~A).spacing() );
+
+   if( m*k <= DECOMPOSITION_BLOCK_SIZE*DECOMPOSITION_BLOCK_SIZE ) {
+      if( SO )
+         nativeOrgqrUnblocked( (~A).data(), m, k, 1UL, lda, tau );
+      else
+         nativeOrgqrUnblocked( (~A).data(), m, k, lda, 1UL, tau );
+      return;
+   }
+
+   CustomMatrix<ET,unaligned,unpadded,SO> V( (~A).data(), m, k, lda );
+   nativeOrgqrBlocked( V, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the reconstruction of the orthogonal matrix Q from a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param A On entry, the QR decomposed matrix; on exit, the \c Q matrix from the QR decomposition.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function reconstructs the \c Q matrix from a QR decomposition computed by the geqrf()
+// or nativeGeqrf() functions. In contrast to the orgqr() and ungqr() functions it does not
+// require a LAPACK library, but it has the same semantics: On exit, the first min(\a m,\a n)
+// columns of \a A contain the \c Q matrix. It can be used for matrices with both real and
+// complex element type.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void nativeOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t k( min( m, (~A).columns() ) );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   if( !SO && IsComplex<ET>::value ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<k; ++j )
+            conjugate( (~A)(i,j) );
+   }
+
+   nativeOrgqr_backend( ~A, tau );
+
+   if( !SO && IsComplex<ET>::value ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<k; ++j )
+            conjugate( (~A)(i,j) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,431 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrf.h
+//  \brief Header file for the native LLH (Cholesky) decomposition functions (potrf)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LLH (CHOLESKY) DECOMPOSITION FUNCTIONS (POTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native LLH (Cholesky) decomposition functions (potrf) */
+//@{
+template< typename MT, bool SO >
+inline void nativePotrf( DenseMatrix<MT,SO>& A, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of the lower part of a diagonal block.
+// \ingroup lapack_decomposition
+//
+// \param A The diagonal block to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the unblocked, left-looking Cholesky decomposition of the lower part
+// of the given square block. Each column of \c L is computed by a single dense matrix/dense
+// vector multiplication, which results in contiguous, vectorized memory accesses for both
+// row-major and column-major blocks.
+*/
+template< typename MT >  // Type of the diagonal block
+void nativePotrfPanel( MT& A )
+{
+   typedef ElementType_<MT>          ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t n( A.rows() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const auto lk( subvector( row( A, k ), 0UL, k ) );
+
+      const BT d( ( k > 0UL )?( real( A(k,k) ) - real( lk * ctrans( lk ) ) ):( real( A(k,k) ) ) );
+
+      if( !( d > BT(0) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      const BT l( std::sqrt( d ) );
+      A(k,k) = l;
+
+      if( k+1UL < n ) {
+         // The column is accessed via a submatrix starting at row k+1 (instead of a subvector
+         // of the column), such that the SIMD accesses to both operands start at the same row
+         auto Ak( submatrix( A, k+1UL, 0UL, n-k-1UL, k+1UL ) );
+         auto ck( column( Ak, k ) );
+         if( k > 0UL ) {
+            ck -= submatrix( Ak, 0UL, 0UL, n-k-1UL, k ) * ctrans( lk );
+         }
+         ck *= ET( BT(1) / l );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Cholesky decomposition of the lower part of a dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param V The matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function implements the blocked, right-looking Cholesky decomposition of the lower part
+// of the given square matrix. The matrix is processed in blocks of blaze::DECOMPOSITION_BLOCK_SIZE
+// columns. After the decomposition of the diagonal block, the triangular solve for the block
+// column of \c L and the update of the lower part of the trailing matrix are executed in parallel
+// (in case the trailing matrix is sufficiently large). The trailing update is based on the Blaze
+// matrix multiplication kernels.
+*/
+template< typename MT >  // Type of the matrix
+void nativePotrfBlocked( MT& V )
+{
+   typedef ElementType_<MT>          ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t n( V.rows() );
+
+   for( size_t j=0UL; j<n; j+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jb( min( DECOMPOSITION_BLOCK_SIZE, n-j ) );
+      const size_t r( n-j-jb );
+
+      auto L11( submatrix( V, j, j, jb, jb ) );
+      nativePotrfPanel( L11 );
+
+      if( r == 0UL )
+         break;
+
+      auto L21( submatrix( V, j+jb, j, r, jb ) );
+
+      const size_t solved = smpFusedKernel<size_t>( r, r*jb, [&]( size_t begin, size_t end )
+      {
+         auto X( submatrix( L21, begin, 0UL, end-begin, jb ) );
+
+         // The operands of the updates never overlap with the updated column, therefore the
+         // updates are directly assigned in order to avoid the evaluation of a temporary
+         for( size_t k=0UL; k<jb; ++k ) {
+            auto xk( column( X, k ) );
+            if( k > 0UL ) {
+               subAssign( xk, submatrix( X, 0UL, 0UL, end-begin, k ) *
+                              ctrans( subvector( row( L11, k ), 0UL, k ) ) );
+            }
+            xk.scale( ET( BT(1) / real( L11(k,k) ) ) );
+         }
+
+         return end - begin;
+      } );
+
+      const DynamicMatrix<ET,!IsRowMajorMatrix<MT>::value> W( ctrans( L21 ) );
+      auto A22( submatrix( V, j+jb, j+jb, r, r ) );
+
+      const size_t updated = smpFusedKernel<size_t>( r, r*r, [&]( size_t begin, size_t end )
+      {
+         const auto Wc( submatrix( W, 0UL, begin, jb, end-begin ) );
+
+         auto D( submatrix( A22, begin, begin, end-begin, end-begin ) );
+         lmmm( D, submatrix( L21, begin, 0UL, end-begin, jb ), Wc, ET(-1), ET(1) );
+
+         if( end < r ) {
+            auto B( submatrix( A22, end, begin, r-end, end-begin ) );
+            mmm( B, submatrix( L21, end, 0UL, r-end, jb ), Wc, ET(-1), ET(1) );
+         }
+
+         return end - begin;
+      } );
+
+      BLAZE_INTERNAL_ASSERT( solved  == r, "Invalid number of processed rows"    );
+      BLAZE_INTERNAL_ASSERT( updated == r, "Invalid number of processed columns" );
+      UNUSED_PARAMETER( solved, updated );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of a small matrix.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param n The number of rows and columns of the matrix.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition of the lower part of a small matrix directly
+// on the given array. In contrast to the blocked algorithm it does not require any temporary or
+// view and therefore never allocates memory.
+*/
+template< typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativePotrfUnblocked( ET* A, size_t n, size_t rs, size_t cs )
+{
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const BT d( real( A[k*rs+k*cs] ) );
+
+      if( !( d > BT(0) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      const BT l( std::sqrt( d ) );
+      const BT inv( BT(1) / l );
+
+      A[k*rs+k*cs] = l;
+
+      for( size_t i=k+1UL; i<n; ++i ) {
+         A[i*rs+k*cs] *= inv;
+      }
+
+      for( size_t j=k+1UL; j<n; ++j ) {
+         const ET tmp( conj( A[j*rs+k*cs] ) );
+         for( size_t i=j; i<n; ++i ) {
+            A[i*rs+j*cs] -= A[i*rs+k*cs] * tmp;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of a matrix with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A Pointer to the first element of the matrix.
+// \param rs The distance between two consecutive elements of a column.
+// \param cs The distance between two consecutive elements of a row.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition of the lower part of a small matrix with
+// compile time dimensions (as for instance a StaticMatrix). Due to the compile time loop bounds
+// the compiler is able to completely unroll the decomposition.
+*/
+template< size_t N       // Number of rows and columns of the matrix
+        , typename ET >  // Element type of the matrix
+BLAZE_ALWAYS_INLINE void nativePotrfStatic( ET* A, size_t rs, size_t cs )
+{
+   nativePotrfUnblocked( A, N, rs, cs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native Cholesky decomposition for matrices with compile time dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param lower \a true in case the lower part of the column-major storage is decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline EnableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativePotrf_backend( DenseMatrix<MT,SO>& A, bool lower )
+{
+   constexpr size_t N( Rows<MT>::value );
+
+   const size_t lda( (~A).spacing() );
+
+   if( lower )
+      nativePotrfStatic<N>( (~A).data(), 1UL, lda );
+   else
+      nativePotrfStatic<N>( (~A).data(), lda, 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the native Cholesky decomposition for matrices with runtime dimensions.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param lower \a true in case the lower part of the column-major storage is decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// Matrices that fit into a single block of blaze::DECOMPOSITION_BLOCK_SIZE columns are directly
+// decomposed by the unblocked kernel, all other matrices by the blocked algorithm.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline DisableIfTrue_< Rows<MT>::value != 0UL && Columns<MT>::value != 0UL >
+   nativePotrf_backend( DenseMatrix<MT,SO>& A, bool lower )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t n( (~A).rows() );
+   const size_t lda( (~A).spacing() );
+
+   if( n <= DECOMPOSITION_BLOCK_SIZE ) {
+      if( lower )
+         nativePotrfUnblocked( (~A).data(), n, 1UL, lda );
+      else
+         nativePotrfUnblocked( (~A).data(), n, lda, 1UL );
+   }
+   else if( lower ) {
+      CustomMatrix<ET,unaligned,unpadded,columnMajor> V( (~A).data(), n, n, lda );
+      nativePotrfBlocked( V );
+   }
+   else {
+      CustomMatrix<ET,unaligned,unpadded,rowMajor> V( (~A).data(), n, n, lda );
+      nativePotrfBlocked( V );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the dense matrix Cholesky decomposition of a symmetric positive definite
+// matrix. In contrast to the potrf() function it does not require a LAPACK library, but it has
+// the same semantics. The decomposition has the form
+
+                      \f[ A = U^{H} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{H} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular matrix and \c L is a lower triangular matrix. Matrices with
+// compile time dimensions (as for instance StaticMatrix) are decomposed by a completely unrolled
+// kernel, all other matrices are decomposed by a blocked, right-looking algorithm based on the
+// Blaze matrix multiplication kernels. The Cholesky decomposition fails if ...
+//
+//  - ... the given system matrix \a A is not a symmetric positive definite matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U'.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void nativePotrf( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( (~A).rows() == 0UL ) {
+      return;
+   }
+
+   nativePotrf_backend( ~A, ( uplo == 'L' ) == SO );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <boost/cast.hpp>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
@@ -51,6 +50,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/sytrf.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 
 
@@ -144,13 +144,13 @@ inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv )
    }
 
    int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ArenaArray<ET> work( lwork );
 
    if( IsRowMajorMatrix<MT>::value ) {
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   sytrf( uplo, n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+   sytrf( uplo, n, (~A).data(), lda, ipiv, work.data(), lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix decomposition" );
 }
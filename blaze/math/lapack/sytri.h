@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <boost/cast.hpp>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
@@ -51,6 +50,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/sytri.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/ArenaArray.h>
 #include <blaze/util/Assert.h>
 
 
@@ -141,9 +141,9 @@ inline void sytri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv )
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   const std::unique_ptr<ET[]> work( new ET[n] );
+   ArenaArray<ET> work( n );
 
-   sytri( uplo, n, (~A).data(), lda, ipiv, work.get(), &info );
+   sytri( uplo, n, (~A).data(), lda, ipiv, work.data(), &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
@@ -0,0 +1,878 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Memory mapped, zero-copy archive for dense and sparse vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/MappedCompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FILE FORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief File header of a memory mapped archive.
+// \ingroup math_serialization
+//
+// Every memory mapped archive starts with a 64 byte file header, which contains a magic string,
+// the version of the file format and a tag to detect files written on a platform of different
+// endianness.
+*/
+struct MappedArchiveHeader
+{
+   char     magic[8];        //!< The magic string "BLAZEMAP".
+   uint32_t version;         //!< The version of the file format.
+   uint32_t endianness;      //!< The endianness tag (0x01020304 in native byte order).
+   uint8_t  reserved[48];    //!< Reserved for future use (zero).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Entry header of a memory mapped archive.
+// \ingroup math_serialization
+//
+// Every vector or matrix in a memory mapped archive is preceded by a 64 byte entry header. The
+// \a type flags use the same encoding as the MatrixSerializer and the VectorSerializer (0x01:
+// matrix, 0x02: sparse, 0x04: column-major), the element type and size follow TypeValueMapping.
+// The payload directly follows the header and \a bytes is a multiple of 64.
+*/
+struct MappedArchiveEntry
+{
+   uint8_t  type;          //!< The type flags of the vector/matrix.
+   uint8_t  elementType;   //!< The type of the elements (see TypeValueMapping).
+   uint8_t  elementSize;   //!< The size of a single element in bytes.
+   uint8_t  reserved0[5];  //!< Reserved for future use (zero).
+   uint64_t rows;          //!< The number of rows (the size in case of a vector).
+   uint64_t columns;       //!< The number of columns (1 in case of a vector).
+   uint64_t spacing;       //!< The spacing between two rows/columns of a dense matrix.
+   uint64_t nonZeros;      //!< The number of non-zero elements of a sparse matrix.
+   uint64_t bytes;         //!< The size of the payload in bytes.
+   uint64_t reserved1[2];  //!< Reserved for future use (zero).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constants of the memory mapped archive file format.
+// \ingroup math_serialization
+*/
+struct MappedArchiveFormat
+{
+   enum : uint32_t { version    = 1U          };  //!< The current version of the file format.
+   enum : uint32_t { endianness = 0x01020304U };  //!< The endianness tag.
+   enum : size_t   { alignment  = 64UL        };  //!< The alignment of all payloads in bytes.
+
+   //! Returns the magic string of the file format.
+   static constexpr const char* magic() noexcept { return "BLAZEMAP"; }
+
+   //! Returns the padded spacing of a dense row/column with \a n elements of the given size.
+   static constexpr size_t spacing( size_t n, size_t size ) noexcept {
+      return ( alignment % size == 0UL )?( nextMultiple( n, alignment / size ) ):( n );
+   }
+
+   //! Returns the given number of bytes padded to the alignment of the payloads.
+   static constexpr size_t padded( size_t bytes ) noexcept {
+      return nextMultiple( bytes, size_t( alignment ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_STATIC_ASSERT( sizeof( MappedArchiveHeader ) == MappedArchiveFormat::alignment );
+BLAZE_STATIC_ASSERT( sizeof( MappedArchiveEntry  ) == MappedArchiveFormat::alignment );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVEWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for memory mapped archives.
+// \ingroup math_serialization
+//
+// The MappedArchiveWriter class writes dense vectors, dense matrices and sparse matrices into a
+// binary file that can be memory mapped and used without any copy or conversion by means of
+// the MappedArchive class. In contrast to the portable format of the MatrixSerializer and the
+// VectorSerializer, the file contains the elements in exactly the in-memory layout of Blaze:
+// Dense rows (or columns) are padded to a multiple of 64 bytes and all payloads are aligned to
+// 64-byte boundaries, such that they can be used by aligned and padded custom vectors and
+// matrices. Sparse matrices are stored in the compressed row (or column) format used by the
+// CompressedMatrix class template.
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 1000UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::MappedArchiveWriter writer( "data.blazemap" );
+   writer << A << x << S;
+   \endcode
+
+// Since the format is a copy of the in-memory representation, files are only portable between
+// platforms with the same endianness and the same size of \c size_t. Both properties are
+// verified when the file is mapped.
+*/
+class MappedArchiveWriter : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedArchiveWriter( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   template< typename MT, bool SO > inline MappedArchiveWriter& operator<<( const DenseMatrix<MT,SO>& dm );
+   template< typename VT, bool TF > inline MappedArchiveWriter& operator<<( const DenseVector<VT,TF>& dv );
+   template< typename MT, bool SO > inline MappedArchiveWriter& operator<<( const SparseMatrix<MT,SO>& sm );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void write( const void* data, size_t bytes );
+   inline void pad( size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream stream_;  //!< The output file stream.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new memory mapped archive.
+//
+// \param filename The name of the archive file.
+// \exception std::runtime_error Archive file could not be created.
+//
+// This constructor creates (or truncates) the given file and writes the file header.
+*/
+inline MappedArchiveWriter::MappedArchiveWriter( const std::string& filename )
+   : stream_( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc )  // The output file stream
+{
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be created" );
+   }
+
+   MappedArchiveHeader header{};
+   std::memcpy( header.magic, MappedArchiveFormat::magic(), sizeof( header.magic ) );
+   header.version    = MappedArchiveFormat::version;
+   header.endianness = MappedArchiveFormat::endianness;
+
+   write( &header, sizeof( header ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix to the archive.
+//
+// \param dm The dense matrix to be written.
+// \return Reference to the archive writer.
+// \exception std::runtime_error Archive file could not be written.
+//
+// The matrix is written in its storage order. Each row (for row-major matrices) or column (for
+// column-major matrices) is padded with zeros to a multiple of 64 bytes.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseMatrix<MT,SO>& dm )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   BLAZE_STATIC_ASSERT( IsNumeric<ET>::value );
+
+   CT A( ~dm );
+
+   const size_t lines  ( SO ? A.columns() : A.rows() );
+   const size_t length ( SO ? A.rows() : A.columns() );
+   const size_t spacing( MappedArchiveFormat::spacing( length, sizeof( ET ) ) );
+   const size_t bytes  ( lines * spacing * sizeof( ET ) );
+
+   MappedArchiveEntry entry{};
+   entry.type        = uint8_t( 0x01 | ( SO ? 0x04 : 0x00 ) );
+   entry.elementType = uint8_t( TypeValueMapping<ET>::value );
+   entry.elementSize = uint8_t( sizeof( ET ) );
+   entry.rows        = A.rows();
+   entry.columns     = A.columns();
+   entry.spacing     = spacing;
+   entry.bytes       = MappedArchiveFormat::padded( bytes );
+
+   write( &entry, sizeof( entry ) );
+
+   std::vector<ET> buffer( spacing );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      for( size_t l=0UL; l<length; ++l ) {
+         buffer[l] = ( SO )?( A(l,k) ):( A(k,l) );
+      }
+      write( buffer.data(), spacing*sizeof( ET ) );
+   }
+
+   pad( bytes );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector to the archive.
+//
+// \param dv The dense vector to be written.
+// \return Reference to the archive writer.
+// \exception std::runtime_error Archive file could not be written.
+//
+// The vector is padded with zeros to a multiple of 64 bytes. As for the VectorSerializer, the
+// transpose flag of the vector is not stored.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseVector<VT,TF>& dv )
+{
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   BLAZE_STATIC_ASSERT( IsNumeric<ET>::value );
+
+   CT x( ~dv );
+
+   const size_t size   ( x.size() );
+   const size_t spacing( MappedArchiveFormat::spacing( size, sizeof( ET ) ) );
+   const size_t bytes  ( spacing * sizeof( ET ) );
+
+   MappedArchiveEntry entry{};
+   entry.type        = uint8_t( 0x00 );
+   entry.elementType = uint8_t( TypeValueMapping<ET>::value );
+   entry.elementSize = uint8_t( sizeof( ET ) );
+   entry.rows        = size;
+   entry.columns     = 1UL;
+   entry.spacing     = spacing;
+   entry.bytes       = MappedArchiveFormat::padded( bytes );
+
+   write( &entry, sizeof( entry ) );
+
+   std::vector<ET> buffer( spacing );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      buffer[i] = x[i];
+   }
+   write( buffer.data(), bytes );
+
+   pad( bytes );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix to the archive.
+//
+// \param sm The sparse matrix to be written.
+// \return Reference to the archive writer.
+// \exception std::runtime_error Archive file could not be written.
+//
+// The matrix is written in compressed row (for row-major matrices) or compressed column (for
+// column-major matrices) format: The \f$ L+1 \f$ offsets of the rows/columns, padded to 64
+// bytes, are followed by the value-index pairs of all non-zero elements.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const SparseMatrix<MT,SO>& sm )
+{
+   typedef ElementType_<MT>      ET;
+   typedef CompositeType_<MT>    CT;
+   typedef RemoveReference_<CT>  RT;
+   typedef ValueIndexPair<ET>    Element;
+
+   BLAZE_STATIC_ASSERT( IsNumeric<ET>::value );
+
+   CT A( ~sm );
+
+   const size_t lines( SO ? A.columns() : A.rows() );
+
+   std::vector<uint64_t> offsets( lines+1UL, 0UL );
+   for( size_t k=0UL; k<lines; ++k ) {
+      size_t nonzeros( 0UL );
+      for( typename RT::ConstIterator element=A.begin(k); element!=A.end(k); ++element ) {
+         ++nonzeros;
+      }
+      offsets[k+1UL] = offsets[k] + nonzeros;
+   }
+
+   const size_t nonzeros( offsets[lines] );
+   const size_t offsetBytes ( MappedArchiveFormat::padded( offsets.size()*sizeof( uint64_t ) ) );
+   const size_t elementBytes( nonzeros*sizeof( Element ) );
+
+   MappedArchiveEntry entry{};
+   entry.type        = uint8_t( 0x03 | ( SO ? 0x04 : 0x00 ) );
+   entry.elementType = uint8_t( TypeValueMapping<ET>::value );
+   entry.elementSize = uint8_t( sizeof( ET ) );
+   entry.rows        = A.rows();
+   entry.columns     = A.columns();
+   entry.nonZeros    = nonzeros;
+   entry.bytes       = offsetBytes + MappedArchiveFormat::padded( elementBytes );
+
+   write( &entry, sizeof( entry ) );
+   write( offsets.data(), offsets.size()*sizeof( uint64_t ) );
+   pad( offsets.size()*sizeof( uint64_t ) );
+
+   std::vector<byte_t> buffer( sizeof( Element ), byte_t( 0 ) );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      for( typename RT::ConstIterator element=A.begin(k); element!=A.end(k); ++element ) {
+         ::new( buffer.data() ) Element( element->value(), element->index() );
+         write( buffer.data(), sizeof( Element ) );
+      }
+   }
+
+   pad( elementBytes );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given number of bytes to the archive file.
+//
+// \param data The data to be written.
+// \param bytes The number of bytes to be written.
+// \return void
+// \exception std::runtime_error Archive file could not be written.
+*/
+inline void MappedArchiveWriter::write( const void* data, size_t bytes )
+{
+   stream_.write( static_cast<const char*>( data ), static_cast<std::streamsize>( bytes ) );
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the zero padding following a payload of the given size.
+//
+// \param bytes The size of the payload in bytes.
+// \return void
+// \exception std::runtime_error Archive file could not be written.
+*/
+inline void MappedArchiveWriter::pad( size_t bytes )
+{
+   const char zeros[MappedArchiveFormat::alignment] = {};
+   write( zeros, MappedArchiveFormat::padded( bytes ) - bytes );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy reader for memory mapped archives.
+// \ingroup math_serialization
+//
+// The MappedArchive class maps an archive file created by the MappedArchiveWriter into memory
+// and provides views on the contained vectors and matrices without copying any element: Dense
+// matrices are loaded into CustomMatrix instances, dense vectors into CustomVector instances
+// and sparse matrices into MappedCompressedMatrix instances. The entries are read in the order
+// in which they have been written:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::CustomVector;
+   using blaze::MappedCompressedMatrix;
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   CustomMatrix<double,aligned,padded,rowMajor> A;
+   CustomVector<double,aligned,padded,columnVector> x;
+   MappedCompressedMatrix<double,rowMajor> S;
+
+   blaze::MappedArchive archive( "data.blazemap" );
+   archive >> A >> x >> S;
+
+   blaze::DynamicVector<double,columnVector> y( A * x + S * x );
+   \endcode
+
+// The views share the ownership of the mapping, i.e. they remain valid after the archive has
+// been destroyed. Pages are only read from disk when they are accessed. By default, the file is
+// mapped read-only, such that even huge archives can be mapped independent of the overcommit
+// policy of the system. In this case the elements must not be modified via a custom vector or
+// matrix (any write access results in a segmentation fault). In order to modify the elements,
+// a private copy-on-write mapping can be explicitly requested via the second constructor
+// argument. Modifications are then never written back to the file:
+
+   \code
+   blaze::MappedArchive archive( "data.blazemap", true );  // Writable copy-on-write mapping
+   archive >> A;
+
+   A *= 2.0;  // Only the modified pages are copied
+   \endcode
+
+// The element type, the storage order and the kind of the
+// view have to match the stored entry; in case of a mismatch or a corrupt file, a
+// \a std::runtime_error exception is thrown and the position in the archive is not changed.
+*/
+class MappedArchive : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedArchive( const std::string& filename, bool writable=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   template< typename Type, bool AF, bool PF, bool SO >
+   inline MappedArchive& operator>>( CustomMatrix<Type,AF,PF,SO>& dm );
+
+   template< typename Type, bool AF, bool PF, bool TF >
+   inline MappedArchive& operator>>( CustomVector<Type,AF,PF,TF>& dv );
+
+   template< typename Type, bool SO >
+   inline MappedArchive& operator>>( MappedCompressedMatrix<Type,SO>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool eof() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Deleter class*******************************************************************************
+   /*!\brief Deleter for custom vectors and matrices on top of the mapping.
+   //
+   // The Deleter class does not release any memory, but keeps the mapping alive as long as any
+   // custom vector or matrix refers to it.
+   */
+   struct Deleter
+   {
+      template< typename Type >
+      inline void operator()( Type* ) const noexcept {}
+
+      std::shared_ptr<MemoryMap> map_;  //!< The shared memory mapping.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   inline const MappedArchiveEntry& entry( uint8_t type ) const;
+
+   template< typename Type >
+   inline Type* payload() const noexcept;
+
+   template< typename Type, bool AF, bool TF >
+   inline void reset( CustomVector<Type,AF,padded,TF>& dv, Type* ptr, size_t n, size_t nn ) const;
+
+   template< typename Type, bool AF, bool TF >
+   inline void reset( CustomVector<Type,AF,unpadded,TF>& dv, Type* ptr, size_t n, size_t nn ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<MemoryMap> map_;  //!< The memory mapping of the archive file.
+   size_t pos_;                      //!< The position of the next entry.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given archive file into memory.
+//
+// \param filename The name of the archive file.
+// \param writable \a true for a writable copy-on-write mapping, \a false for a read-only mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid archive file.
+//
+// This constructor maps the given file into memory and validates the file header, i.e. the
+// magic string, the version of the format and the endianness of the platform.
+*/
+inline MappedArchive::MappedArchive( const std::string& filename, bool writable )
+   : map_( std::make_shared<MemoryMap>( filename, writable ) )  // The memory mapping of the archive file
+   , pos_( sizeof( MappedArchiveHeader ) )                      // The position of the next entry
+{
+   if( map_->size() < sizeof( MappedArchiveHeader ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive file" );
+   }
+
+   const MappedArchiveHeader& header( *reinterpret_cast<const MappedArchiveHeader*>( map_->data() ) );
+
+   if( std::memcmp( header.magic, MappedArchiveFormat::magic(), sizeof( header.magic ) ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive file" );
+   }
+   else if( header.version != MappedArchiveFormat::version ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unsupported archive version" );
+   }
+   else if( header.endianness != MappedArchiveFormat::endianness ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file has a different endianness" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the next dense matrix of the archive into the given custom matrix.
+//
+// \param dm The custom matrix to be reset to the stored matrix.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid archive entry.
+//
+// The custom matrix is reset to the elements inside the mapping. The stored matrix must have
+// the same element type and storage order as the custom matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline MappedArchive& MappedArchive::operator>>( CustomMatrix<Type,AF,PF,SO>& dm )
+{
+   const MappedArchiveEntry& e( entry<Type>( uint8_t( 0x01 | ( SO ? 0x04 : 0x00 ) ) ) );
+
+   const size_t lines   ( SO ? e.columns : e.rows );
+   const size_t length  ( SO ? e.rows : e.columns );
+   const size_t capacity( e.bytes / sizeof( Type ) );
+
+   if( e.spacing < length || ( e.spacing != 0UL && lines > capacity / e.spacing ) ||
+       e.bytes != MappedArchiveFormat::padded( lines*e.spacing*sizeof( Type ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   Type* ptr( payload<Type>() );
+   dm.reset( ptr, e.rows, e.columns, e.spacing, Deleter{ map_ } );
+
+   pos_ += sizeof( MappedArchiveEntry ) + e.bytes;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the next dense vector of the archive into the given custom vector.
+//
+// \param dv The custom vector to be reset to the stored vector.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid archive entry.
+//
+// The custom vector is reset to the elements inside the mapping. The stored vector must have
+// the same element type as the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline MappedArchive& MappedArchive::operator>>( CustomVector<Type,AF,PF,TF>& dv )
+{
+   const MappedArchiveEntry& e( entry<Type>( uint8_t( 0x00 ) ) );
+
+   if( e.columns != 1UL || e.spacing < e.rows || e.spacing > e.bytes / sizeof( Type ) ||
+       e.bytes != MappedArchiveFormat::padded( e.spacing*sizeof( Type ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   Type* ptr( payload<Type>() );
+   reset( dv, ptr, e.rows, e.spacing );
+
+   pos_ += sizeof( MappedArchiveEntry ) + e.bytes;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the next sparse matrix of the archive into the given mapped compressed matrix.
+//
+// \param sm The mapped compressed matrix to be reset to the stored matrix.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid archive entry.
+//
+// The mapped compressed matrix is reset to the offsets and elements inside the mapping. The
+// stored matrix must have the same element type and storage order as the view. Since the view
+// relies on valid offsets and strictly increasing indices, the offsets and the indices of all
+// non-zero elements are validated before the view is reset.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedArchive& MappedArchive::operator>>( MappedCompressedMatrix<Type,SO>& sm )
+{
+   typedef ValueIndexPair<Type>  Element;
+
+   if( sizeof( size_t ) != sizeof( uint64_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse archive entries require 64-bit indices" );
+   }
+
+   const MappedArchiveEntry& e( entry<Type>( uint8_t( 0x03 | ( SO ? 0x04 : 0x00 ) ) ) );
+
+   const size_t lines ( SO ? e.columns : e.rows );
+   const size_t length( SO ? e.rows : e.columns );
+
+   if( lines >= e.bytes / sizeof( uint64_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   const size_t offsetBytes( MappedArchiveFormat::padded( ( lines+1UL )*sizeof( uint64_t ) ) );
+
+   if( offsetBytes > e.bytes || e.nonZeros > ( e.bytes - offsetBytes ) / sizeof( Element ) ||
+       e.bytes != offsetBytes + MappedArchiveFormat::padded( e.nonZeros*sizeof( Element ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   const byte_t* data( map_->data() + pos_ + sizeof( MappedArchiveEntry ) );
+   const size_t* offsets( reinterpret_cast<const size_t*>( data ) );
+
+   if( offsets[0UL] != 0UL || offsets[lines] != e.nonZeros ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      if( offsets[k] > offsets[k+1UL] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+      }
+   }
+
+   const Element* elements( reinterpret_cast<const Element*>( data + offsetBytes ) );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      for( size_t l=offsets[k]; l<offsets[k+1UL]; ++l ) {
+         if( elements[l].index() >= length ||
+             ( l > offsets[k] && elements[l].index() <= elements[l-1UL].index() ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+         }
+      }
+   }
+   sm.reset( e.rows, e.columns, offsets, elements, map_ );
+
+   pos_ += sizeof( MappedArchiveEntry ) + e.bytes;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all entries of the archive have been read.
+//
+// \return \a true in case the end of the archive has been reached, \a false if not.
+*/
+inline bool MappedArchive::eof() const noexcept
+{
+   return pos_ >= map_->size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the header of the next entry after validating its type and elements.
+//
+// \param type The expected type flags of the entry.
+// \return Reference to the header of the next entry.
+// \exception std::runtime_error Invalid archive entry.
+*/
+template< typename Type >  // Data type of the elements
+inline const MappedArchiveEntry& MappedArchive::entry( uint8_t type ) const
+{
+   if( map_->size() - pos_ < sizeof( MappedArchiveEntry ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "End of archive reached" );
+   }
+
+   const MappedArchiveEntry& e( *reinterpret_cast<const MappedArchiveEntry*>( map_->data() + pos_ ) );
+
+   if( e.type != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector or matrix type detected" );
+   }
+   else if( e.elementType != TypeValueMapping<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( e.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+   else if( e.bytes % MappedArchiveFormat::alignment != 0UL ||
+            e.bytes > map_->size() - pos_ - sizeof( MappedArchiveEntry ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid archive entry" );
+   }
+
+   return e;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the payload of the next entry.
+//
+// \return Pointer to the first element of the payload.
+//
+// Since custom vectors and matrices cannot refer to constant elements, the returned pointer is
+// not const-qualified, even in case of a read-only mapping. In this case the elements must not
+// be modified.
+*/
+template< typename Type >  // Data type of the elements
+inline Type* MappedArchive::payload() const noexcept
+{
+   return const_cast<Type*>( reinterpret_cast<const Type*>( map_->data() + pos_ + sizeof( MappedArchiveEntry ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the given padded custom vector to the given array.
+//
+// \param dv The custom vector to be reset.
+// \param ptr The array of elements inside the mapping.
+// \param n The size of the vector.
+// \param nn The padded size of the array.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF >      // Transpose flag
+inline void MappedArchive::reset( CustomVector<Type,AF,padded,TF>& dv, Type* ptr, size_t n, size_t nn ) const
+{
+   dv.reset( ptr, n, nn, Deleter{ map_ } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the given unpadded custom vector to the given array.
+//
+// \param dv The custom vector to be reset.
+// \param ptr The array of elements inside the mapping.
+// \param n The size of the vector.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF >      // Transpose flag
+inline void MappedArchive::reset( CustomVector<Type,AF,unpadded,TF>& dv, Type* ptr, size_t n, size_t ) const
+{
+   dv.reset( ptr, n, Deleter{ map_ } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
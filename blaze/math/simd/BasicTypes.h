@@ -81,7 +81,12 @@ struct SIMDint8 : public SIMDi8< SIMDint8 >
    using BaseType  = SIMDi8<This>;
    using ValueType = int8_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDint8() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 64UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDint8() noexcept : value( 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -129,7 +134,12 @@ struct SIMDuint8 : public SIMDi8< SIMDuint8 >
    using BaseType  = SIMDi8<This>;
    using ValueType = uint8_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDuint8() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 64UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDuint8() noexcept : value( 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -198,7 +208,12 @@ struct SIMDcint8 : public SIMDci8< SIMDcint8 >
    using BaseType  = SIMDci8<This>;
    using ValueType = complex<int8_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDcint8() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 32UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDcint8() noexcept : value( 0, 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -246,7 +261,12 @@ struct SIMDcuint8 : public SIMDci8< SIMDcuint8 >
    using BaseType  = SIMDci8<This>;
    using ValueType = complex<uint8_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDcuint8() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 32UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDcuint8() noexcept : value( 0, 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -315,7 +335,12 @@ struct SIMDint16 : public SIMDi16< SIMDint16 >
    using BaseType  = SIMDi16<This>;
    using ValueType = int16_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDint16() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 32UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDint16() noexcept : value( 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -363,7 +388,12 @@ struct SIMDuint16 : public SIMDi16< SIMDuint16 >
    using BaseType  = SIMDi16<This>;
    using ValueType = uint16_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDuint16() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 32UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDuint16() noexcept : value( 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -432,7 +462,12 @@ struct SIMDcint16 : public SIMDci16< SIMDcint16 >
    using BaseType  = SIMDci16<This>;
    using ValueType = complex<int16_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDcint16() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 16UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDcint16() noexcept : value( 0, 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -480,7 +515,12 @@ struct SIMDcuint16 : public SIMDci16< SIMDcuint16 >
    using BaseType  = SIMDci16<This>;
    using ValueType = complex<uint16_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   using IntrinsicType = __m512i;
+   BLAZE_ALWAYS_INLINE SIMDcuint16() noexcept : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
+   enum : size_t { size = 16UL };
+#elif BLAZE_MIC_MODE
    using IntrinsicType = ValueType;
    BLAZE_ALWAYS_INLINE SIMDcuint16() noexcept : value( 0, 0 ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t /*i*/ ) const noexcept { return value; }
@@ -549,7 +589,7 @@ struct SIMDint32 : public SIMDi32< SIMDint32 >
    using BaseType  = SIMDi32<This>;
    using ValueType = int32_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDint32() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -597,7 +637,7 @@ struct SIMDuint32 : public SIMDi32< SIMDuint32 >
    using BaseType  = SIMDi32<This>;
    using ValueType = uint32_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDuint32() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -666,7 +706,7 @@ struct SIMDcint32 : public SIMDci32< SIMDcint32 >
    using BaseType  = SIMDci32<This>;
    using ValueType = complex<int32_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDcint32() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -714,7 +754,7 @@ struct SIMDcuint32 : public SIMDci32< SIMDcuint32 >
    using BaseType  = SIMDci32<This>;
    using ValueType = complex<uint32_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDcuint32() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -783,7 +823,7 @@ struct SIMDint64 : public SIMDi64< SIMDint64 >
    using BaseType  = SIMDi64<This>;
    using ValueType = int64_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDint64() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -831,7 +871,7 @@ struct SIMDuint64 : public SIMDi64< SIMDuint64 >
    using BaseType  = SIMDi64<This>;
    using ValueType = uint64_t;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDuint64() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -900,7 +940,7 @@ struct SIMDcint64 : public SIMDci64< SIMDcint64 >
    using BaseType  = SIMDci64<This>;
    using ValueType = complex<int64_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDcint64() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -948,7 +988,7 @@ struct SIMDcuint64 : public SIMDci64< SIMDcuint64 >
    using BaseType  = SIMDci64<This>;
    using ValueType = complex<uint64_t>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512i;
    BLAZE_ALWAYS_INLINE SIMDcuint64() noexcept : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -1017,7 +1057,7 @@ struct SIMDfloat : public SIMDf32< SIMDfloat >
    using BaseType  = SIMDf32<This>;
    using ValueType = float;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512;
    BLAZE_ALWAYS_INLINE SIMDfloat() noexcept : value( _mm512_setzero_ps() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -1088,7 +1128,7 @@ struct SIMDcfloat : public SIMDcf32< SIMDcfloat >
    using BaseType  = SIMDcf32<This>;
    using ValueType = complex<float>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512;
    BLAZE_ALWAYS_INLINE SIMDcfloat() noexcept : value( _mm512_setzero_ps() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -1157,7 +1197,7 @@ struct SIMDdouble : public SIMDf64< SIMDdouble >
    using BaseType  = SIMDf64<This>;
    using ValueType = double;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512d;
    BLAZE_ALWAYS_INLINE SIMDdouble() noexcept : value( _mm512_setzero_pd() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -1228,7 +1268,7 @@ struct SIMDcdouble : public SIMDcf64< SIMDcdouble >
    using BaseType  = SIMDcf64<This>;
    using ValueType = complex<double>;
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    using IntrinsicType = __m512d;
    BLAZE_ALWAYS_INLINE SIMDcdouble() noexcept : value( _mm512_setzero_pd() ) {}
    BLAZE_ALWAYS_INLINE ValueType operator[]( size_t i ) const noexcept { return reinterpret_cast<const ValueType*>( &value )[i]; }
@@ -0,0 +1,91 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Cvtloadu.h
+//  \brief Header file for the SIMD converting load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_CVTLOADU_H_
+#define _BLAZE_MATH_SIMD_CVTLOADU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT TO 64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float' values and converts them to 'double' values.
+// \ingroup simd
+//
+// \param address The first 'float' value to be loaded.
+// \return The loaded and converted vector of 'double' values.
+//
+// This function loads \a SIMDdouble::size consecutive single precision values and widens them
+// to double precision within the SIMD registers. It enables mixed-precision kernels that store
+// their operands in single precision but compute in double precision. In contrast to the
+// \c loada() function, the given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble cvtloadu( const float* address ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cvtps_pd( _mm256_loadu_ps( address ) );
+#elif BLAZE_MIC_MODE
+   double tmp[SIMDdouble::size];
+   for( size_t i=0UL; i<SIMDdouble::size; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#elif BLAZE_AVX_MODE
+   return _mm256_cvtps_pd( _mm_loadu_ps( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_cvtps_pd( _mm_castsi128_ps( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( address ) ) ) );
+#else
+   return static_cast<double>( *address );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
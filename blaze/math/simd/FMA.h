@@ -93,7 +93,7 @@ struct SIMDf32FmaddExpr : public SIMDf32< SIMDf32FmaddExpr<T1,T2,T3> >
    // \return The resulting packed 32-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDfloat eval() const noexcept
-#if BLAZE_FMA_MODE && BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
    {
       return _mm512_fmadd_ps( a_.eval().value, b_.eval().value, c_.eval().value );
    }
@@ -156,7 +156,7 @@ struct SIMDf32FmsubExpr : public SIMDf32< SIMDf32FmsubExpr<T1,T2,T3> >
    // \return The resulting packed 32-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDfloat eval() const noexcept
-#if BLAZE_FMA_MODE && BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
    {
       return _mm512_fmsub_ps( a_.eval().value, b_.eval().value, c_.eval().value );
    }
@@ -805,7 +805,7 @@ struct SIMDf64FmaddExpr : public SIMDf64< SIMDf64FmaddExpr<T1,T2,T3> >
    // \return The resulting packed 64-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDdouble eval() const noexcept
-#if BLAZE_FMA_MODE && BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
    {
       return _mm512_fmadd_pd( a_.eval().value, b_.eval().value, c_.eval().value );
    }
@@ -868,7 +868,7 @@ struct SIMDf64FmsubExpr : public SIMDf64< SIMDf64FmsubExpr<T1,T2,T3> >
    // \return The resulting packed 64-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDdouble eval() const noexcept
-#if BLAZE_FMA_MODE && BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
    {
       return _mm512_fmsub_pd( a_.eval().value, b_.eval().value, c_.eval().value );
    }
@@ -53,6 +53,7 @@
 #include <blaze/math/simd/Conj.h>
 #include <blaze/math/simd/Cos.h>
 #include <blaze/math/simd/Cosh.h>
+#include <blaze/math/simd/Cvtloadu.h>
 #include <blaze/math/simd/Division.h>
 #include <blaze/math/simd/Erf.h>
 #include <blaze/math/simd/Erfc.h>
@@ -61,6 +62,7 @@
 #include <blaze/math/simd/Exp10.h>
 #include <blaze/math/simd/Floor.h>
 #include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Gather.h>
 #include <blaze/math/simd/InvCbrt.h>
 #include <blaze/math/simd/InvSqrt.h>
 #include <blaze/math/simd/Loada.h>
@@ -68,10 +70,15 @@
 #include <blaze/math/simd/Log.h>
 #include <blaze/math/simd/Log2.h>
 #include <blaze/math/simd/Log10.h>
+#include <blaze/math/simd/Maskloadu.h>
+#include <blaze/math/simd/Maskstoreu.h>
+#include <blaze/math/simd/Max.h>
+#include <blaze/math/simd/Min.h>
 #include <blaze/math/simd/Multiplication.h>
 #include <blaze/math/simd/Pow.h>
 #include <blaze/math/simd/Reduction.h>
 #include <blaze/math/simd/Round.h>
+#include <blaze/math/simd/Scatter.h>
 #include <blaze/math/simd/Set.h>
 #include <blaze/math/simd/Setzero.h>
 #include <blaze/math/simd/Sin.h>
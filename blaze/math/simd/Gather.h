@@ -0,0 +1,188 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float' values from non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the single precision floating point values.
+// \param indices The \a SIMDfloat::size offsets of the values to be loaded.
+// \return The loaded vector of single precision floating point values.
+//
+// This function loads the values \c address[indices[0]], \c address[indices[1]], ... into a
+// single SIMD vector. The offsets are not required to be sorted or to be properly aligned, but
+// all of them must refer to valid memory locations.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const uint32_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), 0xFFFF, _mm512_loadu_si512( indices ), address, 4 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 4 );
+#else
+   float tmp[SIMDfloat::size];
+   for( size_t i=0UL; i<SIMDfloat::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float' values from non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the single precision floating point values.
+// \param indices The \a SIMDfloat::size offsets of the values to be loaded.
+// \return The loaded vector of single precision floating point values.
+//
+// This function loads the values \c address[indices[0]], \c address[indices[1]], ... into a
+// single SIMD vector. In contrast to the gather() function for 32-bit offsets, the offsets can
+// address the complete memory. They are not required to be sorted or to be properly aligned, but
+// all of them must refer to valid memory locations.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE && SIZE_MAX == UINT64_MAX
+   const __m256 lo( _mm512_mask_i64gather_ps( _mm256_setzero_ps(), 0xFF,
+                                              _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256 hi( _mm512_mask_i64gather_ps( _mm256_setzero_ps(), 0xFF,
+                                              _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   const __m512d tmp( _mm512_maskz_insertf64x4( 0xFF, _mm512_setzero_pd(), _mm256_castps_pd( lo ), 0 ) );
+   return _mm512_castpd_ps( _mm512_maskz_insertf64x4( 0xFF, tmp, _mm256_castps_pd( hi ), 1 ) );
+#elif BLAZE_AVX2_MODE && SIZE_MAX == UINT64_MAX
+   const __m128 lo( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ), 4 ) );
+   const __m128 hi( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ), 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( lo ), hi, 1 );
+#else
+   float tmp[SIMDfloat::size];
+   for( size_t i=0UL; i<SIMDfloat::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'double' values from non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the double precision floating point values.
+// \param indices The \a SIMDdouble::size offsets of the values to be loaded.
+// \return The loaded vector of double precision floating point values.
+//
+// This function loads the values \c address[indices[0]], \c address[indices[1]], ... into a
+// single SIMD vector. The offsets are not required to be sorted or to be properly aligned, but
+// all of them must refer to valid memory locations.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, const uint32_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), 0xFF,
+                                    _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_pd( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ), 8 );
+#else
+   double tmp[SIMDdouble::size];
+   for( size_t i=0UL; i<SIMDdouble::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'double' values from non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the double precision floating point values.
+// \param indices The \a SIMDdouble::size offsets of the values to be loaded.
+// \return The loaded vector of double precision floating point values.
+//
+// This function loads the values \c address[indices[0]], \c address[indices[1]], ... into a
+// single SIMD vector. In contrast to the gather() function for 32-bit offsets, the offsets can
+// address the complete memory. They are not required to be sorted or to be properly aligned, but
+// all of them must refer to valid memory locations.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE && SIZE_MAX == UINT64_MAX
+   return _mm512_mask_i64gather_pd( _mm512_setzero_pd(), 0xFF, _mm512_loadu_si512( indices ), address, 8 );
+#elif BLAZE_AVX2_MODE && SIZE_MAX == UINT64_MAX
+   return _mm256_i64gather_pd( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 8 );
+#else
+   double tmp[SIMDdouble::size];
+   for( size_t i=0UL; i<SIMDdouble::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
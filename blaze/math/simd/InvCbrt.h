@@ -64,7 +64,11 @@ namespace blaze {
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat invcbrt( const SIMDf32<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_AVX_MODE
+#if BLAZE_SVML_MODE && BLAZE_AVX512F_MODE
+{
+   return _mm512_invcbrt_ps( (~a).eval().value );
+}
+#elif BLAZE_SVML_MODE && BLAZE_AVX_MODE
 {
    return _mm256_invcbrt_ps( (~a).eval().value );
 }
@@ -97,7 +101,11 @@ BLAZE_ALWAYS_INLINE const SIMDfloat invcbrt( const SIMDf32<T>& a ) noexcept
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble invcbrt( const SIMDf64<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_AVX_MODE
+#if BLAZE_SVML_MODE && BLAZE_AVX512F_MODE
+{
+   return _mm512_invcbrt_pd( (~a).eval().value );
+}
+#elif BLAZE_SVML_MODE && BLAZE_AVX_MODE
 {
    return _mm256_invcbrt_pd( (~a).eval().value );
 }
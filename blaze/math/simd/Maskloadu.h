@@ -0,0 +1,502 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Maskloadu.h
+//  \brief Header file for the SIMD masked unaligned load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_MASKLOADU_H_
+#define _BLAZE_MATH_SIMD_MASKLOADU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  8-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 1-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 1-byte integral values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
+                                   , If_< IsSigned<T>, SIMDint8, SIMDuint8 > >
+   maskloadu( const T* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDint8::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   return _mm512_maskz_loadu_epi8( static_cast<__mmask64>( 0xFFFFFFFFFFFFFFFFULL >> ( 64UL - n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDint8, SIMDuint8 >;
+
+   T tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 1-byte integral complex values.
+// \ingroup simd
+//
+// \param address The first integral complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral complex values.
+//
+// This function loads the first \a n elements of a vector of 1-byte integral complex values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
+                                   , If_< IsSigned<T>, SIMDcint8, SIMDcuint8 > >
+   maskloadu( const complex<T>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcint8::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   return _mm512_maskz_loadu_epi8( static_cast<__mmask64>( 0xFFFFFFFFFFFFFFFFULL >> ( 64UL - 2UL*n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDcint8, SIMDcuint8 >;
+
+   complex<T> tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  16-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 2-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 2-byte integral values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
+                                   , If_< IsSigned<T>, SIMDint16, SIMDuint16 > >
+   maskloadu( const T* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDint16::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   return _mm512_maskz_loadu_epi16( static_cast<__mmask32>( 0xFFFFFFFFU >> ( 32UL - n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDint16, SIMDuint16 >;
+
+   T tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 2-byte integral complex values.
+// \ingroup simd
+//
+// \param address The first integral complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral complex values.
+//
+// This function loads the first \a n elements of a vector of 2-byte integral complex values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
+                                   , If_< IsSigned<T>, SIMDcint16, SIMDcuint16 > >
+   maskloadu( const complex<T>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcint16::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   return _mm512_maskz_loadu_epi16( static_cast<__mmask32>( 0xFFFFFFFFU >> ( 32UL - 2UL*n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDcint16, SIMDcuint16 >;
+
+   complex<T> tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 4-byte integral values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
+                                   , If_< IsSigned<T>, SIMDint32, SIMDuint32 > >
+   maskloadu( const T* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDint32::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi32( static_cast<__mmask16>( 0xFFFFU >> ( 16UL - n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDint32, SIMDuint32 >;
+
+   T tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 4-byte integral complex values.
+// \ingroup simd
+//
+// \param address The first integral complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral complex values.
+//
+// This function loads the first \a n elements of a vector of 4-byte integral complex values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
+                                   , If_< IsSigned<T>, SIMDcint32, SIMDcuint32 > >
+   maskloadu( const complex<T>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcint32::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi32( static_cast<__mmask16>( 0xFFFFU >> ( 16UL - 2UL*n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDcint32, SIMDcuint32 >;
+
+   complex<T> tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 8-byte integral values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
+                                   , If_< IsSigned<T>, SIMDint64, SIMDuint64 > >
+   maskloadu( const T* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDint64::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi64( static_cast<__mmask8>( 0xFFU >> ( 8UL - n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDint64, SIMDuint64 >;
+
+   T tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 8-byte integral complex values.
+// \ingroup simd
+//
+// \param address The first integral complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of integral complex values.
+//
+// This function loads the first \a n elements of a vector of 8-byte integral complex values and sets
+// all remaining elements to zero. The memory behind the first \a n values is not accessed.
+// In contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
+                                   , If_< IsSigned<T>, SIMDcint64, SIMDcuint64 > >
+   maskloadu( const complex<T>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcint64::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi64( static_cast<__mmask8>( 0xFFU >> ( 8UL - 2UL*n ) ), address );
+#else
+   using SIMDType = If_< IsSigned<T>, SIMDcint64, SIMDcuint64 >;
+
+   complex<T> tmp[SIMDType::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 'float' values.
+// \ingroup simd
+//
+// \param address The first single precision floating point value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of single precision floating point values.
+//
+// This function loads the first \a n elements of a vector of 'float' values and sets all
+// remaining elements to zero. The memory behind the first \a n values is not accessed. In
+// contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat maskloadu( const float* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDfloat::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( 0xFFFFU >> ( 16UL - n ) ), address );
+#else
+   float tmp[SIMDfloat::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 'complex<float>' values.
+// \ingroup simd
+//
+// \param address The first single precision complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of single precision complex values.
+//
+// This function loads the first \a n elements of a vector of 'complex<float>' values and sets all
+// remaining elements to zero. The memory behind the first \a n values is not accessed. In
+// contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDcfloat maskloadu( const complex<float>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcfloat::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( 0xFFFFU >> ( 16UL - 2UL*n ) ), reinterpret_cast<const float*>( address ) );
+#else
+   complex<float> tmp[SIMDcfloat::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 'double' values.
+// \ingroup simd
+//
+// \param address The first double precision floating point value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of double precision floating point values.
+//
+// This function loads the first \a n elements of a vector of 'double' values and sets all
+// remaining elements to zero. The memory behind the first \a n values is not accessed. In
+// contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble maskloadu( const double* address, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDdouble::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( 0xFFU >> ( 8UL - n ) ), address );
+#else
+   double tmp[SIMDdouble::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a partial vector of 'complex<double>' values.
+// \ingroup simd
+//
+// \param address The first double precision complex value to be loaded.
+// \param n The number of values to be loaded \f$[1..SIMDSIZE]\f$.
+// \return The loaded vector of double precision complex values.
+//
+// This function loads the first \a n elements of a vector of 'complex<double>' values and sets all
+// remaining elements to zero. The memory behind the first \a n values is not accessed. In
+// contrast to the according \c loadu() function, it can therefore be used to load the
+// remainder of an array. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDcdouble maskloadu( const complex<double>* address, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcdouble::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( 0xFFU >> ( 8UL - 2UL*n ) ), reinterpret_cast<const double*>( address ) );
+#else
+   complex<double> tmp[SIMDcdouble::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,498 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Maskstoreu.h
+//  \brief Header file for the SIMD masked unaligned store functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_MASKSTOREU_H_
+#define _BLAZE_MATH_SIMD_MASKSTOREU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  8-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 1-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 1-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 1-byte integral values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
+   maskstoreu( T1* address, const SIMDi8<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   _mm512_mask_storeu_epi8( address, static_cast<__mmask64>( 0xFFFFFFFFFFFFFFFFULL >> ( 64UL - n ) ), (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 1-byte integral complex values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 1-byte integral complex vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 1-byte integral complex values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
+   maskstoreu( complex<T1>* address, const SIMDci8<T2>& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   _mm512_mask_storeu_epi8( address, static_cast<__mmask64>( 0xFFFFFFFFFFFFFFFFULL >> ( 64UL - 2UL*n ) ), (~value).value );
+#else
+   complex<T1> tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  16-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 2-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 2-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 2-byte integral values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
+   maskstoreu( T1* address, const SIMDi16<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   _mm512_mask_storeu_epi16( address, static_cast<__mmask32>( 0xFFFFFFFFU >> ( 32UL - n ) ), (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 2-byte integral complex values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 2-byte integral complex vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 2-byte integral complex values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
+   maskstoreu( complex<T1>* address, const SIMDci16<T2>& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   _mm512_mask_storeu_epi16( address, static_cast<__mmask32>( 0xFFFFFFFFU >> ( 32UL - 2UL*n ) ), (~value).value );
+#else
+   complex<T1> tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 4-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 4-byte integral values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
+   maskstoreu( T1* address, const SIMDi32<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi32( address, static_cast<__mmask16>( 0xFFFFU >> ( 16UL - n ) ), (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 4-byte integral complex values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 4-byte integral complex vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 4-byte integral complex values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
+   maskstoreu( complex<T1>* address, const SIMDci32<T2>& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi32( address, static_cast<__mmask16>( 0xFFFFU >> ( 16UL - 2UL*n ) ), (~value).value );
+#else
+   complex<T1> tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 8-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 8-byte integral values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
+   maskstoreu( T1* address, const SIMDi64<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi64( address, static_cast<__mmask8>( 0xFFU >> ( 8UL - n ) ), (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 8-byte integral complex values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 8-byte integral complex vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 8-byte integral complex values. The
+// memory behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address is
+// not required to be properly aligned.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
+   maskstoreu( complex<T1>* address, const SIMDci64<T2>& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi64( address, static_cast<__mmask8>( 0xFFU >> ( 8UL - 2UL*n ) ), (~value).value );
+#else
+   complex<T1> tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'float' values. The memory
+// behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address
+// is not required to be properly aligned.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void maskstoreu( float* address, const SIMDf32<T>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDfloat::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_ps( address, static_cast<__mmask16>( 0xFFFFU >> ( 16UL - n ) ), (~value).eval().value );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, (~value).eval() );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 'complex<float>' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'complex<float>' vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'complex<float>' values. The memory
+// behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address
+// is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstoreu( complex<float>* address, const SIMDcfloat& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcfloat::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_ps( reinterpret_cast<float*>( address ), static_cast<__mmask16>( 0xFFFFU >> ( 16UL - 2UL*n ) ), value.value );
+#else
+   complex<float> tmp[SIMDcfloat::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'double' vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'double' values. The memory
+// behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address
+// is not required to be properly aligned.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void maskstoreu( double* address, const SIMDf64<T>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDdouble::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_pd( address, static_cast<__mmask8>( 0xFFU >> ( 8UL - n ) ), (~value).eval().value );
+#else
+   double tmp[SIMDdouble::size];
+   storeu( tmp, (~value).eval() );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a vector of 'complex<double>' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'complex<double>' vector to be stored.
+// \param n The number of values to be stored \f$[1..SIMDSIZE]\f$.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'complex<double>' values. The memory
+// behind the first \a n values is not accessed. In contrast to the according \c storeu()
+// function, it can therefore be used to store the remainder of an array. The given address
+// is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE void maskstoreu( complex<double>* address, const SIMDcdouble& value, size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+   BLAZE_INTERNAL_ASSERT( n > 0UL && n <= SIMDcdouble::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_pd( reinterpret_cast<double*>( address ), static_cast<__mmask8>( 0xFFU >> ( 8UL - 2UL*n ) ), value.value );
+#else
+   complex<double> tmp[SIMDcdouble::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
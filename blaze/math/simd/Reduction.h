@@ -40,9 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/functors/Forward.h>
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storeu.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -53,6 +56,37 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the sum of all elements in the 8-bit integral SIMD vector.
+// \ingroup simd
+//
+// \param a The vector to be sumed up.
+// \return The sum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE int8_t sum( const SIMDint8& a ) noexcept
+{
+#if BLAZE_AVX512BW_MODE
+   const __m512i b( _mm512_sad_epu8( a.value, _mm512_setzero_si512() ) );
+   const __m256i c = _mm256_add_epi64( _mm512_maskz_extracti64x4_epi64( 0xF, b, 1 )
+                                     , _mm512_maskz_extracti64x4_epi64( 0xF, b, 0 ) );
+   const __m128i d = _mm_add_epi64( _mm256_extracti128_si256( c, 1 )
+                                  , _mm256_castsi256_si128( c ) );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( d ) + _mm_extract_epi16( d, 4 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256i b( _mm256_sad_epu8( a.value, _mm256_setzero_si256() ) );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( c ) + _mm_extract_epi16( c, 4 ) );
+#elif BLAZE_SSE2_MODE
+   const __m128i b( _mm_sad_epu8( a.value, _mm_setzero_si128() ) );
+   return static_cast<int8_t>( _mm_cvtsi128_si32( b ) + _mm_extract_epi16( b, 4 ) );
+#else
+   return a.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the sum of all elements in the 8-bit integral complex SIMD vector.
 // \ingroup simd
@@ -62,7 +96,12 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int8_t>( a[ 0] + a[ 1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                           a[ 8] + a[ 9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] +
+                           a[16] + a[17] + a[18] + a[19] + a[20] + a[21] + a[22] + a[23] +
+                           a[24] + a[25] + a[26] + a[27] + a[28] + a[29] + a[30] + a[31] );
+#elif BLAZE_AVX2_MODE
    return complex<int8_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
 #elif BLAZE_SSE2_MODE
@@ -91,7 +130,16 @@ BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   const __m256i b = _mm256_add_epi16( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                     , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) );
+   const __m256i c( _mm256_hadd_epi16( b, b ) );
+   const __m256i d( _mm256_hadd_epi16( c, c ) );
+   const __m256i e( _mm256_hadd_epi16( d, d ) );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi16( a.value, a.value ) );
    const __m256i c( _mm256_hadd_epi16( b, b ) );
    const __m256i d( _mm256_hadd_epi16( c, c ) );
@@ -121,7 +169,10 @@ BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int16_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
+#elif BLAZE_AVX2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_SSE2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] );
@@ -149,7 +200,15 @@ BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b = _mm256_add_epi32( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                     , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) );
+   const __m256i c( _mm256_hadd_epi32( b, b ) );
+   const __m256i d( _mm256_hadd_epi32( c, c ) );
+   const __m128i e = _mm_add_epi32( _mm256_extracti128_si256( d, 1 )
+                                  , _mm256_castsi256_si128( d ) );
+   return _mm_extract_epi32( e, 0 );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi32( a.value, a.value ) );
@@ -179,7 +238,7 @@ BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX2_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] );
@@ -209,7 +268,13 @@ BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b = _mm256_add_epi64( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                     , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return _mm_cvtsi128_si64( c ) + _mm_extract_epi64( c, 1 );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
@@ -231,7 +296,7 @@ BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int64_t>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX2_MODE
    return complex<int64_t>( a[0] + a[1] );
@@ -261,7 +326,15 @@ BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m512d tmp( _mm512_castps_pd( a.value ) );
+   const __m256 b = _mm256_add_ps( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, tmp, 1 ) )
+                                 , _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, tmp, 0 ) ) );
+   const __m256 c( _mm256_hadd_ps( b, b ) );
+   const __m256 d( _mm256_hadd_ps( c, c ) );
+   const __m128 e = _mm_add_ps( _mm256_extractf128_ps( d, 1 ), _mm256_castps256_ps128( d ) );
+   return _mm_cvtss_f32( e );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
 #elif BLAZE_AVX_MODE
    const __m256 b( _mm256_hadd_ps( a.value, a.value ) );
@@ -290,7 +363,7 @@ BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -320,7 +393,13 @@ BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256d b = _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xF, a.value, 1 )
+                                  , _mm512_maskz_extractf64x4_pd( 0xF, a.value, 0 ) );
+   const __m256d c( _mm256_hadd_pd( b, b ) );
+   const __m128d d = _mm_add_pd( _mm256_extractf128_pd( c, 1 ), _mm256_castpd256_pd128( c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
 #elif BLAZE_AVX_MODE
    const __m256d b( _mm256_hadd_pd( a.value, a.value ) );
@@ -347,7 +426,7 @@ BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<double> sum( const SIMDcdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
@@ -359,6 +438,61 @@ BLAZE_ALWAYS_INLINE const complex<double> sum( const SIMDcdouble& a ) noexcept
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  GENERIC REDUCTION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduces the elements of the given SIMD vector by means of a binary operation.
+// \ingroup simd
+//
+// \param a The vector to be reduced.
+// \param op The binary reduction operation.
+// \return The result of the reduction operation.
+//
+// This function folds all elements of the given SIMD vector into a single value by means of
+// the given binary operation. The operation is expected to be associative and commutative.
+*/
+template< typename T     // Type of the SIMD vector
+        , typename OP >  // Type of the reduction operation
+BLAZE_ALWAYS_INLINE const typename T::ValueType reduce( const SIMDPack<T>& a, OP op )
+{
+   typedef typename T::ValueType  ValueType;
+
+   ValueType array[T::size];
+   storeu( array, ~a );
+
+   ValueType redux( array[0UL] );
+   for( size_t i=1UL; i<T::size; ++i ) {
+      redux = op( redux, array[i] );
+   }
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the elements of the given SIMD vector by means of an addition.
+// \ingroup simd
+//
+// \param a The vector to be reduced.
+// \return The sum of all vector elements.
+//
+// This overload of the reduce() function maps the addition onto the according horizontal
+// sum() operation.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const typename T::ValueType reduce( const SIMDPack<T>& a, const Add& )
+{
+   return sum( ~a );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
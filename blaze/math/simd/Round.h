@@ -60,11 +60,15 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available for SSE4.1 and AVX.
+// This operation is only available for SSE4.1, AVX, and AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat round( const SIMDf32<T>& a ) noexcept
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_roundscale_ps( (~a).eval().value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+}
+#elif BLAZE_AVX_MODE
 {
    return _mm256_round_ps( (~a).eval().value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
 }
@@ -93,11 +97,15 @@ BLAZE_ALWAYS_INLINE const SIMDfloat round( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available for SSE4.1 and AVX.
+// This operation is only available for SSE4.1, AVX, and AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble round( const SIMDf64<T>& a ) noexcept
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_roundscale_pd( (~a).eval().value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+}
+#elif BLAZE_AVX_MODE
 {
    return _mm256_round_pd( (~a).eval().value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
 }
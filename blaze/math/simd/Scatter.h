@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Scatter.h
+//  \brief Header file for the SIMD scatter functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_SCATTER_H_
+#define _BLAZE_MATH_SIMD_SCATTER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores a vector of 'float' values to non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the single precision floating point values.
+// \param indices The \a SIMDfloat::size offsets of the target locations.
+// \param value The single precision floating point vector to be stored.
+// \return void
+//
+// This function stores the values of the given SIMD vector to \c address[indices[0]],
+// \c address[indices[1]], ... The offsets are not required to be sorted or to be properly
+// aligned, but all of them must refer to valid memory locations. In case several offsets
+// refer to the same location, the value with the highest position in the vector is stored.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( float* address, const size_t* indices, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE && SIZE_MAX == UINT64_MAX
+   const __m512d tmp( _mm512_castps_pd( (~value).eval().value ) );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices ),
+                         _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, tmp, 0 ) ), 4 );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices+8UL ),
+                         _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, tmp, 1 ) ), 4 );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i )
+      address[indices[i]] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores a vector of 'double' values to non-contiguous memory locations.
+// \ingroup simd
+//
+// \param address The base address of the double precision floating point values.
+// \param indices The \a SIMDdouble::size offsets of the target locations.
+// \param value The double precision floating point vector to be stored.
+// \return void
+//
+// This function stores the values of the given SIMD vector to \c address[indices[0]],
+// \c address[indices[1]], ... The offsets are not required to be sorted or to be properly
+// aligned, but all of them must refer to valid memory locations. In case several offsets
+// refer to the same location, the value with the highest position in the vector is stored.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( double* address, const size_t* indices, const SIMDf64<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE && SIZE_MAX == UINT64_MAX
+   _mm512_i64scatter_pd( address, _mm512_loadu_si512( indices ), (~value).eval().value, 8 );
+#else
+   double tmp[SIMDdouble::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDdouble::size; ++i )
+      address[indices[i]] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -75,7 +75,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
    storeu( T1* address, const SIMDi8<T2>& value ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -104,7 +106,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -139,7 +143,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
    storeu( T1* address, const SIMDi16<T2>& value ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -168,7 +174,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -203,7 +211,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
    storeu( T1* address, const SIMDi32<T2>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi32( address     , (~value).value );
    _mm512_packstorehi_epi32( address+16UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -235,7 +245,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi32( address    , (~value).value );
    _mm512_packstorehi_epi32( address+8UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -273,7 +285,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
    storeu( T1* address, const SIMDi64<T2>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi64( address    , (~value).value );
    _mm512_packstorehi_epi64( address+8UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -305,7 +319,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi64( address    , (~value).value );
    _mm512_packstorehi_epi64( address+4UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -341,7 +357,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( float* address, const SIMDf32<T>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( address, (~value).eval().value );
+#elif BLAZE_MIC_MODE
    const SIMDfloat( (~value).eval().value );
    _mm512_packstorelo_ps( address     , tmp );
    _mm512_packstorehi_ps( address+16UL, tmp );
@@ -371,7 +389,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( reinterpret_cast<float*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_ps( reinterpret_cast<float*>( address     ), value.value );
    _mm512_packstorehi_ps( reinterpret_cast<float*>( address+8UL ), value.value );
 #elif BLAZE_AVX_MODE
@@ -407,7 +427,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( double* address, const SIMDf64<T>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( address, (~value).eval().value );
+#elif BLAZE_MIC_MODE
    const SIMDdouble tmp( (~value).eval().value );
    _mm512_packstorelo_pd( address    , tmp );
    _mm512_packstorehi_pd( address+8UL, tmp );
@@ -437,7 +459,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<double>* address, const SIMDcdouble& va
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( reinterpret_cast<double*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_pd( reinterpret_cast<double*>( address     ), value.value );
    _mm512_packstorehi_pd( reinterpret_cast<double*>( address+4UL ), value.value );
 #elif BLAZE_AVX_MODE
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +90,22 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+#if BLAZE_OPENMP_PARALLEL_MODE
    static bool active_;  //!< Activity flag for the parallel section.
                          /*!< In case a parallel section is active (i.e. the currently executed
                               code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+                              otherwise it is \a false. The flag is shared by all threads, since
+                              the OpenMP backends are executed by the threads of an OpenMP team
+                              that did not start the parallel section themselves. */
+#else
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the
+                                           currently executed code is inside a parallel
+                                           section), the flag is set to \a true, otherwise
+                                           it is \a false. The flag is thread-local in order
+                                           to enable nested SMP assignments from within the
+                                           tasks of the thread backend system. */
+#endif
    //@}
    //**********************************************************************************************
 
@@ -115,8 +128,13 @@ class ParallelSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_OPENMP_PARALLEL_MODE
 template< typename T >
 bool ParallelSection<T>::active_ = false;
+#else
+template< typename T >
+thread_local bool ParallelSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -0,0 +1,95 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/BatchMatrix.h
+//  \brief Header file for the default batch matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_BATCHMATRIX_H_
+#define _BLAZE_MATH_SMP_DEFAULT_BATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/Forward.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BatchMatrix SMP functions */
+//@{
+template< typename Type, size_t M, size_t N, typename OP >
+inline void smpBatch( const BatchMatrix<Type,M,N>& batch, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP execution of an operation on a batch of matrices.
+// \ingroup smp
+//
+// \param batch The batch of matrices the operation is applied to.
+// \param op The batch operation to be executed.
+// \return void
+//
+// This function implements the default SMP execution of an operation on a batch of matrices.
+// The operation is called once for the complete batch, i.e. for the range \f$ [0..N) \f$.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the batch
+        , size_t M       // Number of rows of the matrices
+        , size_t N       // Number of columns of the matrices
+        , typename OP >  // Type of the batch operation
+inline void smpBatch( const BatchMatrix<Type,M,N>& batch, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   op( 0UL, batch.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
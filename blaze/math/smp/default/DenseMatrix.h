@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/system/SMP.h>
@@ -72,6 +74,12 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsDenseMatrix<MT1> >
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename OP >
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< typename VT, bool TF, typename MT, bool SO, typename OP >
+inline void smpReduce( DenseVector<VT,TF>& y, const DenseMatrix<MT,SO>& dm, OP op );
 //@}
 //*************************************************************************************************
 
@@ -169,6 +177,64 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP row-wise or column-wise reduction of a dense matrix.
+// \ingroup smp
+//
+// \param y The target dense vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the default SMP row-wise (in case \a y is a column vector) or
+// column-wise (in case \a y is a row vector) reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline void smpReduce( DenseVector<VT,TF>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == ( TF ? (~dm).columns() : (~dm).rows() ), "Invalid vector size" );
+
+   dmatreduce( ~y, ~dm, op );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
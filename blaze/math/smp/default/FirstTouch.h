@@ -0,0 +1,128 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/FirstTouch.h
+//  \brief Header file for the default first-touch initialization SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name First-touch initialization SMP functions */
+//@{
+template< typename VT, bool TF, typename OP >
+inline void smpFirstTouch( DenseVector<VT,TF>& lhs, OP op );
+
+template< typename MT, bool SO, typename OP >
+inline void smpFirstTouch( DenseMatrix<MT,SO>& lhs, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function implements the default SMP first-touch initialization of a dense vector. The
+// initialization operation is called once for the complete range \f$ [0..N) \f$ of the vector
+// via \c op(0,N).\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated vectors. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseVector<VT,TF>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   op( 0UL, (~lhs).size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function implements the default SMP first-touch initialization of a dense matrix. The
+// initialization operation is called once for the complete \f$ M \times N \f$ matrix via
+// \c op(0,0,M,N).\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated matrices. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseMatrix<MT,SO>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   op( 0UL, 0UL, (~lhs).rows(), (~lhs).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,6 +42,7 @@
 
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/SpGEMM.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -70,6 +71,9 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsSparseMatrix<MT1> >
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO, typename MT2, typename MT3 >
+inline void smpSpgemm( SparseMatrix<MT1,SO>& lhs, const MT2& A, const MT3& B );
 //@}
 //*************************************************************************************************
 
@@ -166,6 +170,38 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP multiplication of two sparse matrices.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// This function implements the default SMP multiplication of two sparse matrices with the same
+// storage order as the target sparse matrix (\f$ C=A*B \f$).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO       // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline void smpSpgemm( SparseMatrix<MT1,SO>& lhs, const MT2& A, const MT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == B.columns(), "Invalid number of columns" );
+
+   spgemm( ~lhs, A, B );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/BatchMatrix.h
+//  \brief Header file for the OpenMP-based batch matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_BATCHMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_BATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BatchMatrix SMP functions */
+//@{
+template< typename Type, size_t M, size_t N, typename OP >
+inline void smpBatch( const BatchMatrix<Type,M,N>& batch, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP execution of an operation on a batch of matrices.
+// \ingroup smp
+//
+// \param batch The batch of matrices the operation is applied to.
+// \param op The batch operation to be executed.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP execution of an operation
+// on a batch of matrices. The batch is split into one partition per thread. The size of the
+// partitions is rounded to the SIMD size of the element type, such that every partition starts
+// at a SIMD boundary of the structure-of-arrays storage.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the batch
+        , size_t M       // Number of rows of the matrices
+        , size_t N       // Number of columns of the matrices
+        , typename OP >  // Type of the batch operation
+void smpBatch_backend( const BatchMatrix<Type,M,N>& batch, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( batch.size() > 0UL, "Invalid batch size" );
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( batch.size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( batch.size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t partitions   ( ( batch.size() - 1UL ) / sizePerThread + 1UL );
+
+#pragma omp parallel for schedule(dynamic,1) shared( batch, op )
+   for( int i=0; i<static_cast<int>( partitions ); ++i )
+   {
+      const size_t begin( i*sizePerThread );
+      const size_t end( min( begin+sizePerThread, batch.size() ) );
+
+      op( begin, end );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP execution of an operation on a batch of matrices.
+// \ingroup smp
+//
+// \param batch The batch of matrices the operation is applied to.
+// \param op The batch operation to be executed.
+// \return void
+//
+// This function executes the given operation on the given batch of matrices. The operation is
+// called for disjoint, SIMD aligned ranges \f$ [begin..end) \f$ of the batch, which together
+// cover the complete batch. In case the total number of elements of the batch is below the
+// blaze::SMP_BATCH_THRESHOLD, the operation is called once for the complete batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the batch
+        , size_t M       // Number of rows of the matrices
+        , size_t N       // Number of columns of the matrices
+        , typename OP >  // Type of the batch operation
+inline void smpBatch( const BatchMatrix<Type,M,N>& batch, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || batch.size() == 0UL || batch.size()*M*N < SMP_BATCH_THRESHOLD ) {
+      op( 0UL, batch.size() );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpBatch_backend( batch, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
@@ -55,7 +56,9 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -116,7 +119,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -180,7 +183,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -332,7 +335,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -396,7 +399,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -548,7 +551,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -612,7 +615,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -765,7 +768,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -830,7 +833,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -982,7 +985,7 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for BLAZE_OPENMP_SCHEDULE nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -1100,6 +1103,164 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// vector. The vector is split into one partition per thread, each partition is reduced by
+// the single-threaded (vectorized) reduction kernel, and the partial results are combined
+// afterwards. The size of the partitions is rounded to the SIMD size of the element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size" );
+
+   typedef ElementType_<VT>  ET;
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const bool vecAligned( (~dv).isAligned() );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t partitions   ( ( (~dv).size() - 1UL ) / sizePerThread + 1UL );
+
+   std::unique_ptr<ET[]> partial( new ET[partitions] );
+
+#pragma omp parallel for BLAZE_OPENMP_SCHEDULE shared( dv, op, partial )
+   for( int i=0; i<static_cast<int>( partitions ); ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+      if( simdEnabled && vecAligned ) {
+         partial[i] = dvecreduce( subvector<aligned>( ~dv, index, size ), op );
+      }
+      else {
+         partial[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+      }
+   }
+
+   ET redux( partial[0UL] );
+   for( size_t i=1UL; i<partitions; ++i ) {
+      redux = op( redux, partial[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense vector. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the OpenMP-based SMP reduction of a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is SMP-assignable. In case the size of the vector is below
+// the blaze::SMP_DVECREDUCE_THRESHOLD, the reduction is computed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || (~dv).size() == 0UL || (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
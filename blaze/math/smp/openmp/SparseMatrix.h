@@ -0,0 +1,656 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseMatrix.h
+//  \brief Header file for the OpenMP-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <omp.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/openmp/DenseMatrix.h>
+#include <blaze/math/sparse/SpAssign.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a dense
+// matrix or a sparse matrix with the same storage order, which are not computations, to a sparse
+// matrix. The lines of the target matrix (i.e. the rows of a row-major and the columns of a
+// column-major matrix) are partitioned among the available threads and the assignment is
+// performed in two passes: In the first (symbolic) pass the number of non-zero elements of each
+// partition is determined in parallel. Based on this information the capacity of each partition
+// is reserved in the target matrix. In the second (numeric) pass each thread evaluates its
+// partition of the right-hand side matrix directly into the according lines of the target
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+EnableIf_< IsSpassignPartitionable<MT1,MT2> >
+   smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t lines( SO1 ? (~lhs).columns() : (~lhs).rows() );
+
+   const int threads( omp_get_max_threads() );
+
+   const size_t addon         ( ( ( lines % threads ) != 0UL )? 1UL : 0UL );
+   const size_t linesPerThread( lines / threads + addon );
+
+   std::vector<size_t> nonzeros( threads, 0UL );
+
+#pragma omp parallel shared( lhs, rhs, nonzeros )
+   {
+      // First pass: Determining the number of non-zero elements of each partition
+#pragma omp for schedule(dynamic,1)
+      for( int i=0; i<threads; ++i )
+      {
+         const size_t begin( i*linesPerThread );
+
+         if( begin >= lines )
+            continue;
+
+         const size_t end( min( begin + linesPerThread, lines ) );
+
+         nonzeros[i] = spassignSymbolic( ~lhs, ~rhs, begin, end );
+      }
+
+      // Reserving the capacity of each partition in the target matrix
+#pragma omp single
+      {
+         size_t used( 0UL );
+         size_t total( 0UL );
+
+         (~lhs).reset();
+
+         for( size_t i=0UL; i<lines; ++i )
+            used += (~lhs).capacity( i );
+
+         for( int i=0; i<threads; ++i )
+            total += nonzeros[i];
+
+         (~lhs).reserve( used + total );
+
+         for( int i=0; i<threads; ++i ) {
+            if( i*linesPerThread < lines )
+               (~lhs).reserve( i*linesPerThread, nonzeros[i] );
+         }
+      }
+
+      // Second pass: Evaluating the partitions into the target matrix
+#pragma omp for schedule(dynamic,1)
+      for( int i=0; i<threads; ++i )
+      {
+         const size_t begin( i*linesPerThread );
+
+         if( begin >= lines )
+            continue;
+
+         const size_t end( min( begin + linesPerThread, lines ) );
+
+         spassignNumeric( ~lhs, ~rhs, begin, end, false );
+      }
+   }
+
+   if( lines > 0UL )
+      (~lhs).finalize( lines-1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a dense matrix computation to a sparse
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side dense matrix computation to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a dense
+// matrix computation to a sparse matrix. In order to evaluate each element of the computation
+// only once and by means of the optimized kernels of the computation, the computation is first
+// evaluated in parallel into a dense temporary matrix with the storage order of the target
+// matrix. Afterwards the temporary matrix is assigned to the target matrix by the partitioned
+// assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+EnableIf_< IsComputation<MT2> >
+   smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef RemoveAdaptor_< IfTrue_< SO1 == SO2, ResultType_<MT2>, OppositeType_<MT2> > >  TmpType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+   BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT1, TmpType );
+
+   TmpType tmp;
+   resize( tmp, (~rhs).rows(), (~rhs).columns(), false );
+
+#pragma omp parallel shared( tmp, rhs )
+   smpAssign_backend( tmp, ~rhs );
+
+   smpAssign_backend( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a non-partitionable sparse matrix to a
+//        sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
+// matrix with opposite storage order or of a sparse matrix computation to a sparse matrix. In the
+// first case the elements of a single line of the target matrix are spread over all lines of the
+// right-hand side matrix, in the second case the non-zero elements of a line can only be
+// determined by evaluating the computation. Since in both cases the lines of the target matrix
+// cannot be filled independently of each other, the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+DisableIf_< IsSpassignPartitionable<MT1,MT2> >
+   smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case either of the two operands is not SMP-assignable or the
+// target matrix is not resizable (as for instance views and adaptors).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsResizable<MT1> >
+                         , Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable, the target matrix is resizable, and
+// the element types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsResizable<MT1>
+                     , IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the OpenMP-based SMP addition assignment to a sparse
+// matrix. Since the addition assignment to a sparse matrix in general changes the sparsity
+// pattern of the entire target matrix, the operation is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment to a sparse
+// matrix. Since the subtraction assignment to a sparse matrix in general changes the sparsity
+// pattern of the entire target matrix, the operation is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP multiplication of two sparse matrices.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP multiplication of
+// two sparse matrices with the same storage order as the target matrix. The lines of the target
+// matrix are partitioned into contiguous blocks with approximately the same number of scalar
+// products and the multiplication is performed in two passes: In the first (symbolic) pass the
+// exact number of non-zero elements of each block is determined in parallel. Based on this
+// information the capacity of each block is reserved in the target matrix. In the second
+// (numeric) pass each block of the target matrix is computed and filled in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO         // Storage order of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+void smpSpgemm_backend( SparseMatrix<MT1,SO>& lhs, const MT2& A, const MT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t lines( SO ? (~lhs).columns() : (~lhs).rows() );
+
+   const int blocks( omp_get_max_threads() );
+   const std::vector<size_t> bounds( spgemmPartition( ~lhs, A, B, blocks ) );
+
+   std::vector<size_t> nonzeros( blocks, 0UL );
+
+#pragma omp parallel shared( lhs, A, B, bounds, nonzeros )
+   {
+      // First pass: Determining the number of non-zero elements of each block
+#pragma omp for schedule(dynamic,1)
+      for( int i=0; i<blocks; ++i )
+      {
+         if( bounds[i] == bounds[i+1] )
+            continue;
+
+         nonzeros[i] = spgemmSymbolic( ~lhs, A, B, bounds[i], bounds[i+1] );
+      }
+
+      // Reserving the capacity of each block in the target matrix
+#pragma omp single
+      {
+         size_t used( 0UL );
+         size_t total( 0UL );
+
+         (~lhs).reset();
+
+         for( size_t i=0UL; i<lines; ++i )
+            used += (~lhs).capacity( i );
+
+         for( int i=0; i<blocks; ++i )
+            total += nonzeros[i];
+
+         (~lhs).reserve( used + total );
+
+         for( int i=0; i<blocks; ++i ) {
+            if( bounds[i] < bounds[i+1] )
+               (~lhs).reserve( bounds[i], nonzeros[i] );
+         }
+      }
+
+      // Second pass: Computing the blocks of the target matrix
+#pragma omp for schedule(dynamic,1)
+      for( int i=0; i<blocks; ++i )
+      {
+         if( bounds[i] == bounds[i+1] )
+            continue;
+
+         spgemmNumeric( ~lhs, A, B, bounds[i], bounds[i+1], false );
+      }
+   }
+
+   if( lines > 0UL )
+      (~lhs).finalize( lines-1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP multiplication of two sparse matrices.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// This function implements the default OpenMP-based SMP multiplication of two sparse
+// matrices. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the target matrix is either not SMP-assignable or not
+// resizable (as for instance views and adaptors).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO         // Storage order of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline EnableIf_< Or< Not< IsResizable<MT1> >, Not< IsSMPAssignable<MT1> > > >
+   smpSpgemm( SparseMatrix<MT1,SO>& lhs, const MT2& A, const MT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == B.columns(), "Invalid number of columns" );
+
+   spgemm( ~lhs, A, B );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP multiplication of two sparse matrices.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// This function implements the OpenMP-based SMP multiplication of two sparse matrices
+// with the same storage order as the target matrix (\f$ C=A*B \f$). Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the target matrix is SMP-assignable and resizable. The multiplication is performed in
+// parallel in case the size of the target matrix exceeds the according SMP threshold.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO         // Storage order of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline EnableIf_< And< IsResizable<MT1>, IsSMPAssignable<MT1> > >
+   smpSpgemm( SparseMatrix<MT1,SO>& lhs, const MT2& A, const MT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == B.columns(), "Invalid number of columns" );
+
+   const size_t threshold( SO ? SMP_TSMATTSMATMULT_THRESHOLD : SMP_SMATSMATMULT_THRESHOLD );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() * (~lhs).columns() < threshold ) {
+         spgemm( ~lhs, A, B );
+      }
+      else {
+         smpSpgemm_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
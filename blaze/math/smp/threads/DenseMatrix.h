@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -52,12 +54,16 @@
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -112,7 +118,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& r
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
@@ -195,7 +201,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>&
 
    typedef SubmatrixExprTrait_<MT1,unaligned>  UnalignedTarget;
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
@@ -362,7 +368,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
@@ -445,7 +451,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
 
    typedef SubmatrixExprTrait_<MT1,unaligned>  UnalignedTarget;
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
@@ -613,7 +619,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
@@ -696,7 +702,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
 
    typedef SubmatrixExprTrait_<MT1,unaligned>  UnalignedTarget;
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
@@ -864,6 +870,332 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of a
+// dense matrix. The rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix) of the matrix are split into one partition per thread, each partition is reduced by the
+// single-threaded (vectorized) reduction kernel, and the partial results are combined afterwards.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the reduce()
+// function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL && (~dm).columns() > 0UL, "Invalid matrix size" );
+
+   typedef ElementType_<MT>  ET;
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+
+   const bool matAligned( (~dm).isAligned() );
+
+   const size_t threads( TheThreadBackend::tasks() );
+   const size_t lines  ( SO ? (~dm).columns() : (~dm).rows() );
+   const size_t addon  ( ( ( lines % threads ) != 0UL )? 1UL : 0UL );
+   const size_t linesPerThread( lines / threads + addon );
+   const size_t partitions( ( lines - 1UL ) / linesPerThread + 1UL );
+
+   std::unique_ptr<ET[]> partial( new ET[partitions] );
+
+   for( size_t i=0UL; i<partitions; ++i )
+   {
+      const size_t index( i*linesPerThread );
+      const size_t size( min( linesPerThread, lines - index ) );
+
+      const size_t row   ( SO ? 0UL : index );
+      const size_t column( SO ? index : 0UL );
+      const size_t m     ( SO ? (~dm).rows() : size );
+      const size_t n     ( SO ? size : (~dm).columns() );
+
+      if( simdEnabled && matAligned ) {
+         TheThreadBackend::schedule( [&dm,&partial,op,i,row,column,m,n]() {
+            partial[i] = dmatreduce( submatrix<aligned>( ~dm, row, column, m, n ), op );
+         } );
+      }
+      else {
+         TheThreadBackend::schedule( [&dm,&partial,op,i,row,column,m,n]() {
+            partial[i] = dmatreduce( submatrix<unaligned>( ~dm, row, column, m, n ), op );
+         } );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partial[0UL] );
+   for( size_t i=1UL; i<partitions; ++i ) {
+      redux = op( redux, partial[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP row-wise or column-wise reduction of a dense
+//        matrix.
+// \ingroup smp
+//
+// \param y The target dense vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP row-wise (in case
+// \a y is a column vector) or column-wise (in case \a y is a row vector) reduction of a dense
+// matrix. The rows or columns of the matrix are split into one partition per thread and each
+// partition is reduced into the corresponding subvector of \a y by the single-threaded
+// (vectorized) reduction kernel. The size of the partitions is rounded to the SIMD size of the
+// element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+void smpReduce_backend( DenseVector<VT,TF>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( (~y).size() > 0UL, "Invalid vector size" );
+
+   typedef ElementType_<MT>                    ET;
+   typedef SubvectorExprTrait_<VT,unaligned>  UnalignedTarget;
+
+   constexpr bool simdEnabled( VT::simdEnabled && MT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t threads( TheThreadBackend::tasks() );
+   const size_t addon     ( ( ( (~y).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( (~y).size() / threads + addon );
+   const size_t rest      ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t partitions( ( (~y).size() - 1UL ) / sizePerThread + 1UL );
+
+   for( size_t i=0UL; i<partitions; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size( min( sizePerThread, (~y).size() - index ) );
+
+      const size_t row   ( TF ? 0UL : index );
+      const size_t column( TF ? index : 0UL );
+      const size_t m     ( TF ? (~dm).rows() : size );
+      const size_t n     ( TF ? size : (~dm).columns() );
+
+      TheThreadBackend::schedule( [&y,&dm,op,index,size,row,column,m,n]() {
+         UnalignedTarget target( subvector<unaligned>( ~y, index, size ) );
+         dmatreduce( target, submatrix<unaligned>( ~dm, row, column, m, n ), op );
+      } );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is SMP-assignable. In case the number of elements of the
+// matrix is below the blaze::SMP_DMATREDUCE_THRESHOLD, the reduction is computed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   if( isSerialSectionActive() || (~dm).rows() == 0UL || (~dm).columns() == 0UL ||
+       (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   CompositeType_<MT> tmp( ~dm );  // Evaluation of the dense matrix operand
+
+   ElementType_<MT> redux;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP row-wise or column-wise
+//        reduction of a dense matrix.
+// \ingroup smp
+//
+// \param y The target dense vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP row-wise or column-wise
+// reduction of a dense matrix. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case either the target vector or the dense
+// matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< And< IsSMPAssignable<VT>, IsSMPAssignable<MT> > >
+   smpReduce( DenseVector<VT,TF>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == ( TF ? (~dm).columns() : (~dm).rows() ), "Invalid vector size" );
+
+   dmatreduce( ~y, ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP row-wise or column-wise
+//        reduction of a dense matrix.
+// \ingroup smp
+//
+// \param y The target dense vector for the reduction results.
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP row-wise (in case \a y is a column
+// vector) or column-wise (in case \a y is a row vector) reduction of a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both the target vector and the dense matrix are SMP-assignable. In case the number of
+// elements of the matrix is below the blaze::SMP_DMATREDUCE_THRESHOLD, the reduction is computed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< And< IsSMPAssignable<VT>, IsSMPAssignable<MT> > >
+   smpReduce( DenseVector<VT,TF>& y, const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == ( TF ? (~dm).columns() : (~dm).rows() ), "Invalid vector size" );
+
+   if( isSerialSectionActive() || (~dm).rows() == 0UL || (~dm).columns() == 0UL ||
+       (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+      dmatreduce( ~y, ~dm, op );
+      return;
+   }
+
+   CompositeType_<MT> tmp( ~dm );  // Evaluation of the dense matrix operand
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpReduce_backend( ~y, tmp, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -55,7 +56,9 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -110,7 +113,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -178,7 +181,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
    typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
@@ -329,7 +332,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -397,7 +400,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
@@ -549,7 +552,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -617,7 +620,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
@@ -770,7 +773,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -838,7 +841,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
    typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
@@ -991,7 +994,7 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -1116,6 +1119,169 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of a
+// dense vector. The vector is split into one partition per thread, each partition is reduced by the
+// single-threaded (vectorized) reduction kernel, and the partial results are combined afterwards.
+// The size of the partitions is rounded to the SIMD size of the element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size" );
+
+   typedef ElementType_<VT>  ET;
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const bool vecAligned( (~dv).isAligned() );
+
+   const size_t threads      ( TheThreadBackend::tasks() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t partitions   ( ( (~dv).size() - 1UL ) / sizePerThread + 1UL );
+
+   std::unique_ptr<ET[]> partial( new ET[partitions] );
+
+   for( size_t i=0UL; i<partitions; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+      if( simdEnabled && vecAligned ) {
+         TheThreadBackend::schedule( [&dv,&partial,op,i,index,size]() {
+            partial[i] = dvecreduce( subvector<aligned>( ~dv, index, size ), op );
+         } );
+      }
+      else {
+         TheThreadBackend::schedule( [&dv,&partial,op,i,index,size]() {
+            partial[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+         } );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partial[0UL] );
+   for( size_t i=1UL; i<partitions; ++i ) {
+      redux = op( redux, partial[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is SMP-assignable. In case the size of the vector is below
+// the blaze::SMP_DVECREDUCE_THRESHOLD, the reduction is computed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || (~dv).size() == 0UL || (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
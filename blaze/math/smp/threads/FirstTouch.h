@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/FirstTouch.h
+//  \brief Header file for the C++11/Boost thread-based first-touch SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name First-touch initialization SMP functions */
+//@{
+template< typename VT, bool TF, typename OP >
+inline void smpFirstTouch( DenseVector<VT,TF>& lhs, OP op );
+
+template< typename MT, bool SO, typename OP >
+inline void smpFirstTouch( DenseMatrix<MT,SO>& lhs, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP first-touch
+// initialization of a dense vector. The vector is partitioned exactly as in the SMP assignment
+// of a dense vector and the initialization operation is called once per partition.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated vectors. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseVector<VT,TF>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT> >::size );
+
+   const size_t threads      ( TheThreadBackend::tasks() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      TheThreadBackend::schedule( [op,index,size]() { op( index, size ); } );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP first-touch
+// initialization of a dense matrix. The matrix is partitioned exactly as in the SMP assignment
+// of a dense matrix and the initialization operation is called once per block.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated matrices. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseMatrix<MT,SO>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT> >::size );
+
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<threads.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~lhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+         TheThreadBackend::schedule( [op,row,column,m,n]() { op( row, column, m, n ); } );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP first-touch initialization of a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of a newly allocated dense vector. The initialization
+// operation is called as \c op(index,size) for disjoint ranges of elements, which together cover
+// the complete vector. In NUMA mode (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the ranges
+// are initialized in parallel by the same threads that execute the according partitions of the
+// SMP assignment, which places the memory pages on the NUMA nodes of these threads. Otherwise,
+// in case of an active serial section, in case the function is called from within a parallel
+// section or in case the vector is too small for an SMP assignment, the operation is called once
+// for the complete vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated vectors. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseVector<VT,TF>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !BLAZE_NUMA_FIRST_TOUCH_MODE || isSerialSectionActive() || isParallelSectionActive() ||
+       !(~lhs).canSMPAssign() ) {
+      op( 0UL, (~lhs).size() );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFirstTouch_backend( ~lhs, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP first-touch initialization of a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of a newly allocated dense matrix. The initialization
+// operation is called as \c op(row,column,m,n) for disjoint \f$ m \times n \f$ blocks, which
+// together cover the complete matrix. In NUMA mode (see the \c BLAZE_USE_NUMA_FIRST_TOUCH
+// switch), the blocks are initialized in parallel by the same threads that execute the according
+// blocks of the SMP assignment, which places the memory pages on the NUMA nodes of these threads.
+// Otherwise, in case of an active serial section, in case the function is called from within a
+// parallel section or in case the matrix is too small for an SMP assignment, the operation is
+// called once for the complete matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of newly allocated matrices. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseMatrix<MT,SO>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !BLAZE_NUMA_FIRST_TOUCH_MODE || isSerialSectionActive() || isParallelSectionActive() ||
+       !(~lhs).canSMPAssign() ) {
+      op( 0UL, 0UL, (~lhs).rows(), (~lhs).columns() );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFirstTouch_backend( ~lhs, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,176 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Solvers.h
+//  \brief Header file for the C++11/Boost thread-based SMP implementation of the fused solver kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SOLVERS_H_
+#define _BLAZE_MATH_SMP_THREADS_SOLVERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused solver kernel SMP functions */
+//@{
+template< typename RT, typename OP >
+inline RT smpFusedKernel( size_t size, size_t work, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP execution of a fused solver kernel.
+// \ingroup smp
+//
+// \param size The size of the index range processed by the kernel.
+// \param op The kernel to be executed.
+// \return The result of the kernel.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP execution of
+// a fused solver kernel. The index range is split into one partition per thread. The size of
+// the partitions is a multiple of 64, such that every partition starts at a SIMD and cache line
+// boundary of aligned vectors. The partial results of the partitions are summed up in the order
+// of the partitions, which makes the result independent of the scheduling of the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of the iterative solvers. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename RT    // Result type of the kernel
+        , typename OP >  // Type of the kernel
+RT smpFusedKernel_backend( size_t size, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( size > 0UL, "Invalid index range" );
+
+   constexpr size_t GRANULARITY( 64UL );
+
+   const size_t threads      ( TheThreadBackend::tasks() );
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare & ( GRANULARITY - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + GRANULARITY ):( equalShare ) );
+   const size_t partitions   ( ( size - 1UL ) / sizePerThread + 1UL );
+
+   std::unique_ptr<RT[]> partial( new RT[partitions] );
+
+   for( size_t i=0UL; i<partitions; ++i )
+   {
+      const size_t begin( i*sizePerThread );
+      const size_t end( min( begin+sizePerThread, size ) );
+
+      TheThreadBackend::schedule( [&partial,op,i,begin,end]() {
+         partial[i] = op( begin, end );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   RT result( partial[0UL] );
+   for( size_t i=1UL; i<partitions; ++i ) {
+      result += partial[i];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP execution of a fused solver kernel.
+// \ingroup smp
+//
+// \param size The size of the index range processed by the kernel.
+// \param work The number of elements processed by the kernel.
+// \param op The kernel to be executed.
+// \return The sum of the results of all partitions.
+//
+// This function executes the given fused solver kernel. The kernel is called for disjoint
+// ranges \f$ [begin..end) \f$, which together cover the index range \f$ [0..size) \f$, and has
+// to return its partial result for the given range. In case the number of processed elements
+// \a work is below the blaze::SMP_SOLVER_THRESHOLD, the kernel is called once for the complete
+// index range.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of the iterative solvers. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename RT    // Result type of the kernel
+        , typename OP >  // Type of the kernel
+inline RT smpFusedKernel( size_t size, size_t work, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || size == 0UL || work < SMP_SOLVER_THRESHOLD ) {
+      return op( 0UL, size );
+   }
+
+   RT result = RT();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpFusedKernel_backend<RT>( size, op );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
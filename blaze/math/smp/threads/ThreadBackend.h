@@ -57,6 +57,8 @@
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/Types.h>
 
 
@@ -90,6 +92,7 @@ class ThreadBackend
    /*!\name Utility functions */
    //@{
    static inline size_t size  ();
+   static inline size_t tasks ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
    //@}
@@ -112,6 +115,9 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleDivAssign( Target& target, const Source& source );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
    //@}
    //**********************************************************************************************
 
@@ -324,7 +330,15 @@ class ThreadBackend
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t               initPool();
+   static inline threadpool::Affinity initAffinity();
+   //@}
+   //**********************************************************************************************
+
+   //**Task group functions************************************************************************
+   /*!\name Task group functions */
+   //@{
+   static inline threadpool::TaskGroup& group();
    //@}
    //**********************************************************************************************
 
@@ -334,7 +348,9 @@ class ThreadBackend
    static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
                                                 /*!< It is initialized with the number of threads
                                                      specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
+                                                     \c BLAZE_NUM_THREADS and pins its threads
+                                                     according to the environment variable
+                                                     \c BLAZE_THREAD_AFFINITY. However, it can be
                                                      explicitly resized to arbitrary numbers of
                                                      threads. */
    //@}
@@ -355,7 +371,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initAffinity() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -386,6 +402,29 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tasks an SMP assignment should be split into.
+//
+// \return The number of tasks per SMP assignment.
+//
+// This function returns the number of tasks an SMP assignment should be split into. In order
+// to enable the thread pool to balance the work load via work stealing, every assignment is
+// split into \a smpTasksPerThread tasks per thread (see the <tt>./blaze/config/SMP.h</tt>
+// configuration file).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::tasks()
+{
+   return threadpool_.size() * smpTasksPerThread;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Changes the total number of threads managed by the thread backend system.
@@ -420,7 +459,10 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks that have been scheduled by the calling thread have been
+// completed. In case the calling thread is one of the threads of the thread backend system, it
+// helps executing scheduled tasks while waiting. Therefore it is possible to nest SMP assignments
+// (e.g. an SMP assignment inside of a task of another SMP assignment) without serialization.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -428,7 +470,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   threadpool_.wait( group() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -461,7 +503,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   threadpool_.schedule( group(), Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -486,7 +528,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( group(), AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -511,7 +553,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( group(), SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -536,7 +578,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( group(), MultAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -561,7 +603,30 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( DivAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( group(), DivAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution.
+//
+// \param func The callable task to be executed.
+// \return void
+//
+// This function schedules an arbitrary task for execution. It is used by those SMP assignments
+// that cannot be expressed in terms of a single (compound) assignment between two operands.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the task to be executed
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   threadpool_.schedule( group(), func );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -608,6 +673,67 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial thread affinity of the thread pool.
+//
+// \return The initial thread affinity.
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// environment variable (see threadpool::parseAffinity() for the supported formats). In case the
+// environment variable is not defined or malformed, the function returns an empty affinity, i.e.
+// the threads of the thread pool are not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::Affinity ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   return threadpool::parseAffinity( std::getenv( "BLAZE_THREAD_AFFINITY" ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK GROUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the task group of the calling thread.
+//
+// \return Reference to the thread-local task group.
+//
+// This function returns the task group for all tasks scheduled by the calling thread. Since
+// every thread uses a separate task group, the wait() function only waits for the tasks that
+// have been scheduled by the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::TaskGroup& ThreadBackend<TT,MT,LT,CT>::group()
+{
+   static thread_local threadpool::TaskGroup taskgroup;
+   return taskgroup;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
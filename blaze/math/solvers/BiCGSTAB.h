@@ -0,0 +1,243 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the stabilized biconjugate gradient method
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  STABILIZED BICONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Stabilized biconjugate gradient method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT = IdentityPreconditioner >
+bool bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control, const PT& M = PT() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of a general linear system by means of the (right preconditioned) stabilized
+//        biconjugate gradient method.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess on input, the solution on output.
+// \param b The right-hand side vector.
+// \param control The termination criteria and the result of the solution process.
+// \param M The preconditioner.
+// \return \a true in case the method has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ for a general square matrix
+// \f$ A \f$ by means of the BiCGSTAB method of van der Vorst. The given vector \f$ \vec{x} \f$
+// is used as initial guess. The method terminates as soon as the relative residual drops below
+// the tolerance of the given SolverControl or as soon as the maximum number of iterations has
+// been performed. The number of performed iterations and the final relative residual are
+// recorded in the SolverControl:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+   blaze::ILU0Preconditioner<double> M( A );
+
+   const bool converged = blaze::bicgstab( A, x, b, control, M );
+   \endcode
+
+// Both matrix/vector multiplications of an iteration are fused with the dot products that
+// depend on their result (see the multDot() and multDotNorm() functions). The final update of
+// the solution and the residual is fused with the computation of the residual norm and of the
+// dot product \f$ \hat{\vec{r}}^H\vec{r} \f$ of the next iteration. All kernels are executed in
+// parallel in case the size of the system exceeds the blaze::SMP_SOLVER_THRESHOLD. The method
+// terminates without convergence in case of a breakdown (i.e. \f$ \hat{\vec{r}}^H\vec{r}=0 \f$
+// or \f$ \vec{t}^H\vec{t}=0 \f$).
+//
+// In case the given matrix is not a square matrix or the sizes of the given vectors don't match
+// the size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , typename PT > // Type of the preconditioner
+bool bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control, const PT& M )
+{
+   typedef ElementType_<VT1>        ET;  // Element type of the solution vector
+   typedef UnderlyingBuiltin_<ET>   RT;  // Underlying builtin type of the solution vector
+   typedef DynamicVector<ET,false>  VT;  // Type of the work vectors
+   typedef StaticVector<ET,2UL>     PR;  // Type of the pairs of fused dot products
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~x).size() != (~A).rows() || (~b).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   const RT bnorm( sqrt( real( ctrans( ~b ) * (~b) ) ) );
+
+   if( bnorm == RT( 0 ) ) {
+      reset( ~x );
+      control.report( 0UL, 0.0, true );
+      return true;
+   }
+
+   VT r( (~b) - Ac * (~x) );
+   VT rhat( r );
+   VT p( r );
+   VT v( n ), s( n ), t( n );
+   VT phat( preconditionerSize<PT>( n ) );
+   VT shat( preconditionerSize<PT>( n ) );
+
+   RT residual( sqrt( real( ctrans( r ) * r ) ) / bnorm );
+   ET rho( ctrans( rhat ) * r );
+
+   if( residual <= control.tolerance() ) {
+      control.report( 0UL, residual, true );
+      return true;
+   }
+
+   for( size_t iteration=1UL; iteration<=control.maxIterations(); ++iteration )
+   {
+      if( rho == ET( 0 ) ) {
+         control.report( iteration-1UL, residual, false );
+         return false;
+      }
+
+      // Preconditioning and fused v=A*phat, rhat^H*v
+      const VT& pp( precondition( M, phat, p ) );
+      const ET alpha( rho / multDot( v, Ac, pp, rhat ) );
+
+      // Fused s=r-alpha*v, s^H*s
+      const RT ss = fusedKernel<RT>( n, [&r,&s,&v,alpha]( size_t i, size_t m )
+      {
+         auto ssub( subvector( s, i, m ) );
+         ssub = serial( subvector( r, i, m ) - alpha * subvector( v, i, m ) );
+         return real( serial( ctrans( ssub ) * ssub ) );
+      } );
+
+      if( sqrt( ss ) / bnorm <= control.tolerance() ) {
+         (~x) += alpha * pp;
+         control.report( iteration, sqrt( ss ) / bnorm, true );
+         return true;
+      }
+
+      // Preconditioning and fused t=A*shat, s^H*t, t^H*t
+      const VT& sp( precondition( M, shat, s ) );
+      const PR st( multDotNorm( t, Ac, sp, s ) );
+
+      if( st[1] == ET( 0 ) ) {
+         control.report( iteration, residual, false );
+         return false;
+      }
+
+      const ET omega( conj( st[0] ) / st[1] );
+
+      // Fused x+=alpha*phat+omega*shat, r=s-omega*t, r^H*r, rhat^H*r
+      const PR rr = fusedKernel<PR>( n, [&,alpha,omega]( size_t i, size_t m )
+      {
+         auto rsub( subvector( r, i, m ) );
+         subvector( ~x, i, m ) += serial( alpha * subvector( pp, i, m ) +
+                                          omega * subvector( sp, i, m ) );
+         rsub = serial( subvector( s, i, m ) - omega * subvector( t, i, m ) );
+         return PR{ serial( ctrans( rsub ) * rsub ),
+                    serial( ctrans( subvector( rhat, i, m ) ) * rsub ) };
+      } );
+
+      residual = sqrt( real( rr[0] ) ) / bnorm;
+
+      if( residual <= control.tolerance() ) {
+         control.report( iteration, residual, true );
+         return true;
+      }
+
+      if( omega == ET( 0 ) ) {
+         control.report( iteration, residual, false );
+         return false;
+      }
+
+      // Update of the search direction p=r+beta*(p-omega*v)
+      const ET beta( ( rr[1] / rho ) * ( alpha / omega ) );
+      p = r + beta * ( p - omega * v );
+      rho = rr[1];
+   }
+
+   control.report( control.maxIterations(), residual, false );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
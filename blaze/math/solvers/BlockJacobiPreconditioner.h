@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BlockJacobiPreconditioner.h
+//  \brief Header file for the block Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The block Jacobi preconditioner.
+// \ingroup preconditioners
+//
+// The BlockJacobiPreconditioner class template represents the preconditioner that consists of
+// the square diagonal blocks of the system matrix. On construction the given matrix is split
+// into diagonal blocks of the given block size (the last block might be smaller) and the
+// inverse of every block is computed by means of a Gauss-Jordan elimination with partial
+// pivoting. The preconditioning step \f$ \vec{z}=M^{-1}\vec{r} \f$ therefore consists of
+// independent small dense matrix/vector multiplications, which are distributed among all
+// available threads:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control;
+   blaze::BlockJacobiPreconditioner<double> M( A, 8UL );  // Diagonal blocks of size 8x8
+
+   blaze::bicgstab( A, x, b, control, M );
+   \endcode
+
+// The template argument \a Type specifies the element type of the stored inverse blocks.
+*/
+template< typename Type >  // Data type of the preconditioner
+class BlockJacobiPreconditioner
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<Type,rowMajor>  BlockType;  //!< Type of the inverted diagonal blocks.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockJacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline BlockJacobiPreconditioner( const Matrix<MT,SO>& A, size_t blockSize );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size     () const noexcept;
+   inline size_t blockSize() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void invert( BlockType& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                   //!< The number of rows/columns of the preconditioned system.
+   size_t blockSize_;              //!< The size of the diagonal blocks.
+   std::vector<BlockType> blocks_;  //!< The inverted diagonal blocks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the BlockJacobiPreconditioner class template.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline BlockJacobiPreconditioner<Type>::BlockJacobiPreconditioner()
+   : size_     ( 0UL )  // The number of rows/columns of the preconditioned system
+   , blockSize_( 1UL )  // The size of the diagonal blocks
+   , blocks_   ()       // The inverted diagonal blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the block Jacobi preconditioner for the given matrix.
+//
+// \param A The square system matrix.
+// \param blockSize The size of the diagonal blocks.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid block size.
+// \exception std::runtime_error Inversion of singular block failed.
+//
+// In case the given matrix is not square or the block size is zero, a \a std::invalid_argument
+// exception is thrown. In case any of the diagonal blocks is singular, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline BlockJacobiPreconditioner<Type>::BlockJacobiPreconditioner( const Matrix<MT,SO>& A,
+                                                                  size_t blockSize )
+   : size_     ( (~A).rows() )  // The number of rows/columns of the preconditioned system
+   , blockSize_( blockSize   )  // The size of the diagonal blocks
+   , blocks_   ()               // The inverted diagonal blocks
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( blockSize == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid block size" );
+   }
+
+   blocks_.reserve( ( size_ + blockSize_ - 1UL ) / blockSize_ );
+
+   for( size_t i=0UL; i<size_; i+=blockSize_ )
+   {
+      const size_t m( min( blockSize_, size_-i ) );
+
+      BlockType B( submatrix( ~A, i, i, m, m ) );
+      invert( B );
+      blocks_.push_back( std::move( B ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows/columns of the preconditioned system.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t BlockJacobiPreconditioner<Type>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the diagonal blocks.
+//
+// \return The size of the diagonal blocks.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t BlockJacobiPreconditioner<Type>::blockSize() const noexcept
+{
+   return blockSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a diagonal block.
+//
+// \param B The diagonal block to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular block failed.
+//
+// This function inverts the given block by means of a Gauss-Jordan elimination with partial
+// pivoting. It does not rely on LAPACK. In case the block is singular, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline void BlockJacobiPreconditioner<Type>::invert( BlockType& B )
+{
+   const size_t n( B.rows() );
+
+   BlockType I( n, n, Type( 0 ) );
+   for( size_t i=0UL; i<n; ++i ) {
+      I(i,i) = Type( 1 );
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t pivot( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( B(i,k) ) > abs( B(pivot,k) ) )
+            pivot = i;
+      }
+
+      if( B(pivot,k) == Type( 0 ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular block failed" );
+      }
+
+      if( pivot != k ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            std::swap( B(k,j), B(pivot,j) );
+            std::swap( I(k,j), I(pivot,j) );
+         }
+      }
+
+      const Type scale( Type( 1 ) / B(k,k) );
+      row( B, k ) *= scale;
+      row( I, k ) *= scale;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i == k || B(i,k) == Type( 0 ) ) continue;
+         const Type factor( B(i,k) );
+         row( B, i ) -= factor * row( B, k );
+         row( I, i ) -= factor * row( I, k );
+      }
+   }
+
+   B = std::move( I );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=M^{-1}\vec{r} \f$).
+//
+// \param z The target vector.
+// \param r The residual vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function multiplies every inverted diagonal block with the according part of the given
+// residual vector. The blocks are distributed among all available threads.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the residual vector
+inline void BlockJacobiPreconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                                    const DenseVector<VT2,false>& r ) const
+{
+   if( (~z).size() != size_ || (~r).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t processed = smpFusedKernel<size_t>( blocks_.size(), size_*blockSize_,
+                                                    [this,&z,&r]( size_t begin, size_t end )
+   {
+      for( size_t k=begin; k<end; ++k ) {
+         const size_t i( k*blockSize_ );
+         const size_t m( blocks_[k].rows() );
+         subvector( ~z, i, m ) = serial( blocks_[k] * subvector( ~r, i, m ) );
+      }
+
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == blocks_.size(), "Invalid number of processed blocks" );
+   UNUSED_PARAMETER( processed );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,212 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient method
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT = IdentityPreconditioner >
+bool cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control, const PT& M = PT() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of a Hermitian positive definite linear system by means of the (preconditioned)
+//        conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The Hermitian positive definite system matrix.
+// \param x The initial guess on input, the solution on output.
+// \param b The right-hand side vector.
+// \param control The termination criteria and the result of the solution process.
+// \param M The Hermitian positive definite preconditioner.
+// \return \a true in case the method has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ for a Hermitian (symmetric)
+// positive definite matrix \f$ A \f$ by means of the conjugate gradient method. The given vector
+// \f$ \vec{x} \f$ is used as initial guess. The method terminates as soon as the relative
+// residual drops below the tolerance of the given SolverControl or as soon as the maximum number
+// of iterations has been performed. The number of performed iterations and the final relative
+// residual are recorded in the SolverControl:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+   blaze::JacobiPreconditioner<double> M( A );
+
+   const bool converged = blaze::cg( A, x, b, control, M );
+   \endcode
+
+// Every iteration of the method is composed of the following fused kernels, each of which
+// streams its vectors from memory only once:
+//  - the matrix/vector multiplication \f$ \vec{q}=A\vec{p} \f$ and the dot product
+//    \f$ \vec{p}^H\vec{q} \f$ (see the multDot() function),
+//  - the updates \f$ \vec{x}+=\alpha\vec{p} \f$ and \f$ \vec{r}-=\alpha\vec{q} \f$ and the
+//    norm \f$ \|\vec{r}\|_2 \f$,
+//  - the update of the search direction \f$ \vec{p}=\vec{z}+\beta\vec{p} \f$.
+//
+// In case a preconditioner is given, the preconditioning step \f$ \vec{z}=M^{-1}\vec{r} \f$ and
+// the dot product \f$ \vec{r}^H\vec{z} \f$ are performed in addition. All kernels are executed
+// in parallel in case the size of the system exceeds the blaze::SMP_SOLVER_THRESHOLD.
+//
+// In case the given matrix is not a square matrix or the sizes of the given vectors don't match
+// the size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , typename PT > // Type of the preconditioner
+bool cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control, const PT& M )
+{
+   typedef ElementType_<VT1>        ET;  // Element type of the solution vector
+   typedef UnderlyingBuiltin_<ET>   RT;  // Underlying builtin type of the solution vector
+   typedef DynamicVector<ET,false>  VT;  // Type of the work vectors
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~x).size() != (~A).rows() || (~b).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   const RT bnorm( sqrt( real( ctrans( ~b ) * (~b) ) ) );
+
+   if( bnorm == RT( 0 ) ) {
+      reset( ~x );
+      control.report( 0UL, 0.0, true );
+      return true;
+   }
+
+   VT r( (~b) - Ac * (~x) );
+   VT z( preconditionerSize<PT>( n ) );
+   VT q( n );
+
+   RT rr( real( ctrans( r ) * r ) );
+
+   if( sqrt( rr ) / bnorm <= control.tolerance() ) {
+      control.report( 0UL, sqrt( rr ) / bnorm, true );
+      return true;
+   }
+
+   VT p( precondition( M, z, r ) );
+   ET rz( ctrans( r ) * p );
+
+   for( size_t iteration=1UL; iteration<=control.maxIterations(); ++iteration )
+   {
+      const ET alpha( rz / multDot( q, Ac, p, p ) );
+
+      rr = fusedKernel<RT>( n, [&x,&r,&p,&q,alpha]( size_t i, size_t m )
+      {
+         auto rsub( subvector( r, i, m ) );
+         subvector( ~x, i, m ) += serial( alpha * subvector( p, i, m ) );
+         rsub -= serial( alpha * subvector( q, i, m ) );
+         return real( serial( ctrans( rsub ) * rsub ) );
+      } );
+
+      const RT residual( sqrt( rr ) / bnorm );
+
+      if( residual <= control.tolerance() ) {
+         control.report( iteration, residual, true );
+         return true;
+      }
+
+      if( iteration == control.maxIterations() ) {
+         control.report( iteration, residual, false );
+         return false;
+      }
+
+      const VT& zr( precondition( M, z, r ) );
+      const ET rzNew( ( IsSame<PT,IdentityPreconditioner>::value )?( ET( rr ) )
+                                                                  :( ET( ctrans( r ) * zr ) ) );
+      const ET beta( rzNew / rz );
+
+      p = zr + beta * p;
+      rz = rzNew;
+   }
+
+   control.report( 0UL, sqrt( rr ) / bnorm, false );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
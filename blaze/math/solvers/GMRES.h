@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the generalized minimal residual method
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Generalized minimal residual method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT = IdentityPreconditioner >
+bool gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control, const PT& M = PT() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of a general linear system by means of the (right preconditioned) restarted
+//        generalized minimal residual method.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess on input, the solution on output.
+// \param b The right-hand side vector.
+// \param control The termination criteria and the result of the solution process.
+// \param M The preconditioner.
+// \return \a true in case the method has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ for a general square matrix
+// \f$ A \f$ by means of the GMRES(m) method, where the restart parameter \a m is taken from the
+// given SolverControl. The given vector \f$ \vec{x} \f$ is used as initial guess. The method
+// terminates as soon as the relative residual drops below the tolerance of the SolverControl
+// or as soon as the maximum number of iterations (i.e. of matrix/vector multiplications within
+// the Arnoldi process) has been performed:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control( 1000UL, 1E-10, 40UL );  // Restart after 40 iterations
+   blaze::ILU0Preconditioner<double> M( A );
+
+   const bool converged = blaze::gmres( A, x, b, control, M );
+   \endcode
+
+// The Krylov basis is stored in a column-major dense matrix. Instead of the modified Gram-Schmidt
+// process, which requires one pass over the basis vector per basis vector, the orthogonalization
+// is performed by means of the classical Gram-Schmidt process with reorthogonalization (CGS2):
+// Every orthogonalization step consists of a (vectorized and SMP-parallel) multiplication with
+// the conjugate transpose of the basis and a multiplication with the basis, the last of which is
+// fused with the computation of the norm of the new basis vector. Whereas the Arnoldi process
+// is terminated based on the residual estimate of the GMRES method, the convergence is always
+// confirmed by means of the explicitly computed residual.
+//
+// In case the given matrix is not a square matrix or the sizes of the given vectors don't match
+// the size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , typename PT > // Type of the preconditioner
+bool gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control, const PT& M )
+{
+   typedef ElementType_<VT1>                ET;  // Element type of the solution vector
+   typedef UnderlyingBuiltin_<ET>           RT;  // Underlying builtin type of the solution vector
+   typedef DynamicVector<ET,false>          VT;  // Type of the work vectors
+   typedef DynamicMatrix<ET,columnMajor>    BT;  // Type of the Krylov basis
+   typedef DynamicMatrix<ET,rowMajor>       HT;  // Type of the Hessenberg matrix
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~x).size() != (~A).rows() || (~b).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+   const size_t m( min( control.restart(), n ) );
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   const RT bnorm( sqrt( real( ctrans( ~b ) * (~b) ) ) );
+
+   if( bnorm == RT( 0 ) ) {
+      reset( ~x );
+      control.report( 0UL, 0.0, true );
+      return true;
+   }
+
+   BT V( n, m+1UL );                         // The Krylov basis
+   HT H( m+1UL, m );                         // The Hessenberg matrix
+   VT cs( m ), sn( m ), g( m+1UL ), y( m );  // The Givens rotations and the reduced system
+   VT w( n ), h( m+1UL ), u( n );
+   VT z( preconditionerSize<PT>( n ) );
+
+   size_t iteration( 0UL );
+   RT residual( 0 );
+
+   while( true )
+   {
+      // Computation of the initial residual and the first basis vector
+      auto v0( column( V, 0UL ) );
+      w = (~b) - Ac * (~x);
+
+      const RT beta( sqrt( real( ctrans( w ) * w ) ) );
+      residual = beta / bnorm;
+
+      if( residual <= control.tolerance() ) {
+         control.report( iteration, residual, true );
+         return true;
+      }
+
+      if( iteration >= control.maxIterations() ) {
+         control.report( iteration, residual, false );
+         return false;
+      }
+
+      v0 = w * ( RT( 1 ) / beta );
+      reset( g );
+      g[0UL] = beta;
+
+      // Arnoldi process
+      size_t k( 0UL );
+
+      while( k < m && iteration < control.maxIterations() )
+      {
+         const auto vk( column( V, k ) );
+         w = Ac * precondition( M, z, vk );
+
+         // Classical Gram-Schmidt orthogonalization with reorthogonalization
+         const auto Vk( submatrix( V, 0UL, 0UL, n, k+1UL ) );
+         auto hk( subvector( h, 0UL, k+1UL ) );
+
+         hk = ctrans( Vk ) * w;
+         w -= Vk * hk;
+
+         const VT hc( ctrans( Vk ) * w );
+         hk += hc;
+
+         const RT hnorm = sqrt( fusedKernel<RT>( n, [&w,&Vk,&hc]( size_t i, size_t mi )
+         {
+            auto wsub( subvector( w, i, mi ) );
+            wsub -= serial( submatrix( Vk, i, 0UL, mi, Vk.columns() ) * hc );
+            return real( serial( ctrans( wsub ) * wsub ) );
+         } ) );
+
+         h[k+1UL] = hnorm;
+
+         if( hnorm != RT( 0 ) ) {
+            column( V, k+1UL ) = w * ( RT( 1 ) / hnorm );
+         }
+
+         // Application of the previous Givens rotations to the new column of H
+         for( size_t i=0UL; i<k; ++i ) {
+            const ET tmp( cs[i] * h[i] + sn[i] * h[i+1UL] );
+            h[i+1UL] = -conj( sn[i] ) * h[i] + cs[i] * h[i+1UL];
+            h[i] = tmp;
+         }
+
+         // Computation and application of the new Givens rotation
+         const RT habs( abs( h[k] ) );
+         const RT rnorm( sqrt( habs*habs + hnorm*hnorm ) );
+
+         if( habs == RT( 0 ) ) {
+            cs[k] = ET( 0 );
+            sn[k] = ET( 1 );
+         }
+         else {
+            cs[k] = ET( habs / rnorm );
+            sn[k] = ( h[k] / habs ) * ET( hnorm / rnorm );
+         }
+
+         h[k] = cs[k] * h[k] + sn[k] * h[k+1UL];
+         h[k+1UL] = ET( 0 );
+
+         g[k+1UL] = -conj( sn[k] ) * g[k];
+         g[k] = cs[k] * g[k];
+
+         subvector( column( H, k ), 0UL, k+1UL ) = hk;
+
+         ++k;
+         ++iteration;
+
+         residual = abs( g[k] ) / bnorm;
+
+         if( residual <= control.tolerance() || hnorm == RT( 0 ) )
+            break;
+      }
+
+      // Solution of the triangular system H*y=g and update of the solution
+      for( size_t i=k; i-- > 0UL; ) {
+         ET tmp( g[i] );
+         for( size_t j=i+1UL; j<k; ++j ) {
+            tmp -= H(i,j) * y[j];
+         }
+         y[i] = tmp / H(i,i);
+      }
+
+      u = submatrix( V, 0UL, 0UL, n, k ) * subvector( y, 0UL, k );
+      (~x) += precondition( M, z, u );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the IC(0) preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/adaptors/LowerMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SMatForEachExpr.h>
+#include <blaze/math/expressions/SMatTransExpr.h>
+#include <blaze/math/solvers/IncompleteFactorization.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/Substitution.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The incomplete Cholesky preconditioner without fill-in (IC(0)).
+// \ingroup preconditioners
+//
+// The IC0Preconditioner class template represents the incomplete Cholesky factorization
+// \f$ M=LL^H \f$ of a Hermitian positive definite matrix, where the lower factor \f$ L \f$ has
+// the same sparsity pattern as the lower part of the given matrix (see blaze::ic0()). In
+// contrast to the ILU(0) preconditioner the preconditioner is Hermitian positive definite and
+// can therefore be combined with the CG method. The preconditioning step
+// \f$ \vec{z}=M^{-1}\vec{r} \f$ consists of a forward substitution with \f$ L \f$ and a backward
+// substitution with \f$ L^H \f$, which is stored explicitly as row-major upper matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the symmetric positive definite system
+
+   blaze::SolverControl control;
+   blaze::IC0Preconditioner<double> M( A );
+
+   blaze::cg( A, x, b, control, M );
+   \endcode
+
+// Only the lower part of the given matrix is accessed. All diagonal elements of the matrix are
+// required to be part of the sparsity pattern. The level schedules of both factors (see
+// blaze::LevelSchedule) are computed once during the setup, the rows of every level of the
+// substitutions are distributed among all available threads.
+*/
+template< typename Type >  // Data type of the preconditioner
+class IC0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef LowerMatrix< CompressedMatrix<Type,rowMajor> >  LowerType;  //!< Type of the lower factor.
+   typedef UpperMatrix< CompressedMatrix<Type,rowMajor> >  UpperType;  //!< Type of the conjugate transpose factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline IC0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size () const noexcept;
+   inline const LowerType& lower() const noexcept;
+   inline const UpperType& upper() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   LowerType     L_;              //!< The lower factor.
+   UpperType     U_;              //!< The conjugate transpose of the lower factor.
+   LevelSchedule lowerSchedule_;  //!< The level schedule of the forward substitution.
+   LevelSchedule upperSchedule_;  //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the IC0Preconditioner class template.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline IC0Preconditioner<Type>::IC0Preconditioner()
+   : L_            ()  // The lower factor
+   , U_            ()  // The conjugate transpose of the lower factor
+   , lowerSchedule_()  // The level schedule of the forward substitution
+   , upperSchedule_()  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the IC(0) preconditioner for the given matrix.
+//
+// \param A The Hermitian positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Non-positive pivot in incomplete Cholesky factorization.
+//
+// In case the given matrix is not square or any of its diagonal elements is not part of the
+// sparsity pattern, a \a std::invalid_argument exception is thrown. In case a non-positive
+// pivot is encountered during the factorization, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IC0Preconditioner<Type>::IC0Preconditioner( const Matrix<MT,SO>& A )
+   : L_            ()  // The lower factor
+   , U_            ()  // The conjugate transpose of the lower factor
+   , lowerSchedule_()  // The level schedule of the forward substitution
+   , upperSchedule_()  // The level schedule of the backward substitution
+{
+   ic0( ~A, L_ );
+   U_ = ctrans( L_ );
+
+   lowerSchedule_ = LevelSchedule( L_, 'L' );
+   upperSchedule_ = LevelSchedule( U_, 'U' );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows/columns of the preconditioned system.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t IC0Preconditioner<Type>::size() const noexcept
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower factor of the incomplete Cholesky factorization.
+//
+// \return The lower factor \f$ L \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename IC0Preconditioner<Type>::LowerType&
+   IC0Preconditioner<Type>::lower() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the conjugate transpose of the lower factor.
+//
+// \return The upper factor \f$ L^H \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename IC0Preconditioner<Type>::UpperType&
+   IC0Preconditioner<Type>::upper() const noexcept
+{
+   return U_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=L^{-H}L^{-1}\vec{r} \f$).
+//
+// \param z The target vector.
+// \param r The residual vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs a forward substitution with the lower factor \f$ L \f$ followed by
+// a backward substitution with its conjugate transpose \f$ L^H \f$. Both substitutions are
+// executed level by level. The target vector \f$ \vec{z} \f$ and the residual vector
+// \f$ \vec{r} \f$ are allowed to be the same vector.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the residual vector
+inline void IC0Preconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                            const DenseVector<VT2,false>& r ) const
+{
+   if( (~z).size() != size() || (~r).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   solve( L_, ~z, ~r, lowerSchedule_ );
+   solve( U_, ~z, ~z, upperSchedule_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
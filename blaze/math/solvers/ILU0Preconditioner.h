@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the ILU(0) preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/adaptors/UniLowerMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/IncompleteFactorization.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/Substitution.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The incomplete LU preconditioner without fill-in (ILU(0)).
+// \ingroup preconditioners
+//
+// The ILU0Preconditioner class template represents the incomplete LU factorization \f$ M=LU \f$
+// of a square matrix, where the factors \f$ L \f$ (with unit diagonal) and \f$ U \f$ have the
+// same sparsity pattern as the lower and upper part of the given matrix (see blaze::ilu0()). The
+// factors are stored in row-major compressed matrices, the preconditioning step
+// \f$ \vec{z}=M^{-1}\vec{r} \f$ consists of a forward and a backward substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control;
+   blaze::ILU0Preconditioner<double> M( A );
+
+   blaze::gmres( A, x, b, control, M );
+   \endcode
+
+// Note that the sparsity pattern is taken from the non-zero elements of the given matrix, i.e.
+// in case a dense matrix is given, all zero elements are excluded from the pattern. All diagonal
+// elements of the matrix are required to be part of the pattern. The level schedules of both
+// factors (see blaze::LevelSchedule) are computed once during the setup, the rows of every
+// level of the substitutions are distributed among all available threads.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef UniLowerMatrix< CompressedMatrix<Type,rowMajor> >  LowerType;  //!< Type of the unit lower factor.
+   typedef UpperMatrix< CompressedMatrix<Type,rowMajor> >     UpperType;  //!< Type of the upper factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ILU0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size () const noexcept;
+   inline const LowerType& lower() const noexcept;
+   inline const UpperType& upper() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   LowerType     L_;              //!< The unit lower factor.
+   UpperType     U_;              //!< The upper factor.
+   LevelSchedule lowerSchedule_;  //!< The level schedule of the forward substitution.
+   LevelSchedule upperSchedule_;  //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the ILU0Preconditioner class template.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline ILU0Preconditioner<Type>::ILU0Preconditioner()
+   : L_            ()  // The unit lower factor
+   , U_            ()  // The upper factor
+   , lowerSchedule_()  // The level schedule of the forward substitution
+   , upperSchedule_()  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the ILU(0) preconditioner for the given matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Division by zero.
+//
+// In case the given matrix is not square or any of its diagonal elements is not part of the
+// sparsity pattern, a \a std::invalid_argument exception is thrown. In case a zero pivot is
+// encountered during the factorization, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : L_            ()  // The unit lower factor
+   , U_            ()  // The upper factor
+   , lowerSchedule_()  // The level schedule of the forward substitution
+   , upperSchedule_()  // The level schedule of the backward substitution
+{
+   ilu0( ~A, L_, U_ );
+
+   lowerSchedule_ = LevelSchedule( L_, 'L' );
+   upperSchedule_ = LevelSchedule( U_, 'U' );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows/columns of the preconditioned system.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t ILU0Preconditioner<Type>::size() const noexcept
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the unit lower factor of the incomplete LU factorization.
+//
+// \return The unit lower factor \f$ L \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename ILU0Preconditioner<Type>::LowerType&
+   ILU0Preconditioner<Type>::lower() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper factor of the incomplete LU factorization.
+//
+// \return The upper factor \f$ U \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename ILU0Preconditioner<Type>::UpperType&
+   ILU0Preconditioner<Type>::upper() const noexcept
+{
+   return U_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=U^{-1}L^{-1}\vec{r} \f$).
+//
+// \param z The target vector.
+// \param r The residual vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs a forward substitution with the unit lower factor \f$ L \f$ followed
+// by a backward substitution with the upper factor \f$ U \f$. Both substitutions are executed
+// level by level. The target vector \f$ \vec{z} \f$ and the residual vector \f$ \vec{r} \f$ are
+// allowed to be the same vector.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the residual vector
+inline void ILU0Preconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                             const DenseVector<VT2,false>& r ) const
+{
+   if( (~z).size() != size() || (~r).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   solve( L_, ~z, ~r, lowerSchedule_ );
+   solve( U_, ~z, ~z, upperSchedule_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,199 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IdentityPreconditioner.h
+//  \brief Header file for the IdentityPreconditioner class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The identity preconditioner.
+// \ingroup preconditioners
+//
+// The IdentityPreconditioner class represents the absence of a preconditioner. It is the default
+// preconditioner of all iterative solvers. The solvers detect this preconditioner at compile time
+// and skip the preconditioning step (and the according vector) entirely.
+//
+// All preconditioners of the iterative solvers have to provide the same interface: A member
+// function \a apply() that computes \f$ \vec{z}=M^{-1}\vec{r} \f$ for the given vectors
+// \f$ \vec{z} \f$ and \f$ \vec{r} \f$ of equal size. Therefore any user-defined class with the
+// following member function can be used as preconditioner:
+
+   \code
+   class MyPreconditioner
+   {
+    public:
+      template< typename VT1, typename VT2 >
+      void apply( blaze::DenseVector<VT1,false>& z, const blaze::DenseVector<VT2,false>& r ) const;
+   };
+   \endcode
+*/
+class IdentityPreconditioner
+{
+ public:
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=\vec{r} \f$).
+//
+// \param z The target vector.
+// \param r The residual vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the target vector
+        , typename VT2 >  // Type of the residual vector
+inline void IdentityPreconditioner::apply( DenseVector<VT1,false>& z,
+                                           const DenseVector<VT2,false>& r ) const
+{
+   if( (~z).size() != (~r).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   (~z) = (~r);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Preconditioning step of an iterative solver (\f$ \vec{z}=M^{-1}\vec{r} \f$).
+// \ingroup preconditioners
+//
+// \param M The preconditioner.
+// \param z The target vector.
+// \param r The residual vector.
+// \return Reference to the preconditioned vector \f$ \vec{z} \f$.
+*/
+template< typename PT     // Type of the preconditioner
+        , typename VT1    // Type of the target vector
+        , typename VT2 >  // Type of the residual vector
+inline const VT1& precondition( const PT& M, VT1& z, const VT2& r )
+{
+   M.apply( z, r );
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Preconditioning step of an iterative solver for the identity preconditioner.
+// \ingroup preconditioners
+//
+// \param M The identity preconditioner.
+// \param z The (unused) target vector.
+// \param r The residual vector.
+// \return Reference to the residual vector \f$ \vec{r} \f$.
+//
+// This overload skips the preconditioning step and returns the given residual vector. Therefore
+// the target vector is not accessed and does not have to be allocated.
+*/
+template< typename VT1    // Type of the target vector
+        , typename VT2 >  // Type of the residual vector
+inline const VT2& precondition( const IdentityPreconditioner& M, VT1& z, const VT2& r )
+{
+   UNUSED_PARAMETER( M, z );
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the preconditioning workspace of an iterative solver.
+// \ingroup preconditioners
+//
+// \param n The size of the linear system.
+// \return The required size of the preconditioned vectors.
+//
+// For the identity preconditioner the preconditioned vectors are never accessed. Therefore this
+// function returns 0 for the identity preconditioner and \a n for all other preconditioners.
+*/
+template< typename PT >  // Type of the preconditioner
+constexpr size_t preconditionerSize( size_t n ) noexcept
+{
+   return ( IsSame<PT,IdentityPreconditioner>::value )?( 0UL ):( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
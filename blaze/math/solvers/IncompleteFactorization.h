@@ -0,0 +1,384 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IncompleteFactorization.h
+//  \brief Header file for the incomplete LU and Cholesky factorizations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_INCOMPLETEFACTORIZATION_H_
+#define _BLAZE_MATH_SOLVERS_INCOMPLETEFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/adaptors/Forward.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INCOMPLETE FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Incomplete factorization functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void ilu0( const Matrix<MT1,SO1>& A, UniLowerMatrix<MT2,SO2,false>& L, UpperMatrix<MT3,SO3,false>& U );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void ic0( const Matrix<MT1,SO1>& A, LowerMatrix<MT2,SO2,false>& L );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place ILU(0) factorization of a row-major compressed matrix.
+// \ingroup solvers
+//
+// \param LU The matrix to be factorized; the combined factors \f$ L \f$ and \f$ U \f$ on exit.
+// \return void
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Division by zero.
+//
+// This function computes the incomplete LU factorization in-place by means of the row-wise
+// (IKJ) variant of the Gaussian elimination, discarding all updates outside the sparsity
+// pattern. The positions of the elements of the current row are tracked in a dense work array,
+// such that every update is an O(1) operation. On exit, the strictly lower part of the matrix
+// contains the strictly lower part of the unit lower factor \f$ L \f$, the upper part contains
+// \f$ U \f$.
+*/
+template< typename Type >  // Data type of the factors
+void ilu0_backend( CompressedMatrix<Type,rowMajor>& LU )
+{
+   typedef typename CompressedMatrix<Type,rowMajor>::Iterator  Iterator;
+
+   const size_t n( LU.rows() );
+
+   std::vector<Iterator> position( n, Iterator() );
+   std::vector<Iterator> diagonal( n, Iterator() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator begin( LU.begin(i) );
+      const Iterator diag ( LU.find( i, i ) );
+      const Iterator end  ( LU.end(i) );
+
+      if( diag == end ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element" );
+      }
+
+      for( Iterator element=begin; element!=end; ++element ) {
+         position[element->index()] = element;
+      }
+
+      for( Iterator element=begin; element!=diag; ++element )
+      {
+         const size_t k( element->index() );
+         const Type factor( element->value() / diagonal[k]->value() );
+         element->value() = factor;
+
+         const Iterator last( LU.end(k) );
+         for( Iterator ukj=diagonal[k]+1UL; ukj!=last; ++ukj ) {
+            const Iterator pos( position[ukj->index()] );
+            if( pos != Iterator() )
+               pos->value() -= factor * ukj->value();
+         }
+      }
+
+      if( isDefault( diag->value() ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Zero pivot in incomplete LU factorization" );
+      }
+
+      diagonal[i] = diag;
+
+      for( Iterator element=begin; element!=end; ++element ) {
+         position[element->index()] = Iterator();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place IC(0) factorization of a row-major lower triangular compressed matrix.
+// \ingroup solvers
+//
+// \param L The lower part of the matrix to be factorized; the lower factor \f$ L \f$ on exit.
+// \return void
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Non-positive pivot in incomplete Cholesky factorization.
+//
+// This function computes the incomplete Cholesky factorization in-place by means of the
+// row-wise (up-looking) variant of the Cholesky decomposition, discarding all elements outside
+// the sparsity pattern. Every element \f$ l_{ik} \f$ is computed from the sparse dot product of
+// the rows \a i and \a k, which is evaluated by means of a dense work array of the positions of
+// the elements of row \a i.
+*/
+template< typename Type >  // Data type of the factor
+void ic0_backend( CompressedMatrix<Type,rowMajor>& L )
+{
+   typedef typename CompressedMatrix<Type,rowMajor>::Iterator  Iterator;
+
+   const size_t n( L.rows() );
+
+   std::vector<Iterator> position( n, Iterator() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator begin( L.begin(i) );
+      const Iterator end  ( L.end(i) );
+
+      if( begin == end || (end-1)->index() != i ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element" );
+      }
+
+      const Iterator diag( end-1 );
+
+      for( Iterator element=begin; element!=diag; ++element ) {
+         position[element->index()] = element;
+      }
+
+      Type d( diag->value() );
+
+      for( Iterator element=begin; element!=diag; ++element )
+      {
+         const size_t k( element->index() );
+         const Iterator last( L.end(k)-1 );
+
+         Type tmp( element->value() );
+         for( Iterator lkj=L.begin(k); lkj!=last; ++lkj ) {
+            const Iterator pos( position[lkj->index()] );
+            if( pos != Iterator() )
+               tmp -= pos->value() * conj( lkj->value() );
+         }
+
+         element->value() = tmp / last->value();
+         d -= element->value() * conj( element->value() );
+      }
+
+      if( !( real( d ) > 0 ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Non-positive pivot in incomplete Cholesky factorization" );
+      }
+
+      diag->value() = Type( sqrt( real( d ) ) );
+
+      for( Iterator element=begin; element!=diag; ++element ) {
+         position[element->index()] = Iterator();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Incomplete LU factorization without fill-in (ILU(0)) of the given square matrix.
+// \ingroup solvers
+//
+// \param A The square matrix to be factorized.
+// \param L The resulting unit lower factor.
+// \param U The resulting upper factor.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Division by zero.
+//
+// This function computes the incomplete LU factorization \f$ A \approx LU \f$ of the given
+// square matrix, where the unit lower factor \f$ L \f$ and the upper factor \f$ U \f$ have the
+// same sparsity pattern as the lower and upper part of \a A, respectively. All updates outside
+// of this pattern are discarded:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Initialization of the system matrix
+
+   blaze::UniLowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L;
+   blaze::UpperMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > U;
+
+   ilu0( A, L, U );
+
+   blaze::DynamicVector<double> z, r;
+   solve( L, z, r );  // Forward substitution
+   solve( U, z, z );  // Backward substitution
+   \endcode
+
+// The sparsity pattern is taken from the non-zero elements of the given matrix, i.e. in case a
+// dense matrix is given, all zero elements are excluded from the pattern. In case the matrix is
+// not square or any diagonal element is not part of the pattern, a \a std::invalid_argument
+// exception is thrown. In case a zero pivot is encountered, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename MT1  // Type of the matrix to be factorized
+        , bool SO1      // Storage order of the matrix to be factorized
+        , typename MT2  // Type of the adapted lower factor
+        , bool SO2      // Storage order of the adapted lower factor
+        , typename MT3  // Type of the adapted upper factor
+        , bool SO3 >    // Storage order of the adapted upper factor
+void ilu0( const Matrix<MT1,SO1>& A, UniLowerMatrix<MT2,SO2,false>& L, UpperMatrix<MT3,SO3,false>& U )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT2>, ElementType_<MT3> );
+
+   typedef ElementType_<MT2>                   ET;
+   typedef CompressedMatrix<ET,rowMajor>       FactorType;
+   typedef typename FactorType::ConstIterator  ConstIterator;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   FactorType LU( ~A );
+   ilu0_backend( LU );
+
+   const size_t n( LU.rows() );
+
+   size_t lower( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      lower += LU.lowerBound( i, i ) - LU.begin(i);
+   }
+
+   FactorType tmpL( n, n, lower );
+   FactorType tmpU( n, n, LU.nonZeros() + n - lower );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator end( LU.end(i) );
+      ConstIterator element( LU.begin(i) );
+
+      for( ; element->index()<i; ++element ) {
+         tmpL.append( i, element->index(), element->value() );
+      }
+      tmpL.append( i, i, ET(1) );
+      tmpL.finalize( i );
+
+      for( ; element!=end; ++element ) {
+         tmpU.append( i, element->index(), element->value() );
+      }
+      tmpU.finalize( i );
+   }
+
+   L = tmpL;
+   U = tmpU;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky factorization without fill-in (IC(0)) of the given square matrix.
+// \ingroup solvers
+//
+// \param A The Hermitian positive definite matrix to be factorized.
+// \param L The resulting lower factor.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Non-positive pivot in incomplete Cholesky factorization.
+//
+// This function computes the incomplete Cholesky factorization \f$ A \approx LL^H \f$ of the
+// given Hermitian positive definite matrix, where the lower factor \f$ L \f$ has the same
+// sparsity pattern as the lower part of \a A. All updates outside of this pattern are discarded.
+// Only the lower part of \a A is accessed:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Initialization of the symmetric positive definite system matrix
+
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L;
+
+   ic0( A, L );
+   \endcode
+
+// In case the matrix is not square or any diagonal element is not part of the pattern, a
+// \a std::invalid_argument exception is thrown. In case a non-positive pivot is encountered
+// (which is possible for positive definite matrices that are not M-matrices), a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT1  // Type of the matrix to be factorized
+        , bool SO1      // Storage order of the matrix to be factorized
+        , typename MT2  // Type of the adapted lower factor
+        , bool SO2 >    // Storage order of the adapted lower factor
+void ic0( const Matrix<MT1,SO1>& A, LowerMatrix<MT2,SO2,false>& L )
+{
+   typedef ElementType_<MT2>                   ET;
+   typedef CompressedMatrix<ET,rowMajor>       FactorType;
+   typedef typename FactorType::ConstIterator  ConstIterator;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const FactorType B( ~A );
+   const size_t n( B.rows() );
+
+   size_t lower( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      lower += B.upperBound( i, i ) - B.begin(i);
+   }
+
+   FactorType tmp( n, n, lower );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator end( B.upperBound( i, i ) );
+      for( ConstIterator element=B.begin(i); element!=end; ++element ) {
+         tmp.append( i, element->index(), element->value() );
+      }
+      tmp.finalize( i );
+   }
+
+   ic0_backend( tmp );
+
+   L = tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
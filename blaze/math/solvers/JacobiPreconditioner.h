@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The Jacobi (diagonal) preconditioner.
+// \ingroup preconditioners
+//
+// The JacobiPreconditioner class template represents the preconditioner \f$ M=diag(A) \f$. On
+// construction it stores the inverted diagonal elements of the given square matrix, which turns
+// the preconditioning step \f$ \vec{z}=M^{-1}\vec{r} \f$ into a componentwise multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control;
+   blaze::JacobiPreconditioner<double> M( A );
+
+   blaze::cg( A, x, b, control, M );
+   \endcode
+
+// The template argument \a Type specifies the element type of the stored diagonal elements.
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline JacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type,false> inv_;  //!< The inverted diagonal elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the JacobiPreconditioner class template.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline JacobiPreconditioner<Type>::JacobiPreconditioner()
+   : inv_()  // The inverted diagonal elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the Jacobi preconditioner for the given matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Division by zero.
+//
+// In case the given matrix is not square, a \a std::invalid_argument exception is thrown. In
+// case the matrix has a zero diagonal element, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inv_( (~A).rows() )  // The inverted diagonal elements
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   for( size_t i=0UL; i<inv_.size(); ++i )
+   {
+      const Type diag( (~A)(i,i) );
+
+      if( diag == Type( 0 ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Zero diagonal element in Jacobi preconditioner" );
+      }
+
+      inv_[i] = Type( 1 ) / diag;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows/columns of the preconditioned system.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t JacobiPreconditioner<Type>::size() const noexcept
+{
+   return inv_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=M^{-1}\vec{r} \f$).
+//
+// \param z The target vector.
+// \param r The residual vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the componentwise product of the inverted diagonal and the given
+// residual vector. The operation is vectorized and SMP-parallel.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the residual vector
+inline void JacobiPreconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                               const DenseVector<VT2,false>& r ) const
+{
+   if( (~z).size() != inv_.size() || (~r).size() != inv_.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   (~z) = inv_ * (~r);
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,449 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Kernels.h
+//  \brief Header file for the fused kernels of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of vector elements processed per chunk of a fused solver kernel.
+// \ingroup solver_kernels
+//
+// The fused vector kernels process their vectors in chunks of this size. All operations of a
+// kernel are applied to one chunk before the next chunk is processed, such that all vectors
+// involved in the kernel are streamed from memory only once.
+*/
+constexpr size_t SOLVER_CHUNK_SIZE = 1024UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of matrix rows processed per chunk of a fused dense matrix/vector kernel.
+// \ingroup solver_kernels
+*/
+constexpr size_t SOLVER_ROW_CHUNK_SIZE = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED SOLVER KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused solver kernels */
+//@{
+template< typename RT, typename OP >
+inline RT fusedKernel( size_t size, OP op );
+
+template< typename VT1, typename MT, bool SO, typename VT2, typename VT3 >
+inline ElementType_<VT1>
+   multDot( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+            const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& w );
+
+template< typename VT1, typename MT, bool SO, typename VT2, typename VT3 >
+inline StaticVector< ElementType_<VT1>, 2UL >
+   multDotNorm( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+                const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& w );
+
+template< typename VT1, typename ST, typename VT2 >
+inline UnderlyingBuiltin_< ElementType_<VT1> >
+   axpyNorm( DenseVector<VT1,false>& y, ST alpha, const DenseVector<VT2,false>& x );
+
+template< typename VT1, typename ST, typename VT2, typename VT3 >
+inline ElementType_<VT1>
+   axpyDot( DenseVector<VT1,false>& y, ST alpha, const DenseVector<VT2,false>& x,
+            const DenseVector<VT3,false>& w );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Chunked, SMP-parallel execution of a fused vector kernel.
+// \ingroup solver_kernels
+//
+// \param size The size of the processed vectors.
+// \param op The kernel to be executed.
+// \return The sum of the partial results of all chunks.
+//
+// This function executes the given kernel for consecutive chunks of blaze::SOLVER_CHUNK_SIZE
+// elements of the index range \f$ [0..size) \f$. The kernel is called as \a op( index, n ) for
+// the chunk \f$ [index..index+n) \f$ and has to return its partial result for this chunk. Since
+// all operations of the kernel are applied to a chunk while the chunk resides in cache, every
+// vector involved in the kernel is streamed from memory only once. The chunks are distributed
+// among all available threads (see the blaze::SMP_SOLVER_THRESHOLD). Since the kernel might be
+// executed in parallel, all Blaze operations within the kernel have to be wrapped by the
+// serial() function.
+//
+// All fused kernels of the iterative solvers are built on top of this function. The following
+// example demonstrates the fusion of an update of two vectors with the computation of a norm:
+
+   \code
+   using blaze::subvector;
+   using blaze::serial;
+
+   blaze::DynamicVector<double> x, r, p, q;
+   double alpha;
+   // ... Initialization of the vectors and the scalar
+
+   const double norm = blaze::fusedKernel<double>( x.size(), [&]( size_t i, size_t n ) {
+      subvector( x, i, n ) += serial( alpha * subvector( p, i, n ) );
+      subvector( r, i, n ) -= serial( alpha * subvector( q, i, n ) );
+      return serial( trans( subvector( r, i, n ) ) * subvector( r, i, n ) );
+   } );
+   \endcode
+*/
+template< typename RT    // Result type of the kernel
+        , typename OP >  // Type of the kernel
+inline RT fusedKernel( size_t size, OP op )
+{
+   return smpFusedKernel<RT>( size, size, [op]( size_t begin, size_t end )
+   {
+      RT result = RT();
+
+      for( size_t i=begin; i<end; i+=SOLVER_CHUNK_SIZE ) {
+         result += op( i, min( SOLVER_CHUNK_SIZE, end-i ) );
+      }
+
+      return result;
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused matrix/vector multiplication and dot products for row-major sparse matrices.
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param A The row-major sparse matrix.
+// \param x The right-hand side vector of the multiplication.
+// \param w The vector for the dot product \f$ \vec{w}^H\vec{y} \f$.
+// \return The dot products \f$ \vec{w}^H\vec{y} \f$ and \f$ \vec{y}^H\vec{y} \f$.
+//
+// This kernel computes every element of the target vector by a single traversal of the according
+// row of the sparse matrix and immediately accumulates the contribution of the element to both
+// dot products.
+*/
+template< bool NORM      // Flag for the computation of the norm of the target vector
+        , typename VT1   // Type of the target vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename VT3 > // Type of the dot product vector
+inline EnableIf_< And< IsSparseMatrix<MT>, IsRowMajorMatrix<MT> >, StaticVector<ElementType_<VT1>,2UL> >
+   multDotKernel( VT1& y, const MT& A, const VT2& x, const VT3& w )
+{
+   typedef ElementType_<VT1>     ET;
+   typedef StaticVector<ET,2UL>  RT;
+   typedef ConstIterator_<MT>    ConstIterator;
+
+   return smpFusedKernel<RT>( A.rows(), A.nonZeros(), [&y,&A,&x,&w]( size_t begin, size_t end )
+   {
+      ET dot ( 0 );
+      ET norm( 0 );
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         ET tmp( 0 );
+
+         const ConstIterator last( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=last; ++element ) {
+            tmp += element->value() * x[element->index()];
+         }
+
+         y[i] = tmp;
+         dot += conj( w[i] ) * tmp;
+         if( NORM ) norm += conj( tmp ) * tmp;
+      }
+
+      return RT{ dot, norm };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused matrix/vector multiplication and dot products for all other matrices.
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param A The matrix.
+// \param x The right-hand side vector of the multiplication.
+// \param w The vector for the dot product \f$ \vec{w}^H\vec{y} \f$.
+// \return The dot products \f$ \vec{w}^H\vec{y} \f$ and \f$ \vec{y}^H\vec{y} \f$.
+//
+// This kernel computes the target vector in chunks of blaze::SOLVER_ROW_CHUNK_SIZE rows by means
+// of the (vectorized) matrix/vector multiplication of Blaze and computes the contributions of a
+// chunk to both dot products while the chunk resides in cache.
+*/
+template< bool NORM      // Flag for the computation of the norm of the target vector
+        , typename VT1   // Type of the target vector
+        , typename MT    // Type of the matrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename VT3 > // Type of the dot product vector
+inline DisableIf_< And< IsSparseMatrix<MT>, IsRowMajorMatrix<MT> >, StaticVector<ElementType_<VT1>,2UL> >
+   multDotKernel( VT1& y, const MT& A, const VT2& x, const VT3& w )
+{
+   typedef ElementType_<VT1>     ET;
+   typedef StaticVector<ET,2UL>  RT;
+
+   const size_t work( IsSparseMatrix<MT>::value ? nonZeros( A ) : A.rows()*A.columns() );
+
+   return smpFusedKernel<RT>( A.rows(), work, [&y,&A,&x,&w]( size_t begin, size_t end )
+   {
+      RT result( 0 );
+
+      for( size_t i=begin; i<end; i+=SOLVER_ROW_CHUNK_SIZE )
+      {
+         const size_t m( min( SOLVER_ROW_CHUNK_SIZE, end-i ) );
+
+         auto ysub( subvector( y, i, m ) );
+         ysub = serial( submatrix( A, i, 0UL, m, A.columns() ) * x );
+
+         result[0] += serial( ctrans( subvector( w, i, m ) ) * ysub );
+         if( NORM ) result[1] += serial( ctrans( ysub ) * ysub );
+      }
+
+      return result;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused matrix/vector multiplication and dot product (\f$ \vec{y}=A\vec{x} \f$,
+//        \f$ \vec{w}^H\vec{y} \f$).
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param A The matrix.
+// \param x The right-hand side vector of the multiplication.
+// \param w The vector for the dot product.
+// \return The dot product \f$ \vec{w}^H\vec{y} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the matrix/vector multiplication \f$ \vec{y}=A\vec{x} \f$ and the dot
+// product \f$ \vec{w}^H\vec{y} \f$ in a single pass over the involved data. For row-major
+// sparse matrices every element of \f$ \vec{y} \f$ contributes to the dot product right after
+// it has been computed, for all other matrices the dot product is computed for chunks of rows
+// that still reside in cache. The target vector \f$ \vec{y} \f$ must not alias with any of the
+// other operands. In case the sizes of the vectors don't match the size of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the target vector
+        , typename MT   // Type of the matrix
+        , bool SO       // Storage order of the matrix
+        , typename VT2  // Type of the right-hand side vector
+        , typename VT3 > // Type of the dot product vector
+inline ElementType_<VT1>
+   multDot( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+            const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& w )
+{
+   if( (~A).columns() != (~x).size() || (~A).rows() != (~y).size() || (~w).size() != (~y).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   return multDotKernel<false>( ~y, Ac, ~x, ~w )[0];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused matrix/vector multiplication, dot product and norm (\f$ \vec{y}=A\vec{x} \f$,
+//        \f$ \vec{w}^H\vec{y} \f$, \f$ \vec{y}^H\vec{y} \f$).
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param A The matrix.
+// \param x The right-hand side vector of the multiplication.
+// \param w The vector for the dot product.
+// \return The dot product \f$ \vec{w}^H\vec{y} \f$ and the squared norm \f$ \vec{y}^H\vec{y} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the matrix/vector multiplication \f$ \vec{y}=A\vec{x} \f$, the dot
+// product \f$ \vec{w}^H\vec{y} \f$ and the squared norm of \f$ \vec{y} \f$ in a single pass over
+// the involved data (see the multDot() function). The target vector \f$ \vec{y} \f$ must not
+// alias with any of the other operands. In case the sizes of the vectors don't match the size
+// of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the target vector
+        , typename MT   // Type of the matrix
+        , bool SO       // Storage order of the matrix
+        , typename VT2  // Type of the right-hand side vector
+        , typename VT3 > // Type of the dot product vector
+inline StaticVector< ElementType_<VT1>, 2UL >
+   multDotNorm( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+                const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& w )
+{
+   if( (~A).columns() != (~x).size() || (~A).rows() != (~y).size() || (~w).size() != (~y).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   return multDotKernel<true>( ~y, Ac, ~x, ~w );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused vector update and norm computation (\f$ \vec{y}+=\alpha\vec{x} \f$,
+//        \f$ \|\vec{y}\|_2^2 \f$).
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param alpha The scaling factor.
+// \param x The vector to be added.
+// \return The squared norm \f$ \vec{y}^H\vec{y} \f$ of the updated vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function updates the vector \f$ \vec{y} \f$ and computes the squared norm of the updated
+// vector in a single pass over both vectors. In case the sizes of the two vectors don't match,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the target vector
+        , typename ST   // Type of the scaling factor
+        , typename VT2 > // Type of the vector to be added
+inline UnderlyingBuiltin_< ElementType_<VT1> >
+   axpyNorm( DenseVector<VT1,false>& y, ST alpha, const DenseVector<VT2,false>& x )
+{
+   typedef UnderlyingBuiltin_< ElementType_<VT1> >  RT;
+
+   if( (~y).size() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return fusedKernel<RT>( (~y).size(), [&y,alpha,&x]( size_t i, size_t n )
+   {
+      auto ysub( subvector( ~y, i, n ) );
+      ysub += serial( alpha * subvector( ~x, i, n ) );
+      return real( serial( ctrans( ysub ) * ysub ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused vector update and dot product (\f$ \vec{y}+=\alpha\vec{x} \f$,
+//        \f$ \vec{w}^H\vec{y} \f$).
+// \ingroup solver_kernels
+//
+// \param y The target vector.
+// \param alpha The scaling factor.
+// \param x The vector to be added.
+// \param w The vector for the dot product.
+// \return The dot product \f$ \vec{w}^H\vec{y} \f$ with the updated vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function updates the vector \f$ \vec{y} \f$ and computes the dot product of the given
+// vector \f$ \vec{w} \f$ with the updated vector in a single pass over all three vectors. In
+// case the sizes of the vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the target vector
+        , typename ST   // Type of the scaling factor
+        , typename VT2  // Type of the vector to be added
+        , typename VT3 > // Type of the dot product vector
+inline ElementType_<VT1>
+   axpyDot( DenseVector<VT1,false>& y, ST alpha, const DenseVector<VT2,false>& x,
+            const DenseVector<VT3,false>& w )
+{
+   typedef ElementType_<VT1>  RT;
+
+   if( (~y).size() != (~x).size() || (~y).size() != (~w).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return fusedKernel<RT>( (~y).size(), [&y,alpha,&x,&w]( size_t i, size_t n )
+   {
+      auto ysub( subvector( ~y, i, n ) );
+      ysub += serial( alpha * subvector( ~x, i, n ) );
+      return serial( ctrans( subvector( ~w, i, n ) ) * ysub );
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
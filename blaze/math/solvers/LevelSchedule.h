@@ -0,0 +1,347 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LevelSchedule.h
+//  \brief Header file for the level schedule of sparse triangular substitutions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level set analysis of a sparse triangular matrix.
+// \ingroup solvers
+//
+// The LevelSchedule class groups the rows of a sparse lower or upper triangular matrix into
+// levels. Row \f$ i \f$ belongs to level \f$ k \f$ if the longest chain of dependencies of the
+// substitution that ends in row \f$ i \f$ has length \f$ k \f$. Since all rows of a level only
+// depend on rows of previous levels, the substitutions of the rows of a level are independent
+// of each other and can be executed in parallel. The analysis only depends on the sparsity
+// pattern of the matrix and can be reused for all matrices with the same pattern:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   const blaze::LevelSchedule schedule( L, 'L' );  // Analysis of the lower triangular part
+
+   solve( L, x, b, schedule );  // Level-scheduled forward substitution
+   \endcode
+
+// The \a uplo argument selects the strictly lower (\c 'L') or strictly upper (\c 'U') part of
+// the given matrix, all elements of the opposite part are ignored. Therefore the analysis can
+// also be performed on a general sparse matrix that stores the combined factors of an LU
+// decomposition.
+*/
+class LevelSchedule
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>::const_iterator  ConstIterator;  //!< Iterator over the rows of a level.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LevelSchedule();
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A, char uplo );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        size  () const noexcept;
+   inline size_t        levels() const noexcept;
+   inline char          uplo  () const noexcept;
+   inline size_t        size  ( size_t l ) const noexcept;
+   inline size_t        work  ( size_t l ) const noexcept;
+   inline ConstIterator begin ( size_t l ) const noexcept;
+   inline ConstIterator end   ( size_t l ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   char                uplo_;     //!< The analyzed triangular part ('L' or 'U').
+   std::vector<size_t> rows_;     //!< The row indices ordered by level.
+   std::vector<size_t> offsets_;  //!< The offsets of the levels within the row indices.
+   std::vector<size_t> work_;     //!< The number of non-zero elements per level.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the LevelSchedule class.
+*/
+inline LevelSchedule::LevelSchedule()
+   : uplo_   ( 'L'      )  // The analyzed triangular part
+   , rows_   ()            // The row indices ordered by level
+   , offsets_( 1UL, 0UL )  // The offsets of the levels within the row indices
+   , work_   ()            // The number of non-zero elements per level
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level set analysis of the given sparse matrix.
+//
+// \param A The square sparse matrix to be analyzed.
+// \param uplo \c 'L' to analyze the lower triangular part, \c 'U' for the upper part.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+//
+// This constructor computes the level of every row of the given matrix in a single pass over
+// all non-zero elements. Row-major matrices are traversed row by row, column-major matrices
+// column by column. Within every level the rows are stored in ascending order. In case the
+// given matrix is not square or \a uplo is neither \c 'L' nor \c 'U', a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A, char uplo )
+   : uplo_   ( uplo )  // The analyzed triangular part
+   , rows_   ()        // The row indices ordered by level
+   , offsets_()        // The offsets of the levels within the row indices
+   , work_   ()        // The number of non-zero elements per level
+{
+   typedef ConstIterator_<MT>  MatrixIterator;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+   const bool lower( uplo == 'L' );
+
+   std::vector<size_t> level   ( n, 0UL );
+   std::vector<size_t> nonzeros( n, 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( lower ? k : n-k-1UL );
+      const MatrixIterator end( (~A).end(i) );
+
+      if( IsRowMajorMatrix<MT>::value )
+      {
+         size_t l( 0UL );
+         for( MatrixIterator element=(~A).begin(i); element!=end; ++element ) {
+            const size_t j( element->index() );
+            if( ( lower && j < i ) || ( !lower && j > i ) )
+               l = max( l, level[j]+1UL );
+         }
+         level[i]    = l;
+         nonzeros[i] = (~A).nonZeros(i);
+      }
+      else
+      {
+         for( MatrixIterator element=(~A).begin(i); element!=end; ++element ) {
+            const size_t j( element->index() );
+            if( ( lower && j > i ) || ( !lower && j < i ) )
+               level[j] = max( level[j], level[i]+1UL );
+            ++nonzeros[j];
+         }
+      }
+   }
+
+   size_t levels( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      levels = max( levels, level[i]+1UL );
+   }
+
+   offsets_.resize( levels+1UL, 0UL );
+   work_.resize( levels, 0UL );
+   rows_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++offsets_[level[i]+1UL];
+      work_[level[i]] += nonzeros[i];
+   }
+
+   for( size_t l=0UL; l<levels; ++l ) {
+      offsets_[l+1UL] += offsets_[l];
+   }
+
+   std::vector<size_t> pos( offsets_.begin(), offsets_.end()-1 );
+   for( size_t i=0UL; i<n; ++i ) {
+      rows_[pos[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the analyzed matrix.
+//
+// \return The number of rows of the analyzed matrix.
+*/
+inline size_t LevelSchedule::size() const noexcept
+{
+   return rows_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels.
+//
+// \return The number of levels, i.e. the length of the critical path of the substitution.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the analyzed triangular part.
+//
+// \return \c 'L' in case the lower part has been analyzed, \c 'U' for the upper part.
+*/
+inline char LevelSchedule::uplo() const noexcept
+{
+   return uplo_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given level.
+//
+// \param l The index of the level \f$[0..levels()-1]\f$.
+// \return The number of rows of level \a l.
+*/
+inline size_t LevelSchedule::size( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return offsets_[l+1UL] - offsets_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the rows of the given level.
+//
+// \param l The index of the level \f$[0..levels()-1]\f$.
+// \return The number of non-zero elements of the rows of level \a l.
+*/
+inline size_t LevelSchedule::work( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return work_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first row of the given level.
+//
+// \param l The index of the level \f$[0..levels()-1]\f$.
+// \return Iterator to the first row index of level \a l.
+*/
+inline LevelSchedule::ConstIterator LevelSchedule::begin( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return rows_.begin() + offsets_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last row of the given level.
+//
+// \param l The index of the level \f$[0..levels()-1]\f$.
+// \return Iterator just past the last row index of level \a l.
+*/
+inline LevelSchedule::ConstIterator LevelSchedule::end( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return rows_.begin() + offsets_[l+1UL];
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
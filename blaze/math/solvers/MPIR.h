@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MPIR.h
+//  \brief Header file for the mixed-precision iterative refinement
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MPIR_H_
+#define _BLAZE_MATH_SOLVERS_MPIR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/LU.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsDouble.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MIXED-PRECISION ITERATIVE REFINEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Mixed-precision iterative refinement */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+bool mpir( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+           const DenseVector<VT2,false>& b, SolverControl& control );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system by means of a given LU decomposition.
+// \ingroup solvers
+//
+// \param LU The LU decomposition of the system matrix as computed by the getrf() function.
+// \param ipiv The pivot indices of the LU decomposition.
+// \param v The right-hand side vector on input, the solution on output.
+// \return void
+//
+// This function applies the row interchanges of the LU decomposition and performs the forward
+// substitution with the unit lower triangular factor and the backward substitution with the
+// upper triangular factor. Both substitutions are column-oriented, i.e. they are composed of
+// vectorized updates with the columns of the column-major decomposition.
+*/
+template< typename Type >  // Data type of the matrix and vector elements
+void mpirSolve( const DynamicMatrix<Type,columnMajor>& LU, const int* ipiv,
+                DynamicVector<Type,false>& v )
+{
+   const size_t n( LU.rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t p( ipiv[i] - 1 );
+      if( p != i ) {
+         std::swap( v[i], v[p] );
+      }
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type vj( v[j] );
+      if( !isDefault( vj ) && j+1UL < n ) {
+         subvector( v, j+1UL, n-j-1UL ) -= subvector( column( LU, j ), j+1UL, n-j-1UL ) * vj;
+      }
+   }
+
+   for( size_t j=n; j-->0UL; ) {
+      v[j] /= LU(j,j);
+      const Type vj( v[j] );
+      if( !isDefault( vj ) && j > 0UL ) {
+         subvector( v, 0UL, j ) -= subvector( column( LU, j ), 0UL, j ) * vj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given LU decomposition for a zero or non-finite pivot element.
+// \ingroup solvers
+//
+// \param LU The LU decomposition of the system matrix.
+// \return \a true in case all diagonal elements of the upper factor are finite and nonzero.
+*/
+template< typename Type >  // Data type of the matrix elements
+bool mpirIsRegular( const DynamicMatrix<Type,columnMajor>& LU )
+{
+   for( size_t i=0UL; i<LU.rows(); ++i ) {
+      if( isDefault( LU(i,i) ) || !std::isfinite( real( LU(i,i) ) ) ||
+          !std::isfinite( imag( LU(i,i) ) ) ) {
+         return false;
+      }
+   }
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of a general linear system by means of the mixed-precision iterative
+//        refinement.
+// \ingroup solvers
+//
+// \param A The general, square system matrix.
+// \param x The solution on output.
+// \param b The right-hand side vector.
+// \param control The termination criteria and the result of the solution process.
+// \return \a true in case the method has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Invalid singular matrix provided.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ for a general double precision
+// matrix \f$ A \f$ by means of the mixed-precision iterative refinement. The \f$ O(n^3) \f$ LU
+// decomposition of the system matrix is computed in single precision, i.e. at roughly half the
+// cost of a double precision decomposition. The single precision solution is then improved by
+// the iterative refinement
+
+      \f[ \vec{r}=\vec{b}-A\vec{x}, \quad LU\vec{d}=P\vec{r}, \quad \vec{x}=\vec{x}+\vec{d}, \f]
+
+// where the residual \f$ \vec{r} \f$ and the update of the solution are computed in double
+// precision and the correction \f$ \vec{d} \f$ is computed by means of the single precision LU
+// decomposition. For matrices that are not too badly conditioned a few refinement steps suffice
+// to reach double precision accuracy:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization of the system
+
+   blaze::SolverControl control( 30UL, 1E-14 );
+
+   const bool converged = blaze::mpir( A, x, b, control );
+   \endcode
+
+// The refinement terminates as soon as the relative residual \f$ \|\vec{b}-A\vec{x}\|_2 /
+// \|\vec{b}\|_2 \f$ drops below the tolerance of the given SolverControl. In case the maximum
+// number of refinement steps is exceeded, the residual stagnates, or the system matrix cannot
+// be represented or decomposed in single precision, the system is solved by means of a double
+// precision LU decomposition instead. The number of refinement steps and the final relative
+// residual are recorded in the SolverControl. In contrast to the other iterative solvers, the
+// initial content of \f$ \vec{x} \f$ is ignored.
+//
+// The function is restricted to solution vectors with \c double or \c complex<double> elements.
+// In case the given matrix is not a square matrix or the sizes of the given vectors don't match
+// the size of the matrix, a \a std::invalid_argument exception is thrown. The same exception
+// is thrown in case the given matrix is singular.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool mpir( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+           const DenseVector<VT2,false>& b, SolverControl& control )
+{
+   typedef ElementType_<VT1>                           ET;  // Element type of the solution vector
+   typedef UnderlyingBuiltin_<ET>                      RT;  // Underlying builtin type
+   typedef If_< IsComplex<ET>, complex<float>, float >  LT;  // Single precision element type
+
+   BLAZE_STATIC_ASSERT_MSG( IsDouble<RT>::value, "Double precision solution vector required" );
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~x).size() != (~A).rows() || (~b).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   CompositeType_<MT> Ac( ~A );  // Evaluation of the matrix operand
+
+   const RT bnorm( sqrt( real( ctrans( ~b ) * (~b) ) ) );
+
+   if( bnorm == RT( 0 ) ) {
+      reset( ~x );
+      control.report( 0UL, RT( 0 ), true );
+      return true;
+   }
+
+   const std::unique_ptr<int[]> ipiv( new int[n] );
+
+   DynamicMatrix<LT,columnMajor> LU( Ac );
+   getrf_backend( LU, ipiv.get() );
+
+   DynamicVector<ET,false> r( n );
+   size_t iteration( 0UL );
+
+   if( mpirIsRegular( LU ) )
+   {
+      DynamicVector<LT,false> d( (~b) * ( RT( 1 ) / bnorm ) );
+      mpirSolve( LU, ipiv.get(), d );
+      r = d;
+      (~x) = r * bnorm;
+
+      RT previous( bnorm );
+
+      while( true )
+      {
+         r = (~b) - Ac * (~x);
+
+         const RT rnorm( sqrt( real( ctrans( r ) * r ) ) );
+
+         if( rnorm <= control.tolerance() * bnorm ) {
+            control.report( iteration, rnorm / bnorm, true );
+            return true;
+         }
+
+         if( iteration == control.maxIterations() || !( rnorm < previous ) ) {
+            break;
+         }
+
+         d = r * ( RT( 1 ) / rnorm );
+         mpirSolve( LU, ipiv.get(), d );
+         r = d;
+         (~x) += r * rnorm;
+
+         previous = rnorm;
+         ++iteration;
+      }
+   }
+
+   DynamicMatrix<LT,columnMajor>().swap( LU );
+   DynamicMatrix<ET,columnMajor> LUd( Ac );
+   getrf_backend( LUd, ipiv.get() );
+
+   if( !mpirIsRegular( LUd ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid singular matrix provided" );
+   }
+
+   r = ~b;
+   mpirSolve( LUd, ipiv.get(), r );
+   (~x) = r;
+
+   r = (~b) - Ac * (~x);
+
+   const RT residual( sqrt( real( ctrans( r ) * r ) ) / bnorm );
+   const bool converged( residual <= control.tolerance() );
+
+   control.report( iteration, residual, converged );
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
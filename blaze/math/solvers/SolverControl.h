@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverControl.h
+//  \brief Header file for the SolverControl class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Control and result data of an iterative solver.
+// \ingroup solvers
+//
+// The SolverControl class specifies the termination criteria of the iterative solvers (see
+// for instance the cg(), bicgstab() and gmres() functions) and records the state of the solver
+// after the solution process. An iterative solver terminates as soon as the relative residual
+// \f$ \|\vec{b}-A\vec{x}\|_2 / \|\vec{b}\|_2 \f$ drops below the given tolerance or as soon as
+// the maximum number of iterations has been performed:
+
+   \code
+   blaze::SolverControl control( 500UL, 1E-10 );  // At most 500 iterations, tolerance 1E-10
+
+   if( !blaze::cg( A, x, b, control ) ) {
+      std::cerr << "No convergence after " << control.iterations() << " iterations, "
+                << "relative residual = " << control.residual() << "\n";
+   }
+   \endcode
+
+// The restart parameter is only used by the GMRES method and specifies the maximum dimension
+// of the Krylov subspace before the method is restarted.
+*/
+class SolverControl
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SolverControl( size_t maxIterations = 1000UL, double tolerance = 1E-8,
+                                  size_t restart = 30UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t maxIterations() const noexcept;
+   inline double tolerance    () const noexcept;
+   inline size_t restart      () const noexcept;
+   inline size_t iterations   () const noexcept;
+   inline double residual     () const noexcept;
+   inline bool   converged    () const noexcept;
+
+   inline void report( size_t iterations, double residual, bool converged ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t maxIterations_;  //!< The maximum number of iterations.
+   double tolerance_;      //!< The tolerance for the relative residual.
+   size_t restart_;        //!< The restart parameter of the GMRES method.
+   size_t iterations_;     //!< The number of iterations performed by the last solution process.
+   double residual_;       //!< The relative residual after the last solution process.
+   bool   converged_;      //!< Convergence flag of the last solution process.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the SolverControl class.
+//
+// \param maxIterations The maximum number of iterations.
+// \param tolerance The tolerance for the relative residual.
+// \param restart The restart parameter of the GMRES method.
+// \exception std::invalid_argument Invalid solver settings.
+//
+// In case the tolerance is negative or the restart parameter is zero, a \a std::invalid_argument
+// exception is thrown.
+*/
+inline SolverControl::SolverControl( size_t maxIterations, double tolerance, size_t restart )
+   : maxIterations_( maxIterations )  // The maximum number of iterations
+   , tolerance_    ( tolerance     )  // The tolerance for the relative residual
+   , restart_      ( restart       )  // The restart parameter of the GMRES method
+   , iterations_   ( 0UL           )  // The number of iterations of the last solution process
+   , residual_     ( 0.0           )  // The relative residual after the last solution process
+   , converged_    ( false         )  // Convergence flag of the last solution process
+{
+   if( !( tolerance >= 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid solver tolerance" );
+   }
+
+   if( restart == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid restart parameter" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of iterations.
+//
+// \return The maximum number of iterations.
+*/
+inline size_t SolverControl::maxIterations() const noexcept
+{
+   return maxIterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the tolerance for the relative residual.
+//
+// \return The tolerance for the relative residual.
+*/
+inline double SolverControl::tolerance() const noexcept
+{
+   return tolerance_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the restart parameter of the GMRES method.
+//
+// \return The maximum dimension of the Krylov subspace of the GMRES method.
+*/
+inline size_t SolverControl::restart() const noexcept
+{
+   return restart_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations performed by the last solution process.
+//
+// \return The number of iterations of the last solution process.
+*/
+inline size_t SolverControl::iterations() const noexcept
+{
+   return iterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative residual after the last solution process.
+//
+// \return The relative residual \f$ \|\vec{b}-A\vec{x}\|_2 / \|\vec{b}\|_2 \f$.
+*/
+inline double SolverControl::residual() const noexcept
+{
+   return residual_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the last solution process has converged.
+//
+// \return \a true in case the last solution process has converged, \a false if not.
+*/
+inline bool SolverControl::converged() const noexcept
+{
+   return converged_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Records the result of a solution process.
+//
+// \param iterations The number of performed iterations.
+// \param residual The final relative residual.
+// \param converged Convergence flag of the solution process.
+// \return void
+//
+// This function is used by the iterative solvers to record the result of the solution process.
+*/
+inline void SolverControl::report( size_t iterations, double residual, bool converged ) noexcept
+{
+   iterations_ = iterations;
+   residual_   = residual;
+   converged_  = converged;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,553 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Substitution.h
+//  \brief Header file for the forward and backward substitution of sparse triangular systems
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SUBSTITUTION_H_
+#define _BLAZE_MATH_SOLVERS_SUBSTITUTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/adaptors/Forward.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE TRIANGULAR SYSTEM SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular system solver functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2, bool TF >
+void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single row of a row-major sparse triangular matrix.
+// \ingroup solvers
+//
+// \param A The row-major sparse triangular matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \param i The index of the row to be substituted.
+// \return \a true in case the substitution succeeded, \a false in case of a zero diagonal element.
+//
+// This function computes the \a i-th element of the solution vector from the \a i-th element of
+// the right-hand side vector and all elements of the solution vector the row depends on. The
+// template arguments \a LF and \a UF select a lower or upper and a unit or non-unit triangular
+// matrix, respectively. All elements of the opposite triangular part are ignored.
+*/
+template< bool LF        // Lower flag
+        , bool UF        // Unit flag
+        , typename MT    // Type of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+inline bool substituteRow( const MT& A, VT1& x, const VT2& b, size_t i )
+{
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const ConstIterator end( A.end(i) );
+   ConstIterator element( A.begin(i) );
+   ConstIterator diag( end );
+
+   ElementType_<VT1> tmp( b[i] );
+
+   if( LF ) {
+      for( ; element!=end && element->index()<i; ++element ) {
+         tmp -= element->value() * x[element->index()];
+      }
+      if( element != end && element->index() == i ) {
+         diag = element;
+      }
+   }
+   else {
+      for( ; element!=end && element->index()<i; ++element ) {}
+      if( element != end && element->index() == i ) {
+         diag = element;
+         ++element;
+      }
+      for( ; element!=end; ++element ) {
+         tmp -= element->value() * x[element->index()];
+      }
+   }
+
+   if( !UF && ( diag == end || isDefault( diag->value() ) ) ) {
+      x[i] = tmp;
+      return false;
+   }
+
+   x[i] = ( UF )?( tmp ):( tmp / diag->value() );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-oriented substitution of a column-major sparse triangular matrix.
+// \ingroup solvers
+//
+// \param A The column-major sparse triangular matrix.
+// \param x The right-hand side on entry, the solution vector on exit.
+// \return The number of zero diagonal elements.
+//
+// This function performs a column-oriented forward (\a LF == \a true) or backward (\a LF ==
+// \a false) substitution in-place on the given vector. After the computation of an element of
+// the solution vector it is eliminated from all remaining elements of the right-hand side.
+*/
+template< bool LF        // Lower flag
+        , bool UF        // Unit flag
+        , typename MT    // Type of the system matrix
+        , typename VT >  // Type of the solution vector
+inline size_t substituteColumns( const MT& A, VT& x )
+{
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t n( A.columns() );
+   size_t failures( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t j( LF ? k : n-k-1UL );
+      const ConstIterator end( A.end(j) );
+
+      if( !UF ) {
+         const ConstIterator diag( A.find( j, j ) );
+         if( diag == end || isDefault( diag->value() ) )
+            ++failures;
+         else
+            x[j] /= diag->value();
+      }
+
+      const ElementType_<VT> xj( x[j] );
+
+      for( ConstIterator element=A.begin(j); element!=end; ++element ) {
+         const size_t i( element->index() );
+         if( ( LF && i > j ) || ( !LF && i < j ) )
+            x[i] -= element->value() * xj;
+      }
+   }
+
+   return failures;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the sparse triangular system solvers.
+// \ingroup solvers
+//
+// \param A The sparse triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the system matrix (\c nullptr for a serial substitution).
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// Row-major system matrices are solved row by row. In case a level schedule is given, the rows
+// are processed level by level and the rows of every level are distributed among all available
+// threads. Column-major system matrices are always solved by a serial column-oriented
+// substitution.
+*/
+template< bool LF        // Lower flag
+        , bool UF        // Unit flag
+        , typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the vectors
+void solve_backend( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF>& x,
+                    const DenseVector<VT2,TF>& b, const LevelSchedule* schedule )
+{
+   const size_t n( (~A).rows() );
+
+   if( n != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( schedule != nullptr && ( schedule->size() != n || schedule->uplo() != ( LF ? 'L' : 'U' ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid level schedule provided" );
+   }
+
+   resize( ~x, n, false );
+
+   size_t failures( 0UL );
+
+   if( SO == columnMajor ) {
+      (~x) = (~b);
+      failures = substituteColumns<LF,UF>( ~A, ~x );
+   }
+   else if( schedule == nullptr ) {
+      for( size_t k=0UL; k<n; ++k ) {
+         if( !substituteRow<LF,UF>( ~A, ~x, ~b, LF ? k : n-k-1UL ) )
+            ++failures;
+      }
+   }
+   else {
+      for( size_t l=0UL; l<schedule->levels(); ++l )
+      {
+         const LevelSchedule::ConstIterator rows( schedule->begin(l) );
+
+         failures += smpFusedKernel<size_t>( schedule->size(l), schedule->work(l),
+                                             [&A,&x,&b,rows]( size_t begin, size_t end )
+         {
+            size_t partial( 0UL );
+            for( size_t k=begin; k<end; ++k ) {
+               if( !substituteRow<LF,UF>( ~A, ~x, ~b, rows[k] ) )
+                  ++partial;
+            }
+            return partial;
+         } );
+      }
+   }
+
+   if( failures > 0UL ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solving the LSE of a singular matrix failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse lower triangular system of equations (\f$ L*x=b \f$).
+// \ingroup solvers
+//
+// \param L The sparse lower triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the lower triangular system of equations \f$ L*x=b \f$ by means of a
+// forward substitution:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   solve( L, x, b );
+   \endcode
+
+// In case a diagonal element of \a L is zero or not stored, a \a std::runtime_error exception
+// is thrown and the content of \a x is undefined. The vectors \a x and \a b are allowed to be
+// the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   solve_backend<true,false>( ~L, ~x, ~b, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solution of a sparse lower triangular system of equations (\f$ L*x=b \f$).
+// \ingroup solvers
+//
+// \param L The sparse lower triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the lower part of \a L.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the lower triangular system of equations \f$ L*x=b \f$ by means of a
+// forward substitution. In case \a L is a row-major matrix, the rows of every level of the given
+// level schedule (see blaze::LevelSchedule) are distributed among all available threads:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   const blaze::LevelSchedule schedule( L, 'L' );
+   solve( L, x, b, schedule );
+   \endcode
+
+// Column-major matrices are solved serially. In case the schedule has not been computed for the
+// lower part of a matrix of the same size, a \a std::invalid_argument exception is thrown. In
+// case a diagonal element of \a L is zero or not stored, a \a std::runtime_error exception is
+// thrown and the content of \a x is undefined. The vectors \a x and \a b are allowed to be the
+// same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule )
+{
+   solve_backend<true,false>( ~L, ~x, ~b, &schedule );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse unilower triangular system of equations (\f$ L*x=b \f$).
+// \ingroup solvers
+//
+// \param L The sparse unilower triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function solves the unilower triangular system of equations \f$ L*x=b \f$ by means of a
+// forward substitution. The vectors \a x and \a b are allowed to be the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   solve_backend<true,true>( ~L, ~x, ~b, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solution of a sparse unilower triangular system of equations (\f$ L*x=b \f$).
+// \ingroup solvers
+//
+// \param L The sparse unilower triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the lower part of \a L.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function solves the unilower triangular system of equations \f$ L*x=b \f$ by means of a
+// forward substitution. In case \a L is a row-major matrix, the rows of every level of the given
+// level schedule (see blaze::LevelSchedule) are distributed among all available threads. The
+// vectors \a x and \a b are allowed to be the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule )
+{
+   solve_backend<true,true>( ~L, ~x, ~b, &schedule );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse upper triangular system of equations (\f$ U*x=b \f$).
+// \ingroup solvers
+//
+// \param U The sparse upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the upper triangular system of equations \f$ U*x=b \f$ by means of a
+// backward substitution. In case a diagonal element of \a U is zero or not stored, a
+// \a std::runtime_error exception is thrown and the content of \a x is undefined. The vectors
+// \a x and \a b are allowed to be the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   solve_backend<false,false>( ~U, ~x, ~b, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solution of a sparse upper triangular system of equations (\f$ U*x=b \f$).
+// \ingroup solvers
+//
+// \param U The sparse upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the upper part of \a U.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Solving the LSE of a singular matrix failed.
+//
+// This function solves the upper triangular system of equations \f$ U*x=b \f$ by means of a
+// backward substitution. In case \a U is a row-major matrix, the rows of every level of the
+// given level schedule (see blaze::LevelSchedule) are distributed among all available threads.
+// In case a diagonal element of \a U is zero or not stored, a \a std::runtime_error exception is
+// thrown and the content of \a x is undefined. The vectors \a x and \a b are allowed to be the
+// same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule )
+{
+   solve_backend<false,false>( ~U, ~x, ~b, &schedule );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse uniupper triangular system of equations (\f$ U*x=b \f$).
+// \ingroup solvers
+//
+// \param U The sparse uniupper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function solves the uniupper triangular system of equations \f$ U*x=b \f$ by means of a
+// backward substitution. The vectors \a x and \a b are allowed to be the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   solve_backend<false,true>( ~U, ~x, ~b, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solution of a sparse uniupper triangular system of equations (\f$ U*x=b \f$).
+// \ingroup solvers
+//
+// \param U The sparse uniupper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the upper part of \a U.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function solves the uniupper triangular system of equations \f$ U*x=b \f$ by means of a
+// backward substitution. In case \a U is a row-major matrix, the rows of every level of the
+// given level schedule (see blaze::LevelSchedule) are distributed among all available threads.
+// The vectors \a x and \a b are allowed to be the same vector.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b,
+            const LevelSchedule& schedule )
+{
+   solve_backend<false,true>( ~U, ~x, ~b, &schedule );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
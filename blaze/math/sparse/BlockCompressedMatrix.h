@@ -0,0 +1,1799 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a sparse matrix in the block compressed row storage format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSpMultKernels.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-optimized row-major sparse matrix in the block compressed row storage format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template represents a row-major sparse matrix in the block
+// compressed row (BCSR) storage format, which is optimized for repeated sparse matrix/dense
+// vector multiplications of matrices with a natural block structure (as for instance matrices
+// resulting from the discretization of systems of partial differential equations). The matrix
+// is divided into dense blocks of \a M rows and \a N columns. Only the blocks containing at
+// least one non-zero element are stored: For every block row, the column indices of the stored
+// blocks and the column-major stored elements of the blocks are kept in separate arrays. The
+// type of the elements and the size of the blocks can be specified via the three template
+// parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of a single block.
+//  - N   : specifies the number of columns of a single block.
+//
+// A BlockCompressedMatrix is created from any other matrix and can afterwards only be used on
+// the right-hand side of assignments. All multiplications of a BlockCompressedMatrix with a dense
+// vector or dense matrix with the same element type are evaluated by the specialized spmv() and
+// spmm() kernels. Only a single column index has to be loaded per block and in case \a M is a
+// multiple of the number of values packed into a single SIMD vector, each column of a block is
+// processed by aligned SIMD operations:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::BlockCompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double,rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   const BlockCompressedMatrix<double,4UL,2UL> B( A );  // Conversion into 4x2 blocks
+   DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = B * x;                 // Evaluated by means of spmv( y, B, x, 1.0, 0.0 )
+   y -= B * x;                // Evaluated by means of spmv( y, B, x, -1.0, 1.0 )
+   \endcode
+
+// Note that the zero elements within the stored blocks are explicitly stored and are therefore
+// also visited by the iterators of the matrix and counted by the nonZeros() functions.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,M,N>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,M,N>     This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef SparseMatrix<This,rowMajor>         BaseType;        //!< Base type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>     ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;       //!< Reference to a constant matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant matrix value.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the stored elements of a single row of the BlockCompressedMatrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>       Element;           //!< Element type of the sparse matrix.
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_ ( nullptr )  // Pointer to the current row of the current block
+         , column_( nullptr )  // Pointer to the block column index of the current block
+         , c_     ( 0UL )      // The current column within the current block
+         , n_     ( 0UL )      // The number of columns of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the current row of the current block.
+      // \param column Pointer to the block column index of the current block.
+      // \param c The current column within the current block.
+      // \param n The number of columns of the matrix.
+      */
+      inline ConstIterator( const Type* value, const size_t* column, size_t c, size_t n ) noexcept
+         : value_ ( value  )  // Pointer to the current row of the current block
+         , column_( column )  // Pointer to the block column index of the current block
+         , c_     ( c      )  // The current column within the current block
+         , n_     ( n      )  // The number of columns of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ++c_;
+         if( c_ == N || (*column_)*N + c_ >= n_ ) {
+            c_ = 0UL;
+            ++column_;
+            value_ += M*N;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ConstReference value() const noexcept {
+         return value_[c_*M];
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return (*column_)*N + c_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return column_ == rhs.column_ && c_ == rhs.c_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      //
+      // Since only the last block of a block row can be cut off by the last column of the
+      // matrix, the left-hand side iterator is expected to refer to a later position than
+      // the right-hand side iterator.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         DifferenceType diff( ( column_ - rhs.column_ ) * DifferenceType( N ) +
+                              DifferenceType( c_ ) - DifferenceType( rhs.c_ ) );
+         if( column_ != rhs.column_ && column_[-1]*N + N > n_ )
+            diff -= DifferenceType( column_[-1]*N + N - n_ );
+         return diff;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;   //!< Pointer to the current row of the current block.
+      const size_t* column_;  //!< Pointer to the block column index of the current block.
+      size_t        c_;       //!< The current column within the current block.
+      size_t        n_;       //!< The number of columns of the matrix.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+
+   inline BlockCompressedMatrix( const BlockCompressedMatrix& bm );
+   inline BlockCompressedMatrix( BlockCompressedMatrix&& bm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   inline BlockCompressedMatrix& operator=( BlockCompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t blocks() const noexcept;
+   inline void   reset();
+   inline void   swap( BlockCompressedMatrix& bm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Kernel functions */
+   //@{
+   template< typename VT1, typename VT2, typename ST >
+   void mult( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x, ST alpha, ST beta ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2, typename ST >
+   void mult( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta ) const;
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   //! The number of elements of a single block.
+   enum : size_t { BLOCKSIZE = M*N };
+
+   //! Compilation switch for the vectorized matrix/vector multiplication kernel.
+   enum : bool { vectorizable = IsVectorizable<Type>::value &&
+                                HasSIMDAdd<Type,Type>::value &&
+                                HasSIMDMult<Type,Type>::value &&
+                                ( M % SIMDSIZE == 0UL ) };
+
+   //! Compilation switch for the vectorized matrix/matrix multiplication kernel.
+   enum : bool { paddedVectorizable = usePadding &&
+                                      IsVectorizable<Type>::value &&
+                                      HasSIMDAdd<Type,Type>::value &&
+                                      HasSIMDMult<Type,Type>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the selection of the direct multiplication kernel.
+   /*! The DirectMult struct is a helper struct for the selection of the multiplication kernel.
+       In case both vectors provide direct access to their contiguous elements of type \a Type,
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT1, typename VT2 >
+   struct DirectMult {
+      enum : bool { value = HasMutableDataAccess<VT1>::value && !IsExpression<VT1>::value &&
+                            HasConstDataAccess<VT2>::value && !IsExpression<VT2>::value &&
+                            IsSame< ElementType_<VT1>, Type >::value &&
+                            IsSame< ElementType_<VT2>, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT1, typename VT2, typename ST >
+   inline EnableIf_< DirectMult<VT1,VT2> >
+      multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const;
+
+   template< typename VT1, typename VT2, typename ST >
+   inline DisableIf_< DirectMult<VT1,VT2> >
+      multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const;
+
+   template< typename ST >
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                           ST alpha, ST beta, TrueType ) const noexcept;
+
+   template< typename ST >
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                           ST alpha, ST beta, FalseType ) const noexcept;
+
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, TrueType  ) noexcept;
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, FalseType ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                     //!< The number of rows of the matrix.
+   size_t n_;                     //!< The number of columns of the matrix.
+   size_t nonZeros_;              //!< The number of stored elements of the matrix.
+   size_t blockRows_;             //!< The number of block rows of the matrix.
+   Type* BLAZE_RESTRICT values_;  //!< The column-major elements of all stored blocks.
+   size_t* offsets_;              //!< The offsets of the block rows (\a blockRows_+1 elements).
+   size_t* columns_;              //!< The block column indices of all stored blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t M, size_t N >
+const Type BlockCompressedMatrix<Type,M,N>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix() noexcept
+   : m_        ( 0UL )      // The number of rows of the matrix
+   , n_        ( 0UL )      // The number of columns of the matrix
+   , nonZeros_ ( 0UL )      // The number of stored elements of the matrix
+   , blockRows_( 0UL )      // The number of block rows of the matrix
+   , values_   ( nullptr )  // The column-major elements of all stored blocks
+   , offsets_  ( nullptr )  // The offsets of the block rows
+   , columns_  ( nullptr )  // The block column indices of all stored blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into the block compressed row format.
+//
+// This constructor converts the given matrix into the block compressed row format. All blocks
+// containing at least one non-zero element of the given matrix are stored.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : BlockCompressedMatrix()
+{
+   const CompressedMatrix<Type,rowMajor> A( ~m );
+
+   const size_t invalid( size_t(-1) );
+   const size_t blockColumns( ( A.columns() + N - 1UL ) / N );
+
+   m_         = A.rows();
+   n_         = A.columns();
+   blockRows_ = ( m_ + M - 1UL ) / M;
+
+   std::vector<size_t> marker( blockColumns, invalid );
+
+   try {
+      offsets_ = allocate<size_t>( blockRows_ + 1UL );
+      offsets_[0UL] = 0UL;
+
+      for( size_t ib=0UL; ib<blockRows_; ++ib )
+      {
+         size_t count( 0UL );
+
+         for( size_t i=ib*M; i<std::min( (ib+1UL)*M, m_ ); ++i ) {
+            for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+               const size_t jb( element->index() / N );
+               if( marker[jb] != ib ) {
+                  marker[jb] = ib;
+                  ++count;
+               }
+            }
+         }
+
+         offsets_[ib+1UL] = offsets_[ib] + count;
+      }
+
+      columns_ = allocate<size_t>( offsets_[blockRows_] );
+      values_  = allocate<Type>( offsets_[blockRows_] * BLOCKSIZE );
+   }
+   catch( ... ) {
+      reset();
+      throw;
+   }
+
+   std::fill( values_, values_ + offsets_[blockRows_] * BLOCKSIZE, Type() );
+   std::fill( marker.begin(), marker.end(), invalid );
+
+   for( size_t ib=0UL; ib<blockRows_; ++ib )
+   {
+      const size_t ibegin( ib*M );
+      const size_t iend  ( std::min( ibegin+M, m_ ) );
+      size_t b( offsets_[ib] );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t jb( element->index() / N );
+            if( marker[jb] == invalid ) {
+               marker[jb] = 0UL;
+               columns_[b++] = jb;
+            }
+         }
+      }
+
+      std::sort( columns_ + offsets_[ib], columns_ + b );
+
+      for( b=offsets_[ib]; b<offsets_[ib+1UL]; ++b ) {
+         marker[columns_[b]] = b;
+      }
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t j( element->index() );
+            values_[marker[j/N]*BLOCKSIZE + (j%N)*M + (i-ibegin)] = element->value();
+         }
+         nonZeros_ += nonZeros( i );
+      }
+
+      for( b=offsets_[ib]; b<offsets_[ib+1UL]; ++b ) {
+         marker[columns_[b]] = invalid;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param bm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( const BlockCompressedMatrix& bm )
+   : BlockCompressedMatrix()
+{
+   const size_t blocks( bm.blocks() );
+
+   try {
+      offsets_ = allocate<size_t>( bm.blockRows_ + 1UL );
+      columns_ = allocate<size_t>( blocks );
+      values_  = allocate<Type>( blocks * BLOCKSIZE );
+   }
+   catch( ... ) {
+      reset();
+      throw;
+   }
+
+   m_         = bm.m_;
+   n_         = bm.n_;
+   nonZeros_  = bm.nonZeros_;
+   blockRows_ = bm.blockRows_;
+
+   std::copy( bm.offsets_, bm.offsets_ + blockRows_ + 1UL, offsets_ );
+   std::copy( bm.columns_, bm.columns_ + blocks, columns_ );
+   std::copy( bm.values_, bm.values_ + blocks * BLOCKSIZE, values_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BlockCompressedMatrix.
+//
+// \param bm The sparse matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( BlockCompressedMatrix&& bm ) noexcept
+   : BlockCompressedMatrix()
+{
+   swap( bm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>::~BlockCompressedMatrix()
+{
+   deallocate( values_ );
+   deallocate( offsets_ );
+   deallocate( columns_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstReference
+   BlockCompressedMatrix<Type,M,N>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstReference
+   BlockCompressedMatrix<Type,M,N>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first stored element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first stored element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t b( offsets_[i/M] );
+   return ConstIterator( values_ + b*BLOCKSIZE + i%M, columns_ + b, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first stored element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first stored element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last stored element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last stored element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t b( offsets_[i/M+1UL] );
+   return ConstIterator( values_ + b*BLOCKSIZE + i%M, columns_ + b, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last stored element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last stored element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>&
+   BlockCompressedMatrix<Type,M,N>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs != this ) {
+      BlockCompressedMatrix tmp( rhs );
+      swap( tmp );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BlockCompressedMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline BlockCompressedMatrix<Type,M,N>&
+   BlockCompressedMatrix<Type,M,N>::operator=( BlockCompressedMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted into the block compressed row format.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,M,N>&
+   BlockCompressedMatrix<Type,M,N>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity corresponds to the total number of elements of all stored blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::capacity() const noexcept
+{
+   return blocks() * BLOCKSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return ( offsets_[i/M+1UL] - offsets_[i/M] ) * N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the sparse matrix.
+//
+// \return The number of stored elements in the sparse matrix.
+//
+// This function returns the number of elements within the stored blocks, including the zero
+// elements of the blocks but excluding the parts of the blocks beyond the last row or column.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of stored elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeros( size_t i ) const noexcept
+{
+   return static_cast<size_t>( end( i ) - begin( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks.
+//
+// \return The number of stored blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline size_t BlockCompressedMatrix<Type,M,N>::blocks() const noexcept
+{
+   return ( offsets_ != nullptr )?( offsets_[blockRows_] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix to the default initial state.
+//
+// \return void
+//
+// This function resets the matrix to a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void BlockCompressedMatrix<Type,M,N>::reset()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param bm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void BlockCompressedMatrix<Type,M,N>::swap( BlockCompressedMatrix& bm ) noexcept
+{
+   std::swap( m_, bm.m_ );
+   std::swap( n_, bm.n_ );
+   std::swap( nonZeros_, bm.nonZeros_ );
+   std::swap( blockRows_, bm.blockRows_ );
+   std::swap( values_, bm.values_ );
+   std::swap( offsets_, bm.offsets_ );
+   std::swap( columns_, bm.columns_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element at position (\a i,\a j). In case the element
+// is found, the function returns an row iterator to the element. Otherwise an iterator just
+// past the last stored element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t* const first( columns_ + offsets_[i/M] );
+   const size_t* const last ( columns_ + offsets_[i/M+1UL] );
+   const size_t* const pos  ( std::lower_bound( first, last, j/N ) );
+   const size_t b( pos - columns_ );
+
+   return ConstIterator( values_ + b*BLOCKSIZE + i%M, pos,
+                         ( pos != last && *pos == j/N )?( j%N ):( 0UL ), n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      ++pos;
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of a block
+        , size_t N >        // Number of columns of a block
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,M,N>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of a block
+        , size_t N >        // Number of columns of a block
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,M,N>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since the matrix cannot be used in SMP assignments.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline bool BlockCompressedMatrix<Type,M,N>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the matrix/vector multiplication \f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// In case both vectors provide direct access to their elements, the kernel operates directly on
+// the given vectors. Otherwise the vectors are copied into temporary vectors.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void BlockCompressedMatrix<Type,M,N>::mult( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                                            ST alpha, ST beta ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~y).size() == m_, "Invalid vector size" );
+
+   multDispatch( ~y, ~x, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the matrix/matrix multiplication \f$ C=\alpha*A*B+\beta*C \f$.
+//
+// \param C The target left-hand side dense matrix.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// Every stored element of the matrix is read exactly once and scales a complete row of \a B,
+// i.e. the kernel is vectorized along the rows of row-major copies of \a B and \a C.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , bool SO2       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void BlockCompressedMatrix<Type,M,N>::mult( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B,
+                                            ST alpha, ST beta ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~B).rows() == n_, "Invalid number of rows" );
+
+   const DynamicMatrix<Type,rowMajor> tB( ~B );
+   DynamicMatrix<Type,rowMajor> tC( m_, tB.columns(), Type() );
+
+   const size_t K( paddedVectorizable ? tB.spacing() : tB.columns() );
+
+   for( size_t ib=0UL; ib<blockRows_; ++ib )
+   {
+      const size_t i0  ( ib*M );
+      const size_t rend( std::min( M, m_-i0 ) );
+
+      for( size_t b=offsets_[ib]; b<offsets_[ib+1UL]; ++b )
+      {
+         const Type* const v( values_ + b*BLOCKSIZE );
+         const size_t j0  ( columns_[b]*N );
+         const size_t cend( std::min( N, n_-j0 ) );
+
+         for( size_t c=0UL; c<cend; ++c ) {
+            for( size_t r=0UL; r<rend; ++r ) {
+               axpy( tC.data(i0+r), tB.data(j0+c), v[c*M+r], K, BoolConstant<paddedVectorizable>() );
+            }
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<tC.rows(); ++i ) {
+      for( size_t j=tC.columns(); j<tC.spacing(); ++j ) {
+         tC.data(i)[j] = Type();
+      }
+   }
+
+   if( isDefault( beta ) )
+      (~C) = alpha * tC;
+   else
+      (~C) = alpha * tC + beta * (~C);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication directly on the elements of the given vectors.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+inline EnableIf_< typename BlockCompressedMatrix<Type,M,N>::template DirectMult<VT1,VT2> >
+   BlockCompressedMatrix<Type,M,N>::multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const
+{
+   if( x.canAlias( &y ) ) {
+      const DynamicVector<Type,false> tmp( x );
+      multKernel( y.data(), tmp.data(), alpha, beta, BoolConstant<vectorizable>() );
+   }
+   else {
+      multKernel( y.data(), x.data(), alpha, beta, BoolConstant<vectorizable>() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication by means of temporary vectors.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+inline DisableIf_< typename BlockCompressedMatrix<Type,M,N>::template DirectMult<VT1,VT2> >
+   BlockCompressedMatrix<Type,M,N>::multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const
+{
+   const DynamicVector<Type,false> tx( x );
+   DynamicVector<Type,false> ty( m_, Type() );
+
+   multKernel( ty.data(), tx.data(), ST(1), ST(0), BoolConstant<vectorizable>() );
+
+   if( isDefault( beta ) )
+      y = alpha * ty;
+   else
+      y = alpha * ty + beta * y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the matrix/vector multiplication.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// The \a M rows of a block row are accumulated in \a M/SIMDSIZE SIMD vectors. Every column of
+// a block is processed by aligned SIMD loads and a single broadcast element of \a x. In case
+// \a beta is zero, the target vector is not read.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename ST >  // Type of the scaling factors
+inline void BlockCompressedMatrix<Type,M,N>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                         ST alpha, ST beta, TrueType ) const noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const bool scale( !isDefault( beta ) );
+
+   for( size_t ib=0UL; ib<blockRows_; ++ib )
+   {
+      SIMDType xmm[M/SIMDSIZE];
+
+      for( size_t b=offsets_[ib]; b<offsets_[ib+1UL]; ++b )
+      {
+         const Type* BLAZE_RESTRICT v( values_ + b*BLOCKSIZE );
+         const size_t j0  ( columns_[b]*N );
+         const size_t cend( std::min( N, n_-j0 ) );
+
+         for( size_t c=0UL; c<cend; ++c ) {
+            const SIMDType x1( set( x[j0+c] ) );
+            for( size_t p=0UL; p<M/SIMDSIZE; ++p ) {
+               xmm[p] = xmm[p] + loada( v+c*M+p*SIMDSIZE ) * x1;
+            }
+         }
+      }
+
+      const size_t i0  ( ib*M );
+      const size_t rend( std::min( M, m_-i0 ) );
+
+      for( size_t r=0UL; r<rend; ++r ) {
+         Type& target( y[i0+r] );
+         const Type tmp( xmm[r/SIMDSIZE][r%SIMDSIZE] );
+         target = ( scale )?( alpha * tmp + beta * target ):( alpha * tmp );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the matrix/vector multiplication.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// In case \a beta is zero, the target vector is not read.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+template< typename ST >  // Type of the scaling factors
+inline void BlockCompressedMatrix<Type,M,N>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                         ST alpha, ST beta, FalseType ) const noexcept
+{
+   const bool scale( !isDefault( beta ) );
+
+   for( size_t ib=0UL; ib<blockRows_; ++ib )
+   {
+      Type tmp[M];
+      std::fill( tmp, tmp+M, Type() );
+
+      for( size_t b=offsets_[ib]; b<offsets_[ib+1UL]; ++b )
+      {
+         const Type* BLAZE_RESTRICT v( values_ + b*BLOCKSIZE );
+         const size_t j0  ( columns_[b]*N );
+         const size_t cend( std::min( N, n_-j0 ) );
+
+         for( size_t c=0UL; c<cend; ++c ) {
+            const Type x1( x[j0+c] );
+            for( size_t r=0UL; r<M; ++r ) {
+               tmp[r] += v[c*M+r] * x1;
+            }
+         }
+      }
+
+      const size_t i0  ( ib*M );
+      const size_t rend( std::min( M, m_-i0 ) );
+
+      for( size_t r=0UL; r<rend; ++r ) {
+         Type& target( y[i0+r] );
+         target = ( scale )?( alpha * tmp[r] + beta * target ):( alpha * tmp[r] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized update \f$ \vec{y} += a \vec{x} \f$ of an aligned, zero padded array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements including the padding (a multiple of the SIMD width).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void BlockCompressedMatrix<Type,M,N>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                   const Type& a, size_t n, TrueType ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const SIMDType factor( set( a ) );
+
+   for( size_t l=0UL; l<n; l+=SIMDSIZE ) {
+      storea( y+l, loada( y+l ) + loada( x+l ) * factor );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default update \f$ \vec{y} += a \vec{x} \f$ of an array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void BlockCompressedMatrix<Type,M,N>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                                   const Type& a, size_t n, FalseType ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] += x[l] * a;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( BlockCompressedMatrix<Type,M,N>& a, BlockCompressedMatrix<Type,M,N>& b ) noexcept;
+
+template< typename VT1, typename Type, size_t M, size_t N, typename VT2, typename ST >
+void spmv( DenseVector<VT1,false>& y, const BlockCompressedMatrix<Type,M,N>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta );
+
+template< typename MT1, bool SO1, typename Type, size_t M, size_t N, typename MT2, bool SO2, typename ST >
+void spmm( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,M,N>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void reset( BlockCompressedMatrix<Type,M,N>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void clear( BlockCompressedMatrix<Type,M,N>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N >     // Number of columns of a block
+inline void swap( BlockCompressedMatrix<Type,M,N>& a, BlockCompressedMatrix<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Block compressed matrix/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function performs the multiplication of a block compressed matrix with a dense vector.
+// Every stored block of the matrix is read exactly once. In case \a beta is zero, the target
+// vector is not read and resized to the number of rows of \a A if necessary.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of a block
+        , size_t N       // Number of columns of a block
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void spmv( DenseVector<VT1,false>& y, const BlockCompressedMatrix<Type,M,N>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~x).size() != A.columns() || ( !isDefault( beta ) && (~y).size() != A.rows() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~y, A.rows(), false );
+
+   A.mult( ~y, ~x, alpha, beta );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Block compressed matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the multiplication of a block compressed matrix with a dense matrix.
+// Every stored element of the matrix is read exactly once and scales a complete row of \a B.
+// In case \a beta is zero, the target matrix is not read and resized if necessary.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename Type  // Data type of the block compressed matrix
+        , size_t M       // Number of rows of a block
+        , size_t N       // Number of columns of a block
+        , typename MT2   // Type of the right-hand side matrix operand
+        , bool SO2       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void spmm( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,M,N>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != A.columns() ||
+       ( !isDefault( beta ) && ( (~C).rows() != A.rows() || (~C).columns() != (~B).columns() ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   A.mult( ~C, ~B, alpha, beta );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASSPMULTKERNELS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t M, size_t N >
+struct HasSpMultKernels< BlockCompressedMatrix<T,M,N> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t M, size_t N >
+struct SubmatrixTrait< BlockCompressedMatrix<T1,M,N> >
+{
+   using Type = CompressedMatrix<T1,rowMajor>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t M, size_t N >
+struct RowTrait< BlockCompressedMatrix<T1,M,N> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t M, size_t N >
+struct ColumnTrait< BlockCompressedMatrix<T1,M,N> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
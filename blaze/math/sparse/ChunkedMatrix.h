@@ -0,0 +1,1947 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/ChunkedMatrix.h
+//  \brief Implementation of a sparse matrix with chunked row/column storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_CHUNKEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_CHUNKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsRValueReference.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup chunked_matrix ChunkedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a sparse matrix for frequent structural modifications.
+// \ingroup chunked_matrix
+//
+// The ChunkedMatrix class template is the counterpart of the CompressedMatrix class template
+// for applications that constantly change the sparsity pattern of a matrix, as for instance
+// online graph updates or incremental assembly. In contrast to the CompressedMatrix, which
+// stores all non-zero elements in a single array and therefore has to move large parts of this
+// array on every insertion or erasure in a row other than the last one, every row (in case of
+// a row-major matrix) or column (in case of a column-major matrix) of the ChunkedMatrix is
+// stored as a sequence of small, sorted chunks of at most 64 elements. An insertion or erasure
+// only moves the elements of a single chunk and the handles of the chunks of a single row or
+// column. Therefore the cost of set(), insert() and erase() is independent of the total number
+// of non-zero elements and in practice constant. The type of the elements and the storage order
+// of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class ChunkedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. ChunkedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//
+// Since the elements of each row/column are kept sorted, the ChunkedMatrix can be used in all
+// expressions as any other sparse matrix. For repeated computations the matrix can be converted
+// into a CompressedMatrix via the compress() function, which fills the rows/columns of the
+// compressed matrix in parallel:
+
+   \code
+   using blaze::ChunkedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   ChunkedMatrix<double,rowMajor> A( 100000UL, 50000UL );
+
+   // Frequent modifications of the sparsity pattern
+   A.set( 17UL, 4711UL, 2.5 );
+   A(3UL,15UL) += 1.0;
+   A.erase( 17UL, 4711UL );
+
+   // Direct use within expressions
+   DynamicVector<double> x( 50000UL, 1.0 );
+   DynamicVector<double> y( A * x );
+
+   // Conversion into a compressed matrix
+   CompressedMatrix<double,rowMajor> B;
+   A.compress( B );
+   \endcode
+
+// Since the rows/columns of the matrix don't share any state, different rows (in case of a
+// row-major matrix) or columns (in case of a column-major matrix) can be modified concurrently
+// by different threads. Note however that all iterators of a row/column are invalidated by an
+// insertion or erasure within this row/column.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class ChunkedMatrix : public SparseMatrix< ChunkedMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the chunked matrix element.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Value-index-pair for the ChunkedMatrix class.
+   //
+   // This struct grants access to the data members of the base class and adapts the copy and
+   // move semantics of the value-index-pair: Assignments to an element via an iterator only
+   // change the value of the element, not its index.
+   */
+   struct Element : public ElementBase
+   {
+      //**Constructors*****************************************************************************
+      explicit Element() = default;
+               Element( const Element& rhs ) = default;
+               Element( Element&& rhs ) = default;
+      //*******************************************************************************************
+
+      //**Assignment operators*********************************************************************
+      inline Element& operator=( const Element& rhs )
+      {
+         this->value_ = rhs.value_;
+         return *this;
+      }
+
+      inline Element& operator=( Element&& rhs )
+      {
+         this->value_ = std::move( rhs.value_ );
+         return *this;
+      }
+
+      template< typename Other >
+      inline EnableIf_< IsSparseElement<Other>, Element& >
+         operator=( const Other& rhs )
+      {
+         this->value_ = rhs.value();
+         return *this;
+      }
+
+      template< typename Other >
+      inline EnableIf_< And< IsSparseElement< RemoveReference_<Other> >
+                           , IsRValueReference<Other&&> >, Element& >
+         operator=( Other&& rhs )
+      {
+         this->value_ = std::move( rhs.value() );
+         return *this;
+      }
+
+      template< typename Other >
+      inline EnableIf_< Not< IsSparseElement<Other> >, Element& >
+         operator=( const Other& v )
+      {
+         this->value_ = v;
+         return *this;
+      }
+
+      template< typename Other >
+      inline EnableIf_< And< Not< IsSparseElement< RemoveReference_<Other> > >
+                           , IsRValueReference<Other&&> >, Element& >
+         operator=( Other&& v )
+      {
+         this->value_ = std::move( v );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class ChunkedMatrix;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<ElementBase>  Chunk;  //!< Sorted sequence of non-zero elements.
+   typedef std::vector<Chunk>        Line;   //!< Sorted sequence of chunks of a single row/column.
+   //**********************************************************************************************
+
+   //**ChunkIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row/column of a ChunkedMatrix.
+   */
+   template< typename ElementType  // Type of the accessed elements
+           , typename ChunkType >  // Type of the traversed chunks
+   class ChunkIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag   IteratorCategory;  //!< The iterator category.
+      typedef RemoveConst_<ElementType>  ValueType;         //!< Type of the underlying elements.
+      typedef ElementType*                PointerType;       //!< Pointer return type.
+      typedef ElementType&                ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                   DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ChunkIterator class.
+      */
+      inline ChunkIterator() noexcept
+         : chunk_( nullptr )  // Pointer to the current chunk
+         , pos_  ( 0UL )      // The current position within the current chunk
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ChunkIterator class.
+      //
+      // \param chunk Pointer to the current chunk.
+      // \param pos The current position within the current chunk.
+      */
+      inline ChunkIterator( ChunkType* chunk, size_t pos ) noexcept
+         : chunk_( chunk )  // Pointer to the current chunk
+         , pos_  ( pos   )  // The current position within the current chunk
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different ChunkIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ElementType2, typename ChunkType2 >
+      inline ChunkIterator( const ChunkIterator<ElementType2,ChunkType2>& it ) noexcept
+         : chunk_( it.chunk_ )  // Pointer to the current chunk
+         , pos_  ( it.pos_   )  // The current position within the current chunk
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ChunkIterator& operator++() noexcept {
+         if( ++pos_ == chunk_->size() ) {
+            ++chunk_;
+            pos_ = 0UL;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ChunkIterator operator++( int ) noexcept {
+         const ChunkIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline ReferenceType operator*() const noexcept {
+         return static_cast<ReferenceType>( (*chunk_)[pos_] );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Pointer to the sparse matrix element at the current iterator position.
+      */
+      inline PointerType operator->() const noexcept {
+         return &(**this);
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ChunkIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ElementType2, typename ChunkType2 >
+      inline bool operator==( const ChunkIterator<ElementType2,ChunkType2>& rhs ) const noexcept {
+         return chunk_ == rhs.chunk_ && pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ChunkIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ElementType2, typename ChunkType2 >
+      inline bool operator!=( const ChunkIterator<ElementType2,ChunkType2>& rhs ) const noexcept {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      //
+      // The left-hand side iterator is expected to refer to the same or a later position of the
+      // same row/column than the right-hand side iterator.
+      */
+      template< typename ElementType2, typename ChunkType2 >
+      inline DifferenceType operator-( const ChunkIterator<ElementType2,ChunkType2>& rhs ) const noexcept {
+         DifferenceType diff( DifferenceType( pos_ ) - DifferenceType( rhs.pos_ ) );
+         for( const Chunk* chunk=rhs.chunk_; chunk!=chunk_; ++chunk ) {
+            diff += DifferenceType( chunk->size() );
+         }
+         return diff;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ChunkType* chunk_;  //!< Pointer to the current chunk.
+      size_t     pos_;    //!< The current position within the current chunk.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ElementType2, typename ChunkType2 > friend class ChunkIterator;
+      friend class ChunkedMatrix;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef ChunkedMatrix<Type,SO>                      This;            //!< Type of this ChunkedMatrix instance.
+   typedef SparseMatrix<This,SO>                       BaseType;        //!< Base type of this ChunkedMatrix instance.
+   typedef CompressedMatrix<Type,SO>                   ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>                  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>                  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                        ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                                 ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                                 CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>                     Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                                 ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef ChunkIterator<Element,Chunk>                Iterator;        //!< Iterator over non-constant elements.
+   typedef ChunkIterator<const Element,const Chunk>    ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a ChunkedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef ChunkedMatrix<ET,SO>  Other;  //!< The type of the other ChunkedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ChunkedMatrix() noexcept;
+   explicit inline ChunkedMatrix( size_t m, size_t n );
+
+   template< typename MT, bool SO2 >
+   explicit inline ChunkedMatrix( const Matrix<MT,SO2>& m );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+
+   template< typename MT, bool SO2 > inline ChunkedMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+   inline void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   compress( CompressedMatrix<Type,SO>& A ) const;
+   inline void   swap( ChunkedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j, const Type& value );
+   inline Iterator insert( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   lines() const noexcept;
+   inline Iterator insertElement( Line& line, size_t index, const Type& value );
+   inline Iterator eraseElement ( Line& line, size_t c, size_t pos );
+
+   static inline size_t findChunk( const Line& line, size_t index ) noexcept;
+
+   template< typename IT, typename LT >
+   static inline IT lineLowerBound( LT& line, size_t index ) noexcept;
+
+   template< typename IT, typename LT >
+   static inline IT lineUpperBound( LT& line, size_t index ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                 //!< The current number of rows of the sparse matrix.
+   size_t n_;                 //!< The current number of columns of the sparse matrix.
+   std::vector<Line> lines_;  //!< The chunks of all rows/columns of the sparse matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Chunk size**********************************************************************************
+   //! The maximum number of non-zero elements per chunk.
+   enum : size_t { chunkSize = 64UL };
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type ChunkedMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ChunkedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline ChunkedMatrix<Type,SO>::ChunkedMatrix() noexcept
+   : m_    ( 0UL )  // The current number of rows of the sparse matrix
+   , n_    ( 0UL )  // The current number of columns of the sparse matrix
+   , lines_()       // The chunks of all rows/columns of the sparse matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline ChunkedMatrix<Type,SO>::ChunkedMatrix( size_t m, size_t n )
+   : m_    ( m )           // The current number of rows of the sparse matrix
+   , n_    ( n )           // The current number of columns of the sparse matrix
+   , lines_( SO ? n : m )  // The chunks of all rows/columns of the sparse matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into a chunked matrix.
+//
+// The given matrix is evaluated into a compressed matrix (unless it already is a compressed
+// matrix of the same type), whose rows/columns are afterwards split into completely filled
+// chunks. The rows/columns are processed in parallel in case the number of non-zero elements
+// is sufficiently large.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline ChunkedMatrix<Type,SO>::ChunkedMatrix( const Matrix<MT,SO2>& m )
+   : m_    ( (~m).rows() )     // The current number of rows of the sparse matrix
+   , n_    ( (~m).columns() )  // The current number of columns of the sparse matrix
+   , lines_( SO ? n_ : m_ )    // The chunks of all rows/columns of the sparse matrix
+{
+   typedef CompressedMatrix<Type,SO>                     CMT;
+   typedef If_< IsSame<MT,CMT>, const CMT&, const CMT >  Tmp;
+
+   Tmp A( ~m );
+
+   const size_t processed = smpFusedKernel<size_t>( lines_.size(), A.nonZeros(), [this,&A]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i )
+      {
+         Line& line( lines_[i] );
+         line.reserve( ( A.nonZeros(i) + chunkSize - 1UL ) / chunkSize );
+
+         for( auto element=A.begin(i); element!=A.end(i); ) {
+            const size_t size( std::min<size_t>( chunkSize, A.end(i) - element ) );
+            line.emplace_back( element, element+size );
+            element += size;
+         }
+      }
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == lines_.size(), "Invalid number of processed rows/columns" );
+   UNUSED_PARAMETER( processed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case
+// the chunked matrix does not yet store an element for index (\a i,\a j), a new element is
+// inserted into the chunked matrix. This function only performs an index check in case
+// BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Reference
+   ChunkedMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstReference
+   ChunkedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Reference
+   ChunkedMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstReference
+   ChunkedMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return Iterator( lines_[i].data(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return ConstIterator( lines_[i].data(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return Iterator( lines_[i].data() + lines_[i].size(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return ConstIterator( lines_[i].data() + lines_[i].size(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline ChunkedMatrix<Type,SO>& ChunkedMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   ChunkedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::capacity() const noexcept
+{
+   size_t capacity( 0UL );
+   for( size_t i=0UL; i<lines(); ++i )
+      capacity += this->capacity( i );
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column, i.e. the sum of the
+// capacities of all chunks of the row/column. In case the storage order is set to \a rowMajor
+// the function returns the capacity of row \a i, in case the storage flag is set to
+// \a columnMajor the function returns the capacity of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   size_t capacity( 0UL );
+   for( const Chunk& chunk : lines_[i] )
+      capacity += chunk.capacity();
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<lines(); ++i )
+      nonzeros += nonZeros( i );
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+   for( const Chunk& chunk : lines_[i] )
+      nonzeros += chunk.size();
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::reset()
+{
+   for( Line& line : lines_ )
+      line.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column is released.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   lines_[i].clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   lines_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t bound( SO ? m : n );
+
+   if( !preserve ) {
+      lines_.clear();
+   }
+
+   lines_.resize( SO ? n : m );
+
+   if( preserve && bound < ( SO ? m_ : n_ ) )
+   {
+      for( Line& line : lines_ )
+      {
+         if( line.empty() )
+            continue;
+
+         const size_t c( findChunk( line, bound ) );
+         Chunk& chunk( line[c] );
+
+         chunk.erase( std::lower_bound( chunk.begin(), chunk.end(), bound,
+                                        []( const ElementBase& element, size_t idx ) {
+                                           return element.index() < idx;
+                                        } ), chunk.end() );
+
+         const size_t last( chunk.empty() ? c : c+1UL );
+         line.erase( line.begin()+last, line.end() );
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converting the sparse matrix into a compressed matrix.
+//
+// \param A The target compressed matrix.
+// \return void
+//
+// This function resets the given compressed matrix to a copy of the chunked matrix. The
+// capacity of all rows/columns of the compressed matrix is allocated at once and the
+// rows/columns are filled in parallel in case the number of non-zero elements is sufficiently
+// large. In contrast to an assignment, the conversion does not have to reallocate the element
+// array of the compressed matrix and can therefore be used to efficiently create snapshots of
+// a constantly modified chunked matrix for repeated computations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::compress( CompressedMatrix<Type,SO>& A ) const
+{
+   std::vector<size_t> nonzeros( lines() );
+
+   const size_t total = smpFusedKernel<size_t>( lines(), lines(), [this,&nonzeros]( size_t begin, size_t end )
+   {
+      size_t sum( 0UL );
+      for( size_t i=begin; i<end; ++i ) {
+         nonzeros[i] = nonZeros( i );
+         sum += nonzeros[i];
+      }
+      return sum;
+   } );
+
+   CompressedMatrix<Type,SO> tmp( m_, n_, nonzeros );
+
+   const size_t processed = smpFusedKernel<size_t>( lines(), total, [this,&tmp]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         for( const Chunk& chunk : lines_[i] ) {
+            for( const ElementBase& element : chunk ) {
+               if( SO )
+                  tmp.append( element.index(), i, element.value() );
+               else
+                  tmp.append( i, element.index(), element.value() );
+            }
+         }
+      }
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == lines(), "Invalid number of processed rows/columns" );
+   UNUSED_PARAMETER( processed );
+
+   A.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::swap( ChunkedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   lines_.swap( sm.lines_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::lines() const noexcept
+{
+   return lines_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting a new element into a row/column.
+//
+// \param line The row/column for the new element.
+// \param index The index of the new element within the row/column.
+// \param value The value of the new element.
+// \return Iterator to the newly inserted element.
+//
+// This function inserts a new element into the chunk covering the given index. In case the
+// chunk is already full, it is split into two halves. Elements appended behind a full chunk
+// are added to the following chunk or to a new chunk, such that a row/column that is filled
+// in ascending order consists of completely filled chunks.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::insertElement( Line& line, size_t index, const Type& value )
+{
+   if( line.empty() ) {
+      line.emplace_back( 1UL, ElementBase( value, index ) );
+      return Iterator( line.data(), 0UL );
+   }
+
+   size_t c( findChunk( line, index ) );
+   size_t pos( std::lower_bound( line[c].begin(), line[c].end(), index,
+                                 []( const ElementBase& element, size_t idx ) {
+                                    return element.index() < idx;
+                                 } ) - line[c].begin() );
+
+   BLAZE_INTERNAL_ASSERT( pos == line[c].size() || line[c][pos].index() != index, "Duplicate element detected" );
+
+   if( line[c].size() == chunkSize )
+   {
+      if( pos == chunkSize ) {
+         ++c;
+         pos = 0UL;
+         if( c == line.size() || line[c].size() == chunkSize ) {
+            line.emplace( line.begin()+c, 1UL, ElementBase( value, index ) );
+            return Iterator( line.data()+c, 0UL );
+         }
+      }
+      else {
+         const size_t half( chunkSize / 2UL );
+         Chunk upper( line[c].begin()+half, line[c].end() );
+         line[c].erase( line[c].begin()+half, line[c].end() );
+         line.insert( line.begin()+c+1UL, std::move( upper ) );
+         if( pos > half ) {
+            ++c;
+            pos -= half;
+         }
+      }
+   }
+
+   line[c].insert( line[c].begin()+pos, ElementBase( value, index ) );
+   return Iterator( line.data()+c, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from a row/column.
+//
+// \param line The row/column containing the element.
+// \param c The index of the chunk containing the element.
+// \param pos The position of the element within the chunk.
+// \return Iterator to the element after the erased element.
+//
+// This function erases the specified element. Empty chunks are removed and a chunk that
+// becomes less than half full together with one of its neighbors is merged with it, such
+// that the number of chunks per row/column stays proportional to its number of elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::eraseElement( Line& line, size_t c, size_t pos )
+{
+   BLAZE_INTERNAL_ASSERT( c < line.size() && pos < line[c].size(), "Invalid element position" );
+
+   line[c].erase( line[c].begin()+pos );
+
+   if( line[c].empty() ) {
+      line.erase( line.begin()+c );
+      return Iterator( line.data()+c, 0UL );
+   }
+
+   if( c+1UL < line.size() && line[c].size() + line[c+1UL].size() <= chunkSize / 2UL ) {
+      line[c].insert( line[c].end(), line[c+1UL].begin(), line[c+1UL].end() );
+      line.erase( line.begin()+c+1UL );
+   }
+   else if( c > 0UL && line[c-1UL].size() + line[c].size() <= chunkSize / 2UL ) {
+      pos += line[c-1UL].size();
+      line[c-1UL].insert( line[c-1UL].end(), line[c].begin(), line[c].end() );
+      line.erase( line.begin()+c );
+      --c;
+   }
+
+   if( pos == line[c].size() )
+      return Iterator( line.data()+c+1UL, 0UL );
+   else
+      return Iterator( line.data()+c, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the chunk of a non-empty row/column covering the given index.
+//
+// \param line The non-empty row/column.
+// \param index The index within the row/column.
+// \return The index of the last chunk whose first element is not greater than \a index (or 0).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ChunkedMatrix<Type,SO>::findChunk( const Line& line, size_t index ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( !line.empty(), "Invalid empty row/column" );
+
+   return std::upper_bound( line.begin()+1UL, line.end(), index,
+                            []( size_t idx, const Chunk& chunk ) {
+                               return idx < chunk.front().index();
+                            } ) - line.begin() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of a row/column with an index not less
+//        than the given index.
+//
+// \param line The row/column.
+// \param index The index within the row/column.
+// \return Iterator to the first element with an index not less than \a index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename IT    // Type of the resulting iterator
+        , typename LT >  // Type of the row/column
+inline IT ChunkedMatrix<Type,SO>::lineLowerBound( LT& line, size_t index ) noexcept
+{
+   if( line.empty() )
+      return IT( line.data(), 0UL );
+
+   const size_t c( findChunk( line, index ) );
+   const size_t pos( std::lower_bound( line[c].begin(), line[c].end(), index,
+                                       []( const ElementBase& element, size_t idx ) {
+                                          return element.index() < idx;
+                                       } ) - line[c].begin() );
+
+   if( pos == line[c].size() )
+      return IT( line.data()+c+1UL, 0UL );
+   else
+      return IT( line.data()+c, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of a row/column with an index greater than
+//        the given index.
+//
+// \param line The row/column.
+// \param index The index within the row/column.
+// \return Iterator to the first element with an index greater than \a index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename IT    // Type of the resulting iterator
+        , typename LT >  // Type of the row/column
+inline IT ChunkedMatrix<Type,SO>::lineUpperBound( LT& line, size_t index ) noexcept
+{
+   if( line.empty() )
+      return IT( line.data(), 0UL );
+
+   const size_t c( findChunk( line, index ) );
+   const size_t pos( std::upper_bound( line[c].begin(), line[c].end(), index,
+                                       []( size_t idx, const ElementBase& element ) {
+                                          return idx < element.index();
+                                       } ) - line[c].begin() );
+
+   if( pos == line[c].size() )
+      return IT( line.data()+c+1UL, 0UL );
+   else
+      return IT( line.data()+c, pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the sparse matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid sparse matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid sparse matrix column access index" );
+
+   const Iterator pos( find( i, j ) );
+
+   if( pos != end( SO ? j : i ) ) {
+      pos->value() = value;
+      return pos;
+   }
+
+   return insertElement( lines_[SO ? j : i], SO ? i : j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the sparse matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid sparse matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid sparse matrix column access index" );
+
+   if( find( i, j ) != end( SO ? j : i ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insertElement( lines_[SO ? j : i], SO ? i : j, value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void ChunkedMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+
+   if( pos != end( SO ? j : i ) )
+      erase( SO ? j : i, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos.chunk_ >= lines_[i].data() && pos.chunk_ <= lines_[i].data() + lines_[i].size(), "Invalid iterator" );
+
+   if( pos == end( i ) )
+      return pos;
+
+   Line& line( lines_[i] );
+   return eraseElement( line, size_t( pos.chunk_ - line.data() ), pos.pos_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element at position (\a i,\a j). In case the element
+// is found, the function returns an row/column iterator to the element. Otherwise an iterator
+// just past the last non-zero element of row \a i or column \a j (the end() iterator) is
+// returned. Note that the returned sparse matrix iterator is subject to invalidation due to
+// inserting operations via the function call operator or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   const Iterator pos( lowerBound( i, j ) );
+   const Iterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element at position (\a i,\a j). In case the element
+// is found, the function returns an row/column iterator to the element. Otherwise an iterator
+// just past the last non-zero element of row \a i or column \a j (the end() iterator) is
+// returned. Note that the returned sparse matrix iterator is subject to invalidation due to
+// inserting operations via the function call operator or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator or the
+// insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return lineLowerBound<Iterator>( lines_[SO ? j : i], SO ? i : j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator or the
+// insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return lineLowerBound<ConstIterator>( lines_[SO ? j : i], SO ? i : j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator or the
+// insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::Iterator
+   ChunkedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return lineUpperBound<Iterator>( lines_[SO ? j : i], SO ? i : j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator or the
+// insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename ChunkedMatrix<Type,SO>::ConstIterator
+   ChunkedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return lineUpperBound<ConstIterator>( lines_[SO ? j : i], SO ? i : j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool ChunkedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool ChunkedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool ChunkedMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHUNKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ChunkedMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( ChunkedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( ChunkedMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( ChunkedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( ChunkedMatrix<Type,SO>& a, ChunkedMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given chunked matrix.
+// \ingroup chunked_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( ChunkedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given chunked matrix.
+// \ingroup chunked_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given chunked matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column is released.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( ChunkedMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given chunked matrix.
+// \ingroup chunked_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( ChunkedMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two chunked matrices.
+// \ingroup chunked_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( ChunkedMatrix<Type,SO>& a, ChunkedMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< ChunkedMatrix<T1,SO> >
+{
+   using Type = CompressedMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< ChunkedMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< ChunkedMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
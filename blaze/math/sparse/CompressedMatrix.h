@@ -675,12 +675,10 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -701,8 +699,6 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -710,7 +706,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -1099,15 +1095,13 @@ template< typename MT    // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1131,8 +1125,6 @@ template< typename MT    // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1142,7 +1134,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3289,12 +3281,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3316,8 +3306,6 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -3325,7 +3313,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3698,15 +3686,13 @@ template< typename MT      // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3731,8 +3717,6 @@ template< typename MT      // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3742,7 +3726,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
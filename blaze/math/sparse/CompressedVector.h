@@ -403,7 +403,9 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    //**Low-level utility functions*****************************************************************
    /*!\name Low-level utility functions */
    //@{
-   inline void append( size_t index, const Type& value, bool check=false );
+   inline void append  ( size_t index, const Type& value, bool check=false );
+   inline void appendAt( size_t pos, size_t index, const Type& value );
+   inline void finalize( size_t nonzeros );
    //@}
    //**********************************************************************************************
 
@@ -587,8 +589,7 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
    , begin_   ( nullptr )       // Pointer to the first non-zero element of the compressed vector
    , end_     ( nullptr )       // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~dv );
+   smpAssign( *this, ~dv );
 }
 //*************************************************************************************************
 
@@ -607,8 +608,7 @@ inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& s
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~sv );
+   smpAssign( *this, ~sv );
 }
 //*************************************************************************************************
 
@@ -913,8 +913,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -922,7 +920,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -945,8 +943,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -954,7 +950,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1878,6 +1874,69 @@ inline void CompressedVector<Type,TF>::append( size_t index, const Type& value,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Writing an element to the given position of the compressed vector.
+//
+// \param pos The position of the new element in the internal element array.
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the new element.
+// \return void
+//
+// This function provides a way to fill a compressed vector with elements from several threads.
+// It writes a new element to the given position of the internal element array without any
+// memory allocation and without changing the number of non-zero elements of the vector. The
+// new elements are added to the vector by a subsequent call to the finalize() function. Since
+// the function does not modify the vector itself, it can be called concurrently for distinct
+// positions. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the position must be smaller than the capacity of the vector
+//  - the position must not be smaller than the current number of non-zero elements
+//  - the indices of the elements at the positions up to the number of non-zero elements passed
+//    to finalize() must be strictly increasing
+//
+// Ignoring these preconditions might result in undefined behavior!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void CompressedVector<Type,TF>::appendAt( size_t pos, size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( pos < capacity(), "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( begin_+pos >= end_, "Invalid position of the new element" );
+
+   begin_[pos].value_ = value;
+   begin_[pos].index_ = index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion via the appendAt() function.
+//
+// \param nonzeros The total number of non-zero elements of the compressed vector.
+// \return void
+//
+// This function sets the number of non-zero elements of the compressed vector to \a nonzeros
+// and thereby completes the insertion of the elements written by the appendAt() function. The
+// number of non-zero elements must not be larger than the capacity of the vector and must not
+// be smaller than the current number of non-zero elements.
+//
+// \note The function invalidates all iterators returned by the end() functions!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void CompressedVector<Type,TF>::finalize( size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros <= capacity(), "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( begin_+nonzeros >= end_, "Invalid number of non-zero elements" );
+
+   end_ = begin_ + nonzeros;
+
+   BLAZE_INTERNAL_ASSERT( nonZeros() == nonzeros, "Invalid number of non-zero elements" );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +51,13 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t, size_t > class BlockCompressedMatrix;
+template< typename, bool > class ChunkedMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
+template< typename, bool > class MappedCompressedMatrix;
+template< typename > class SellMatrix;
+template< typename > class TripletBuilder;
 
 } // namespace blaze
 
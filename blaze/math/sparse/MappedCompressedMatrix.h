@@ -0,0 +1,955 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedCompressedMatrix.h
+//  \brief Implementation of a read-only view on external compressed sparse matrix storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_compressed_matrix MappedCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only view on external compressed sparse matrix storage.
+// \ingroup mapped_compressed_matrix
+//
+// The MappedCompressedMatrix class template is the sparse counterpart of the CustomMatrix class
+// template: It represents a read-only sparse matrix on top of an externally managed array of
+// non-zero elements, as for instance the memory mapped content of a file created via the
+// MappedArchiveWriter (see MappedArchive). The type of the elements and the storage order of
+// the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//
+// The external storage consists of two arrays in the same format as used internally by the
+// CompressedMatrix class template: An array of \f$ L+1 \f$ offsets, where \f$ L \f$ is the
+// number of rows (in case of a row-major matrix) or columns (in case of a column-major matrix),
+// and an array of value-index pairs. The non-zero elements of row/column \a i are stored in the
+// range \f$ [offsets[i]..offsets[i+1]) \f$ of the value-index array, ordered by their index:
+
+   \code
+   using blaze::MappedCompressedMatrix;
+   using blaze::ValueIndexPair;
+
+   // Storage of the 2x3 matrix ( ( 1 0 2 ) ( 0 3 0 ) )
+   const size_t offsets[] = { 0UL, 2UL, 3UL };
+   const ValueIndexPair<double> elements[] = { { 1.0, 0UL }, { 2.0, 2UL }, { 3.0, 1UL } };
+
+   MappedCompressedMatrix<double,rowMajor> A( 2UL, 3UL, offsets, elements );
+
+   blaze::DynamicVector<double> x{ 1.0, 2.0, 3.0 };
+   blaze::DynamicVector<double> y( A * x );
+   \endcode
+
+// The MappedCompressedMatrix does not copy the given arrays. Optionally, the ownership of the
+// external storage can be shared with the matrix by means of a \c std::shared_ptr, which keeps
+// the storage alive as long as any copy of the matrix exists. Since the external storage is not
+// modified, the MappedCompressedMatrix can only be used on the right-hand side of assignments.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class MappedCompressedMatrix : public SparseMatrix< MappedCompressedMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedCompressedMatrix<Type,SO>  This;            //!< Type of this MappedCompressedMatrix instance.
+   typedef SparseMatrix<This,SO>            BaseType;        //!< Base type of this MappedCompressedMatrix instance.
+   typedef CompressedMatrix<Type,SO>        ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>       OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>       TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                      Reference;       //!< Reference to a constant matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant matrix value.
+   typedef ValueIndexPair<Type>             Element;         //!< Value-index-pair of the external storage.
+   typedef const Element*                   Iterator;        //!< Iterator over constant elements.
+   typedef const Element*                   ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedCompressedMatrix() noexcept;
+   explicit inline MappedCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                           const Element* elements );
+   explicit inline MappedCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                           const Element* elements, std::shared_ptr<const void> owner );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t m, size_t n, const size_t* offsets, const Element* elements );
+   inline void   reset( size_t m, size_t n, const size_t* offsets, const Element* elements,
+                        std::shared_ptr<const void> owner );
+   inline void   swap( MappedCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lines() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                            //!< The number of rows of the matrix.
+   size_t n_;                            //!< The number of columns of the matrix.
+   const size_t* offsets_;               //!< The offsets of the rows/columns.
+   const Element* elements_;             //!< The non-zero elements of the matrix.
+   std::shared_ptr<const void> owner_;  //!< The optional owner of the external storage.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type MappedCompressedMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedCompressedMatrix<Type,SO>::MappedCompressedMatrix() noexcept
+   : m_       ( 0UL )      // The number of rows of the matrix
+   , n_       ( 0UL )      // The number of columns of the matrix
+   , offsets_ ( nullptr )  // The offsets of the rows/columns
+   , elements_( nullptr )  // The non-zero elements of the matrix
+   , owner_   ()           // The optional owner of the external storage
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix on top of the given external storage.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ L+1 \f$ row (or column) offsets.
+// \param elements The array of non-zero elements.
+// \exception std::invalid_argument Invalid array of offsets.
+//
+// This constructor creates a matrix on top of the given external storage. The matrix does not
+// take responsibility for the given arrays, which have to outlive the matrix and all its copies.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedCompressedMatrix<Type,SO>::MappedCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                                                const Element* elements )
+   : MappedCompressedMatrix( m, n, offsets, elements, std::shared_ptr<const void>() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix on top of the given, shared external storage.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ L+1 \f$ row (or column) offsets.
+// \param elements The array of non-zero elements.
+// \param owner The owner of the external storage.
+// \exception std::invalid_argument Invalid array of offsets.
+//
+// This constructor creates a matrix on top of the given external storage. The matrix shares
+// the ownership of the storage with the given \a owner, i.e. the storage is kept alive until
+// the last copy of the matrix is destroyed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedCompressedMatrix<Type,SO>::MappedCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                                                const Element* elements,
+                                                                std::shared_ptr<const void> owner )
+   : m_       ( m )                   // The number of rows of the matrix
+   , n_       ( n )                   // The number of columns of the matrix
+   , offsets_ ( offsets )             // The offsets of the rows/columns
+   , elements_( elements )            // The non-zero elements of the matrix
+   , owner_   ( std::move( owner ) )  // The optional owner of the external storage
+{
+   if( offsets_ == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of offsets" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstReference
+   MappedCompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstReference
+   MappedCompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return elements_ + offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return elements_ + offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::nonZeros() const noexcept
+{
+   return ( offsets_ != nullptr )?( offsets_[lines()] - offsets_[0UL] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix to the default initial state.
+//
+// \return void
+//
+// This function resets the matrix to a \f$ 0 \times 0 \f$ matrix and releases the shared
+// ownership of the external storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedCompressedMatrix<Type,SO>::reset()
+{
+   MappedCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix and replaces the external storage.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ L+1 \f$ row (or column) offsets.
+// \param elements The array of non-zero elements.
+// \return void
+// \exception std::invalid_argument Invalid array of offsets.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedCompressedMatrix<Type,SO>::reset( size_t m, size_t n, const size_t* offsets,
+                                                    const Element* elements )
+{
+   MappedCompressedMatrix tmp( m, n, offsets, elements );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix and replaces the shared external storage.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ L+1 \f$ row (or column) offsets.
+// \param elements The array of non-zero elements.
+// \param owner The owner of the external storage.
+// \return void
+// \exception std::invalid_argument Invalid array of offsets.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedCompressedMatrix<Type,SO>::reset( size_t m, size_t n, const size_t* offsets,
+                                                    const Element* elements,
+                                                    std::shared_ptr<const void> owner )
+{
+   MappedCompressedMatrix tmp( m, n, offsets, elements, std::move( owner ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedCompressedMatrix<Type,SO>::swap( MappedCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( elements_, sm.elements_ );
+   owner_.swap( sm.owner_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns of the external storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedCompressedMatrix<Type,SO>::lines() const noexcept
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element at position (\a i,\a j). In case the element
+// is found, the function returns an row/column iterator to the element. Otherwise an iterator
+// just past the last non-zero element of row \a i or column \a j (the end() iterator) is
+// returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   return std::lower_bound( begin( line ), end( line ), index,
+                            []( const Element& element, size_t idx )
+                            {
+                               return element.index() < idx;
+                            } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedCompressedMatrix<Type,SO>::ConstIterator
+   MappedCompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   return std::upper_bound( begin( line ), end( line ), index,
+                            []( size_t idx, const Element& element )
+                            {
+                               return idx < element.index();
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool MappedCompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedCompressedMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( MappedCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void clear( MappedCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( MappedCompressedMatrix<Type,SO>& a, MappedCompressedMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given mapped compressed matrix.
+// \ingroup mapped_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( MappedCompressedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given mapped compressed matrix.
+// \ingroup mapped_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( MappedCompressedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two mapped compressed matrices.
+// \ingroup mapped_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( MappedCompressedMatrix<Type,SO>& a, MappedCompressedMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< MappedCompressedMatrix<T1,SO> >
+{
+   using Type = CompressedMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< MappedCompressedMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< MappedCompressedMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1723 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a sparse matrix in the SELL-C-sigma storage format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSpMultKernels.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-optimized row-major sparse matrix in the SELL-C-sigma storage format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template represents a row-major sparse matrix that is optimized for
+// repeated sparse matrix/dense vector multiplications, as they for instance occur in iterative
+// solvers. In contrast to the CompressedMatrix class template, which stores the non-zero
+// elements of each row as an array of value-index pairs, the SellMatrix stores the values
+// and the column indices in two separate arrays in the SELL-C-\f$ \sigma \f$ format:
+//
+//  - The rows of the matrix are grouped into slices of \a C consecutive rows, where \a C is the
+//    number of values packed into a single SIMD vector of the element type (or 1 in case the
+//    element type cannot be vectorized).
+//  - The elements of a slice are stored column by column, i.e. the k-th non-zero elements of
+//    all \a C rows of the slice are stored contiguously and can be processed by a single SIMD
+//    operation. The slice is padded to the length of its longest row.
+//  - Within a sorting window of \f$ \sigma \f$ rows the rows are sorted by their number of
+//    non-zero elements, which keeps the padding small for matrices with varying row lengths.
+//
+// The type of the elements can be specified via the template parameter:
+
+   \code
+   template< typename Type >
+   class SellMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SellMatrix can be used with any non-cv-
+//          qualified, non-reference, non-pointer element type.
+//
+// A SellMatrix is created from any other matrix and can afterwards only be used on the right-hand
+// side of assignments. All multiplications of a SellMatrix with a dense vector or dense matrix
+// with the same element type are evaluated by the specialized spmv() and spmm() kernels, which
+// in case of single and double precision elements use SIMD gather operations for the access to
+// the vector:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SellMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double,rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   const SellMatrix<double> S( A );   // Conversion into the SELL-C-sigma format
+   DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = S * x;                 // Evaluated by means of spmv( y, S, x, 1.0, 0.0 )
+   y += S * x;                // Evaluated by means of spmv( y, S, x, 1.0, 1.0 )
+   spmv( y, S, x, 2.0, 3.0 ); // y = 2 * S * x + 3 * y
+   \endcode
+
+// The column indices are stored as 32-bit integers. Therefore the number of columns of a
+// SellMatrix is restricted to \f$ 2^{31}-1 \f$.
+*/
+template< typename Type >  // Data type of the matrix
+class SellMatrix : public SparseMatrix< SellMatrix<Type>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SellMatrix<Type>                    This;            //!< Type of this SellMatrix instance.
+   typedef SparseMatrix<This,rowMajor>         BaseType;        //!< Base type of this SellMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>     ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;       //!< Reference to a constant matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant matrix value.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the SellMatrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>       Element;           //!< Element type of the sparse matrix.
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the current value.
+      // \param index Pointer to the current column index.
+      */
+      inline ConstIterator( const Type* value, const uint32_t* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         value_ += SLICE;
+         index_ += SLICE;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ConstReference value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( value_ - rhs.value_ ) / DifferenceType( SLICE );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*     value_;  //!< Pointer to the current value.
+      const uint32_t* index_;  //!< Pointer to the current column index.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SellMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline SellMatrix( const Matrix<MT,SO>& m, size_t sigma = 128UL );
+
+   inline SellMatrix( const SellMatrix& sm );
+   inline SellMatrix( SellMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SellMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SellMatrix& operator=( const SellMatrix& rhs );
+   inline SellMatrix& operator=( SellMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO > inline SellMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t sliceHeight() const noexcept;
+   inline size_t sigma() const noexcept;
+   inline void   reset();
+   inline void   swap( SellMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Kernel functions */
+   //@{
+   template< typename VT1, typename VT2, typename ST >
+   void mult( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x, ST alpha, ST beta ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2, typename ST >
+   void mult( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta ) const;
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   //! Compilation switch for the vectorized, gather based matrix/vector multiplication kernel.
+   enum : bool { vectorizable = ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                                HasSIMDAdd<Type,Type>::value &&
+                                HasSIMDMult<Type,Type>::value };
+
+   //! Compilation switch for the vectorized matrix/matrix multiplication kernel.
+   enum : bool { paddedVectorizable = usePadding &&
+                                      IsVectorizable<Type>::value &&
+                                      HasSIMDAdd<Type,Type>::value &&
+                                      HasSIMDMult<Type,Type>::value };
+
+   //! The number of rows per slice.
+   enum : size_t { SLICE = ( vectorizable ? SIMDSIZE : 1UL ) };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the selection of the direct multiplication kernel.
+   /*! The DirectMult struct is a helper struct for the selection of the multiplication kernel.
+       In case both vectors provide direct access to their contiguous elements of type \a Type,
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT1, typename VT2 >
+   struct DirectMult {
+      enum : bool { value = HasMutableDataAccess<VT1>::value && !IsExpression<VT1>::value &&
+                            HasConstDataAccess<VT2>::value && !IsExpression<VT2>::value &&
+                            IsSame< ElementType_<VT1>, Type >::value &&
+                            IsSame< ElementType_<VT2>, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t offset( size_t pos ) const noexcept;
+
+   template< typename VT1, typename VT2, typename ST >
+   inline EnableIf_< DirectMult<VT1,VT2> >
+      multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const;
+
+   template< typename VT1, typename VT2, typename ST >
+   inline DisableIf_< DirectMult<VT1,VT2> >
+      multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const;
+
+   template< typename ST >
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                           ST alpha, ST beta, TrueType ) const noexcept;
+
+   template< typename ST >
+   inline void multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                           ST alpha, ST beta, FalseType ) const noexcept;
+
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, TrueType  ) noexcept;
+   static inline void axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x, const Type& a, size_t n, FalseType ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                          //!< The number of rows of the matrix.
+   size_t n_;                          //!< The number of columns of the matrix.
+   size_t nonZeros_;                   //!< The number of non-zero elements of the matrix.
+   size_t sigma_;                      //!< The size of the sorting window.
+   size_t slices_;                     //!< The number of slices of the matrix.
+   Type* BLAZE_RESTRICT values_;       //!< The values of all slices (including the padding).
+   uint32_t* BLAZE_RESTRICT indices_;  //!< The column indices of all slices (including the padding).
+   size_t* sliceStart_;                //!< The offsets of the slices (\a slices_+1 elements).
+   size_t* rowLength_;                 //!< The number of non-zero elements per slice position.
+   size_t* perm_;                      //!< The row index stored at each slice position.
+   size_t* position_;                  //!< The slice position of each row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >
+const Type SellMatrix<Type>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::SellMatrix() noexcept
+   : m_         ( 0UL )      // The number of rows of the matrix
+   , n_         ( 0UL )      // The number of columns of the matrix
+   , nonZeros_  ( 0UL )      // The number of non-zero elements of the matrix
+   , sigma_     ( SLICE )    // The size of the sorting window
+   , slices_    ( 0UL )      // The number of slices of the matrix
+   , values_    ( nullptr )  // The values of all slices
+   , indices_   ( nullptr )  // The column indices of all slices
+   , sliceStart_( nullptr )  // The offsets of the slices
+   , rowLength_ ( nullptr )  // The number of non-zero elements per slice position
+   , perm_      ( nullptr )  // The row index stored at each slice position
+   , position_  ( nullptr )  // The slice position of each row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into the SELL-C-sigma format.
+// \param sigma The size of the sorting window (rounded up to a multiple of the slice height).
+// \exception std::invalid_argument Invalid number of columns.
+//
+// This constructor converts the given matrix into the SELL-C-sigma format. Within each window
+// of \a sigma consecutive rows, the rows are sorted by their number of non-zero elements. In
+// case the given matrix has more than \f$ 2^{31}-1 \f$ columns, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SellMatrix<Type>::SellMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : SellMatrix()
+{
+   if( (~m).columns() > 0x7FFFFFFFUL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns" );
+   }
+
+   const CompressedMatrix<Type,rowMajor> A( ~m );
+
+   m_        = A.rows();
+   n_        = A.columns();
+   nonZeros_ = A.nonZeros();
+   sigma_    = ( sigma > SLICE ) ? ( sigma + SLICE - 1UL ) - ( sigma + SLICE - 1UL ) % SLICE : SLICE;
+   slices_   = ( m_ + SLICE - 1UL ) / SLICE;
+
+   const size_t positions( slices_ * SLICE );
+
+   try {
+      sliceStart_ = allocate<size_t>( slices_ + 1UL );
+      rowLength_  = allocate<size_t>( positions );
+      perm_       = allocate<size_t>( positions );
+      position_   = allocate<size_t>( m_ );
+
+      for( size_t pos=0UL; pos<positions; ++pos ) {
+         perm_[pos] = pos;
+      }
+
+      for( size_t first=0UL; first<m_; first+=sigma_ ) {
+         std::stable_sort( perm_+first, perm_+std::min( first+sigma_, m_ ),
+                           [&A]( size_t i1, size_t i2 ) {
+                              return A.nonZeros( i1 ) > A.nonZeros( i2 );
+                           } );
+      }
+
+      sliceStart_[0UL] = 0UL;
+      for( size_t s=0UL; s<slices_; ++s ) {
+         for( size_t pos=s*SLICE; pos<(s+1UL)*SLICE; ++pos ) {
+            rowLength_[pos] = ( pos < m_ )?( A.nonZeros( perm_[pos] ) ):( 0UL );
+            if( pos < m_ ) position_[perm_[pos]] = pos;
+         }
+         sliceStart_[s+1UL] = sliceStart_[s] + rowLength_[s*SLICE] * SLICE;
+      }
+
+      values_  = allocate<Type>( sliceStart_[slices_] );
+      indices_ = allocate<uint32_t>( sliceStart_[slices_] );
+   }
+   catch( ... ) {
+      reset();
+      throw;
+   }
+
+   std::fill( values_, values_ + sliceStart_[slices_], Type() );
+   std::fill( indices_, indices_ + sliceStart_[slices_], uint32_t( 0 ) );
+
+   for( size_t pos=0UL; pos<m_; ++pos )
+   {
+      const size_t i( perm_[pos] );
+      size_t k( offset( pos ) );
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element, k+=SLICE ) {
+         values_[k]  = element->value();
+         indices_[k] = static_cast<uint32_t>( element->index() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SellMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::SellMatrix( const SellMatrix& sm )
+   : SellMatrix()
+{
+   const size_t positions( sm.slices_ * SLICE );
+
+   try {
+      sliceStart_ = allocate<size_t>( sm.slices_ + 1UL );
+      rowLength_  = allocate<size_t>( positions );
+      perm_       = allocate<size_t>( positions );
+      position_   = allocate<size_t>( sm.m_ );
+      values_     = allocate<Type>( sm.sliceStart_[sm.slices_] );
+      indices_    = allocate<uint32_t>( sm.sliceStart_[sm.slices_] );
+   }
+   catch( ... ) {
+      reset();
+      throw;
+   }
+
+   m_        = sm.m_;
+   n_        = sm.n_;
+   nonZeros_ = sm.nonZeros_;
+   sigma_    = sm.sigma_;
+   slices_   = sm.slices_;
+
+   std::copy( sm.sliceStart_, sm.sliceStart_ + slices_ + 1UL, sliceStart_ );
+   std::copy( sm.rowLength_, sm.rowLength_ + positions, rowLength_ );
+   std::copy( sm.perm_, sm.perm_ + positions, perm_ );
+   std::copy( sm.position_, sm.position_ + m_, position_ );
+   std::copy( sm.values_, sm.values_ + sliceStart_[slices_], values_ );
+   std::copy( sm.indices_, sm.indices_ + sliceStart_[slices_], indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SellMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::SellMatrix( SellMatrix&& sm ) noexcept
+   : SellMatrix()
+{
+   swap( sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SellMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::~SellMatrix()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   deallocate( sliceStart_ );
+   deallocate( rowLength_ );
+   deallocate( perm_ );
+   deallocate( position_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstReference
+   SellMatrix<Type>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstReference
+   SellMatrix<Type>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( offset( position_[i] ) );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( position_[i] );
+   const size_t k( offset( pos ) + rowLength_[pos] * SLICE );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SellMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>& SellMatrix<Type>::operator=( const SellMatrix& rhs )
+{
+   if( &rhs != this ) {
+      SellMatrix tmp( rhs );
+      swap( tmp );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SellMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>& SellMatrix<Type>::operator=( SellMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted into the SELL-C-sigma format.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The matrix is rebuilt with the current size of the sorting window.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline SellMatrix<Type>& SellMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SellMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity includes the padding of the slices to the length of their longest row.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::capacity() const noexcept
+{
+   return ( sliceStart_ != nullptr )?( sliceStart_[slices_] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   const size_t s( position_[i] / SLICE );
+   return ( sliceStart_[s+1UL] - sliceStart_[s] ) / SLICE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return rowLength_[position_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows per slice.
+//
+// \return The slice height \a C of the SELL-C-sigma format.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::sliceHeight() const noexcept
+{
+   return SLICE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting window.
+//
+// \return The size \a sigma of the sorting window of the SELL-C-sigma format.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the matrix to the default initial state.
+//
+// \return void
+//
+// This function resets the matrix to a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::reset()
+{
+   SellMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::swap( SellMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( slices_, sm.slices_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( sliceStart_, sm.sliceStart_ );
+   std::swap( rowLength_, sm.rowLength_ );
+   std::swap( perm_, sm.perm_ );
+   std::swap( position_, sm.position_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given slice position.
+//
+// \param pos The slice position.
+// \return The offset of the first element stored at slice position \a pos.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::offset( size_t pos ) const noexcept
+{
+   return sliceStart_[pos/SLICE] + pos%SLICE;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element at position (\a i,\a j). In case the element
+// is found, the function returns an row iterator to the element. Otherwise an iterator just
+// past the last non-zero element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t pos( position_[i] );
+   const size_t k  ( offset( pos ) );
+
+   size_t first( 0UL );
+   size_t count( rowLength_[pos] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices_[k+(first+step)*SLICE] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+k+first*SLICE, indices_+k+first*SLICE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      ++pos;
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since the matrix cannot be used in SMP assignments.
+*/
+template< typename Type >  // Data type of the matrix
+inline bool SellMatrix<Type>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the matrix/vector multiplication \f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// In case both vectors provide direct access to their elements, the kernel operates directly on
+// the given vectors. Otherwise the vectors are copied into temporary vectors.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename ST >    // Type of the scaling factors
+void SellMatrix<Type>::mult( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                             ST alpha, ST beta ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~y).size() == m_, "Invalid vector size" );
+
+   multDispatch( ~y, ~x, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the matrix/matrix multiplication \f$ C=\alpha*A*B+\beta*C \f$.
+//
+// \param C The target left-hand side dense matrix.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// Every stored element of the matrix is read exactly once and scales a complete row of \a B,
+// i.e. the kernel is vectorized along the rows of row-major copies of \a B and \a C.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT1     // Type of the left-hand side target matrix
+        , bool SO1         // Storage order of the left-hand side target matrix
+        , typename MT2     // Type of the right-hand side matrix operand
+        , bool SO2         // Storage order of the right-hand side matrix operand
+        , typename ST >    // Type of the scaling factors
+void SellMatrix<Type>::mult( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B,
+                             ST alpha, ST beta ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~B).rows() == n_, "Invalid number of rows" );
+
+   const DynamicMatrix<Type,rowMajor> tB( ~B );
+   DynamicMatrix<Type,rowMajor> tC( m_, tB.columns(), Type() );
+
+   const size_t N( paddedVectorizable ? tB.spacing() : tB.columns() );
+
+   for( size_t pos=0UL; pos<m_; ++pos )
+   {
+      const size_t i( perm_[pos] );
+      const size_t k( offset( pos ) );
+
+      for( size_t l=0UL; l<rowLength_[pos]; ++l ) {
+         axpy( tC.data(i), tB.data( indices_[k+l*SLICE] ), values_[k+l*SLICE],
+               N, BoolConstant<paddedVectorizable>() );
+      }
+   }
+
+   for( size_t i=0UL; i<tC.rows(); ++i ) {
+      for( size_t j=tC.columns(); j<tC.spacing(); ++j ) {
+         tC.data(i)[j] = Type();
+      }
+   }
+
+   if( isDefault( beta ) )
+      (~C) = alpha * tC;
+   else
+      (~C) = alpha * tC + beta * (~C);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication directly on the elements of the given vectors.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename ST >    // Type of the scaling factors
+inline EnableIf_< typename SellMatrix<Type>::template DirectMult<VT1,VT2> >
+   SellMatrix<Type>::multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const
+{
+   if( x.canAlias( &y ) ) {
+      const DynamicVector<Type,false> tmp( x );
+      multKernel( y.data(), tmp.data(), alpha, beta, BoolConstant<vectorizable>() );
+   }
+   else {
+      multKernel( y.data(), x.data(), alpha, beta, BoolConstant<vectorizable>() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication by means of temporary vectors.
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT1     // Type of the left-hand side target vector
+        , typename VT2     // Type of the right-hand side vector operand
+        , typename ST >    // Type of the scaling factors
+inline DisableIf_< typename SellMatrix<Type>::template DirectMult<VT1,VT2> >
+   SellMatrix<Type>::multDispatch( VT1& y, const VT2& x, ST alpha, ST beta ) const
+{
+   const DynamicVector<Type,false> tx( x );
+   DynamicVector<Type,false> ty( m_, Type() );
+
+   multKernel( ty.data(), tx.data(), ST(1), ST(0), BoolConstant<vectorizable>() );
+
+   if( isDefault( beta ) )
+      y = alpha * ty;
+   else
+      y = alpha * ty + beta * y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the matrix/vector multiplication.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// The first elements of all rows of a slice, up to the length of the shortest row of the slice,
+// are processed by means of aligned SIMD loads of the values and SIMD gathers of the according
+// elements of \a x. The remaining elements of the longer rows are processed row by row, which
+// guarantees that the padding of the slices is never accessed. In case \a beta is zero, the
+// target vector is not read.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename ST >    // Type of the scaling factors
+inline void SellMatrix<Type>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                          ST alpha, ST beta, TrueType ) const noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const bool scale( !isDefault( beta ) );
+
+   for( size_t s=0UL; s<slices_; ++s )
+   {
+      const size_t begin( s*SLICE );
+      const size_t kmin ( rowLength_[begin+SLICE-1UL] );
+      const Type*     BLAZE_RESTRICT v  ( values_  + sliceStart_[s] );
+      const uint32_t* BLAZE_RESTRICT idx( indices_ + sliceStart_[s] );
+
+      SIMDType xmm;
+
+      for( size_t k=0UL; k<kmin; ++k ) {
+         xmm = xmm + loada( v+k*SLICE ) * gather( x, idx+k*SLICE );
+      }
+
+      for( size_t r=0UL; r<SLICE && begin+r<m_; ++r )
+      {
+         Type tmp( xmm[r] );
+
+         for( size_t k=kmin; k<rowLength_[begin+r]; ++k ) {
+            tmp += v[k*SLICE+r] * x[idx[k*SLICE+r]];
+         }
+
+         Type& target( y[perm_[begin+r]] );
+         target = ( scale )?( alpha * tmp + beta * target ):( alpha * tmp );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the matrix/vector multiplication.
+//
+// \param y Pointer to the first element of the target vector.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// In case \a beta is zero, the target vector is not read.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename ST >    // Type of the scaling factors
+inline void SellMatrix<Type>::multKernel( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                          ST alpha, ST beta, FalseType ) const noexcept
+{
+   const bool scale( !isDefault( beta ) );
+
+   for( size_t pos=0UL; pos<m_; ++pos )
+   {
+      const size_t k( offset( pos ) );
+
+      Type tmp = Type();
+
+      for( size_t l=0UL; l<rowLength_[pos]; ++l ) {
+         tmp += values_[k+l*SLICE] * x[indices_[k+l*SLICE]];
+      }
+
+      Type& target( y[perm_[pos]] );
+      target = ( scale )?( alpha * tmp + beta * target ):( alpha * tmp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized update \f$ \vec{y} += a \vec{x} \f$ of an aligned, zero padded array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements including the padding (a multiple of the SIMD width).
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                    const Type& a, size_t n, TrueType ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   const SIMDType factor( set( a ) );
+
+   for( size_t l=0UL; l<n; l+=SIMDSIZE ) {
+      storea( y+l, loada( y+l ) + loada( x+l ) * factor );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default update \f$ \vec{y} += a \vec{x} \f$ of an array.
+//
+// \param y Pointer to the first element of the target array.
+// \param x Pointer to the first element of the right-hand side array.
+// \param a The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::axpy( Type* BLAZE_RESTRICT y, const Type* BLAZE_RESTRICT x,
+                                    const Type& a, size_t n, FalseType ) noexcept
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      y[l] += x[l] * a;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type >
+inline void reset( SellMatrix<Type>& m );
+
+template< typename Type >
+inline void clear( SellMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) noexcept;
+
+template< typename VT1, typename Type, typename VT2, typename ST >
+void spmv( DenseVector<VT1,false>& y, const SellMatrix<Type>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta );
+
+template< typename MT1, bool SO1, typename Type, typename MT2, bool SO2, typename ST >
+void spmm( DenseMatrix<MT1,SO1>& C, const SellMatrix<Type>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given SELL-C-sigma matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void reset( SellMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given SELL-C-sigma matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void clear( SellMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two SELL-C-sigma matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SELL-C-sigma matrix/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function performs the multiplication of a SELL-C-sigma matrix with a dense vector. Every
+// stored element of the matrix is read exactly once. In case \a beta is zero, the target vector
+// is not read and resized to the number of rows of \a A if necessary.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the matrix
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void spmv( DenseVector<VT1,false>& y, const SellMatrix<Type>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~x).size() != A.columns() || ( !isDefault( beta ) && (~y).size() != A.rows() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~y, A.rows(), false );
+
+   A.mult( ~y, ~x, alpha, beta );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SELL-C-sigma matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup sell_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the multiplication of a SELL-C-sigma matrix with a dense matrix. Every
+// stored element of the matrix is read exactly once and scales a complete row of \a B. In case
+// \a beta is zero, the target matrix is not read and resized if necessary.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename Type  // Data type of the SELL-C-sigma matrix
+        , typename MT2   // Type of the right-hand side matrix operand
+        , bool SO2       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void spmm( DenseMatrix<MT1,SO1>& C, const SellMatrix<Type>& A,
+           const DenseMatrix<MT2,SO2>& B, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != A.columns() ||
+       ( !isDefault( beta ) && ( (~C).rows() != A.rows() || (~C).columns() != (~B).columns() ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   A.mult( ~C, ~B, alpha, beta );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASSPMULTKERNELS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct HasSpMultKernels< SellMatrix<T> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< SellMatrix<T1> >
+{
+   using Type = CompressedMatrix<T1,rowMajor>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< SellMatrix<T1> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< SellMatrix<T1> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,464 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpAssign.h
+//  \brief Header file for the partitioned assignment to sparse matrices and vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPASSIGN_H_
+#define _BLAZE_MATH_SPARSE_SPASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARTITIONED SPARSE MATRIX ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for the partitioned assignment of a matrix to a sparse matrix.
+// \ingroup sparse_matrix
+//
+// This type trait tests whether the lines of the given sparse matrix type \a MT1 can be filled
+// independently of each other by the symbolic and numeric passes of the partitioned assignment
+// of the given matrix type \a MT2. This is the case for dense matrices and for sparse matrices
+// with the same storage order (i.e. that provide iterators over the elements of each line) that
+// are not computations. Since both passes access the elements of the right-hand side matrix,
+// the elements of a computation would be evaluated twice and without the optimized kernels of
+// the computation. In this case, the \a value member constant is set to \a true, the
+// nested type definition \a Type is \a TrueType, and the class derives from \a TrueType.
+// Otherwise \a value is set to \a false, \a Type is \a FalseType, and the class derives from
+// \a FalseType.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+struct IsSpassignPartitionable
+   : public BoolConstant< !IsComputation<MT2>::value &&
+                          ( IsDenseMatrix<MT2>::value ||
+                            IsRowMajorMatrix<MT1>::value == IsRowMajorMatrix<MT2>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of the assignment of a dense matrix to a sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The right-hand side dense matrix.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \return The number of non-zero elements of the given lines of the target matrix.
+//
+// The lines of a row-major target matrix are its rows, the lines of a column-major target
+// matrix are its columns. The function does not modify the target matrix.
+*/
+template< typename MT1  // Type of the target sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline size_t spassignSymbolic( const SparseMatrix<MT1,false>& C, const DenseMatrix<MT2,SO2>& A,
+                                size_t begin, size_t end )
+{
+   UNUSED_PARAMETER( C );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=begin; i<end; ++i ) {
+      for( size_t j=0UL; j<(~A).columns(); ++j ) {
+         if( !isDefault( (~A)(i,j) ) )
+            ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+
+template< typename MT1  // Type of the target sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline size_t spassignSymbolic( const SparseMatrix<MT1,true>& C, const DenseMatrix<MT2,SO2>& A,
+                                size_t begin, size_t end )
+{
+   UNUSED_PARAMETER( C );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=begin; j<end; ++j ) {
+      for( size_t i=0UL; i<(~A).rows(); ++i ) {
+         if( !isDefault( (~A)(i,j) ) )
+            ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of the assignment of a sparse matrix to a sparse matrix with the same
+//        storage order.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The right-hand side sparse matrix.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \return The number of non-zero elements of the given lines of the target matrix.
+//
+// The number of non-zero elements is determined by traversing the given lines of the sparse
+// matrix without evaluating the values of its elements. The function does not modify the
+// target matrix.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of both sparse matrices
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline size_t spassignSymbolic( const SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& A,
+                                size_t begin, size_t end )
+{
+   typedef ConstIterator_<MT2>  ConstIterator;
+
+   UNUSED_PARAMETER( C );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=begin; i<end; ++i ) {
+      const ConstIterator lineEnd( (~A).end(i) );
+      for( ConstIterator element=(~A).begin(i); element!=lineEnd; ++element )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of the assignment of a dense matrix to a sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The right-hand side dense matrix.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \param last \a true in case the last line of the range has to be finalized, \a false if not.
+// \return void
+//
+// The non-zero elements of the given lines are appended to the target matrix, which requires
+// the capacity determined by the according symbolic pass to be reserved for the first line.
+*/
+template< typename MT1  // Type of the target sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void spassignNumeric( SparseMatrix<MT1,false>& C, const DenseMatrix<MT2,SO2>& A,
+                             size_t begin, size_t end, bool last )
+{
+   typedef ElementType_<MT2>  ElementType;
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      for( size_t j=0UL; j<(~A).columns(); ++j ) {
+         const ElementType value( (~A)(i,j) );
+         if( !isDefault( value ) )
+            (~C).append( i, j, value );
+      }
+
+      if( last || i+1UL < end ) {
+         (~C).finalize( i );
+      }
+   }
+}
+
+template< typename MT1  // Type of the target sparse matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline void spassignNumeric( SparseMatrix<MT1,true>& C, const DenseMatrix<MT2,SO2>& A,
+                             size_t begin, size_t end, bool last )
+{
+   typedef ElementType_<MT2>  ElementType;
+
+   for( size_t j=begin; j<end; ++j )
+   {
+      for( size_t i=0UL; i<(~A).rows(); ++i ) {
+         const ElementType value( (~A)(i,j) );
+         if( !isDefault( value ) )
+            (~C).append( i, j, value );
+      }
+
+      if( last || j+1UL < end ) {
+         (~C).finalize( j );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of the assignment of a sparse matrix to a sparse matrix with the same
+//        storage order.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The right-hand side sparse matrix.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \param last \a true in case the last line of the range has to be finalized, \a false if not.
+// \return void
+//
+// The elements of the given lines are appended to the target matrix, which requires the
+// capacity determined by the according symbolic pass to be reserved for the first line.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void spassignNumeric( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& A,
+                             size_t begin, size_t end, bool last )
+{
+   typedef ConstIterator_<MT2>  ConstIterator;
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const ConstIterator lineEnd( (~A).end(i) );
+      for( ConstIterator element=(~A).begin(i); element!=lineEnd; ++element )
+         (~C).append( i, element->index(), element->value() );
+
+      if( last || i+1UL < end ) {
+         (~C).finalize( i );
+      }
+   }
+}
+
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void spassignNumeric( SparseMatrix<MT1,true>& C, const SparseMatrix<MT2,true>& A,
+                             size_t begin, size_t end, bool last )
+{
+   typedef ConstIterator_<MT2>  ConstIterator;
+
+   for( size_t j=begin; j<end; ++j )
+   {
+      const ConstIterator lineEnd( (~A).end(j) );
+      for( ConstIterator element=(~A).begin(j); element!=lineEnd; ++element )
+         (~C).append( element->index(), j, element->value() );
+
+      if( last || j+1UL < end ) {
+         (~C).finalize( j );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARTITIONED SPARSE VECTOR ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of the assignment of a dense vector to a sparse vector.
+// \ingroup sparse_vector
+//
+// \param x The target sparse vector.
+// \param y The right-hand side dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index of one past the last element of the range.
+// \return The number of non-zero elements of the given range of the target vector.
+//
+// The function does not modify the target vector.
+*/
+template< typename VT1  // Type of the target sparse vector
+        , bool TF1      // Transpose flag of the target sparse vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline size_t spassignSymbolic( const SparseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y,
+                                size_t begin, size_t end )
+{
+   UNUSED_PARAMETER( x );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=begin; i<end; ++i ) {
+      if( !isDefault( (~y)[i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of the assignment of a sparse vector to a sparse vector.
+// \ingroup sparse_vector
+//
+// \param x The target sparse vector.
+// \param y The right-hand side sparse vector.
+// \param begin The index of the first element of the range.
+// \param end The index of one past the last element of the range.
+// \return The number of non-zero elements of the given range of the target vector.
+//
+// The number of non-zero elements is determined by traversing the given range of the sparse
+// vector without evaluating the values of its elements. The function does not modify the
+// target vector.
+*/
+template< typename VT1  // Type of the target sparse vector
+        , bool TF1      // Transpose flag of the target sparse vector
+        , typename VT2  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline size_t spassignSymbolic( const SparseVector<VT1,TF1>& x, const SparseVector<VT2,TF2>& y,
+                                size_t begin, size_t end )
+{
+   typedef ConstIterator_<VT2>  ConstIterator;
+
+   UNUSED_PARAMETER( x );
+
+   size_t nonzeros( 0UL );
+
+   const ConstIterator last( (~y).end() );
+   ConstIterator element( (~y).lowerBound( begin ) );
+
+   for( ; element!=last && element->index()<end; ++element )
+      ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of the assignment of a dense vector to a sparse vector.
+// \ingroup sparse_vector
+//
+// \param x The target sparse vector.
+// \param y The right-hand side dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index of one past the last element of the range.
+// \param pos The position of the first non-zero element of the range in the target vector.
+// \return void
+//
+// The non-zero elements of the given range are written to the internal element array of the
+// target vector via the appendAt() function, starting at position \a pos. This requires the
+// capacity determined by the symbolic passes of all ranges to be reserved in the target vector.
+// The elements are added to the target vector by a subsequent call to the finalize() function.
+*/
+template< typename VT1  // Type of the target sparse vector
+        , bool TF1      // Transpose flag of the target sparse vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline void spassignNumeric( SparseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y,
+                             size_t begin, size_t end, size_t pos )
+{
+   typedef ElementType_<VT2>  ElementType;
+
+   for( size_t i=begin; i<end; ++i ) {
+      const ElementType value( (~y)[i] );
+      if( !isDefault( value ) )
+         (~x).appendAt( pos++, i, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of the assignment of a sparse vector to a sparse vector.
+// \ingroup sparse_vector
+//
+// \param x The target sparse vector.
+// \param y The right-hand side sparse vector.
+// \param begin The index of the first element of the range.
+// \param end The index of one past the last element of the range.
+// \param pos The position of the first non-zero element of the range in the target vector.
+// \return void
+//
+// The elements of the given range are written to the internal element array of the target
+// vector via the appendAt() function, starting at position \a pos. This requires the capacity
+// determined by the symbolic passes of all ranges to be reserved in the target vector. The
+// elements are added to the target vector by a subsequent call to the finalize() function.
+*/
+template< typename VT1  // Type of the target sparse vector
+        , bool TF1      // Transpose flag of the target sparse vector
+        , typename VT2  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline void spassignNumeric( SparseVector<VT1,TF1>& x, const SparseVector<VT2,TF2>& y,
+                             size_t begin, size_t end, size_t pos )
+{
+   typedef ConstIterator_<VT2>  ConstIterator;
+
+   const ConstIterator last( (~y).end() );
+   ConstIterator element( (~y).lowerBound( begin ) );
+
+   for( ; element!=last && element->index()<end; ++element )
+      (~x).appendAt( pos++, element->index(), element->value() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
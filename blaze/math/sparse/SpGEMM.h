@@ -0,0 +1,815 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMM.h
+//  \brief Header file for the sparse matrix multiplication engine
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX MULTIPLICATION ENGINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scratch memory of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// This auxiliary class template represents the accumulators of the sparse matrix multiplication
+// engine. Each line of the target matrix is accumulated either in a dense sparse accumulator
+// (SPA), which is indexed by the column index of the result and uses generation stamps in
+// order to avoid a reset after every line, or in an open addressing hash table, whose size is
+// proportional to the number of scalar products of the line. In both cases the memory is kept
+// between consecutive lines and consecutive multiplications of the same thread.
+*/
+template< typename T >  // Type of the accumulated values
+struct SpGEMMWorkspace : private NonCopyable
+{
+   //**********************************************************************************************
+   enum : size_t { unused = ~size_t( 0UL ) };  //!< Key of an unused hash table entry.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor for SpGEMMWorkspace.
+   */
+   inline SpGEMMWorkspace()
+      : stamps_ ()     // Generation stamps of the dense accumulator
+      , keys_   ()     // Keys of the hash accumulator
+      , values_ ()     // Values of the dense and the hash accumulator
+      , indices_()     // Indices of the occupied accumulator entries
+      , stamp_  ( 0UL )  // The current generation stamp
+   {}
+   //**********************************************************************************************
+
+   //**Dense accumulator function******************************************************************
+   /*!\brief Prepares the dense accumulator for a line of the given length.
+   //
+   // \param n The length of the line of the target matrix.
+   // \param products The number of scalar products of the line.
+   // \return The generation stamp of the line.
+   */
+   inline size_t dense( size_t n, size_t products )
+   {
+      if( stamps_.size() < n ) {
+         stamps_.resize( n, 0UL );
+         values_.resize( max( values_.size(), n ) );
+      }
+
+      if( indices_.size() < min( products, n ) ) {
+         indices_.resize( min( products, n ) );
+      }
+
+      if( ++stamp_ == 0UL ) {
+         std::fill( stamps_.begin(), stamps_.end(), 0UL );
+         stamp_ = 1UL;
+      }
+
+      return stamp_;
+   }
+   //**********************************************************************************************
+
+   //**Hash accumulator function*******************************************************************
+   /*!\brief Prepares the hash accumulator for the given number of scalar products.
+   //
+   // \param products The number of scalar products of the line.
+   // \return The bit mask for the hash table indices.
+   //
+   // The size of the hash table is the smallest power of two that is at least twice as large
+   // as the number of scalar products, which limits the load factor of the table to 0.5.
+   */
+   inline size_t hash( size_t products )
+   {
+      size_t capacity( 16UL );
+
+      while( capacity < products + products ) {
+         capacity <<= 1;
+      }
+
+      if( keys_.size() < capacity ) {
+         keys_.resize( capacity, unused );
+         values_.resize( max( values_.size(), capacity ) );
+      }
+
+      if( indices_.size() < products ) {
+         indices_.resize( products );
+      }
+
+      return capacity - 1UL;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<size_t> stamps_;   //!< Generation stamps of the dense accumulator.
+   std::vector<size_t> keys_;     //!< Keys of the hash accumulator.
+   std::vector<T>      values_;   //!< Values of the dense and the hash accumulator.
+   std::vector<size_t> indices_;  //!< Indices of the occupied accumulator entries.
+   size_t              stamp_;    //!< The current generation stamp.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the scratch memory of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// \return Reference to the workspace of the calling thread.
+//
+// Every thread owns a separate workspace for every type of accumulated values. The workspace
+// is reused by all sparse matrix multiplications performed by the thread.
+*/
+template< typename T >  // Type of the accumulated values
+inline SpGEMMWorkspace<T>& spgemmWorkspace()
+{
+   static thread_local SpGEMMWorkspace<T> workspace;
+   return workspace;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the accumulator for a line of the target matrix.
+// \ingroup sparse_matrix
+//
+// \param products The number of scalar products of the line.
+// \param n The length of the line of the target matrix.
+// \return \a true in case the hash accumulator is used, \a false if the dense accumulator is used.
+//
+// Sparse lines are accumulated in a small hash table that fits into the cache, whereas dense
+// lines, which touch a considerable part of the line of the target matrix, are accumulated in
+// the dense accumulator.
+*/
+inline bool spgemmUseHash( size_t products, size_t n )
+{
+   return products * 16UL < n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the number of scalar products of a line of the target matrix.
+// \ingroup sparse_matrix
+//
+// \param X The outer sparse matrix operand.
+// \param Y The inner sparse matrix operand.
+// \param i The index of the line.
+// \return The number of scalar products of the line.
+//
+// The number of scalar products is an upper bound for the number of non-zero elements of the
+// line of the target matrix.
+*/
+template< typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+inline size_t spgemmProducts( const MT1& X, const MT2& Y, size_t i )
+{
+   typedef ConstIterator_<MT1>  ConstIterator;
+
+   size_t products( 0UL );
+
+   const ConstIterator end( X.end(i) );
+   for( ConstIterator element=X.begin(i); element!=end; ++element ) {
+      products += Y.nonZeros( element->index() );
+   }
+
+   return products;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar product of an element of the left-hand side and the right-hand side operand.
+// \ingroup sparse_matrix
+//
+// \param x The element of the outer sparse matrix operand.
+// \param y The element of the inner sparse matrix operand.
+// \return The scalar product in the order of the multiplication.
+//
+// For row-major target matrices the outer operand is the left-hand side operand (\f$ x*y \f$),
+// for column-major target matrices it is the right-hand side operand (\f$ y*x \f$).
+*/
+template< typename T1, typename T2 >
+inline auto spgemmMult( const T1& x, const T2& y, FalseType ) -> decltype( x * y )
+{
+   return x * y;
+}
+
+template< typename T1, typename T2 >
+inline auto spgemmMult( const T1& x, const T2& y, TrueType ) -> decltype( y * x )
+{
+   return y * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending an element to a line of a row-major or column-major target matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param i The index of the line.
+// \param j The index of the element within the line.
+// \param value The value of the element.
+// \return void
+*/
+template< typename MT    // Type of the target sparse matrix
+        , typename T >   // Type of the value
+inline void spgemmAppend( SparseMatrix<MT,false>& C, size_t i, size_t j, const T& value )
+{
+   (~C).append( i, j, value );
+}
+
+template< typename MT    // Type of the target sparse matrix
+        , typename T >   // Type of the value
+inline void spgemmAppend( SparseMatrix<MT,true>& C, size_t i, size_t j, const T& value )
+{
+   (~C).append( j, i, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic kernel of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// \param X The outer sparse matrix operand.
+// \param Y The inner sparse matrix operand.
+// \param n The length of the lines of the target matrix.
+// \param begin The index of the first line.
+// \param end The index of one past the last line.
+// \return The number of non-zero elements of the given lines of the target matrix.
+//
+// This function determines the exact number of non-zero elements of the lines in the range
+// \f$ [begin..end) \f$ of the target matrix, without computing any of the values.
+*/
+template< typename T      // Type of the accumulated values
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+size_t spgemmSymbolicKernel( const MT1& X, const MT2& Y, size_t n, size_t begin, size_t end )
+{
+   typedef ConstIterator_<MT1>  OuterIterator;
+   typedef ConstIterator_<MT2>  InnerIterator;
+
+   SpGEMMWorkspace<T>& workspace( spgemmWorkspace<T>() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const size_t products( spgemmProducts( X, Y, i ) );
+
+      if( products == 0UL ) {
+         continue;
+      }
+      else if( X.nonZeros(i) == 1UL ) {
+         nonzeros += products;
+         continue;
+      }
+
+      const OuterIterator xend( X.end(i) );
+      size_t count( 0UL );
+
+      if( spgemmUseHash( products, n ) )
+      {
+         const size_t mask( workspace.hash( products ) );
+         size_t* const keys( workspace.keys_.data() );
+         size_t* const slots( workspace.indices_.data() );
+
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y )
+            {
+               const size_t j( y->index() );
+               size_t h( ( j * 2654435761UL ) & mask );
+
+               while( keys[h] != j ) {
+                  if( keys[h] == SpGEMMWorkspace<T>::unused ) {
+                     keys[h] = j;
+                     slots[count++] = h;
+                     break;
+                  }
+                  h = ( h + 1UL ) & mask;
+               }
+            }
+         }
+
+         for( size_t k=0UL; k<count; ++k ) {
+            keys[slots[k]] = SpGEMMWorkspace<T>::unused;
+         }
+      }
+      else
+      {
+         const size_t stamp( workspace.dense( n, products ) );
+         size_t* const stamps( workspace.stamps_.data() );
+
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y ) {
+               if( stamps[y->index()] != stamp ) {
+                  stamps[y->index()] = stamp;
+                  ++count;
+               }
+            }
+         }
+      }
+
+      nonzeros += count;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric kernel of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param X The outer sparse matrix operand.
+// \param Y The inner sparse matrix operand.
+// \param n The length of the lines of the target matrix.
+// \param begin The index of the first line.
+// \param end The index of one past the last line.
+// \param last \a true in case the last line of the range has to be finalized, \a false if not.
+// \return void
+//
+// This function computes the lines in the range \f$ [begin..end) \f$ of the target matrix and
+// appends the non-zero elements in ascending order. It is assumed that the target matrix
+// provides sufficient capacity for all non-zero elements of the range.
+*/
+template< typename T      // Type of the accumulated values
+        , typename MT     // Type of the target sparse matrix
+        , bool SO         // Storage order of the target sparse matrix
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+void spgemmNumericKernel( SparseMatrix<MT,SO>& C, const MT1& X, const MT2& Y,
+                          size_t n, size_t begin, size_t end, bool last )
+{
+   typedef ConstIterator_<MT1>  OuterIterator;
+   typedef ConstIterator_<MT2>  InnerIterator;
+
+   const BoolConstant<SO> order;
+
+   SpGEMMWorkspace<T>& workspace( spgemmWorkspace<T>() );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      const size_t products( spgemmProducts( X, Y, i ) );
+      const OuterIterator xend( X.end(i) );
+
+      if( products > 0UL && X.nonZeros(i) == 1UL )
+      {
+         const OuterIterator x( X.begin(i) );
+         const InnerIterator yend( Y.end( x->index() ) );
+         for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y ) {
+            const T value( spgemmMult( x->value(), y->value(), order ) );
+            if( !isDefault( value ) )
+               spgemmAppend( C, i, y->index(), value );
+         }
+      }
+      else if( products > 0UL && spgemmUseHash( products, n ) )
+      {
+         const size_t mask( workspace.hash( products ) );
+         size_t* const keys( workspace.keys_.data() );
+         T*      const values( workspace.values_.data() );
+         size_t* const indices( workspace.indices_.data() );
+         size_t count( 0UL );
+
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y )
+            {
+               const size_t j( y->index() );
+               size_t h( ( j * 2654435761UL ) & mask );
+
+               while( true ) {
+                  if( keys[h] == j ) {
+                     values[h] += spgemmMult( x->value(), y->value(), order );
+                     break;
+                  }
+                  else if( keys[h] == SpGEMMWorkspace<T>::unused ) {
+                     keys[h] = j;
+                     values[h] = spgemmMult( x->value(), y->value(), order );
+                     indices[count++] = j;
+                     break;
+                  }
+                  h = ( h + 1UL ) & mask;
+               }
+            }
+         }
+
+         std::sort( indices, indices + count );
+
+         for( size_t k=0UL; k<count; ++k )
+         {
+            const size_t j( indices[k] );
+            size_t h( ( j * 2654435761UL ) & mask );
+
+            while( keys[h] != j ) {
+               h = ( h + 1UL ) & mask;
+            }
+
+            if( !isDefault( values[h] ) )
+               spgemmAppend( C, i, j, values[h] );
+
+            indices[k] = h;
+         }
+
+         for( size_t k=0UL; k<count; ++k ) {
+            keys[indices[k]] = SpGEMMWorkspace<T>::unused;
+         }
+      }
+      else if( products > 0UL )
+      {
+         const size_t stamp( workspace.dense( n, products ) );
+         size_t* const stamps( workspace.stamps_.data() );
+         T*      const values( workspace.values_.data() );
+         size_t* const indices( workspace.indices_.data() );
+         size_t count( 0UL ), minIndex( inf ), maxIndex( 0UL );
+
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y )
+            {
+               const size_t j( y->index() );
+
+               if( stamps[j] != stamp ) {
+                  stamps[j] = stamp;
+                  values[j] = spgemmMult( x->value(), y->value(), order );
+                  indices[count++] = j;
+                  if( j < minIndex ) minIndex = j;
+                  if( j > maxIndex ) maxIndex = j;
+               }
+               else {
+                  values[j] += spgemmMult( x->value(), y->value(), order );
+               }
+            }
+         }
+
+         BLAZE_INTERNAL_ASSERT( count <= n, "Invalid number of non-zero elements" );
+         BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+         if( ( count + count ) < ( maxIndex - minIndex ) )
+         {
+            std::sort( indices, indices + count );
+
+            for( size_t k=0UL; k<count; ++k ) {
+               const size_t j( indices[k] );
+               if( !isDefault( values[j] ) )
+                  spgemmAppend( C, i, j, values[j] );
+            }
+         }
+         else
+         {
+            for( size_t j=minIndex; j<=maxIndex; ++j ) {
+               if( stamps[j] == stamp && !isDefault( values[j] ) )
+                  spgemmAppend( C, i, j, values[j] );
+            }
+         }
+      }
+
+      if( last || i+1UL < end ) {
+         (~C).finalize( i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning kernel of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// \param X The outer sparse matrix operand.
+// \param Y The inner sparse matrix operand.
+// \param lines The number of lines of the target matrix.
+// \param blocks The number of blocks.
+// \return The \a blocks+1 boundaries of the line blocks.
+//
+// This function partitions the lines of the target matrix into \a blocks contiguous blocks
+// of approximately the same number of scalar products. In contrast to a partitioning into
+// blocks of equal size this balances the work in case of a skewed distribution of non-zero
+// elements, as it is typical for instance for graphs with power-law degree distribution.
+*/
+template< typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+std::vector<size_t> spgemmPartitionKernel( const MT1& X, const MT2& Y, size_t lines, size_t blocks )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks" );
+
+   std::vector<size_t> work( lines );
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      work[i] = spgemmProducts( X, Y, i ) + 1UL;
+      total += work[i];
+   }
+
+   std::vector<size_t> bounds( blocks+1UL, lines );
+   bounds[0UL] = 0UL;
+
+   size_t accumulated( 0UL );
+
+   for( size_t i=0UL, k=1UL; i<lines && k<blocks; ++i ) {
+      accumulated += work[i];
+      while( k < blocks && accumulated * blocks >= total * k ) {
+         bounds[k++] = i+1UL;
+      }
+   }
+
+   return bounds;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of a sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \return The number of non-zero elements of the given lines of the target matrix.
+//
+// The lines of a row-major target matrix are its rows, the lines of a column-major target
+// matrix are its columns. The function does not modify the target matrix.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline size_t spgemmSymbolic( const SparseMatrix<MT1,false>& C, const MT2& A, const MT3& B,
+                              size_t begin, size_t end )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   UNUSED_PARAMETER( C );
+
+   return spgemmSymbolicKernel<ET>( A, B, B.columns(), begin, end );
+}
+
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline size_t spgemmSymbolic( const SparseMatrix<MT1,true>& C, const MT2& A, const MT3& B,
+                              size_t begin, size_t end )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   UNUSED_PARAMETER( C );
+
+   return spgemmSymbolicKernel<ET>( B, A, A.rows(), begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of a sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \param begin The index of the first line of the target matrix.
+// \param end The index of one past the last line of the target matrix.
+// \param last \a true in case the last line of the range has to be finalized, \a false if not.
+// \return void
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline void spgemmNumeric( SparseMatrix<MT1,false>& C, const MT2& A, const MT3& B,
+                           size_t begin, size_t end, bool last )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   spgemmNumericKernel<ET>( C, A, B, B.columns(), begin, end, last );
+}
+
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline void spgemmNumeric( SparseMatrix<MT1,true>& C, const MT2& A, const MT3& B,
+                           size_t begin, size_t end, bool last )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   spgemmNumericKernel<ET>( C, B, A, A.rows(), begin, end, last );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of a sparse matrix multiplication (\f$ C=A*B \f$) into line blocks.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \param blocks The number of blocks.
+// \return The \a blocks+1 boundaries of the line blocks.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline std::vector<size_t>
+   spgemmPartition( const SparseMatrix<MT1,false>& C, const MT2& A, const MT3& B, size_t blocks )
+{
+   UNUSED_PARAMETER( C );
+
+   return spgemmPartitionKernel( A, B, A.rows(), blocks );
+}
+
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline std::vector<size_t>
+   spgemmPartition( const SparseMatrix<MT1,true>& C, const MT2& A, const MT3& B, size_t blocks )
+{
+   UNUSED_PARAMETER( C );
+
+   return spgemmPartitionKernel( B, A, B.columns(), blocks );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel of the sparse matrix multiplication engine.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param X The outer sparse matrix operand.
+// \param Y The inner sparse matrix operand.
+// \param n The length of the lines of the target matrix.
+// \param lines The number of lines of the target matrix.
+// \return void
+//
+// The number of scalar products is an upper bound for the number of non-zero elements of the
+// target matrix, which is reserved directly in case it is small. In case it exceeds both the
+// capacity of the L2 cache and the number of non-zero elements of the operands by a large
+// factor (as for instance for the product of two graphs with power-law degree distribution),
+// a symbolic pass determines the exact number of non-zero elements of the result before the
+// numeric pass computes the values, which avoids a massive over-allocation of the target matrix.
+*/
+template< typename T      // Type of the accumulated values
+        , typename MT     // Type of the target sparse matrix
+        , bool SO         // Storage order of the target sparse matrix
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+void spgemmKernel( SparseMatrix<MT,SO>& C, const MT1& X, const MT2& Y, size_t n, size_t lines )
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      nonzeros += spgemmProducts( X, Y, i );
+   }
+
+   if( nonzeros > l2CacheSize / ( sizeof(T) + sizeof(size_t) ) &&
+       nonzeros > 8UL * ( X.nonZeros() + Y.nonZeros() ) ) {
+      nonzeros = spgemmSymbolicKernel<T>( X, Y, n, 0UL, lines );
+   }
+   else if( nonzeros > n * lines ) {
+      nonzeros = n * lines;
+   }
+
+   (~C).reserve( nonzeros );
+
+   spgemmNumericKernel<T>( C, X, Y, n, 0UL, lines, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// This function computes the product of the two sparse matrices \a A and \a B by means of
+// Gustavson's algorithm. For a row-major target matrix both operands are expected to be
+// row-major, for a column-major target matrix both operands are expected to be column-major.
+// It is assumed that the target matrix does not contain any non-zero elements.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline void spgemm( SparseMatrix<MT1,false>& C, const MT2& A, const MT3& B )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes"      );
+
+   spgemmKernel<ET>( C, A, B, B.columns(), A.rows() );
+}
+
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+inline void spgemm( SparseMatrix<MT1,true>& C, const MT2& A, const MT3& B )
+{
+   typedef MultTrait_< ElementType_<MT2>, ElementType_<MT3> >  ET;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes"      );
+
+   spgemmKernel<ET>( C, B, A, A.rows(), B.columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
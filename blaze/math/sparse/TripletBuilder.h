@@ -0,0 +1,592 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletBuilder.h
+//  \brief Header file for the TripletBuilder class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/smp/Solvers.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parallel assembly of a CompressedMatrix from unordered (i,j,value) triplets.
+// \ingroup compressed_matrix
+//
+// The TripletBuilder class template collects the non-zero elements of a sparse matrix as
+// unordered (i,j,value) triplets (also known as coordinate or COO format) and builds the final
+// CompressedMatrix in a single step. In contrast to the insert() function of CompressedMatrix,
+// which moves all subsequent elements of the matrix for every inserted element, the cost of the
+// assembly is linear in the number of triplets, independent of the order of insertion. Multiple
+// triplets for the same element are combined by a user-defined operation, which by default is
+// the addition, as for instance required by the assembly of finite element matrices.
+//
+// The triplets can be collected by several threads at the same time: Each thread requests its
+// own buffer via the buffer() function and inserts its triplets into this buffer without any
+// synchronization:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::TripletBuilder;
+
+   TripletBuilder<double> builder( 1000UL, 1000UL );
+
+   #pragma omp parallel
+   {
+      TripletBuilder<double>::Buffer& buffer( builder.buffer() );
+
+      #pragma omp for
+      for( int e=0; e<elements; ++e ) {
+         // ... Computing the element matrix
+         buffer.insert( i, j, value );
+      }
+   }
+
+   CompressedMatrix<double,rowMajor> A;
+   builder.build( A );  // Summing up all triplets for the same element
+
+   CompressedMatrix<double,columnMajor> B;
+   builder.build( B, blaze::Maximum() );  // Combining duplicates by their maximum
+   \endcode
+
+// The build() function performs a parallel counting sort of the triplets by row (or column in
+// case of a column-major target matrix), sorts and combines the triplets of each row in parallel
+// and finally fills the rows of the target matrix, whose capacity is allocated exactly once.
+// The triplets of the same element are combined in the order of their insertion (in the order
+// of the buffers), which makes the result independent of the number of threads used for the
+// assembly. Note that explicitly inserted zero values are stored in the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+class TripletBuilder : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type  ElementType;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Triplet struct definition*******************************************************************
+   /*!\brief A single (i,j,value) triplet.
+   */
+   struct Triplet
+   {
+      size_t row;     //!< The row index of the element.
+      size_t column;  //!< The column index of the element.
+      Type   value;   //!< The value of the element.
+   };
+   //**********************************************************************************************
+
+   //**Buffer class definition*********************************************************************
+   /*!\brief Thread-local collection of triplets.
+   //
+   // A buffer collects the triplets of a single thread. Triplets can be inserted into different
+   // buffers concurrently, but a single buffer must not be used by several threads at the same
+   // time.
+   */
+   class Buffer : private NonCopyable
+   {
+    public:
+      //**Insert function**************************************************************************
+      /*!\brief Inserting a triplet into the buffer.
+      //
+      // \param i The row index of the element \f$[0..M-1]\f$.
+      // \param j The column index of the element \f$[0..N-1]\f$.
+      // \param value The value of the element.
+      // \return void
+      */
+      inline void insert( size_t i, size_t j, const Type& value ) {
+         BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+         BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+         triplets_.push_back( Triplet{ i, j, value } );
+      }
+      //*******************************************************************************************
+
+      //**Reserve function*************************************************************************
+      /*!\brief Setting the minimum capacity of the buffer.
+      //
+      // \param n The new minimum capacity of the buffer.
+      // \return void
+      */
+      inline void reserve( size_t n ) {
+         triplets_.reserve( n );
+      }
+      //*******************************************************************************************
+
+      //**Size function****************************************************************************
+      /*!\brief Returns the number of triplets in the buffer.
+      //
+      // \return The number of triplets in the buffer.
+      */
+      inline size_t size() const noexcept {
+         return triplets_.size();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for a buffer of an \f$ M \times N \f$ matrix.
+      //
+      // \param m The number of rows of the matrix.
+      // \param n The number of columns of the matrix.
+      */
+      explicit inline Buffer( size_t m, size_t n )
+         : m_       ( m )  // The number of rows of the matrix
+         , n_       ( n )  // The number of columns of the matrix
+         , triplets_()     // The triplets of the buffer
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t               m_;         //!< The number of rows of the matrix.
+      size_t               n_;         //!< The number of columns of the matrix.
+      std::vector<Triplet> triplets_;  //!< The triplets of the buffer.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class TripletBuilder;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TripletBuilder( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t  rows() const noexcept;
+   inline size_t  columns() const noexcept;
+   inline size_t  size() const;
+   inline Buffer& buffer();
+   inline void    insert( size_t i, size_t j, const Type& value );
+   inline void    reserve( size_t n );
+   inline void    clear();
+   //@}
+   //**********************************************************************************************
+
+   //**Build functions*****************************************************************************
+   /*!\name Build functions */
+   //@{
+   template< bool SO >
+   inline void build( CompressedMatrix<Type,SO>& A ) const;
+
+   template< bool SO, typename OP >
+   void build( CompressedMatrix<Type,SO>& A, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Entry struct definition*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief A triplet sorted into a row/column of the matrix.
+   */
+   struct Entry
+   {
+      size_t index;  //!< The column/row index of the element.
+      size_t seq;    //!< The position of the triplet in the order of insertion.
+      Type   value;  //!< The value of the element.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t                                 m_;        //!< The number of rows of the matrix.
+   size_t                                 n_;        //!< The number of columns of the matrix.
+   std::vector< std::unique_ptr<Buffer> > buffers_;  //!< The triplet buffers.
+   std::mutex                             mutex_;    //!< Synchronization of the buffer creation.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the assembly of an \f$ M \times N \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline TripletBuilder<Type>::TripletBuilder( size_t m, size_t n )
+   : m_      ( m )  // The number of rows of the matrix
+   , n_      ( n )  // The number of columns of the matrix
+   , buffers_()     // The triplet buffers
+   , mutex_  ()     // Synchronization of the buffer creation
+{
+   buffers_.emplace_back( new Buffer( m_, n_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the assembled matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t TripletBuilder<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the assembled matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t TripletBuilder<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of triplets in all buffers.
+//
+// \return The total number of triplets.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t TripletBuilder<Type>::size() const
+{
+   size_t triplets( 0UL );
+
+   for( const auto& buffer : buffers_ ) {
+      triplets += buffer->size();
+   }
+
+   return triplets;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new buffer for the calling thread.
+//
+// \return Reference to the new buffer.
+//
+// This function creates a new, empty buffer, which can be used by the calling thread to insert
+// triplets without any synchronization. The function itself can be called by several threads
+// concurrently. The returned reference remains valid until the builder is destroyed.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename TripletBuilder<Type>::Buffer& TripletBuilder<Type>::buffer()
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   buffers_.emplace_back( new Buffer( m_, n_ ) );
+   return *buffers_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting a triplet into the default buffer.
+//
+// \param i The row index of the element \f$[0..M-1]\f$.
+// \param j The column index of the element \f$[0..N-1]\f$.
+// \param value The value of the element.
+// \return void
+//
+// This function inserts the given triplet into the default buffer of the builder. In contrast
+// to the insertion into a buffer created by buffer() this function must not be called by
+// several threads at the same time.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void TripletBuilder<Type>::insert( size_t i, size_t j, const Type& value )
+{
+   buffers_.front()->insert( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the default buffer.
+//
+// \param n The new minimum capacity of the default buffer.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void TripletBuilder<Type>::reserve( size_t n )
+{
+   buffers_.front()->reserve( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all triplets from all buffers.
+//
+// \return void
+//
+// This function removes all triplets, but keeps both the buffers and their capacity. Thus all
+// references returned by buffer() remain valid and the buffers can be reused for the assembly
+// of the next matrix with the same dimensions.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void TripletBuilder<Type>::clear()
+{
+   for( auto& buffer : buffers_ ) {
+      buffer->triplets_.clear();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Building a compressed matrix by summing up the triplets for the same element.
+//
+// \param A The target compressed matrix.
+// \return void
+//
+// This function resets the given matrix to an \f$ M \times N \f$ matrix that contains the sum
+// of all triplets for each element.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< bool SO >        // Storage order of the target matrix
+inline void TripletBuilder<Type>::build( CompressedMatrix<Type,SO>& A ) const
+{
+   build( A, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Building a compressed matrix by combining the triplets for the same element.
+//
+// \param A The target compressed matrix.
+// \param op The operation for the combination of two values for the same element.
+// \return void
+//
+// This function resets the given matrix to an \f$ M \times N \f$ matrix that contains all
+// inserted triplets. Multiple triplets for the same element are combined via the given binary
+// operation in the order of their insertion. The assembly is performed in four passes, each of
+// which is executed in parallel (in case the number of triplets is sufficiently large):
+//
+//  -# The triplets per row (or column in case of a column-major matrix) are counted;
+//  -# The triplets are sorted into the rows by means of a counting sort;
+//  -# The triplets of each row are sorted by their column index and combined;
+//  -# The rows of the target matrix, whose capacity is allocated at once, are filled.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< bool SO          // Storage order of the target matrix
+        , typename OP >    // Type of the combination operation
+void TripletBuilder<Type>::build( CompressedMatrix<Type,SO>& A, OP op ) const
+{
+   const size_t lines( SO ? n_ : m_ );
+
+   std::vector<size_t> offsets( buffers_.size()+1UL, 0UL );
+   for( size_t b=0UL; b<buffers_.size(); ++b ) {
+      offsets[b+1UL] = offsets[b] + buffers_[b]->size();
+   }
+
+   const size_t total( offsets.back() );
+
+   const auto traverse = [this,&offsets]( size_t begin, size_t end, auto f )
+   {
+      size_t b( std::upper_bound( offsets.begin(), offsets.end(), begin ) - offsets.begin() - 1UL );
+
+      for( size_t k=begin; k<end; ++b ) {
+         const Triplet* const triplets( buffers_[b]->triplets_.data() );
+         const size_t kend( std::min( end, offsets[b+1UL] ) );
+         for( ; k<kend; ++k ) {
+            f( triplets[k-offsets[b]], k );
+         }
+      }
+   };
+
+   // First pass: Counting the triplets of each row/column
+   std::unique_ptr< std::atomic<size_t>[] > cursors( new std::atomic<size_t>[lines] );
+   for( size_t i=0UL; i<lines; ++i ) {
+      cursors[i].store( 0UL, std::memory_order_relaxed );
+   }
+
+   size_t processed = smpFusedKernel<size_t>( total, total, [&]( size_t begin, size_t end )
+   {
+      traverse( begin, end, [&cursors]( const Triplet& t, size_t ) {
+         cursors[ SO ? t.column : t.row ].fetch_add( 1UL, std::memory_order_relaxed );
+      } );
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == total, "Invalid number of processed triplets" );
+
+   std::vector<size_t> start( lines+1UL, 0UL );
+   for( size_t i=0UL; i<lines; ++i ) {
+      start[i+1UL] = start[i] + cursors[i].load( std::memory_order_relaxed );
+      cursors[i].store( start[i], std::memory_order_relaxed );
+   }
+
+   // Second pass: Sorting the triplets into the rows/columns
+   std::unique_ptr<Entry[]> entries( new Entry[total] );
+
+   processed = smpFusedKernel<size_t>( total, total, [&]( size_t begin, size_t end )
+   {
+      traverse( begin, end, [&cursors,&entries]( const Triplet& t, size_t k ) {
+         Entry& entry( entries[ cursors[ SO ? t.column : t.row ].fetch_add( 1UL, std::memory_order_relaxed ) ] );
+         entry.index = ( SO ? t.row : t.column );
+         entry.seq   = k;
+         entry.value = t.value;
+      } );
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == total, "Invalid number of processed triplets" );
+
+   // Third pass: Sorting and combining the triplets of each row/column
+   std::vector<size_t> nonzeros( lines, 0UL );
+
+   processed = smpFusedKernel<size_t>( lines, total, [&]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i )
+      {
+         Entry* const first( entries.get() + start[i] );
+         Entry* const last ( entries.get() + start[i+1UL] );
+
+         std::sort( first, last, []( const Entry& a, const Entry& b ) {
+            return a.index < b.index || ( a.index == b.index && a.seq < b.seq );
+         } );
+
+         Entry* out( first );
+         for( Entry* entry=first; entry!=last; ++out ) {
+            *out = *entry;
+            for( ++entry; entry!=last && entry->index == out->index; ++entry ) {
+               out->value = op( out->value, entry->value );
+            }
+         }
+
+         nonzeros[i] = out - first;
+      }
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == lines, "Invalid number of processed rows/columns" );
+
+   // Fourth pass: Filling the rows/columns of the target matrix
+   CompressedMatrix<Type,SO> tmp( m_, n_, nonzeros );
+
+   processed = smpFusedKernel<size_t>( lines, total, [&]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         const Entry* const first( entries.get() + start[i] );
+         for( const Entry* entry=first; entry!=first+nonzeros[i]; ++entry ) {
+            if( SO )
+               tmp.append( entry->index, i, entry->value );
+            else
+               tmp.append( i, entry->index, entry->value );
+         }
+      }
+      return end - begin;
+   } );
+
+   BLAZE_INTERNAL_ASSERT( processed == lines, "Invalid number of processed rows/columns" );
+   UNUSED_PARAMETER( processed );
+
+   A.swap( tmp );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
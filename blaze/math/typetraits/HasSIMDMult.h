@@ -81,7 +81,8 @@ struct HasSIMDMultHelper< T1, T2, EnableIf_< And< IsNumeric<T1>, IsIntegral<T1>
    enum : bool { value = ( bool( BLAZE_SSE2_MODE ) && sizeof(T1) == 2UL ) ||
                          ( bool( BLAZE_SSE4_MODE ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
                          ( bool( BLAZE_AVX2_MODE ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
-                         ( bool( BLAZE_MIC_MODE  ) && sizeof(T1) == 4UL ) };
+                         ( bool( BLAZE_MIC_MODE  ) && sizeof(T1) == 4UL ) ||
+                         ( bool( BLAZE_AVX512DQ_MODE ) && sizeof(T1) == 8UL ) };
 };
 
 template< typename T >
@@ -0,0 +1,126 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/HasSpMultKernels.h
+//  \brief Header file for the HasSpMultKernels type trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_HASSPMULTKERNELS_H_
+#define _BLAZE_MATH_TYPETRAITS_HASSPMULTKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for sparse matrix types with specialized multiplication kernels.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the given data type is a sparse matrix type that provides its
+// own, format specific multiplication kernels in form of the two free functions
+
+   \code
+   spmv( y, A, x, alpha, beta );  // y = alpha * A * x + beta * y
+   spmm( C, A, B, alpha, beta );  // C = alpha * A * B + beta * C
+   \endcode
+
+// for dense vectors \a x and \a y and dense matrices \a B and \a C. The sparse matrix/dense
+// vector and sparse matrix/dense matrix multiplication expressions use these kernels instead
+// of the default, iterator based kernels. In case the type provides the kernels, the \a value
+// member constant is set to \a true, the nested type definition \a Type is \a TrueType, and the
+// class derives from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType,
+// and the class derives from \a FalseType. Examples:
+
+   \code
+   blaze::HasSpMultKernels< SellMatrix<double> >::value              // Evaluates to 1
+   blaze::HasSpMultKernels< const SellMatrix<float> >::Type          // Results in TrueType
+   blaze::HasSpMultKernels< BlockCompressedMatrix<double,4UL,1UL> >  // Is derived from TrueType
+   blaze::HasSpMultKernels< CompressedMatrix<double,false> >::value  // Evaluates to 0
+   blaze::HasSpMultKernels< DynamicMatrix<double,false> >::Type      // Results in FalseType
+   blaze::HasSpMultKernels< int >                                    // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct HasSpMultKernels : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the HasSpMultKernels type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct HasSpMultKernels< const T > : public HasSpMultKernels<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the HasSpMultKernels type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct HasSpMultKernels< volatile T > : public HasSpMultKernels<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the HasSpMultKernels type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct HasSpMultKernels< const volatile T > : public HasSpMultKernels<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
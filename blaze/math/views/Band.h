@@ -0,0 +1,1238 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/Band.h
+//  \brief Header file for the band view
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_BAND_H_
+#define _BLAZE_MATH_VIEWS_BAND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/TransExpr.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band Band
+// \ingroup views
+*/
+/*!\brief View on the band of a dense matrix.
+// \ingroup band
+//
+// The Band class template represents a view on the band of a dense matrix, i.e. on the diagonal,
+// the first \a kl subdiagonals and the first \a ku superdiagonals. All elements within the band
+// refer to the according elements of the underlying matrix, all elements outside the band are
+// zero. A band view can be created via the band() function:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 100UL );
+   // ... Initialization
+
+   // Creating a view on the tridiagonal part of A
+   auto T = band( A, 1UL, 1UL );
+   \endcode
+
+// The view can be used in all dense matrix expressions. Additionally, the gbmv() function
+// performs a matrix/vector multiplication that only touches the elements of the band:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> x( 100UL ), y;
+   // ... Initialization
+
+   gbmv( y, band( A, 1UL, 1UL ), x, 1.0, 0.0 );  // y = T * x in O(N) operations
+   \endcode
+
+// Assignments to the band view only modify the elements of the band of the underlying matrix.
+// The attempt to assign a matrix with non-zero elements outside the band or to set an element
+// outside the band to a non-zero value results in a \a std::invalid_argument exception. The
+// band of a band view can be extracted into a BandMatrix for the use with the band kernels:
+
+   \code
+   blaze::BandMatrix<double> B( band( A, 1UL, 1UL ) );  // B has a lower and upper bandwidth of 1
+   \endcode
+
+// Note that the band view can only be created for dense matrices that provide references to
+// their elements (i.e. not for adaptors and computations).
+*/
+template< typename MT                               // Type of the dense matrix
+        , bool SO = IsColumnMajorMatrix<MT>::value >  // Storage order
+class Band : public DenseMatrix< Band<MT,SO>, SO >
+           , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense matrix expression.
+   typedef If_< IsExpression<MT>, MT, MT& >  Operand;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef Band<MT,SO>             This;           //!< Type of this Band instance.
+   typedef DenseMatrix<This,SO>    BaseType;       //!< Base type of this Band instance.
+   typedef ResultType_<MT>         ResultType;     //!< Result type for expression template evaluations.
+   typedef OppositeType_<MT>       OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef TransposeType_<MT>      TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<MT>        ElementType;    //!< Type of the band elements.
+   typedef const ElementType       ReturnType;     //!< Return type for expression template evaluations.
+   typedef const Band&             CompositeType;  //!< Data type for composite expression templates.
+   typedef const ElementType       ConstReference; //!< Reference to a constant band value.
+
+   //! Reference to a non-constant band value.
+   typedef If_< IsConst<MT>, ConstReference, BandProxy<ElementType> >  Reference;
+
+   typedef BandIterator<This,Reference,SO>             Iterator;       //!< Iterator over non-constant elements.
+   typedef BandIterator<const This,ConstReference,SO>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Band( Operand matrix, size_t kl, size_t ku ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline Band& operator=( const ElementType& rhs );
+   inline Band& operator=( const Band& rhs );
+
+   template< typename MT2, bool SO2 > inline Band& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline Band& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline Band& operator-=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, Band >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, Band >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Operand operand() const noexcept;
+   inline size_t  rows() const noexcept;
+   inline size_t  columns() const noexcept;
+   inline size_t  lowerBandwidth() const noexcept;
+   inline size_t  upperBandwidth() const noexcept;
+   inline void    reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isStored( size_t i, size_t j ) const noexcept;
+
+   inline Reference reference( size_t i, size_t j, TrueType  );
+   inline Reference reference( size_t i, size_t j, FalseType );
+
+   template< typename MT2 > void checkBand( const MT2& rhs ) const;
+   template< typename MT2 > void assign   ( const MT2& rhs );
+   template< typename MT2 > void addAssign( const MT2& rhs );
+   template< typename MT2 > void subAssign( const MT2& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand      matrix_;  //!< The dense matrix containing the band.
+   const size_t kl_;      //!< The number of subdiagonals of the band.
+   const size_t ku_;      //!< The number of superdiagonals of the band.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE  ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE  ( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for Band.
+//
+// \param matrix The matrix containing the band.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT,SO>::Band( Operand matrix, size_t kl, size_t ku ) noexcept
+   : matrix_( matrix )  // The dense matrix containing the band
+   , kl_    ( kl     )  // The number of subdiagonals of the band
+   , ku_    ( ku     )  // The number of superdiagonals of the band
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the band elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+//
+// In case the accessed element lies outside the band, the returned proxy represents a zero
+// element that can only be set to zero.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Reference Band<MT,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return reference( i, j, BoolConstant< IsConst<MT>::value >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the band elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstReference Band<MT,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return const_cast<const MT&>( matrix_ )(i,j);
+   else
+      return ElementType();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the band elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Reference Band<MT,SO>::at( size_t i, size_t j )
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the band elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstReference Band<MT,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Iterator Band<MT,SO>::begin( size_t i )
+{
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstIterator Band<MT,SO>::begin( size_t i ) const
+{
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstIterator Band<MT,SO>::cbegin( size_t i ) const
+{
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Iterator Band<MT,SO>::end( size_t i )
+{
+   return Iterator( *this, i, ( SO ? rows() : columns() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstIterator Band<MT,SO>::end( size_t i ) const
+{
+   return ConstIterator( *this, i, ( SO ? rows() : columns() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::ConstIterator Band<MT,SO>::cend( size_t i ) const
+{
+   return ConstIterator( *this, i, ( SO ? rows() : columns() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all elements of the band.
+//
+// \param rhs Scalar value to be assigned to all elements of the band.
+// \return Reference to the assigned band.
+//
+// All elements within the band of the underlying matrix are set to the given value, all other
+// elements of the matrix remain unchanged.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT,SO>& Band<MT,SO>::operator=( const ElementType& rhs )
+{
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) = rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for Band.
+//
+// \param rhs Band view to be copied.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to band matrix.
+//
+// The elements of the given band view are copied into the band of the underlying matrix. The
+// elements outside the band remain unchanged.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT,SO>& Band<MT,SO>::operator=( const Band& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   return operator=( static_cast<const Matrix<Band,SO>&>( rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to band matrix.
+//
+// The elements of the given matrix are copied into the band of the underlying matrix. In case
+// the given matrix has non-zero elements outside the band, a \a std::invalid_argument exception
+// is thrown and the underlying matrix remains unchanged.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline Band<MT,SO>& Band<MT,SO>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsComputation<MT2>::value || (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      assign( tmp );
+   }
+   else {
+      assign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the band.
+// \return Reference to the band.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline Band<MT,SO>& Band<MT,SO>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsComputation<MT2>::value || (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      addAssign( tmp );
+   }
+   else {
+      addAssign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the band.
+// \return Reference to the band.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline Band<MT,SO>& Band<MT,SO>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsComputation<MT2>::value || (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      subAssign( tmp );
+   }
+   else {
+      subAssign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a band and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the band.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, Band<MT,SO> >& Band<MT,SO>::operator*=( Other rhs )
+{
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) *= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a band by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the band.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, Band<MT,SO> >& Band<MT,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the matrix containing the band.
+//
+// \return The matrix containing the band.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Operand Band<MT,SO>::operand() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the band view.
+//
+// \return The number of rows of the band view.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t Band<MT,SO>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the band view.
+//
+// \return The number of columns of the band view.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t Band<MT,SO>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth (the number of subdiagonals) of the band view.
+//
+// \return The lower bandwidth of the band view.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t Band<MT,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth (the number of superdiagonals) of the band view.
+//
+// \return The upper bandwidth of the band view.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t Band<MT,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements within the band of the underlying matrix to their default
+// value. The elements outside the band remain unchanged.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void Band<MT,SO>::reset()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         clear( matrix_(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ a_{ij} \f$ lies within the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element lies within the band, \a false if not.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool Band<MT,SO>::isStored( size_t i, size_t j ) const noexcept
+{
+   return ( j+kl_ >= i ) && ( j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to an element of a band view on a constant matrix.
+//
+// \param i Access index for the row.
+// \param j Access index for the column.
+// \return The value of the accessed element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Reference Band<MT,SO>::reference( size_t i, size_t j, TrueType )
+{
+   return const_cast<const Band&>( *this )(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to an element of a band view on a non-constant matrix.
+//
+// \param i Access index for the row.
+// \param j Access index for the column.
+// \return Proxy to the accessed element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename Band<MT,SO>::Reference Band<MT,SO>::reference( size_t i, size_t j, FalseType )
+{
+   return Reference( isStored( i, j ) ? &matrix_(i,j) : nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the given matrix for non-zero elements outside the band.
+//
+// \param rhs The matrix to be checked.
+// \return void
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side matrix
+void Band<MT,SO>::checkBand( const MT2& rhs ) const
+{
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         if( !isStored( i, j ) && !isDefault( rhs(i,j) ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to band matrix" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the band of the given matrix.
+//
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side matrix
+void Band<MT,SO>::assign( const MT2& rhs )
+{
+   checkBand( rhs );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) = rhs(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment of the band of the given matrix.
+//
+// \param rhs The right-hand side matrix to be added.
+// \return void
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side matrix
+void Band<MT,SO>::addAssign( const MT2& rhs )
+{
+   checkBand( rhs );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) += rhs(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of the band of the given matrix.
+//
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+// \exception std::invalid_argument Invalid assignment to band matrix.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side matrix
+void Band<MT,SO>::subAssign( const MT2& rhs )
+{
+   checkBand( rhs );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix_(i,j) -= rhs(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the band view can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this band view, \a false if not.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool Band<MT,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the band view is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this band view, \a false if not.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool Band<MT,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the band view is properly aligned in memory.
+//
+// \return \a false.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool Band<MT,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the band view can be used in SMP assignments.
+//
+// \return \a false.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool Band<MT,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on the band of the given dense matrix.
+// \ingroup band
+//
+// \param matrix The dense matrix containing the band.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \return View on the band of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT> band( DenseMatrix<MT,SO>& matrix, size_t kl, size_t ku )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<MT>( ~matrix, kl, ku );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on the band of the given temporary dense matrix.
+// \ingroup band
+//
+// \param matrix The temporary dense matrix containing the band.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \return View on the band of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT> band( DenseMatrix<MT,SO>&& matrix, size_t kl, size_t ku )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<MT>( ~matrix, kl, ku );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on the band of the given constant dense matrix.
+// \ingroup band
+//
+// \param matrix The constant dense matrix containing the band.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \return View on the band of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const Band<const MT> band( const DenseMatrix<MT,SO>& matrix, size_t kl, size_t ku )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<const MT>( ~matrix, kl, ku );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Band operators */
+//@{
+template< typename MT, bool SO >
+inline void reset( Band<MT,SO>& b );
+
+template< typename MT, bool SO >
+inline void clear( Band<MT,SO>& b );
+
+template< typename MT, bool SO >
+inline bool isDefault( const Band<MT,SO>& b );
+
+template< typename VT1, typename MT, bool SO, typename VT2, typename ST >
+void gbmv( DenseVector<VT1,false>& y, const Band<MT,SO>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band view.
+// \ingroup band
+//
+// \param b The band view to be resetted.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void reset( Band<MT,SO>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band view.
+// \ingroup band
+//
+// \param b The band view to be cleared.
+// \return void
+//
+// Clearing a band view is equivalent to resetting it via the reset() function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void clear( Band<MT,SO>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band view is in default state.
+// \ingroup band
+//
+// \param b The band view to be tested for its default state.
+// \return \a true in case all elements of the band are in default state, \a false otherwise.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool isDefault( const Band<MT,SO>& b )
+{
+   const size_t kl( b.lowerBandwidth() );
+   const size_t ku( b.upperBandwidth() );
+
+   for( size_t i=0UL; i<b.rows(); ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( min( b.columns(), i+ku+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         if( !isDefault( b(i,j) ) ) return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Band view/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup band
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side band view operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function performs the multiplication of the band of a dense matrix with a dense vector.
+// Only the elements within the band of the underlying matrix are accessed. In case of a
+// row-major matrix every element of \a y is computed as the vectorized inner product of a
+// segment of a row and \a x, in case of a column-major matrix every element of \a x scales a
+// segment of a column. In case \a beta is zero, the target vector is not read and resized to the
+// number of rows of \a A if necessary.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+void gbmv( DenseVector<VT1,false>& y, const Band<MT,SO>& A,
+           const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>  ET;
+
+   if( (~x).size() != A.columns() || ( !isDefault( beta ) && (~y).size() != A.rows() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const size_t m ( A.rows() );
+   const size_t n ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   const MT& M( A.operand() );
+   const DynamicVector<ET,false> tx( ~x );
+   DynamicVector<ET,false> ty( m, ET() );
+
+   if( !SO ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+         const size_t jend  ( min( n, i+ku+1UL ) );
+         if( jbegin < jend ) {
+            ty[i] = subvector( row( M, i ), jbegin, jend-jbegin ) *
+                    subvector( tx, jbegin, jend-jbegin );
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t ibegin( ( j > ku )?( j-ku ):( 0UL ) );
+         const size_t iend  ( min( m, j+kl+1UL ) );
+         if( ibegin < iend ) {
+            subvector( ty, ibegin, iend-ibegin ) +=
+               subvector( column( M, j ), ibegin, iend-ibegin ) * tx[j];
+         }
+      }
+   }
+
+   if( isDefault( beta ) )
+      (~y) = alpha * ty;
+   else
+      (~y) = alpha * ty + beta * (~y);
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
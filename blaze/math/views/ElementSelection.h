@@ -0,0 +1,2865 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/ElementSelection.h
+//  \brief Header file for the implementation of the ElementSelection view
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_ELEMENTSELECTION_H_
+#define _BLAZE_MATH_VIEWS_ELEMENTSELECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransExpr.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatVecMultExpr.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsTransExpr.h>
+#include <blaze/math/typetraits/IsTVecMatMultExpr.h>
+#include <blaze/math/typetraits/IsVecEvalExpr.h>
+#include <blaze/math/typetraits/IsVecForEachExpr.h>
+#include <blaze/math/typetraits/IsVecScalarDivExpr.h>
+#include <blaze/math/typetraits/IsVecScalarMultExpr.h>
+#include <blaze/math/typetraits/IsVecSerialExpr.h>
+#include <blaze/math/typetraits/IsVecTransExpr.h>
+#include <blaze/math/typetraits/IsVecVecAddExpr.h>
+#include <blaze/math/typetraits/IsVecVecDivExpr.h>
+#include <blaze/math/typetraits/IsVecVecMultExpr.h>
+#include <blaze/math/typetraits/IsVecVecSubExpr.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup elements Element selections
+// \ingroup views
+*/
+/*!\brief View on an arbitrary selection of elements of a dense vector.
+// \ingroup elements
+//
+// The ElementSelection class template represents a view on a selection of elements of a dense vector.
+// The selection is given by a list of indices, which don't have to be sorted and which may
+// contain the same index several times. An element selection can be created via the elements()
+// function:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> x( 1000UL );
+   // ... Initialization
+
+   // Creating a view on the elements 7, 3 and 500 of x
+   auto e1 = elements( x, { 7UL, 3UL, 500UL } );
+
+   // Creating a view on the elements given by a std::vector
+   std::vector<size_t> indices{ 2UL, 4UL, 6UL, 8UL };
+   auto e2 = elements( x, indices );
+   \endcode
+
+// The view can be used in all dense vector expressions and can be the target of all dense vector
+// assignments. In case the element type provides SIMD gather operations (see the HasSIMDGather
+// type trait) and the underlying vector provides direct access to its elements, the elements are
+// loaded via SIMD gather instructions and stored via SIMD scatter instructions. Additionally,
+// assignments to and from element selections are parallelized in SMP assignments. Element selections can
+// also be created for vector expressions, in which case only the selected elements are computed:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double,blaze::columnVector> y;
+
+   y = elements( A * x, indices );  // Only computes the 4 selected elements of A*x
+   \endcode
+
+// Note that in case an element selection is the target of an assignment and the index list contains
+// the same index several times, it is unspecified which of the assigned values is stored in the
+// repeatedly referenced element. Also note that element selections can only be created for dense
+// vectors that provide references to their elements (i.e. not for adaptors).
+*/
+template< typename VT                          // Type of the dense vector
+        , bool TF = IsRowVector<VT>::value >  // Transpose flag
+class ElementSelection : public DenseVector< ElementSelection<VT,TF>, TF >
+                       , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense vector expression.
+   typedef If_< IsExpression<VT>, VT, VT& >  Operand;
+   //**********************************************************************************************
+
+   //**ElementSelectionIterator class definition***************************************************
+   /*!\brief Iterator over the elements of the element selection.
+   */
+   template< typename VectorType       // Type of the dense vector
+           , typename ReferenceType >  // Reference return type
+   class ElementSelectionIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef ElementType_<VectorType>         ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+      typedef SIMDTrait_<ValueType>            SIMDType;          //!< SIMD type of the elements.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the ElementSelectionIterator class.
+      */
+      inline ElementSelectionIterator() noexcept
+         : vector_( nullptr )  // The dense vector containing the elements
+         , index_ ( nullptr )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the ElementSelectionIterator class.
+      //
+      // \param vector The dense vector containing the elements.
+      // \param index Pointer to the index of the initial element.
+      */
+      inline ElementSelectionIterator( VectorType& vector, const size_t* index ) noexcept
+         : vector_( &vector )  // The dense vector containing the elements
+         , index_ ( index   )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different ElementSelectionIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VectorType2, typename ReferenceType2 >
+      inline ElementSelectionIterator( const ElementSelectionIterator<VectorType2,ReferenceType2>& it ) noexcept
+         : vector_( it.vector_ )  // The dense vector containing the elements
+         , index_ ( it.index_  )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ElementSelectionIterator& operator+=( size_t inc ) noexcept {
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ElementSelectionIterator& operator-=( size_t dec ) noexcept {
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ElementSelectionIterator& operator++() noexcept {
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementSelectionIterator operator++( int ) noexcept {
+         const ElementSelectionIterator tmp( *this );
+         ++index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ElementSelectionIterator& operator--() noexcept {
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementSelectionIterator operator--( int ) noexcept {
+         const ElementSelectionIterator tmp( *this );
+         --index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*vector_)[*index_];
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function gathers the next SIMD element of the element selection from the underlying
+      // dense vector. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return gather( vector_->data(), index_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // Since the elements of an element selection are not contiguous, this function is identical
+      // to the load() function. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // Since the elements of an element selection are not contiguous, this function is identical
+      // to the load() function. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function scatters the given SIMD element to the according elements of the
+      // underlying dense vector. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void store( const SIMDType& value ) const noexcept {
+         scatter( vector_->data(), index_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of an element selection are not contiguous, this function is identical
+      // to the store() function. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of an element selection are not contiguous, this function is identical
+      // to the store() function. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of an element selection are not contiguous, this function is identical
+      // to the store() function. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ElementSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ElementSelectionIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an ElementSelectionIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementSelectionIterator operator+( const ElementSelectionIterator& it, size_t inc ) noexcept {
+         return ElementSelectionIterator( *it.vector_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and an ElementSelectionIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementSelectionIterator operator+( size_t inc, const ElementSelectionIterator& it ) noexcept {
+         return ElementSelectionIterator( *it.vector_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between an ElementSelectionIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ElementSelectionIterator operator-( const ElementSelectionIterator& it, size_t dec ) noexcept {
+         return ElementSelectionIterator( *it.vector_, it.index_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VectorType*   vector_;  //!< The dense vector containing the elements.
+      const size_t* index_;   //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename VectorType2, typename ReferenceType2 > friend class ElementSelectionIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef ElementSelection<VT,TF>     This;            //!< Type of this ElementSelection instance.
+   typedef DenseVector<This,TF>        BaseType;        //!< Base type of this ElementSelection instance.
+   typedef SubvectorTrait_<VT>         ResultType;      //!< Result type for expression template evaluations.
+   typedef TransposeType_<ResultType>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef ElementType_<VT>            ElementType;     //!< Type of the selected elements.
+   typedef SIMDTrait_<ElementType>     SIMDType;        //!< SIMD type of the selected elements.
+   typedef ReturnType_<VT>             ReturnType;      //!< Return type for expression template evaluations.
+   typedef const ElementSelection&     CompositeType;   //!< Data type for composite expression templates.
+   typedef ConstReference_<VT>         ConstReference;  //!< Reference to a constant element value.
+
+   //! Reference to a non-constant element value.
+   typedef If_< IsConst<VT>, ConstReference, Reference_<VT> >  Reference;
+
+   //! Iterator over constant elements.
+   typedef ElementSelectionIterator<const VT,ConstReference>  ConstIterator;
+
+   //! Iterator over non-constant elements.
+   typedef If_< IsConst<VT>, ConstIterator, ElementSelectionIterator<VT,Reference> >  Iterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = VT::simdEnabled &&
+                               HasSIMDGather<ElementType>::value &&
+                               HasConstDataAccess<VT>::value };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = VT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ElementSelection( Operand vector, const size_t* indices, size_t n );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                            inline ElementSelection& operator= ( const ElementType& rhs );
+                            inline ElementSelection& operator= ( const ElementSelection& rhs );
+   template< typename VT2 > inline ElementSelection& operator= ( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline ElementSelection& operator+=( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline ElementSelection& operator-=( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline ElementSelection& operator*=( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline ElementSelection& operator/=( const DenseVector<VT2,TF>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, ElementSelection >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, ElementSelection >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Operand                    operand() const noexcept;
+   inline size_t                     idx( size_t i ) const noexcept;
+   inline const std::vector<size_t>& indices() const noexcept;
+   inline size_t                     size() const noexcept;
+   inline size_t                     capacity() const noexcept;
+   inline size_t                     nonZeros() const;
+   inline void                       reset();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            simdEnabled && VT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<VT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedAddAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            simdEnabled && VT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<VT2> >::value &&
+                            HasSIMDAdd< ElementType, ElementType_<VT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedSubAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            simdEnabled && VT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<VT2> >::value &&
+                            HasSIMDSub< ElementType, ElementType_<VT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedMultAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            simdEnabled && VT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<VT2> >::value &&
+                            HasSIMDMult< ElementType, ElementType_<VT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedDivAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            simdEnabled && VT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<VT2> >::value &&
+                            HasSIMDDiv< ElementType, ElementType_<VT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT2 >
+   inline DisableIf_< VectorizedAssign<VT2> > assign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline EnableIf_< VectorizedAssign<VT2> > assign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void assign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline DisableIf_< VectorizedAddAssign<VT2> > addAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline EnableIf_< VectorizedAddAssign<VT2> > addAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void addAssign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline DisableIf_< VectorizedSubAssign<VT2> > subAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline EnableIf_< VectorizedSubAssign<VT2> > subAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void subAssign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline DisableIf_< VectorizedMultAssign<VT2> > multAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline EnableIf_< VectorizedMultAssign<VT2> > multAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void multAssign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline DisableIf_< VectorizedDivAssign<VT2> > divAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline EnableIf_< VectorizedDivAssign<VT2> > divAssign( const DenseVector<VT2,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand             vector_;   //!< The dense vector containing the elements.
+   std::vector<size_t> indices_;  //!< The indices of the selected elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE   ( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE  ( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE    ( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE  ( VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for ElementSelection.
+//
+// \param vector The dense vector containing the elements.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \exception std::invalid_argument Invalid element access index.
+//
+// In case any of the given indices is greater than or equal to the size of the given vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementSelection<VT,TF>::ElementSelection( Operand vector, const size_t* indices, size_t n )
+   : vector_ ( vector )            // The dense vector containing the elements
+   , indices_( indices, indices+n )  // The indices of the selected elements
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      if( vector_.size() <= indices_[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid element access index" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the selected elements.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return Reference to the accessed value.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::Reference ElementSelection<VT,TF>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid element access index" );
+   return vector_[indices_[index]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the selected elements.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return Reference to the accessed value.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstReference ElementSelection<VT,TF>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid element access index" );
+   return const_cast<const VT&>( vector_ )[indices_[index]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the selected elements.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid element access index.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::Reference ElementSelection<VT,TF>::at( size_t index )
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid element access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the selected elements.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid element access index.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstReference ElementSelection<VT,TF>::at( size_t index ) const
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid element access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first selected element.
+//
+// \return Iterator to the first selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::Iterator ElementSelection<VT,TF>::begin()
+{
+   return Iterator( vector_, indices_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first selected element.
+//
+// \return Iterator to the first selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstIterator ElementSelection<VT,TF>::begin() const
+{
+   return ConstIterator( vector_, indices_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first selected element.
+//
+// \return Iterator to the first selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstIterator ElementSelection<VT,TF>::cbegin() const
+{
+   return ConstIterator( vector_, indices_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last selected element.
+//
+// \return Iterator just past the last selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::Iterator ElementSelection<VT,TF>::end()
+{
+   return Iterator( vector_, indices_.data() + indices_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last selected element.
+//
+// \return Iterator just past the last selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstIterator ElementSelection<VT,TF>::end() const
+{
+   return ConstIterator( vector_, indices_.data() + indices_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last selected element.
+//
+// \return Iterator just past the last selected element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::ConstIterator ElementSelection<VT,TF>::cend() const
+{
+   return ConstIterator( vector_, indices_.data() + indices_.size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all selected elements.
+//
+// \param rhs Scalar value to be assigned to all selected elements.
+// \return Reference to the assigned element selection.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator=( const ElementType& rhs )
+{
+   for( size_t i=0UL; i<size(); ++i )
+      vector_[indices_[i]] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for ElementSelection.
+//
+// \param rhs Element view to be copied.
+// \return Reference to the assigned element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two element selections don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator=( const ElementSelection& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   return operator=( static_cast<const Vector<ElementSelection,TF>&>( rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be assigned.
+// \return Reference to the assigned element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<VT2> );
+
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const ResultType_<VT2> tmp( ~rhs );
+      if( IsSparseVector<VT2>::value )
+         reset();
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseVector<VT2>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the element selection.
+// \return Reference to the element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator+=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<VT2> );
+
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const ResultType_<VT2> tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the element selection.
+// \return Reference to the element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator-=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<VT2> );
+
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const ResultType_<VT2> tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the element selection.
+// \return Reference to the element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator*=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<VT2> );
+
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const ResultType_<VT2> tmp( ~rhs );
+      smpMultAssign( *this, tmp );
+   }
+   else {
+      smpMultAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a dense vector
+//        (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the element selection.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline ElementSelection<VT,TF>& ElementSelection<VT,TF>::operator/=( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<VT2> );
+
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const ResultType_<VT2> tmp( ~rhs );
+      smpDivAssign( *this, tmp );
+   }
+   else {
+      smpDivAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between an element selection
+//        and a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the element selection.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, ElementSelection<VT,TF> >& ElementSelection<VT,TF>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of an element selection by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the element selection.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, ElementSelection<VT,TF> >& ElementSelection<VT,TF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the vector containing the selected elements.
+//
+// \return The vector containing the selected elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename ElementSelection<VT,TF>::Operand ElementSelection<VT,TF>::operand() const noexcept
+{
+   return vector_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the \a i-th selected element within the underlying vector.
+//
+// \param i Access index. The index must be smaller than the number of selected elements.
+// \return The index of the selected element within the underlying vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t ElementSelection<VT,TF>::idx( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid element access index" );
+   return indices_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the selected elements.
+//
+// \return The indices of the selected elements within the underlying vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const std::vector<size_t>& ElementSelection<VT,TF>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of selected elements.
+//
+// \return The number of selected elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t ElementSelection<VT,TF>::size() const noexcept
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the element selection.
+//
+// \return The capacity of the element selection.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t ElementSelection<VT,TF>::capacity() const noexcept
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero selected elements.
+//
+// \return The number of non-zero selected elements.
+//
+// Note that the number of non-zero elements is always less than or equal to the number of
+// selected elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t ElementSelection<VT,TF>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<size(); ++i ) {
+      if( !isDefault( (*this)[i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all selected elements of the underlying vector to their default value.
+// All other elements of the vector remain unchanged.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void ElementSelection<VT,TF>::reset()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<size(); ++i )
+      clear( vector_[indices_[i]] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the element selection can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this element selection, \a false if not.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool ElementSelection<VT,TF>::canAlias( const Other* alias ) const noexcept
+{
+   return vector_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element selection is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this element selection, \a false if not.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool ElementSelection<VT,TF>::isAliased( const Other* alias ) const noexcept
+{
+   return vector_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element selection is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the selected elements are in general not contiguous in memory, an element selection is
+// never considered to be aligned.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool ElementSelection<VT,TF>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element selection can be used in SMP assignments.
+//
+// \return \a true in case the element selection can be used in SMP assignments, \a false if not.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool ElementSelection<VT,TF>::canSMPAssign() const noexcept
+{
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// This function gathers the selected elements \a index to \a index + \a SIMDSIZE - 1 from the
+// underlying vector. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE typename ElementSelection<VT,TF>::SIMDType
+   ElementSelection<VT,TF>::load( size_t index ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid element access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid element access index" );
+
+   return gather( vector_.data(), indices_.data()+index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// Since the selected elements are not contiguous, this function is identical to the load()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE typename ElementSelection<VT,TF>::SIMDType
+   ElementSelection<VT,TF>::loada( size_t index ) const noexcept
+{
+   return load( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// Since the selected elements are not contiguous, this function is identical to the load()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE typename ElementSelection<VT,TF>::SIMDType
+   ElementSelection<VT,TF>::loadu( size_t index ) const noexcept
+{
+   return load( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function scatters the given SIMD element to the selected elements \a index to \a index
+// + \a SIMDSIZE - 1 of the underlying vector. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE void ElementSelection<VT,TF>::store( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid element access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid element access index" );
+
+   scatter( vector_.data(), indices_.data()+index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the selected elements are not contiguous, this function is identical to the store()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE void ElementSelection<VT,TF>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   store( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the selected elements are not contiguous, this function is identical to the store()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE void ElementSelection<VT,TF>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   store( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the selected elements are not contiguous, this function is identical to the store()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE void ElementSelection<VT,TF>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   store( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedAssign<VT2> >
+   ElementSelection<VT,TF>::assign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      vector_[indices_[i    ]] = (~rhs)[i    ];
+      vector_[indices_[i+1UL]] = (~rhs)[i+1UL];
+   }
+   if( ipos < size() ) {
+      vector_[indices_[ipos]] = (~rhs)[ipos];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedAssign<VT2> >
+   ElementSelection<VT,TF>::assign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_<VT2> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<n; ++i ) {
+      *left = *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void ElementSelection<VT,TF>::assign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT2> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[indices_[element->index()]] = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT2> >
+   ElementSelection<VT,TF>::addAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      vector_[indices_[i    ]] += (~rhs)[i    ];
+      vector_[indices_[i+1UL]] += (~rhs)[i+1UL];
+   }
+   if( ipos < size() ) {
+      vector_[indices_[ipos]] += (~rhs)[ipos];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT2> >
+   ElementSelection<VT,TF>::addAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_<VT2> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<n; ++i ) {
+      *left += *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void ElementSelection<VT,TF>::addAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT2> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[indices_[element->index()]] += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT2> >
+   ElementSelection<VT,TF>::subAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      vector_[indices_[i    ]] -= (~rhs)[i    ];
+      vector_[indices_[i+1UL]] -= (~rhs)[i+1UL];
+   }
+   if( ipos < size() ) {
+      vector_[indices_[ipos]] -= (~rhs)[ipos];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT2> >
+   ElementSelection<VT,TF>::subAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_<VT2> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<n; ++i ) {
+      *left -= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void ElementSelection<VT,TF>::subAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT2> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[indices_[element->index()]] -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT2> >
+   ElementSelection<VT,TF>::multAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      vector_[indices_[i    ]] *= (~rhs)[i    ];
+      vector_[indices_[i+1UL]] *= (~rhs)[i+1UL];
+   }
+   if( ipos < size() ) {
+      vector_[indices_[ipos]] *= (~rhs)[ipos];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT2> >
+   ElementSelection<VT,TF>::multAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_<VT2> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<n; ++i ) {
+      *left *= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the multiplication assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void ElementSelection<VT,TF>::multAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const ResultType tmp( serial( *this ) );
+
+   reset();
+
+   for( ConstIterator_<VT2> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[indices_[element->index()]] = tmp[element->index()] * element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline DisableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedDivAssign<VT2> >
+   ElementSelection<VT,TF>::divAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      vector_[indices_[i    ]] /= (~rhs)[i    ];
+      vector_[indices_[i+1UL]] /= (~rhs)[i+1UL];
+   }
+   if( ipos < size() ) {
+      vector_[indices_[ipos]] /= (~rhs)[ipos];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< typename ElementSelection<VT,TF>::BLAZE_TEMPLATE VectorizedDivAssign<VT2> >
+   ElementSelection<VT,TF>::divAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_<VT2> right( (~rhs).begin() );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<n; ++i ) {
+      *left /= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENTS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ElementSelection operators */
+//@{
+template< typename VT, bool TF >
+inline void reset( ElementSelection<VT,TF>& e );
+
+template< typename VT, bool TF >
+inline void clear( ElementSelection<VT,TF>& e );
+
+template< typename VT, bool TF >
+inline bool isDefault( const ElementSelection<VT,TF>& e );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given element selection.
+// \ingroup elements
+//
+// \param e The element selection to be resetted.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void reset( ElementSelection<VT,TF>& e )
+{
+   e.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given element selection.
+// \ingroup elements
+//
+// \param e The element selection to be cleared.
+// \return void
+//
+// Clearing an element selection is equivalent to resetting it via the reset() function.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void clear( ElementSelection<VT,TF>& e )
+{
+   e.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given element selection is in default state.
+// \ingroup elements
+//
+// \param e The element selection to be tested for its default state.
+// \return \a true in case all selected elements are in default state, \a false otherwise.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool isDefault( const ElementSelection<VT,TF>& e )
+{
+   for( size_t i=0UL; i<e.size(); ++i ) {
+      if( !isDefault( e[i] ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of elements of the given dense vector.
+// \ingroup elements
+//
+// \param vector The dense vector containing the elements.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the given vector.
+// \exception std::invalid_argument Invalid element access index.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline DisableIf_< Or< IsComputation<VT>, IsTransExpr<VT> >, ElementSelection<VT> >
+   elements( DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ElementSelection<VT>( ~vector, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of elements of the given constant dense vector.
+// \ingroup elements
+//
+// \param vector The constant dense vector containing the elements.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the given vector.
+// \exception std::invalid_argument Invalid element access index.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const DisableIf_< Or< IsComputation<VT>, IsTransExpr<VT> >, ElementSelection<const VT> >
+   elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ElementSelection<const VT>( ~vector, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of elements of the given temporary dense vector.
+// \ingroup elements
+//
+// \param vector The temporary dense vector containing the elements.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the given vector.
+// \exception std::invalid_argument Invalid element access index.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline DisableIf_< Or< IsComputation<VT>, IsTransExpr<VT> >, ElementSelection<VT> >
+   elements( DenseVector<VT,TF>&& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ElementSelection<VT>( ~vector, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of elements of the given dense vector.
+// \ingroup elements
+//
+// \param vector The dense vector containing the elements.
+// \param indices The indices of the selected elements.
+// \return View on the selected elements of the given vector.
+// \exception std::invalid_argument Invalid element access index.
+//
+// This function returns an expression representing the selected elements of the given dense
+// vector or dense vector expression:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> x( 100UL );
+   // ... Initialization
+
+   auto e = elements( x, { 2UL, 7UL, 7UL, 42UL } );
+   \endcode
+*/
+template< typename VT >  // Type of the dense vector
+inline decltype(auto) elements( VT&& vector, initializer_list<size_t> indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( std::forward<VT>( vector ), indices.begin(), indices.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of elements of the given dense vector.
+// \ingroup elements
+//
+// \param vector The dense vector containing the elements.
+// \param indices The indices of the selected elements.
+// \return View on the selected elements of the given vector.
+// \exception std::invalid_argument Invalid element access index.
+//
+// This function returns an expression representing the selected elements of the given dense
+// vector or dense vector expression. The given indices are copied into the view, i.e. the
+// given \c std::vector can be modified or destroyed afterwards.
+*/
+template< typename VT >  // Type of the dense vector
+inline decltype(auto) elements( VT&& vector, const std::vector<size_t>& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( std::forward<VT>( vector ), indices.data(), indices.size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/vector addition.
+// \ingroup elements
+//
+// \param vector The constant vector/vector addition.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the addition.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecVecAddExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand() , indices, n ) +
+          elements( (~vector).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/vector subtraction.
+// \ingroup elements
+//
+// \param vector The constant vector/vector subtraction.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the subtraction.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecVecSubExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand() , indices, n ) -
+          elements( (~vector).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/vector multiplication.
+// \ingroup elements
+//
+// \param vector The constant vector/vector multiplication.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the multiplication.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecVecMultExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand() , indices, n ) *
+          elements( (~vector).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/vector division.
+// \ingroup elements
+//
+// \param vector The constant vector/vector division.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the division.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecVecDivExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand() , indices, n ) /
+          elements( (~vector).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/scalar multiplication.
+// \ingroup elements
+//
+// \param vector The constant vector/scalar multiplication.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the multiplication.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecScalarMultExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand(), indices, n ) * (~vector).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/scalar division.
+// \ingroup elements
+//
+// \param vector The constant vector/scalar division.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the division.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecScalarDivExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~vector).leftOperand(), indices, n ) / (~vector).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector custom operation.
+// \ingroup elements
+//
+// \param vector The constant vector custom operation.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the custom operation.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecForEachExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return forEach( elements( (~vector).operand(), indices, n ), (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector evaluation operation.
+// \ingroup elements
+//
+// \param vector The constant vector evaluation operation.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the evaluation operation.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecEvalExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return eval( elements( (~vector).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector serialization operation.
+// \ingroup elements
+//
+// \param vector The constant vector serialization operation.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the serialization operation.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecSerialExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serial( elements( (~vector).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector transpose operation.
+// \ingroup elements
+//
+// \param vector The constant vector transpose operation.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the transpose operation.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsVecTransExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return trans( elements( (~vector).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given matrix/vector multiplication.
+// \ingroup elements
+//
+// \param vector The constant matrix/vector multiplication.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the multiplication.
+//
+// This function restructures the selection of elements of the matrix/vector multiplication
+// \f$ A*\vec{x} \f$ into the multiplication of the according rows of \f$ A \f$ with
+// \f$ \vec{x} \f$, i.e. only the selected elements are computed.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsMatVecMultExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~vector).leftOperand(), indices, n ) * (~vector).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given vector/matrix multiplication.
+// \ingroup elements
+//
+// \param vector The constant vector/matrix multiplication.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the multiplication.
+//
+// This function restructures the selection of elements of the vector/matrix multiplication
+// \f$ \vec{x}^T*A \f$ into the multiplication of \f$ \vec{x}^T \f$ with the according columns
+// of \f$ A \f$, i.e. only the selected elements are computed.
+*/
+template< typename VT  // Type of the vector
+        , bool TF      // Transpose flag
+        , EnableIf_< IsTVecMatMultExpr<VT> >* = nullptr >
+inline decltype(auto) elements( const DenseVector<VT,TF>& vector, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return (~vector).leftOperand() * columns( (~vector).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of another element selection.
+// \ingroup elements
+//
+// \param e The constant element selection.
+// \param indices Pointer to the first index of the selected elements.
+// \param n The number of selected elements.
+// \return View on the selected elements of the given element selection.
+// \exception std::invalid_argument Invalid element access index.
+//
+// This function returns an element selection on the underlying vector of the given element selection,
+// whose index list is composed from the two index lists.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementSelection<VT,TF>
+   elements( const ElementSelection<VT,TF>& e, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::vector<size_t> tmp( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( e.size() <= indices[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid element access index" );
+      }
+      tmp[i] = e.idx( indices[i] );
+   }
+
+   return ElementSelection<VT,TF>( e.operand(), tmp.data(), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given element selection.
+// \ingroup elements
+//
+// \param e The constant element selection.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the element selection.
+// \exception std::invalid_argument Invalid subvector specification.
+//
+// This function returns an element selection on the underlying vector of the given element selection,
+// which selects the specified consecutive range of the given element selection.
+*/
+template< bool AF      // Alignment flag
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const ElementSelection<VT,TF>
+   subvector( const ElementSelection<VT,TF>& e, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( index + size > e.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid subvector specification" );
+   }
+
+   return ElementSelection<VT,TF>( e.operand(), e.indices().data() + index, size );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, typename T >
+struct AddTrait< ElementSelection<VT,TF>, T >
+{
+   using Type = AddTrait_< SubvectorTrait_<VT>, T >;
+};
+
+template< typename T, typename VT, bool TF >
+struct AddTrait< T, ElementSelection<VT,TF> >
+{
+   using Type = AddTrait_< T, SubvectorTrait_<VT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, typename T >
+struct SubTrait< ElementSelection<VT,TF>, T >
+{
+   using Type = SubTrait_< SubvectorTrait_<VT>, T >;
+};
+
+template< typename T, typename VT, bool TF >
+struct SubTrait< T, ElementSelection<VT,TF> >
+{
+   using Type = SubTrait_< T, SubvectorTrait_<VT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, typename T >
+struct MultTrait< ElementSelection<VT,TF>, T >
+{
+   using Type = MultTrait_< SubvectorTrait_<VT>, T >;
+};
+
+template< typename T, typename VT, bool TF >
+struct MultTrait< T, ElementSelection<VT,TF> >
+{
+   using Type = MultTrait_< T, SubvectorTrait_<VT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CROSSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, typename T >
+struct CrossTrait< ElementSelection<VT,TF>, T >
+{
+   using Type = CrossTrait_< SubvectorTrait_<VT>, T >;
+};
+
+template< typename T, typename VT, bool TF >
+struct CrossTrait< T, ElementSelection<VT,TF> >
+{
+   using Type = CrossTrait_< T, SubvectorTrait_<VT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, typename T >
+struct DivTrait< ElementSelection<VT,TF>, T >
+{
+   using Type = DivTrait_< SubvectorTrait_<VT>, T >;
+};
+
+template< typename T, typename VT, bool TF >
+struct DivTrait< T, ElementSelection<VT,TF> >
+{
+   using Type = DivTrait_< T, SubvectorTrait_<VT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF >
+struct SubvectorTrait< ElementSelection<VT,TF> >
+{
+   using Type = SubvectorTrait_<VT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTOREXPRTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, bool AF >
+struct SubvectorExprTrait< ElementSelection<VT,TF>, AF >
+{
+   using Type = ElementSelection<VT,TF>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, bool AF >
+struct SubvectorExprTrait< const ElementSelection<VT,TF>, AF >
+{
+   using Type = ElementSelection<VT,TF>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, bool AF >
+struct SubvectorExprTrait< volatile ElementSelection<VT,TF>, AF >
+{
+   using Type = ElementSelection<VT,TF>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF, bool AF >
+struct SubvectorExprTrait< const volatile ElementSelection<VT,TF>, AF >
+{
+   using Type = ElementSelection<VT,TF>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
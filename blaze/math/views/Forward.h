@@ -44,8 +44,12 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class Band;
 template< typename, bool, bool, bool > class Column;
+template< typename, bool > class ColumnSelection;
+template< typename, bool > class ElementSelection;
 template< typename, bool, bool, bool > class Row;
+template< typename, bool > class RowSelection;
 template< typename, bool, bool, bool > class Submatrix;
 template< typename, bool, bool, bool > class Subvector;
 
@@ -0,0 +1,3148 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/RowSelection.h
+//  \brief Header file for the implementation of the RowSelection view
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_ROWSELECTION_H_
+#define _BLAZE_MATH_VIEWS_ROWSELECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransExpr.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDeclExpr.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatEvalExpr.h>
+#include <blaze/math/typetraits/IsMatForEachExpr.h>
+#include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatMatSubExpr.h>
+#include <blaze/math/typetraits/IsMatScalarDivExpr.h>
+#include <blaze/math/typetraits/IsMatScalarMultExpr.h>
+#include <blaze/math/typetraits/IsMatSerialExpr.h>
+#include <blaze/math/typetraits/IsMatTransExpr.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsTransExpr.h>
+#include <blaze/math/typetraits/IsVecTVecMultExpr.h>
+#include <blaze/math/views/ElementSelection.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup rows Row selections
+// \ingroup views
+*/
+/*!\brief View on an arbitrary selection of rows of a dense matrix.
+// \ingroup rows
+//
+// The RowSelection class template represents a view on a selection of rows of a dense matrix. The
+// selection is given by a list of row indices, which don't have to be sorted and which may
+// contain the same index several times. The view itself is a dense matrix with as many rows as
+// indices and the same number of columns as the underlying matrix. A row selection can be created
+// via the rows() function:
+
+   \code
+   blaze::DynamicMatrix<float,blaze::rowMajor> X( 60000UL, 784UL );
+   // ... Initialization
+
+   // Extracting a minibatch of 64 randomly selected samples
+   std::vector<size_t> batch( 64UL );
+   // ... Initialization of the sample indices
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> B( rows( X, batch ) );
+
+   // Scattering updated samples back into the data set
+   rows( X, batch ) = B;
+   \endcode
+
+// The view can be used in all dense matrix expressions and can be the target of all dense matrix
+// assignments. In case of a row-major matrix the rows are accessed directly via the iterators of
+// the underlying matrix. In case of a column-major matrix the selected elements of each column
+// are loaded via SIMD gather instructions and stored via SIMD scatter instructions (given that
+// the element type provides SIMD gather operations, see the HasSIMDGather type trait). Large
+// assignments to and from row selections are parallelized in SMP assignments. RowSelection views can also be
+// created for matrix expressions, in which case only the selected rows are computed:
+
+   \code
+   blaze::DynamicMatrix<float,blaze::rowMajor> W( 784UL, 128UL ), H;
+
+   H = rows( X * W, batch );  // Only computes the 64 selected rows of X*W
+   \endcode
+
+// Note that in case a row selection is the target of an assignment and the index list contains the
+// same index several times, the final content of the repeatedly referenced row is unspecified.
+// Also note that row selections can only be created for dense matrices that provide references to
+// their elements (i.e. not for adaptors).
+*/
+template< typename MT                               // Type of the dense matrix
+        , bool SO = IsColumnMajorMatrix<MT>::value >  // Storage order
+class RowSelection : public DenseMatrix< RowSelection<MT,SO>, SO >
+                   , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense matrix expression.
+   typedef If_< IsExpression<MT>, MT, MT& >  Operand;
+   //**********************************************************************************************
+
+   //**RowSelectionIterator class definition*******************************************************
+   /*!\brief Iterator over the selected elements of a column of a column-major matrix.
+   */
+   template< typename MatrixType       // Type of the dense matrix
+           , typename ReferenceType >  // Reference return type
+   class RowSelectionIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef ElementType_<MatrixType>         ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+      typedef SIMDTrait_<ValueType>            SIMDType;          //!< SIMD type of the elements.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the RowSelectionIterator class.
+      */
+      inline RowSelectionIterator() noexcept
+         : matrix_( nullptr )  // The dense matrix containing the column
+         , column_( 0UL     )  // The index of the column
+         , index_ ( nullptr )  // Pointer to the row index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the RowSelectionIterator class.
+      //
+      // \param matrix The dense matrix containing the column.
+      // \param column The index of the column.
+      // \param index Pointer to the row index of the initial element.
+      */
+      inline RowSelectionIterator( MatrixType& matrix, size_t column, const size_t* index ) noexcept
+         : matrix_( &matrix )  // The dense matrix containing the column
+         , column_( column  )  // The index of the column
+         , index_ ( index   )  // Pointer to the row index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different RowSelectionIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2, typename ReferenceType2 >
+      inline RowSelectionIterator( const RowSelectionIterator<MatrixType2,ReferenceType2>& it ) noexcept
+         : matrix_( it.matrix_ )  // The dense matrix containing the column
+         , column_( it.column_ )  // The index of the column
+         , index_ ( it.index_  )  // Pointer to the row index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline RowSelectionIterator& operator+=( size_t inc ) noexcept {
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline RowSelectionIterator& operator-=( size_t dec ) noexcept {
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline RowSelectionIterator& operator++() noexcept {
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const RowSelectionIterator operator++( int ) noexcept {
+         const RowSelectionIterator tmp( *this );
+         ++index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline RowSelectionIterator& operator--() noexcept {
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const RowSelectionIterator operator--( int ) noexcept {
+         const RowSelectionIterator tmp( *this );
+         --index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)(*index_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function gathers the next SIMD element of the column from the underlying dense
+      // matrix. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return gather( matrix_->data( column_ ), index_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // Since the selected elements are not contiguous, this function is identical to the
+      // load() function. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // Since the selected elements are not contiguous, this function is identical to the
+      // load() function. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function scatters the given SIMD element to the according elements of the column
+      // of the underlying dense matrix. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates.
+      // Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      inline void store( const SIMDType& value ) const noexcept {
+         scatter( matrix_->data( column_ ), index_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the selected elements are not contiguous, this function is identical to the
+      // store() function. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the selected elements are not contiguous, this function is identical to the
+      // store() function. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the selected elements are not contiguous, this function is identical to the
+      // store() function. This function must \b NOT be called explicitly! It is used internally
+      // for the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two RowSelectionIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const RowSelectionIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a RowSelectionIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const RowSelectionIterator operator+( const RowSelectionIterator& it, size_t inc ) noexcept {
+         return RowSelectionIterator( *it.matrix_, it.column_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a RowSelectionIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const RowSelectionIterator operator+( size_t inc, const RowSelectionIterator& it ) noexcept {
+         return RowSelectionIterator( *it.matrix_, it.column_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a RowSelectionIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const RowSelectionIterator operator-( const RowSelectionIterator& it, size_t dec ) noexcept {
+         return RowSelectionIterator( *it.matrix_, it.column_, it.index_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType*   matrix_;  //!< The dense matrix containing the column.
+      size_t        column_;  //!< The index of the column.
+      const size_t* index_;   //!< Pointer to the row index of the current element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename ReferenceType2 > friend class RowSelectionIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef RowSelection<MT,SO>         This;            //!< Type of this RowSelection instance.
+   typedef DenseMatrix<This,SO>        BaseType;        //!< Base type of this RowSelection instance.
+   typedef SubmatrixTrait_<MT>         ResultType;      //!< Result type for expression template evaluations.
+   typedef OppositeType_<ResultType>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef TransposeType_<ResultType>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef ElementType_<MT>            ElementType;     //!< Type of the selected elements.
+   typedef SIMDTrait_<ElementType>     SIMDType;        //!< SIMD type of the selected elements.
+   typedef ReturnType_<MT>             ReturnType;      //!< Return type for expression template evaluations.
+   typedef const RowSelection&         CompositeType;   //!< Data type for composite expression templates.
+   typedef ConstReference_<MT>         ConstReference;  //!< Reference to a constant element value.
+
+   //! Reference to a non-constant element value.
+   typedef If_< IsConst<MT>, ConstReference, Reference_<MT> >  Reference;
+
+   //! Iterator over constant elements.
+   typedef IfTrue_< SO, RowSelectionIterator<const MT,ConstReference>, ConstIterator_<MT> >  ConstIterator;
+
+   //! Iterator over non-constant elements.
+   typedef If_< IsConst<MT>
+              , ConstIterator
+              , IfTrue_< SO, RowSelectionIterator<MT,Reference>, Iterator_<MT> > >  Iterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = MT::simdEnabled &&
+                               ( !SO || ( HasSIMDGather<ElementType>::value &&
+                                          HasConstDataAccess<MT>::value ) ) };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline RowSelection( Operand matrix, const size_t* indices, size_t n );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline RowSelection& operator=( const ElementType& rhs );
+   inline RowSelection& operator=( const RowSelection& rhs );
+
+   template< typename MT2, bool SO2 > inline RowSelection& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline RowSelection& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline RowSelection& operator-=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline RowSelection& operator*=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, RowSelection >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, RowSelection >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Operand                    operand() const noexcept;
+   inline size_t                     idx( size_t i ) const noexcept;
+   inline const std::vector<size_t>& indices() const noexcept;
+   inline size_t                     rows() const noexcept;
+   inline size_t                     columns() const noexcept;
+   inline size_t                     capacity() const noexcept;
+   inline size_t                     capacity( size_t i ) const noexcept;
+   inline size_t                     nonZeros() const;
+   inline size_t                     nonZeros( size_t i ) const;
+   inline void                       reset();
+   inline void                       reset( size_t i );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Iterator functions**************************************************************************
+   /*!\name Iterator functions */
+   //@{
+   inline Iterator      iterator( size_t k, size_t l, TrueType  );
+   inline Iterator      iterator( size_t k, size_t l, FalseType );
+   inline ConstIterator iterator( size_t k, size_t l, TrueType  ) const;
+   inline ConstIterator iterator( size_t k, size_t l, FalseType ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2, bool SO2 >
+   struct VectorizedAssign {
+      enum : bool { value = useOptimizedKernels && SO2 == SO &&
+                            simdEnabled && MT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2, bool SO2 >
+   struct VectorizedAddAssign {
+      enum : bool { value = useOptimizedKernels && SO2 == SO &&
+                            simdEnabled && MT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<MT2> >::value &&
+                            HasSIMDAdd< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2, bool SO2 >
+   struct VectorizedSubAssign {
+      enum : bool { value = useOptimizedKernels && SO2 == SO &&
+                            simdEnabled && MT2::simdEnabled &&
+                            IsSIMDCombinable< ElementType, ElementType_<MT2> >::value &&
+                            HasSIMDSub< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2, bool SO2 >
+   inline DisableIf_< VectorizedAssign<MT2,SO2> > assign( const DenseMatrix<MT2,SO2>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< VectorizedAssign<MT2,SO> > assign( const DenseMatrix<MT2,SO>& rhs );
+
+   template< typename MT2, bool SO2 > inline void assign( const SparseMatrix<MT2,SO2>& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline DisableIf_< VectorizedAddAssign<MT2,SO2> > addAssign( const DenseMatrix<MT2,SO2>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< VectorizedAddAssign<MT2,SO> > addAssign( const DenseMatrix<MT2,SO>& rhs );
+
+   template< typename MT2, bool SO2 > inline void addAssign( const SparseMatrix<MT2,SO2>& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline DisableIf_< VectorizedSubAssign<MT2,SO2> > subAssign( const DenseMatrix<MT2,SO2>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< VectorizedSubAssign<MT2,SO> > subAssign( const DenseMatrix<MT2,SO>& rhs );
+
+   template< typename MT2, bool SO2 > inline void subAssign( const SparseMatrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand             matrix_;   //!< The dense matrix containing the rows.
+   std::vector<size_t> indices_;  //!< The indices of the selected rows.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE  ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE  ( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for RowSelection.
+//
+// \param matrix The dense matrix containing the rows.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \exception std::invalid_argument Invalid row access index.
+//
+// In case any of the given indices is greater than or equal to the number of rows of the given
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline RowSelection<MT,SO>::RowSelection( Operand matrix, const size_t* indices, size_t n )
+   : matrix_ ( matrix )              // The dense matrix containing the rows
+   , indices_( indices, indices+n )  // The indices of the selected rows
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      if( matrix_.rows() <= indices_[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid row access index" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the elements of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Reference RowSelection<MT,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return matrix_(indices_[i],j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the elements of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstReference RowSelection<MT,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return const_cast<const MT&>( matrix_ )(indices_[i],j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the elements of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Reference RowSelection<MT,SO>::at( size_t i, size_t j )
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the elements of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstReference RowSelection<MT,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of the selected row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Iterator RowSelection<MT,SO>::begin( size_t i )
+{
+   return iterator( i, 0UL, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of the selected row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::begin( size_t i ) const
+{
+   return iterator( i, 0UL, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of the selected row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::cbegin( size_t i ) const
+{
+   return iterator( i, 0UL, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of the selected row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Iterator RowSelection<MT,SO>::end( size_t i )
+{
+   return iterator( i, ( SO ? rows() : columns() ), BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of the selected row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::end( size_t i ) const
+{
+   return iterator( i, ( SO ? rows() : columns() ), BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of the selected row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last selected element of column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::cend( size_t i ) const
+{
+   return iterator( i, ( SO ? rows() : columns() ), BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the selected element \a l of column \a k of a column-major matrix.
+//
+// \param k The column index.
+// \param l The index of the selected element within the column.
+// \return Iterator to the according element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Iterator RowSelection<MT,SO>::iterator( size_t k, size_t l, TrueType )
+{
+   return Iterator( matrix_, k, indices_.data() + l );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element \a l of the selected row \a k of a row-major matrix.
+//
+// \param k The row index.
+// \param l The column index.
+// \return Iterator to the according element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Iterator RowSelection<MT,SO>::iterator( size_t k, size_t l, FalseType )
+{
+   return matrix_.begin( indices_[k] ) + l;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the selected element \a l of column \a k of a column-major matrix.
+//
+// \param k The column index.
+// \param l The index of the selected element within the column.
+// \return Iterator to the according element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::iterator( size_t k, size_t l, TrueType ) const
+{
+   return ConstIterator( matrix_, k, indices_.data() + l );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element \a l of the selected row \a k of a row-major matrix.
+//
+// \param k The row index.
+// \param l The column index.
+// \return Iterator to the according element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::ConstIterator RowSelection<MT,SO>::iterator( size_t k, size_t l, FalseType ) const
+{
+   return matrix_.cbegin( indices_[k] ) + l;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all elements of the row selection.
+//
+// \param rhs Scalar value to be assigned to all selected elements.
+// \return Reference to the assigned row selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator=( const ElementType& rhs )
+{
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         matrix_(indices_[i],j) = rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for RowSelection.
+//
+// \param rhs RowSelection view to be copied.
+// \return Reference to the assigned row selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two views don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator=( const RowSelection& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   return operator=( static_cast<const Matrix<RowSelection,SO>&>( rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned row selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<MT2> );
+
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      if( IsSparseMatrix<MT2>::value )
+         reset();
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseMatrix<MT2>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the row selection.
+// \return Reference to the row selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<MT2> );
+
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the row selection.
+// \return Reference to the row selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<MT2> );
+
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType_<MT2> tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the row selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the number of columns of the row selection doesn't match the number of rows of the given
+// matrix or the given matrix is not a square matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline RowSelection<MT,SO>& RowSelection<MT,SO>::operator*=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE  ( ResultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_<MT2> );
+
+   typedef MultTrait_< ResultType, ResultType_<MT2> >  MultType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE  ( MultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MultType );
+
+   if( columns() != (~rhs).rows() || (~rhs).rows() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const MultType tmp( *this * (~rhs) );
+   smpAssign( *this, tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a row selection and a
+//        scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the row selection.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, RowSelection<MT,SO> >& RowSelection<MT,SO>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a row selection by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the row selection.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, RowSelection<MT,SO> >& RowSelection<MT,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the matrix containing the selected rows.
+//
+// \return The matrix containing the selected rows.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename RowSelection<MT,SO>::Operand RowSelection<MT,SO>::operand() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the \a i-th selected row within the underlying matrix.
+//
+// \param i Access index. The index must be smaller than the number of selected rows.
+// \return The index of the selected row within the underlying matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::idx( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return indices_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the selected rows.
+//
+// \return The indices of the selected rows within the underlying matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const std::vector<size_t>& RowSelection<MT,SO>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of selected rows.
+//
+// \return The number of selected rows.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::rows() const noexcept
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the row selection.
+//
+// \return The number of columns of the row selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the row selection.
+//
+// \return The capacity of the row selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::capacity() const noexcept
+{
+   return rows() * columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::capacity( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < ( SO ? columns() : rows() ), "Invalid row/column access index" );
+
+   return ( SO ? rows() : columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the row selection.
+//
+// \return The number of non-zero elements in the row selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         if( !isDefault( matrix_(indices_[i],j) ) )
+            ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t RowSelection<MT,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? columns() : rows() ), "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   const ConstIterator end( cend( i ) );
+   for( ConstIterator element=cbegin( i ); element!=end; ++element ) {
+      if( !isDefault( *element ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all selected rows of the underlying matrix to their default value. All
+// other elements of the matrix remain unchanged.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void RowSelection<MT,SO>::reset()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         clear( matrix_(indices_[i],j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// In case the storage order is set to \a rowMajor the function resets the values in the
+// selected row \a i, in case the storage order is set to \a columnMajor the function resets
+// the selected values in column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void RowSelection<MT,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < ( SO ? columns() : rows() ), "Invalid row/column access index" );
+
+   const Iterator end( this->end( i ) );
+   for( Iterator element=begin( i ); element!=end; ++element ) {
+      clear( *element );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the row selection can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this row selection, \a false if not.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool RowSelection<MT,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the row selection is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this row selection, \a false if not.
+*/
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool RowSelection<MT,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the row selection is properly aligned in memory.
+//
+// \return \a true in case the row selection is aligned, \a false if not.
+//
+// In case of a row-major matrix the selected rows are aligned in case the rows of the
+// underlying matrix are aligned. In case of a column-major matrix the selected elements of
+// the columns are not contiguous and the view is never considered to be aligned.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool RowSelection<MT,SO>::isAligned() const noexcept
+{
+   return !SO && matrix_.isAligned();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the row selection can be used in SMP assignments.
+//
+// \return \a true in case the row selection can be used in SMP assignments, \a false if not.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool RowSelection<MT,SO>::canSMPAssign() const noexcept
+{
+   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE typename RowSelection<MT,SO>::SIMDType
+   RowSelection<MT,SO>::load( size_t i, size_t j ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   return iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).load();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE typename RowSelection<MT,SO>::SIMDType
+   RowSelection<MT,SO>::loada( size_t i, size_t j ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   return iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).loada();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE typename RowSelection<MT,SO>::SIMDType
+   RowSelection<MT,SO>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   return iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).loadu();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE void
+   RowSelection<MT,SO>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).store( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE void
+   RowSelection<MT,SO>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).storea( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE void
+   RowSelection<MT,SO>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).storeu( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the row selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE void
+   RowSelection<MT,SO>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   iterator( ( SO ? j : i ), ( SO ? i : j ), BoolConstant<SO>() ).stream( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT2,SO2> >
+   RowSelection<MT,SO>::assign( const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 != SO ) {
+      for( size_t ii=0UL; ii<rows(); ii+=BLOCK_SIZE ) {
+         const size_t iend( min( rows(), ii+BLOCK_SIZE ) );
+         for( size_t jj=0UL; jj<columns(); jj+=BLOCK_SIZE ) {
+            const size_t jend( min( columns(), jj+BLOCK_SIZE ) );
+            for( size_t i=ii; i<iend; ++i ) {
+               for( size_t j=jj; j<jend; ++j ) {
+                  matrix_(indices_[i],j) = (~rhs)(i,j);
+               }
+            }
+         }
+      }
+   }
+   else if( SO ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         for( size_t i=0UL; i<rows(); ++i ) {
+            matrix_(indices_[i],j) = (~rhs)(i,j);
+         }
+      }
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i ) {
+         for( size_t j=0UL; j<columns(); ++j ) {
+            matrix_(indices_[i],j) = (~rhs)(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT2,SO> >
+   RowSelection<MT,SO>::assign( const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( SO ? columns() : rows() );
+   const size_t N( SO ? rows() : columns() );
+   const size_t kpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % (SIMDSIZE) ) ) == kpos, "Invalid end calculation" );
+
+   for( size_t l=0UL; l<M; ++l )
+   {
+      size_t k( 0UL );
+      Iterator left( begin(l) );
+      ConstIterator_<MT2> right( (~rhs).begin(l) );
+
+      for( ; (k+SIMDSIZE*3UL) < kpos; k+=SIMDSIZE*4UL ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<kpos; k+=SIMDSIZE ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<N; ++k ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void RowSelection<MT,SO>::assign( const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 ) {
+      for( size_t j=0UL; j<columns(); ++j )
+         for( ConstIterator_<MT2> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            matrix_(indices_[element->index()],j) = element->value();
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i )
+         for( ConstIterator_<MT2> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            matrix_(indices_[i],element->index()) = element->value();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT2,SO2> >
+   RowSelection<MT,SO>::addAssign( const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 != SO ) {
+      for( size_t ii=0UL; ii<rows(); ii+=BLOCK_SIZE ) {
+         const size_t iend( min( rows(), ii+BLOCK_SIZE ) );
+         for( size_t jj=0UL; jj<columns(); jj+=BLOCK_SIZE ) {
+            const size_t jend( min( columns(), jj+BLOCK_SIZE ) );
+            for( size_t i=ii; i<iend; ++i ) {
+               for( size_t j=jj; j<jend; ++j ) {
+                  matrix_(indices_[i],j) += (~rhs)(i,j);
+               }
+            }
+         }
+      }
+   }
+   else if( SO ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         for( size_t i=0UL; i<rows(); ++i ) {
+            matrix_(indices_[i],j) += (~rhs)(i,j);
+         }
+      }
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i ) {
+         for( size_t j=0UL; j<columns(); ++j ) {
+            matrix_(indices_[i],j) += (~rhs)(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT2,SO> >
+   RowSelection<MT,SO>::addAssign( const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( SO ? columns() : rows() );
+   const size_t N( SO ? rows() : columns() );
+   const size_t kpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % (SIMDSIZE) ) ) == kpos, "Invalid end calculation" );
+
+   for( size_t l=0UL; l<M; ++l )
+   {
+      size_t k( 0UL );
+      Iterator left( begin(l) );
+      ConstIterator_<MT2> right( (~rhs).begin(l) );
+
+      for( ; (k+SIMDSIZE*3UL) < kpos; k+=SIMDSIZE*4UL ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<kpos; k+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<N; ++k ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void RowSelection<MT,SO>::addAssign( const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 ) {
+      for( size_t j=0UL; j<columns(); ++j )
+         for( ConstIterator_<MT2> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            matrix_(indices_[element->index()],j) += element->value();
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i )
+         for( ConstIterator_<MT2> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            matrix_(indices_[i],element->index()) += element->value();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT2,SO2> >
+   RowSelection<MT,SO>::subAssign( const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 != SO ) {
+      for( size_t ii=0UL; ii<rows(); ii+=BLOCK_SIZE ) {
+         const size_t iend( min( rows(), ii+BLOCK_SIZE ) );
+         for( size_t jj=0UL; jj<columns(); jj+=BLOCK_SIZE ) {
+            const size_t jend( min( columns(), jj+BLOCK_SIZE ) );
+            for( size_t i=ii; i<iend; ++i ) {
+               for( size_t j=jj; j<jend; ++j ) {
+                  matrix_(indices_[i],j) -= (~rhs)(i,j);
+               }
+            }
+         }
+      }
+   }
+   else if( SO ) {
+      for( size_t j=0UL; j<columns(); ++j ) {
+         for( size_t i=0UL; i<rows(); ++i ) {
+            matrix_(indices_[i],j) -= (~rhs)(i,j);
+         }
+      }
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i ) {
+         for( size_t j=0UL; j<columns(); ++j ) {
+            matrix_(indices_[i],j) -= (~rhs)(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename RowSelection<MT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT2,SO> >
+   RowSelection<MT,SO>::subAssign( const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( SO ? columns() : rows() );
+   const size_t N( SO ? rows() : columns() );
+   const size_t kpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % (SIMDSIZE) ) ) == kpos, "Invalid end calculation" );
+
+   for( size_t l=0UL; l<M; ++l )
+   {
+      size_t k( 0UL );
+      Iterator left( begin(l) );
+      ConstIterator_<MT2> right( (~rhs).begin(l) );
+
+      for( ; (k+SIMDSIZE*3UL) < kpos; k+=SIMDSIZE*4UL ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<kpos; k+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; k<N; ++k ) {
+         *left -= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2    // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void RowSelection<MT,SO>::subAssign( const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 ) {
+      for( size_t j=0UL; j<columns(); ++j )
+         for( ConstIterator_<MT2> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            matrix_(indices_[element->index()],j) -= element->value();
+   }
+   else {
+      for( size_t i=0UL; i<rows(); ++i )
+         for( ConstIterator_<MT2> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            matrix_(indices_[i],element->index()) -= element->value();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name RowSelection operators */
+//@{
+template< typename MT, bool SO >
+inline void reset( RowSelection<MT,SO>& r );
+
+template< typename MT, bool SO >
+inline void reset( RowSelection<MT,SO>& r, size_t i );
+
+template< typename MT, bool SO >
+inline void clear( RowSelection<MT,SO>& r );
+
+template< typename MT, bool SO >
+inline bool isDefault( const RowSelection<MT,SO>& r );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given row selection.
+// \ingroup rows
+//
+// \param r The row selection to be resetted.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void reset( RowSelection<MT,SO>& r )
+{
+   r.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given row selection.
+// \ingroup rows
+//
+// \param r The row selection to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given row selection to their
+// default value. In case the storage order is set to \a rowMajor the function resets the values
+// in row \a i, in case the storage order is set to \a columnMajor the function resets the
+// values in column \a i.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void reset( RowSelection<MT,SO>& r, size_t i )
+{
+   r.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given row selection.
+// \ingroup rows
+//
+// \param r The row selection to be cleared.
+// \return void
+//
+// Clearing a row selection is equivalent to resetting it via the reset() function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void clear( RowSelection<MT,SO>& r )
+{
+   r.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given row selection is in default state.
+// \ingroup rows
+//
+// \param r The row selection to be tested for its default state.
+// \return \a true in case all selected elements are in default state, \a false otherwise.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool isDefault( const RowSelection<MT,SO>& r )
+{
+   for( size_t i=0UL; i<r.rows(); ++i ) {
+      for( size_t j=0UL; j<r.columns(); ++j ) {
+         if( !isDefault( r(i,j) ) ) return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of rows of the given dense matrix.
+// \ingroup rows
+//
+// \param matrix The dense matrix containing the rows.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the given matrix.
+// \exception std::invalid_argument Invalid row access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline DisableIf_< Or< IsComputation<MT>, IsTransExpr<MT>, IsDeclExpr<MT> >, RowSelection<MT> >
+   rows( DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return RowSelection<MT>( ~matrix, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of rows of the given constant dense matrix.
+// \ingroup rows
+//
+// \param matrix The constant dense matrix containing the rows.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the given matrix.
+// \exception std::invalid_argument Invalid row access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DisableIf_< Or< IsComputation<MT>, IsTransExpr<MT>, IsDeclExpr<MT> >, RowSelection<const MT> >
+   rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return RowSelection<const MT>( ~matrix, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of rows of the given temporary dense matrix.
+// \ingroup rows
+//
+// \param matrix The temporary dense matrix containing the rows.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the given matrix.
+// \exception std::invalid_argument Invalid row access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline DisableIf_< Or< IsComputation<MT>, IsTransExpr<MT>, IsDeclExpr<MT> >, RowSelection<MT> >
+   rows( DenseMatrix<MT,SO>&& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return RowSelection<MT>( ~matrix, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of rows of the given dense matrix.
+// \ingroup rows
+//
+// \param matrix The dense matrix containing the rows.
+// \param indices The indices of the selected rows.
+// \return View on the selected rows of the given matrix.
+// \exception std::invalid_argument Invalid row access index.
+//
+// This function returns an expression representing the selected rows of the given dense
+// matrix or dense matrix expression:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 20UL );
+   // ... Initialization
+
+   auto r = rows( A, { 2UL, 7UL, 7UL, 42UL } );
+   \endcode
+*/
+template< typename MT >  // Type of the dense matrix
+inline decltype(auto) rows( MT&& matrix, initializer_list<size_t> indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( std::forward<MT>( matrix ), indices.begin(), indices.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of rows of the given dense matrix.
+// \ingroup rows
+//
+// \param matrix The dense matrix containing the rows.
+// \param indices The indices of the selected rows.
+// \return View on the selected rows of the given matrix.
+// \exception std::invalid_argument Invalid row access index.
+//
+// This function returns an expression representing the selected rows of the given dense
+// matrix or dense matrix expression. The given indices are copied into the view, i.e. the
+// given \c std::vector can be modified or destroyed afterwards.
+*/
+template< typename MT >  // Type of the dense matrix
+inline decltype(auto) rows( MT&& matrix, const std::vector<size_t>& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( std::forward<MT>( matrix ), indices.data(), indices.size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix/matrix addition.
+// \ingroup rows
+//
+// \param matrix The constant matrix/matrix addition.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the addition.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatMatAddExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).leftOperand() , indices, n ) +
+          rows( (~matrix).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix/matrix subtraction.
+// \ingroup rows
+//
+// \param matrix The constant matrix/matrix subtraction.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the subtraction.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatMatSubExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).leftOperand() , indices, n ) -
+          rows( (~matrix).rightOperand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix/matrix multiplication.
+// \ingroup rows
+//
+// \param matrix The constant matrix/matrix multiplication.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the multiplication.
+//
+// This function restructures the selection of rows of the matrix/matrix multiplication
+// \f$ A*B \f$ into the multiplication of the according rows of \f$ A \f$ with \f$ B \f$,
+// i.e. only the selected rows are computed.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatMatMultExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).leftOperand(), indices, n ) * (~matrix).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given outer product.
+// \ingroup rows
+//
+// \param matrix The constant outer product.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the outer product.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsVecTVecMultExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return elements( (~matrix).leftOperand(), indices, n ) * (~matrix).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix/scalar multiplication.
+// \ingroup rows
+//
+// \param matrix The constant matrix/scalar multiplication.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the multiplication.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatScalarMultExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).leftOperand(), indices, n ) * (~matrix).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix/scalar division.
+// \ingroup rows
+//
+// \param matrix The constant matrix/scalar division.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the division.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatScalarDivExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).leftOperand(), indices, n ) / (~matrix).rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix custom operation.
+// \ingroup rows
+//
+// \param matrix The constant matrix custom operation.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the custom operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatForEachExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return forEach( rows( (~matrix).operand(), indices, n ), (~matrix).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix evaluation operation.
+// \ingroup rows
+//
+// \param matrix The constant matrix evaluation operation.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the evaluation operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatEvalExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return eval( rows( (~matrix).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix serialization operation.
+// \ingroup rows
+//
+// \param matrix The constant matrix serialization operation.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the serialization operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatSerialExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return serial( rows( (~matrix).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix declaration operation.
+// \ingroup rows
+//
+// \param matrix The constant matrix declaration operation.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the declaration operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsDeclExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows( (~matrix).operand(), indices, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given matrix transpose operation.
+// \ingroup rows
+//
+// \param matrix The constant matrix transpose operation.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the transpose operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order
+        , EnableIf_< IsMatTransExpr<MT> >* = nullptr >
+inline decltype(auto) rows( const DenseMatrix<MT,SO>& matrix, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return trans( columns( (~matrix).operand(), indices, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of another row selection.
+// \ingroup rows
+//
+// \param r The constant row selection.
+// \param indices Pointer to the first index of the selected rows.
+// \param n The number of selected rows.
+// \return View on the selected rows of the given row selection.
+// \exception std::invalid_argument Invalid row access index.
+//
+// This function returns a row selection on the underlying matrix of the given row selection, whose
+// index list is composed from the two index lists.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const RowSelection<MT,SO>
+   rows( const RowSelection<MT,SO>& r, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::vector<size_t> tmp( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( r.rows() <= indices[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid row access index" );
+      }
+      tmp[i] = r.idx( indices[i] );
+   }
+
+   return RowSelection<MT,SO>( r.operand(), tmp.data(), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific row of the given row selection.
+// \ingroup rows
+//
+// \param r The constant row selection.
+// \param index The index of the row.
+// \return View on the specified row of the underlying matrix.
+// \exception std::invalid_argument Invalid row access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline RowExprTrait_<MT> row( const RowSelection<MT,SO>& r, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( r.rows() <= index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row access index" );
+   }
+
+   return row( r.operand(), r.idx( index ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific column of the given row selection.
+// \ingroup rows
+//
+// \param r The constant row selection.
+// \param index The index of the column.
+// \return View on the selected elements of the column of the underlying matrix.
+// \exception std::invalid_argument Invalid column access index.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementSelection< ColumnExprTrait_<MT> > column( const RowSelection<MT,SO>& r, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ElementSelection< ColumnExprTrait_<MT> >( column( r.operand(), index ), r.indices().data(), r.rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific submatrix of the given row selection.
+// \ingroup rows
+//
+// \param r The constant row selection.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return View on the specified submatrix of the row selection.
+// \exception std::invalid_argument Invalid submatrix specification.
+//
+// This function returns a row selection on the according columns of the underlying matrix, which
+// selects the specified consecutive range of rows of the given row selection.
+*/
+template< bool AF      // Alignment flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const RowSelection< SubmatrixExprTrait_<MT,AF> >
+   submatrix( const RowSelection<MT,SO>& r, size_t row, size_t column, size_t m, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( row + m > r.rows() || column + n > r.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid submatrix specification" );
+   }
+
+   return RowSelection< SubmatrixExprTrait_<MT,AF> >(
+      submatrix<AF>( r.operand(), 0UL, column, r.operand().rows(), n ), r.indices().data() + row, m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename T >
+struct AddTrait< RowSelection<MT,SO>, T >
+{
+   using Type = AddTrait_< SubmatrixTrait_<MT>, T >;
+};
+
+template< typename T, typename MT, bool SO >
+struct AddTrait< T, RowSelection<MT,SO> >
+{
+   using Type = AddTrait_< T, SubmatrixTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename T >
+struct SubTrait< RowSelection<MT,SO>, T >
+{
+   using Type = SubTrait_< SubmatrixTrait_<MT>, T >;
+};
+
+template< typename T, typename MT, bool SO >
+struct SubTrait< T, RowSelection<MT,SO> >
+{
+   using Type = SubTrait_< T, SubmatrixTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename T >
+struct MultTrait< RowSelection<MT,SO>, T >
+{
+   using Type = MultTrait_< SubmatrixTrait_<MT>, T >;
+};
+
+template< typename T, typename MT, bool SO >
+struct MultTrait< T, RowSelection<MT,SO> >
+{
+   using Type = MultTrait_< T, SubmatrixTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename T >
+struct DivTrait< RowSelection<MT,SO>, T >
+{
+   using Type = DivTrait_< SubmatrixTrait_<MT>, T >;
+};
+
+template< typename T, typename MT, bool SO >
+struct DivTrait< T, RowSelection<MT,SO> >
+{
+   using Type = DivTrait_< T, SubmatrixTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct SubmatrixTrait< RowSelection<MT,SO> >
+{
+   using Type = SubmatrixTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXEXPRTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, bool AF >
+struct SubmatrixExprTrait< RowSelection<MT,SO>, AF >
+{
+   using Type = RowSelection< SubmatrixExprTrait_<MT,AF> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, bool AF >
+struct SubmatrixExprTrait< const RowSelection<MT,SO>, AF >
+{
+   using Type = RowSelection< SubmatrixExprTrait_<MT,AF> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, bool AF >
+struct SubmatrixExprTrait< volatile RowSelection<MT,SO>, AF >
+{
+   using Type = RowSelection< SubmatrixExprTrait_<MT,AF> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, bool AF >
+struct SubmatrixExprTrait< const volatile RowSelection<MT,SO>, AF >
+{
+   using Type = RowSelection< SubmatrixExprTrait_<MT,AF> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowTrait< RowSelection<MT,SO> >
+{
+   using Type = RowTrait_< ResultType_< RowSelection<MT,SO> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWEXPRTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowExprTrait< RowSelection<MT,SO> >
+{
+   using Type = RowExprTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowExprTrait< const RowSelection<MT,SO> >
+{
+   using Type = RowExprTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowExprTrait< volatile RowSelection<MT,SO> >
+{
+   using Type = RowExprTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowExprTrait< const volatile RowSelection<MT,SO> >
+{
+   using Type = RowExprTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnTrait< RowSelection<MT,SO> >
+{
+   using Type = ColumnTrait_< ResultType_< RowSelection<MT,SO> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNEXPRTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnExprTrait< RowSelection<MT,SO> >
+{
+   using Type = ElementSelection< ColumnExprTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnExprTrait< const RowSelection<MT,SO> >
+{
+   using Type = ElementSelection< ColumnExprTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnExprTrait< volatile RowSelection<MT,SO> >
+{
+   using Type = ElementSelection< ColumnExprTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnExprTrait< const volatile RowSelection<MT,SO> >
+{
+   using Type = ElementSelection< ColumnExprTrait_<MT> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -53,6 +53,7 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransExpr.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/View.h>
@@ -67,6 +68,8 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -105,6 +108,7 @@
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsReference.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/Unused.h>
 
 
@@ -360,7 +364,10 @@ class Submatrix<MT,unaligned,false,true>
       // result in erroneous results and/or in compilation errors.
       */
       inline void store( const SIMDType& value ) const {
-         storeu( value );
+         if( isAligned_ )
+            storea( value );
+         else
+            storeu( value );
       }
       //*******************************************************************************************
 
@@ -392,12 +399,7 @@ class Submatrix<MT,unaligned,false,true>
       // might result in erroneous results and/or in compilation errors.
       */
       inline void storeu( const SIMDType& value ) const {
-         if( isAligned_ ) {
-            iterator_.storea( value );
-         }
-         else {
-            iterator_.storeu( value );
-         }
+         iterator_.storeu( value );
       }
       //*******************************************************************************************
 
@@ -698,6 +700,17 @@ class Submatrix<MT,unaligned,false,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value &&
+                            HasConstDataAccess<MT2>::value &&
+                            IsSame< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
    //**SIMD properties*****************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -737,7 +750,12 @@ class Submatrix<MT,unaligned,false,true>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -2616,7 +2634,8 @@ inline EnableIf_< typename Submatrix<MT,unaligned,false,true>::BLAZE_TEMPLATE Ve
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
+inline DisableIf_< typename Submatrix<MT,unaligned,false,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -2641,6 +2660,34 @@ inline void Submatrix<MT,unaligned,false,true>::assign( const DenseMatrix<MT2,tr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,unaligned,false,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -3345,7 +3392,10 @@ class Submatrix<MT,unaligned,true,true>
       // result in erroneous results and/or in compilation errors.
       */
       inline void store( const SIMDType& value ) const {
-         storeu( value );
+         if( isAligned_ )
+            storea( value );
+         else
+            storeu( value );
       }
       //*******************************************************************************************
 
@@ -3377,12 +3427,7 @@ class Submatrix<MT,unaligned,true,true>
       // might result in erroneous results and/or in compilation errors.
       */
       inline void storeu( const SIMDType& value ) const {
-         if( isAligned_ ) {
-            iterator_.storea( value );
-         }
-         else {
-            iterator_.storeu( value );
-         }
+         iterator_.storeu( value );
       }
       //*******************************************************************************************
 
@@ -3683,6 +3728,17 @@ class Submatrix<MT,unaligned,true,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value &&
+                            HasConstDataAccess<MT2>::value &&
+                            IsSame< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
    //**SIMD properties*****************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -3722,7 +3778,12 @@ class Submatrix<MT,unaligned,true,true>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -5556,7 +5617,8 @@ inline EnableIf_< typename Submatrix<MT,unaligned,true,true>::BLAZE_TEMPLATE Vec
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
+inline DisableIf_< typename Submatrix<MT,unaligned,true,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -5581,6 +5643,34 @@ inline void Submatrix<MT,unaligned,true,true>::assign( const DenseMatrix<MT2,fal
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,unaligned,true,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -6221,6 +6311,17 @@ class Submatrix<MT,aligned,false,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value &&
+                            HasConstDataAccess<MT2>::value &&
+                            IsSame< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
    //**SIMD properties*****************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -6260,7 +6361,12 @@ class Submatrix<MT,aligned,false,true>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -8128,7 +8234,8 @@ inline EnableIf_< typename Submatrix<MT,aligned,false,true>::BLAZE_TEMPLATE Vect
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
+inline DisableIf_< typename Submatrix<MT,aligned,false,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8153,6 +8260,34 @@ inline void Submatrix<MT,aligned,false,true>::assign( const DenseMatrix<MT2,true
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,aligned,false,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,false,true>::assign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -8793,6 +8928,17 @@ class Submatrix<MT,aligned,true,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value &&
+                            HasConstDataAccess<MT2>::value &&
+                            IsSame< ElementType, ElementType_<MT2> >::value };
+   };
+   //**********************************************************************************************
+
    //**SIMD properties*****************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -8832,7 +8978,12 @@ class Submatrix<MT,aligned,true,true>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -10652,7 +10803,8 @@ inline EnableIf_< typename Submatrix<MT,aligned,true,true>::BLAZE_TEMPLATE Vecto
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
+inline DisableIf_< typename Submatrix<MT,aligned,true,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -10677,6 +10829,34 @@ inline void Submatrix<MT,aligned,true,true>::assign( const DenseMatrix<MT2,false
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,aligned,true,true>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,true,true>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeAssign( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/system/Debugging.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -56,9 +57,6 @@ namespace blaze {
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
-
-constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
-constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -66,9 +64,6 @@ constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
-
-constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
-constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -76,9 +71,28 @@ constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BLOCK_SIZE );
+/*! \endcond */
+//*************************************************************************************************
+
 
-constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
-constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t MMM_MICRO_ROWS    = ( BLAZE_MIC_MODE ? 14UL : 6UL );
+constexpr size_t MMM_MICRO_VECTORS = 2UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t DECOMPOSITION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? 4UL : 64UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t TRANSPOSE_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? 8UL : 32UL );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -99,8 +113,11 @@ namespace {
 
 BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 
-BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
-BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
+BLAZE_STATIC_ASSERT( blaze::MMM_MICRO_ROWS >= 1UL && blaze::MMM_MICRO_VECTORS >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::DECOMPOSITION_BLOCK_SIZE >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::TRANSPOSE_BLOCK_SIZE >= 8UL && blaze::TRANSPOSE_BLOCK_SIZE % 8UL == 0UL );
 
 }
 /*! \endcond */
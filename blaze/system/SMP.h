@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/config/SMP.h>
 
 
@@ -123,4 +125,65 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  NUMA MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-aware initialization of dense vectors and matrices.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallel first-touch initialization of dense
+// vectors and matrices. It is only active in case the shared-memory parallelization and the
+// \c BLAZE_USE_NUMA_FIRST_TOUCH switch (see <tt>./blaze/config/SMP.h</tt>) are enabled.
+*/
+#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && BLAZE_USE_NUMA_FIRST_TOUCH
+#define BLAZE_NUMA_FIRST_TOUCH_MODE 1
+#else
+#define BLAZE_NUMA_FIRST_TOUCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling clause of the OpenMP-based SMP assignments.
+// \ingroup system
+//
+// In NUMA mode the partitions of an SMP assignment are statically mapped to the OpenMP threads,
+// such that every thread works on the partition it has initialized. Otherwise the partitions are
+// distributed dynamically to balance the work load among the threads.
+*/
+#if BLAZE_NUMA_FIRST_TOUCH_MODE
+#define BLAZE_OPENMP_SCHEDULE schedule(static)
+#else
+#define BLAZE_OPENMP_SCHEDULE schedule(dynamic,1)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::smpTasksPerThread >= 1UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
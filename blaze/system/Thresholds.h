@@ -53,7 +53,11 @@
 //
 //=================================================================================================
 
-#include <blaze/config/Thresholds.h>
+#if defined(BLAZE_THRESHOLDS_INCLUDE_FILE)
+#  include BLAZE_THRESHOLDS_INCLUDE_FILE
+#else
+#  include <blaze/config/Thresholds.h>
+#endif
 
 
 
@@ -246,6 +250,21 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Dense matrix decomposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::DECOMPOSITION_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies the threshold between the application of the native Blaze
+// kernels and the LAPACK kernels for the LU, Cholesky, and QR decompositions of dense matrices.
+// In case the number of elements of the decomposed matrix is equal or higher than this value,
+// the LAPACK kernels are preferred over the native Blaze kernels. In case the number of elements
+// is smaller, the native Blaze kernels are used.
+*/
+constexpr size_t DECOMPOSITION_DEBUG_THRESHOLD = 36UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   );
@@ -260,6 +279,7 @@ constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DE
 constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  );
 constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  );
 constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD );
+constexpr size_t DECOMPOSITION_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DECOMPOSITION_DEBUG_THRESHOLD   : DECOMPOSITION_USER_THRESHOLD   );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -908,6 +928,62 @@ constexpr size_t SMP_DVECTDVECMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DVECREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the vector is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a reduction of a dense matrix can be executed in
+// parallel. In case the number of elements of the matrix is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batch operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_BATCH_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when an operation on a batch of small matrices can be executed
+// in parallel. In case the total number of elements of all matrices of the batch is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP fused solver kernel threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SOLVER_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a fused kernel of the iterative solvers can be executed in
+// parallel. In case the number of elements processed by the kernel is larger or equal to this
+// threshold, the kernel is executed in parallel. If the number of elements is below this
+// threshold the kernel is executed single-threaded.
+*/
+constexpr size_t SMP_SOLVER_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     );
@@ -955,6 +1031,10 @@ constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSM
 constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  );
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD );
 constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : SMP_DVECREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : SMP_DMATREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_BATCH_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : SMP_BATCH_USER_THRESHOLD          );
+constexpr size_t SMP_SOLVER_THRESHOLD         = ( BLAZE_DEBUG_MODE ? SMP_SOLVER_DEBUG_THRESHOLD         : SMP_SOLVER_USER_THRESHOLD         );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -982,6 +1062,8 @@ BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::DECOMPOSITION_THRESHOLD >= 0UL );
+
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
@@ -1026,6 +1108,10 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCH_THRESHOLD          >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SOLVER_THRESHOLD         >= 0UL );
 
 }
 /*! \endcond */
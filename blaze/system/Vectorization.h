@@ -110,7 +110,7 @@
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC MODE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC MODE CONFIGURATION
 //
 //=================================================================================================
 
@@ -233,6 +233,57 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512F mode. In case the AVX512F mode is enabled
+// (i.e. in case AVX512F functionality is available) the Blaze library attempts to vectorize
+// the linear algebra operations on 32-bit and 64-bit values by AVX512F intrinsics. In case the
+// AVX512F mode is disabled, the Blaze library falls back to the AVX2 vectorization.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512BW mode. In case the AVX512BW mode is
+// enabled (i.e. in case AVX512BW functionality is available) the Blaze library attempts to
+// vectorize the linear algebra operations on 8-bit and 16-bit integral values by AVX512BW
+// intrinsics. In case the AVX512BW mode is disabled, these operations are vectorized by
+// AVX2 intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512DQ mode. In case the AVX512DQ mode is
+// enabled (i.e. in case AVX512DQ functionality is available) the Blaze library additionally
+// vectorizes the multiplication of 64-bit integral values by AVX512DQ intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -319,6 +370,10 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -328,11 +383,11 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC INCLUDE FILE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC INCLUDE FILE CONFIGURATION
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
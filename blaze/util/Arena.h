@@ -0,0 +1,412 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Arena.h
+//  \brief Header file for the Arena class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_ARENA_H_
+#define _BLAZE_UTIL_ARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local stack allocator for temporary workspace.
+// \ingroup util
+//
+// The Arena class implements a stack (bump) allocator for short-lived scratch memory, such as
+// the packing buffers of the matrix multiplication kernels, pivot and work arrays of LAPACK
+// based decompositions, or the temporaries of expression template evaluations. Memory is taken
+// from a list of large, aligned chunks, which are allocated on demand and kept for later reuse.
+// Therefore the repeated evaluation of the same kernel, as for instance in an iterative solver,
+// does not result in any system memory allocation after the first evaluation.\n
+// Memory has to be released in reverse order of allocation (LIFO). Usually the arena is not
+// used directly, but via the ArenaArray class template, which guarantees the LIFO order by
+// means of scoping:
+
+   \code
+   blaze::ArenaArray<double> work( n );  // Takes n doubles from the arena of the calling thread
+   blaze::ArenaArray<int>    ipiv( n );  // Takes n integers from the arena of the calling thread
+   // ...
+   // At the end of the scope the memory of 'ipiv' and 'work' is returned in reverse order
+   \endcode
+
+// Every thread owns its own arena, which is accessible via the local() function. Since the
+// arena of a thread is never accessed by any other thread, no synchronization is required.
+// All memory returned by an arena is aligned to at least \a alignment bytes, which suffices
+// for all SIMD instruction sets supported by Blaze.
+*/
+class Arena : private NonCopyable
+{
+ private:
+   //**struct Chunk********************************************************************************
+   /*!\brief A single memory chunk of the arena.
+   */
+   struct Chunk
+   {
+      byte_t* begin_;  //!< Pointer to the first byte of the chunk.
+      byte_t* end_;    //!< Pointer one past the last byte of the chunk.
+      byte_t* top_;    //!< Top of the stack at the time the chunk was left.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Chunk>  Chunks;  //!< Vector of memory chunks.
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   enum : size_t { alignment = 64UL      };  //!< Alignment of all allocated memory.
+   enum : size_t { chunksize = 1048576UL };  //!< Minimum size of a memory chunk in bytes.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline Arena();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Arena();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline byte_t* allocate( size_t bytes );
+   inline void    release ( byte_t* address );
+   inline void    shrink  ();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size    () const;
+   inline size_t capacity() const;
+   inline bool   isEmpty () const;
+
+   static inline Arena& local();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Chunks  chunks_;   //!< The memory chunks of the arena.
+   size_t  current_;  //!< Index of the currently active chunk.
+   byte_t* top_;      //!< Top of the stack within the currently active chunk.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Arena.
+//
+// The default constructor does not allocate any memory. The first chunk is allocated by the
+// first call to the allocate() function.
+*/
+inline Arena::Arena()
+   : chunks_ ()          // The memory chunks of the arena
+   , current_( 0UL )     // Index of the currently active chunk
+   , top_    ( nullptr ) // Top of the stack within the currently active chunk
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Arena.
+//
+// The destructor releases all memory chunks of the arena.
+*/
+inline Arena::~Arena()
+{
+   BLAZE_INTERNAL_ASSERT( isEmpty(), "Destruction of non-empty arena detected" );
+
+   for( Chunks::iterator it=chunks_.begin(); it!=chunks_.end(); ++it ) {
+      deallocate_backend( it->begin_ );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of the given number of bytes.
+//
+// \param bytes The number of bytes to be allocated.
+// \return Pointer to the first byte of the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function takes the given number of bytes from the top of the stack. The returned memory
+// is aligned to \a alignment bytes. In case the currently active chunk cannot hold the request,
+// the next chunk is used. A new chunk is only allocated in case none of the available chunks
+// is large enough.
+*/
+inline byte_t* Arena::allocate( size_t bytes )
+{
+   if( !chunks_.empty() )
+   {
+      const size_t offset( ( top_ - chunks_[current_].begin_ + alignment - 1UL ) & ~( alignment - 1UL ) );
+      byte_t* const address( chunks_[current_].begin_ + offset );
+
+      if( bytes <= size_t( chunks_[current_].end_ - address ) ) {
+         top_ = address + bytes;
+         return address;
+      }
+
+      chunks_[current_].top_ = top_;
+
+      if( current_+1UL < chunks_.size() &&
+          bytes > size_t( chunks_[current_+1UL].end_ - chunks_[current_+1UL].begin_ ) ) {
+         for( size_t i=current_+1UL; i<chunks_.size(); ++i )
+            deallocate_backend( chunks_[i].begin_ );
+         chunks_.resize( current_+1UL );
+      }
+
+      ++current_;
+   }
+
+   if( current_ == chunks_.size() )
+   {
+      const size_t size( ( bytes + alignment - 1UL ) & ~( alignment - 1UL ) );
+      const size_t previous( chunks_.empty() ? 0UL : chunks_.back().end_ - chunks_.back().begin_ );
+      const size_t capacity( std::max( std::max( size, size_t( chunksize ) ), previous ) );
+
+      Chunk chunk;
+      chunk.begin_ = allocate_backend( capacity, alignment );
+      chunk.end_   = chunk.begin_ + capacity;
+      chunk.top_   = chunk.begin_;
+
+      try {
+         chunks_.push_back( chunk );
+      }
+      catch( ... ) {
+         deallocate_backend( chunk.begin_ );
+         if( current_ > 0UL ) {
+            --current_;
+            top_ = chunks_[current_].top_;
+         }
+         throw;
+      }
+   }
+
+   top_ = chunks_[current_].begin_ + bytes;
+   return chunks_[current_].begin_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Release of memory previously allocated via the allocate() function.
+//
+// \param address Pointer to the first byte of the memory to be released.
+// \return void
+//
+// This function returns the given memory and all memory that has been allocated after it to
+// the arena. The memory is not returned to the system, but kept for later allocations.
+*/
+inline void Arena::release( byte_t* address )
+{
+   BLAZE_INTERNAL_ASSERT( !chunks_.empty(), "Release of memory from an empty arena detected" );
+
+   while( address < chunks_[current_].begin_ || address > chunks_[current_].end_ ) {
+      BLAZE_INTERNAL_ASSERT( current_ > 0UL, "Release of foreign memory detected" );
+      --current_;
+      top_ = chunks_[current_].top_;
+   }
+
+   if( address == chunks_[current_].begin_ && current_ > 0UL ) {
+      --current_;
+      top_ = chunks_[current_].top_;
+   }
+   else {
+      BLAZE_INTERNAL_ASSERT( address <= top_, "Invalid release order detected" );
+      top_ = address;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning all currently unused memory chunks to the system.
+//
+// \return void
+//
+// This function deallocates all memory chunks that are currently not in use. In case the arena
+// is empty, all memory chunks are deallocated.
+*/
+inline void Arena::shrink()
+{
+   if( chunks_.empty() )
+      return;
+
+   const size_t used( isEmpty() ? 0UL : current_+1UL );
+
+   for( size_t i=used; i<chunks_.size(); ++i ) {
+      deallocate_backend( chunks_[i].begin_ );
+   }
+
+   chunks_.resize( used );
+
+   if( used == 0UL ) {
+      current_ = 0UL;
+      top_ = nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently in use (including alignment padding).
+//
+// \return The number of bytes currently in use.
+*/
+inline size_t Arena::size() const
+{
+   if( chunks_.empty() )
+      return 0UL;
+
+   size_t bytes( top_ - chunks_[current_].begin_ );
+
+   for( size_t i=0UL; i<current_; ++i ) {
+      bytes += chunks_[i].top_ - chunks_[i].begin_;
+   }
+
+   return bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total size of all memory chunks of the arena.
+//
+// \return The capacity of the arena in bytes.
+*/
+inline size_t Arena::capacity() const
+{
+   size_t bytes( 0UL );
+
+   for( Chunks::const_iterator it=chunks_.begin(); it!=chunks_.end(); ++it ) {
+      bytes += it->end_ - it->begin_;
+   }
+
+   return bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any memory of the arena is currently in use.
+//
+// \return \a true in case no memory is in use, \a false if at least one allocation is active.
+*/
+inline bool Arena::isEmpty() const
+{
+   return chunks_.empty() || ( current_ == 0UL && top_ == chunks_[0UL].begin_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the arena of the calling thread.
+//
+// \return Reference to the arena of the calling thread.
+//
+// Every thread owns its own arena, which is created on the first call of this function and
+// destroyed at the end of the thread.
+*/
+inline Arena& Arena::local()
+{
+   static thread_local Arena arena;
+   return arena;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,436 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ArenaArray.h
+//  \brief Header file for the ArenaArray class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_ARENAARRAY_H_
+#define _BLAZE_UTIL_ARENAARRAY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <new>
+#include <blaze/util/Arena.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scoped array of temporary workspace taken from the thread-local arena.
+// \ingroup util
+//
+// The ArenaArray class template represents an array of \a n elements of type \a Type, whose
+// memory is taken from the arena of the calling thread (see the Arena class) on construction
+// and returned on destruction. Since objects with automatic storage duration are destroyed in
+// reverse order of their construction, the memory is automatically returned in the LIFO order
+// required by the arena. In contrast to a std::vector or the allocate() function the creation
+// of an ArenaArray does not require a system memory allocation once the arena of the thread
+// has grown to its working set:
+
+   \code
+   void kernel( size_t n )
+   {
+      blaze::ArenaArray<double> buffer( n );  // No call to malloc() in the steady state
+
+      for( size_t i=0UL; i<n; ++i ) {
+         buffer[i] = ...;
+      }
+   }
+   \endcode
+
+// As the allocate() function, ArenaArray does not initialize the elements of built-in data
+// types, whereas all elements of class types are default constructed. The memory is aligned
+// to at least Arena::alignment bytes. Note that an ArenaArray must not outlive the thread
+// that created it and that it must not be moved to a different thread.
+*/
+template< typename Type >  // Type of the array elements
+class ArenaArray : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type         ElementType;     //!< Type of the array elements.
+   typedef Type*        Pointer;         //!< Pointer to a non-constant array element.
+   typedef const Type*  ConstPointer;    //!< Pointer to a constant array element.
+   typedef Type&        Reference;       //!< Reference to a non-constant array element.
+   typedef const Type&  ConstReference;  //!< Reference to a constant array element.
+   typedef Type*        Iterator;        //!< Iterator over non-constant elements.
+   typedef const Type*  ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ArenaArray( size_t n );
+   explicit inline ArenaArray( size_t n, Arena& arena );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ArenaArray();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index ) noexcept;
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline Pointer        data() noexcept;
+   inline ConstPointer   data() const noexcept;
+   inline Iterator       begin () noexcept;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline Iterator       end   () noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void construct();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Arena&  arena_;  //!< The arena the memory is taken from.
+   size_t  size_;   //!< The number of array elements.
+   byte_t* raw_;    //!< The memory taken from the arena.
+   Type*   v_;      //!< The array elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_STATIC_ASSERT( AlignmentOf<Type>::value <= Arena::alignment );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating an array of \a n elements taken from the arena of the calling thread.
+//
+// \param n The number of array elements.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type >  // Type of the array elements
+inline ArenaArray<Type>::ArenaArray( size_t n )
+   : arena_( Arena::local() )                          // The arena the memory is taken from
+   , size_ ( n )                                       // The number of array elements
+   , raw_  ( arena_.allocate( n*sizeof(Type) ) )       // The memory taken from the arena
+   , v_    ( reinterpret_cast<Type*>( raw_ ) )         // The array elements
+{
+   construct();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an array of \a n elements taken from the given arena.
+//
+// \param n The number of array elements.
+// \param arena The arena the memory is taken from.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type >  // Type of the array elements
+inline ArenaArray<Type>::ArenaArray( size_t n, Arena& arena )
+   : arena_( arena )                                   // The arena the memory is taken from
+   , size_ ( n )                                       // The number of array elements
+   , raw_  ( arena_.allocate( n*sizeof(Type) ) )       // The memory taken from the arena
+   , v_    ( reinterpret_cast<Type*>( raw_ ) )         // The array elements
+{
+   construct();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for ArenaArray.
+//
+// The destructor destroys all array elements and returns the memory to the arena.
+*/
+template< typename Type >  // Type of the array elements
+inline ArenaArray<Type>::~ArenaArray()
+{
+   if( !IsBuiltin<Type>::value ) {
+      for( size_t i=size_; i>0UL; --i )
+         v_[i-1UL].~Type();
+   }
+
+   arena_.release( raw_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the array elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::Reference ArenaArray<Type>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid array access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the array elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstReference
+   ArenaArray<Type>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid array access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the array elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::Pointer ArenaArray<Type>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the array elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstPointer ArenaArray<Type>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the array.
+//
+// \return Iterator to the first element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::Iterator ArenaArray<Type>::begin() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the array.
+//
+// \return Iterator to the first element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstIterator ArenaArray<Type>::begin() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the array.
+//
+// \return Iterator to the first element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstIterator ArenaArray<Type>::cbegin() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the array.
+//
+// \return Iterator just past the last element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::Iterator ArenaArray<Type>::end() noexcept
+{
+   return v_ + size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the array.
+//
+// \return Iterator just past the last element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstIterator ArenaArray<Type>::end() const noexcept
+{
+   return v_ + size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the array.
+//
+// \return Iterator just past the last element of the array.
+*/
+template< typename Type >  // Type of the array elements
+inline typename ArenaArray<Type>::ConstIterator ArenaArray<Type>::cend() const noexcept
+{
+   return v_ + size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of array elements.
+//
+// \return The number of array elements.
+*/
+template< typename Type >  // Type of the array elements
+inline size_t ArenaArray<Type>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default construction of all array elements of class type.
+//
+// \return void
+//
+// In case any element throws an exception during construction, all elements that have already
+// been constructed are destroyed in reverse order and the memory is returned to the arena.
+*/
+template< typename Type >  // Type of the array elements
+inline void ArenaArray<Type>::construct()
+{
+   if( IsBuiltin<Type>::value )
+      return;
+
+   size_t i( 0UL );
+
+   try {
+      for( ; i<size_; ++i )
+         ::new ( v_+i ) Type();
+   }
+   catch( ... ) {
+      while( i != 0UL )
+         v_[--i].~Type();
+      arena_.release( raw_ );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
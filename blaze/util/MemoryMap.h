@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of a complete file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the
+// process. The pages of the file are loaded lazily by the operating system on first access,
+// i.e. the creation of a memory map neither copies the file nor allocates memory for its
+// content. By default, the file is mapped read-only, i.e. the mapping does not require any
+// memory commitment beyond the page cache and the mapped content can only be read. Optionally,
+// the file can be mapped privately and copy-on-write: In this case the content of the mapped
+// file can be read and modified, but modifications are neither written back to the file nor
+// visible to other processes, and only the modified pages occupy additional memory. Note that
+// depending on the overcommit policy of the system a copy-on-write mapping might reserve memory
+// for the complete file and therefore fail for very large files. The mapping is released when
+// the MemoryMap is destroyed:
+
+   \code
+   blaze::MemoryMap map( "matrices.blazemap" );
+
+   const blaze::byte_t* data( map.data() );  // The first byte of the file
+   const size_t         size( map.size() );  // The size of the file in bytes
+
+   blaze::MemoryMap copy( "matrices.blazemap", true );  // Writable copy-on-write mapping
+
+   blaze::byte_t* first( copy.mutableData() );  // Modifiable first byte of the file
+   \endcode
+
+// Note that the start of the mapping is aligned to the page size of the system.
+*/
+class MemoryMap : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryMap( const std::string& filename, bool writable=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const byte_t* data()        const noexcept;
+   inline byte_t*       mutableData() const;
+   inline size_t        size()        const noexcept;
+   inline bool          isWritable()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* data_;      //!< The first byte of the mapped file.
+   size_t  size_;      //!< The size of the mapped file in bytes.
+   bool    writable_;  //!< \a true in case of a writable copy-on-write mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a memory mapping of the given file.
+//
+// \param filename The name of the file to be mapped.
+// \param writable \a true for a writable copy-on-write mapping, \a false for a read-only mapping.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline MemoryMap::MemoryMap( const std::string& filename, bool writable )
+   : data_    ( nullptr  )  // The first byte of the mapped file
+   , size_    ( 0UL      )  // The size of the mapped file in bytes
+   , writable_( writable )  // Flag for a writable copy-on-write mapping
+{
+#if defined(_MSC_VER)
+
+   HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+
+   if( file == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER filesize;
+
+   if( !GetFileSizeEx( file, &filesize ) ) {
+      CloseHandle( file );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   size_ = static_cast<size_t>( filesize.QuadPart );
+
+   if( size_ > 0UL )
+   {
+      HANDLE mapping = CreateFileMappingA( file, nullptr, writable ? PAGE_WRITECOPY : PAGE_READONLY,
+                                           0, 0, nullptr );
+      CloseHandle( file );
+
+      if( mapping == nullptr ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      data_ = static_cast<byte_t*>( MapViewOfFile( mapping, writable ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0 ) );
+      CloseHandle( mapping );
+
+      if( data_ == nullptr ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+   }
+   else CloseHandle( file );
+
+#else
+
+   const int file = ::open( filename.c_str(), O_RDONLY );
+
+   if( file == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat status;
+
+   if( ::fstat( file, &status ) != 0 ) {
+      ::close( file );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   size_ = static_cast<size_t>( status.st_size );
+
+   if( size_ > 0UL )
+   {
+      const int protection( writable ? PROT_READ | PROT_WRITE : PROT_READ );
+      void* ptr = ::mmap( nullptr, size_, protection, MAP_PRIVATE, file, 0 );
+      ::close( file );
+
+      if( ptr == MAP_FAILED ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      data_ = static_cast<byte_t*>( ptr );
+   }
+   else ::close( file );
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MemoryMap class.
+//
+// The destructor releases the memory mapping. All pointers into the mapped memory are
+// invalidated.
+*/
+inline MemoryMap::~MemoryMap()
+{
+   if( data_ == nullptr ) return;
+
+#if defined(_MSC_VER)
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file (\a nullptr in case of an empty file).
+*/
+inline const byte_t* MemoryMap::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first modifiable byte of a copy-on-write mapping.
+//
+// \return Pointer to the first byte of the mapped file (\a nullptr in case of an empty file).
+// \exception std::logic_error Read-only memory map.
+//
+// This function can only be used for writable copy-on-write mappings. In case the file has been
+// mapped read-only, a \a std::logic_error exception is thrown.
+*/
+inline byte_t* MemoryMap::mutableData() const
+{
+   if( !writable_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Read-only memory map" );
+   }
+
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MemoryMap::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the file is mapped writable and copy-on-write.
+//
+// \return \a true in case of a writable copy-on-write mapping, \a false for a read-only mapping.
+*/
+inline bool MemoryMap::isWritable() const noexcept
+{
+   return writable_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,8 @@
 #include <memory>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -259,7 +261,7 @@ class Thread : private NonCopyable
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -310,6 +312,9 @@ class Thread : private NonCopyable
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          index_;       //!< Index of the thread within the managing thread pool.
+                                 /*!< The index selects the work queue of the thread
+                                      within the managing thread pool. */
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -335,6 +340,7 @@ class Thread : private NonCopyable
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param index The index of the thread within the thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -343,9 +349,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t index )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , index_     ( index   )  // Index of the thread within the managing thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -370,6 +377,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , index_ ( 0UL     )  // Index of the thread within the managing thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -474,7 +482,8 @@ inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 //*************************************************************************************************
 /*!\brief Execution function for threads in a thread pool.
 //
-// This function is executed by any thread managed by a thread pool.
+// This function is executed by any thread managed by a thread pool. In case the thread pool
+// specifies a thread affinity, the thread first pins itself to the according CPU.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -485,8 +494,13 @@ void Thread<TT,MT,LT,CT>::run()
    // Checking the thread pool handle
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
+   // Pinning the thread according to the affinity of the thread pool
+   if( !pool_->affinity_.empty() ) {
+      threadpool::pinCurrentThread( pool_->affinity_[index_ % pool_->affinity_.size()] );
+   }
+
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   while( pool_->executeTask( index_ ) ) {}
 
    // Setting the termination flag
    terminated_ = true;
@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <utility>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
@@ -48,6 +51,8 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
 
@@ -192,6 +197,46 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_stealing Work stealing and nested parallelism
+//
+// Internally, every thread of the thread pool owns a separate work queue. Tasks scheduled from
+// outside the thread pool are distributed round-robin among the work queues, tasks scheduled by
+// one of the threads of the thread pool are added to the work queue of this particular thread.
+// The round-robin distribution of the tasks of a task group restarts with the first work queue
+// whenever the group has been completed, i.e. repeatedly scheduled partitionings of the same
+// operation are mapped to the same threads.
+// Every thread primarily executes the most recently added task of its own work queue. Only in
+// case its own work queue is empty, the thread steals the oldest task from the work queue of
+// another thread. This work stealing strategy avoids the contention of a single, central task
+// queue and automatically balances the work load in case the tasks differ in size.
+//
+// In order to use the thread pool from within a scheduled task (i.e. for nested parallelism),
+// tasks can be scheduled as part of a threadpool::TaskGroup. The wait() function for a task
+// group only waits for the tasks of this particular group. Additionally, in case it is called
+// by one of the threads of the thread pool, the thread helps executing scheduled tasks instead
+// of blocking idly:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   blaze::threadpool::TaskGroup group;
+
+   threadpool.schedule( group, [&threadpool]()
+   {
+      // Splitting the task into two subtasks executed by the same thread pool
+      blaze::threadpool::TaskGroup subgroup;
+      threadpool.schedule( subgroup, function0 );
+      threadpool.schedule( subgroup, Functor2(), 4, 6 );
+      threadpool.wait( subgroup );
+   } );
+
+   threadpool.wait( group );
+   \endcode
+
+// Note that the global wait() function, which waits for all scheduled tasks, must not be called
+// from within a scheduled task.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -314,16 +359,46 @@ class ThreadPool : private NonCopyable
    typedef Thread<TT,MT,LT,CT>       ManagedThread;  //!< Type of the managed threads.
    typedef PtrVector<ManagedThread>  Threads;        //!< Type of the thread container.
    typedef threadpool::TaskQueue     TaskQueue;      //!< Type of the task queue.
+   typedef threadpool::TaskGroup     TaskGroup;      //!< Type of a group of tasks.
    typedef MT                        Mutex;          //!< Type of the mutex.
    typedef LT                        Lock;           //!< Type of a locking object.
    typedef CT                        Condition;      //!< Condition variable type.
    //**********************************************************************************************
 
+   //**Compilation flags***************************************************************************
+   //! Maximum number of work queues of a thread pool.
+   /*! In case the thread pool contains more threads, several threads share a single work queue. */
+   enum : size_t { maxQueues = 256UL };
+   //**********************************************************************************************
+
+   //**Private struct WorkQueue********************************************************************
+   /*!\brief Work queue of a single thread of the thread pool.
+   //
+   // The owning thread adds and removes tasks at the end of the work queue, whereas all other
+   // threads steal tasks from the front of the work queue.
+   */
+   struct WorkQueue
+   {
+      Mutex     mutex_;  //!< Synchronization mutex of the work queue.
+      TaskQueue tasks_;  //!< The tasks of the work queue.
+   };
+   //**********************************************************************************************
+
+   //**Private struct Worker***********************************************************************
+   /*!\brief Thread-local information about the calling thread.
+   */
+   struct Worker
+   {
+      const ThreadPool* pool_;   //!< The thread pool the calling thread belongs to (if any).
+      size_t            index_;  //!< Index of the calling thread within the thread pool.
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, const threadpool::Affinity& affinity = threadpool::Affinity() );
    //@}
    //**********************************************************************************************
 
@@ -349,6 +424,9 @@ class ThreadPool : private NonCopyable
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void schedule( TaskGroup& group, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -357,6 +435,7 @@ class ThreadPool : private NonCopyable
    //@{
    void resize( size_t n, bool block=false );
    void wait();
+   void wait( TaskGroup& group );
    void clear();
    //@}
    //**********************************************************************************************
@@ -366,7 +445,16 @@ class ThreadPool : private NonCopyable
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   bool executeTask( size_t index );
+   //@}
+   //**********************************************************************************************
+
+   //**Work queue functions************************************************************************
+   /*!\name Work queue functions */
+   //@{
+          void     push       ( threadpool::Task task, size_t slot );
+          bool     acquireTask( size_t index, threadpool::Task& task );
+   static Worker&  worker     ();
    //@}
    //**********************************************************************************************
 
@@ -378,8 +466,14 @@ class ThreadPool : private NonCopyable
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
+   size_t created_;            //!< Total number of threads created by the thread pool.
    Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+   std::unique_ptr<WorkQueue> workqueues_[maxQueues];  //!< The work queues of the threads.
+   std::atomic<size_t> queues_;   //!< Number of available work queues.
+   std::atomic<size_t> next_;     //!< Counter for the distribution of externally scheduled tasks.
+   std::atomic<size_t> pending_;  //!< Number of scheduled tasks that have not been started yet.
+   std::atomic<size_t> idle_;     //!< Number of threads waiting for new tasks.
+   const threadpool::Affinity affinity_;  //!< The CPUs the threads are pinned to.
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
@@ -407,20 +501,28 @@ class ThreadPool : private NonCopyable
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param affinity The CPUs the threads are pinned to (no pinning by default).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case a thread affinity is given, the i-th thread
+// of the pool is pinned to the CPU at position \f$ i \bmod N \f$ of the list of \f$ N \f$ CPUs.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, const threadpool::Affinity& affinity )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
+   , created_ ( 0UL )  // Total number of threads created by the thread pool
    , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
+   , workqueues_   ()  // The work queues of the threads
+   , queues_  ( 0UL )  // Number of available work queues
+   , next_    ( 0UL )  // Counter for the distribution of externally scheduled tasks
+   , pending_ ( 0UL )  // Number of scheduled tasks that have not been started yet
+   , idle_    ( 0UL )  // Number of threads waiting for new tasks
+   , affinity_( affinity )  // The CPUs the threads are pinned to
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
@@ -441,7 +543,7 @@ ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
 //*************************************************************************************************
 /*!\brief Destructor for the ThreadPool class.
 //
-// The destructor clears all remaining tasks from the task queue and waits for the currently
+// The destructor clears all remaining tasks from the task queues and waits for the currently
 // active threads to complete their tasks.
 */
 template< typename TT    // Type of the encapsulated thread
@@ -450,10 +552,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 {
-   Lock lock( mutex_ );
-
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   clear();
+
+   Lock lock( mutex_ );
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -496,8 +598,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return pending_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -570,7 +671,9 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. In case the function is called by one of the threads of the thread pool, the task is
+// added to the work queue of the calling thread, else the tasks are distributed round-robin
+// among the work queues of all threads.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -580,9 +683,53 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   push( std::bind<void>( func, std::forward<Args>( args )... ), next_++ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution as part of the given task group.
+//
+// \param group The task group the task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution as part of the given task
+// group. The completion of all tasks of a task group can be awaited via the wait( TaskGroup& )
+// function. The given function/functor must be copyable, must be callable with the given type
+// and number of arguments and must return \c void. Note that the task group must not be
+// destroyed before all its tasks have been completed.
+//
+// In case the function is not called by one of the threads of the thread pool, the k-th task
+// scheduled since the last wait() for the task group is added to the work queue of the thread
+// with index \f$ k \bmod N \f$, where \f$ N \f$ is the number of work queues. Thus repeatedly
+// scheduling the same partitioning of an operation assigns the same partitions to the same
+// threads, which in combination with pinned threads keeps the partitions close to the memory
+// they have been initialized by.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::schedule( TaskGroup& group, Callable func, Args&&... args )
+{
+   const threadpool::Task task( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   ++group.pending_;
+
+   push( [this,&group,task]()
+   {
+      task();
+
+      if( --group.pending_ == 0UL ) {
+         Lock lock( mutex_ );
+         waitForThread_.notify_all();
+      }
+   }, group.scheduled_++ );
 }
 //*************************************************************************************************
 
@@ -686,7 +833,9 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. Note that this function
+// must not be called from within a task executed by the thread pool. Nested parallelism has to
+// use the wait( TaskGroup& ) function instead.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -694,22 +843,78 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
+   BLAZE_USER_ASSERT( worker().pool_ != this, "Invalid wait from within the thread pool" );
+
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   while( pending_ > 0UL || active_ > 0UL ) {
       waitForThread_.wait( lock );
    }
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed. In case
+// the function is called by one of the threads of the thread pool, the calling thread does not
+// block idly but helps executing scheduled tasks until the task group has been completed. This
+// enables the nested use of the thread pool from within scheduled tasks. After the completion
+// of the task group, the distribution of its tasks among the work queues starts anew with the
+// first work queue.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( TaskGroup& group )
+{
+   const Worker& current( worker() );
+
+   if( current.pool_ == this )
+   {
+      threadpool::Task task;
+
+      while( group.pending_ > 0UL )
+      {
+         if( acquireTask( current.index_, task ) ) {
+            task();
+            continue;
+         }
+
+         Lock lock( mutex_ );
+
+         if( group.pending_ > 0UL && pending_ == 0UL ) {
+            waitForThread_.wait( lock );
+         }
+      }
+   }
+   else
+   {
+      Lock lock( mutex_ );
+
+      while( group.pending_ > 0UL ) {
+         waitForThread_.wait( lock );
+      }
+   }
+
+   group.scheduled_ = 0UL;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all scheduled tasks from the thread pool.
 //
 // \return void
 //
 // This function removes all currently scheduled tasks from the thread pool. The total number
-// of threads remains unchanged and all active threads continue completing their tasks.
+// of threads remains unchanged and all active threads continue completing their tasks. Note
+// that task groups with removed tasks will never be completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -717,8 +922,14 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
-   Lock lock( mutex_ );
-   taskqueue_.clear();
+   const size_t queues( queues_ );
+
+   for( size_t i=0UL; i<queues; ++i ) {
+      WorkQueue& queue( *workqueues_[i] );
+      Lock lock( queue.mutex_ );
+      pending_ -= queue.tasks_.size();
+      queue.tasks_.clear();
+   }
 }
 //*************************************************************************************************
 
@@ -735,6 +946,9 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// This function creates a new thread including its work queue. In case the maximum number of
+// work queues is reached, the new thread shares the work queue of a previously created thread.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -742,7 +956,14 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.pushBack( new ManagedThread( this ) );
+   const size_t index( created_++ );
+
+   if( index < maxQueues ) {
+      workqueues_[index].reset( new WorkQueue() );
+      queues_ = index + 1UL;
+   }
+
+   threads_.pushBack( new ManagedThread( this, index % maxQueues ) );
    ++total_;
    ++expected_;
    ++active_;
@@ -753,46 +974,175 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
-// \return \a true in case a task was successfully finished, \a false if not.
+// \param index The index of the calling thread.
+// \return \a true in case the thread should continue, \a false if it should terminate.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// The thread primarily executes the tasks of its own work queue and steals tasks from the work
+// queues of other threads in case its own work queue is empty. In case there is no task
+// available, the thread blocks and waits for a new task to be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t index )
 {
+   Worker& current( worker() );
+   current.pool_  = this;
+   current.index_ = index;
+
    threadpool::Task task;
 
-   // Acquiring a scheduled task
+   // Acquiring and executing a scheduled task
+   if( acquireTask( index, task ) ) {
+      task();
+      return true;
+   }
+
+   // Waiting for new tasks
+   Lock lock( mutex_ );
+
+   ++idle_;
+
+   while( pending_ == 0UL )
+   {
+      --active_;
+      waitForThread_.notify_all();
+
+      if( total_ > expected_ ) {
+         --total_;
+         --idle_;
+         return false;
+      }
+
+      waitForTask_.wait( lock );
+      ++active_;
+   }
+
+   --idle_;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORK QUEUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to a work queue.
+//
+// \param task The task to be added.
+// \param slot The distribution slot of the task.
+// \return void
+//
+// This function adds the given task to the work queue of the calling thread in case it is one
+// of the threads of the thread pool. Otherwise the task is added to the work queue selected by
+// the given distribution slot, which results in a round-robin distribution for consecutive
+// slots. In case there are idle threads, one of them is woken up.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::push( threadpool::Task task, size_t slot )
+{
+   const Worker& current( worker() );
+   const size_t  queues ( queues_ );
+
+   BLAZE_INTERNAL_ASSERT( queues > 0UL, "No work queue available" );
+
+   const size_t index( ( current.pool_ == this )?( current.index_ ):( slot % queues ) );
+
+   ++pending_;
+
    {
+      WorkQueue& queue( *workqueues_[index] );
+      Lock lock( queue.mutex_ );
+      queue.tasks_.push( std::move( task ) );
+   }
+
+   if( idle_ > 0UL ) {
       Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
 
-      while( taskqueue_.isEmpty() )
-      {
-         --active_;
-         waitForThread_.notify_all();
 
-         if( total_ > expected_ ) {
-            --total_;
-            return false;
-         }
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task.
+//
+// \param index The index of the calling thread.
+// \param task The acquired task.
+// \return \a true in case a task could be acquired, \a false if not.
+//
+// This function acquires the most recently added task from the work queue of the given thread.
+// In case this work queue is empty, the function tries to steal the oldest task from the work
+// queues of all other threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::acquireTask( size_t index, threadpool::Task& task )
+{
+   if( pending_ == 0UL )
+      return false;
+
+   const size_t queues( queues_ );
+
+   BLAZE_INTERNAL_ASSERT( index < queues, "Invalid work queue index detected" );
 
-         waitForTask_.wait( lock );
-         ++active_;
+   // Acquiring a task from the own work queue
+   {
+      WorkQueue& queue( *workqueues_[index] );
+      Lock lock( queue.mutex_ );
+
+      if( !queue.tasks_.isEmpty() ) {
+         task = queue.tasks_.popBack();
+         --pending_;
+         return true;
       }
+   }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+   // Stealing a task from the work queue of another thread
+   for( size_t i=1UL; i<queues; ++i )
+   {
+      WorkQueue& queue( *workqueues_[( index + i ) % queues] );
+      Lock lock( queue.mutex_ );
+
+      if( !queue.tasks_.isEmpty() ) {
+         task = queue.tasks_.pop();
+         --pending_;
+         return true;
+      }
    }
 
-   // Executing the task
-   task();
+   return false;
+}
+//*************************************************************************************************
 
-   return true;
+
+//*************************************************************************************************
+/*!\brief Returns the thread-local information about the calling thread.
+//
+// \return Reference to the thread-local information about the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::Worker& ThreadPool<TT,MT,LT,CT>::worker()
+{
+   static thread_local Worker current{ nullptr, 0UL };
+   return current;
 }
 //*************************************************************************************************
 
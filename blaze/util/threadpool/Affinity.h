@@ -0,0 +1,225 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Header file for the thread affinity functionality of the thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List of logical CPUs the threads of a thread pool are pinned to.
+// \ingroup threads
+//
+// The i-th thread of a thread pool is pinned to the CPU at position \f$ i \bmod N \f$ of the
+// list, where \f$ N \f$ is the length of the list. An empty list disables the pinning.
+*/
+typedef std::vector<size_t>  Affinity;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Affinity functions */
+//@{
+inline Affinity availableCpus();
+inline Affinity parseAffinity( const char* list );
+inline bool pinCurrentThread( size_t cpu );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the logical CPUs the calling process is allowed to run on.
+// \ingroup threads
+//
+// \return The list of available CPUs in ascending order.
+//
+// On Linux systems this function returns the CPUs of the affinity mask of the calling process,
+// which respects any restriction imposed via \c taskset, \c numactl or control groups. On all
+// other systems the function returns an empty list.
+*/
+inline Affinity availableCpus()
+{
+   Affinity cpus;
+
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( sched_getaffinity( 0, sizeof(set), &set ) == 0 ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &set ) )
+            cpus.push_back( cpu );
+      }
+   }
+#endif
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given textual CPU list into a thread affinity.
+// \ingroup threads
+//
+// \param list The textual CPU list.
+// \return The according thread affinity.
+//
+// This function converts a textual specification of a thread affinity into a list of logical
+// CPUs. The specification is either the keyword \c compact, which pins the threads to the
+// available CPUs of the process in ascending order (see availableCpus()), or a comma-separated
+// list of single CPUs and CPU ranges in the format used by \c taskset and \c numactl:
+
+   \code
+   parseAffinity( "compact" );      // The available CPUs of the process
+   parseAffinity( "0-7,16-23" );    // { 0, 1, ..., 7, 16, 17, ..., 23 }
+   parseAffinity( "0,2,4,6" );      // { 0, 2, 4, 6 }
+   \endcode
+
+// In case the given specification is empty or malformed, the function returns an empty list,
+// i.e. the pinning of threads is disabled.
+*/
+inline Affinity parseAffinity( const char* list )
+{
+   Affinity cpus;
+
+   if( list == nullptr )
+      return cpus;
+
+   if( std::strcmp( list, "compact" ) == 0 )
+      return availableCpus();
+
+   const char* pos( list );
+
+   while( *pos != '\0' )
+   {
+      if( !std::isdigit( static_cast<unsigned char>( *pos ) ) )
+         return Affinity();
+
+      char* end( nullptr );
+      const size_t first( std::strtoul( pos, &end, 10 ) );
+      size_t last( first );
+      pos = end;
+
+      if( *pos == '-' ) {
+         ++pos;
+         if( !std::isdigit( static_cast<unsigned char>( *pos ) ) )
+            return Affinity();
+         last = std::strtoul( pos, &end, 10 );
+         pos = end;
+      }
+
+      if( last < first || ( *pos != ',' && *pos != '\0' ) )
+         return Affinity();
+
+      for( size_t cpu=first; cpu<=last; ++cpu )
+         cpus.push_back( cpu );
+
+      if( *pos == ',' && *(++pos) == '\0' )
+         return Affinity();
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the calling thread to the given logical CPU.
+// \ingroup threads
+//
+// \param cpu The logical CPU the calling thread is pinned to.
+// \return \a true in case the thread has been pinned, \a false if not.
+//
+// This function restricts the execution of the calling thread to the given logical CPU. In case
+// the CPU does not exist or is not available to the process, or in case the operating system
+// does not support thread pinning, the affinity of the thread remains unchanged and the function
+// returns \a false.
+*/
+inline bool pinCurrentThread( size_t cpu )
+{
+#if defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+
+   return sched_setaffinity( 0, sizeof(set), &set ) == 0;
+#else
+   UNUSED_PARAMETER( cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
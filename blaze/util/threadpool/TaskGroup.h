@@ -0,0 +1,193 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Header file of the TaskGroup class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+template< typename TT, typename MT, typename LT, typename CT > class ThreadPool;
+
+
+
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of related tasks for fork/join parallelism.
+// \ingroup threads
+//
+// The TaskGroup class represents a set of tasks that have been scheduled for execution within
+// a thread pool and that can be waited for as a whole. In contrast to the global wait() function
+// of the ThreadPool class, waiting for a task group only waits for the tasks of this particular
+// group. This enables the nested use of a thread pool, i.e. the scheduling of further tasks from
+// within a task that is executed by the thread pool:
+
+   \code
+   typedef blaze::ThreadPool< std::thread
+                            , std::mutex
+                            , std::unique_lock<std::mutex>
+                            , std::condition_variable >  StdThreadPool;
+
+   StdThreadPool threadpool( 4 );
+
+   blaze::threadpool::TaskGroup outer;
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      threadpool.schedule( outer, [&threadpool]() {
+         blaze::threadpool::TaskGroup inner;
+         for( size_t j=0UL; j<4UL; ++j )
+            threadpool.schedule( inner, []() { ... } );
+         threadpool.wait( inner );  // Executes pending tasks while waiting
+      } );
+   }
+
+   threadpool.wait( outer );
+   \endcode
+
+// A task group must outlive all tasks that have been scheduled with it, i.e. it must not be
+// destroyed before the according wait() function has returned.
+*/
+class TaskGroup : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size   () const;
+   inline bool   isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> pending_;    //!< Number of scheduled but not yet completed tasks.
+   std::atomic<size_t> scheduled_;  //!< Number of tasks scheduled since the last completion.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename TT, typename MT, typename LT, typename CT > friend class blaze::ThreadPool;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskGroup.
+*/
+inline TaskGroup::TaskGroup()
+   : pending_  ( 0UL )  // Number of scheduled but not yet completed tasks
+   , scheduled_( 0UL )  // Number of tasks scheduled since the last completion
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of unfinished tasks of the task group.
+//
+// \return The number of scheduled but not yet completed tasks.
+*/
+inline size_t TaskGroup::size() const
+{
+   return pending_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks of the task group have been completed.
+//
+// \return \a true if all tasks have been completed, \a false if not.
+*/
+inline bool TaskGroup::isEmpty() const
+{
+   return pending_ == 0UL;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
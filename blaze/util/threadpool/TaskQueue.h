@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <deque>
+#include <utility>
 #include <blaze/util/threadpool/Task.h>
 
 
@@ -58,8 +59,12 @@ namespace threadpool {
 /*!\brief Task queue for the thread pool.
 // \ingroup threads
 //
-// The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// The TaskQueue class represents the internal task container of a thread pool. By default it
+// uses a FIFO (first in, first out) strategy to store and remove the assigned tasks. Via the
+// popBack() function it is additionally possible to remove the most recently added task, which
+// enables the use of the task queue as a double-ended work queue for work stealing: the owning
+// thread adds and removes tasks at the end of the queue (LIFO), whereas other threads steal
+// tasks from the front of the queue (FIFO).
 */
 class TaskQueue
 {
@@ -99,9 +104,10 @@ class TaskQueue
    //**Element functions***************************************************************************
    /*!\name Element functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
-   inline void clear();
+   inline void push   ( Task task );
+   inline Task pop    ();
+   inline Task popBack();
+   inline void clear  ();
    //@}
    //**********************************************************************************************
 
@@ -224,7 +230,7 @@ inline bool TaskQueue::isEmpty() const
 */
 inline void TaskQueue::push( Task task )
 {
-   tasks_.push_back( task );
+   tasks_.push_back( std::move( task ) );
 }
 //*************************************************************************************************
 
@@ -236,13 +242,29 @@ inline void TaskQueue::push( Task task )
 */
 inline Task TaskQueue::pop()
 {
-   const Task task( tasks_.front() );
+   Task task( std::move( tasks_.front() ) );
    tasks_.pop_front();
    return task;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the task from the end of the task queue.
+//
+// \return The last task in the task queue.
+//
+// This function removes and returns the most recently added task of the task queue.
+*/
+inline Task TaskQueue::popBack()
+{
+   Task task( std::move( tasks_.back() ) );
+   tasks_.pop_back();
+   return task;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all tasks from the task queue.
 //
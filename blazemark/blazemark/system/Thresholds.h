@@ -0,0 +1,185 @@
+//=================================================================================================
+/*!
+//  \file blazemark/blazemark/system/Thresholds.h
+//  \brief Threshold configuration for the tuning of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZEMARK_SYSTEM_THRESHOLDS_H_
+#define _BLAZEMARK_SYSTEM_THRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLAS THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BLAS thresholds for the threshold tuning
+//
+// During the tuning of the thresholds the BLAS kernels are never selected within Blaze
+// expressions. Instead, the BLAS kernels are called explicitly by the tuning tool.
+*/
+//@{
+constexpr size_t DMATDVECMULT_USER_THRESHOLD       = ~0UL;
+constexpr size_t TDMATDVECMULT_USER_THRESHOLD      = ~0UL;
+constexpr size_t TDVECDMATMULT_USER_THRESHOLD      = ~0UL;
+constexpr size_t TDVECTDMATMULT_USER_THRESHOLD     = ~0UL;
+constexpr size_t DMATDMATMULT_USER_THRESHOLD       = ~0UL;
+constexpr size_t DMATTDMATMULT_USER_THRESHOLD      = ~0UL;
+constexpr size_t TDMATDMATMULT_USER_THRESHOLD      = ~0UL;
+constexpr size_t TDMATTDMATMULT_USER_THRESHOLD     = ~0UL;
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX MULTIPLICATION THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse matrix multiplication thresholds for the threshold tuning
+//
+// The kernel selection of the dense matrix/sparse matrix multiplications is not subject to the
+// threshold tuning. Therefore these thresholds correspond to the default settings.
+*/
+//@{
+constexpr size_t DMATSMATMULT_USER_THRESHOLD       = 2500UL;
+constexpr size_t TDMATSMATMULT_USER_THRESHOLD      = 2500UL;
+constexpr size_t TSMATDMATMULT_USER_THRESHOLD      = 10000UL;
+constexpr size_t TSMATTDMATMULT_USER_THRESHOLD     = 22500UL;
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LAPACK THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK thresholds for the threshold tuning
+//
+// The selection between the native decomposition kernels and the LAPACK kernels is not subject
+// to the threshold tuning. Therefore this threshold corresponds to the default setting.
+*/
+//@{
+constexpr size_t DECOMPOSITION_USER_THRESHOLD      = 10000UL;
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP thresholds for the threshold tuning
+//
+// During the tuning of the thresholds all operations are executed in parallel unless they are
+// explicitly executed in a serial section.
+*/
+//@{
+constexpr size_t SMP_DVECASSIGN_USER_THRESHOLD     = 0UL;
+constexpr size_t SMP_DVECDVECADD_USER_THRESHOLD    = 0UL;
+constexpr size_t SMP_DVECDVECSUB_USER_THRESHOLD    = 0UL;
+constexpr size_t SMP_DVECDVECMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_DVECDVECDIV_USER_THRESHOLD    = 0UL;
+constexpr size_t SMP_DVECSCALARMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DMATDVECMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_TDMATDVECMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDVECDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDVECTDMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DMATSVECMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_TDMATSVECMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSVECDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSVECTDMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_SMATDVECMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_TSMATDVECMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDVECSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDVECTSMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_SMATSVECMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_TSMATSVECMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSVECSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSVECTSMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DMATASSIGN_USER_THRESHOLD     = 0UL;
+constexpr size_t SMP_DMATDMATADD_USER_THRESHOLD    = 0UL;
+constexpr size_t SMP_DMATTDMATADD_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_DMATDMATSUB_USER_THRESHOLD    = 0UL;
+constexpr size_t SMP_DMATTDMATSUB_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_DMATSCALARMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DMATDMATMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_DMATTDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDMATDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDMATTDMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DMATSMATMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_DMATTSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDMATSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TDMATTSMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_SMATDMATMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_SMATTDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSMATDMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSMATTDMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_SMATSMATMULT_USER_THRESHOLD   = 0UL;
+constexpr size_t SMP_SMATTSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSMATSMATMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_TSMATTSMATMULT_USER_THRESHOLD = 0UL;
+constexpr size_t SMP_DVECTDVECMULT_USER_THRESHOLD  = 0UL;
+constexpr size_t SMP_DVECREDUCE_USER_THRESHOLD     = 0UL;
+constexpr size_t SMP_DMATREDUCE_USER_THRESHOLD     = 0UL;
+constexpr size_t SMP_BATCH_USER_THRESHOLD          = 0UL;
+constexpr size_t SMP_SOLVER_USER_THRESHOLD         = 0UL;
+//@}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
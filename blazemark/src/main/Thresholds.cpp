@@ -0,0 +1,557 @@
+//=================================================================================================
+/*!
+//  \file src/main/Thresholds.cpp
+//  \brief Source file for the tuning of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#define BLAZE_THRESHOLDS_INCLUDE_FILE <blazemark/system/Thresholds.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blaze/math/BLAS.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::element_t;
+using blazemark::size_t;
+using blaze::columnMajor;
+using blaze::columnVector;
+using blaze::rowMajor;
+using blaze::rowVector;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Timing function for a single threshold.
+//
+// The function measures the runtime of one of the two competing kernels for the given problem
+// size. The second argument selects the kernel: \a false selects the default kernel (serial
+// execution or Blaze kernel), \a true selects the alternative kernel (parallel execution or
+// BLAS kernel).
+*/
+typedef std::function<double(size_t,bool)>  Kernel;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Description of a single threshold to be tuned.
+*/
+struct Tuning
+{
+   std::string name;   //!< The name of the threshold in the configuration file.
+   Kernel kernel;      //!< The timing function of the competing kernels.
+   size_t first;       //!< The first problem size of the sweep.
+   size_t last;        //!< The last problem size of the sweep.
+   bool square;        //!< \a true if the threshold refers to \f$ N^2 \f$ elements.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+const double minTime  = 2E-3;  //!< Minimum runtime of a single measurement (in seconds).
+const double growth   = 1.2;   //!< Growth factor of the problem size during the sweep.
+const size_t confirms = 3UL;   //!< Number of consecutive sizes required to confirm a crossover.
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the minimum runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation.
+*/
+template< typename OP >
+double measure( OP op )
+{
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   op();
+
+   while( true ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+      if( timer.last() >= minTime ) break;
+      steps *= 2UL;
+   }
+
+   for( size_t rep=1UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of the given operation in serial or parallel execution.
+//
+// \param op The operation to be measured.
+// \param parallel \a true for parallel execution, \a false for serial execution.
+// \return The minimum runtime of a single execution of the operation.
+*/
+template< typename OP >
+double measureSMP( OP op, bool parallel )
+{
+   if( parallel ) {
+      return measure( op );
+   }
+
+   BLAZE_SERIAL_SECTION {
+      return measure( op );
+   }
+
+   return 0.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point of the two kernels of the given threshold.
+//
+// \param tuning The threshold to be tuned.
+// \return The tuned threshold value.
+//
+// The function sweeps the problem size from \a tuning.first to \a tuning.last and returns the
+// threshold value of the smallest problem size from which on the alternative kernel is faster
+// than the default kernel for at least \a confirms consecutive problem sizes. In case the
+// alternative kernel never wins, the alternative kernel is disabled by the maximum threshold.
+*/
+size_t tune( const Tuning& tuning )
+{
+   std::cout << "   " << std::left << std::setw( 36 ) << tuning.name << std::flush;
+
+   size_t candidate( 0UL );
+   size_t wins( 0UL );
+
+   for( size_t N=tuning.first; N<=tuning.last; N=blaze::max( N+1UL, size_t( N*growth ) ) )
+   {
+      const double defaultTime( tuning.kernel( N, false ) );
+      const double alternativeTime( tuning.kernel( N, true ) );
+
+      if( alternativeTime < defaultTime ) {
+         if( wins == 0UL ) candidate = N;
+         if( ++wins == confirms ) break;
+      }
+      else wins = 0UL;
+   }
+
+   const size_t threshold( ( wins < confirms )?( ~size_t( 0 ) )
+                                              :( tuning.square ? candidate*candidate : candidate ) );
+
+   if( wins < confirms )
+      std::cout << "never" << std::endl;
+   else
+      std::cout << threshold << std::endl;
+
+   return threshold;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the tuned thresholds into a new configuration file.
+//
+// \param input The path of the original threshold configuration file.
+// \param output The path of the generated threshold configuration file.
+// \param thresholds The tuned thresholds.
+// \return void
+// \exception std::runtime_error File could not be read or written.
+//
+// The generated file is a copy of the original configuration file, in which the values of all
+// tuned thresholds have been replaced.
+*/
+void writeThresholds( const std::string& input, const std::string& output,
+                      const std::map<std::string,size_t>& thresholds )
+{
+   std::ifstream in( input.c_str() );
+   if( !in ) {
+      throw std::runtime_error( "Threshold file '" + input + "' could not be read" );
+   }
+
+   std::ostringstream oss;
+   oss << in.rdbuf();
+   std::string content( oss.str() );
+
+   for( const auto& threshold : thresholds ) {
+      const std::regex pattern( "constexpr size_t " + threshold.first + " = \\w+;" );
+      content = std::regex_replace( content, pattern, "constexpr size_t " + threshold.first + " = "
+                                                        + std::to_string( threshold.second ) + "UL;" );
+   }
+
+   std::ofstream out( output.c_str() );
+   out << content;
+
+   if( !out ) {
+      throw std::runtime_error( "Threshold file '" + output + "' could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the SMP timing function for a dense vector operation.
+//
+// \param op The dense vector operation to be executed.
+// \return The timing function for serial and parallel execution.
+*/
+template< typename OP >
+Kernel dvecKernel( OP op )
+{
+   return [op]( size_t N, bool parallel ) {
+      blaze::DynamicVector<element_t,columnVector> a( N ), b( N ), c( N );
+      blaze::randomize( a, element_t(1), element_t(2) );
+      blaze::randomize( b, element_t(1), element_t(2) );
+      return measureSMP( [&]() { op( c, a, b ); }, parallel );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the SMP timing function for a dense matrix operation.
+//
+// \param op The dense matrix operation to be executed.
+// \return The timing function for serial and parallel execution.
+*/
+template< bool SO1, bool SO2, typename OP >
+Kernel dmatKernel( OP op )
+{
+   return [op]( size_t N, bool parallel ) {
+      blaze::DynamicMatrix<element_t,SO1> A( N, N ), C( N, N );
+      blaze::DynamicMatrix<element_t,SO2> B( N, N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( B, element_t(1), element_t(2) );
+      return measureSMP( [&]() { op( C, A, B ); }, parallel );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the SMP timing function for a dense matrix/dense vector multiplication.
+//
+// \return The timing function for serial and parallel execution.
+*/
+template< bool SO >
+Kernel dmatdvecmultKernel()
+{
+   return []( size_t N, bool parallel ) {
+      blaze::DynamicMatrix<element_t,SO> A( N, N );
+      blaze::DynamicVector<element_t,columnVector> x( N ), y( N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( x, element_t(1), element_t(2) );
+      return measureSMP( [&]() { y = A * x; }, parallel );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the SMP timing function for a transpose dense vector/dense matrix multiplication.
+//
+// \return The timing function for serial and parallel execution.
+*/
+template< bool SO >
+Kernel tdvecdmatmultKernel()
+{
+   return []( size_t N, bool parallel ) {
+      blaze::DynamicMatrix<element_t,SO> A( N, N );
+      blaze::DynamicVector<element_t,rowVector> x( N ), y( N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( x, element_t(1), element_t(2) );
+      return measureSMP( [&]() { y = x * A; }, parallel );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the SMP timing function for the outer product of two dense vectors.
+//
+// \return The timing function for serial and parallel execution.
+*/
+Kernel dvectdvecmultKernel()
+{
+   return []( size_t N, bool parallel ) {
+      blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
+      blaze::DynamicMatrix<element_t,rowMajor> C( N, N );
+      blaze::randomize( a, element_t(1), element_t(2) );
+      blaze::randomize( b, element_t(1), element_t(2) );
+      return measureSMP( [&]() { C = a * trans( b ); }, parallel );
+   };
+}
+//*************************************************************************************************
+
+
+#if BLAZE_BLAS_MODE
+//*************************************************************************************************
+/*!\brief Creates the BLAS timing function for a dense matrix/dense vector multiplication.
+//
+// \return The timing function for the Blaze kernel and the BLAS kernel.
+*/
+template< bool SO >
+Kernel dmatdvecmultBlasKernel()
+{
+   return []( size_t N, bool blas ) {
+      blaze::DynamicMatrix<element_t,SO> A( N, N );
+      blaze::DynamicVector<element_t,columnVector> x( N ), y( N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( x, element_t(1), element_t(2) );
+      if( blas )
+         return measure( [&]() { blaze::gemv( y, A, x, element_t(1), element_t(0) ); } );
+      else
+         return measureSMP( [&]() { y = A * x; }, false );
+   };
+}
+#endif
+//*************************************************************************************************
+
+
+#if BLAZE_BLAS_MODE
+//*************************************************************************************************
+/*!\brief Creates the BLAS timing function for a transpose dense vector/dense matrix multiplication.
+//
+// \return The timing function for the Blaze kernel and the BLAS kernel.
+*/
+template< bool SO >
+Kernel tdvecdmatmultBlasKernel()
+{
+   return []( size_t N, bool blas ) {
+      blaze::DynamicMatrix<element_t,SO> A( N, N );
+      blaze::DynamicVector<element_t,rowVector> x( N ), y( N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( x, element_t(1), element_t(2) );
+      if( blas )
+         return measure( [&]() { blaze::gemv( y, x, A, element_t(1), element_t(0) ); } );
+      else
+         return measureSMP( [&]() { y = x * A; }, false );
+   };
+}
+#endif
+//*************************************************************************************************
+
+
+#if BLAZE_BLAS_MODE
+//*************************************************************************************************
+/*!\brief Creates the BLAS timing function for a dense matrix/dense matrix multiplication.
+//
+// \return The timing function for the Blaze kernel and the BLAS kernel.
+*/
+template< bool SO1, bool SO2 >
+Kernel dmatdmatmultBlasKernel()
+{
+   return []( size_t N, bool blas ) {
+      blaze::DynamicMatrix<element_t,SO1> A( N, N ), C( N, N );
+      blaze::DynamicMatrix<element_t,SO2> B( N, N );
+      blaze::randomize( A, element_t(1), element_t(2) );
+      blaze::randomize( B, element_t(1), element_t(2) );
+      if( blas )
+         return measure( [&]() { blaze::gemm( C, A, B, element_t(1), element_t(0) ); } );
+      else
+         return measureSMP( [&]() { C = A * B; }, false );
+   };
+}
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the tuning of the Blaze thresholds.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The threshold tuning measures the crossover points between serial and parallel execution
+// and between the Blaze kernels and the BLAS kernels on the current system and writes a copy
+// of the given threshold configuration file with the tuned thresholds. The generated file can
+// be used via the BLAZE_THRESHOLDS_INCLUDE_FILE macro. The SMP thresholds are only tuned in
+// case a shared memory parallelization is active, the BLAS thresholds are only tuned in case
+// the BLAS mode is active. All other thresholds keep their original setting.
+*/
+int main( int argc, char** argv )
+{
+   if( argc != 3 ) {
+      std::cerr << " Invalid use of program 'Thresholds'!\n"
+                << "   Use: ./thresholds <blaze/config/Thresholds.h> <output_file>\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   blaze::setSeed( blazemark::seed );
+
+   typedef blaze::DynamicVector<element_t,columnVector>  VT;
+   typedef blaze::DynamicMatrix<element_t,rowMajor>      RM;
+   typedef blaze::DynamicMatrix<element_t,columnMajor>   CM;
+
+   std::vector<Tuning> tunings;
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   tunings.push_back( { "SMP_DVECASSIGN_USER_THRESHOLD"    , dvecKernel( []( VT& c, const VT& a, const VT& ) { c = a; } )          , 256UL, 1UL << 22, false } );
+   tunings.push_back( { "SMP_DVECDVECADD_USER_THRESHOLD"   , dvecKernel( []( VT& c, const VT& a, const VT& b ) { c = a + b; } )    , 256UL, 1UL << 22, false } );
+   tunings.push_back( { "SMP_DVECDVECSUB_USER_THRESHOLD"   , dvecKernel( []( VT& c, const VT& a, const VT& b ) { c = a - b; } )    , 256UL, 1UL << 22, false } );
+   tunings.push_back( { "SMP_DVECDVECMULT_USER_THRESHOLD"  , dvecKernel( []( VT& c, const VT& a, const VT& b ) { c = a * b; } )    , 256UL, 1UL << 22, false } );
+   tunings.push_back( { "SMP_DVECDVECDIV_USER_THRESHOLD"   , dvecKernel( []( VT& c, const VT& a, const VT& b ) { c = a / b; } )    , 256UL, 1UL << 22, false } );
+   tunings.push_back( { "SMP_DVECSCALARMULT_USER_THRESHOLD", dvecKernel( []( VT& c, const VT& a, const VT& ) { c = a * 2.2; } )    , 256UL, 1UL << 22, false } );
+
+   tunings.push_back( { "SMP_DMATDVECMULT_USER_THRESHOLD"  , dmatdvecmultKernel<rowMajor>()    , 16UL, 4096UL, false } );
+   tunings.push_back( { "SMP_TDMATDVECMULT_USER_THRESHOLD" , dmatdvecmultKernel<columnMajor>() , 16UL, 4096UL, false } );
+   tunings.push_back( { "SMP_TDVECDMATMULT_USER_THRESHOLD" , tdvecdmatmultKernel<rowMajor>()   , 16UL, 4096UL, false } );
+   tunings.push_back( { "SMP_TDVECTDMATMULT_USER_THRESHOLD", tdvecdmatmultKernel<columnMajor>(), 16UL, 4096UL, false } );
+
+   tunings.push_back( { "SMP_DMATASSIGN_USER_THRESHOLD"    , dmatKernel<rowMajor,rowMajor>   ( []( RM& C, const RM& A, const RM& ) { C = A; } )          , 16UL, 2048UL, true } );
+   tunings.push_back( { "SMP_DMATDMATADD_USER_THRESHOLD"   , dmatKernel<rowMajor,rowMajor>   ( []( RM& C, const RM& A, const RM& B ) { C = A + B; } )    , 16UL, 2048UL, true } );
+   tunings.push_back( { "SMP_DMATTDMATADD_USER_THRESHOLD"  , dmatKernel<rowMajor,columnMajor>( []( RM& C, const RM& A, const CM& B ) { C = A + B; } )    , 16UL, 2048UL, true } );
+   tunings.push_back( { "SMP_DMATDMATSUB_USER_THRESHOLD"   , dmatKernel<rowMajor,rowMajor>   ( []( RM& C, const RM& A, const RM& B ) { C = A - B; } )    , 16UL, 2048UL, true } );
+   tunings.push_back( { "SMP_DMATTDMATSUB_USER_THRESHOLD"  , dmatKernel<rowMajor,columnMajor>( []( RM& C, const RM& A, const CM& B ) { C = A - B; } )    , 16UL, 2048UL, true } );
+   tunings.push_back( { "SMP_DMATSCALARMULT_USER_THRESHOLD", dmatKernel<rowMajor,rowMajor>   ( []( RM& C, const RM& A, const RM& ) { C = A * 2.2; } )    , 16UL, 2048UL, true } );
+
+   tunings.push_back( { "SMP_DMATDMATMULT_USER_THRESHOLD"  , dmatKernel<rowMajor,rowMajor>      ( []( RM& C, const RM& A, const RM& B ) { C = A * B; } ), 8UL, 512UL, true } );
+   tunings.push_back( { "SMP_DMATTDMATMULT_USER_THRESHOLD" , dmatKernel<rowMajor,columnMajor>   ( []( RM& C, const RM& A, const CM& B ) { C = A * B; } ), 8UL, 512UL, true } );
+   tunings.push_back( { "SMP_TDMATDMATMULT_USER_THRESHOLD" , dmatKernel<columnMajor,rowMajor>   ( []( CM& C, const CM& A, const RM& B ) { C = A * B; } ), 8UL, 512UL, true } );
+   tunings.push_back( { "SMP_TDMATTDMATMULT_USER_THRESHOLD", dmatKernel<columnMajor,columnMajor>( []( CM& C, const CM& A, const CM& B ) { C = A * B; } ), 8UL, 512UL, true } );
+
+   tunings.push_back( { "SMP_DVECTDVECMULT_USER_THRESHOLD" , dvectdvecmultKernel(), 16UL, 2048UL, true } );
+#else
+   std::cout << "\n No shared memory parallelization active: Skipping the SMP thresholds" << std::endl;
+#endif
+
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION
+   tunings.push_back( { "DMATDVECMULT_USER_THRESHOLD"  , dmatdvecmultBlasKernel<rowMajor>()    , 16UL, 4096UL, true } );
+   tunings.push_back( { "TDMATDVECMULT_USER_THRESHOLD" , dmatdvecmultBlasKernel<columnMajor>() , 16UL, 4096UL, true } );
+   tunings.push_back( { "TDVECDMATMULT_USER_THRESHOLD" , tdvecdmatmultBlasKernel<rowMajor>()   , 16UL, 4096UL, true } );
+   tunings.push_back( { "TDVECTDMATMULT_USER_THRESHOLD", tdvecdmatmultBlasKernel<columnMajor>(), 16UL, 4096UL, true } );
+#else
+   std::cout << "\n No BLAS matrix/vector multiplication active: Skipping the BLAS matrix/vector thresholds" << std::endl;
+#endif
+
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
+   tunings.push_back( { "DMATDMATMULT_USER_THRESHOLD"  , dmatdmatmultBlasKernel<rowMajor,rowMajor>()      , 8UL, 1024UL, true } );
+   tunings.push_back( { "DMATTDMATMULT_USER_THRESHOLD" , dmatdmatmultBlasKernel<rowMajor,columnMajor>()   , 8UL, 1024UL, true } );
+   tunings.push_back( { "TDMATDMATMULT_USER_THRESHOLD" , dmatdmatmultBlasKernel<columnMajor,rowMajor>()   , 8UL, 1024UL, true } );
+   tunings.push_back( { "TDMATTDMATMULT_USER_THRESHOLD", dmatdmatmultBlasKernel<columnMajor,columnMajor>(), 8UL, 1024UL, true } );
+#else
+   std::cout << "\n No BLAS matrix/matrix multiplication active: Skipping the BLAS matrix/matrix thresholds" << std::endl;
+#endif
+
+   std::cout << "\n Tuning the Blaze thresholds (" << blaze::getNumThreads() << " threads)...\n";
+
+   std::map<std::string,size_t> thresholds;
+
+   for( const Tuning& tuning : tunings ) {
+      thresholds[tuning.name] = tune( tuning );
+   }
+
+   try {
+      writeThresholds( argv[1], argv[2], thresholds );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n ERROR DETECTED: " << ex.what() << "\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Tuned thresholds written to '" << argv[2] << "'\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,530 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/bandmatrix/ClassTest.h
+//  \brief Header file for the BandMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/BandMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BandMatrix class template.
+//
+// This class represents a test suite for the BandMatrix class template and the band() view. It
+// performs a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAccess      ();
+   void testIterator    ();
+   void testResize      ();
+   void testMult        ();
+   void testLU          ();
+   void testLLH         ();
+   void testTridiagonal ();
+   void testView        ();
+
+   template< typename BM >
+   void testMult( size_t m, size_t n );
+
+   template< typename BM >
+   void testLU( size_t n );
+
+   template< typename BM >
+   void testLLH( size_t n );
+
+   template< typename BM >
+   void testTridiagonal( size_t n );
+
+   template< typename BM >
+   void checkSize( const BM& A, size_t expectedRows, size_t expectedColumns ) const;
+
+   template< typename BM >
+   void checkBandwidths( const BM& A, size_t expectedLower, size_t expectedUpper ) const;
+
+   template< typename BM, typename MT >
+   void checkMatrix( const BM& A, const MT& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename BM >
+   BM generate( size_t m, size_t n, size_t kl, size_t ku ) const;
+
+   template< typename BM >
+   BM generateDominant( size_t n, size_t kl, size_t ku ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the banded matrix/vector multiplication for a specific type.
+//
+// \param m The number of rows of the band matrix.
+// \param n The number of columns of the band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the gbmv() kernel and the default multiplication
+// expressions with the results of the according dense multiplications. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::testMult( size_t m, size_t n )
+{
+   typedef blaze::ElementType_<BM>  Type;
+
+   const BM A( generate<BM>( m, n, 2UL, 3UL ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> D( A );
+
+   const blaze::DynamicVector<Type> x( blaze::rand< blaze::DynamicVector<Type> >( n, 0, 9 ) );
+   blaze::DynamicVector<Type> y( m, Type(2) );
+
+   gbmv( y, A, x, Type(3), Type(1) );
+   checkVector( y, Type(3)*D*x + blaze::DynamicVector<Type>( m, Type(2) ) );
+
+   gbmv( y, A, x, Type(1), Type(0) );
+   checkVector( y, D*x );
+
+   checkVector( blaze::DynamicVector<Type>( A*x ), D*x );
+
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( n, 5UL, 0, 9 ) );
+   checkMatrix( blaze::DynamicMatrix<Type>( A*B ), D*B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the banded LU decomposition and the according solvers for a specific type.
+//
+// \param n The number of rows and columns of the band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::testLU( size_t n )
+{
+   typedef blaze::ElementType_<BM>  Type;
+
+   const BM A( generateDominant<BM>( n, 2UL, 1UL ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> D( A );
+
+   const blaze::DynamicVector<Type> b( blaze::rand< blaze::DynamicVector<Type> >( n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::rowMajor> >( n, 4UL, 0, 9 ) );
+
+   BM LU( A );
+   const std::unique_ptr<int[]> ipiv( new int[n+1UL] );
+   gbtrf( LU, ipiv.get() );
+   checkBandwidths( LU, 2UL, 3UL );
+
+   blaze::DynamicVector<Type> x( b );
+   gbtrs( LU, x, ipiv.get() );
+   checkVector( D*x, b );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> X( B );
+   gbtrs( LU, X, ipiv.get() );
+   checkMatrix( D*X, B );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> Y( B );
+   gbtrs( LU, Y, ipiv.get() );
+   checkMatrix( D*Y, B );
+
+   blaze::DynamicVector<Type> z;
+   solve( A, z, b );
+   checkVector( D*z, b );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> Z;
+   solve( A, Z, B );
+   checkMatrix( D*Z, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the banded Cholesky decomposition and the according solvers for a specific type.
+//
+// \param n The number of rows and columns of the band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::testLLH( size_t n )
+{
+   typedef blaze::ElementType_<BM>  Type;
+
+   BM A( n, n, 2UL, 2UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) = Type(10);
+      if( i > 0UL ) { A(i,i-1UL) = A(i-1UL,i) = Type(-2); }
+      if( i > 1UL ) { A(i,i-2UL) = A(i-2UL,i) = Type(1); }
+   }
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> D( A );
+
+   const blaze::DynamicVector<Type> b( blaze::rand< blaze::DynamicVector<Type> >( n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( n, 3UL, 0, 9 ) );
+
+   {
+      BM L( A );
+      pbtrf( L, 'L' );
+
+      blaze::DynamicVector<Type> x( b );
+      pbtrs( L, x, 'L' );
+      checkVector( D*x, b );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> X( B );
+      pbtrs( L, X, 'L' );
+      checkMatrix( D*X, B );
+   }
+
+   {
+      BM U( A );
+      pbtrf( U, 'U' );
+
+      blaze::DynamicVector<Type> x( b );
+      pbtrs( U, x, 'U' );
+      checkVector( D*x, b );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X( B );
+      pbtrs( U, X, 'U' );
+      checkMatrix( D*X, B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched tridiagonal solver for a specific type.
+//
+// \param n The number of rows and columns of the tridiagonal matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::testTridiagonal( size_t n )
+{
+   typedef blaze::ElementType_<BM>  Type;
+
+   const BM A( generateDominant<BM>( n, 1UL, 1UL ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> D( A );
+
+   const blaze::DynamicVector<Type> b( blaze::rand< blaze::DynamicVector<Type> >( n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::rowMajor> >( n, 13UL, 0, 9 ) );
+
+   blaze::DynamicVector<Type> x( b );
+   solveTridiagonal( A, x );
+   checkVector( D*x, b );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> X( B );
+   solveTridiagonal( A, X );
+   checkMatrix( D*X, B );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> Y( B );
+   solveTridiagonal( A, Y );
+   checkMatrix( D*Y, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows and columns of the given band matrix.
+//
+// \param A The band matrix to be checked.
+// \param expectedRows The expected number of rows of the band matrix.
+// \param expectedColumns The expected number of columns of the band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::checkSize( const BM& A, size_t expectedRows, size_t expectedColumns ) const
+{
+   if( A.rows() != expectedRows || A.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( BM ).name() << "\n"
+          << "   Number of rows            : " << A.rows() << "\n"
+          << "   Number of columns         : " << A.columns() << "\n"
+          << "   Expected number of rows   : " << expectedRows << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the lower and upper bandwidth of the given band matrix.
+//
+// \param A The band matrix to be checked.
+// \param expectedLower The expected number of subdiagonals.
+// \param expectedUpper The expected number of superdiagonals.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM >  // Type of the band matrix
+void ClassTest::checkBandwidths( const BM& A, size_t expectedLower, size_t expectedUpper ) const
+{
+   if( A.lowerBandwidth() != expectedLower || A.upperBandwidth() != expectedUpper ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid bandwidths detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( BM ).name() << "\n"
+          << "   Lower bandwidth         : " << A.lowerBandwidth() << "\n"
+          << "   Upper bandwidth         : " << A.upperBandwidth() << "\n"
+          << "   Expected lower bandwidth: " << expectedLower << "\n"
+          << "   Expected upper bandwidth: " << expectedUpper << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename BM    // Type of the checked matrix
+        , typename MT >  // Type of the expected matrix
+void ClassTest::checkMatrix( const BM& A, const MT& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( BM ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a band matrix with small random integral values.
+//
+// \param m The number of rows of the band matrix.
+// \param n The number of columns of the band matrix.
+// \param kl The number of subdiagonals of the band matrix.
+// \param ku The number of superdiagonals of the band matrix.
+// \return The random band matrix.
+//
+// The small integral values keep all products exact and therefore comparable with the results
+// of the according dense operations.
+*/
+template< typename BM >  // Type of the band matrix
+BM ClassTest::generate( size_t m, size_t n, size_t kl, size_t ku ) const
+{
+   return blaze::rand<BM>( m, n, kl, ku, 0, 9 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a strictly diagonally dominant band matrix with small random integral values.
+//
+// \param n The number of rows and columns of the band matrix.
+// \param kl The number of subdiagonals of the band matrix.
+// \param ku The number of superdiagonals of the band matrix.
+// \return The random band matrix.
+//
+// The diagonal dominance guarantees a well-conditioned system matrix, which allows to compare
+// the solutions of the banded solvers by means of the relative accuracy of the comparison
+// operators.
+*/
+template< typename BM >  // Type of the band matrix
+BM ClassTest::generateDominant( size_t n, size_t kl, size_t ku ) const
+{
+   typedef blaze::ElementType_<BM>  Type;
+
+   BM A( generate<BM>( n, n, kl, ku ) );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) = Type( 10*( kl + ku + 1UL ) );
+   }
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BandMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BandMatrix class test.
+*/
+#define RUN_BANDMATRIX_CLASS_TEST \
+   blazetest::mathtest::bandmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
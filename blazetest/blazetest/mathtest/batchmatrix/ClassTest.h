@@ -0,0 +1,524 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/batchmatrix/ClassTest.h
+//  \brief Header file for the BatchMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BATCHMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BATCHMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/BatchMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batchmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BatchMatrix class template.
+//
+// This class represents a test suite for the BatchMatrix class template. It performs a series
+// of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAccess      ();
+   void testResize      ();
+   void testMult        ();
+   void testDet         ();
+   void testLU          ();
+   void testInvert      ();
+
+   template< typename Type, size_t M, size_t K, size_t N >
+   void testMult( size_t n );
+
+   template< typename Type, size_t N >
+   void testDet( size_t n );
+
+   template< typename Type, size_t N >
+   void testLU( size_t n );
+
+   template< typename Type, size_t N >
+   void testInvert( size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   void checkSize( const blaze::BatchMatrix<Type,M,N>& batch, size_t expectedSize ) const;
+
+   template< typename Type, size_t M, size_t N >
+   void checkPadding( const blaze::BatchMatrix<Type,M,N>& batch ) const;
+
+   template< typename Type, size_t M, size_t N, typename MT >
+   void checkMatrix( const blaze::BatchMatrix<Type,M,N>& batch, size_t k, const MT& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t N >
+   void makeRegular( blaze::BatchMatrix<Type,N,N>& batch ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batch matrix multiplication for a specific combination of matrix sizes.
+//
+// \param n The number of matrices of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the batch matrix multiplication with the result of the
+// multiplication of the individual matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void ClassTest::testMult( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,M,N>  MT;
+
+   blaze::BatchMatrix<Type,M,K> A( n );
+   blaze::BatchMatrix<Type,K,N> B( n );
+   blaze::BatchMatrix<Type,M,N> C;
+
+   randomize( A );
+   randomize( B );
+
+   mult( C, A, B );
+
+   checkSize   ( C, n );
+   checkPadding( C );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const MT expected( A.get(k) * B.get(k) );
+      checkMatrix( C, k, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch determinant computation for a specific matrix size.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the determinants of a batch of matrices with the determinants of the
+// individual matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::testDet( size_t n )
+{
+   blaze::BatchMatrix<Type,N,N> A( n );
+   randomize( A );
+   makeRegular( A );
+
+   if( n > 1UL ) {
+      A.set( 1UL, blaze::StaticMatrix<Type,N,N>( Type() ) );
+   }
+
+   const blaze::DynamicVector<Type> d( det( A ) );
+
+   if( d.size() != n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of determinants detected\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of determinants:\n" << d.size() << "\n"
+          << "   Expected number of determinants:\n" << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const Type expected( ( k == 1UL )?( Type() ):( blaze::det( A.get(k) ) ) );
+
+      if( !blaze::equal( d[k], expected ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Determinant computation failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size:\n"
+             << "     " << N << "x" << N << "\n"
+             << "   Matrix index:\n"
+             << "     " << k << "\n"
+             << "   Result:\n" << d[k] << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch LU decomposition for a specific matrix size.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the LU decomposition of a batch of matrices results in lower
+// unitriangular, upper triangular, and permutation matrices, whose product restores the
+// original matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::testLU( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,N,N>  MT;
+
+   blaze::BatchMatrix<Type,N,N> A( n ), L, U, P;
+   randomize( A );
+
+   lu( A, L, U, P );
+
+   checkSize   ( L, n );
+   checkSize   ( U, n );
+   checkSize   ( P, n );
+   checkPadding( L );
+   checkPadding( U );
+   checkPadding( P );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const MT Lk( L.get(k) );
+      const MT Uk( U.get(k) );
+      const MT Pk( P.get(k) );
+
+      if( !blaze::isLower( Lk ) || !blaze::isUpper( Uk ) || !blaze::isIdentity( Pk * trans( Pk ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid LU factors detected\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix index:\n"
+             << "     " << k << "\n"
+             << "   L:\n" << Lk << "\n"
+             << "   U:\n" << Uk << "\n"
+             << "   P:\n" << Pk << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( A, k, MT( Pk * Lk * Uk ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch inversion for a specific matrix size.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the inverses of a batch of matrices with the inverses of the individual
+// matrices and checks that the inversion of a batch containing a singular matrix fails. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::testInvert( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,N,N>  MT;
+
+   blaze::BatchMatrix<Type,N,N> A( n );
+   randomize( A );
+   makeRegular( A );
+
+   blaze::BatchMatrix<Type,N,N> B( A );
+   invert( B );
+
+   checkSize   ( B, n );
+   checkPadding( B );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      MT expected( A.get(k) );
+      blaze::invert( expected );
+      checkMatrix( B, k, expected );
+   }
+
+   if( n > 0UL )
+   {
+      B = A;
+      B.set( n-1UL, MT( Type() ) );
+
+      try {
+         invert( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size:\n"
+             << "     " << N << "x" << N << "\n"
+             << "   Batch size:\n"
+             << "     " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of matrices of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void ClassTest::checkSize( const blaze::BatchMatrix<Type,M,N>& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Batch size         : " << batch.size() << "\n"
+          << "   Expected batch size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding elements of the given batch.
+//
+// \param batch The batch to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all elements beyond the size of the given batch are default
+// values. In case a non-default padding element is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void ClassTest::checkPadding( const blaze::BatchMatrix<Type,M,N>& batch ) const
+{
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t k=batch.size(); k<batch.capacity(); ++k ) {
+            if( !blaze::isDefault( batch.data(i,j)[k] ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid padding element detected\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Element:\n"
+                   << "     (" << i << "," << j << ") at index " << k << "\n"
+                   << "   Value:\n"
+                   << "     " << batch.data(i,j)[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the \a k-th matrix of the given batch.
+//
+// \param batch The batch to be checked.
+// \param k The index of the matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , typename MT >  // Type of the expected matrix
+void ClassTest::checkMatrix( const blaze::BatchMatrix<Type,M,N>& batch, size_t k, const MT& expected ) const
+{
+   const blaze::StaticMatrix<Type,M,N> result( batch.get(k) );
+
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix size:\n"
+          << "     " << M << "x" << N << "\n"
+          << "   Matrix index:\n"
+          << "     " << k << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Making all matrices of the given batch diagonally dominant and thus regular.
+//
+// \param batch The batch of square matrices.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::makeRegular( blaze::BatchMatrix<Type,N,N>& batch ) const
+{
+   for( size_t k=0UL; k<batch.size(); ++k ) {
+      for( size_t i=0UL; i<N; ++i ) {
+         batch(k,i,i) += Type( 2*N );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BatchMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BatchMatrix class test.
+*/
+#define RUN_BATCHMATRIX_CLASS_TEST \
+   blazetest::mathtest::batchmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batchmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the BlockCompressedMatrix class template. It performs a series
+// of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAccess      ();
+   void testIterator    ();
+   void testLookup      ();
+   void testMult        ();
+
+   template< typename Type, size_t M, size_t N >
+   void testIterator( size_t m, size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   void testMult( size_t m, size_t n );
+
+   template< typename MT >
+   void checkRows( const MT& A, size_t expectedRows ) const;
+
+   template< typename MT >
+   void checkColumns( const MT& A, size_t expectedColumns ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& A, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   blaze::CompressedMatrix<Type,blaze::rowMajor> generate( size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterators for a specific element type and block size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function traverses all rows of a BlockCompressedMatrix and compares the visited elements
+// with the elements of the original compressed matrix. Since the zero elements within a stored
+// block are stored explicitly, every non-zero element of the original matrix has to be visited,
+// but additional zero elements may be visited as well. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of a single block
+        , size_t N >     // Number of columns of a single block
+void ClassTest::testIterator( size_t m, size_t n )
+{
+   typedef blaze::CompressedMatrix<Type,blaze::rowMajor>  CMT;
+   typedef typename blaze::BlockCompressedMatrix<Type,M,N>::ConstIterator  ConstIterator;
+
+   const CMT A( generate<Type>( m, n ) );
+   const blaze::BlockCompressedMatrix<Type,M,N> S( A );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      size_t visited( 0UL ), index( 0UL );
+
+      for( ConstIterator it=S.begin(i); it!=S.end(i); ++it, ++visited )
+      {
+         if( it->index() >= n || ( visited > 0UL && it->index() <= index ) ||
+             it->value() != A(i,it->index()) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Index : " << it->index() << "\n"
+                << "   Value : " << it->value() << "\n"
+                << "   Matrix:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         index = it->index();
+      }
+
+      if( visited != S.nonZeros(i) || visited < A.nonZeros(i) ||
+          size_t( S.end(i) - S.begin(i) ) != visited ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << S.nonZeros(i) << "\n"
+             << "   Number of visited elements  : " << visited << "\n"
+             << "   Minimum number of non-zeros : " << A.nonZeros(i) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      nonzeros += visited;
+   }
+
+   if( nonzeros != S.nonZeros() || S.capacity() != S.blocks()*M*N || S.capacity() < S.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << S.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonzeros << "\n"
+          << "   Number of blocks            : " << S.blocks() << "\n"
+          << "   Capacity                    : " << S.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix multiplication kernels for a specific element type
+//        and block size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the spmv() and spmm() kernels and of the according
+// multiplication expressions with the results of the multiplications of the original compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of a single block
+        , size_t N >     // Number of columns of a single block
+void ClassTest::testMult( size_t m, size_t n )
+{
+   typedef blaze::CompressedMatrix<Type,blaze::rowMajor>  CMT;
+   typedef blaze::DynamicVector<Type,blaze::columnVector>  DVT;
+
+   const CMT A( generate<Type>( m, n ) );
+   const blaze::BlockCompressedMatrix<Type,M,N> S( A );
+
+   const DVT x( blaze::rand<DVT>( n, 0, 9 ) );
+   const DVT z( blaze::rand<DVT>( n, 0, 9 ) );
+   const DVT ref( A * x );
+
+   DVT y( m, Type(2) );
+
+   spmv( y, S, x, Type(3), Type(1) );
+   checkVector( y, Type(3)*ref + DVT( m, Type(2) ) );
+
+   spmv( y, S, x, Type(1), Type(0) );
+   checkVector( y, ref );
+
+   y = S * x;
+   checkVector( y, ref );
+
+   y += S * x;
+   checkVector( y, Type(2)*ref );
+
+   y -= S * x;
+   checkVector( y, ref );
+
+   y = S * ( x + z );
+   checkVector( y, A * ( x + z ) );
+
+   DVT w( m+2UL, Type(1) );
+   subvector( w, 1UL, m ) = S * x;
+   checkVector( subvector( w, 1UL, m ), ref );
+
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( n, 7UL, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> AB( A * B );
+   blaze::DynamicMatrix<Type,blaze::rowMajor> C( m, 7UL, Type(1) );
+
+   spmm( C, S, B, Type(2), Type(1) );
+   checkMatrix( C, Type(2)*AB + blaze::DynamicMatrix<Type>( m, 7UL, Type(1) ) );
+
+   C = S * B;
+   checkMatrix( C, AB );
+
+   C += S * B;
+   checkMatrix( C, Type(2)*AB );
+
+   C -= S * B;
+   checkMatrix( C, AB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkRows( const MT& A, size_t expectedRows ) const
+{
+   if( A.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << A.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkColumns( const MT& A, size_t expectedColumns ) const
+{
+   if( A.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << A.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the checked matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& A, const MT2& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a random row-major compressed matrix with small integral values.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The random compressed matrix.
+//
+// The rows of the matrix have strongly varying numbers of non-zero elements, which results in
+// both densely and sparsely populated blocks. The small integral values keep all products exact
+// and therefore comparable with the results of the compressed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor> ClassTest::generate( size_t m, size_t n ) const
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n );
+
+   if( n == 0UL )
+      return A;
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t nonzeros( blaze::rand<size_t>( 0UL, ( i % 3UL == 0UL ) ? n : ( n+3UL ) / 4UL ) );
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A( i, blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<Type>( 1, 9 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,430 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/chunkedmatrix/ClassTest.h
+//  \brief Header file for the ChunkedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CHUNKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_CHUNKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/ChunkedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace chunkedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the ChunkedMatrix class template.
+//
+// This class represents a test suite for the ChunkedMatrix class template. It performs a series
+// of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testInsert      ();
+   void testErase       ();
+   void testLookup      ();
+   void testResize      ();
+   void testCompress    ();
+   void testOperations  ();
+   void testUpdates     ();
+
+   template< typename Type, bool SO >
+   void testUpdates( size_t m, size_t n, size_t updates );
+
+   template< typename MT >
+   void checkRows( const MT& A, size_t expectedRows ) const;
+
+   template< typename MT >
+   void checkColumns( const MT& A, size_t expectedColumns ) const;
+
+   template< typename MT >
+   void checkNonZeros( const MT& A, size_t expectedNonZeros ) const;
+
+   template< typename MT >
+   void checkOrder( const MT& A ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& A, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of random structural modifications for a specific element type and storage order.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param updates The number of random modifications.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies a sequence of random insertions, modifications and erasures to a
+// ChunkedMatrix and to a dense reference matrix and compares both matrices, the order of the
+// stored elements and the result of the conversion into a compressed matrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void ClassTest::testUpdates( size_t m, size_t n, size_t updates )
+{
+   blaze::ChunkedMatrix<Type,SO> A( m, n );
+   blaze::DynamicMatrix<Type,SO> D( m, n, Type(0) );
+
+   for( size_t k=0UL; k<updates; ++k )
+   {
+      const size_t i( blaze::rand<size_t>( 0UL, m-1UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, n-1UL ) );
+
+      switch( blaze::rand<size_t>( 0UL, 3UL ) ) {
+         case 0UL:
+            A.erase( i, j );
+            D(i,j) = Type(0);
+            break;
+         case 1UL:
+            A(i,j) += Type(1);
+            D(i,j) += Type(1);
+            break;
+         default:
+            const Type value( blaze::rand<Type>( 1, 9 ) );
+            A.set( i, j, value );
+            D(i,j) = value;
+            break;
+      }
+   }
+
+   checkMatrix( A, D );
+   checkOrder ( A );
+
+   blaze::CompressedMatrix<Type,SO> C;
+   A.compress( C );
+
+   checkMatrix  ( C, D );
+   checkNonZeros( C, A.nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkRows( const MT& A, size_t expectedRows ) const
+{
+   if( A.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << A.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkColumns( const MT& A, size_t expectedColumns ) const
+{
+   if( A.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << A.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkNonZeros( const MT& A, size_t expectedNonZeros ) const
+{
+   if( A.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << A.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( A.capacity() < A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << A.nonZeros() << "\n"
+          << "   Capacity           : " << A.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the order of the stored elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the elements of all rows/columns are visited in strictly ascending
+// order of their indices and that the distance between the begin() and end() iterators matches
+// the number of non-zero elements of each row/column.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkOrder( const MT& A ) const
+{
+   const size_t lines( blaze::IsRowMajorMatrix<MT>::value ? A.rows() : A.columns() );
+
+   for( size_t i=0UL; i<lines; ++i )
+   {
+      size_t nonzeros( 0UL );
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element, ++nonzeros )
+      {
+         auto next( element );
+         ++next;
+
+         if( next != A.end(i) && next->index() <= element->index() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid order of elements detected\n"
+                << " Details:\n"
+                << "   Row/column    : " << i << "\n"
+                << "   Index         : " << element->index() << "\n"
+                << "   Next index    : " << next->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( nonzeros != A.nonZeros(i) || size_t( A.end(i) - A.begin(i) ) != nonzeros ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row/column " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << A.nonZeros(i) << "\n"
+             << "   Iterator distance           : " << ( A.end(i) - A.begin(i) ) << "\n"
+             << "   Expected number of non-zeros: " << nonzeros << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the checked matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& A, const MT2& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the ChunkedMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ChunkedMatrix class test.
+*/
+#define RUN_CHUNKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::chunkedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace chunkedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,219 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/compressedmatrix/BuilderTest.h
+//  \brief Header file for the CompressedMatrix triplet builder test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_BUILDERTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_BUILDERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/sparse/TripletBuilder.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the TripletBuilder class template.
+//
+// This class represents a test suite for the blaze::TripletBuilder class template, which
+// assembles a blaze::CompressedMatrix from unordered (i,j,value) triplets. It performs a
+// series of runtime tests for both row-major and column-major target matrices.
+*/
+class BuilderTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BuilderTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testInsert();
+   void testBuffers();
+   void testCombine();
+   void testClear();
+   void testLarge();
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& expected, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::TripletBuilder<int>                       TB;   //!< Type of the triplet builder.
+   typedef blaze::CompressedMatrix<int,blaze::rowMajor>     SM;   //!< Row-major target matrix type.
+   typedef blaze::CompressedMatrix<int,blaze::columnMajor>  OSM;  //!< Column-major target matrix type.
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>        DM;   //!< Type of the reference matrix.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the assembled matrix against the expected matrix.
+//
+// \param result The assembled compressed matrix.
+// \param expected The expected matrix.
+// \param expectedNonZeros The expected number of stored elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the assembled matrix element-wise with the expected matrix and checks
+// the number of stored elements as well as the strictly increasing order of the indices within
+// each row/column. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the assembled matrix
+        , typename MT2 >  // Type of the expected matrix
+void BuilderTest::checkMatrix( const MT1& result, const MT2& expected, size_t expectedNonZeros ) const
+{
+   typedef blaze::ConstIterator_<MT1>  ConstIterator;
+
+   const size_t lines( blaze::IsRowMajorMatrix<MT1>::value ? result.rows() : result.columns() );
+
+   bool sorted( true );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( ConstIterator element=result.begin(i); element!=result.end(i); ++element ) {
+         if( element != result.begin(i) && ( element-1 )->index() >= element->index() )
+            sorted = false;
+      }
+   }
+
+   if( result.rows() != expected.rows() || result.columns() != expected.columns() ||
+       result != expected || result.nonZeros() != expectedNonZeros || !sorted ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assembly failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Number of non-zeros: " << result.nonZeros() << " (expected " << expectedNonZeros << ")\n"
+          << "   Sorted indices: " << ( sorted ? "yes" : "no" ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the TripletBuilder class template.
+//
+// \return void
+*/
+void runTest()
+{
+   BuilderTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the TripletBuilder test.
+*/
+#define RUN_COMPRESSEDMATRIX_BUILDER_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
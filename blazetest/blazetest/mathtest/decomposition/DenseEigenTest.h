@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/decomposition/DenseEigenTest.h
+//  \brief Header file for the dense matrix eigenvalue test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEEIGENTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEEIGENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Column.h>
+#include <blaze/math/dense/Eigen.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense matrix eigenvalue tests.
+//
+// This class represents a test suite for the dense matrix eigenvalue functionality. It performs
+// a series of eigenvalue computations on symmetric and Hermitian matrices of all supported
+// element types and storage orders, including the partial spectrum and the workspace reuse.
+*/
+class DenseEigenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseEigenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testFull( size_t n );
+
+   template< typename Type >
+   void testPartial( size_t n );
+
+   void testAdaptors();
+   void testWorkspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   MT symmetric( size_t n ) const;
+
+   template< typename MT, typename VT >
+   void checkEigenpairs( const MT& A, const VT& w, const MT& V, const char* error ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkValues( const VT1& result, const VT2& expected, const char* error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the computation of all eigenvalues and eigenvectors.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the computation of all eigenvalues and eigenvectors of a randomly
+// initialized symmetric (Hermitian) matrix of the given type. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseEigenTest::testFull( size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Computation of all eigenvalues";
+
+   typedef blaze::ElementType_<Type>                     ET;
+   typedef blaze::UnderlyingBuiltin_<ET>                 BT;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   const Type A( symmetric<Type>( n ) );
+
+   blaze::DynamicVector<BT,blaze::columnVector> w, w2;
+   Type V;
+
+   blaze::eigen( A, w, V );
+   blaze::eigen( A, w2 );
+
+   checkEigenpairs( CMT( A ), w, CMT( V ), "Eigenvalue decomposition failed" );
+   checkValues( w2, w, "Eigenvalues without eigenvectors differ" );
+
+   for( size_t i=1UL; i<n; ++i ) {
+      if( w[i-1UL] > w[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalues are not sorted in ascending order\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Eigenvalues:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the computation of a selected subset of the eigenvalues and eigenvectors.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the computation of the eigenvalues within an index range and within a
+// value range of a randomly initialized symmetric (Hermitian) matrix of the given type. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseEigenTest::testPartial( size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Computation of selected eigenvalues";
+
+   typedef blaze::ElementType_<Type>                     ET;
+   typedef blaze::UnderlyingBuiltin_<ET>                 BT;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   const Type A( symmetric<Type>( n ) );
+
+   blaze::DynamicVector<BT,blaze::columnVector> w, wi, wv;
+   Type V;
+
+   blaze::eigen( A, w );
+
+   // Index range
+   {
+      const size_t m( blaze::eigen( A, wi, V, 2UL, 6UL ) );
+
+      if( m != 5UL || V.rows() != n || V.columns() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of eigenpairs in index range\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of eigenvalues: " << m << "\n"
+             << "   Eigenvectors: " << V.rows() << "x" << V.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValues( wi, subvector( w, 2UL, 5UL ), "Eigenvalues in index range differ" );
+      checkEigenpairs( CMT( A ), wi, CMT( V ), "Eigenpairs in index range failed" );
+   }
+
+   // Value range
+   {
+      const BT low( ( w[1UL] + w[2UL] ) / BT(2) );
+      const BT upp( ( w[n-3UL] + w[n-2UL] ) / BT(2) );
+
+      const size_t m( blaze::eigen( A, wv, low, upp ) );
+
+      if( m != n-4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of eigenvalues in value range\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of eigenvalues: " << m << " (expected " << n-4UL << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValues( wv, subvector( w, 2UL, n-4UL ), "Eigenvalues in value range differ" );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a random symmetric (Hermitian) matrix of the given type.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The random symmetric (Hermitian) matrix.
+*/
+template< typename MT >  // Type of the matrix
+MT DenseEigenTest::symmetric( size_t n ) const
+{
+   MT X( n, n );
+   randomize( X );
+
+   return MT( X + ctrans( X ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the eigenpairs of a symmetric (Hermitian) matrix.
+//
+// \param A The symmetric (Hermitian) matrix.
+// \param w The vector of eigenvalues.
+// \param V The matrix of eigenvectors (in its columns).
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that \f$ A \cdot V = V \cdot diag(w) \f$ and that the columns of \a V
+// are orthonormal.
+*/
+template< typename MT    // Type of the matrices
+        , typename VT >  // Type of the eigenvalue vector
+void DenseEigenTest::checkEigenpairs( const MT& A, const VT& w, const MT& V,
+                                      const char* error ) const
+{
+   MT VW( V );
+   for( size_t j=0UL; j<w.size(); ++j ) {
+      column( VW, j ) *= w[j];
+   }
+
+   MT I( w.size(), w.size(), 0 );
+   for( size_t i=0UL; i<w.size(); ++i ) {
+      I(i,i) = 1;
+   }
+
+   const double diff1( max( abs( A*V - VW ) ) );
+   const double diff2( max( abs( ctrans( V ) * V - I ) ) );
+
+   if( !( diff1 < 1E-8 ) || !( diff2 < 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_<MT> ).name() << "\n"
+          << "   Rows: " << A.rows() << ", eigenpairs: " << w.size() << "\n"
+          << "   Maximum residual: " << diff1 << "\n"
+          << "   Maximum orthogonality error: " << diff2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking two vectors of eigenvalues against each other.
+//
+// \param result The computed eigenvalues.
+// \param expected The expected eigenvalues.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed eigenvalues
+        , typename VT2 >  // Type of the expected eigenvalues
+void DenseEigenTest::checkValues( const VT1& result, const VT2& expected, const char* error ) const
+{
+   if( result.size() != expected.size() || !( max( abs( result - expected ) ) < 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix eigenvalue functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseEigenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix eigenvalue test.
+*/
+#define RUN_DENSE_EIGEN_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/decomposition/DenseNativeTest.h
+//  \brief Header file for the native dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSENATIVETEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSENATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/lapack/native/getrf.h>
+#include <blaze/math/lapack/native/orgqr.h>
+#include <blaze/math/lapack/native/potrf.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all native dense matrix decomposition tests.
+//
+// This class represents a test suite for the native (LAPACK-free) LU, Cholesky and QR kernels
+// and the solution of linear systems of equations. The tests use matrices that are larger than
+// the decomposition block size in order to exercise both the unblocked panel kernels and the
+// blocked trailing updates, as well as small matrices with compile time and runtime dimensions,
+// which are handled by the unblocked kernels.
+*/
+class DenseNativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseNativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testGetrf( size_t m, size_t n );
+
+   template< typename Type >
+   void testPotrf( size_t n, char uplo );
+
+   template< typename Type >
+   void testGeqrf( size_t m, size_t n );
+
+   template< typename Type >
+   void testSolve( size_t n );
+
+   void testLU();
+   void testLLH();
+   void testQR();
+   void testLSE();
+   void testNonPositiveDefinite();
+   void testSingular();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected, const char* error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition with a randomly initialized matrix.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition for a randomly initialized matrix of the given
+// type. The factorization is verified by reconstructing the row-permuted matrix from the \c L
+// and \c U factors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseNativeTest::testGetrf( size_t m, size_t n )
+{
+   test_ = "Native LU decomposition";
+
+   typedef blaze::ElementType_<Type>                          ET;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   Type A;
+   resize( A, m, n );
+   randomize( A );
+
+   Type B( A );
+   const size_t mindim( blaze::min( m, n ) );
+   const std::unique_ptr<int[]> ipiv( new int[mindim] );
+
+   blaze::nativeGetrf( B, ipiv.get() );
+
+   // A row-major matrix is factorized in the sense of its (column-major) transpose
+   CMT X, F;
+   if( blaze::IsRowMajorMatrix<Type>::value ) {
+      X = trans( A );
+      F = trans( B );
+   }
+   else {
+      X = A;
+      F = B;
+   }
+
+   const size_t rows( X.rows() );
+   const size_t cols( X.columns() );
+   const size_t k( mindim );
+
+   CMT L( rows, k, ET() ), U( k, cols, ET() );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      L(j,j) = ET(1);
+      for( size_t i=j+1UL; i<rows; ++i )
+         L(i,j) = F(i,j);
+   }
+   for( size_t j=0UL; j<cols; ++j ) {
+      for( size_t i=0UL; i<=j && i<k; ++i )
+         U(i,j) = F(i,j);
+   }
+
+   for( size_t i=0UL; i<k; ++i ) {
+      const size_t ip( ipiv[i] - 1 );
+      if( ip != i ) {
+         for( size_t j=0UL; j<cols; ++j )
+            std::swap( X(i,j), X(ip,j) );
+      }
+   }
+
+   checkResult( CMT( L*U ), X, "LU decomposition failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition with a randomly initialized matrix.
+//
+// \param n The number of rows and columns of the test matrix.
+// \param uplo \c 'L' for the lower Cholesky factor, \c 'U' for the upper Cholesky factor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native Cholesky decomposition for a randomly initialized positive
+// definite matrix of the given type. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void DenseNativeTest::testPotrf( size_t n, char uplo )
+{
+   test_ = "Native Cholesky decomposition";
+
+   typedef blaze::ElementType_<Type>                          ET;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   CMT X( n, n );
+   randomize( X );
+
+   CMT S( ctrans( X ) * X );
+   for( size_t i=0UL; i<n; ++i )
+      S(i,i) += ET( n );
+
+   Type A;
+   resize( A, n, n );
+   A = S;
+
+   blaze::nativePotrf( A, uplo );
+
+   CMT T( n, n, ET() );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( ( uplo == 'L' && i >= j ) || ( uplo == 'U' && i <= j ) )
+            T(i,j) = A(i,j);
+      }
+   }
+
+   if( uplo == 'L' )
+      checkResult( CMT( T * ctrans( T ) ), S, "Lower Cholesky decomposition failed" );
+   else
+      checkResult( CMT( ctrans( T ) * T ), S, "Upper Cholesky decomposition failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition with a randomly initialized matrix.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native QR decomposition and the subsequent reconstruction of the
+// \c Q matrix for a randomly initialized matrix of the given type. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseNativeTest::testGeqrf( size_t m, size_t n )
+{
+   test_ = "Native QR decomposition";
+
+   typedef blaze::ElementType_<Type>                          ET;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   const size_t k( blaze::min( m, n ) );
+
+   Type A;
+   resize( A, m, n );
+   randomize( A );
+
+   Type B( A );
+   const std::unique_ptr<ET[]> tau( new ET[k] );
+
+   blaze::nativeGeqrf( B, tau.get() );
+
+   CMT R( k, n, ET() );
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=i; j<n; ++j )
+         R(i,j) = B(i,j);
+   }
+
+   Type Q( submatrix( B, 0UL, 0UL, m, k ) );
+   blaze::nativeOrgqr( Q, tau.get() );
+
+   checkResult( CMT( Q*R ), A, "QR decomposition failed" );
+   CMT I( k, k, ET() );
+   for( size_t i=0UL; i<k; ++i )
+      I(i,i) = ET(1);
+
+   checkResult( CMT( ctrans( Q ) * Q ), I, "Q is not unitary" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of a linear system of equations with a randomly initialized matrix.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions for a single right-hand side vector and for multiple
+// right-hand sides for a randomly initialized, diagonally dominant matrix of the given type. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseNativeTest::testSolve( size_t n )
+{
+   test_ = "Solution of a linear system of equations";
+
+   typedef blaze::ElementType_<Type>                          ET;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   Type A;
+   resize( A, n, n );
+   randomize( A );
+
+   for( size_t i=0UL; i<n; ++i )
+      A(i,i) += ET( n );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( n ), x;
+   randomize( b );
+
+   blaze::solve( A, x, b );
+
+   CMT B( n, 1UL ), X( n, 1UL );
+   column( B, 0UL ) = b;
+   column( X, 0UL ) = x;
+
+   checkResult( CMT( A*X ), B, "Solving the LSE with a single right-hand side failed" );
+
+   CMT C( n, 3UL ), Y;
+   randomize( C );
+
+   blaze::solve( A, Y, C );
+
+   checkResult( CMT( A*Y ), C, "Solving the LSE with multiple right-hand sides failed" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a decomposition against the expected matrix.
+//
+// \param result The reconstructed matrix.
+// \param expected The expected matrix.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the two given matrices element-wise with an absolute tolerance that
+// accounts for the accumulated rounding errors of the factorization.
+*/
+template< typename MT1    // Type of the reconstructed matrix
+        , typename MT2 >  // Type of the expected matrix
+void DenseNativeTest::checkResult( const MT1& result, const MT2& expected, const char* error ) const
+{
+   const double diff( max( abs( result - expected ) ) );
+
+   if( !( diff < 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_<MT1> ).name() << "\n"
+          << "   Rows: " << result.rows() << ", columns: " << result.columns() << "\n"
+          << "   Maximum deviation: " << diff << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native dense matrix decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseNativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native dense matrix decomposition test.
+*/
+#define RUN_DENSE_NATIVE_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,394 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/decomposition/DenseSVDTest.h
+//  \brief Header file for the dense matrix singular value decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSESVDTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSESVDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Column.h>
+#include <blaze/math/dense/SVD.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense matrix singular value decomposition tests.
+//
+// This class represents a test suite for the dense matrix singular value decomposition (SVD)
+// functionality. It performs a series of decompositions of matrices of all supported element
+// types and storage orders, including the partial decomposition and the workspace reuse.
+*/
+class DenseSVDTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseSVDTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testFull( size_t m, size_t n );
+
+   template< typename Type >
+   void testPartial( size_t m, size_t n );
+
+   void testWorkspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected, const char* error ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkValues( const VT1& result, const VT2& expected, const char* error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the full singular value decomposition.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the singular value decomposition of a randomly initialized matrix of the
+// given type by reconstructing the matrix from its factors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSVDTest::testFull( size_t m, size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Full singular value decomposition";
+
+   typedef blaze::ElementType_<Type>                     ET;
+   typedef blaze::UnderlyingBuiltin_<ET>                 BT;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   Type A( m, n );
+   randomize( A );
+
+   blaze::DynamicVector<BT,blaze::columnVector> s, s2;
+   Type U, V;
+
+   blaze::svd( A, U, s, V );
+   blaze::svd( A, s2 );
+
+   CMT US( U );
+   for( size_t j=0UL; j<s.size(); ++j ) {
+      column( US, j ) *= s[j];
+   }
+
+   checkResult( CMT( US * V ), A, "Singular value decomposition failed" );
+   checkValues( s2, s, "Singular values without singular vectors differ" );
+
+   for( size_t i=1UL; i<s.size(); ++i ) {
+      if( s[i-1UL] < s[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular values are not sorted in descending order\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Singular values:\n" << s << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partial singular value decomposition.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the computation of the singular values within an index range and within
+// a value range of a randomly initialized matrix of the given type. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSVDTest::testPartial( size_t m, size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Partial singular value decomposition";
+
+   typedef blaze::ElementType_<Type>                     ET;
+   typedef blaze::UnderlyingBuiltin_<ET>                 BT;
+   typedef blaze::DynamicMatrix<ET,blaze::columnMajor>  CMT;
+
+   const size_t k( blaze::min( m, n ) );
+
+   Type A( m, n );
+   randomize( A );
+
+   blaze::DynamicVector<BT,blaze::columnVector> s, si, sv;
+   Type U, V;
+
+   blaze::svd( A, s );
+
+   // Index range
+   {
+      const size_t ns( blaze::svd( A, U, si, V, 0UL, 3UL ) );
+
+      if( ns != 4UL || U.rows() != m || U.columns() != 4UL || V.rows() != 4UL || V.columns() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of singular triplets in index range\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of singular values: " << ns << "\n"
+             << "   U: " << U.rows() << "x" << U.columns() << "\n"
+             << "   V: " << V.rows() << "x" << V.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValues( si, subvector( s, 0UL, 4UL ), "Singular values in index range differ" );
+
+      CMT US( U );
+      for( size_t j=0UL; j<ns; ++j ) {
+         column( US, j ) *= si[j];
+      }
+
+      checkResult( CMT( A * ctrans( V ) ), US, "Singular vectors in index range failed" );
+   }
+
+   // Value range
+   {
+      const BT low( ( s[k-3UL] + s[k-2UL] ) / BT(2) );
+      const BT upp( s[0UL] + BT(1) );
+
+      const size_t ns( blaze::svd( A, sv, low, upp ) );
+
+      if( ns != k-2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of singular values in value range\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of singular values: " << ns << " (expected " << k-2UL << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValues( sv, subvector( s, 0UL, k-2UL ), "Singular values in value range differ" );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a decomposition against the expected matrix.
+//
+// \param result The reconstructed matrix.
+// \param expected The expected matrix.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the reconstructed matrix
+        , typename MT2 >  // Type of the expected matrix
+void DenseSVDTest::checkResult( const MT1& result, const MT2& expected, const char* error ) const
+{
+   const double diff( max( abs( result - expected ) ) );
+
+   if( !( diff < 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_<MT1> ).name() << "\n"
+          << "   Rows: " << result.rows() << ", columns: " << result.columns() << "\n"
+          << "   Maximum deviation: " << diff << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking two vectors of singular values against each other.
+//
+// \param result The computed singular values.
+// \param expected The expected singular values.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed singular values
+        , typename VT2 >  // Type of the expected singular values
+void DenseSVDTest::checkValues( const VT1& result, const VT2& expected, const char* error ) const
+{
+   if( result.size() != expected.size() || !( max( abs( result - expected ) ) < 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix singular value decomposition functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseSVDTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix singular value decomposition test.
+*/
+#define RUN_DENSE_SVD_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -103,6 +103,8 @@ class GeneralTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testProduct();
    void testTrace();
 
    template< typename Type >
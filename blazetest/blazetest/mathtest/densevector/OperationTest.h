@@ -88,6 +88,9 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testProduct();
+   void testFuse();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -0,0 +1,317 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/dmatdvecmult/MixedPrecisionTest.h
+//  \brief Header file for the mixed-precision dense matrix/dense vector multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDVECMULT_MIXEDPRECISIONTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDVECMULT_MIXEDPRECISIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdvecmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the mixed-precision dense matrix/dense vector multiplication test.
+//
+// This class represents a test suite for the mixed-precision kernels of the dense matrix/dense
+// vector multiplication, which multiply single precision matrices with double precision vectors,
+// and for the mixed-precision reductions of dense vectors. All results are compared to reference
+// results that are computed with double precision accumulation.
+*/
+class MixedPrecisionTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicVector<double,blaze::columnVector>  DVec;   //!< Double precision vector type.
+   typedef blaze::DynamicVector<float,blaze::columnVector>   FVec;   //!< Single precision vector type.
+   typedef blaze::DynamicMatrix<float,blaze::rowMajor>       DMat;   //!< Row-major single precision matrix type.
+   typedef blaze::DynamicMatrix<float,blaze::columnMajor>    TDMat;  //!< Column-major single precision matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MixedPrecisionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDMatDVecMult ();
+   void testTDMatDVecMult();
+   void testReductions   ();
+
+   template< typename MT >
+   void testMult( size_t m, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult ) const;
+
+   void checkValue( double computedValue, double expectedValue ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   DVec reference( const MT& A, const DVec& x ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all multiplication operations for a single precision matrix of given size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, the addition assignment and the subtraction assignment
+// of the plain and the scaled multiplication of a random single precision matrix with a random
+// double precision vector. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT >  // Type of the single precision matrix
+void MixedPrecisionTest::testMult( size_t m, size_t n )
+{
+   MT A( m, n );
+   DVec x( n ), y( m ), init( m );
+
+   randomize( A );
+   randomize( x );
+   randomize( init );
+
+   const DVec ref( reference( A, x ) );
+
+   y = A * x;
+   checkResult( y, ref );
+
+   y = init;
+   y += A * x;
+   checkResult( y, init + ref );
+
+   y = init;
+   y -= A * x;
+   checkResult( y, init - ref );
+
+   y = 2.0 * ( A * x );
+   checkResult( y, 2.0 * ref );
+
+   y = init;
+   y += ( A * x ) * 3.0;
+   checkResult( y, init + 3.0 * ref );
+
+   y = init;
+   y -= 2 * ( A * x );
+   checkResult( y, init - 2.0 * ref );
+
+   if( m > 2UL && n > 2UL ) {
+      y = init;
+      subvector( y, 1UL, m-2UL ) = submatrix( A, 1UL, 1UL, m-2UL, n-2UL ) * subvector( x, 1UL, n-2UL );
+
+      DVec expected( init );
+      subvector( expected, 1UL, m-2UL ) =
+         reference( submatrix( A, 1UL, 1UL, m-2UL, n-2UL ), DVec( subvector( x, 1UL, n-2UL ) ) );
+      checkResult( y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed and the expected result with a tolerance that is only
+// met in case all products and sums have been computed in double precision. In case the two
+// results differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Vector type of the computed result
+        , typename T2 >  // Vector type of the expected result
+void MixedPrecisionTest::checkResult( const T1& computedResult, const T2& expectedResult ) const
+{
+   const DVec expected( expectedResult );
+
+   bool error( computedResult.size() != expected.size() );
+
+   for( size_t i=0UL; !error && i<expected.size(); ++i ) {
+      error = !( std::fabs( computedResult[i] - expected[i] ) <= 1E-12 * ( 1.0 + std::fabs( expected[i] ) ) );
+   }
+
+   if( error ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the reference result of a matrix/vector multiplication.
+//
+// \param A The single precision matrix.
+// \param x The double precision vector.
+// \return The reference result computed with double precision accumulation.
+*/
+template< typename MT >  // Type of the single precision matrix
+MixedPrecisionTest::DVec MixedPrecisionTest::reference( const MT& A, const DVec& x ) const
+{
+   DVec y( A.rows() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      double sum( 0.0 );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         sum += double( A(i,j) ) * x[j];
+      }
+      y[i] = sum;
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the mixed-precision dense matrix/dense vector multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   MixedPrecisionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the mixed-precision dense matrix/dense vector multiplication
+//        test.
+*/
+#define RUN_DMATDVECMULT_MIXEDPRECISION_TEST \
+   blazetest::mathtest::dmatdvecmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdvecmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
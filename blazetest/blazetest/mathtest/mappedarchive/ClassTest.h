@@ -0,0 +1,410 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/mappedarchive/ClassTest.h
+//  \brief Header file for the MappedArchive class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MAPPEDARCHIVE_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPEDARCHIVE_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedCompressedMatrix.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedarchive {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedArchive class.
+//
+// This class represents a test suite for the blaze::MappedArchiveWriter and blaze::MappedArchive
+// classes. It performs a series of runtime tests with different vector and matrix types to test
+// the zero-copy loading of dense vectors, dense matrices and sparse matrices.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseMatrices  ();
+   void testDenseVectors   ();
+   void testSparseMatrices ();
+   void testMultipleEntries();
+   void testLifetime       ();
+   void testFailures       ();
+   void testCorruptEntries ();
+
+   template< typename MT, typename Type, bool AF, bool PF, bool SO >
+   void runDenseMatrixTest( const MT& src, blaze::CustomMatrix<Type,AF,PF,SO>& dst );
+
+   template< typename VT, typename Type, bool AF, bool PF, bool TF >
+   void runDenseVectorTest( const VT& src, blaze::CustomVector<Type,AF,PF,TF>& dst );
+
+   template< typename MT, typename Type, bool SO >
+   void runSparseMatrixTest( const MT& src, blaze::MappedCompressedMatrix<Type,SO>& dst );
+
+   template< typename T1, typename T2 >
+   void compare( const T1& src, const T2& dst );
+
+   template< typename Target >
+   void checkCorruption( const std::string& corruption );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void patch( size_t position, const Type& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;      //!< Label of the currently performed test.
+   std::string filename_;  //!< Name of the temporary archive file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix to an archive and maps it into the given custom matrix.
+//
+// \param src The dense matrix to be written.
+// \param dst The custom matrix to be reset to the mapped matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename Type  // Data type of the custom matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+void ClassTest::runDenseMatrixTest( const MT& src, blaze::CustomMatrix<Type,AF,PF,SO>& dst )
+{
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << src;
+   }
+
+   blaze::MappedArchive archive( filename_ );
+   archive >> dst;
+
+   if( !archive.eof() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: End of archive not reached\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( dst ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( dst.spacing() * sizeof( Type ) % 64UL != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid spacing of mapped matrix\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( dst ).name() << "\n"
+          << "   Spacing: " << dst.spacing() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   compare( src, dst );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector to an archive and maps it into the given custom vector.
+//
+// \param src The dense vector to be written.
+// \param dst The custom vector to be reset to the mapped vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT    // Type of the dense vector
+        , typename Type  // Data type of the custom vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+void ClassTest::runDenseVectorTest( const VT& src, blaze::CustomVector<Type,AF,PF,TF>& dst )
+{
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << src;
+   }
+
+   blaze::MappedArchive archive( filename_ );
+   archive >> dst;
+
+   if( !archive.eof() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: End of archive not reached\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( dst ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   compare( src, dst );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix to an archive and maps it into the given view.
+//
+// \param src The sparse matrix to be written.
+// \param dst The mapped compressed matrix to be reset to the mapped matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename Type  // Data type of the mapped compressed matrix
+        , bool SO >      // Storage order
+void ClassTest::runSparseMatrixTest( const MT& src, blaze::MappedCompressedMatrix<Type,SO>& dst )
+{
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << src;
+   }
+
+   blaze::MappedArchive archive( filename_ );
+   archive >> dst;
+
+   if( !archive.eof() || dst.nonZeros() != nonZeros( src ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( dst ).name() << "\n"
+          << "   Number of non-zeros: " << dst.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( src ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   compare( src, dst );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the given source and mapped vector or matrix.
+//
+// \param src The vector or matrix that has been written to the archive.
+// \param dst The mapped vector or matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the source vector or matrix
+        , typename T2 >  // Type of the mapped vector or matrix
+void ClassTest::compare( const T1& src, const T2& dst )
+{
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapped data does not match the written data\n"
+          << " Details:\n"
+          << "   Source type:\n"
+          << "     " << typeid( src ).name() << "\n"
+          << "   Destination type:\n"
+          << "     " << typeid( dst ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Checking that the corrupted archive entry is rejected.
+//
+// \param corruption Description of the corruption of the archive entry.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function maps the archive file and tries to load the first entry into a vector or matrix
+// of the given type. In case the loading attempt succeeds, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Target >  // Type of the target vector or matrix
+void ClassTest::checkCorruption( const std::string& corruption )
+{
+   try {
+      blaze::MappedArchive archive( filename_ );
+      Target dst;
+      archive >> dst;
+   }
+   catch( std::runtime_error& ) {
+      return;
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Loading of a corrupt archive entry succeeded\n"
+       << " Details:\n"
+       << "   Corruption: " << corruption << "\n"
+       << "   Target type:\n"
+       << "     " << typeid( Target ).name() << "\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Overwriting the bytes of the archive file at the given position with the given value.
+//
+// \param position The position in the archive file.
+// \param value The value to be written.
+// \return void
+*/
+template< typename Type >  // Type of the value
+void ClassTest::patch( size_t position, const Type& value ) const
+{
+   std::fstream file( filename_.c_str(), std::ios::binary | std::ios::in | std::ios::out );
+   file.seekp( static_cast<std::streamoff>( position ) );
+   file.write( reinterpret_cast<const char*>( &value ), sizeof( Type ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedArchive class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedArchive class test.
+*/
+#define RUN_MAPPEDARCHIVE_CLASS_TEST \
+   blazetest::mathtest::mappedarchive::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedarchive
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
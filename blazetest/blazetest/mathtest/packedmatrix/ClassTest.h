@@ -0,0 +1,357 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/packedmatrix/ClassTest.h
+//  \brief Header file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PackedMatrix class template.
+//
+// This class represents a test suite for the PackedMatrix class template. It performs a series
+// of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAccess      ();
+   void testIterator    ();
+   void testResize      ();
+   void testMult        ();
+   void testRankUpdate  ();
+
+   template< typename PM >
+   void testMult( size_t n );
+
+   template< typename PM >
+   void testRankUpdate( size_t n );
+
+   template< typename PM >
+   void checkSize( const PM& A, size_t expectedSize ) const;
+
+   template< typename PM, typename MT >
+   void checkMatrix( const PM& A, const MT& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename PM >
+   PM generate( size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the packed matrix/vector and matrix/matrix multiplications for a specific type.
+//
+// \param n The number of rows and columns of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the packed multiplication kernels and the default
+// multiplication expressions with the results of the according dense multiplications. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PM >  // Type of the packed matrix
+void ClassTest::testMult( size_t n )
+{
+   typedef blaze::ElementType_<PM>  Type;
+
+   const PM A( generate<PM>( n ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> D( A );
+
+   const blaze::DynamicVector<Type> x( blaze::rand< blaze::DynamicVector<Type> >( n, 0, 9 ) );
+   blaze::DynamicVector<Type> y( n, Type(2) );
+
+   spmv( y, A, x, Type(3), Type(1) );
+   checkVector( y, Type(3)*D*x + blaze::DynamicVector<Type>( n, Type(2) ) );
+
+   spmv( y, A, x, Type(1), Type(0) );
+   checkVector( y, D*x );
+
+   checkVector( blaze::DynamicVector<Type>( A*x ), D*x );
+
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( n, 7UL, 0, 9 ) );
+   blaze::DynamicMatrix<Type,blaze::rowMajor> C( n, 7UL, Type(1) );
+
+   spmm( C, A, B, Type(2), Type(1) );
+   checkMatrix( C, Type(2)*D*B + blaze::DynamicMatrix<Type>( n, 7UL, Type(1) ) );
+
+   spmm( C, A, B, Type(1), Type(0) );
+   checkMatrix( C, D*B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed rank-k update for a specific type.
+//
+// \param n The number of rows and columns of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the packed rank-k update with the result of the
+// according dense computation. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename PM >  // Type of the packed matrix
+void ClassTest::testRankUpdate( size_t n )
+{
+   typedef blaze::ElementType_<PM>  Type;
+
+   const blaze::DynamicMatrix<Type> X( blaze::rand< blaze::DynamicMatrix<Type> >( n, 5UL, 0, 9 ) );
+   const blaze::DynamicMatrix<Type> XXt( blaze::IsHermitian<PM>::value ? blaze::DynamicMatrix<Type>( X * ctrans( X ) )
+                                                                      : blaze::DynamicMatrix<Type>( X * trans( X ) ) );
+
+   PM C;
+   sprk( C, X, Type(1), Type(0) );
+   checkSize  ( C, n );
+   checkMatrix( C, XXt );
+
+   const blaze::DynamicMatrix<Type> D( C );
+   sprk( C, X, Type(2), Type(3) );
+   checkMatrix( C, Type(2)*XXt + Type(3)*D );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows and columns of the given packed matrix.
+//
+// \param A The packed matrix to be checked.
+// \param expectedSize The expected number of rows and columns of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename PM >  // Type of the packed matrix
+void ClassTest::checkSize( const PM& A, size_t expectedSize ) const
+{
+   if( A.rows() != expectedSize || A.columns() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( PM ).name() << "\n"
+          << "   Number of rows   : " << A.rows() << "\n"
+          << "   Number of columns: " << A.columns() << "\n"
+          << "   Expected size    : " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename PM    // Type of the checked matrix
+        , typename MT >  // Type of the expected matrix
+void ClassTest::checkMatrix( const PM& A, const MT& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( PM ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a packed matrix with small random integral values.
+//
+// \param n The number of rows and columns of the packed matrix.
+// \return The random packed matrix.
+//
+// The small integral values keep all products exact and therefore comparable with the results
+// of the according dense operations.
+*/
+template< typename PM >  // Type of the packed matrix
+PM ClassTest::generate( size_t n ) const
+{
+   return blaze::rand<PM>( n, 0, 9 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PackedMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PackedMatrix class test.
+*/
+#define RUN_PACKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
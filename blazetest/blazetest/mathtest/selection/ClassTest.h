@@ -0,0 +1,677 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/selection/ClassTest.h
+//  \brief Header file for the selection view class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SELECTION_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SELECTION_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/ColumnSelection.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/ElementSelection.h>
+#include <blaze/math/RowSelection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace selection {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the selection views.
+//
+// This class represents a test suite for the RowSelection, ColumnSelection, and ElementSelection
+// class templates and the according rows(), columns(), and elements() functions. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRows       ();
+   void testColumns    ();
+   void testElements   ();
+   void testExpressions();
+   void testAssignment ();
+   void testComposition();
+   void testExceptions ();
+
+   template< typename MT >
+   void testRows( size_t m, size_t n, const std::vector<size_t>& indices );
+
+   template< typename MT >
+   void testColumns( size_t m, size_t n, const std::vector<size_t>& indices );
+
+   template< typename VT >
+   void testElements( size_t n, const std::vector<size_t>& indices );
+
+   template< typename MT >
+   void testRowAssignment( size_t m, size_t n );
+
+   template< typename MT >
+   void testColumnAssignment( size_t m, size_t n );
+
+   template< typename MT1, typename MT2 >
+   void checkSize( const MT1& A, const MT2& expected ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& A, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   blaze::DynamicMatrix< blaze::ElementType_<MT> >
+      selectRows( const MT& A, const std::vector<size_t>& indices ) const;
+
+   template< typename MT >
+   blaze::DynamicMatrix< blaze::ElementType_<MT> >
+      selectColumns( const MT& A, const std::vector<size_t>& indices ) const;
+
+   std::vector<size_t> permutation( size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the rows() view for a specific matrix type.
+//
+// \param m The number of rows of the underlying matrix.
+// \param n The number of columns of the underlying matrix.
+// \param indices The indices of the selected rows.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the element access, the iterators, and the assignment of the rows()
+// view to dense matrices of both storage orders. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ClassTest::testRows( size_t m, size_t n, const std::vector<size_t>& indices )
+{
+   typedef blaze::ElementType_<MT>  Type;
+
+   const MT A( blaze::rand<MT>( m, n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type> expected( selectRows( A, indices ) );
+
+   auto R = rows( A, indices );
+
+   checkSize  ( R, expected );
+   checkMatrix( R, expected );
+
+   for( size_t i=0UL; i<R.rows(); ++i ) {
+      for( size_t j=0UL; j<R.columns(); ++j ) {
+         if( R(i,j) != A(indices[i],j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element access detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Element (" << i << "," << j << "): " << R(i,j) << "\n"
+                << "   Expected: " << A(indices[i],j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   const bool rowMajor( blaze::IsRowMajorMatrix<MT>::value );
+
+   for( size_t k=0UL; k<( rowMajor ? R.rows() : R.columns() ); ++k ) {
+      size_t l( 0UL );
+      for( auto it=R.cbegin(k); it!=R.cend(k); ++it, ++l ) {
+         const size_t i( rowMajor ? k : l );
+         const size_t j( rowMajor ? l : k );
+         if( *it != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Element (" << i << "," << j << "): " << *it << "\n"
+                << "   Expected: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      if( l != ( rowMajor ? R.columns() : R.rows() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator range detected\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Number of traversed elements: " << l << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor>    B( R );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> C( R );
+
+   checkMatrix( B, expected );
+   checkMatrix( C, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the columns() view for a specific matrix type.
+//
+// \param m The number of rows of the underlying matrix.
+// \param n The number of columns of the underlying matrix.
+// \param indices The indices of the selected columns.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the element access, the iterators, and the assignment of the columns()
+// view to dense matrices of both storage orders. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ClassTest::testColumns( size_t m, size_t n, const std::vector<size_t>& indices )
+{
+   typedef blaze::ElementType_<MT>  Type;
+
+   const MT A( blaze::rand<MT>( m, n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type> expected( selectColumns( A, indices ) );
+
+   auto C = columns( A, indices );
+
+   checkSize  ( C, expected );
+   checkMatrix( C, expected );
+
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( size_t j=0UL; j<C.columns(); ++j ) {
+         if( C(i,j) != A(i,indices[j]) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element access detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Element (" << i << "," << j << "): " << C(i,j) << "\n"
+                << "   Expected: " << A(i,indices[j]) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   const bool rowMajor( blaze::IsRowMajorMatrix<MT>::value );
+
+   for( size_t k=0UL; k<( rowMajor ? C.rows() : C.columns() ); ++k ) {
+      size_t l( 0UL );
+      for( auto it=C.cbegin(k); it!=C.cend(k); ++it, ++l ) {
+         const size_t i( rowMajor ? k : l );
+         const size_t j( rowMajor ? l : k );
+         if( *it != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Element (" << i << "," << j << "): " << *it << "\n"
+                << "   Expected: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      if( l != ( rowMajor ? C.columns() : C.rows() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator range detected\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Number of traversed elements: " << l << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor>    B( C );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> D( C );
+
+   checkMatrix( B, expected );
+   checkMatrix( D, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the elements() view for a specific vector type.
+//
+// \param n The size of the underlying vector.
+// \param indices The indices of the selected elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the element access, the iterators, and the assignment of the elements()
+// view to a dense vector. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename VT >  // Type of the dense vector
+void ClassTest::testElements( size_t n, const std::vector<size_t>& indices )
+{
+   const VT x( blaze::rand<VT>( n, 0, 9 ) );
+
+   VT expected( indices.size() );
+   for( size_t i=0UL; i<indices.size(); ++i ) {
+      expected[i] = x[indices[i]];
+   }
+
+   auto e = elements( x, indices );
+
+   if( e.size() != indices.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT ).name() << "\n"
+          << "   Size         : " << e.size() << "\n"
+          << "   Expected size: " << indices.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkVector( e, expected );
+
+   size_t l( 0UL );
+   for( auto it=e.cbegin(); it!=e.cend(); ++it, ++l ) {
+      if( *it != expected[l] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator detected\n"
+             << " Details:\n"
+             << "   Vector type:\n"
+             << "     " << typeid( VT ).name() << "\n"
+             << "   Element " << l << ": " << *it << "\n"
+             << "   Expected: " << expected[l] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const VT y( e );
+   checkVector( y, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rows() view as target of assignments for a specific matrix type.
+//
+// \param m The number of rows of the underlying matrix.
+// \param n The number of columns of the underlying matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns, adds, subtracts, and scales dense matrices of both storage orders to
+// a selection of rows and compares the result with the according element-wise computation. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ClassTest::testRowAssignment( size_t m, size_t n )
+{
+   typedef blaze::ElementType_<MT>  Type;
+
+   const std::vector<size_t> indices( permutation( m ) );
+   const size_t k( indices.size() / 2UL );
+   const std::vector<size_t> selected( indices.begin(), indices.begin()+k );
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::rowMajor> >( k, n, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> C(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( k, n, 0, 9 ) );
+
+   MT A( blaze::rand<MT>( m, n, 0, 9 ) );
+   blaze::DynamicMatrix<Type> expected( A );
+
+   rows( A, selected ) = B;
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(selected[i],j) = B(i,j);
+   checkMatrix( A, expected );
+
+   rows( A, selected ) += C;
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(selected[i],j) += C(i,j);
+   checkMatrix( A, expected );
+
+   rows( A, selected ) -= B;
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(selected[i],j) -= B(i,j);
+   checkMatrix( A, expected );
+
+   rows( A, selected ) *= Type(3);
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(selected[i],j) *= Type(3);
+   checkMatrix( A, expected );
+
+   rows( A, indices ) = rows( blaze::DynamicMatrix<Type>( A ), indices );
+   checkMatrix( A, expected );
+
+   MT P( m, n );
+   rows( P, indices ) = A;
+   checkMatrix( rows( P, indices ), A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the columns() view as target of assignments for a specific matrix type.
+//
+// \param m The number of rows of the underlying matrix.
+// \param n The number of columns of the underlying matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns, adds, subtracts, and scales dense matrices of both storage orders to
+// a selection of columns and compares the result with the according element-wise computation.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ClassTest::testColumnAssignment( size_t m, size_t n )
+{
+   typedef blaze::ElementType_<MT>  Type;
+
+   const std::vector<size_t> indices( permutation( n ) );
+   const size_t k( indices.size() / 2UL );
+   const std::vector<size_t> selected( indices.begin(), indices.begin()+k );
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::rowMajor> >( m, k, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> C(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( m, k, 0, 9 ) );
+
+   MT A( blaze::rand<MT>( m, n, 0, 9 ) );
+   blaze::DynamicMatrix<Type> expected( A );
+
+   columns( A, selected ) = C;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         expected(i,selected[j]) = C(i,j);
+   checkMatrix( A, expected );
+
+   columns( A, selected ) += B;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         expected(i,selected[j]) += B(i,j);
+   checkMatrix( A, expected );
+
+   columns( A, selected ) -= C;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         expected(i,selected[j]) -= C(i,j);
+   checkMatrix( A, expected );
+
+   columns( A, selected ) *= Type(2);
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         expected(i,selected[j]) *= Type(2);
+   checkMatrix( A, expected );
+
+   MT P( m, n );
+   columns( P, indices ) = A;
+   checkMatrix( columns( P, indices ), A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The matrix with the expected size.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the checked matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkSize( const MT1& A, const MT2& expected ) const
+{
+   if( A.rows() != expected.rows() || A.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Number of rows            : " << A.rows() << "\n"
+          << "   Number of columns         : " << A.columns() << "\n"
+          << "   Expected number of rows   : " << expected.rows() << "\n"
+          << "   Expected number of columns: " << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the checked matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& A, const MT2& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection of rows of the given matrix.
+//
+// \param A The given matrix.
+// \param indices The indices of the selected rows.
+// \return The matrix consisting of the selected rows.
+*/
+template< typename MT >  // Type of the matrix
+blaze::DynamicMatrix< blaze::ElementType_<MT> >
+   ClassTest::selectRows( const MT& A, const std::vector<size_t>& indices ) const
+{
+   blaze::DynamicMatrix< blaze::ElementType_<MT> > R( indices.size(), A.columns() );
+   for( size_t i=0UL; i<indices.size(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         R(i,j) = A(indices[i],j);
+      }
+   }
+   return R;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection of columns of the given matrix.
+//
+// \param A The given matrix.
+// \param indices The indices of the selected columns.
+// \return The matrix consisting of the selected columns.
+*/
+template< typename MT >  // Type of the matrix
+blaze::DynamicMatrix< blaze::ElementType_<MT> >
+   ClassTest::selectColumns( const MT& A, const std::vector<size_t>& indices ) const
+{
+   blaze::DynamicMatrix< blaze::ElementType_<MT> > C( A.rows(), indices.size() );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<indices.size(); ++j ) {
+         C(i,j) = A(i,indices[j]);
+      }
+   }
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the selection views.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the selection view class test.
+*/
+#define RUN_SELECTION_CLASS_TEST \
+   blazetest::mathtest::selection::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace selection
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,461 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/sellmatrix/ClassTest.h
+//  \brief Header file for the SellMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SELLMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SELLMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SellMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SellMatrix class template.
+//
+// This class represents a test suite for the SellMatrix class template. It performs a series
+// of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAccess      ();
+   void testIterator    ();
+   void testLookup      ();
+   void testMult        ();
+
+   template< typename Type >
+   void testIterator( size_t m, size_t n, size_t sigma );
+
+   template< typename Type >
+   void testMult( size_t m, size_t n );
+
+   template< typename MT >
+   void checkRows( const MT& A, size_t expectedRows ) const;
+
+   template< typename MT >
+   void checkColumns( const MT& A, size_t expectedColumns ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& A, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   blaze::CompressedMatrix<Type,blaze::rowMajor> generate( size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix iterators for a specific element type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param sigma The sorting scope of the SELL-C-sigma format.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function traverses all rows of a SellMatrix and compares the visited elements with the
+// elements of the original compressed matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void ClassTest::testIterator( size_t m, size_t n, size_t sigma )
+{
+   typedef blaze::CompressedMatrix<Type,blaze::rowMajor>  CMT;
+   typedef typename blaze::SellMatrix<Type>::ConstIterator  ConstIterator;
+
+   const CMT A( generate<Type>( m, n ) );
+   const blaze::SellMatrix<Type> S( A, sigma );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      typename CMT::ConstIterator element( A.begin(i) );
+
+      for( ConstIterator it=S.begin(i); it!=S.end(i); ++it, ++element )
+      {
+         if( element == A.end(i) || it->index() != element->index() || it->value() != element->value() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Index : " << it->index() << "\n"
+                << "   Value : " << it->value() << "\n"
+                << "   Matrix:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( element != A.end(i) || S.nonZeros(i) != A.nonZeros(i) ||
+          size_t( S.end(i) - S.begin(i) ) != A.nonZeros(i) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << S.nonZeros(i) << "\n"
+             << "   Expected number of non-zeros: " << A.nonZeros(i) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      nonzeros += S.nonZeros(i);
+   }
+
+   if( nonzeros != S.nonZeros() || S.nonZeros() != A.nonZeros() || S.capacity() < S.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << S.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << A.nonZeros() << "\n"
+          << "   Capacity                    : " << S.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix multiplication kernels for a specific element type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the spmv() and spmm() kernels and of the according
+// multiplication expressions with the results of the multiplications of the original compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void ClassTest::testMult( size_t m, size_t n )
+{
+   typedef blaze::CompressedMatrix<Type,blaze::rowMajor>  CMT;
+   typedef blaze::DynamicVector<Type,blaze::columnVector>  DVT;
+
+   const CMT A( generate<Type>( m, n ) );
+   const blaze::SellMatrix<Type> S( A, 8UL );
+
+   const DVT x( blaze::rand<DVT>( n, 0, 9 ) );
+   const DVT z( blaze::rand<DVT>( n, 0, 9 ) );
+   const DVT ref( A * x );
+
+   DVT y( m, Type(2) );
+
+   spmv( y, S, x, Type(3), Type(1) );
+   checkVector( y, Type(3)*ref + DVT( m, Type(2) ) );
+
+   spmv( y, S, x, Type(1), Type(0) );
+   checkVector( y, ref );
+
+   y = S * x;
+   checkVector( y, ref );
+
+   y += S * x;
+   checkVector( y, Type(2)*ref );
+
+   y -= S * x;
+   checkVector( y, ref );
+
+   y = S * ( x + z );
+   checkVector( y, A * ( x + z ) );
+
+   DVT w( m+2UL, Type(1) );
+   subvector( w, 1UL, m ) = S * x;
+   checkVector( subvector( w, 1UL, m ), ref );
+
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> B(
+      blaze::rand< blaze::DynamicMatrix<Type,blaze::columnMajor> >( n, 7UL, 0, 9 ) );
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> AB( A * B );
+   blaze::DynamicMatrix<Type,blaze::rowMajor> C( m, 7UL, Type(1) );
+
+   spmm( C, S, B, Type(2), Type(1) );
+   checkMatrix( C, Type(2)*AB + blaze::DynamicMatrix<Type>( m, 7UL, Type(1) ) );
+
+   C = S * B;
+   checkMatrix( C, AB );
+
+   C += S * B;
+   checkMatrix( C, Type(2)*AB );
+
+   C -= S * B;
+   checkMatrix( C, AB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkRows( const MT& A, size_t expectedRows ) const
+{
+   if( A.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << A.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::checkColumns( const MT& A, size_t expectedColumns ) const
+{
+   if( A.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << A.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given matrix.
+//
+// \param A The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the checked matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& A, const MT2& expected ) const
+{
+   if( A != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the checked vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a random row-major compressed matrix with small integral values.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The random compressed matrix.
+//
+// The rows of the matrix have strongly varying numbers of non-zero elements, which exercises
+// the sorting and padding of the SELL-C-sigma format. The small integral values keep all
+// products exact and therefore comparable with the results of the compressed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor> ClassTest::generate( size_t m, size_t n ) const
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n );
+
+   if( n == 0UL )
+      return A;
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t nonzeros( blaze::rand<size_t>( 0UL, ( i % 3UL == 0UL ) ? n : ( n+3UL ) / 4UL ) );
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A( i, blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<Type>( 1, 9 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SellMatrix class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SellMatrix class test.
+*/
+#define RUN_SELLMATRIX_CLASS_TEST \
+   blazetest::mathtest::sellmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -177,6 +177,8 @@ class OperationTest : private blaze::NonCopyable
    void testStorea        ();
    void testStream        ();
    void testStoreu        ( size_t offset );
+   void testMaskloadu     ( size_t n );
+   void testMaskstoreu    ( size_t n );
 
    void testAddition      ( blaze::TrueType  );
    void testAddition      ( blaze::FalseType );
@@ -329,6 +331,11 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   for( size_t n=1UL; n<=SIMDSIZE; ++n ) {
+      testMaskloadu ( n );
+      testMaskstoreu( n );
+   }
+
    testAddition      ( blaze::HasSIMDAdd    <T,T>() );
    testSubtraction   ( blaze::HasSIMDSub    <T,T>() );
    testMultiplication( blaze::HasSIMDMult   <T,T>() );
@@ -494,6 +501,75 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked unaligned load operation.
+//
+// \param n The number of elements per SIMD vector to be loaded.
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked unaligned load operation by loading the first \a n elements
+// of each SIMD vector of an array. All remaining elements are expected to be zero. In case any
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskloadu( size_t n )
+{
+   using blaze::maskloadu;
+   using blaze::storea;
+
+   test_  = "maskloadu() operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( i % SIMDSIZE < n ) ? a_[i] : T();
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( b_+i, maskloadu( a_+i, n ) );
+   }
+
+   compare( c_, b_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the masked unaligned store operation.
+//
+// \param n The number of elements per SIMD vector to be stored.
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked unaligned store operation by copying the first \a n elements
+// of each SIMD vector of an array to another array. All remaining elements of the target array
+// are expected to be unchanged. In case any error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskstoreu( size_t n )
+{
+   using blaze::maskloadu;
+   using blaze::maskstoreu;
+
+   test_  = "maskstoreu() operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( i % SIMDSIZE < n ) ? a_[i] : b_[i];
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      maskstoreu( b_+i, maskloadu( a_+i, n ), n );
+   }
+
+   compare( c_, b_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the addition operation.
 //
@@ -0,0 +1,338 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smpassign/SpGEMMTest.h
+//  \brief Header file for the sparse matrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMPASSIGN_SPGEMMTEST_H_
+#define _BLAZETEST_MATHTEST_SMPASSIGN_SPGEMMTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse matrix multiplication engine.
+//
+// This class represents a test suite for the Gustavson-based multiplication of two sparse
+// matrices, both for the serial and the SMP assignment. The operands are constructed such that
+// the lines of the target matrix are computed by all accumulators of the engine (i.e. the copy
+// of a single line, the hash accumulator, and the dense accumulator) and the results are
+// compared to the product of the according dense matrices. The number of threads is set to
+// four, such that the SMP backends partition the target matrices even on machines with a small
+// number of cores.
+*/
+class SpGEMMTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>  Pattern;  //!< Number of non-zero elements per line.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SpGEMMTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testHash();
+   void testDense();
+   void testMixed();
+   void testSymbolic();
+   void testWorkspace();
+   void testEmpty();
+
+   void runTest( size_t lines, size_t inner, size_t length,
+                 const Pattern& outer, const Pattern& pattern );
+
+   template< bool SO1, bool SO2 >
+   void runTest( const blaze::CompressedMatrix<double,SO2>& A,
+                 const blaze::CompressedMatrix<double,SO2>& B );
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& reference );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   blaze::CompressedMatrix<double,SO> create( size_t m, size_t n, const Pattern& pattern );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performing the multiplication of two sparse matrices.
+//
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns the product of the two given sparse matrices with storage order \a SO2
+// to a sparse matrix with storage order \a SO1, both via an SMP assignment and via a serial
+// assignment, and compares the results to the product of the according dense matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the target matrix
+        , bool SO2 >  // Storage order of the operands
+void SpGEMMTest::runTest( const blaze::CompressedMatrix<double,SO2>& A,
+                          const blaze::CompressedMatrix<double,SO2>& B )
+{
+   const blaze::DynamicMatrix<double,SO2> DA( A );
+   const blaze::DynamicMatrix<double,SO2> DB( B );
+   const blaze::DynamicMatrix<double,SO1> ref( DA * DB );
+
+   {
+      const blaze::CompressedMatrix<double,SO1> C( A * B );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,SO1> C( ref.rows(), ref.columns() );
+      randomize( C, blaze::min( ref.rows() * ref.columns(), 100UL ) );
+
+      C = A * B;
+      checkResult( C, ref );
+   }
+
+   BLAZE_SERIAL_SECTION
+   {
+      blaze::CompressedMatrix<double,SO1> C( A * B );
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a sparse matrix multiplication to a dense reference.
+//
+// \param result The result of the sparse matrix multiplication.
+// \param reference The result of the according dense matrix multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the values and the number of non-zero elements of the given sparse
+// matrix to the given dense matrix and checks that the indices of the non-zero elements in
+// each row/column of the sparse matrix are strictly increasing. Since all elements of the
+// operands are positive, the sparse result must not contain any explicit zeros. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the sparse result
+        , typename MT2 >  // Type of the dense reference
+void SpGEMMTest::checkResult( const MT1& result, const MT2& reference )
+{
+   typedef blaze::ConstIterator_<MT1>  ConstIterator;
+
+   const size_t lines( blaze::IsRowMajorMatrix<MT1>::value ? result.rows() : result.columns() );
+
+   bool equal( result.rows() == reference.rows() && result.columns() == reference.columns() &&
+               result.nonZeros() == nonZeros( reference ) && result == reference );
+
+   for( size_t i=0UL; equal && i<lines; ++i ) {
+      const ConstIterator end( result.end(i) );
+      for( ConstIterator element=result.begin(i); equal && element!=end; ++element ) {
+         ConstIterator next( element );
+         equal = ( ++next == end || element->index() < next->index() );
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of sparse matrix multiplication\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Result type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result (" << result.rows() << "x" << result.columns() << ", "
+          << result.nonZeros() << " non-zeros)\n"
+          << "   Expected result (" << reference.rows() << "x" << reference.columns() << ", "
+          << nonZeros( reference ) << " non-zeros)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a random sparse matrix with a given number of non-zero elements per line.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pattern The number of non-zero elements of the lines, which is repeated cyclically.
+// \return The random sparse matrix.
+//
+// This function creates a sparse matrix whose rows (in case of a row-major matrix) or columns
+// (in case of a column-major matrix) contain the number of non-zero elements given by the
+// pattern. All non-zero elements are positive integral values.
+*/
+template< bool SO >  // Storage order of the sparse matrix
+blaze::CompressedMatrix<double,SO>
+   SpGEMMTest::create( size_t m, size_t n, const Pattern& pattern )
+{
+   const size_t lines ( SO ? n : m );
+   const size_t length( SO ? m : n );
+
+   blaze::CompressedMatrix<double,SO> matrix( m, n );
+
+   for( size_t i=0UL; i<lines; ++i )
+   {
+      const size_t nonzeros( blaze::min( pattern[i%pattern.size()], length ) );
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+      {
+         size_t j( blaze::rand<size_t>( 0UL, length-1UL ) );
+         while( SO ? !isDefault( matrix(j,i) ) : !isDefault( matrix(i,j) ) ) {
+            j = ( j + 1UL ) % length;
+         }
+
+         const double value( blaze::rand<size_t>( 1UL, 9UL ) );
+
+         if( SO ) matrix(j,i) = value;
+         else     matrix(i,j) = value;
+      }
+   }
+
+   return matrix;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix multiplication engine.
+//
+// \return void
+*/
+void runTest()
+{
+   SpGEMMTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix multiplication test.
+*/
+#define RUN_SMPASSIGN_SPGEMM_TEST \
+   blazetest::mathtest::smpassign::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
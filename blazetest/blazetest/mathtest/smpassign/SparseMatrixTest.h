@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smpassign/SparseMatrixTest.h
+//  \brief Header file for the SMP sparse matrix assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMPASSIGN_SPARSEMATRIXTEST_H_
+#define _BLAZETEST_MATHTEST_SMPASSIGN_SPARSEMATRIXTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP assignment to sparse matrices.
+//
+// This class represents a test suite for the SMP assignment of dense matrices to sparse matrices.
+// It performs a series of assignments with several threads and compares the resulting sparse
+// matrices to the results of the according serial assignments. The number of threads is set to
+// four, such that the SMP backends partition the target matrices even on machines with a small
+// number of cores.
+*/
+class SparseMatrixTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseMatrixTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testThreads();
+   void testAssignment();
+   void testReassignment();
+   void testMultiplication();
+
+   template< bool SO1, bool SO2 >
+   void runAssignmentTest( size_t m, size_t n, size_t nonzeros );
+
+   template< bool SO1, bool SO2 >
+   void runMultiplicationTest( size_t m, size_t k, size_t n, size_t nonzeros );
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& reference );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an SMP assignment to the result of a serial assignment.
+//
+// \param result The result of the SMP assignment.
+// \param reference The result of the serial assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the values and the sparsity pattern of the two given sparse matrices,
+// i.e. also the number of non-zero elements of every row/column. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the result of the SMP assignment
+        , typename MT2 >  // Type of the result of the serial assignment
+void SparseMatrixTest::checkResult( const MT1& result, const MT2& reference )
+{
+   const size_t lines( blaze::IsRowMajorMatrix<MT1>::value ? result.rows() : result.columns() );
+
+   bool equal( result.rows() == reference.rows() && result.columns() == reference.columns() &&
+               result.nonZeros() == reference.nonZeros() && result == reference );
+
+   for( size_t i=0UL; equal && i<lines; ++i ) {
+      equal = ( result.nonZeros( i ) == reference.nonZeros( i ) );
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of SMP assignment\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Result type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result (" << result.rows() << "x" << result.columns() << ", "
+          << result.nonZeros() << " non-zeros)\n"
+          << "   Expected result (" << reference.rows() << "x" << reference.columns() << ", "
+          << reference.nonZeros() << " non-zeros)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to sparse matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseMatrixTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse matrix assignment test.
+*/
+#define RUN_SMPASSIGN_SPARSEMATRIX_TEST \
+   blazetest::mathtest::smpassign::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smpassign/SparseVectorTest.h
+//  \brief Header file for the SMP sparse vector assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMPASSIGN_SPARSEVECTORTEST_H_
+#define _BLAZETEST_MATHTEST_SMPASSIGN_SPARSEVECTORTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP assignment to sparse vectors.
+//
+// This class represents a test suite for the SMP assignment of dense vectors to sparse vectors.
+// It performs a series of assignments with several threads and compares the resulting sparse
+// vectors to the results of the according serial assignments. The number of threads is set to
+// four, such that the SMP backends partition the target vectors even on machines with a small
+// number of cores.
+*/
+class SparseVectorTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseVectorTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testThreads();
+   void testAssignment();
+   void testComputation();
+
+   template< bool TF >
+   void runAssignmentTest( size_t n, size_t nonzeros );
+
+   template< typename VT1, typename VT2 >
+   void checkResult( const VT1& result, const VT2& reference );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an SMP assignment to the result of a serial assignment.
+//
+// \param result The result of the SMP assignment.
+// \param reference The result of the serial assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the values and the sparsity pattern of the two given sparse vectors,
+// i.e. also the indices of all non-zero elements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result of the SMP assignment
+        , typename VT2 >  // Type of the result of the serial assignment
+void SparseVectorTest::checkResult( const VT1& result, const VT2& reference )
+{
+   typedef blaze::ConstIterator_<VT1>  ConstIterator1;
+   typedef blaze::ConstIterator_<VT2>  ConstIterator2;
+
+   bool equal( result.size() == reference.size() && result.nonZeros() == reference.nonZeros() &&
+               result == reference );
+
+   ConstIterator2 ref( reference.begin() );
+
+   for( ConstIterator1 element=result.begin(); equal && element!=result.end(); ++element, ++ref ) {
+      equal = ( element->index() == ref->index() );
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of SMP assignment\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Result type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result (size " << result.size() << ", "
+          << result.nonZeros() << " non-zeros)\n"
+          << "   Expected result (size " << reference.size() << ", "
+          << reference.nonZeros() << " non-zeros)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to sparse vectors.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseVectorTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse vector assignment test.
+*/
+#define RUN_SMPASSIGN_SPARSEVECTOR_TEST \
+   blazetest::mathtest::smpassign::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,610 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/solvers/ClassTest.h
+//  \brief Header file for the iterative solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative solvers.
+//
+// This class represents a test suite for the iterative solver module. It tests the fused solver
+// kernels, the sparse triangular substitutions, the incomplete factorizations, the
+// preconditioners, the CG, BiCGSTAB and GMRES methods and the mixed-precision iterative
+// refinement.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testControl        ();
+   void testKernels        ();
+   void testSubstitution   ();
+   void testFactorizations ();
+   void testPreconditioners();
+   void testCG             ();
+   void testBiCGSTAB       ();
+   void testGMRES          ();
+   void testMPIR           ();
+
+   template< typename MT >
+   void testKernels( const MT& A );
+
+   template< typename MT >
+   void testSubstitution( const MT& A, char uplo );
+
+   template< typename MT, typename PT >
+   void testCG( const MT& A, const PT& M );
+
+   template< typename MT, typename PT >
+   void testBiCGSTAB( const MT& A, const PT& M );
+
+   template< typename MT, typename PT >
+   void testGMRES( const MT& A, const PT& M, size_t restart );
+
+   template< typename MT >
+   void testMPIR( const MT& A );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkSolution( const MT& A, const VT1& x, const VT2& b,
+                       const blaze::SolverControl& control, bool converged ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkFactorization( const MT1& A, const MT2& product ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+
+   template< typename T1, typename T2 >
+   void checkValue( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   blaze::CompressedMatrix<Type,blaze::rowMajor> poisson( size_t m ) const;
+
+   template< typename Type >
+   blaze::CompressedMatrix<Type,blaze::rowMajor> convection( size_t m ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the fused solver kernels for a specific matrix.
+//
+// \param A The matrix for the fused matrix/vector multiplication kernels.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the fused solver kernels with the results of the
+// according separate Blaze operations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::testKernels( const MT& A )
+{
+   typedef blaze::ElementType_<MT>            ET;
+   typedef blaze::DynamicVector<ET,blaze::columnVector>  VT;
+
+   VT x( A.columns() ), w( A.rows() ), y( A.rows() );
+   randomize( x );
+   randomize( w );
+
+   const VT ref( A * x );
+
+   {
+      const ET dot( blaze::multDot( y, A, x, w ) );
+
+      checkVector( y, ref );
+      checkValue( dot, ET( ctrans( w ) * ref ) );
+   }
+
+   {
+      const blaze::StaticVector<ET,2UL> dots( blaze::multDotNorm( y, A, x, w ) );
+
+      checkVector( y, ref );
+      checkValue( dots[0], ET( ctrans( w ) * ref ) );
+      checkValue( dots[1], ET( ctrans( ref ) * ref ) );
+   }
+
+   {
+      VT z( w );
+      const ET alpha( 2 );
+      const VT expected( w + alpha * y );
+      const auto norm( blaze::axpyNorm( z, alpha, y ) );
+
+      checkVector( z, expected );
+      checkValue( norm, std::real( ctrans( expected ) * expected ) );
+   }
+
+   {
+      VT z( w );
+      const ET alpha( 3 );
+      const VT expected( w + alpha * y );
+      const ET dot( blaze::axpyDot( z, alpha, y, x ) );
+
+      checkVector( z, expected );
+      checkValue( dot, ET( ctrans( x ) * expected ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular substitutions for a specific triangular matrix.
+//
+// \param A The sparse triangular matrix.
+// \param uplo \c 'L' for a lower triangular matrix, \c 'U' for an upper triangular matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a triangular system with a known solution by means of the serial and
+// the level-scheduled substitution, both out-of-place and in-place. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the triangular matrix
+void ClassTest::testSubstitution( const MT& A, char uplo )
+{
+   typedef blaze::ElementType_<MT>                       ET;
+   typedef blaze::DynamicVector<ET,blaze::columnVector>  VT;
+
+   VT x( A.rows() ), y;
+   randomize( x );
+
+   const VT b( A * x );
+
+   solve( A, y, b );
+   checkVector( y, x );
+
+   const blaze::LevelSchedule schedule( A, uplo );
+
+   reset( y );
+   solve( A, y, b, schedule );
+   checkVector( y, x );
+
+   VT z( b );
+   solve( A, z, z, schedule );
+   checkVector( z, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CG method for a specific system matrix and preconditioner.
+//
+// \param A The Hermitian positive definite system matrix.
+// \param M The preconditioner.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the system matrix
+        , typename PT >  // Type of the preconditioner
+void ClassTest::testCG( const MT& A, const PT& M )
+{
+   typedef blaze::DynamicVector<blaze::ElementType_<MT>,blaze::columnVector>  VT;
+
+   VT b( A.rows() ), x( A.rows(), 0 );
+   randomize( b );
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+   const bool converged( blaze::cg( A, x, b, control, M ) );
+
+   checkSolution( A, x, b, control, converged );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB method for a specific system matrix and preconditioner.
+//
+// \param A The system matrix.
+// \param M The preconditioner.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the system matrix
+        , typename PT >  // Type of the preconditioner
+void ClassTest::testBiCGSTAB( const MT& A, const PT& M )
+{
+   typedef blaze::DynamicVector<blaze::ElementType_<MT>,blaze::columnVector>  VT;
+
+   VT b( A.rows() ), x( A.rows(), 0 );
+   randomize( b );
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+   const bool converged( blaze::bicgstab( A, x, b, control, M ) );
+
+   checkSolution( A, x, b, control, converged );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the GMRES method for a specific system matrix and preconditioner.
+//
+// \param A The system matrix.
+// \param M The preconditioner.
+// \param restart The restart parameter of the GMRES method.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the system matrix
+        , typename PT >  // Type of the preconditioner
+void ClassTest::testGMRES( const MT& A, const PT& M, size_t restart )
+{
+   typedef blaze::DynamicVector<blaze::ElementType_<MT>,blaze::columnVector>  VT;
+
+   VT b( A.rows() ), x( A.rows(), 0 );
+   randomize( b );
+
+   blaze::SolverControl control( 2000UL, 1E-10, restart );
+   const bool converged( blaze::gmres( A, x, b, control, M ) );
+
+   checkSolution( A, x, b, control, converged );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision iterative refinement for a specific system matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the system matrix
+void ClassTest::testMPIR( const MT& A )
+{
+   typedef blaze::DynamicVector<blaze::ElementType_<MT>,blaze::columnVector>  VT;
+
+   VT b( A.rows() ), x( A.rows() );
+   randomize( b );
+
+   blaze::SolverControl control( 30UL, 1E-13 );
+   const bool converged( blaze::mpir( A, x, b, control ) );
+
+   checkSolution( A, x, b, control, converged );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST CHECK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the solution of an iterative solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param control The result of the solution process.
+// \param converged The return value of the solver.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver has converged and that the explicitly computed relative
+// residual of the solution matches the tolerance. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT     // Type of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void ClassTest::checkSolution( const MT& A, const VT1& x, const VT2& b,
+                               const blaze::SolverControl& control, bool converged ) const
+{
+   const VT2 r( b - A * x );
+   const double residual( std::sqrt( std::real( ctrans( r ) * r ) / std::real( ctrans( b ) * b ) ) );
+
+   if( !converged || !control.converged() || control.iterations() == 0UL ||
+       residual > 1E3 * control.tolerance() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solution process failed\n"
+          << " Details:\n"
+          << "   Converged                  : " << converged << "\n"
+          << "   Number of iterations       : " << control.iterations() << "\n"
+          << "   Reported relative residual : " << control.residual() << "\n"
+          << "   Actual relative residual   : " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an incomplete factorization.
+//
+// \param A The row-major factorized matrix.
+// \param product The product of the computed factors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the product of the factors of an incomplete factorization matches
+// the factorized matrix at all non-zero positions of the matrix. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the factorized matrix
+        , typename MT2 >  // Type of the product of the factors
+void ClassTest::checkFactorization( const MT1& A, const MT2& product ) const
+{
+   typedef blaze::ConstIterator_<MT1>  ConstIterator;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( !blaze::equal( product(i,element->index()), element->value() ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid incomplete factorization\n"
+                << " Details:\n"
+                << "   Position       : (" << i << "," << element->index() << ")\n"
+                << "   Product        : " << product(i,element->index()) << "\n"
+                << "   Matrix element : " << element->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a vector operation.
+//
+// \param result The computed vector.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result vector\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a scalar operation.
+//
+// \param result The computed value.
+// \param expected The expected value.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed value
+        , typename T2 >  // Type of the expected value
+void ClassTest::checkValue( const T1& result, const T2& expected ) const
+{
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result value\n"
+          << " Details:\n"
+          << "   Result         : " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the five-point stencil of the 2D Poisson equation.
+//
+// \param m The number of grid points in each dimension.
+// \return The symmetric positive definite \f$ m^2 \times m^2 \f$ system matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor> ClassTest::poisson( size_t m ) const
+{
+   const size_t n( m*m );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= m         ) A.append( i, i-m, Type( -1 ) );
+      if( i % m != 0UL   ) A.append( i, i-1, Type( -1 ) );
+      A.append( i, i, Type( 4 ) );
+      if( i % m != m-1UL ) A.append( i, i+1, Type( -1 ) );
+      if( i+m < n        ) A.append( i, i+m, Type( -1 ) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a nonsymmetric 2D convection-diffusion operator.
+//
+// \param m The number of grid points in each dimension.
+// \return The nonsymmetric \f$ m^2 \times m^2 \f$ system matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor> ClassTest::convection( size_t m ) const
+{
+   const size_t n( m*m );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= m         ) A.append( i, i-m, Type( -1.5 ) );
+      if( i % m != 0UL   ) A.append( i, i-1, Type( -1.25 ) );
+      A.append( i, i, Type( 4 ) );
+      if( i % m != m-1UL ) A.append( i, i+1, Type( -0.75 ) );
+      if( i+m < n        ) A.append( i, i+m, Type( -0.5 ) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the iterative solvers.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solver test.
+*/
+#define RUN_SOLVERS_CLASS_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
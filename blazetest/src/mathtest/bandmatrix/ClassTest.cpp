@@ -0,0 +1,803 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/bandmatrix/ClassTest.cpp
+//  \brief Source file for the BandMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/Views.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/bandmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BandMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAccess();
+   testIterator();
+   testResize();
+   testMult();
+   testLU();
+   testLLH();
+   testTridiagonal();
+   testView();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BandMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   typedef blaze::BandMatrix<int,blaze::rowMajor>     RBM;
+   typedef blaze::BandMatrix<int,blaze::columnMajor>  CBM;
+
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix default constructor";
+
+      blaze::BandMatrix<double> A;
+
+      checkSize      ( A, 0UL, 0UL );
+      checkBandwidths( A, 0UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructors
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix size constructor";
+
+      RBM A( 6UL, 5UL, 1UL, 2UL );
+
+      checkSize      ( A, 6UL, 5UL );
+      checkBandwidths( A, 1UL, 2UL );
+      checkMatrix    ( A, blaze::DynamicMatrix<int>( 6UL, 5UL, 0 ) );
+
+      if( A.capacity() < 4UL*6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << A.capacity() << "\n"
+             << "   Expected capacity: >= 24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix homogeneous initialization";
+
+      CBM A( 4UL, 4UL, 1UL, 0UL, 2 );
+
+      const blaze::DynamicMatrix<int> expected{ { 2, 0, 0, 0 },
+                                                { 2, 2, 0, 0 },
+                                                { 0, 2, 2, 0 },
+                                                { 0, 0, 2, 2 } };
+      checkMatrix( A, expected );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix copy constructor";
+
+      const RBM A( generate<RBM>( 11UL, 9UL, 2UL, 3UL ) );
+      const RBM B( A );
+
+      checkSize      ( B, 11UL, 9UL );
+      checkBandwidths( B, 2UL, 3UL );
+      checkMatrix    ( B, A );
+   }
+
+   {
+      test_ = "BandMatrix move constructor";
+
+      CBM A( generate<CBM>( 11UL, 9UL, 2UL, 3UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      CBM B( std::move( A ) );
+
+      checkSize  ( A, 0UL, 0UL );
+      checkSize  ( B, 11UL, 9UL );
+      checkMatrix( B, D );
+   }
+
+
+   //=====================================================================================
+   // Matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix constructor (dense matrix)";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> D{ { 1, 2, 0, 0 },
+                                                            { 0, 4, 5, 6 },
+                                                            { 7, 0, 8, 0 } };
+      const RBM A( D );
+
+      checkSize      ( A, 3UL, 4UL );
+      checkBandwidths( A, 2UL, 2UL );
+      checkMatrix    ( A, D );
+   }
+
+   {
+      test_ = "BandMatrix constructor (band matrix)";
+
+      const RBM A( generate<RBM>( 7UL, 10UL, 0UL, 4UL ) );
+      const CBM B( A );
+
+      checkSize      ( B, 7UL, 10UL );
+      checkBandwidths( B, 0UL, 4UL );
+      checkMatrix    ( B, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   typedef blaze::BandMatrix<int,blaze::rowMajor>     RBM;
+   typedef blaze::BandMatrix<int,blaze::columnMajor>  CBM;
+
+   //=====================================================================================
+   // Copy and move assignment
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix copy assignment";
+
+      const RBM A( generate<RBM>( 9UL, 9UL, 1UL, 1UL ) );
+      RBM B( 3UL, 4UL, 2UL, 0UL );
+      B = A;
+
+      checkSize      ( B, 9UL, 9UL );
+      checkBandwidths( B, 1UL, 1UL );
+      checkMatrix    ( B, A );
+   }
+
+   {
+      test_ = "BandMatrix move assignment";
+
+      CBM A( generate<CBM>( 9UL, 9UL, 1UL, 1UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      CBM B( 3UL, 4UL, 2UL, 0UL );
+      B = std::move( A );
+
+      checkSize  ( B, 9UL, 9UL );
+      checkMatrix( B, D );
+   }
+
+
+   //=====================================================================================
+   // Matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix matrix assignment";
+
+      const RBM A( generate<RBM>( 9UL, 9UL, 1UL, 2UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      CBM B;
+      B = trans( A ) + A;
+
+      checkSize      ( B, 9UL, 9UL );
+      checkBandwidths( B, 2UL, 2UL );
+      checkMatrix    ( B, trans( D ) + D );
+   }
+
+
+   //=====================================================================================
+   // Addition, subtraction and scaling
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix addition/subtraction assignment and scaling";
+
+      const RBM A( generate<RBM>( 9UL, 7UL, 1UL, 2UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      RBM B( A );
+      B += A;
+      B *= 3;
+      B -= A;
+      B /= 5;
+
+      checkBandwidths( B, 1UL, 2UL );
+      checkMatrix    ( B, D );
+   }
+
+   {
+      test_ = "BandMatrix addition assignment (wider band)";
+
+      const RBM A( generate<RBM>( 8UL, 8UL, 1UL, 1UL ) );
+      const CBM B( generate<CBM>( 8UL, 8UL, 3UL, 0UL ) );
+      const blaze::DynamicMatrix<int> DA( A ), DB( B );
+
+      RBM C( A );
+      C += B;
+      checkBandwidths( C, 3UL, 1UL );
+      checkMatrix    ( C, DA + DB );
+
+      C -= DB;
+      checkMatrix( C, DA );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// BandMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAccess()
+{
+   {
+      test_ = "BandMatrix::operator()";
+
+      blaze::BandMatrix<int,blaze::rowMajor> A( 3UL, 4UL, 1UL, 1UL );
+
+      A(0,0) = 1;
+      A(0,1) = 2;
+      A(2,1) = 3;
+      A(2,3) = 4;
+      A(1,2) += 5;
+      A(2,0) = 0;
+
+      const blaze::DynamicMatrix<int> expected{ { 1, 2, 0, 0 }, { 0, 0, 5, 0 }, { 0, 3, 0, 4 } };
+      checkMatrix( A, expected );
+
+      try {
+         A(0,2) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to element outside the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "BandMatrix::at()";
+
+      blaze::BandMatrix<int,blaze::columnMajor> A( 3UL, 3UL, 1UL, 1UL );
+
+      try {
+         A.at(3,1) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix iterators and of the row and column views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterators of the BandMatrix class template, which
+// traverse all elements of a row (row-major) or column (column-major), including the elements
+// outside the band. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::BandMatrix<int,blaze::rowMajor>     RBM;
+   typedef blaze::BandMatrix<int,blaze::columnMajor>  CBM;
+
+   {
+      test_ = "BandMatrix iterators";
+
+      const RBM A( generate<RBM>( 13UL, 11UL, 2UL, 1UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         if( A.end(i) - A.begin(i) != 11L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator distance detected\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Result: " << ( A.end(i) - A.begin(i) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         size_t j( 0UL );
+         for( RBM::ConstIterator it=A.cbegin(i); it!=A.cend(i); ++it, ++j ) {
+            if( *it != D(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid iterator value detected\n"
+                   << " Details:\n"
+                   << "   Element : (" << i << "," << j << ")\n"
+                   << "   Result  : " << *it << "\n"
+                   << "   Expected: " << D(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "BandMatrix row and column views";
+
+      const CBM A( generate<CBM>( 13UL, 13UL, 3UL, 2UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      checkVector( row   ( A, 4UL ), row   ( D, 4UL ) );
+      checkVector( column( A, 4UL ), column( D, 4UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix resize functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() functions of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   typedef blaze::BandMatrix<int,blaze::rowMajor>     RBM;
+   typedef blaze::BandMatrix<int,blaze::columnMajor>  CBM;
+
+   {
+      test_ = "BandMatrix::resize() (row-major)";
+
+      RBM A( generate<RBM>( 17UL, 15UL, 2UL, 1UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      A.resize( 20UL, 18UL, 3UL, 3UL );
+      checkSize      ( A, 20UL, 18UL );
+      checkBandwidths( A, 3UL, 3UL );
+      checkMatrix    ( submatrix( A, 0UL, 0UL, 17UL, 15UL ), D );
+      checkMatrix    ( submatrix( A, 17UL, 0UL, 3UL, 18UL ), blaze::DynamicMatrix<int>( 3UL, 18UL, 0 ) );
+      checkMatrix    ( submatrix( A, 0UL, 15UL, 20UL, 3UL ), blaze::DynamicMatrix<int>( 20UL, 3UL, 0 ) );
+
+      A.resize( 9UL, 9UL );
+      checkSize      ( A, 9UL, 9UL );
+      checkBandwidths( A, 3UL, 3UL );
+      checkMatrix    ( A, submatrix( D, 0UL, 0UL, 9UL, 9UL ) );
+
+      A.resize( 0UL, 0UL );
+      checkSize( A, 0UL, 0UL );
+   }
+
+   {
+      test_ = "BandMatrix::resize() (column-major, narrower band)";
+
+      CBM A( generate<CBM>( 12UL, 12UL, 2UL, 2UL ) );
+      blaze::DynamicMatrix<int> D( A );
+
+      A.resize( 12UL, 12UL, 1UL, 0UL );
+      checkBandwidths( A, 1UL, 0UL );
+
+      for( size_t i=0UL; i<12UL; ++i ) {
+         for( size_t j=0UL; j<12UL; ++j ) {
+            if( j > i || i > j+1UL ) D(i,j) = 0;
+         }
+      }
+      checkMatrix( A, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the banded matrix/vector and matrix/matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMult()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Banded matrix multiplication";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testMult< blaze::BandMatrix<double,rowMajor> >( n, n );
+      testMult< blaze::BandMatrix<double,columnMajor> >( n, n );
+      testMult< blaze::BandMatrix<double,rowMajor> >( n+5UL, n );
+      testMult< blaze::BandMatrix<double,columnMajor> >( n, n+5UL );
+      testMult< blaze::BandMatrix<float,rowMajor> >( n, n );
+      testMult< blaze::BandMatrix<float,columnMajor> >( n, n );
+      testMult< blaze::BandMatrix<int,rowMajor> >( n, n+2UL );
+      testMult< blaze::BandMatrix<cplx,rowMajor> >( n, n );
+      testMult< blaze::BandMatrix<cplx,columnMajor> >( n+2UL, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the banded LU decomposition and the general banded solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testLU()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Banded LU decomposition";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testLU< blaze::BandMatrix<double,rowMajor> >( n );
+      testLU< blaze::BandMatrix<double,columnMajor> >( n );
+      testLU< blaze::BandMatrix<cplx,rowMajor> >( n );
+      testLU< blaze::BandMatrix<cplx,columnMajor> >( n );
+   }
+
+   {
+      test_ = "Banded LU decomposition (singular matrix)";
+
+      blaze::BandMatrix<double> A( 3UL, 3UL, 1UL, 1UL, 1.0 );
+      A(1,0) = 0.0;
+      A(1,1) = 0.0;
+      A(2,1) = 0.0;
+
+      const blaze::DynamicVector<double> b( 3UL, 1.0 );
+      blaze::DynamicVector<double> x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the banded Cholesky decomposition and the according solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testLLH()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Banded Cholesky decomposition";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testLLH< blaze::BandMatrix<double,rowMajor> >( n );
+      testLLH< blaze::BandMatrix<double,columnMajor> >( n );
+   }
+
+   {
+      test_ = "Banded Cholesky decomposition (non-positive-definite matrix)";
+
+      blaze::BandMatrix<double> A( 3UL, 3UL, 1UL, 1UL, 2.0 );
+      A(1,1) = -1.0;
+
+      try {
+         pbtrf( A, 'L' );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of non-positive-definite matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "Banded Cholesky decomposition (invalid uplo argument)";
+
+      blaze::BandMatrix<double> A( 3UL, 3UL, 1UL, 1UL, 2.0 );
+
+      try {
+         pbtrf( A, 'X' );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition with invalid uplo argument succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched tridiagonal solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testTridiagonal()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Tridiagonal solver";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testTridiagonal< blaze::BandMatrix<double,rowMajor> >( n );
+      testTridiagonal< blaze::BandMatrix<double,columnMajor> >( n );
+      testTridiagonal< blaze::BandMatrix<cplx,rowMajor> >( n );
+   }
+
+   {
+      test_ = "Tridiagonal solver (non-tridiagonal matrix)";
+
+      const blaze::BandMatrix<double> A( 4UL, 4UL, 2UL, 1UL, 1.0 );
+      blaze::DynamicVector<double> x( 4UL, 1.0 );
+
+      try {
+         solveTridiagonal( A, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a non-tridiagonal system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band() view on dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the band() view, which restricts a general dense matrix to
+// a band of diagonals. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testView()
+{
+   {
+      test_ = "band() view (read access)";
+
+      const blaze::DynamicMatrix<int> A( blaze::rand< blaze::DynamicMatrix<int> >( 9UL, 7UL, 1, 9 ) );
+      const auto B = band( A, 1UL, 2UL );
+
+      checkSize      ( B, 9UL, 7UL );
+      checkBandwidths( B, 1UL, 2UL );
+
+      blaze::DynamicMatrix<int> expected( A );
+      for( size_t i=0UL; i<9UL; ++i ) {
+         for( size_t j=0UL; j<7UL; ++j ) {
+            if( j+1UL < i || j > i+2UL ) expected(i,j) = 0;
+         }
+      }
+      checkMatrix( B, expected );
+
+      const blaze::BandMatrix<int> C( B );
+      checkBandwidths( C, 1UL, 2UL );
+      checkMatrix    ( C, expected );
+   }
+
+   {
+      test_ = "band() view (multiplication)";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> A(
+         blaze::rand< blaze::DynamicMatrix<double,blaze::columnMajor> >( 11UL, 11UL, 0, 9 ) );
+      const blaze::DynamicMatrix<double> D( band( A, 2UL, 0UL ) );
+      const blaze::DynamicVector<double> x( blaze::rand< blaze::DynamicVector<double> >( 11UL, 0, 9 ) );
+
+      blaze::DynamicVector<double> y( 11UL, 1.0 );
+      gbmv( y, band( A, 2UL, 0UL ), x, 2.0, 1.0 );
+      checkVector( y, 2.0*D*x + blaze::DynamicVector<double>( 11UL, 1.0 ) );
+
+      checkMatrix( blaze::DynamicMatrix<double>( band( A, 2UL, 0UL ) * trans( A ) ), D * trans( A ) );
+   }
+
+   {
+      test_ = "band() view (assignment)";
+
+      blaze::DynamicMatrix<int> A( 5UL, 5UL, 1 );
+      auto B = band( A, 0UL, 1UL );
+
+      B *= 3;
+      B(2,2) = 7;
+
+      const blaze::DynamicMatrix<int> expected{ { 3, 3, 1, 1, 1 },
+                                                { 1, 3, 3, 1, 1 },
+                                                { 1, 1, 7, 3, 1 },
+                                                { 1, 1, 1, 3, 3 },
+                                                { 1, 1, 1, 1, 3 } };
+      checkMatrix( A, expected );
+
+      try {
+         B(3,1) = 2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to element outside the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         B = A;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-band matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkMatrix( A, expected );
+   }
+}
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BandMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BANDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BandMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,562 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/batchmatrix/ClassTest.cpp
+//  \brief Source file for the BatchMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/batchmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batchmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAccess();
+   testResize();
+   testMult();
+   testDet();
+   testLU();
+   testInvert();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BatchMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix default constructor";
+
+      blaze::BatchMatrix<double,3UL,3UL> batch;
+
+      checkSize( batch, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix size constructor (0)";
+
+      blaze::BatchMatrix<double,3UL,3UL> batch( 0UL );
+
+      checkSize( batch, 0UL );
+   }
+
+   {
+      test_ = "BatchMatrix size constructor (5)";
+
+      blaze::BatchMatrix<double,3UL,3UL> batch( 5UL );
+
+      checkSize   ( batch, 5UL );
+      checkPadding( batch );
+
+      if( batch.capacity() < 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << batch.capacity() << "\n"
+             << "   Expected capacity: >= 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix copy constructor";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch1( 3UL );
+      randomize( batch1 );
+
+      blaze::BatchMatrix<int,2UL,3UL> batch2( batch1 );
+
+      checkSize   ( batch2, 3UL );
+      checkPadding( batch2 );
+      checkMatrix ( batch2, 0UL, batch1.get(0UL) );
+      checkMatrix ( batch2, 1UL, batch1.get(1UL) );
+      checkMatrix ( batch2, 2UL, batch1.get(2UL) );
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix move constructor";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch1( 3UL );
+      randomize( batch1 );
+      const blaze::StaticMatrix<int,2UL,3UL> m( batch1.get(1UL) );
+
+      blaze::BatchMatrix<int,2UL,3UL> batch2( std::move( batch1 ) );
+
+      checkSize  ( batch1, 0UL );
+      checkSize  ( batch2, 3UL );
+      checkMatrix( batch2, 1UL, m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BatchMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix copy assignment";
+
+      blaze::BatchMatrix<double,2UL,2UL> batch1( 7UL );
+      randomize( batch1 );
+
+      blaze::BatchMatrix<double,2UL,2UL> batch2( 2UL );
+      batch2 = batch1;
+
+      checkSize   ( batch2, 7UL );
+      checkPadding( batch2 );
+
+      for( size_t k=0UL; k<7UL; ++k ) {
+         checkMatrix( batch2, k, batch1.get(k) );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix move assignment";
+
+      blaze::BatchMatrix<double,2UL,2UL> batch1( 7UL );
+      randomize( batch1 );
+      const blaze::StaticMatrix<double,2UL,2UL> m( batch1.get(6UL) );
+
+      blaze::BatchMatrix<double,2UL,2UL> batch2( 2UL );
+      batch2 = std::move( batch1 );
+
+      checkSize  ( batch2, 7UL );
+      checkMatrix( batch2, 6UL, m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and of the get(), set(), and
+// data() functions of the BatchMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccess()
+{
+   //=====================================================================================
+   // Function call operator and data()
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix::operator()";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch( 4UL );
+      batch.reset();
+
+      batch(2UL,1UL,0UL) = 5;
+      batch(3UL,0UL,2UL) = 7;
+
+      if( batch.data(1UL,0UL)[2UL] != 5 || batch.data(0UL,2UL)[3UL] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch.get(2UL) << "\n" << batch.get(3UL) << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 5 0 0 )\n\n( 0 0 7 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::StaticMatrix<int,2UL,3UL> m{ { 0, 0, 7 }, { 0, 0, 0 } };
+      checkMatrix( batch, 3UL, m );
+   }
+
+
+   //=====================================================================================
+   // set() and get()
+   //=====================================================================================
+
+   {
+      test_ = "BatchMatrix::set() and BatchMatrix::get()";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch( 3UL );
+      batch.reset();
+
+      const blaze::StaticMatrix<int,2UL,3UL> m{ { 1, 2, 3 }, { 4, 5, 6 } };
+      const blaze::DynamicMatrix<int,blaze::columnMajor> d( m );
+
+      batch.set( 0UL, m );
+      batch.set( 2UL, d );
+
+      checkMatrix( batch, 0UL, m );
+      checkMatrix( batch, 1UL, blaze::StaticMatrix<int,2UL,3UL>( 0 ) );
+      checkMatrix( batch, 2UL, m );
+
+      if( batch(2UL,1UL,2UL) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch(2UL,1UL,2UL) << "\n"
+             << "   Expected result:\n6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BatchMatrix::set() with invalid matrix size";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch( 3UL );
+
+      try {
+         batch.set( 0UL, blaze::DynamicMatrix<int>( 3UL, 2UL, 0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "BatchMatrix::get() with invalid index";
+
+      blaze::BatchMatrix<int,2UL,3UL> batch( 3UL );
+
+      try {
+         batch.get( 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access with invalid index succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix resize(), reserve(), and clear() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize(), reserve(), and clear() member functions of the
+// BatchMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "BatchMatrix::resize()";
+
+   blaze::BatchMatrix<double,3UL,3UL> batch;
+
+   batch.resize( 5UL );
+   randomize( batch );
+   checkSize   ( batch, 5UL );
+   checkPadding( batch );
+
+   const blaze::StaticMatrix<double,3UL,3UL> m( batch.get(4UL) );
+
+   batch.resize( 37UL );
+   checkSize  ( batch, 37UL );
+   checkMatrix( batch, 4UL, m );
+
+   batch.resize( 3UL );
+   checkSize   ( batch, 3UL );
+   checkPadding( batch );
+
+   test_ = "BatchMatrix::reserve()";
+
+   const blaze::StaticMatrix<double,3UL,3UL> n( batch.get(2UL) );
+
+   batch.reserve( 100UL );
+   checkSize   ( batch, 3UL );
+   checkPadding( batch );
+   checkMatrix ( batch, 2UL, n );
+
+   if( batch.capacity() < 100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity         : " << batch.capacity() << "\n"
+          << "   Expected capacity: >= 100\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "BatchMatrix::clear()";
+
+   clear( batch );
+   checkSize   ( batch, 0UL );
+   checkPadding( batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch matrix and matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMult()
+{
+   test_ = "Batch multiplication";
+
+   for( size_t n : { 0UL, 1UL, 9UL, 1000UL } )
+   {
+      testMult<int,3UL,3UL,3UL>( n );
+      testMult<float,2UL,2UL,2UL>( n );
+      testMult<double,3UL,3UL,3UL>( n );
+      testMult<double,6UL,6UL,6UL>( n );
+      testMult<double,3UL,3UL,1UL>( n );
+      testMult<double,6UL,6UL,1UL>( n );
+      testMult<double,2UL,4UL,3UL>( n );
+      testMult<blaze::complex<double>,3UL,3UL,3UL>( n );
+   }
+
+   test_ = "Batch multiplication with aliasing";
+
+   {
+      blaze::BatchMatrix<double,3UL,3UL> A( 9UL ), B( 9UL );
+      randomize( A );
+      randomize( B );
+
+      const blaze::BatchMatrix<double,3UL,3UL> C( A );
+      mult( A, A, B );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         const blaze::StaticMatrix<double,3UL,3UL> expected( C.get(k) * B.get(k) );
+         checkMatrix( A, k, expected );
+      }
+   }
+
+   test_ = "Batch multiplication with invalid batch sizes";
+
+   {
+      blaze::BatchMatrix<double,3UL,3UL> A( 9UL ), B( 8UL ), C;
+
+      try {
+         mult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch determinant computation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testDet()
+{
+   test_ = "Batch determinant";
+
+   for( size_t n : { 0UL, 1UL, 9UL, 1000UL } )
+   {
+      testDet<float,3UL>( n );
+      testDet<double,1UL>( n );
+      testDet<double,2UL>( n );
+      testDet<double,3UL>( n );
+      testDet<double,4UL>( n );
+      testDet<double,6UL>( n );
+      testDet<blaze::complex<double>,3UL>( n );
+      testDet<blaze::complex<double>,6UL>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testLU()
+{
+   test_ = "Batch LU decomposition";
+
+   for( size_t n : { 0UL, 1UL, 9UL, 1000UL } )
+   {
+      testLU<float,3UL>( n );
+      testLU<double,1UL>( n );
+      testLU<double,3UL>( n );
+      testLU<double,6UL>( n );
+      testLU<blaze::complex<double>,4UL>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batch inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testInvert()
+{
+   test_ = "Batch inversion";
+
+   for( size_t n : { 0UL, 1UL, 9UL, 1000UL } )
+   {
+      testInvert<float,3UL>( n );
+      testInvert<double,1UL>( n );
+      testInvert<double,2UL>( n );
+      testInvert<double,3UL>( n );
+      testInvert<double,4UL>( n );
+      testInvert<double,6UL>( n );
+      testInvert<blaze::complex<double>,2UL>( n );
+      testInvert<blaze::complex<double>,6UL>( n );
+   }
+}
+//*************************************************************************************************
+
+} // namespace batchmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BatchMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BATCHMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BatchMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
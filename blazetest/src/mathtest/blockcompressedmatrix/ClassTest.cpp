@@ -0,0 +1,448 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/Views.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAccess();
+   testIterator();
+   testLookup();
+   testMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      blaze::BlockCompressedMatrix<double,4UL,2UL> S;
+
+      checkRows   ( S, 0UL );
+      checkColumns( S, 0UL );
+      checkMatrix ( S, blaze::CompressedMatrix<double>() );
+   }
+
+
+   //=====================================================================================
+   // Matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix constructor (row-major compressed matrix)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 37UL, 23UL ) );
+      const blaze::BlockCompressedMatrix<int,3UL,3UL> S( A );
+
+      checkRows   ( S, 37UL );
+      checkColumns( S, 23UL );
+      checkMatrix ( S, A );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix constructor (column-major dense matrix)";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> D{ { 1, 0, 2, 0 }
+                                                             , { 0, 0, 0, 0 }
+                                                             , { 3, 4, 5, 6 } };
+      const blaze::BlockCompressedMatrix<double,2UL,2UL> S( D );
+
+      checkRows   ( S, 3UL );
+      checkColumns( S, 4UL );
+      checkMatrix ( S, D );
+
+      if( S.blocks() != 4UL || S.nonZeros() != 12UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of blocks\n"
+             << " Details:\n"
+             << "   Number of blocks            : " << S.blocks() << "\n"
+             << "   Expected number of blocks   : 4\n"
+             << "   Number of non-zeros         : " << S.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 12\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix constructor (partial blocks)";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( generate<float>( 50UL, 31UL ) );
+      const blaze::BlockCompressedMatrix<float,16UL,4UL> S( A );
+
+      checkRows   ( S, 50UL );
+      checkColumns( S, 31UL );
+      checkMatrix ( S, A );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 19UL, 13UL ) );
+      const blaze::BlockCompressedMatrix<double,4UL,2UL> S( A );
+      const blaze::BlockCompressedMatrix<double,4UL,2UL> T( S );
+
+      checkRows   ( T, 19UL );
+      checkColumns( T, 13UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix move constructor";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 19UL, 13UL ) );
+      blaze::BlockCompressedMatrix<double,4UL,2UL> S( A );
+      const blaze::BlockCompressedMatrix<double,4UL,2UL> T( std::move( S ) );
+
+      checkRows   ( S, 0UL );
+      checkRows   ( T, 19UL );
+      checkColumns( T, 13UL );
+      checkMatrix ( T, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 21UL, 9UL ) );
+      const blaze::BlockCompressedMatrix<int,3UL,2UL> S( A );
+      blaze::BlockCompressedMatrix<int,3UL,2UL> T( generate<int>( 3UL, 4UL ) );
+
+      T = S;
+
+      checkRows   ( T, 21UL );
+      checkColumns( T, 9UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix move assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 21UL, 9UL ) );
+      blaze::BlockCompressedMatrix<int,3UL,2UL> S( A );
+      blaze::BlockCompressedMatrix<int,3UL,2UL> T;
+
+      T = std::move( S );
+
+      checkRows   ( T, 21UL );
+      checkColumns( T, 9UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix matrix assignment";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 0 } };
+      blaze::BlockCompressedMatrix<int,3UL,2UL> T( generate<int>( 7UL, 7UL ) );
+
+      T = D;
+
+      checkRows   ( T, 3UL );
+      checkColumns( T, 2UL );
+      checkMatrix ( T, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAccess()
+{
+   {
+      test_ = "BlockCompressedMatrix::operator()";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 29UL, 17UL ) );
+      const blaze::BlockCompressedMatrix<double,4UL,2UL> S( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( S(i,j) != A(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << "): " << S(i,j) << "\n"
+                   << "   Expected value: " << A(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix::at()";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 } };
+      const blaze::BlockCompressedMatrix<int,3UL,2UL> S( D );
+
+      if( S.at(0,1) != 1 || S.at(1,0) != 2 || S.at(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element detected\n"
+             << " Details:\n"
+             << "   Result:\n" << S << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         S.at(2,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "BlockCompressedMatrix iterators";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 16UL, 33UL, 100UL } ) {
+      testIterator<double,1UL,1UL>( m, 23UL );
+      testIterator<double,4UL,2UL>( m, 23UL );
+      testIterator<double,8UL,3UL>( m, 23UL );
+      testIterator<float,16UL,1UL>( m, 23UL );
+      testIterator<int,3UL,3UL>( m, 23UL );
+      testIterator<cplx,2UL,4UL>( m, 23UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() functions of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   typedef blaze::BlockCompressedMatrix<double,4UL,2UL>  BMT;
+   typedef BMT::ConstIterator  ConstIterator;
+
+   test_ = "BlockCompressedMatrix lookup functions";
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 41UL, 19UL ) );
+   const BMT S( A );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const ConstIterator pos( S.find( i, j ) );
+         const ConstIterator lb ( S.lowerBound( i, j ) );
+         const ConstIterator ub ( S.upperBound( i, j ) );
+
+         size_t less( 0UL ), lessEqual( 0UL );
+         for( ConstIterator it=S.begin(i); it!=S.end(i); ++it ) {
+            if( it->index() <  j ) ++less;
+            if( it->index() <= j ) ++lessEqual;
+         }
+
+         if( ( A.find( i, j ) != A.end(i) && pos == S.end(i) ) ||
+             ( pos != S.end(i) && ( pos->index() != j || pos->value() != A(i,j) ) ) ||
+             ( size_t( lb - S.begin(i) ) != less      ) ||
+             ( size_t( ub - S.begin(i) ) != lessEqual ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lookup result\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Column: " << j << "\n"
+                << "   Matrix:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMult()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "BlockCompressedMatrix multiplication";
+
+   for( size_t m : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL, 130UL } ) {
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         testMult<double,1UL,1UL>( m, n );
+         testMult<double,4UL,2UL>( m, n );
+         testMult<double,8UL,3UL>( m, n );
+         testMult<float,16UL,1UL>( m, n );
+         testMult<float,3UL,2UL>( m, n );
+         testMult<int,3UL,3UL>( m, n );
+         testMult<cplx,2UL,4UL>( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,714 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/chunkedmatrix/ClassTest.cpp
+//  \brief Source file for the ChunkedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/Views.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/chunkedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace chunkedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ChunkedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testInsert();
+   testErase();
+   testLookup();
+   testResize();
+   testCompress();
+   testOperations();
+   testUpdates();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the ChunkedMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "ChunkedMatrix default constructor";
+
+      blaze::ChunkedMatrix<double> A;
+
+      checkRows    ( A, 0UL );
+      checkColumns ( A, 0UL );
+      checkNonZeros( A, 0UL );
+   }
+
+   {
+      test_ = "ChunkedMatrix size constructor";
+
+      blaze::ChunkedMatrix<int,blaze::columnMajor> A( 5UL, 7UL );
+
+      checkRows    ( A, 5UL );
+      checkColumns ( A, 7UL );
+      checkNonZeros( A, 0UL );
+   }
+
+   {
+      test_ = "ChunkedMatrix constructor (row-major compressed matrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> C( 3UL, 200UL );
+      for( size_t j=0UL; j<200UL; j+=2UL ) {
+         C(1UL,j) = int( j+1UL );
+      }
+
+      const blaze::ChunkedMatrix<int,blaze::rowMajor> A( C );
+
+      checkRows    ( A, 3UL );
+      checkColumns ( A, 200UL );
+      checkNonZeros( A, 100UL );
+      checkMatrix  ( A, C );
+      checkOrder   ( A );
+   }
+
+   {
+      test_ = "ChunkedMatrix constructor (row-major dense matrix)";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 1, 0, 2, 0 }
+                                                       , { 0, 0, 0, 0 }
+                                                       , { 3, 4, 5, 6 } };
+      const blaze::ChunkedMatrix<int,blaze::columnMajor> A( D );
+
+      checkRows    ( A, 3UL );
+      checkColumns ( A, 4UL );
+      checkNonZeros( A, 6UL );
+      checkMatrix  ( A, D );
+      checkOrder   ( A );
+   }
+
+   {
+      test_ = "ChunkedMatrix copy constructor";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+      const blaze::ChunkedMatrix<int,blaze::rowMajor> A( D );
+      const blaze::ChunkedMatrix<int,blaze::rowMajor> B( A );
+
+      checkRows    ( B, 3UL );
+      checkColumns ( B, 2UL );
+      checkNonZeros( B, 3UL );
+      checkMatrix  ( B, D );
+   }
+
+   {
+      test_ = "ChunkedMatrix move constructor";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+      blaze::ChunkedMatrix<int,blaze::rowMajor> A( D );
+      const blaze::ChunkedMatrix<int,blaze::rowMajor> B( std::move( A ) );
+
+      checkRows    ( B, 3UL );
+      checkColumns ( B, 2UL );
+      checkNonZeros( B, 3UL );
+      checkMatrix  ( B, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the ChunkedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "ChunkedMatrix copy assignment";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+      const blaze::ChunkedMatrix<int,blaze::rowMajor> A( D );
+      blaze::ChunkedMatrix<int,blaze::rowMajor> B( 7UL, 7UL );
+      B(2UL,5UL) = 4;
+
+      B = A;
+
+      checkRows    ( B, 3UL );
+      checkColumns ( B, 2UL );
+      checkNonZeros( B, 3UL );
+      checkMatrix  ( B, D );
+   }
+
+   {
+      test_ = "ChunkedMatrix matrix assignment";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+      blaze::ChunkedMatrix<int,blaze::rowMajor> B( 7UL, 7UL );
+      B(2UL,5UL) = 4;
+
+      B = D;
+
+      checkRows    ( B, 3UL );
+      checkColumns ( B, 2UL );
+      checkNonZeros( B, 3UL );
+      checkMatrix  ( B, D );
+   }
+
+   {
+      test_ = "ChunkedMatrix self-assignment via expression";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+      blaze::ChunkedMatrix<int,blaze::rowMajor> B( D );
+
+      B = 2 * B;
+
+      checkMatrix( B, 2 * D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix insertion functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the set() and insert() functions and of the function call
+// operator of the ChunkedMatrix class template. The rows are filled in ascending, descending
+// and alternating order, which requires the chunks to be split. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "ChunkedMatrix::set()";
+
+      const size_t n( 500UL );
+
+      blaze::ChunkedMatrix<int,blaze::rowMajor> A( 3UL, n );
+      blaze::DynamicMatrix<int,blaze::rowMajor> D( 3UL, n, 0 );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         A.set( 0UL, j, int( j+1UL ) );
+         D(0UL,j) = int( j+1UL );
+         A.set( 1UL, n-j-1UL, int( j+1UL ) );
+         D(1UL,n-j-1UL) = int( j+1UL );
+         A.set( 2UL, ( j%2UL )?( n-j ):( j ), int( j+1UL ) );
+         D(2UL,( j%2UL )?( n-j ):( j )) = int( j+1UL );
+      }
+
+      checkNonZeros( A, 3UL*n );
+      checkMatrix  ( A, D );
+      checkOrder   ( A );
+
+      const auto pos( A.set( 2UL, 4UL, -1 ) );
+      D(2UL,4UL) = -1;
+
+      if( pos->index() != 4UL || pos->value() != -1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Index: " << pos->index() << "\n"
+             << "   Value: " << pos->value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNonZeros( A, 3UL*n );
+      checkMatrix  ( A, D );
+   }
+
+   {
+      test_ = "ChunkedMatrix::insert()";
+
+      blaze::ChunkedMatrix<int,blaze::columnMajor> A( 300UL, 2UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> D( 300UL, 2UL, 0 );
+
+      for( size_t i=0UL; i<300UL; i+=3UL ) {
+         const auto pos( A.insert( 299UL-i, 1UL, int( i+1UL ) ) );
+         D(299UL-i,1UL) = int( i+1UL );
+
+         if( pos->index() != 299UL-i || pos->value() != int( i+1UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator returned\n"
+                << " Details:\n"
+                << "   Index         : " << pos->index() << "\n"
+                << "   Expected index: " << 299UL-i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkNonZeros( A, 100UL );
+      checkMatrix  ( A, D );
+      checkOrder   ( A );
+
+      try {
+         A.insert( 299UL, 1UL, 2 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting a duplicate element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ChunkedMatrix function call operator";
+
+      blaze::ChunkedMatrix<int,blaze::rowMajor> A( 2UL, 3UL );
+
+      A(0UL,2UL) = 4;
+      A(0UL,2UL) += 1;
+      A(1UL,0UL) -= 2;
+      A(1UL,1UL) = 0;
+
+      checkNonZeros( A, 2UL );
+      checkMatrix  ( A, blaze::DynamicMatrix<int>{ { 0, 0, 5 }, { -2, 0, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix erase functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the erase() functions of the ChunkedMatrix class template.
+// The erasure of elements in many different chunks requires the chunks to be merged and
+// removed. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "ChunkedMatrix::erase( size_t, size_t )";
+
+      const size_t n( 1000UL );
+
+      blaze::ChunkedMatrix<int,blaze::rowMajor> A( 2UL, n );
+      blaze::DynamicMatrix<int,blaze::rowMajor> D( 2UL, n, 0 );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         A.set( 1UL, j, int( j+1UL ) );
+         D(1UL,j) = int( j+1UL );
+      }
+
+      for( size_t j=0UL; j<n; ++j ) {
+         if( j % 3UL != 0UL ) {
+            A.erase( 1UL, j );
+            D(1UL,j) = 0;
+         }
+      }
+
+      A.erase( 0UL, 5UL );
+      A.erase( 1UL, 1UL );
+
+      checkNonZeros( A, ( n+2UL ) / 3UL );
+      checkMatrix  ( A, D );
+      checkOrder   ( A );
+
+      for( size_t j=0UL; j<n; j+=3UL ) {
+         A.erase( 1UL, j );
+      }
+
+      checkNonZeros( A, 0UL );
+   }
+
+   {
+      test_ = "ChunkedMatrix::erase( size_t, Iterator )";
+
+      const size_t m( 700UL );
+
+      blaze::ChunkedMatrix<int,blaze::columnMajor> A( m, 1UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> D( m, 1UL, 0 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         A.set( i, 0UL, int( i ) );
+         D(i,0UL) = int( i );
+      }
+
+      size_t count( 0UL );
+      for( auto element=A.begin(0UL); element!=A.end(0UL); ++count ) {
+         if( element->value() % 2 == 0 ) {
+            D(element->index(),0UL) = 0;
+            element = A.erase( 0UL, element );
+         }
+         else ++element;
+      }
+
+      if( count != m ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of visited elements\n"
+             << " Details:\n"
+             << "   Number of visited elements         : " << count << "\n"
+             << "   Expected number of visited elements: " << m << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNonZeros( A, m/2UL );
+      checkMatrix  ( A, D );
+      checkOrder   ( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() functions of the
+// ChunkedMatrix class template, in particular at the boundaries between two chunks. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "ChunkedMatrix lookup functions";
+
+   const size_t n( 1000UL );
+
+   blaze::ChunkedMatrix<int,blaze::rowMajor> A( 1UL, n );
+
+   for( size_t j=0UL; j<n; j+=5UL ) {
+      A.set( 0UL, j, int( j+1UL ) );
+   }
+
+   const blaze::ChunkedMatrix<int,blaze::rowMajor>& B( A );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t lower( ( j+4UL ) / 5UL * 5UL );
+      const size_t upper( j / 5UL * 5UL + 5UL );
+
+      const auto pos( B.find( 0UL, j ) );
+      const auto lb ( B.lowerBound( 0UL, j ) );
+      const auto ub ( A.upperBound( 0UL, j ) );
+
+      if( ( j % 5UL == 0UL ) != ( pos != B.end(0UL) ) ||
+          ( pos != B.end(0UL) && pos->index() != j ) ||
+          ( lower <  n && ( lb == B.end(0UL) || lb->index() != lower ) ) ||
+          ( lower >= n && lb != B.end(0UL) ) ||
+          ( upper <  n && ( ub == A.end(0UL) || ub->index() != upper ) ) ||
+          ( upper >= n && ub != A.end(0UL) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lookup result\n"
+             << " Details:\n"
+             << "   Searched index     : " << j << "\n"
+             << "   Expected lower bound: " << lower << "\n"
+             << "   Expected upper bound: " << upper << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( B(0UL,10UL) != 11 || B(0UL,11UL) != 0 || B.at(0UL,995UL) != 996 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid element access\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      B.at( 1UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix resize() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() function of the ChunkedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "ChunkedMatrix::resize() (row-major)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> D( 20UL, 300UL, 0 );
+      for( size_t i=0UL; i<20UL; ++i ) {
+         for( size_t j=i; j<300UL; j+=i+1UL ) {
+            D(i,j) = int( i+j+1UL );
+         }
+      }
+
+      blaze::ChunkedMatrix<int,blaze::rowMajor> A( D );
+
+      A.resize( 25UL, 150UL );
+      D.resize( 25UL, 150UL );
+      submatrix( D, 20UL, 0UL, 5UL, 150UL ) = 0;
+      checkMatrix( A, D );
+      checkOrder ( A );
+
+      A.resize( 10UL, 63UL );
+      D.resize( 10UL, 63UL );
+      checkMatrix( A, D );
+      checkOrder ( A );
+
+      A.resize( 10UL, 100UL, false );
+      checkRows    ( A, 10UL );
+      checkColumns ( A, 100UL );
+      checkNonZeros( A, 0UL );
+   }
+
+   {
+      test_ = "ChunkedMatrix::resize() (column-major)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> D( 300UL, 20UL, 0 );
+      for( size_t j=0UL; j<20UL; ++j ) {
+         for( size_t i=j; i<300UL; i+=j+1UL ) {
+            D(i,j) = int( i+j+1UL );
+         }
+      }
+
+      blaze::ChunkedMatrix<int,blaze::columnMajor> A( D );
+
+      A.resize( 64UL, 10UL );
+      D.resize( 64UL, 10UL );
+      checkMatrix( A, D );
+      checkOrder ( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a ChunkedMatrix into a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the compress() function of the ChunkedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompress()
+{
+   {
+      test_ = "ChunkedMatrix::compress() (row-major)";
+
+      blaze::ChunkedMatrix<double,blaze::rowMajor> A( 50UL, 400UL );
+      for( size_t i=0UL; i<50UL; ++i ) {
+         for( size_t j=( i*7UL ) % 11UL; j<400UL; j+=i+1UL ) {
+            A.set( i, j, double( i+j ) );
+         }
+      }
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> C( 3UL, 3UL );
+      C(1UL,1UL) = 1.0;
+
+      A.compress( C );
+
+      checkRows    ( C, 50UL );
+      checkColumns ( C, 400UL );
+      checkNonZeros( C, A.nonZeros() );
+      checkMatrix  ( C, A );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> C2( A );
+      checkMatrix( C2, C );
+   }
+
+   {
+      test_ = "ChunkedMatrix::compress() (column-major)";
+
+      blaze::ChunkedMatrix<double,blaze::columnMajor> A( 400UL, 50UL );
+      for( size_t j=0UL; j<50UL; ++j ) {
+         for( size_t i=( j*7UL ) % 11UL; i<400UL; i+=j+1UL ) {
+            A.set( i, j, double( i+j ) );
+         }
+      }
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> C;
+
+      A.compress( C );
+
+      checkRows    ( C, 400UL );
+      checkColumns ( C, 50UL );
+      checkNonZeros( C, A.nonZeros() );
+      checkMatrix  ( C, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedMatrix within expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ChunkedMatrix class template as operand of several expressions and
+// compares the results with the results of the according compressed matrix expressions. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOperations()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "ChunkedMatrix operations";
+
+   blaze::ChunkedMatrix<cplx,blaze::rowMajor> A( 60UL, 90UL );
+   blaze::ChunkedMatrix<cplx,blaze::columnMajor> B( 60UL, 90UL );
+
+   for( size_t k=0UL; k<2000UL; ++k ) {
+      A.set( blaze::rand<size_t>( 0UL, 59UL ), blaze::rand<size_t>( 0UL, 89UL ), cplx( blaze::rand<int>( -5, 5 ), 1 ) );
+      B.set( blaze::rand<size_t>( 0UL, 59UL ), blaze::rand<size_t>( 0UL, 89UL ), cplx( blaze::rand<int>( -5, 5 ), 0 ) );
+   }
+
+   const blaze::CompressedMatrix<cplx,blaze::rowMajor> CA( A );
+   const blaze::CompressedMatrix<cplx,blaze::columnMajor> CB( B );
+
+   const blaze::DynamicVector<cplx> x( blaze::rand< blaze::DynamicVector<cplx> >( 90UL, -3, 3 ) );
+
+   checkVector( blaze::DynamicVector<cplx>( A * x ), CA * x );
+   checkVector( blaze::DynamicVector<cplx>( B * x ), CB * x );
+   checkVector( blaze::DynamicVector<cplx,blaze::rowVector>( trans( x ) * trans( A ) ), trans( x ) * trans( CA ) );
+
+   checkMatrix( blaze::CompressedMatrix<cplx>( A + B ), CA + CB );
+   checkMatrix( blaze::CompressedMatrix<cplx>( A - B ), CA - CB );
+   checkMatrix( blaze::DynamicMatrix<cplx>( A * trans( B ) ), CA * trans( CB ) );
+   checkMatrix( blaze::CompressedMatrix<cplx>( trans( A ) * B ), trans( CA ) * CB );
+   checkMatrix( blaze::CompressedMatrix<cplx>( conj( A ) ), conj( CA ) );
+
+   checkMatrix( submatrix( A, 5UL, 10UL, 20UL, 30UL ), submatrix( CA, 5UL, 10UL, 20UL, 30UL ) );
+   checkVector( row( A, 7UL ), row( CA, 7UL ) );
+   checkVector( column( B, 8UL ), column( CB, 8UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of random structural modifications of the ChunkedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies random sequences of insertions, modifications and erasures to matrices
+// of various sizes and compares the results with a dense reference matrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpdates()
+{
+   test_ = "ChunkedMatrix random updates";
+
+   testUpdates<int,blaze::rowMajor>( 1UL, 1UL, 10UL );
+   testUpdates<int,blaze::rowMajor>( 3UL, 500UL, 5000UL );
+   testUpdates<int,blaze::columnMajor>( 500UL, 3UL, 5000UL );
+   testUpdates<double,blaze::rowMajor>( 100UL, 200UL, 50000UL );
+   testUpdates<double,blaze::columnMajor>( 200UL, 100UL, 50000UL );
+}
+//*************************************************************************************************
+
+} // namespace chunkedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ChunkedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CHUNKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ChunkedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,378 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/compressedmatrix/BuilderTest.cpp
+//  \brief Source file for the CompressedMatrix triplet builder test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/compressedmatrix/BuilderTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TripletBuilder test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BuilderTest::BuilderTest()
+{
+   testInsert();
+   testBuffers();
+   testCombine();
+   testClear();
+   testLarge();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the assembly from triplets inserted into the default buffer.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of a compressed matrix from unordered triplets,
+// including duplicates, which are inserted into the default buffer of the builder. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testInsert()
+{
+   test_ = "TripletBuilder::insert()";
+
+   TB builder( 4UL, 5UL );
+   builder.reserve( 7UL );
+
+   builder.insert( 2UL, 3UL,  1 );
+   builder.insert( 0UL, 4UL,  2 );
+   builder.insert( 2UL, 0UL,  3 );
+   builder.insert( 0UL, 1UL,  4 );
+   builder.insert( 2UL, 3UL,  5 );
+   builder.insert( 3UL, 2UL,  6 );
+   builder.insert( 0UL, 4UL, -2 );
+
+   if( builder.rows() != 4UL || builder.columns() != 5UL || builder.size() != 7UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid builder state\n"
+          << " Details:\n"
+          << "   Rows: " << builder.rows() << " (expected 4)\n"
+          << "   Columns: " << builder.columns() << " (expected 5)\n"
+          << "   Triplets: " << builder.size() << " (expected 7)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   DM expected( 4UL, 5UL, 0 );
+   expected(0,1) = 4;
+   expected(2,0) = 3;
+   expected(2,3) = 6;
+   expected(3,2) = 6;
+
+   // The explicitly assembled zero element (0,4) is stored
+   SM A( 2UL, 2UL, 1UL );
+   builder.build( A );
+   checkMatrix( A, expected, 5UL );
+
+   OSM B;
+   builder.build( B );
+   checkMatrix( B, expected, 5UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assembly from triplets inserted into several buffers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of a compressed matrix from triplets that are
+// distributed among the default buffer and several thread-local buffers, including empty ones.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testBuffers()
+{
+   test_ = "TripletBuilder::buffer()";
+
+   TB builder( 6UL, 6UL );
+
+   TB::Buffer& buffer1( builder.buffer() );
+   TB::Buffer& buffer2( builder.buffer() );
+   TB::Buffer& buffer3( builder.buffer() );
+
+   DM expected( 6UL, 6UL, 0 );
+
+   for( size_t i=0UL; i<6UL; ++i ) {
+      buffer1.insert( i, 5UL-i, 1 );
+      buffer3.insert( i, i, 2 );
+      builder.insert( i, 5UL-i, 3 );
+      expected(i,5UL-i) += 4;
+      expected(i,i) += 2;
+   }
+
+   buffer3.insert( 5UL, 0UL, 10 );
+   expected(5,0) += 10;
+
+   if( buffer1.size() != 6UL || buffer2.size() != 0UL || buffer3.size() != 7UL || builder.size() != 19UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of triplets\n"
+          << " Details:\n"
+          << "   Buffer sizes: " << buffer1.size() << " " << buffer2.size() << " " << buffer3.size() << "\n"
+          << "   Total: " << builder.size() << " (expected 19)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   SM A;
+   builder.build( A );
+   checkMatrix( A, expected, 12UL );
+
+   OSM B;
+   builder.build( B );
+   checkMatrix( B, expected, 12UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the combination of duplicates by a user-defined operation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the combination of multiple triplets for the same element
+// by means of a user-defined operation. Additionally, it tests that the triplets are combined in
+// the order of their insertion. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void BuilderTest::testCombine()
+{
+   test_ = "TripletBuilder::build() with user-defined operation";
+
+   TB builder( 3UL, 3UL );
+   TB::Buffer& buffer( builder.buffer() );
+
+   builder.insert( 1UL, 1UL, 4 );
+   builder.insert( 0UL, 2UL, 1 );
+   buffer.insert ( 1UL, 1UL, 2 );
+   buffer.insert ( 0UL, 2UL, 7 );
+   builder.insert( 1UL, 1UL, 9 );
+   buffer.insert ( 2UL, 0UL, 5 );
+
+   {
+      DM expected( 3UL, 3UL, 0 );
+      expected(0,2) = 7;
+      expected(1,1) = 9;
+      expected(2,0) = 5;
+
+      SM A;
+      builder.build( A, blaze::Maximum() );
+      checkMatrix( A, expected, 3UL );
+
+      OSM B;
+      builder.build( B, blaze::Maximum() );
+      checkMatrix( B, expected, 3UL );
+   }
+
+   {
+      // The default buffer precedes all other buffers
+      DM expected( 3UL, 3UL, 0 );
+      expected(0,2) = 7;
+      expected(1,1) = 2;
+      expected(2,0) = 5;
+
+      const auto last = []( int, int b ) { return b; };
+
+      SM A;
+      builder.build( A, last );
+      checkMatrix( A, expected, 3UL );
+
+      OSM B;
+      builder.build( B, last );
+      checkMatrix( B, expected, 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() member function of the TripletBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function and the reuse of the buffers
+// for a subsequent assembly. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void BuilderTest::testClear()
+{
+   test_ = "TripletBuilder::clear()";
+
+   TB builder( 3UL, 4UL );
+   TB::Buffer& buffer( builder.buffer() );
+
+   builder.insert( 0UL, 0UL, 1 );
+   buffer.insert( 2UL, 3UL, 2 );
+
+   builder.clear();
+
+   if( builder.size() != 0UL || buffer.size() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the builder failed\n"
+          << " Details:\n"
+          << "   Triplets: " << builder.size() << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   buffer.insert( 1UL, 2UL, 3 );
+
+   DM expected( 3UL, 4UL, 0 );
+   expected(1,2) = 3;
+
+   SM A( 3UL, 4UL );
+   A(0,0) = 5;
+
+   builder.build( A );
+   checkMatrix( A, expected, 1UL );
+
+   builder.clear();
+
+   OSM B( 2UL, 2UL );
+   builder.build( B );
+   checkMatrix( B, DM( 3UL, 4UL, 0 ), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assembly of a large matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of a large matrix from randomly distributed
+// triplets, which exercises the parallel assembly in case of an SMP build. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testLarge()
+{
+   test_ = "TripletBuilder::build() with a large number of triplets";
+
+   const size_t m( 700UL );
+   const size_t n( 500UL );
+
+   TB builder( m, n );
+   TB::Buffer* buffers[3] = { &builder.buffer(), &builder.buffer(), &builder.buffer() };
+
+   DM expected( m, n, 0 );
+   DM stored( m, n, 0 );
+
+   for( size_t k=0UL; k<300000UL; ++k ) {
+      const size_t i( blaze::rand<size_t>( 0UL, m-1UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, ( k % 5UL == 0UL ? n-1UL : 20UL ) ) );
+      const int value( blaze::rand<int>( -5, 5 ) );
+      buffers[k%3UL]->insert( i, j, value );
+      expected(i,j) += value;
+      stored(i,j) = 1;
+   }
+
+   const size_t nonzeros( blaze::nonZeros( stored ) );
+
+   SM A;
+   builder.build( A );
+   checkMatrix( A, expected, nonzeros );
+
+   OSM B;
+   builder.build( B );
+   checkMatrix( B, expected, nonzeros );
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix triplet builder test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_BUILDER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix triplet builder test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
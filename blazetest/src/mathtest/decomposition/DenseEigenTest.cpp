@@ -0,0 +1,217 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/decomposition/DenseEigenTest.cpp
+//  \brief Source file for the dense matrix eigenvalue test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/decomposition/DenseEigenTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseEigenTest test.
+//
+// \exception std::runtime_error Error during an eigenvalue computation detected.
+*/
+DenseEigenTest::DenseEigenTest()
+{
+   testFull< blaze::DynamicMatrix<double,blaze::rowMajor   > >(  1UL );
+   testFull< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 40UL );
+   testFull< blaze::DynamicMatrix<double,blaze::columnMajor> >( 40UL );
+   testFull< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 40UL );
+   testFull< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 40UL );
+
+   testPartial< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 30UL );
+   testPartial< blaze::DynamicMatrix<double,blaze::columnMajor> >( 30UL );
+   testPartial< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 30UL );
+   testPartial< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 30UL );
+
+   testAdaptors();
+   testWorkspace();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue computation for symmetric and Hermitian adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the eigenvalue computation for SymmetricMatrix and HermitianMatrix
+// adaptors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseEigenTest::testAdaptors()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Eigenvalue computation for adaptors";
+
+   {
+      typedef blaze::DynamicMatrix<double,blaze::columnMajor>  CMT;
+
+      const CMT S( symmetric<CMT>( 25UL ) );
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > A( S );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      CMT V;
+
+      blaze::eigen( A, w, V );
+      checkEigenpairs( S, w, V, "Eigenvalue decomposition of SymmetricMatrix failed" );
+   }
+
+   {
+      typedef blaze::DynamicMatrix<cdouble,blaze::columnMajor>  CMT;
+
+      const CMT S( symmetric<CMT>( 25UL ) );
+      const blaze::HermitianMatrix< blaze::DynamicMatrix<cdouble,blaze::columnMajor> > A( S );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      CMT V;
+
+      blaze::eigen( A, w, V );
+      checkEigenpairs( S, w, V, "Eigenvalue decomposition of HermitianMatrix failed" );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of a LAPACK workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a series of eigenvalue computations for matrices of the same size
+// performs a single workspace query and does not grow the workspace after the first call. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseEigenTest::testWorkspace()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Eigenvalue computation with workspace reuse";
+
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  CMT;
+
+   blaze::LapackWorkspace<double> ws;
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   CMT V;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      const CMT A( symmetric<CMT>( 32UL ) );
+
+      blaze::eigen( A, w, V, ws );
+      checkEigenpairs( A, w, V, "Eigenvalue decomposition with workspace failed" );
+
+      if( i == 0UL ) {
+         capacity = ws.capacity();
+      }
+      else if( ws.queries() != 1UL || ws.capacity() != capacity ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Workspace is not reused\n"
+             << " Details:\n"
+             << "   Number of workspace queries: " << ws.queries() << "\n"
+             << "   Capacity: " << ws.capacity() << " (initial " << capacity << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix eigenvalue test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_EIGEN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix eigenvalue test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
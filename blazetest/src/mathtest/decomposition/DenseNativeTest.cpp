@@ -0,0 +1,311 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/decomposition/DenseNativeTest.cpp
+//  \brief Source file for the native dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blazetest/mathtest/decomposition/DenseNativeTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseNativeTest test.
+//
+// \exception std::runtime_error Error during a native decomposition detected.
+*/
+DenseNativeTest::DenseNativeTest()
+{
+   testLU();
+   testLLH();
+   testQR();
+   testLSE();
+   testNonPositiveDefinite();
+   testSingular();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition for square and rectangular matrices of both
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseNativeTest::testLU()
+{
+   testGetrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 150UL, 150UL );
+   testGetrf< blaze::DynamicMatrix<double,blaze::columnMajor> >( 150UL, 150UL );
+   testGetrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 130UL,  90UL );
+   testGetrf< blaze::DynamicMatrix<double,blaze::columnMajor> >(  90UL, 130UL );
+
+   testGetrf< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 150UL, 150UL );
+   testGetrf< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 130UL,  90UL );
+
+   testGetrf< blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor   > >( 4UL, 4UL );
+   testGetrf< blaze::StaticMatrix<double,5UL,3UL,blaze::columnMajor> >( 5UL, 3UL );
+   testGetrf< blaze::StaticMatrix<cdouble,3UL,3UL,blaze::columnMajor> >( 3UL, 3UL );
+   testGetrf< blaze::StaticMatrix<double,8UL,8UL,blaze::columnMajor> >( 8UL, 8UL );
+
+   testGetrf< blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor   > >( 7UL, 7UL );
+   testGetrf< blaze::HybridMatrix<cdouble,8UL,8UL,blaze::columnMajor> >( 5UL, 6UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native lower and upper Cholesky decomposition for matrices of both
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseNativeTest::testLLH()
+{
+   testPotrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 150UL, 'L' );
+   testPotrf< blaze::DynamicMatrix<double,blaze::columnMajor> >( 150UL, 'L' );
+   testPotrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 130UL, 'U' );
+   testPotrf< blaze::DynamicMatrix<double,blaze::columnMajor> >( 130UL, 'U' );
+
+   testPotrf< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 150UL, 'L' );
+   testPotrf< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 130UL, 'U' );
+
+   testPotrf< blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor   > >( 6UL, 'L' );
+   testPotrf< blaze::StaticMatrix<double,6UL,6UL,blaze::columnMajor> >( 6UL, 'U' );
+   testPotrf< blaze::StaticMatrix<cdouble,4UL,4UL,blaze::columnMajor> >( 4UL, 'L' );
+   testPotrf< blaze::StaticMatrix<double,8UL,8UL,blaze::rowMajor   > >( 8UL, 'U' );
+
+   testPotrf< blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> >( 7UL, 'L' );
+   testPotrf< blaze::HybridMatrix<cdouble,8UL,8UL,blaze::rowMajor   > >( 6UL, 'U' );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native QR decomposition for square and rectangular matrices of both
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseNativeTest::testQR()
+{
+   testGeqrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 150UL, 150UL );
+   testGeqrf< blaze::DynamicMatrix<double,blaze::columnMajor> >( 150UL, 150UL );
+   testGeqrf< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 130UL,  90UL );
+   testGeqrf< blaze::DynamicMatrix<double,blaze::columnMajor> >(  90UL, 130UL );
+
+   testGeqrf< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 130UL,  90UL );
+   testGeqrf< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >(  90UL, 130UL );
+
+   testGeqrf< blaze::StaticMatrix<double,7UL,7UL,blaze::rowMajor   > >( 7UL, 7UL );
+   testGeqrf< blaze::StaticMatrix<double,8UL,5UL,blaze::columnMajor> >( 8UL, 5UL );
+   testGeqrf< blaze::StaticMatrix<cdouble,6UL,6UL,blaze::rowMajor   > >( 6UL, 6UL );
+
+   testGeqrf< blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> >( 8UL, 6UL );
+   testGeqrf< blaze::HybridMatrix<cdouble,8UL,8UL,blaze::rowMajor   > >( 6UL, 8UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems of equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solution of linear systems of equations for small matrices with
+// compile time and runtime dimensions as well as for large matrices of both storage orders.
+// Since the large systems are solved by LAPACK, they are only tested in the LAPACK mode. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseNativeTest::testLSE()
+{
+   testSolve< blaze::StaticMatrix<double,7UL,7UL,blaze::rowMajor   > >( 7UL );
+   testSolve< blaze::StaticMatrix<double,8UL,8UL,blaze::columnMajor> >( 8UL );
+   testSolve< blaze::StaticMatrix<cdouble,4UL,4UL,blaze::columnMajor> >( 4UL );
+
+   testSolve< blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> >( 6UL );
+   testSolve< blaze::HybridMatrix<cdouble,8UL,8UL,blaze::rowMajor   > >( 8UL );
+
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+   testSolve< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 150UL );
+   testSolve< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 130UL );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition with a non-positive-definite matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the native Cholesky decomposition reports a non-positive-definite
+// matrix by means of a \a std::runtime_error exception.
+*/
+void DenseNativeTest::testNonPositiveDefinite()
+{
+   test_ = "Native Cholesky decomposition of a non-positive-definite matrix";
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 100UL, 100UL, 0.0 );
+
+   for( size_t i=0UL; i<100UL; ++i )
+      A(i,i) = 1.0;
+   A(80UL,80UL) = -1.0;
+
+   bool failed( false );
+
+   try {
+      blaze::nativePotrf( A, 'L' );
+   }
+   catch( std::runtime_error& ) {
+      failed = true;
+   }
+
+   if( !failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of non-positive-definite matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the solution of a linear system of equations with a singular matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solve() function reports a singular system matrix by means of
+// a \a std::runtime_error exception.
+*/
+void DenseNativeTest::testSingular()
+{
+   test_ = "Solution of a linear system of equations with a singular matrix";
+
+   blaze::StaticMatrix<double,7UL,7UL,blaze::rowMajor> A;
+   randomize( A );
+
+   for( size_t j=0UL; j<7UL; ++j )
+      A(3UL,j) = 0.0;
+
+   blaze::StaticVector<double,7UL,blaze::columnVector> b, x;
+   randomize( b );
+
+   bool failed( false );
+
+   try {
+      blaze::solve( A, x, b );
+   }
+   catch( std::runtime_error& ) {
+      failed = true;
+   }
+
+   if( !failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the LSE of a singular matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running native dense matrix decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_NATIVE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during native dense matrix decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
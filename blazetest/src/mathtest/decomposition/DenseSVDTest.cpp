@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/decomposition/DenseSVDTest.cpp
+//  \brief Source file for the dense matrix singular value decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/decomposition/DenseSVDTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseSVDTest test.
+//
+// \exception std::runtime_error Error during a singular value decomposition detected.
+*/
+DenseSVDTest::DenseSVDTest()
+{
+   testFull< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 30UL, 30UL );
+   testFull< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 40UL, 25UL );
+   testFull< blaze::DynamicMatrix<double,blaze::columnMajor> >( 25UL, 40UL );
+   testFull< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 25UL, 40UL );
+   testFull< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 40UL, 25UL );
+
+   testPartial< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 40UL, 25UL );
+   testPartial< blaze::DynamicMatrix<double,blaze::columnMajor> >( 25UL, 40UL );
+   testPartial< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 25UL, 40UL );
+   testPartial< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 40UL, 25UL );
+
+   testWorkspace();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of a LAPACK workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a series of singular value decompositions of matrices of the same
+// size performs a single workspace query and does not grow the workspace after the first call.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseSVDTest::testWorkspace()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Singular value decomposition with workspace reuse";
+
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  RMT;
+
+   blaze::LapackWorkspace<double> ws;
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   RMT U, V;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      RMT A( 32UL, 24UL );
+      randomize( A );
+
+      blaze::svd( A, U, s, V, ws );
+
+      RMT US( U );
+      for( size_t j=0UL; j<s.size(); ++j ) {
+         column( US, j ) *= s[j];
+      }
+
+      checkResult( RMT( US * V ), A, "Singular value decomposition with workspace failed" );
+
+      if( i == 0UL ) {
+         capacity = ws.capacity();
+      }
+      else if( ws.queries() != 1UL || ws.capacity() != capacity ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Workspace is not reused\n"
+             << " Details:\n"
+             << "   Number of workspace queries: " << ws.queries() << "\n"
+             << "   Capacity: " << ws.capacity() << " (initial " << capacity << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix singular value decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_SVD_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix singular value decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -41,6 +41,7 @@
 #include <iostream>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densematrix/GeneralTest.h>
 
 
@@ -78,6 +79,8 @@ GeneralTest::GeneralTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testSum();
+   testProduct();
    testTrace();
 }
 //*************************************************************************************************
@@ -4555,6 +4558,458 @@ void GeneralTest::testMaximum()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense matrices, including the
+// row-wise and column-wise reduction. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      // Total, row-wise and column-wise sum of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) = 1;
+         mat(0,1) = 2;
+         mat(0,2) = 3;
+         mat(1,0) = 4;
+         mat(1,1) = 5;
+         mat(1,2) = 6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int total = sum( mat );
+
+         if( total != 21 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 21\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rows.size() != 2UL || rows[0] != 6 || rows[1] != 15 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n( 6 15 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 5 || columns[1] != 7 || columns[2] != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 5 7 9 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Total, row-wise and column-wise sum of a large matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 37UL, 43UL );
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               mat(i,j) = static_cast<int>( ( i*mat.columns() + j ) % 7UL ) - 3;
+            }
+         }
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 43UL );
+
+         int expected( 0 );
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( 37UL, 0 );
+         blaze::DynamicVector<int,blaze::rowVector> colsums( 43UL, 0 );
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               expected   += mat(i,j);
+               rowsums[i] += mat(i,j);
+               colsums[j] += mat(i,j);
+            }
+         }
+
+         const int total = sum( mat );
+
+         if( total != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rows != rowsums ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n" << rowsums << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( columns != colsums ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n" << colsums << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      // Total, row-wise and column-wise sum of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) = 1;
+         mat(0,1) = 2;
+         mat(0,2) = 3;
+         mat(1,0) = 4;
+         mat(1,1) = 5;
+         mat(1,2) = 6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int total = sum( mat );
+
+         if( total != 21 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 21\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rows.size() != 2UL || rows[0] != 6 || rows[1] != 15 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n( 6 15 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 5 || columns[1] != 7 || columns[2] != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 5 7 9 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Total, row-wise and column-wise sum of a large matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 37UL, 43UL );
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               mat(i,j) = static_cast<int>( ( i*mat.columns() + j ) % 7UL ) - 3;
+            }
+         }
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 43UL );
+
+         int expected( 0 );
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( 37UL, 0 );
+         blaze::DynamicVector<int,blaze::rowVector> colsums( 43UL, 0 );
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               expected   += mat(i,j);
+               rowsums[i] += mat(i,j);
+               colsums[j] += mat(i,j);
+            }
+         }
+
+         const int total = sum( mat );
+
+         if( total != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rows != rowsums ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n" << rowsums << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( columns != colsums ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n" << colsums << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for dense matrices, including the
+// row-wise and column-wise reduction. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testProduct()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major prod()";
+
+      // Total, row-wise and column-wise product of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) = 1;
+         mat(0,1) = 2;
+         mat(0,2) = 3;
+         mat(1,0) = 4;
+         mat(1,1) = 5;
+         mat(1,2) = 6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int total = prod( mat );
+
+         if( total != 720 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 720\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::prod<blaze::rowwise>( mat ) );
+
+         if( rows.size() != 2UL || rows[0] != 6 || rows[1] != 120 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n( 6 120 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 4 || columns[1] != 10 || columns[2] != 18 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 4 10 18 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Total and column-wise product of a matrix without rows
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 0UL, 3UL );
+
+         checkRows   ( mat, 0UL );
+         checkColumns( mat, 3UL );
+
+         const int total = prod( mat );
+
+         if( total != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 1 || columns[1] != 1 || columns[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 1 1 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major prod()";
+
+      // Total, row-wise and column-wise product of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) = 1;
+         mat(0,1) = 2;
+         mat(0,2) = 3;
+         mat(1,0) = 4;
+         mat(1,1) = 5;
+         mat(1,2) = 6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int total = prod( mat );
+
+         if( total != 720 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 720\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rows( blaze::prod<blaze::rowwise>( mat ) );
+
+         if( rows.size() != 2UL || rows[0] != 6 || rows[1] != 120 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rows << "\n"
+                << "   Expected result:\n( 6 120 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 4 || columns[1] != 10 || columns[2] != 18 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 4 10 18 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Total and column-wise product of a matrix without rows
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 0UL, 3UL );
+
+         checkRows   ( mat, 0UL );
+         checkColumns( mat, 3UL );
+
+         const int total = prod( mat );
+
+         if( total != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> columns( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( columns.size() != 3UL || columns[0] != 1 || columns[1] != 1 || columns[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << columns << "\n"
+                << "   Expected result:\n( 1 1 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c trace() function for dense matrices.
 //
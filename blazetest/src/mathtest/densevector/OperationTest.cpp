@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/Fusion.h>
 #include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densevector/OperationTest.h>
 
@@ -69,6 +70,9 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProduct();
+   testFuse();
 }
 //*************************************************************************************************
 
@@ -564,6 +568,356 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      checkSize    ( vec, 4UL );
+      checkCapacity( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 1 || vec[1] != -2 || vec[2] != 3 || vec[3] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the sum function
+      const int total = sum( vec );
+
+      if( total != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: -2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::columnVector> vec( 103UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = static_cast<int>( i );
+      }
+
+      checkSize    ( vec, 103UL );
+      checkCapacity( vec, 103UL );
+      checkNonZeros( vec, 102UL );
+
+      // Testing the sum function
+      const int total = sum( vec );
+
+      if( total != 5253 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 5253\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the sum function on a vector expression
+      const int twice = sum( vec + vec );
+
+      if( twice != 10506 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << twice << "\n"
+             << "   Expected result: 10506\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProduct()
+{
+   test_ = "prod() function";
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      checkSize    ( vec, 4UL );
+      checkCapacity( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 1 || vec[1] != -2 || vec[2] != 3 || vec[3] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the prod function
+      const int total = prod( vec );
+
+      if( total != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Initialization check
+      blaze::DynamicVector<double,blaze::columnVector> vec( 37UL, 1.0 );
+      vec[ 3] = 2.0;
+      vec[17] = 0.5;
+      vec[36] = 4.0;
+
+      checkSize    ( vec, 37UL );
+      checkCapacity( vec, 37UL );
+      checkNonZeros( vec, 37UL );
+
+      // Testing the prod function
+      const double total = prod( vec );
+
+      if( total != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Testing the prod function on an empty vector
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      checkSize( vec, 0UL );
+
+      const int total = prod( vec );
+
+      if( total != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c fuse() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c fuse() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testFuse()
+{
+   using blaze::deferred;
+   using blaze::deferredDot;
+   using blaze::deferredReduce;
+   using blaze::fuse;
+
+
+   test_ = "fuse() function";
+
+   {
+      // Fused vector updates and scalar products (CG update)
+      for( size_t n=0UL; n<100UL; n+=7UL )
+      {
+         blaze::DynamicVector<double,blaze::columnVector> x( n ), p( n ), r( n ), Ap( n );
+         randomize( x );
+         randomize( p );
+         randomize( r );
+         randomize( Ap );
+
+         const double alpha( 0.25 );
+
+         blaze::DynamicVector<double,blaze::columnVector> xref( x ), rref( r );
+         rref -= alpha * Ap;
+         xref += alpha * p;
+         const double rrref( trans( rref ) * rref );
+         const double prref( trans( p ) * rref );
+
+         double rr( -1.0 ), pr( -1.0 );
+         fuse( deferred( r ) -= alpha * Ap,
+               deferred( x ) += alpha * p,
+               deferredDot( rr, r, r ),
+               deferredDot( pr, p, r ) );
+
+         if( x != xref || r != rref || !blaze::equal( rr, rrref ) || !blaze::equal( pr, prref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fused CG update failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result (r^T*r, p^T*r): " << rr << " " << pr << "\n"
+                << "   Expected result (r^T*r, p^T*r): " << rrref << " " << prref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      // Fused assignment, componentwise multiplication and reductions of an integral vector
+      blaze::DynamicVector<int,blaze::rowVector> a( 103UL ), b( 103UL ), c;
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<int>( i );
+         b[i] = static_cast<int>( i % 3UL ) - 1;
+      }
+
+      c.resize( 103UL );
+
+      int total( 0 ), largest( 0 );
+      fuse( deferred( c ) = a + b,
+            deferred( c ) *= b,
+            deferredReduce( total, c, blaze::Add() ),
+            deferredReduce( largest, a, blaze::Maximum() ) );
+
+      for( size_t i=0UL; i<c.size(); ++i ) {
+         if( c[i] != ( a[i] + b[i] ) * b[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fused assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << c << "\n"
+                << "   Expected result:\n" << ( a + b ) * b << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( total != sum( ( a + b ) * b ) || largest != 102 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused reduction failed\n"
+             << " Details:\n"
+             << "   Result: " << total << " " << largest << "\n"
+             << "   Expected result: " << sum( ( a + b ) * b ) << " 102\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Fused evaluation of vectors with different element types
+      blaze::DynamicVector<float,blaze::columnVector> a( 45UL, 2.0F );
+      blaze::DynamicVector<double,blaze::columnVector> b( 45UL, 3.0 );
+
+      float fsum( 0.0F );
+      double dsum( 0.0 );
+      fuse( deferred( a ) /= a, deferred( b ) -= 2.0 * b,
+            deferredReduce( fsum, a, blaze::Add() ),
+            deferredReduce( dsum, b, blaze::Add() ) );
+
+      if( fsum != 45.0F || dsum != -135.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation of mixed element types failed\n"
+             << " Details:\n"
+             << "   Result: " << fsum << " " << dsum << "\n"
+             << "   Expected result: 45 -135\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Fused reduction of an empty vector
+      blaze::DynamicVector<double,blaze::columnVector> a;
+
+      double dot( 1.0 );
+      fuse( deferredDot( dot, a, a ) );
+
+      if( dot != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused reduction of an empty vector failed\n"
+             << " Details:\n"
+             << "   Result: " << dot << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Fused evaluation of vectors of different size
+      blaze::DynamicVector<double,blaze::columnVector> a( 5UL ), b( 6UL );
+
+      try {
+         double dot( 0.0 );
+         fuse( deferred( a ) += a, deferredDot( dot, b, b ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation of vectors of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         deferred( a ) += b;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deferred assignment of vectors of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
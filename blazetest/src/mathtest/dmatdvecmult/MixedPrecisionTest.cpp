@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/dmatdvecmult/MixedPrecisionTest.cpp
+//  \brief Source file for the mixed-precision dense matrix/dense vector multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dmatdvecmult/MixedPrecisionTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdvecmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the mixed-precision test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MixedPrecisionTest::MixedPrecisionTest()
+   : test_()
+{
+   testDMatDVecMult ();
+   testTDMatDVecMult();
+   testReductions   ();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision row-major dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of row-major single precision matrices with double
+// precision vectors for a range of matrix sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MixedPrecisionTest::testDMatDVecMult()
+{
+   test_ = "Row-major float matrix/double vector multiplication";
+
+   for( size_t m=0UL; m<=9UL; ++m ) {
+      for( size_t n=0UL; n<=9UL; ++n ) {
+         testMult<DMat>( m, n );
+      }
+   }
+
+   testMult<DMat>(  67UL, 127UL );
+   testMult<DMat>( 128UL,  64UL );
+   testMult<DMat>( 300UL, 500UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision column-major dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of column-major single precision matrices with double
+// precision vectors for a range of matrix sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MixedPrecisionTest::testTDMatDVecMult()
+{
+   test_ = "Column-major float matrix/double vector multiplication";
+
+   for( size_t m=0UL; m<=9UL; ++m ) {
+      for( size_t n=0UL; n<=9UL; ++n ) {
+         testMult<TDMat>( m, n );
+      }
+   }
+
+   testMult<TDMat>(  67UL, 127UL );
+   testMult<TDMat>( 128UL,  64UL );
+   testMult<TDMat>( 500UL, 300UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dssum(), dsdot() and dsnrm2() functions for single precision vectors
+// of various sizes, for vector expressions and for vectors of other element types. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MixedPrecisionTest::testReductions()
+{
+   test_ = "Mixed-precision reductions";
+
+   for( size_t n=0UL; n<=1025UL; n+=( n < 20UL ? 1UL : 101UL ) )
+   {
+      FVec a( n ), b( n );
+      randomize( a );
+      randomize( b );
+
+      double sum( 0.0 ), dot( 0.0 ), sqr( 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         sum += double( a[i] );
+         dot += double( a[i] ) * double( b[i] );
+         sqr += double( a[i] ) * double( a[i] );
+      }
+
+      checkValue( blaze::dssum( a ), sum );
+      checkValue( blaze::dsdot( a, b ), dot );
+      checkValue( blaze::dsdot( trans( a ), b ), dot );
+      checkValue( blaze::dsnrm2( a ), std::sqrt( sqr ) );
+
+      if( n > 2UL ) {
+         checkValue( blaze::dssum( subvector( a, 1UL, n-2UL ) ),
+                     sum - double( a[0] ) - double( a[n-1UL] ) );
+      }
+   }
+
+   {
+      FVec a( 100UL ), b( 100UL );
+      randomize( a );
+      randomize( b );
+
+      double sum( 0.0 );
+      for( size_t i=0UL; i<100UL; ++i ) {
+         sum += double( a[i] + b[i] );
+      }
+
+      checkValue( blaze::dssum( a + b ), sum );
+   }
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> a{ 1, -2, 3, 4 };
+      DVec b{ 0.5, 1.5, -1.0, 2.0 };
+
+      checkValue( blaze::dssum( a ), 6.0 );
+      checkValue( blaze::dsdot( a, b ), 2.5 );
+      checkValue( blaze::dsnrm2( a ), std::sqrt( 30.0 ) );
+   }
+
+   try {
+      FVec a( 5UL ), b( 6UL );
+      blaze::dsdot( a, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dot product of vectors of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing a computed value.
+//
+// \param computedValue The computed value.
+// \param expectedValue The expected value.
+// \return void
+// \exception std::runtime_error Incorrect value detected.
+*/
+void MixedPrecisionTest::checkValue( double computedValue, double expectedValue ) const
+{
+   if( !( std::fabs( computedValue - expectedValue ) <= 1E-12 * ( 1.0 + std::fabs( expectedValue ) ) ) ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect value detected\n"
+          << " Details:\n"
+          << "   Computed value: " << computedValue << "\n"
+          << "   Expected value: " << expectedValue << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatdvecmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running mixed-precision test..." << std::endl;
+
+   try
+   {
+      RUN_DMATDVECMULT_MIXEDPRECISION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during mixed-precision test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -9088,6 +9088,32 @@ void ClassTest::testTranspose()
       }
    }
 
+   {
+      test_ = "Row-major self-transpose of a non-square matrix (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -9250,6 +9276,32 @@ void ClassTest::testTranspose()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major self-transpose of a non-square matrix (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
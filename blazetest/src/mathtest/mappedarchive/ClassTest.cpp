@@ -0,0 +1,697 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/mappedarchive/ClassTest.cpp
+//  \brief Source file for the MappedArchive class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/mappedarchive/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedarchive {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedArchive class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_    ()
+   , filename_( "mappedarchive.blazemap" )
+{
+   testDenseMatrices();
+   testDenseVectors();
+   testSparseMatrices();
+   testMultipleEntries();
+   testLifetime();
+   testFailures();
+   testCorruptEntries();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedArchive class test.
+//
+// The destructor removes the temporary archive file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy loading of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense matrices of various sizes and element types to an archive and
+// maps them into custom matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseMatrices()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrices";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 16UL, 33UL } ) {
+      for( size_t n : { 0UL, 1UL, 5UL, 16UL, 31UL } )
+      {
+         {
+            blaze::DynamicMatrix<double,rowMajor> src( m, n );
+            randomize( src );
+            blaze::CustomMatrix<double,aligned,padded,rowMajor> dst;
+            runDenseMatrixTest( src, dst );
+         }
+
+         {
+            blaze::DynamicMatrix<double,columnMajor> src( m, n );
+            randomize( src );
+            blaze::CustomMatrix<double,aligned,padded,columnMajor> dst;
+            runDenseMatrixTest( src, dst );
+         }
+
+         {
+            blaze::DynamicMatrix<float,rowMajor> src( m, n );
+            randomize( src );
+            blaze::CustomMatrix<float,unaligned,unpadded,rowMajor> dst;
+            runDenseMatrixTest( src, dst );
+         }
+
+         {
+            blaze::DynamicMatrix<int,columnMajor> src( m, n );
+            randomize( src );
+            blaze::CustomMatrix<int,aligned,unpadded,columnMajor> dst;
+            runDenseMatrixTest( src, dst );
+         }
+
+         {
+            blaze::DynamicMatrix<blaze::complex<double>,rowMajor> src( m, n );
+            randomize( src );
+            blaze::CustomMatrix<blaze::complex<double>,aligned,padded,rowMajor> dst;
+            runDenseMatrixTest( src, dst );
+         }
+      }
+   }
+
+   {
+      test_ = "Dense matrix expression";
+
+      blaze::DynamicMatrix<double,rowMajor> A( 9UL, 6UL );
+      blaze::DynamicMatrix<double,rowMajor> B( 6UL, 11UL );
+      randomize( A );
+      randomize( B );
+
+      blaze::CustomMatrix<double,aligned,padded,rowMajor> dst;
+      runDenseMatrixTest( A * B, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy loading of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense vectors of various sizes and element types to an archive and
+// maps them into custom vectors. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseVectors()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   test_ = "Dense vectors";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 16UL, 63UL, 1000UL } )
+   {
+      {
+         blaze::DynamicVector<double,columnVector> src( n );
+         randomize( src );
+         blaze::CustomVector<double,aligned,padded,columnVector> dst;
+         runDenseVectorTest( src, dst );
+      }
+
+      {
+         blaze::DynamicVector<float,rowVector> src( n );
+         randomize( src );
+         blaze::CustomVector<float,unaligned,unpadded,rowVector> dst;
+         runDenseVectorTest( src, dst );
+      }
+
+      {
+         blaze::DynamicVector<short,columnVector> src( n );
+         randomize( src );
+         blaze::CustomVector<short,aligned,unpadded,columnVector> dst;
+         runDenseVectorTest( src, dst );
+      }
+
+      {
+         blaze::DynamicVector<blaze::complex<float>,columnVector> src( n );
+         randomize( src );
+         blaze::CustomVector<blaze::complex<float>,aligned,padded,columnVector> dst;
+         runDenseVectorTest( src, dst );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy loading of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes sparse matrices of various sizes and element types to an archive and
+// maps them into mapped compressed matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseMatrices()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Sparse matrices";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 33UL } ) {
+      for( size_t n : { 0UL, 1UL, 5UL, 31UL } ) {
+         for( size_t nonzeros : { 0UL, 1UL, 3UL, m*n/3UL, m*n } )
+         {
+            if( nonzeros > m*n ) continue;
+
+            {
+               blaze::CompressedMatrix<double,rowMajor> src( m, n );
+               randomize( src, nonzeros );
+               blaze::MappedCompressedMatrix<double,rowMajor> dst;
+               runSparseMatrixTest( src, dst );
+            }
+
+            {
+               blaze::CompressedMatrix<int,columnMajor> src( m, n );
+               randomize( src, nonzeros );
+               blaze::MappedCompressedMatrix<int,columnMajor> dst;
+               runSparseMatrixTest( src, dst );
+            }
+
+            {
+               blaze::CompressedMatrix<blaze::complex<double>,rowMajor> src( m, n );
+               randomize( src, nonzeros );
+               blaze::MappedCompressedMatrix<blaze::complex<double>,rowMajor> dst;
+               runSparseMatrixTest( src, dst );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Sparse matrix operations";
+
+      blaze::CompressedMatrix<double,rowMajor> src( 20UL, 15UL );
+      randomize( src, 60UL );
+
+      blaze::DynamicVector<double> x( 15UL );
+      randomize( x );
+
+      blaze::MappedCompressedMatrix<double,rowMajor> dst;
+      runSparseMatrixTest( src, dst );
+
+      compare( blaze::DynamicVector<double>( src * x ), blaze::DynamicVector<double>( dst * x ) );
+      compare( blaze::CompressedMatrix<double,columnMajor>( trans( src ) ),
+               blaze::CompressedMatrix<double,columnMajor>( trans( dst ) ) );
+      compare( blaze::CompressedMatrix<double>( src * trans( src ) ),
+               blaze::CompressedMatrix<double>( dst * trans( dst ) ) );
+      compare( blaze::CompressedVector<double,blaze::rowVector>( row( src, 3UL ) ),
+               blaze::CompressedVector<double,blaze::rowVector>( row( dst, 3UL ) ) );
+
+      const blaze::CompressedMatrix<double,rowMajor>& ref( src );
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         for( size_t j=0UL; j<ref.columns(); ++j ) {
+            if( ref(i,j) != dst(i,j) ||
+                ( ref.find(i,j) == ref.end(i) ) != ( dst.find(i,j) == dst.end(i) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element access\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << dst(i,j) << "\n"
+                   << "   Expected result: " << ref(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of archives with multiple entries.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several vectors and matrices into a single archive and reads them back
+// in the same order. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultipleEntries()
+{
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   test_ = "Multiple entries";
+
+   blaze::DynamicMatrix<double,rowMajor> A( 13UL, 7UL );
+   blaze::DynamicVector<double,columnVector> x( 7UL );
+   blaze::CompressedMatrix<float,columnMajor> S( 9UL, 17UL );
+   blaze::DynamicMatrix<float,columnMajor> B( 5UL, 3UL );
+
+   randomize( A );
+   randomize( x );
+   randomize( S, 40UL );
+   randomize( B );
+
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << A << x << S << B;
+   }
+
+   blaze::CustomMatrix<double,aligned,padded,rowMajor> A2;
+   blaze::CustomVector<double,aligned,padded,columnVector> x2;
+   blaze::MappedCompressedMatrix<float,columnMajor> S2;
+   blaze::CustomMatrix<float,aligned,padded,columnMajor> B2;
+
+   blaze::MappedArchive archive( filename_ );
+   archive >> A2 >> x2 >> S2 >> B2;
+
+   if( !archive.eof() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: End of archive not reached\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   compare( A, A2 );
+   compare( x, x2 );
+   compare( S, S2 );
+   compare( B, B2 );
+   compare( blaze::DynamicVector<double,columnVector>( A * x ),
+            blaze::DynamicVector<double,columnVector>( A2 * x2 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lifetime of the mapped vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the mapped vectors and matrices remain valid after the archive has
+// been destroyed and that modifications of the elements of a copy-on-write mapping are not
+// written back to the archive file. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLifetime()
+{
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::rowMajor;
+
+   test_ = "Lifetime of mapped data";
+
+   blaze::DynamicMatrix<double,rowMajor> A( 6UL, 4UL );
+   blaze::CompressedMatrix<double,rowMajor> S( 6UL, 4UL );
+
+   randomize( A );
+   randomize( S, 10UL );
+
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << A << S;
+   }
+
+   blaze::CustomMatrix<double,aligned,padded,rowMajor> A2;
+   blaze::MappedCompressedMatrix<double,rowMajor> S2;
+
+   {
+      blaze::MappedArchive archive( filename_, true );
+      archive >> A2 >> S2;
+   }
+
+   compare( A, A2 );
+   compare( S, S2 );
+
+   A2 = 0.0;
+
+   blaze::CustomMatrix<double,aligned,padded,rowMajor> A3;
+
+   {
+      blaze::MappedArchive archive( filename_ );
+      archive >> A3;
+   }
+
+   compare( A, A3 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing loading attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with invalid archive files and mismatching vector and matrix
+// types. In case no error is detected, i.e. in case the test is failing, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   test_ = "Loading failures";
+
+   blaze::DynamicMatrix<int,rowMajor> A( 4UL, 5UL );
+   randomize( A );
+
+   {
+      blaze::MappedArchiveWriter writer( filename_ );
+      writer << A;
+   }
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::CustomMatrix<int,unaligned,unpadded,columnMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::CustomMatrix<float,unaligned,unpadded,rowMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::CustomMatrix<long,unaligned,unpadded,rowMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element size difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::CustomVector<int,unaligned,unpadded,columnVector> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector/matrix difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::MappedCompressedMatrix<int,rowMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense/sparse difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+      blaze::CustomMatrix<int,aligned,padded,rowMajor> dst1, dst2;
+      archive >> dst1 >> dst2;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading beyond the end of the archive succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   {
+      std::ofstream file( filename_.c_str(), std::ios::binary | std::ios::trunc );
+      file << "This is not a Blaze archive, but a plain text file with more than 64 characters.";
+   }
+
+   try {
+      blaze::MappedArchive archive( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of an invalid archive file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( "nonexisting.blazemap" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      const blaze::MemoryMap map( filename_ );
+      map.mutableData();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Write access to a read-only memory map succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::logic_error& )
+   {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of loading attempts of archive entries with corrupt headers or payloads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function manipulates the entries of valid archive files such that the sizes of the
+// payloads overflow or the stored indices of sparse matrices are out of range. In case the
+// corrupt entries are not detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCorruptEntries()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   typedef blaze::MappedArchiveEntry    Entry;
+   typedef blaze::ValueIndexPair<int>  Element;
+
+   test_ = "Corrupt archive entries";
+
+   const size_t entry   ( sizeof( blaze::MappedArchiveHeader ) );
+   const size_t payload ( entry + sizeof( Entry ) );
+   const size_t rows    ( entry + offsetof( Entry, rows     ) );
+   const size_t spacing ( entry + offsetof( Entry, spacing  ) );
+   const size_t nonZeros( entry + offsetof( Entry, nonZeros ) );
+
+   // Dense matrix with a number of rows that wraps the size of the payload
+   {
+      const blaze::DynamicMatrix<int,rowMajor> A( 4UL, 5UL, 1 );
+      blaze::MappedArchiveWriter( filename_ ) << A;
+
+      patch( rows, uint64_t( ( 1ULL << 58 ) + 4ULL ) );
+      checkCorruption< blaze::CustomMatrix<int,unaligned,unpadded,rowMajor> >( "Overflowing number of rows" );
+   }
+
+   // Dense vector with a spacing that wraps the size of the payload
+   {
+      const blaze::DynamicVector<int,columnVector> x( 5UL, 1 );
+      blaze::MappedArchiveWriter( filename_ ) << x;
+
+      patch( spacing, uint64_t( ( 1ULL << 62 ) + 16ULL ) );
+      checkCorruption< blaze::CustomVector<int,unaligned,unpadded,columnVector> >( "Overflowing spacing" );
+   }
+
+   // Sparse matrices with overflowing sizes and invalid indices
+   {
+      blaze::CompressedMatrix<int,rowMajor> S( 3UL, 4UL );
+      S(0,1) = 1;
+      S(0,3) = 2;
+      S(2,0) = 3;
+
+      const size_t elements( payload + blaze::MappedArchiveFormat::padded( 4UL*sizeof( uint64_t ) ) );
+
+      blaze::MappedArchiveWriter( filename_ ) << S;
+      patch( rows, uint64_t( ~0ULL ) );
+      checkCorruption< blaze::MappedCompressedMatrix<int,rowMajor> >( "Overflowing number of offsets" );
+
+      blaze::MappedArchiveWriter( filename_ ) << S;
+      patch( nonZeros, uint64_t( ( 1ULL << 60 ) + 3ULL ) );
+      checkCorruption< blaze::MappedCompressedMatrix<int,rowMajor> >( "Overflowing number of non-zeros" );
+
+      blaze::MappedArchiveWriter( filename_ ) << S;
+      patch( elements + 2UL*sizeof( Element ), Element( 3, 4UL ) );
+      checkCorruption< blaze::MappedCompressedMatrix<int,rowMajor> >( "Column index out of range" );
+
+      blaze::MappedArchiveWriter( filename_ ) << S;
+      patch( elements + sizeof( Element ), Element( 2, 1UL ) );
+      checkCorruption< blaze::MappedCompressedMatrix<int,rowMajor> >( "Repeated column index" );
+
+      blaze::MappedArchiveWriter( filename_ ) << S;
+      {
+         blaze::MappedArchive archive( filename_ );
+         blaze::MappedCompressedMatrix<int,rowMajor> dst;
+         archive >> dst;
+         compare( S, dst );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace mappedarchive
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedArchive class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDARCHIVE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedArchive class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
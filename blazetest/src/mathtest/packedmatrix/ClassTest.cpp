@@ -0,0 +1,645 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/Views.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAccess();
+   testIterator();
+   testResize();
+   testMult();
+   testRankUpdate();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix default constructor";
+
+      blaze::PackedMatrix<double> A;
+
+      checkSize( A, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructors
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix size constructor";
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedLower> A( 5UL );
+
+      checkSize  ( A, 5UL );
+      checkMatrix( A, blaze::DynamicMatrix<int>( 5UL, 5UL, 0 ) );
+
+      if( A.capacity() < 15UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << A.capacity() << "\n"
+             << "   Expected capacity: >= 15\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PackedMatrix homogeneous initialization";
+
+      blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedUpper> A( 3UL, 2 );
+
+      const blaze::DynamicMatrix<int> expected{ { 2, 2, 2 }, { 0, 2, 2 }, { 0, 0, 2 } };
+      checkMatrix( A, expected );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix copy constructor";
+
+      const blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> A( generate< blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> >( 11UL ) );
+      const blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> B( A );
+
+      checkSize  ( B, 11UL );
+      checkMatrix( B, A );
+   }
+
+   {
+      test_ = "PackedMatrix move constructor";
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> A( generate< blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> >( 11UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> B( std::move( A ) );
+
+      checkSize  ( A, 0UL );
+      checkSize  ( B, 11UL );
+      checkMatrix( B, D );
+   }
+
+
+   //=====================================================================================
+   // Matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix constructor (symmetric matrix)";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> D{ { 1, 2, 3 }, { 2, 4, 5 }, { 3, 5, 6 } };
+      const blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> A( D );
+
+      checkSize  ( A, 3UL );
+      checkMatrix( A, D );
+   }
+
+   {
+      test_ = "PackedMatrix constructor (non-symmetric matrix)";
+
+      const blaze::DynamicMatrix<int> D{ { 1, 2 }, { 3, 4 } };
+
+      try {
+         const blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> A( D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric packed matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix constructor (non-lower matrix)";
+
+      const blaze::DynamicMatrix<int> D{ { 1, 2 }, { 0, 4 } };
+
+      try {
+         const blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedLower> A( D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-lower packed matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   typedef blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedSymmetric>  SPM;
+
+   //=====================================================================================
+   // Copy and move assignment
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix copy assignment";
+
+      const SPM A( generate<SPM>( 9UL ) );
+      SPM B( 3UL );
+      B = A;
+
+      checkSize  ( B, 9UL );
+      checkMatrix( B, A );
+   }
+
+   {
+      test_ = "PackedMatrix move assignment";
+
+      SPM A( generate<SPM>( 9UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      SPM B( 3UL );
+      B = std::move( A );
+
+      checkSize  ( B, 9UL );
+      checkMatrix( B, D );
+   }
+
+
+   //=====================================================================================
+   // Matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix matrix assignment";
+
+      const SPM A( generate<SPM>( 9UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      SPM B;
+      B = trans( A ) + A;
+
+      checkSize  ( B, 9UL );
+      checkMatrix( B, 2*D );
+   }
+
+   {
+      test_ = "PackedMatrix matrix assignment (non-upper matrix)";
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedUpper> A( 2UL );
+      const blaze::DynamicMatrix<int> D{ { 1, 2 }, { 3, 4 } };
+
+      try {
+         A = D;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-upper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Addition, subtraction and scaling
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix addition/subtraction assignment and scaling";
+
+      const SPM A( generate<SPM>( 9UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      SPM B( A );
+      B += A;
+      B *= 3;
+      B -= A;
+      B /= 5;
+
+      checkMatrix( B, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// PackedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAccess()
+{
+   //=====================================================================================
+   // Symmetric matrices
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix::operator() (symmetric)";
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric> A( 3UL );
+
+      A(0,1) = 2;
+      A(2,1) = 3;
+      A(2,2) = 4;
+      A(1,2) += 1;
+
+      const blaze::DynamicMatrix<int> expected{ { 0, 2, 0 }, { 2, 0, 4 }, { 0, 4, 4 } };
+      checkMatrix( A, expected );
+   }
+
+
+   //=====================================================================================
+   // Hermitian matrices
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix::operator() (Hermitian)";
+
+      typedef blaze::complex<double>  cplx;
+
+      blaze::PackedMatrix<cplx,blaze::columnMajor,blaze::packedHermitian> A( 3UL );
+
+      A(0,2) = cplx( 1.0, 2.0 );
+      A(1,0) = cplx( 3.0, 4.0 );
+      A(1,1) = cplx( 5.0, 0.0 );
+
+      const blaze::DynamicMatrix<cplx> expected{ { cplx( 0.0,  0.0 ), cplx( 3.0, -4.0 ), cplx( 1.0, 2.0 ) },
+                                                 { cplx( 3.0,  4.0 ), cplx( 5.0,  0.0 ), cplx( 0.0, 0.0 ) },
+                                                 { cplx( 1.0, -2.0 ), cplx( 0.0,  0.0 ), cplx( 0.0, 0.0 ) } };
+      checkMatrix( A, expected );
+
+      try {
+         A(2,2) = cplx( 1.0, 1.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of complex value to diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Triangular matrices
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix::operator() (lower)";
+
+      blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedLower> A( 3UL );
+
+      A(2,0) = 4;
+      A(1,1) = 5;
+
+      const blaze::DynamicMatrix<int> expected{ { 0, 0, 0 }, { 0, 5, 0 }, { 4, 0, 0 } };
+      checkMatrix( A, expected );
+
+      try {
+         A(0,2) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix::at()";
+
+      blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedUpper> A( 3UL );
+
+      try {
+         A.at(3,1) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix iterators and of the row and column views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterators of the PackedMatrix class template, which
+// traverse all elements of a row (row-major) or column (column-major), including the implied
+// elements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedSymmetric>  SPM;
+   typedef blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedUpper>   UPM;
+
+   {
+      test_ = "PackedMatrix iterators";
+
+      const SPM A( generate<SPM>( 13UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         if( A.end(i) - A.begin(i) != 13L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator distance detected\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Result: " << ( A.end(i) - A.begin(i) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         size_t j( 0UL );
+         for( SPM::ConstIterator it=A.cbegin(i); it!=A.cend(i); ++it, ++j ) {
+            if( *it != D(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid iterator value detected\n"
+                   << " Details:\n"
+                   << "   Element : (" << i << "," << j << ")\n"
+                   << "   Result  : " << *it << "\n"
+                   << "   Expected: " << D(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "PackedMatrix row and column views";
+
+      const UPM A( generate<UPM>( 13UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      checkVector( row   ( A, 4UL ), row   ( D, 4UL ) );
+      checkVector( column( A, 4UL ), column( D, 4UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix resize functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() and extend() functions of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   typedef blaze::PackedMatrix<int,blaze::rowMajor,blaze::packedLower>     LPM;
+   typedef blaze::PackedMatrix<int,blaze::columnMajor,blaze::packedUpper>  UPM;
+
+   {
+      test_ = "PackedMatrix::resize() (lower)";
+
+      LPM A( generate<LPM>( 17UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      A.resize( 20UL );
+      checkSize  ( A, 20UL );
+      checkMatrix( submatrix( A, 0UL, 0UL, 17UL, 17UL ), D );
+      checkMatrix( submatrix( A, 17UL, 0UL, 3UL, 20UL ), blaze::DynamicMatrix<int>( 3UL, 20UL, 0 ) );
+
+      A.resize( 9UL );
+      checkSize  ( A, 9UL );
+      checkMatrix( A, submatrix( D, 0UL, 0UL, 9UL, 9UL ) );
+
+      A.resize( 0UL );
+      checkSize( A, 0UL );
+   }
+
+   {
+      test_ = "PackedMatrix::extend() (upper)";
+
+      UPM A( generate<UPM>( 7UL ) );
+      const blaze::DynamicMatrix<int> D( A );
+
+      A.extend( 10UL );
+      checkSize  ( A, 17UL );
+      checkMatrix( submatrix( A, 0UL, 0UL, 7UL, 7UL ), D );
+      checkMatrix( submatrix( A, 0UL, 7UL, 17UL, 10UL ), blaze::DynamicMatrix<int>( 17UL, 10UL, 0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed matrix/vector and matrix/matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMult()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::packedSymmetric;
+   using blaze::packedHermitian;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Packed matrix multiplication";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testMult< blaze::PackedMatrix<double,rowMajor,packedSymmetric> >( n );
+      testMult< blaze::PackedMatrix<double,columnMajor,packedSymmetric> >( n );
+      testMult< blaze::PackedMatrix<float,columnMajor,packedHermitian> >( n );
+      testMult< blaze::PackedMatrix<double,rowMajor,packedLower> >( n );
+      testMult< blaze::PackedMatrix<double,columnMajor,packedLower> >( n );
+      testMult< blaze::PackedMatrix<double,rowMajor,packedUpper> >( n );
+      testMult< blaze::PackedMatrix<double,columnMajor,packedUpper> >( n );
+      testMult< blaze::PackedMatrix<int,columnMajor,packedSymmetric> >( n );
+      testMult< blaze::PackedMatrix<cplx,columnMajor,packedSymmetric> >( n );
+      testMult< blaze::PackedMatrix<cplx,rowMajor,packedHermitian> >( n );
+      testMult< blaze::PackedMatrix<cplx,columnMajor,packedHermitian> >( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed rank-k update.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testRankUpdate()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::packedSymmetric;
+   using blaze::packedHermitian;
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Packed rank-k update";
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL } )
+   {
+      testRankUpdate< blaze::PackedMatrix<double,rowMajor,packedSymmetric> >( n );
+      testRankUpdate< blaze::PackedMatrix<double,columnMajor,packedSymmetric> >( n );
+      testRankUpdate< blaze::PackedMatrix<int,rowMajor,packedSymmetric> >( n );
+      testRankUpdate< blaze::PackedMatrix<cplx,rowMajor,packedHermitian> >( n );
+      testRankUpdate< blaze::PackedMatrix<cplx,columnMajor,packedHermitian> >( n );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,610 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/selection/ClassTest.cpp
+//  \brief Source file for the selection view class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/selection/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace selection {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the selection view class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testRows();
+   testColumns();
+   testElements();
+   testExpressions();
+   testAssignment();
+   testComposition();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the rows() view.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rows() view for row-major and column-major matrices of
+// various element types. The selected rows contain unsorted and repeated indices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRows()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const std::vector<size_t> few{ 4UL, 0UL, 4UL, 2UL };
+
+   test_ = "rows() view (int)";
+   testRows< blaze::DynamicMatrix<int,rowMajor>    >( 5UL, 7UL, few );
+   testRows< blaze::DynamicMatrix<int,columnMajor> >( 5UL, 7UL, few );
+
+   test_ = "rows() view (float)";
+   testRows< blaze::DynamicMatrix<float,rowMajor>    >( 37UL, 21UL, permutation( 37UL ) );
+   testRows< blaze::DynamicMatrix<float,columnMajor> >( 37UL, 21UL, permutation( 37UL ) );
+
+   test_ = "rows() view (double)";
+   testRows< blaze::DynamicMatrix<double,rowMajor>    >( 33UL, 19UL, permutation( 33UL ) );
+   testRows< blaze::DynamicMatrix<double,columnMajor> >( 33UL, 19UL, permutation( 33UL ) );
+
+   {
+      test_ = "rows() view (empty selection)";
+
+      const blaze::DynamicMatrix<double> A( 4UL, 3UL, 1.0 );
+      const std::vector<size_t> none;
+
+      checkSize( rows( A, none ), blaze::DynamicMatrix<double>( 0UL, 3UL ) );
+   }
+
+   {
+      test_ = "rows() view (initializer list)";
+
+      const blaze::DynamicMatrix<int,columnMajor> A{ { 1, 2, 3 },
+                                                     { 4, 5, 6 },
+                                                     { 7, 8, 9 } };
+      const blaze::DynamicMatrix<int> expected{ { 7, 8, 9 },
+                                                { 1, 2, 3 },
+                                                { 7, 8, 9 } };
+
+      checkMatrix( rows( A, { 2UL, 0UL, 2UL } ), expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the columns() view.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the columns() view for row-major and column-major matrices
+// of various element types. The selected columns contain unsorted and repeated indices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testColumns()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const std::vector<size_t> few{ 1UL, 6UL, 1UL, 3UL, 0UL };
+
+   test_ = "columns() view (int)";
+   testColumns< blaze::DynamicMatrix<int,rowMajor>    >( 4UL, 7UL, few );
+   testColumns< blaze::DynamicMatrix<int,columnMajor> >( 4UL, 7UL, few );
+
+   test_ = "columns() view (float)";
+   testColumns< blaze::DynamicMatrix<float,rowMajor>    >( 23UL, 41UL, permutation( 41UL ) );
+   testColumns< blaze::DynamicMatrix<float,columnMajor> >( 23UL, 41UL, permutation( 41UL ) );
+
+   test_ = "columns() view (double)";
+   testColumns< blaze::DynamicMatrix<double,rowMajor>    >( 17UL, 35UL, permutation( 35UL ) );
+   testColumns< blaze::DynamicMatrix<double,columnMajor> >( 17UL, 35UL, permutation( 35UL ) );
+
+   {
+      test_ = "columns() view (initializer list)";
+
+      const blaze::DynamicMatrix<int> A{ { 1, 2, 3 },
+                                         { 4, 5, 6 } };
+      const blaze::DynamicMatrix<int> expected{ { 3, 3, 1 },
+                                                { 6, 6, 4 } };
+
+      checkMatrix( columns( A, { 2UL, 2UL, 0UL } ), expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the elements() view.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the elements() view for column and row vectors of various
+// element types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElements()
+{
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const std::vector<size_t> few{ 3UL, 3UL, 0UL, 5UL };
+
+   test_ = "elements() view (int)";
+   testElements< blaze::DynamicVector<int,columnVector> >( 6UL, few );
+   testElements< blaze::DynamicVector<int,rowVector>    >( 6UL, few );
+
+   test_ = "elements() view (float)";
+   testElements< blaze::DynamicVector<float,columnVector> >( 53UL, permutation( 53UL ) );
+   testElements< blaze::DynamicVector<float,rowVector>    >( 53UL, permutation( 53UL ) );
+
+   test_ = "elements() view (double)";
+   testElements< blaze::DynamicVector<double,columnVector> >( 29UL, permutation( 29UL ) );
+   testElements< blaze::DynamicVector<double,rowVector>    >( 29UL, permutation( 29UL ) );
+
+   {
+      test_ = "elements() view (assignment)";
+
+      blaze::DynamicVector<double> x{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+      const blaze::DynamicVector<double> y{ 10.0, 20.0 };
+
+      elements( x, { 4UL, 1UL } ) = y;
+      elements( x, { 0UL, 2UL } ) += y;
+      elements( x, { 3UL } ) *= 2.0;
+
+      checkVector( x, blaze::DynamicVector<double>{ 11.0, 20.0, 23.0, 8.0, 10.0 } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of selection views on expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies the selection views to matrix and vector expressions and compares the
+// results with the selection of the evaluated expressions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExpressions()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     RMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  CMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector> VT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>    TVT;
+
+   const RMT A( blaze::rand<RMT>( 13UL, 9UL, 0, 9 ) );
+   const CMT B( blaze::rand<CMT>( 9UL, 11UL, 0, 9 ) );
+   const RMT C( blaze::rand<RMT>( 13UL, 9UL, 0, 9 ) );
+   const VT  x( blaze::rand<VT>( 9UL, 0, 9 ) );
+   const TVT y( blaze::rand<TVT>( 13UL, 0, 9 ) );
+
+   const std::vector<size_t> ri{ 12UL, 3UL, 3UL, 7UL, 0UL };
+   const std::vector<size_t> ci{ 8UL, 1UL, 4UL, 4UL };
+
+   {
+      test_ = "rows() view (matrix/matrix multiplication)";
+
+      checkMatrix( rows( A*B, ri ), selectRows( RMT( A*B ), ri ) );
+      checkMatrix( columns( A*B, ci ), selectColumns( RMT( A*B ), ci ) );
+      checkMatrix( rows( trans( B )*trans( A ), ci ), selectRows( RMT( trans( B )*trans( A ) ), ci ) );
+   }
+
+   {
+      test_ = "rows() view (matrix addition and subtraction)";
+
+      checkMatrix( rows( A+C, ri ), selectRows( RMT( A+C ), ri ) );
+      checkMatrix( rows( A-C, ri ) + rows( C, ri ), rows( A, ri ) );
+      checkMatrix( columns( A+C, ci ), selectColumns( RMT( A+C ), ci ) );
+   }
+
+   {
+      test_ = "rows() view (scalar operations)";
+
+      checkMatrix( rows( 2.0*A, ri ), 2.0*selectRows( A, ri ) );
+      checkMatrix( columns( A/2.0, ci ), selectColumns( A, ci )/2.0 );
+   }
+
+   {
+      test_ = "rows() view (transpose and outer product)";
+
+      checkMatrix( rows( trans( B ), ci ), trans( columns( B, ci ) ) );
+      checkMatrix( columns( trans( A ), ri ), trans( rows( A, ri ) ) );
+      checkMatrix( rows( x*y, ci ), selectRows( RMT( x*y ), ci ) );
+      checkMatrix( columns( x*y, ri ), selectColumns( RMT( x*y ), ri ) );
+   }
+
+   {
+      test_ = "elements() view (matrix/vector multiplication)";
+
+      const VT Ax( A*x );
+      const TVT yA( y*A );
+
+      VT expected( ri.size() );
+      for( size_t i=0UL; i<ri.size(); ++i )
+         expected[i] = Ax[ri[i]];
+      checkVector( elements( A*x, ri ), expected );
+
+      TVT texpected( ci.size() );
+      for( size_t i=0UL; i<ci.size(); ++i )
+         texpected[i] = yA[ci[i]];
+      checkVector( elements( y*A, ci ), texpected );
+   }
+
+   {
+      test_ = "elements() view (vector operations)";
+
+      const VT z( blaze::rand<VT>( 9UL, 0, 9 ) );
+
+      checkVector( elements( x+z, ci ), elements( x, ci ) + elements( z, ci ) );
+      checkVector( elements( 3.0*x, ci ), 3.0*elements( x, ci ) );
+      checkVector( elements( trans( x ), ci ), trans( elements( x, ci ) ) );
+   }
+
+   {
+      test_ = "rows() view (minibatch multiplication)";
+
+      const RMT W( blaze::rand<RMT>( 9UL, 5UL, 0, 9 ) );
+      const RMT X( blaze::rand<RMT>( 300UL, 9UL, 0, 9 ) );
+      const std::vector<size_t> batch( permutation( 300UL ) );
+      const std::vector<size_t> first( batch.begin(), batch.begin()+64UL );
+
+      checkMatrix( rows( X, first ) * W, selectRows( X, first ) * W );
+      checkMatrix( rows( X*W, first ), selectRows( X, first ) * W );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of selection views as target of assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the rows() and columns() views
+// for small and large matrices. The large matrices exceed the SMP thresholds and are therefore
+// assigned in parallel in case shared memory parallelization is enabled. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "rows() view assignment (small)";
+   testRowAssignment< blaze::DynamicMatrix<int,rowMajor>    >( 8UL, 5UL );
+   testRowAssignment< blaze::DynamicMatrix<int,columnMajor> >( 8UL, 5UL );
+   testRowAssignment< blaze::DynamicMatrix<float,rowMajor>    >( 31UL, 17UL );
+   testRowAssignment< blaze::DynamicMatrix<double,columnMajor> >( 31UL, 17UL );
+
+   test_ = "rows() view assignment (large)";
+   testRowAssignment< blaze::DynamicMatrix<float,rowMajor>     >( 300UL, 300UL );
+   testRowAssignment< blaze::DynamicMatrix<double,columnMajor> >( 300UL, 300UL );
+
+   test_ = "columns() view assignment (small)";
+   testColumnAssignment< blaze::DynamicMatrix<int,rowMajor>    >( 5UL, 8UL );
+   testColumnAssignment< blaze::DynamicMatrix<int,columnMajor> >( 5UL, 8UL );
+   testColumnAssignment< blaze::DynamicMatrix<double,rowMajor>   >( 17UL, 31UL );
+   testColumnAssignment< blaze::DynamicMatrix<float,columnMajor> >( 17UL, 31UL );
+
+   test_ = "columns() view assignment (large)";
+   testColumnAssignment< blaze::DynamicMatrix<double,rowMajor>   >( 300UL, 300UL );
+   testColumnAssignment< blaze::DynamicMatrix<float,columnMajor> >( 300UL, 300UL );
+
+   {
+      test_ = "rows() view assignment (sparse matrix)";
+
+      blaze::CompressedMatrix<int> S( 2UL, 4UL );
+      S(0,1) = 5;
+      S(1,3) = 7;
+
+      blaze::DynamicMatrix<int,columnMajor> A( 4UL, 4UL, 1 );
+      rows( A, { 3UL, 1UL } ) = S;
+      rows( A, { 0UL, 2UL } ) += S;
+
+      const blaze::DynamicMatrix<int> expected{ { 1, 6, 1, 1 },
+                                                { 0, 0, 0, 7 },
+                                                { 1, 1, 1, 8 },
+                                                { 0, 5, 0, 0 } };
+      checkMatrix( A, expected );
+   }
+
+   {
+      test_ = "columns() view assignment (sparse matrix)";
+
+      blaze::CompressedMatrix<int,columnMajor> S( 3UL, 2UL );
+      S(2,0) = 4;
+      S(0,1) = 9;
+
+      blaze::DynamicMatrix<int> A( 3UL, 3UL, 2 );
+      columns( A, { 2UL, 0UL } ) -= S;
+
+      const blaze::DynamicMatrix<int> expected{ { -7, 2,  2 },
+                                                {  2, 2,  2 },
+                                                {  2, 2, -2 } };
+      checkMatrix( A, expected );
+   }
+
+   {
+      test_ = "rows() view assignment (row swap)";
+
+      blaze::DynamicMatrix<double> A{ { 1.0, 2.0 },
+                                      { 3.0, 4.0 },
+                                      { 5.0, 6.0 } };
+      rows( A, { 0UL, 2UL } ) = rows( A, { 2UL, 0UL } );
+
+      const blaze::DynamicMatrix<double> expected{ { 5.0, 6.0 },
+                                                   { 3.0, 4.0 },
+                                                   { 1.0, 2.0 } };
+      checkMatrix( A, expected );
+   }
+
+   {
+      test_ = "rows() view assignment (matrix/matrix multiplication)";
+
+      const blaze::DynamicMatrix<double> B( blaze::rand< blaze::DynamicMatrix<double> >( 6UL, 6UL, 0, 9 ) );
+      const blaze::DynamicMatrix<double> C( blaze::rand< blaze::DynamicMatrix<double> >( 3UL, 6UL, 0, 9 ) );
+
+      blaze::DynamicMatrix<double> A( B );
+      rows( A, { 5UL, 2UL, 0UL } ) = C * B;
+
+      blaze::DynamicMatrix<double> expected( B );
+      row( expected, 5UL ) = row( C*B, 0UL );
+      row( expected, 2UL ) = row( C*B, 1UL );
+      row( expected, 0UL ) = row( C*B, 2UL );
+      checkMatrix( A, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the composition of selection views with other views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the combination of the selection views with the row(),
+// column(), and submatrix() views and with nested selections. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testComposition()
+{
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>     RMT;
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>  CMT;
+
+   const std::vector<size_t> ri{ 6UL, 2UL, 5UL, 0UL };
+   const std::vector<size_t> ci{ 1UL, 7UL, 3UL };
+
+   {
+      test_ = "rows() view composition";
+
+      const CMT A( blaze::rand<CMT>( 8UL, 9UL, 0, 9 ) );
+      const RMT R( selectRows( A, ri ) );
+
+      checkVector( row( rows( A, ri ), 1UL ), row( R, 1UL ) );
+      checkVector( column( rows( A, ri ), 4UL ), column( R, 4UL ) );
+      checkMatrix( submatrix( rows( A, ri ), 1UL, 2UL, 3UL, 5UL ), submatrix( R, 1UL, 2UL, 3UL, 5UL ) );
+      checkMatrix( rows( rows( A, ri ), { 3UL, 1UL } ), selectRows( R, { 3UL, 1UL } ) );
+      checkMatrix( columns( rows( A, ri ), ci ), selectColumns( R, ci ) );
+   }
+
+   {
+      test_ = "columns() view composition";
+
+      const RMT A( blaze::rand<RMT>( 9UL, 8UL, 0, 9 ) );
+      const RMT C( selectColumns( A, ci ) );
+
+      checkVector( row( columns( A, ci ), 5UL ), row( C, 5UL ) );
+      checkVector( column( columns( A, ci ), 2UL ), column( C, 2UL ) );
+      checkMatrix( submatrix( columns( A, ci ), 2UL, 1UL, 6UL, 2UL ), submatrix( C, 2UL, 1UL, 6UL, 2UL ) );
+      checkMatrix( columns( columns( A, ci ), { 0UL, 0UL } ), selectColumns( C, { 0UL, 0UL } ) );
+   }
+
+   {
+      test_ = "elements() view composition";
+
+      const blaze::DynamicVector<int> x{ 1, 2, 3, 4, 5, 6 };
+      const blaze::DynamicVector<int> expected{ 6, 2 };
+
+      checkVector( elements( elements( x, { 5UL, 0UL, 1UL } ), { 0UL, 2UL } ), expected );
+      checkVector( subvector( elements( x, { 0UL, 5UL, 1UL } ), 1UL, 2UL ), expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the index checks of the selection views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function verifies that the creation of a selection view with an out-of-bounds index
+// results in a \a std::invalid_argument exception. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExceptions()
+{
+   blaze::DynamicMatrix<double> A( 4UL, 3UL, 0.0 );
+   blaze::DynamicVector<double> x( 5UL, 0.0 );
+
+   {
+      test_ = "rows() view (invalid index)";
+
+      try {
+         auto R = rows( A, { 1UL, 4UL } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of out-of-bounds row selection succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "columns() view (invalid index)";
+
+      try {
+         auto C = columns( A, { 3UL } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of out-of-bounds column selection succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "elements() view (invalid index)";
+
+      try {
+         auto e = elements( x, { 0UL, 5UL } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of out-of-bounds element selection succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << e << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a random permutation of the indices \f$ [0..n) \f$.
+//
+// \param n The number of indices.
+// \return The random permutation.
+*/
+std::vector<size_t> ClassTest::permutation( size_t n ) const
+{
+   std::vector<size_t> indices( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      indices[i] = i;
+   }
+   for( size_t i=n; i>1UL; --i ) {
+      std::swap( indices[i-1UL], indices[blaze::rand<size_t>( 0UL, i-1UL )] );
+   }
+   return indices;
+}
+//*************************************************************************************************
+
+} // namespace selection
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running selection view class test..." << std::endl;
+
+   try
+   {
+      RUN_SELECTION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during selection view class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
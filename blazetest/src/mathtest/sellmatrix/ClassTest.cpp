@@ -0,0 +1,448 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/sellmatrix/ClassTest.cpp
+//  \brief Source file for the SellMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/Views.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/sellmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SellMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAccess();
+   testIterator();
+   testLookup();
+   testMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SellMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix default constructor";
+
+      blaze::SellMatrix<double> S;
+
+      checkRows   ( S, 0UL );
+      checkColumns( S, 0UL );
+      checkMatrix ( S, blaze::CompressedMatrix<double>() );
+   }
+
+
+   //=====================================================================================
+   // Matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix constructor (row-major compressed matrix)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 37UL, 23UL ) );
+      const blaze::SellMatrix<int> S( A );
+
+      checkRows   ( S, 37UL );
+      checkColumns( S, 23UL );
+      checkMatrix ( S, A );
+   }
+
+   {
+      test_ = "SellMatrix constructor (column-major dense matrix)";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> D{ { 1, 0, 2, 0 }
+                                                             , { 0, 0, 0, 0 }
+                                                             , { 3, 4, 5, 6 } };
+      const blaze::SellMatrix<double> S( D, 1UL );
+
+      checkRows   ( S, 3UL );
+      checkColumns( S, 4UL );
+      checkMatrix ( S, D );
+
+      if( S.nonZeros() != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << S.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix constructor (sorting scope)";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( generate<float>( 50UL, 31UL ) );
+      const blaze::SellMatrix<float> S( A, 5UL );
+
+      checkMatrix( S, A );
+
+      if( S.sigma() < 5UL || S.sigma() % S.sliceHeight() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sorting scope detected\n"
+             << " Details:\n"
+             << "   Sorting scope: " << S.sigma() << "\n"
+             << "   Slice height : " << S.sliceHeight() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy constructor";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 19UL, 13UL ) );
+      const blaze::SellMatrix<double> S( A );
+      const blaze::SellMatrix<double> T( S );
+
+      checkRows   ( T, 19UL );
+      checkColumns( T, 13UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "SellMatrix move constructor";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 19UL, 13UL ) );
+      blaze::SellMatrix<double> S( A );
+      const blaze::SellMatrix<double> T( std::move( S ) );
+
+      checkRows   ( S, 0UL );
+      checkRows   ( T, 19UL );
+      checkColumns( T, 13UL );
+      checkMatrix ( T, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SellMatrix copy assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 21UL, 9UL ) );
+      const blaze::SellMatrix<int> S( A );
+      blaze::SellMatrix<int> T( generate<int>( 3UL, 4UL ) );
+
+      T = S;
+
+      checkRows   ( T, 21UL );
+      checkColumns( T, 9UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "SellMatrix move assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( generate<int>( 21UL, 9UL ) );
+      blaze::SellMatrix<int> S( A );
+      blaze::SellMatrix<int> T;
+
+      T = std::move( S );
+
+      checkRows   ( T, 21UL );
+      checkColumns( T, 9UL );
+      checkMatrix ( T, A );
+   }
+
+   {
+      test_ = "SellMatrix matrix assignment";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 }, { 0, 0 } };
+      blaze::SellMatrix<int> T( generate<int>( 7UL, 7UL ) );
+
+      T = D;
+
+      checkRows   ( T, 3UL );
+      checkColumns( T, 2UL );
+      checkMatrix ( T, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// SellMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAccess()
+{
+   {
+      test_ = "SellMatrix::operator()";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 29UL, 17UL ) );
+      const blaze::SellMatrix<double> S( A, 4UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( S(i,j) != A(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << "): " << S(i,j) << "\n"
+                   << "   Expected value: " << A(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SellMatrix::at()";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D{ { 0, 1 }, { 2, 0 } };
+      const blaze::SellMatrix<int> S( D );
+
+      if( S.at(0,1) != 1 || S.at(1,0) != 2 || S.at(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element detected\n"
+             << " Details:\n"
+             << "   Result:\n" << S << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         S.at(2,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix iterators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "SellMatrix iterators";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 16UL, 33UL, 100UL } ) {
+      for( size_t sigma : { 1UL, 8UL, 64UL } ) {
+         testIterator<double>( m, 23UL, sigma );
+         testIterator<float >( m, 23UL, sigma );
+         testIterator<int   >( m, 23UL, sigma );
+         testIterator<cplx  >( m, 23UL, sigma );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() functions of the
+// SellMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testLookup()
+{
+   typedef blaze::SellMatrix<double>::ConstIterator  ConstIterator;
+
+   test_ = "SellMatrix lookup functions";
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( generate<double>( 41UL, 19UL ) );
+   const blaze::SellMatrix<double> S( A, 8UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const ConstIterator pos( S.find( i, j ) );
+         const ConstIterator lb ( S.lowerBound( i, j ) );
+         const ConstIterator ub ( S.upperBound( i, j ) );
+
+         const bool found( A.find( i, j ) != A.end(i) );
+
+         if( ( found  && ( pos == S.end(i) || pos->index() != j || pos->value() != A(i,j) ) ) ||
+             ( !found && pos != S.end(i) ) ||
+             ( lb != S.end(i) && lb->index() < j ) ||
+             ( ub != S.end(i) && ub->index() <= j ) ||
+             ( size_t( lb - S.begin(i) ) != size_t( A.lowerBound( i, j ) - A.begin(i) ) ) ||
+             ( size_t( ub - S.begin(i) ) != size_t( A.upperBound( i, j ) - A.begin(i) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lookup result\n"
+                << " Details:\n"
+                << "   Row   : " << i << "\n"
+                << "   Column: " << j << "\n"
+                << "   Matrix:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMult()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "SellMatrix multiplication";
+
+   for( size_t m : { 0UL, 1UL, 3UL, 8UL, 17UL, 33UL, 130UL } ) {
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         testMult<double>( m, n );
+         testMult<float >( m, n );
+         testMult<int   >( m, n );
+         testMult<cplx  >( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SellMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SellMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
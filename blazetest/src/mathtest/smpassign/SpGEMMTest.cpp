@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smpassign/SpGEMMTest.cpp
+//  \brief Source file for the sparse matrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/smpassign/SpGEMMTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the sparse matrix multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SpGEMMTest::SpGEMMTest()
+   : test_()
+{
+   blaze::setNumThreads( 4UL );
+
+   testHash();
+   testDense();
+   testMixed();
+   testSymbolic();
+   testWorkspace();
+   testEmpty();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the hash accumulator of the sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a very sparse matrix with a very sparse and wide
+// matrix, whose lines are computed by means of the hash accumulator. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SpGEMMTest::testHash()
+{
+   test_ = "Hash accumulator";
+
+   runTest( 200UL, 50UL, 20000UL, Pattern{ 2UL }, Pattern{ 3UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense accumulator of the sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of two sparse matrices, whose lines are computed by
+// means of the dense accumulator. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void SpGEMMTest::testDense()
+{
+   test_ = "Dense accumulator";
+
+   runTest( 200UL, 200UL, 200UL, Pattern{ 20UL }, Pattern{ 20UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the switch between the accumulators within a single multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of two sparse matrices, whose target matrix contains
+// empty lines, lines that are copies of a single line of the inner operand, and lines that are
+// computed by means of the hash accumulator and the dense accumulator. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SpGEMMTest::testMixed()
+{
+   test_ = "Switch between the accumulators";
+
+   runTest( 300UL, 100UL, 5000UL, Pattern{ 0UL, 1UL, 5UL, 60UL }, Pattern{ 20UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symbolic pass of the sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the outer product of a sparse column vector and a sparse row vector,
+// whose number of scalar products exceeds the number of non-zero elements of the operands by
+// far and therefore requires the symbolic pass to determine the number of non-zero elements
+// of the target matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SpGEMMTest::testSymbolic()
+{
+   test_ = "Symbolic pass";
+
+   runTest( 1000UL, 1UL, 1000UL, Pattern{ 1UL }, Pattern{ 1000UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of the workspace of the sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a series of multiplications with alternating lengths of the lines
+// of the target matrix, which reuse the thread-local workspace of the accumulators. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SpGEMMTest::testWorkspace()
+{
+   test_ = "Reuse of the workspace";
+
+   for( size_t length : { 20000UL, 40UL, 5000UL, 40UL, 20000UL } ) {
+      runTest( 100UL, 50UL, length, Pattern{ 0UL, 1UL, 3UL, 40UL }, Pattern{ 4UL } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse matrix multiplication with empty operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of sparse matrices without non-zero elements and of
+// sparse matrices with zero rows or columns. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SpGEMMTest::testEmpty()
+{
+   test_ = "Empty operands";
+
+   runTest( 200UL, 50UL, 300UL, Pattern{ 0UL }, Pattern{ 5UL } );
+   runTest( 200UL, 50UL, 300UL, Pattern{ 5UL }, Pattern{ 0UL } );
+   runTest(   0UL, 50UL, 300UL, Pattern{ 5UL }, Pattern{ 5UL } );
+   runTest( 200UL,  0UL, 300UL, Pattern{ 5UL }, Pattern{ 5UL } );
+   runTest( 200UL, 50UL,   0UL, Pattern{ 5UL }, Pattern{ 5UL } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performing the multiplication of two random sparse matrices.
+//
+// \param lines The number of lines of the target matrix.
+// \param inner The inner dimension of the multiplication.
+// \param length The length of the lines of the target matrix.
+// \param outer The number of non-zero elements per line of the outer operand.
+// \param pattern The number of non-zero elements per line of the inner operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates two random sparse matrices, such that the target matrix has \a lines
+// lines of length \a length, and tests their multiplication for row-major and column-major
+// operands and targets. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SpGEMMTest::runTest( size_t lines, size_t inner, size_t length,
+                          const Pattern& outer, const Pattern& pattern )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   typedef blaze::CompressedMatrix<double,rowMajor>     RowMajorMatrix;
+   typedef blaze::CompressedMatrix<double,columnMajor>  ColumnMajorMatrix;
+
+   {
+      const RowMajorMatrix A( create<rowMajor>( lines, inner, outer ) );
+      const RowMajorMatrix B( create<rowMajor>( inner, length, pattern ) );
+
+      runTest<rowMajor   ,rowMajor>( A, B );
+      runTest<columnMajor,rowMajor>( A, B );
+   }
+
+   {
+      const ColumnMajorMatrix A( create<columnMajor>( length, inner, pattern ) );
+      const ColumnMajorMatrix B( create<columnMajor>( inner, lines, outer ) );
+
+      runTest<columnMajor,columnMajor>( A, B );
+      runTest<rowMajor   ,columnMajor>( A, B );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_SMPASSIGN_SPGEMM_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,385 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smpassign/SparseMatrixTest.cpp
+//  \brief Source file for the SMP sparse matrix assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/smpassign/SparseMatrixTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP sparse matrix assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseMatrixTest::SparseMatrixTest()
+   : test_()
+{
+   blaze::setNumThreads( 4UL );
+
+   testThreads();
+   testAssignment();
+   testReassignment();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the number of threads used for the SMP assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the SMP assignments are performed with more than one thread in
+// case a shared memory parallelization is active. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testThreads()
+{
+   test_ = "Number of threads";
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( blaze::getNumThreads() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Expected number of threads: 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of dense matrices to sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of row-major and column-major dense matrices to
+// row-major and column-major sparse matrices. The sizes of the matrices exceed the SMP
+// threshold and include matrices with fewer rows or columns than partitions. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testAssignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "SMP assignment of dense matrices";
+
+   const size_t sizes[5][3] = { {     3UL, 20000UL,  3000UL }
+                              , { 20000UL,     3UL,  3000UL }
+                              , {   250UL,   230UL,  2875UL }
+                              , {  1000UL,    60UL,     0UL }
+                              , {    60UL,  1000UL, 60000UL } };
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      runAssignmentTest<rowMajor   ,rowMajor   >( sizes[i][0], sizes[i][1], sizes[i][2] );
+      runAssignmentTest<rowMajor   ,columnMajor>( sizes[i][0], sizes[i][1], sizes[i][2] );
+      runAssignmentTest<columnMajor,rowMajor   >( sizes[i][0], sizes[i][1], sizes[i][2] );
+      runAssignmentTest<columnMajor,columnMajor>( sizes[i][0], sizes[i][1], sizes[i][2] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of repeated SMP assignments to the same sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns several dense matrices and dense matrix expressions with different
+// numbers of non-zero elements to the same sparse matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testReassignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Repeated SMP assignments";
+
+   blaze::CompressedMatrix<double,rowMajor> C( 300UL, 200UL );
+
+   for( size_t nonzeros : { 6000UL, 200UL, 30000UL, 0UL, 1500UL } )
+   {
+      blaze::CompressedMatrix<double,rowMajor> S( 300UL, 200UL );
+      randomize( S, nonzeros );
+
+      const blaze::DynamicMatrix<double,rowMajor> D( S );
+      const blaze::DynamicMatrix<double,columnMajor> T( trans( S ) );
+
+      blaze::CompressedMatrix<double,rowMajor> ref( 300UL, 200UL );
+
+      C = D;
+
+      BLAZE_SERIAL_SECTION {
+         ref = D;
+      }
+
+      checkResult( C, ref );
+
+      C = D * 2.0;
+
+      BLAZE_SERIAL_SECTION {
+         ref = D * 2.0;
+      }
+
+      checkResult( C, ref );
+
+      C = trans( T );
+
+      BLAZE_SERIAL_SECTION {
+         ref = trans( T );
+      }
+
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of dense matrix multiplications to sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of dense matrix/dense matrix multiplications and of
+// dense matrix/sparse matrix multiplications to row-major and column-major sparse matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "SMP assignment of dense matrix multiplications";
+
+   const size_t sizes[][4] = { { 120UL, 80UL, 150UL, 1200UL }, { 70UL, 200UL, 90UL, 300UL },
+                               { 100UL, 60UL, 100UL, 0UL } };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(sizes[0]); ++i )
+   {
+      const size_t m( sizes[i][0] );
+      const size_t k( sizes[i][1] );
+      const size_t n( sizes[i][2] );
+      const size_t nonzeros( sizes[i][3] );
+
+      runMultiplicationTest<rowMajor   ,rowMajor   >( m, k, n, nonzeros );
+      runMultiplicationTest<rowMajor   ,columnMajor>( m, k, n, nonzeros );
+      runMultiplicationTest<columnMajor,rowMajor   >( m, k, n, nonzeros );
+      runMultiplicationTest<columnMajor,columnMajor>( m, k, n, nonzeros );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performing the SMP assignment of a random dense matrix to a sparse matrix.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param nonzeros The number of non-zero elements of the dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns a random dense matrix with storage order \a SO2 to a sparse matrix
+// with storage order \a SO1, both via the constructor and via the assignment operator to a
+// sparse matrix that already contains elements. The results are compared to the result of
+// a serial assignment. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO1    // Storage order of the sparse matrix
+        , bool SO2 >  // Storage order of the dense matrix
+void SparseMatrixTest::runAssignmentTest( size_t m, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<double,SO2> S( m, n );
+   randomize( S, nonzeros );
+
+   const blaze::DynamicMatrix<double,SO2> D( S );
+
+   blaze::CompressedMatrix<double,SO1> ref( m, n );
+
+   BLAZE_SERIAL_SECTION {
+      ref = D;
+   }
+
+   {
+      const blaze::CompressedMatrix<double,SO1> C( D );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,SO1> C( m, n );
+      randomize( C, blaze::min( nonzeros/2UL + 10UL, m*n ) );
+
+      C = D;
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performing the SMP assignment of dense matrix multiplications to a sparse matrix.
+//
+// \param m The number of rows of the left-hand side operand.
+// \param k The number of columns of the left-hand side operand.
+// \param n The number of columns of the right-hand side operand.
+// \param nonzeros The number of non-zero elements of the sparse right-hand side operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns the product of a random \a m-by-\a k dense matrix with storage order
+// \a SO2 and a random \a k-by-\a n dense matrix or sparse matrix with storage order \a SO2 to
+// a sparse matrix with storage order \a SO1, both via the constructor and via the assignment
+// operator. The results are compared to the result of a serial assignment. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the sparse target matrix
+        , bool SO2 >  // Storage order of the operands
+void SparseMatrixTest::runMultiplicationTest( size_t m, size_t k, size_t n, size_t nonzeros )
+{
+   blaze::DynamicMatrix<double,SO2> A( m, k );
+   blaze::DynamicMatrix<double,SO2> B( k, n );
+   blaze::CompressedMatrix<double,SO2> S( k, n );
+
+   randomize( A );
+   randomize( B );
+   randomize( S, nonzeros );
+
+   blaze::CompressedMatrix<double,SO1> ref( m, n );
+
+   // Dense matrix/dense matrix multiplication
+   BLAZE_SERIAL_SECTION {
+      ref = A * B;
+   }
+
+   {
+      const blaze::CompressedMatrix<double,SO1> C( A * B );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,SO1> C( m, n );
+      randomize( C, blaze::min( nonzeros + 10UL, m*n ) );
+
+      C = A * B;
+      checkResult( C, ref );
+   }
+
+   // Dense matrix/sparse matrix multiplication
+   BLAZE_SERIAL_SECTION {
+      ref = A * S;
+   }
+
+   {
+      const blaze::CompressedMatrix<double,SO1> C( A * S );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,SO1> C( m, n );
+      randomize( C, blaze::min( nonzeros + 10UL, m*n ) );
+
+      C = A * S;
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP sparse matrix assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMPASSIGN_SPARSEMATRIX_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP sparse matrix assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smpassign/SparseVectorTest.cpp
+//  \brief Source file for the SMP sparse vector assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/smpassign/SparseVectorTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP sparse vector assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseVectorTest::SparseVectorTest()
+   : test_()
+{
+   blaze::setNumThreads( 4UL );
+
+   testThreads();
+   testAssignment();
+   testComputation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the number of threads used for the SMP assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the SMP assignments are performed with more than one thread in
+// case a shared memory parallelization is active. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseVectorTest::testThreads()
+{
+   test_ = "Number of threads";
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( blaze::getNumThreads() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Expected number of threads: 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of dense vectors to sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of dense column and row vectors to sparse vectors of
+// the same kind for several sizes and numbers of non-zero elements. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseVectorTest::testAssignment()
+{
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   test_ = "SMP assignment of dense vectors";
+
+   const size_t sizes[][2] = { { 50000UL, 0UL }, { 50000UL, 1UL }, { 40000UL, 37UL },
+                               { 60000UL, 6000UL }, { 80000UL, 80000UL } };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(sizes[0]); ++i ) {
+      runAssignmentTest<columnVector>( sizes[i][0], sizes[i][1] );
+      runAssignmentTest<rowVector   >( sizes[i][0], sizes[i][1] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of dense vector computations to sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns dense vector/scalar multiplications and dense matrix/dense vector
+// multiplications to the same sparse vector. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseVectorTest::testComputation()
+{
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   test_ = "SMP assignment of dense vector computations";
+
+   blaze::CompressedVector<double,columnVector> c( 60000UL );
+
+   for( size_t nonzeros : { 6000UL, 0UL, 60000UL, 12UL } )
+   {
+      blaze::CompressedVector<double,columnVector> s( 60000UL );
+      randomize( s, nonzeros );
+
+      const blaze::DynamicVector<double,columnVector> d( s );
+
+      blaze::CompressedVector<double,columnVector> ref( 60000UL );
+
+      c = d * 2.0;
+
+      BLAZE_SERIAL_SECTION {
+         ref = d * 2.0;
+      }
+
+      checkResult( c, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> A( 2000UL, 50UL );
+      blaze::DynamicVector<double,columnVector> x( 50UL );
+
+      randomize( A );
+      randomize( x );
+
+      for( size_t i=0UL; i<A.rows(); i+=3UL ) {
+         for( size_t j=0UL; j<A.columns(); ++j )
+            A(i,j) = 0.0;
+      }
+
+      blaze::CompressedVector<double,columnVector> ref( 2000UL );
+
+      BLAZE_SERIAL_SECTION {
+         ref = A * x;
+      }
+
+      c = A * x;
+      checkResult( c, ref );
+
+      const blaze::CompressedVector<double,columnVector> c2( A * x );
+      checkResult( c2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performing the SMP assignment of a random dense vector to a sparse vector.
+//
+// \param n The size of the vectors.
+// \param nonzeros The number of non-zero elements of the dense vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns a random dense vector with transpose flag \a TF to a sparse vector,
+// both via the constructor and via the assignment operator to a sparse vector that already
+// contains elements. The results are compared to the result of a serial assignment. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool TF >  // Transpose flag of the vectors
+void SparseVectorTest::runAssignmentTest( size_t n, size_t nonzeros )
+{
+   blaze::CompressedVector<double,TF> s( n );
+   randomize( s, nonzeros );
+
+   const blaze::DynamicVector<double,TF> d( s );
+
+   blaze::CompressedVector<double,TF> ref( n );
+
+   BLAZE_SERIAL_SECTION {
+      ref = d;
+   }
+
+   {
+      const blaze::CompressedVector<double,TF> c( d );
+      checkResult( c, ref );
+   }
+
+   {
+      blaze::CompressedVector<double,TF> c( n );
+      randomize( c, blaze::min( nonzeros/2UL + 10UL, n ) );
+
+      c = d;
+      checkResult( c, ref );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP sparse vector assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMPASSIGN_SPARSEVECTOR_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP sparse vector assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
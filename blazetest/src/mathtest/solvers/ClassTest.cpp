@@ -0,0 +1,852 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/solvers/ClassTest.cpp
+//  \brief Source file for the iterative solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/solvers/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the iterative solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testControl();
+   testKernels();
+   testSubstitution();
+   testFactorizations();
+   testPreconditioners();
+   testCG();
+   testBiCGSTAB();
+   testGMRES();
+   testMPIR();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SolverControl class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup and the validation of the solver settings. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testControl()
+{
+   test_ = "SolverControl constructor";
+
+   {
+      const blaze::SolverControl control( 100UL, 1E-6, 20UL );
+
+      if( control.maxIterations() != 100UL || control.tolerance() != 1E-6 ||
+          control.restart() != 20UL || control.iterations() != 0UL || control.converged() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solver settings\n"
+             << " Details:\n"
+             << "   Maximum iterations: " << control.maxIterations() << "\n"
+             << "   Tolerance         : " << control.tolerance() << "\n"
+             << "   Restart           : " << control.restart() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      const blaze::SolverControl control( 100UL, -1.0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Negative tolerance succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const blaze::SolverControl control( 100UL, 1E-6, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Zero restart parameter succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused solver kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused solver kernels for sparse and dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testKernels()
+{
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "Fused kernels (row-major sparse matrix)";
+   testKernels( convection<double>( 37UL ) );
+   testKernels( convection<cplx>( 23UL ) );
+
+   test_ = "Fused kernels (column-major sparse matrix)";
+   testKernels( blaze::CompressedMatrix<double,blaze::columnMajor>( convection<double>( 37UL ) ) );
+
+   test_ = "Fused kernels (row-major dense matrix)";
+   testKernels( blaze::DynamicMatrix<double,blaze::rowMajor>( convection<double>( 17UL ) ) );
+   testKernels( blaze::DynamicMatrix<cplx,blaze::rowMajor>( convection<cplx>( 11UL ) ) );
+
+   test_ = "Fused kernels (column-major dense matrix)";
+   testKernels( blaze::DynamicMatrix<double,blaze::columnMajor>( convection<double>( 17UL ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the level schedules and the sparse triangular substitutions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the level set analysis of sparse triangular matrices and the serial and
+// level-scheduled substitutions with lower, unilower, upper and uniupper matrices of both
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubstitution()
+{
+   typedef blaze::complex<double>                            cplx;
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>     RowMT;
+   typedef blaze::CompressedMatrix<double,blaze::columnMajor>  ColMT;
+
+   {
+      test_ = "LevelSchedule (2D Poisson matrix)";
+
+      const size_t m( 7UL );
+      const RowMT A( poisson<double>( m ) );
+
+      const blaze::LevelSchedule lower( A, 'L' );
+      const blaze::LevelSchedule upper( ColMT( A ), 'U' );
+
+      if( lower.size() != m*m || lower.levels() != 2UL*m-1UL || lower.uplo() != 'L' ||
+          upper.size() != m*m || upper.levels() != 2UL*m-1UL || upper.uplo() != 'U' ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid level schedule\n"
+             << " Details:\n"
+             << "   Number of lower levels   : " << lower.levels() << "\n"
+             << "   Number of upper levels   : " << upper.levels() << "\n"
+             << "   Expected number of levels: " << 2UL*m-1UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<lower.levels(); ++l )
+      {
+         size_t work( 0UL );
+
+         for( auto row=lower.begin(l); row!=lower.end(l); ++row ) {
+            work += A.nonZeros( *row );
+            if( *row/m + *row%m != l ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid level of row " << *row << "\n"
+                   << " Details:\n"
+                   << "   Level         : " << l << "\n"
+                   << "   Expected level: " << *row/m + *row%m << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( auto row=upper.begin(l); row!=upper.end(l); ++row ) {
+            if( 2UL*m-2UL - *row/m - *row%m != l ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid level of row " << *row << "\n"
+                   << " Details:\n"
+                   << "   Level         : " << l << "\n"
+                   << "   Expected level: " << 2UL*m-2UL - *row/m - *row%m << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         checkValue( lower.work(l), work );
+      }
+   }
+
+   {
+      test_ = "LevelSchedule (invalid arguments)";
+
+      try {
+         const blaze::LevelSchedule schedule( RowMT( 3UL, 4UL ), 'L' );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const blaze::LevelSchedule schedule( RowMT( 3UL, 3UL ), 'X' );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis with invalid uplo argument succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      const size_t n( 2000UL );
+
+      blaze::LowerMatrix<RowMT>    L ( n );
+      blaze::UniLowerMatrix<RowMT> UL( n );
+      blaze::UpperMatrix<RowMT>    U ( n );
+      blaze::UniUpperMatrix<RowMT> UU( n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         L(i,i) = blaze::rand<double>( 2.0, 4.0 );
+         U(i,i) = blaze::rand<double>( 2.0, 4.0 );
+         for( size_t k=0UL; k<3UL && i>0UL; ++k ) {
+            const size_t j( blaze::rand<size_t>( 0UL, i-1UL ) );
+            L (i,j) = blaze::rand<double>( -1.0, 1.0 );
+            UL(i,j) = blaze::rand<double>( -1.0, 1.0 );
+            U (j,i) = blaze::rand<double>( -1.0, 1.0 );
+            UU(j,i) = blaze::rand<double>( -1.0, 1.0 );
+         }
+      }
+
+      test_ = "solve() (row-major lower matrix)";
+      testSubstitution( L, 'L' );
+
+      test_ = "solve() (column-major lower matrix)";
+      testSubstitution( blaze::LowerMatrix<ColMT>( L ), 'L' );
+
+      test_ = "solve() (row-major unilower matrix)";
+      testSubstitution( UL, 'L' );
+
+      test_ = "solve() (column-major unilower matrix)";
+      testSubstitution( blaze::UniLowerMatrix<ColMT>( UL ), 'L' );
+
+      test_ = "solve() (row-major upper matrix)";
+      testSubstitution( U, 'U' );
+
+      test_ = "solve() (column-major upper matrix)";
+      testSubstitution( blaze::UpperMatrix<ColMT>( U ), 'U' );
+
+      test_ = "solve() (row-major uniupper matrix)";
+      testSubstitution( UU, 'U' );
+
+      test_ = "solve() (column-major uniupper matrix)";
+      testSubstitution( blaze::UniUpperMatrix<ColMT>( UU ), 'U' );
+
+      test_ = "solve() (invalid level schedule)";
+
+      try {
+         blaze::DynamicVector<double,blaze::columnVector> x( n, 1.0 );
+         solve( L, x, x, blaze::LevelSchedule( U, 'U' ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Substitution with invalid level schedule succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "solve() (complex lower matrix)";
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<cplx,blaze::rowMajor> > L( 100UL );
+      for( size_t i=0UL; i<100UL; ++i ) {
+         L(i,i) = cplx( 4.0, 1.0 );
+         if( i >= 3UL ) L(i,i-3UL) = cplx( 1.0, -1.0 );
+         if( i >= 7UL ) L(i,i-7UL) = cplx( -0.5, 2.0 );
+      }
+
+      testSubstitution( L, 'L' );
+   }
+
+   {
+      test_ = "solve() (singular matrix)";
+
+      blaze::LowerMatrix<RowMT> L( 3UL );
+      L(0,0) = 1.0;
+      L(2,1) = 1.0;
+      L(2,2) = 1.0;
+
+      try {
+         blaze::DynamicVector<double,blaze::columnVector> x;
+         solve( L, x, blaze::DynamicVector<double,blaze::columnVector>( 3UL, 1.0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the incomplete factorizations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ILU(0) and IC(0) factorizations by checking the product of the
+// factors at all non-zero positions of the factorized matrix. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFactorizations()
+{
+   typedef blaze::complex<double>                           cplx;
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  RowMT;
+
+   {
+      test_ = "ilu0() (row-major factors)";
+
+      const RowMT A( convection<double>( 12UL ) );
+
+      blaze::UniLowerMatrix<RowMT> L;
+      blaze::UpperMatrix<RowMT> U;
+
+      ilu0( A, L, U );
+
+      checkFactorization( A, blaze::DynamicMatrix<double,blaze::rowMajor>( L * U ) );
+   }
+
+   {
+      test_ = "ilu0() (column-major factors)";
+
+      const blaze::CompressedMatrix<cplx,blaze::rowMajor> A( convection<cplx>( 9UL ) );
+
+      blaze::UniLowerMatrix< blaze::CompressedMatrix<cplx,blaze::columnMajor> > L;
+      blaze::UpperMatrix< blaze::CompressedMatrix<cplx,blaze::columnMajor> > U;
+
+      ilu0( blaze::CompressedMatrix<cplx,blaze::columnMajor>( A ), L, U );
+
+      checkFactorization( A, blaze::DynamicMatrix<cplx,blaze::rowMajor>( L * U ) );
+   }
+
+   {
+      test_ = "ilu0() (invalid matrices)";
+
+      blaze::UniLowerMatrix<RowMT> L;
+      blaze::UpperMatrix<RowMT> U;
+
+      try {
+         ilu0( RowMT( 3UL, 4UL ), L, U );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      RowMT A( 3UL, 3UL );
+      A(0,0) = 1.0;
+      A(1,2) = 1.0;
+      A(2,2) = 1.0;
+
+      try {
+         ilu0( A, L, U );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization with missing diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ic0() (row-major factor)";
+
+      const RowMT A( poisson<double>( 12UL ) );
+
+      blaze::LowerMatrix<RowMT> L;
+
+      ic0( A, L );
+
+      checkFactorization( A, blaze::DynamicMatrix<double,blaze::rowMajor>( L * trans( L ) ) );
+   }
+
+   {
+      test_ = "ic0() (column-major factor)";
+
+      blaze::CompressedMatrix<cplx,blaze::rowMajor> A( 60UL, 60UL );
+      for( size_t i=0UL; i<60UL; ++i ) {
+         A(i,i) = cplx( 6.0, 0.0 );
+         if( i >= 5UL ) {
+            A(i,i-5UL) = cplx( 1.0, 2.0 );
+            A(i-5UL,i) = cplx( 1.0, -2.0 );
+         }
+      }
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<cplx,blaze::columnMajor> > L;
+
+      ic0( A, L );
+
+      checkFactorization( A, blaze::DynamicMatrix<cplx,blaze::rowMajor>( L * ctrans( L ) ) );
+   }
+
+   {
+      test_ = "ic0() (indefinite matrix)";
+
+      RowMT A( 2UL, 2UL );
+      A(0,0) = 1.0;
+      A(0,1) = 2.0;
+      A(1,0) = 2.0;
+      A(1,1) = 1.0;
+
+      blaze::LowerMatrix<RowMT> L;
+
+      try {
+         ic0( A, L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Jacobi, the block Jacobi, the ILU(0) and the IC(0) preconditioners by
+// means of matrices for which the preconditioners are exact. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPreconditioners()
+{
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   VT x( 50UL ), z( 50UL );
+   randomize( x );
+
+   {
+      test_ = "JacobiPreconditioner (diagonal matrix)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> D( 50UL, 50UL );
+      for( size_t i=0UL; i<50UL; ++i ) {
+         D(i,i) = double( i+1UL );
+      }
+
+      const blaze::JacobiPreconditioner<double> M( D );
+      M.apply( z, D * x );
+
+      checkVector( z, x );
+   }
+
+   {
+      test_ = "BlockJacobiPreconditioner (block diagonal matrix)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> B( 50UL, 50UL, 0.0 );
+      for( size_t i=0UL; i<50UL; i+=7UL ) {
+         const size_t m( blaze::min( 7UL, 50UL-i ) );
+         for( size_t j=0UL; j<m; ++j ) {
+            for( size_t k=0UL; k<m; ++k ) {
+               B(i+j,i+k) = blaze::rand<double>( -1.0, 1.0 );
+            }
+            B(i+j,i+j) += 10.0;
+         }
+      }
+
+      const blaze::BlockJacobiPreconditioner<double> M( B, 7UL );
+      M.apply( z, B * x );
+
+      checkVector( z, x );
+   }
+
+   {
+      test_ = "ILU0Preconditioner (tridiagonal matrix)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> T( 50UL, 50UL, 148UL );
+      for( size_t i=0UL; i<50UL; ++i ) {
+         if( i > 0UL   ) T.append( i, i-1UL, -1.0 );
+         T.append( i, i, 3.0 );
+         if( i < 49UL  ) T.append( i, i+1UL, -2.0 );
+         T.finalize( i );
+      }
+
+      const blaze::ILU0Preconditioner<double> M( T );
+      M.apply( z, T * x );
+
+      checkVector( z, x );
+   }
+
+   {
+      test_ = "IC0Preconditioner (tridiagonal matrix)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> T( 50UL, 50UL, 148UL );
+      for( size_t i=0UL; i<50UL; ++i ) {
+         if( i > 0UL   ) T.append( i, i-1UL, -1.0 );
+         T.append( i, i, 3.0 );
+         if( i < 49UL  ) T.append( i, i+1UL, -1.0 );
+         T.finalize( i );
+      }
+
+      const blaze::IC0Preconditioner<double> M( T );
+      M.apply( z, T * x );
+
+      checkVector( z, x );
+   }
+
+   {
+      test_ = "ILU0Preconditioner (missing diagonal element)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,0) = 1.0;
+      A(1,2) = 1.0;
+      A(2,2) = 1.0;
+
+      try {
+         const blaze::ILU0Preconditioner<double> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with missing diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CG method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the CG method with all preconditioners. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCG()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( poisson<double>( 30UL ) );
+
+   test_ = "CG (no preconditioner)";
+   testCG( A, blaze::IdentityPreconditioner() );
+
+   test_ = "CG (Jacobi preconditioner)";
+   testCG( A, blaze::JacobiPreconditioner<double>( A ) );
+
+   test_ = "CG (block Jacobi preconditioner)";
+   testCG( A, blaze::BlockJacobiPreconditioner<double>( A, 30UL ) );
+
+   test_ = "CG (ILU(0) preconditioner)";
+   testCG( A, blaze::ILU0Preconditioner<double>( A ) );
+
+   test_ = "CG (IC(0) preconditioner)";
+   testCG( A, blaze::IC0Preconditioner<double>( A ) );
+
+   test_ = "CG (dense matrix)";
+   testCG( blaze::DynamicMatrix<double,blaze::columnMajor>( poisson<double>( 12UL ) ),
+           blaze::IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the BiCGSTAB method with all preconditioners. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBiCGSTAB()
+{
+   typedef blaze::complex<double>  cplx;
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 30UL ) );
+
+   test_ = "BiCGSTAB (no preconditioner)";
+   testBiCGSTAB( A, blaze::IdentityPreconditioner() );
+
+   test_ = "BiCGSTAB (Jacobi preconditioner)";
+   testBiCGSTAB( A, blaze::JacobiPreconditioner<double>( A ) );
+
+   test_ = "BiCGSTAB (block Jacobi preconditioner)";
+   testBiCGSTAB( A, blaze::BlockJacobiPreconditioner<double>( A, 30UL ) );
+
+   test_ = "BiCGSTAB (ILU(0) preconditioner)";
+   testBiCGSTAB( A, blaze::ILU0Preconditioner<double>( A ) );
+
+   test_ = "BiCGSTAB (complex matrix)";
+   const blaze::CompressedMatrix<cplx,blaze::rowMajor> C( convection<cplx>( 20UL ) );
+   testBiCGSTAB( C, blaze::ILU0Preconditioner<cplx>( C ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the GMRES method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the GMRES method with all preconditioners and different restart
+// parameters. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGMRES()
+{
+   typedef blaze::complex<double>  cplx;
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 30UL ) );
+
+   test_ = "GMRES (no preconditioner)";
+   testGMRES( A, blaze::IdentityPreconditioner(), 30UL );
+   testGMRES( A, blaze::IdentityPreconditioner(), 5UL );
+
+   test_ = "GMRES (Jacobi preconditioner)";
+   testGMRES( A, blaze::JacobiPreconditioner<double>( A ), 30UL );
+
+   test_ = "GMRES (block Jacobi preconditioner)";
+   testGMRES( A, blaze::BlockJacobiPreconditioner<double>( A, 30UL ), 30UL );
+
+   test_ = "GMRES (ILU(0) preconditioner)";
+   testGMRES( A, blaze::ILU0Preconditioner<double>( A ), 30UL );
+
+   test_ = "GMRES (complex matrix)";
+   const blaze::CompressedMatrix<cplx,blaze::rowMajor> C( convection<cplx>( 20UL ) );
+   testGMRES( C, blaze::JacobiPreconditioner<cplx>( C ), 20UL );
+
+   test_ = "GMRES (small dense matrix)";
+   testGMRES( blaze::DynamicMatrix<double,blaze::rowMajor>( convection<double>( 3UL ) ),
+              blaze::IdentityPreconditioner(), 30UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision iterative refinement.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the mixed-precision iterative refinement for row-major and column-major
+// dense matrices, the fallback to a double precision LU decomposition and the handling of
+// invalid systems. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMPIR()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   typedef blaze::complex<double>  cplx;
+
+   test_ = "MPIR (row-major dense matrix)";
+   testMPIR( blaze::DynamicMatrix<double,blaze::rowMajor>( convection<double>( 9UL ) ) );
+   testMPIR( blaze::DynamicMatrix<double,blaze::rowMajor>( poisson<double>( 10UL ) ) );
+
+   test_ = "MPIR (column-major dense matrix)";
+   testMPIR( blaze::DynamicMatrix<double,blaze::columnMajor>( convection<double>( 9UL ) ) );
+   testMPIR( blaze::DynamicMatrix<double,blaze::columnMajor>( poisson<double>( 10UL ) ) );
+
+   test_ = "MPIR (complex matrix)";
+   testMPIR( blaze::DynamicMatrix<cplx,blaze::rowMajor>( convection<cplx>( 7UL ) ) );
+   testMPIR( blaze::DynamicMatrix<cplx,blaze::columnMajor>( convection<cplx>( 7UL ) ) );
+
+   test_ = "MPIR (zero right-hand side)";
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( poisson<double>( 3UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( 9UL, 0.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 9UL, 1.0 );
+
+      blaze::SolverControl control;
+
+      if( !blaze::mpir( A, x, b, control ) || control.iterations() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution process failed\n"
+             << " Details:\n"
+             << "   Number of iterations: " << control.iterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkVector( x, b );
+   }
+
+   test_ = "MPIR (double precision fallback)";
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A{ { 1E100, 0.0, 0.0 },
+                                                             { 0.0  , 2.0, 1.0 },
+                                                             { 0.0  , 1.0, 3.0 } };
+      const blaze::DynamicVector<double,blaze::columnVector> b{ 1E100, 3.0, 4.0 };
+      blaze::DynamicVector<double,blaze::columnVector> x( 3UL );
+
+      blaze::SolverControl control( 30UL, 1E-14 );
+      const bool converged( blaze::mpir( A, x, b, control ) );
+
+      if( !converged || !control.converged() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution process failed\n"
+             << " Details:\n"
+             << "   Reported relative residual: " << control.residual() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValue( x[0], 1.0 );
+      checkValue( x[1], 1.0 );
+      checkValue( x[2], 1.0 );
+   }
+
+   test_ = "MPIR (singular matrix)";
+   try {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A{ { 1.0, 2.0 }, { 2.0, 4.0 } };
+      const blaze::DynamicVector<double,blaze::columnVector> b{ 1.0, 1.0 };
+      blaze::DynamicVector<double,blaze::columnVector> x( 2UL );
+
+      blaze::SolverControl control;
+      blaze::mpir( A, x, b, control );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving a singular system succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   test_ = "MPIR (invalid vector size)";
+   try {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( poisson<double>( 3UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( 8UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 9UL );
+
+      blaze::SolverControl control;
+      blaze::mpir( A, x, b, control );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving a system with invalid vector sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running iterative solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during iterative solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,486 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/arena/ClassTest.cpp
+//  \brief Source file for the Arena class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Memory.h>
+#include <blazetest/utiltest/arena/ClassTest.h>
+#include <blazetest/utiltest/Resource.h>
+#include <blazetest/utiltest/ThrowingResource.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace arena {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Arena class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocate();
+   testChunks();
+   testShrink();
+   testArenaArray();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation and release of memory.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocate() and release() functions of the Arena class.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocate()
+{
+   test_ = "Allocation and release of memory";
+
+   blaze::Arena arena;
+
+   checkSize    ( arena, 0UL );
+   checkCapacity( arena, 0UL );
+
+   blaze::byte_t* a = arena.allocate( 100UL );
+   checkAlignment( a );
+   checkSize     ( arena, 100UL );
+   checkCapacity ( arena, blaze::Arena::chunksize );
+
+   blaze::byte_t* b = arena.allocate( 1UL );
+   checkAlignment( b );
+   checkSize     ( arena, 129UL );
+
+   blaze::byte_t* c = arena.allocate( 0UL );
+   checkAlignment( c );
+   checkSize     ( arena, 192UL );
+
+   arena.release( c );
+   arena.release( b );
+   checkSize( arena, 128UL );
+
+   blaze::byte_t* d = arena.allocate( 64UL );
+
+   if( d != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Released memory is not reused\n"
+          << " Details:\n"
+          << "   Result:\n" << static_cast<void*>( d ) << "\n"
+          << "   Expected result:\n" << static_cast<void*>( b ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   arena.release( d );
+   arena.release( a );
+
+   checkSize    ( arena, 0UL );
+   checkCapacity( arena, blaze::Arena::chunksize );
+
+   if( !arena.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty arena detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of multiple memory chunks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of allocations that exceed the size of a single memory chunk.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testChunks()
+{
+   test_ = "Handling of multiple memory chunks";
+
+   const size_t chunksize( blaze::Arena::chunksize );
+
+   blaze::Arena arena;
+
+   // Filling the first chunk and overflowing into a second chunk
+   {
+      blaze::byte_t* a = arena.allocate( chunksize - 64UL );
+      blaze::byte_t* b = arena.allocate( 128UL );
+      checkAlignment( b );
+      checkSize     ( arena, chunksize + 64UL );
+      checkCapacity ( arena, 2UL*chunksize );
+
+      arena.release( b );
+      checkSize( arena, chunksize - 64UL );
+
+      blaze::byte_t* c = arena.allocate( 128UL );
+
+      if( c != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory chunk is not reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      arena.release( c );
+      arena.release( a );
+      checkSize( arena, 0UL );
+   }
+
+   // Allocating a block larger than the chunk size
+   {
+      blaze::byte_t* a = arena.allocate( 64UL );
+      blaze::byte_t* b = arena.allocate( 3UL*chunksize );
+      checkAlignment( b );
+      checkSize     ( arena, 3UL*chunksize + 64UL );
+      checkCapacity ( arena, 4UL*chunksize );
+
+      for( size_t i=0UL; i<3UL*chunksize; ++i ) {
+         b[i] = blaze::byte_t( i );
+      }
+
+      arena.release( b );
+      arena.release( a );
+   }
+
+   // Reusing all memory chunks without further allocation
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      blaze::byte_t* a = arena.allocate( chunksize );
+      blaze::byte_t* b = arena.allocate( 2UL*chunksize );
+      checkCapacity( arena, 4UL*chunksize );
+      arena.release( b );
+      arena.release( a );
+   }
+
+   if( !arena.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty arena detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the shrink() function of the Arena class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the shrink() function of the Arena class. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testShrink()
+{
+   test_ = "Arena::shrink()";
+
+   const size_t chunksize( blaze::Arena::chunksize );
+
+   blaze::Arena arena;
+
+   blaze::byte_t* a = arena.allocate( chunksize );
+   blaze::byte_t* b = arena.allocate( chunksize );
+   arena.release( b );
+   checkCapacity( arena, 2UL*chunksize );
+
+   arena.shrink();
+   checkSize    ( arena, chunksize );
+   checkCapacity( arena, chunksize );
+
+   arena.release( a );
+   arena.shrink();
+   checkSize    ( arena, 0UL );
+   checkCapacity( arena, 0UL );
+
+   blaze::byte_t* c = arena.allocate( 16UL );
+   checkAlignment( c );
+   checkCapacity ( arena, chunksize );
+   arena.release( c );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ArenaArray class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ArenaArray class template. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArenaArray()
+{
+   test_ = "ArenaArray";
+
+   blaze::Arena arena;
+
+   // Arrays of built-in data types
+   {
+      blaze::ArenaArray<double> a( 5UL, arena );
+      blaze::ArenaArray<int>    b( 3UL, arena );
+
+      checkAlignment( a.data() );
+      checkAlignment( b.data() );
+      checkCount( a.size(), 5UL );
+      checkCount( b.size(), 3UL );
+      checkSize ( arena, 64UL + 12UL );
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = double( i );
+      }
+
+      double sum( 0.0 );
+      for( double value : a ) {
+         sum += value;
+      }
+
+      if( sum != 10.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << sum << "\n"
+             << "   Expected result:\n" << 10.0 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkSize( arena, 0UL );
+
+   // Arrays of class types
+   {
+      blaze::ArenaArray<Resource> a( 5UL, arena );
+      checkCount( Resource::getCount(), 5UL );
+
+      {
+         blaze::ArenaArray<Resource> b( 7UL, arena );
+         checkCount( Resource::getCount(), 12UL );
+      }
+
+      checkCount( Resource::getCount(), 5UL );
+   }
+
+   checkCount( Resource::getCount(), 0UL );
+   checkSize ( arena, 0UL );
+
+   // Exception during the construction of the array elements
+   try {
+      blaze::ArenaArray<ThrowingResource> a( 10UL, arena );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Missing exception during construction\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ) {}
+
+   checkCount( ThrowingResource::getCount(), 0UL );
+   checkSize ( arena, 0UL );
+
+   // Array taken from the arena of the calling thread
+   {
+      blaze::Arena& local( blaze::Arena::local() );
+      const size_t size( local.size() );
+
+      blaze::ArenaArray<float> a( 100UL );
+      checkAlignment( a.data() );
+      checkSize( local, size + 400UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the alignment of the given address.
+//
+// \param address The address to be checked.
+// \return void
+// \exception std::runtime_error Alignment error detected.
+*/
+void ClassTest::checkAlignment( const void* address ) const
+{
+   if( reinterpret_cast<size_t>( address ) % blaze::Arena::alignment != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n"
+          << " Details:\n"
+          << "   Address: " << address << "\n"
+          << "   Expected alignment: " << blaze::Arena::alignment << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of bytes in use of the given arena.
+//
+// \param arena The arena to be checked.
+// \param expected The expected number of bytes in use.
+// \return void
+// \exception std::runtime_error Size error detected.
+*/
+void ClassTest::checkSize( const blaze::Arena& arena, size_t expected ) const
+{
+   if( arena.size() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid arena size detected\n"
+          << " Details:\n"
+          << "   Result:\n" << arena.size() << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given arena.
+//
+// \param arena The arena to be checked.
+// \param expected The expected capacity.
+// \return void
+// \exception std::runtime_error Capacity error detected.
+*/
+void ClassTest::checkCapacity( const blaze::Arena& arena, size_t expected ) const
+{
+   if( arena.capacity() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid arena capacity detected\n"
+          << " Details:\n"
+          << "   Result:\n" << arena.capacity() << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param count The count to be checked.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Count error detected.
+*/
+void ClassTest::checkCount( size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid count detected\n"
+          << " Details:\n"
+          << "   Result:\n" << count << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace arena
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Arena class test..." << std::endl;
+
+   try
+   {
+      RUN_ARENA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Arena class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,390 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSchedule();
+   testResize();
+   testTaskGroup();
+   testNestedTaskGroups();
+   testAffinity();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the schedule() and wait() functions of the ThreadPool class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "Scheduling of tasks";
+
+   ThreadPool pool( 4UL );
+   std::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      pool.schedule( [&count]() { ++count; } );
+   }
+   pool.wait();
+
+   checkCount( count, 1000UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( []( std::atomic<size_t>& c, size_t value ) { c += value; }, std::ref( count ), 2UL );
+   }
+   pool.wait();
+
+   checkCount( count, 1200UL );
+
+   if( !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty thread pool detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resizing of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() function of the ThreadPool class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "Resizing of the thread pool";
+
+   ThreadPool pool( 2UL );
+   std::atomic<size_t> count( 0UL );
+
+   const size_t sizes[] = { 5UL, 1UL, 3UL, 8UL, 2UL };
+
+   for( size_t n : sizes )
+   {
+      pool.resize( n, true );
+
+      if( pool.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread pool size detected\n"
+             << " Details:\n"
+             << "   Result:\n" << pool.size() << "\n"
+             << "   Expected result:\n" << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( [&count]() { ++count; } );
+      }
+      pool.wait();
+   }
+
+   checkCount( count, 500UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks as part of task groups.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scheduling of tasks as part of a task group. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTaskGroup()
+{
+   test_ = "Scheduling of tasks within task groups";
+
+   ThreadPool pool( 4UL );
+   std::atomic<size_t> count1( 0UL );
+   std::atomic<size_t> count2( 0UL );
+
+   TaskGroup group1;
+   TaskGroup group2;
+
+   for( size_t i=0UL; i<500UL; ++i ) {
+      pool.schedule( group1, [&count1]() { ++count1; } );
+      pool.schedule( group2, [&count2]() { ++count2; } );
+   }
+
+   pool.wait( group1 );
+   checkCount( count1, 500UL );
+
+   pool.wait( group2 );
+   checkCount( count2, 500UL );
+
+   if( !group1.isEmpty() || !group2.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incomplete task group detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested task groups.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nested use of the thread pool, i.e. the scheduling of
+// tasks and the waiting for task groups from within scheduled tasks. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedTaskGroups()
+{
+   test_ = "Nested task groups";
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      ThreadPool pool( threads );
+      size_t result( 0UL );
+
+      TaskGroup group;
+      pool.schedule( group, [&pool,&result]() { result = fibonacci( pool, 15UL ); } );
+      pool.wait( group );
+
+      checkCount( result, 610UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conversion of textual CPU lists and of the execution of
+// tasks by pinned threads. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testAffinity()
+{
+   test_ = "Thread affinity";
+
+   // Conversion of valid CPU lists
+   {
+      const blaze::threadpool::Affinity cpus( blaze::threadpool::parseAffinity( "0-3,8,10-11" ) );
+
+      checkCount( cpus.size(), 7UL );
+      checkCount( cpus[0], 0UL );
+      checkCount( cpus[3], 3UL );
+      checkCount( cpus[4], 8UL );
+      checkCount( cpus[6], 11UL );
+   }
+
+   // Conversion of malformed CPU lists
+   {
+      checkCount( blaze::threadpool::parseAffinity( nullptr ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( ""      ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( "0-"    ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( "3-1"   ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( "0,,1"  ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( "0,1,"  ).size(), 0UL );
+      checkCount( blaze::threadpool::parseAffinity( "x"     ).size(), 0UL );
+   }
+
+   // Execution of tasks by pinned threads
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+      ThreadPool pool( threads, blaze::threadpool::parseAffinity( "compact" ) );
+      std::atomic<size_t> counter( 0UL );
+
+      for( size_t round=0UL; round<2UL; ++round )
+      {
+         TaskGroup group;
+
+         for( size_t i=0UL; i<100UL; ++i ) {
+            pool.schedule( group, [&counter]() { ++counter; } );
+         }
+
+         pool.wait( group );
+      }
+
+      checkCount( counter, 200UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param count The count to be checked.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Count error detected.
+*/
+void ClassTest::checkCount( size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid count detected\n"
+          << " Details:\n"
+          << "   Result:\n" << count << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Recursive, task parallel computation of the n-th Fibonacci number.
+//
+// \param pool The thread pool for the execution of the subtasks.
+// \param n The index of the Fibonacci number.
+// \return The n-th Fibonacci number.
+*/
+size_t ClassTest::fibonacci( ThreadPool& pool, size_t n )
+{
+   if( n < 2UL )
+      return n;
+
+   size_t a( 0UL );
+   size_t b( 0UL );
+
+   TaskGroup group;
+   pool.schedule( group, [&pool,&a,n]() { a = fibonacci( pool, n-1UL ); } );
+   pool.schedule( group, [&pool,&b,n]() { b = fibonacci( pool, n-2UL ); } );
+   pool.wait( group );
+
+   return a + b;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************